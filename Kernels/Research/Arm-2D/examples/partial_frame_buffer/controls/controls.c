@@ -46,6 +46,7 @@
 void controls_init(void)
 {
     busy_wheel_init();
+    spectrogram_init();
 }
 
 
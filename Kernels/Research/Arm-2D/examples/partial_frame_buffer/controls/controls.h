@@ -24,6 +24,7 @@
 /*============================ INCLUDES ======================================*/
 #include "./app_cfg.h"
 #include "./busy_wheel.h"
+#include "./spectrogram.h"
 
 /*============================ MACROS ========================================*/
 /*============================ MACROFIED FUNCTIONS ===========================*/
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2009-2021 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*============================ INCLUDES ======================================*/
+#include "./app_cfg.h"
+#include "./spectrogram.h"
+#include "arm_2d.h"
+
+#if defined(__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wpadded"
+#   pragma clang diagnostic ignored "-Wcast-qual"
+#   pragma clang diagnostic ignored "-Wcast-align"
+#   pragma clang diagnostic ignored "-Wmissing-field-initializers"
+#   pragma clang diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
+#   pragma clang diagnostic ignored "-Wmissing-braces"
+#   pragma clang diagnostic ignored "-Wunused-const-variable"
+#   pragma clang diagnostic ignored "-Wmissing-declarations"
+#   pragma clang diagnostic ignored "-Wmissing-variable-declarations"
+#endif
+
+/*============================ MACROS ========================================*/
+#define __LN10_DIV_10       (0.23025851f)
+#define __LUT_SIZE          256
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+#define __RGB565(__R, __G, __B)                                                 \
+            ((uint16_t)(   (((__R) & 0xF8) << 8)                                \
+                        |   (((__G) & 0xFC) << 3)                               \
+                        |   ((__B) >> 3)))
+
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+
+/*! \note The waterfall is a ring of rows: a new spectrum is written in the
+ *!       row above the previous one (wrapping around) and the other rows
+ *!       are never moved. Scrolling is only a change of s_hwNewest, the
+ *!       rows are shown with two tile copies (newest part first). Hence,
+ *!       only one row of the buffer is touched for each spectrum.
+ */
+ARM_NOINIT static arm_2d_color_rgb565_t
+    s_tWaterfallBuffer[SPECTROGRAM_WIDTH * SPECTROGRAM_HEIGHT];
+static const arm_2d_tile_t c_tWaterfall = {
+    .tRegion = {
+        .tSize = {
+            .iWidth = SPECTROGRAM_WIDTH,
+            .iHeight = SPECTROGRAM_HEIGHT
+        },
+    },
+    .tInfo.bIsRoot = true,
+    .phwBuffer = (uint16_t *)s_tWaterfallBuffer,
+};
+
+//! colours of the heat map, evenly spread on the LUT
+static const uint8_t c_chHeatMap[][3] = {
+    {  0,   0,   0},
+    {  0,   0, 255},
+    {  0, 255, 255},
+    {  0, 255,   0},
+    {255, 255,   0},
+    {255,   0,   0},
+    {255, 255, 255},
+};
+
+ARM_NOINIT static uint16_t s_hwColourLUT[__LUT_SIZE];
+ARM_NOINIT static uint16_t s_hwNewest;
+ARM_NOINIT static float s_fOffset;
+ARM_NOINIT static float s_fScale;
+/*============================ IMPLEMENTATION ================================*/
+
+
+void spectrogram_init(void)
+{
+    const uint_fast16_t hwSegments = dimof(c_chHeatMap) - 1;
+
+    for (uint_fast16_t n = 0; n < __LUT_SIZE; n++) {
+        uint_fast16_t hwPos = n * hwSegments;
+        uint_fast16_t hwIndex = hwPos / (__LUT_SIZE - 1);
+        uint_fast16_t hwFrac = hwPos % (__LUT_SIZE - 1);
+        uint_fast16_t hwNext = hwIndex < hwSegments ? hwIndex + 1 : hwIndex;
+        uint8_t chRGB[3];
+
+        for (uint_fast8_t c = 0; c < 3; c++) {
+            int32_t nStart = c_chHeatMap[hwIndex][c];
+            int32_t nStop = c_chHeatMap[hwNext][c];
+            chRGB[c] = (uint8_t)(nStart
+                     + ((nStop - nStart) * (int32_t)hwFrac) / (__LUT_SIZE - 1));
+        }
+
+        s_hwColourLUT[n] = __RGB565(chRGB[0], chRGB[1], chRGB[2]);
+    }
+
+    //! the input is ln(power): dB * ln(10) / 10
+    s_fOffset = SPECTROGRAM_DB_MIN * __LN10_DIV_10;
+    s_fScale = (float)(__LUT_SIZE - 1)
+             / ((SPECTROGRAM_DB_MAX - SPECTROGRAM_DB_MIN) * __LN10_DIV_10);
+    s_hwNewest = 0;
+
+    arm_2d_rgb16_fill_colour(&c_tWaterfall, NULL, s_hwColourLUT[0]);
+}
+
+void spectrogram_push(const float *pfLogPower, uint_fast16_t hwBins)
+{
+    ASSERT(NULL != pfLogPower);
+    ASSERT(hwBins > 0);
+
+    //! the new row is above the previous one
+    s_hwNewest = (s_hwNewest ? s_hwNewest : SPECTROGRAM_HEIGHT) - 1;
+
+    uint16_t *phwRow = (uint16_t *)s_tWaterfallBuffer
+                     + s_hwNewest * SPECTROGRAM_WIDTH;
+
+    for (uint_fast16_t x = 0; x < SPECTROGRAM_WIDTH; x++) {
+        /*! several bins for a column: keep the peak,
+         *! several columns for a bin: repeat it
+         */
+        uint_fast16_t hwFirst = (uint32_t)x * hwBins / SPECTROGRAM_WIDTH;
+        uint_fast16_t hwLast = (uint32_t)(x + 1) * hwBins / SPECTROGRAM_WIDTH;
+        float fPeak = pfLogPower[hwFirst];
+
+        for (uint_fast16_t n = hwFirst + 1; n < hwLast; n++) {
+            if (pfLogPower[n] > fPeak) {
+                fPeak = pfLogPower[n];
+            }
+        }
+
+        float fIndex = (fPeak - s_fOffset) * s_fScale;
+        if (fIndex <= 0.0f) {
+            phwRow[x] = s_hwColourLUT[0];
+        } else if (fIndex >= (float)(__LUT_SIZE - 1)) {
+            phwRow[x] = s_hwColourLUT[__LUT_SIZE - 1];
+        } else {
+            phwRow[x] = s_hwColourLUT[(uint_fast16_t)fIndex];
+        }
+    }
+}
+
+void spectrogram_show(  arm_2d_tile_t *ptTarget,
+                        const arm_2d_location_t *ptLocation)
+{
+    ASSERT(NULL != ptTarget);
+    arm_2d_tile_t tRows;
+    arm_2d_location_t tLocation = {0};
+
+    if (NULL != ptLocation) {
+        tLocation = *ptLocation;
+    }
+
+    //! from the newest row to the bottom of the ring
+    arm_2d_region_t tRegion = {
+        .tLocation = {
+            .iX = 0,
+            .iY = s_hwNewest,
+        },
+        .tSize = {
+            .iWidth = SPECTROGRAM_WIDTH,
+            .iHeight = SPECTROGRAM_HEIGHT - s_hwNewest,
+        },
+    };
+    arm_2d_tile_generate_child(&c_tWaterfall, &tRegion, &tRows, false);
+
+    tRegion.tLocation = tLocation;
+    arm_2d_rgb16_tile_copy( &tRows,
+                            ptTarget,
+                            &tRegion,
+                            ARM_2D_CP_MODE_COPY);
+
+    if (0 == s_hwNewest) {
+        return ;
+    }
+
+    //! the oldest rows, from the top of the ring
+    tRegion.tLocation.iX = 0;
+    tRegion.tLocation.iY = 0;
+    tRegion.tSize.iHeight = s_hwNewest;
+    arm_2d_tile_generate_child(&c_tWaterfall, &tRegion, &tRows, false);
+
+    tRegion.tLocation = tLocation;
+    tRegion.tLocation.iY += SPECTROGRAM_HEIGHT - s_hwNewest;
+    arm_2d_rgb16_tile_copy( &tRows,
+                            ptTarget,
+                            &tRegion,
+                            ARM_2D_CP_MODE_COPY);
+}
+
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#endif
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2009-2021 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __SPECTROGRAM_H__
+#define __SPECTROGRAM_H__
+
+/*============================ INCLUDES ======================================*/
+#include "./app_cfg.h"
+#include "arm_2d.h"
+/*============================ MACROS ========================================*/
+
+//! the waterfall size: one column per frequency, one row per spectrum
+#ifndef SPECTROGRAM_WIDTH
+#   define SPECTROGRAM_WIDTH                128
+#endif
+
+#ifndef SPECTROGRAM_HEIGHT
+#   define SPECTROGRAM_HEIGHT               64
+#endif
+
+//! the range of the power mapped to the colour LUT (in dB)
+#ifndef SPECTROGRAM_DB_MIN
+#   define SPECTROGRAM_DB_MIN               (-100.0f)
+#endif
+
+#ifndef SPECTROGRAM_DB_MAX
+#   define SPECTROGRAM_DB_MAX               (0.0f)
+#endif
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+
+extern
+void spectrogram_init(void);
+
+/*! \brief add a spectrum on top of the waterfall
+ *! \param pfLogPower the natural log of the power of the bins, i.e. the
+ *!        output of log_power_spectrum<float32_t>() of the FFT library
+ *! \param hwBins the number of bins (N/2+1 for a RFFT of length N)
+ */
+extern
+void spectrogram_push(const float *pfLogPower, uint_fast16_t hwBins);
+
+/*! \brief draw the waterfall, the newest spectrum is the top row
+ *! \param ptTarget the target tile (the partial frame buffer)
+ *! \param ptLocation the top-left corner of the waterfall in the target,
+ *!        passing NULL means (0, 0)
+ */
+extern
+void spectrogram_show(  arm_2d_tile_t *ptTarget,
+                        const arm_2d_location_t *ptLocation);
+
+#endif
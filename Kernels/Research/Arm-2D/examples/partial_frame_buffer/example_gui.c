@@ -18,6 +18,7 @@
 
 /*============================ INCLUDES ======================================*/
 #include <stdio.h>
+#include <math.h>
 #include "platform.h"
 #include "example_gui.h"
 #include "./display_adapter/display_adapter.h"
@@ -36,6 +37,11 @@
 #endif
 
 /*============================ MACROS ========================================*/
+
+//! the synthetic spectrum: the bins of a RFFT of length 2*SPECTRUM_HALF_LENGTH
+#define SPECTRUM_HALF_LENGTH        SPECTROGRAM_WIDTH
+#define SPECTRUM_BINS               (SPECTRUM_HALF_LENGTH + 1)
+
 /*============================ MACROFIED FUNCTIONS ===========================*/
 
 #define arm_2d_layer(__TILE_ADDR, __TRANS, __X, __Y, ...)                       \
@@ -107,6 +113,11 @@ const static arm_2d_tile_t c_tPictureSun = {
 extern const uint8_t c_bmpWhiteDot[19*20*sizeof(uint16_t)];
 extern const arm_2d_tile_t c_tPictureWhiteDot;
 
+/*! \note the spectra shown by the spectrogram: ln(power) of each bin, as
+ *!       given by log_power_spectrum<float32_t>() of the FFT library
+ */
+static float s_fLogPower[SPECTRUM_BINS];
+
 
 static arm_2d_layer_t s_ptRefreshLayers[] = {
     arm_2d_layer(&c_tPictureHeliun, 0, -50, -100),
@@ -176,6 +187,33 @@ void example_gui_init(void)
     }
 }
 
+/*! \brief the log power spectrum of a tone sweeping up and down the band
+ *!        above a rippled noise floor, in place of the spectrum of a real
+ *!        input
+ */
+static void example_update_spectrum(void)
+{
+    static uint16_t s_hwStep = 0;
+    //! the tone goes from bin 4 to bin SPECTRUM_BINS - 5 and back
+    const uint_fast16_t hwSpan = SPECTRUM_BINS - 9;
+    uint_fast16_t hwPos = s_hwStep % (2 * hwSpan);
+    float fTone = 4.0f + (float)(hwPos < hwSpan ? hwPos : 2 * hwSpan - hwPos);
+
+    s_hwStep++;
+
+    for (uint_fast16_t n = 0; n < SPECTRUM_BINS; n++) {
+        //! noise floor between -90 dB and -70 dB
+        float fNoise = 1.0e-8f * (1.0f + 0.9f * sinf(0.37f * (float)(n * 7 + s_hwStep)));
+        //! main lobe of the tone, -6 dB at one bin from its centre
+        float fDelta = (float)n - fTone;
+        float fPower = fNoise + 0.25f / (1.0f + fDelta * fDelta);
+
+        s_fLogPower[n] = logf(fPower);
+    }
+
+    spectrogram_push(s_fLogPower, SPECTRUM_BINS);
+}
+
 static void example_update_boxes(floating_range_t *ptBoxes, uint_fast16_t hwCount)
 {
     ASSERT(NULL != ptBoxes);
@@ -216,6 +254,7 @@ void example_gui_do_events(void)
     static uint32_t s_wCounter = 0;
 
     example_update_boxes(s_ptFloatingBoxes, dimof(s_ptFloatingBoxes));
+    example_update_spectrum();
     
     if (s_bTimeout) {                       //!< every 1024 ms
         s_bTimeout = false;
@@ -289,6 +328,15 @@ static void __draw_layers(   arm_2d_tile_t *ptFrameBuffer,
             }
         }
         
+        //! show the spectrogram at the bottom left of the screen
+        do {
+            arm_2d_location_t tLocation = {
+                .iX = 0,
+                .iY = APP_SCREEN_HEIGHT - SPECTROGRAM_HEIGHT,
+            };
+            spectrogram_show(ptFrameBuffer, &tLocation);
+        } while (0);
+
         //! show progress wheel
         busy_wheel_show(ptFrameBuffer);
         
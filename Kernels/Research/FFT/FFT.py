@@ -22,6 +22,9 @@ import numpy as np
 import itertools
 import scipy.fftpack
 import scipy.fft
+import scipy.signal
+from config.channelizer import prototypeFilter
+from config.mfcc import melFilters,dctMatrix
 import argparse
 import sys
 
@@ -117,14 +120,14 @@ def writeFFTForSignal(config,mode,sig,i,nb,signame):
     sigfft = sig 
     fftoutput = fft 
 
-    if mode == Tools.Q15 or mode == Tools.Q31:
+    if mode == Tools.Q15 or mode == Tools.Q31 or mode == Tools.Q7:
         fftoutput = fftoutput * scaling(nb)
 
     maxVal = np.max(np.abs(fft))
     sigifft = fft / maxVal / 2.0
     ifftoutput = sig / maxVal / 2.0
 
-    if mode == Tools.Q15 or mode == Tools.Q31:
+    if mode == Tools.Q15 or mode == Tools.Q31 or mode == Tools.Q7:
         ifftoutput = ifftoutput / 4.0
 
     config.writeInput(i, asReal(sigfft),"ComplexInputFFTSamples_%s_%d_" % (signame,nb))
@@ -141,14 +144,14 @@ def writeRFFTForSignal(config,mode,sig,i,nb,signame):
     sigfft = sig
     fftoutput = rfft 
 
-    if mode == Tools.Q15 or mode == Tools.Q31:
+    if mode == Tools.Q15 or mode == Tools.Q31 or mode == Tools.Q7:
         fftoutput = fftoutput * scaling(int(nb/2))
 
     maxVal = np.max(np.abs(rfft))
     sigifft = rfft / maxVal / 2.0
     ifftoutput = sig / maxVal / 2.0
 
-    if mode == Tools.Q15 or mode == Tools.Q31:
+    if mode == Tools.Q15 or mode == Tools.Q31 or mode == Tools.Q7:
         ifftoutput = ifftoutput / 4.0
 
     
@@ -280,7 +283,1004 @@ def writeRFFTTests(configs):
     i = i + 1
 
     return(i)
+
+# Pruned FFT : (length, wanted bins)
+# The bins must be the same as in the PrunedTests
+PRUNEDCFFT=[(256,[32,100]),
+            (256,[0,5,17,32,128,200,224,31]),
+            (120,list(range(10,16)))]
+PRUNEDRFFT=[(256,[0,7,32,128]),
+            (120,list(range(12,20)))]
+# Long lengths with a few bins near Nyquist (DFT of the bins).
+# Only for f32.
+PRUNEDLONGCFFT=[(4096,[2047,2049])]
+PRUNEDLONGRFFT=[(1024,[511,512])]
+
+def writePrunedTests(configs):
+    i = 1
+
+    for (nb,bins) in PRUNEDCFFT:
+        sig = noisySineSignal(0.05,0.7,nb) + 1j*noisySineSignal(0.05,0.3,nb)
+        sig = sig / 4.0
+        fft = scipy.fftpack.fft(sig)[bins]
+        for config,mode in configs:
+            fftoutput = fft
+            if mode == Tools.Q15 or mode == Tools.Q31:
+               fftoutput = fftoutput * scaling(nb)
+            config.writeInput(i, asReal(sig),"ComplexInputPrunedSamples_%d_" % nb)
+            config.writeInput(i, asReal(fftoutput),"ComplexOutputPrunedSamples_%d_" % nb)
+        i = i + 1
+
+    for (nb,bins) in PRUNEDRFFT:
+        sig = noisySineSignal(0.05,0.7,nb) / 4.0
+        rfft = scipy.fft.rfft(sig)[bins]
+        for config,mode in configs:
+            fftoutput = rfft
+            if mode == Tools.Q15 or mode == Tools.Q31:
+               fftoutput = fftoutput * scaling(int(nb/2))
+            config.writeInput(i, sig,"RealInputPrunedSamples_%d_" % nb)
+            config.writeInput(i, asReal(fftoutput),"ComplexOutputPrunedSamples_%d_" % nb)
+        i = i + 1
+
+    return(i)
+
+def writePrunedLongTests(config,i):
+    for (nb,bins) in PRUNEDLONGCFFT:
+        sig = noisySineSignal(0.05,0.7,nb) + 1j*noisySineSignal(0.05,0.3,nb)
+        sig = sig / 4.0
+        fft = scipy.fftpack.fft(sig)[bins]
+        config.writeInput(i, asReal(sig),"ComplexInputPrunedSamples_%d_" % nb)
+        config.writeInput(i, asReal(fft),"ComplexOutputPrunedSamples_%d_" % nb)
+        i = i + 1
+
+    for (nb,bins) in PRUNEDLONGRFFT:
+        sig = noisySineSignal(0.05,0.7,nb) / 4.0
+        rfft = scipy.fft.rfft(sig)[bins]
+        config.writeInput(i, sig,"RealInputPrunedSamples_%d_" % nb)
+        config.writeInput(i, asReal(rfft),"ComplexOutputPrunedSamples_%d_" % nb)
+        i = i + 1
+
+    return(i)
+
+def generatePrunedPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","Pruned","Pruned")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","Pruned","Pruned")
+    
+    configf64=Tools.Config(PATTERNDIR,PARAMDIR,"f64")
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+    configf16=Tools.Config(PATTERNDIR,PARAMDIR,"f16")
+    configq31=Tools.Config(PATTERNDIR,PARAMDIR,"q31")
+    configq15=Tools.Config(PATTERNDIR,PARAMDIR,"q15")
+     
+    print("Pruned")
+
+    allConfigs=[(configf64,Tools.F64),
+        (configf32,Tools.F32),
+        (configf16,Tools.F16),
+        (configq31,Tools.Q31),
+        (configq15,Tools.Q15)]
+
+    i = writePrunedTests(allConfigs)
+    writePrunedLongTests(configf32,i)
+
+# Sliding DFT : (length of the window, tracked bins, number of input samples)
+# The bins must be the same as in the SDFTTests
+SDFTS=[(64,[0,5,8,31,32],200),
+       (60,[1,7,8,20,30],4096)]
+
+def writeSDFTTests(configs):
+    i = 1
+
+    for (nb,bins,nbSamples) in SDFTS:
+        sig = noisySineSignal(0.05,0.7,nbSamples)
+        sig = sig / 4.0
+        # DFT of the last nb samples
+        dft = scipy.fftpack.fft(sig[-nb:])[bins]
+        for config,mode in configs:
+            dftoutput = dft
+            if mode == Tools.Q15 or mode == Tools.Q31:
+               dftoutput = dftoutput * scaling(nb)
+            config.writeInput(i, sig,"RealInputSDFTSamples_%d_" % nb)
+            config.writeInput(i, asReal(dftoutput),"ComplexOutputSDFTSamples_%d_" % nb)
+        i = i + 1
+
+    return(i)
+
+def generateSDFTPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","SDFT","SDFT")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","SDFT","SDFT")
+    
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+    configq31=Tools.Config(PATTERNDIR,PARAMDIR,"q31")
+    configq15=Tools.Config(PATTERNDIR,PARAMDIR,"q15")
+     
+    print("SDFT")
+
+    allConfigs=[(configf32,Tools.F32),
+        (configq31,Tools.Q31),
+        (configq15,Tools.Q15)]
+
+    writeSDFTTests(allConfigs)
+   
+# Welch estimators : (length of a segment, overlap, window, number of input samples)
+# The configurations must be the same as in the WelchTests
+WELCHS=[(64,32,"hann",1000),
+        (128,96,"boxcar",2000)]
+
+def writeWelchTests(configs):
+    i = 1
+
+    for (nb,overlap,window,nbSamples) in WELCHS:
+        nbBins = int(nb/2) + 1
+        x = noisySineSignal(0.05,0.7,nbSamples) / 4.0
+        # y is a delayed and attenuated x with some independent noise
+        y = 0.5 * np.roll(x,3) + 0.02 * noiseSignal(nbSamples)
+        w = scipy.signal.get_window(window,nb)
+
+        # Two-sided spectra without detrend : the first nb/2+1 bins
+        # are not doubled like in the Welch estimators of the library
+        welchargs = dict(window=w,nperseg=nb,noverlap=overlap,detrend=False,scaling='density')
+        _,pxx = scipy.signal.welch(x,return_onesided=False,**welchargs)
+        # The library is computing X conj(Y) and scipy conj(X) Y
+        _,pxy = scipy.signal.csd(y,x,return_onesided=False,**welchargs)
+        _,cxy = scipy.signal.coherence(x,y,window=w,nperseg=nb,noverlap=overlap,detrend=False)
+
+        for config,mode in configs:
+            config.writeInput(i, x,"RealInputXWelchSamples_%d_" % nb)
+            config.writeInput(i, y,"RealInputYWelchSamples_%d_" % nb)
+            # The rectangular window is tested with a NULL window
+            if window != "boxcar":
+               config.writeInput(i, w,"WindowWelchSamples_%d_" % nb)
+            config.writeInput(i, pxx[:nbBins],"PSDWelchSamples_%d_" % nb)
+            config.writeInput(i, asReal(pxy[:nbBins]),"CSDWelchSamples_%d_" % nb)
+            config.writeInput(i, cxy,"CoherenceWelchSamples_%d_" % nb)
+        i = i + 1
+
+    return(i)
+
+def generateWelchPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","Welch","Welch")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","Welch","Welch")
+    
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+     
+    print("Welch")
+
+    allConfigs=[(configf32,Tools.F32)]
+
+    writeWelchTests(allConfigs)
+   
+# Channelizers : (number of channels, taps of a branch, hop, number of input samples)
+# The configurations must be the same as in the ChannelizerTests
+# and listed in config.yaml
+CHANNELIZERS=[(16,8,16,600),
+              (32,8,12,600)]
+
+# Output of channel k sampled at the last input sample n of each hop :
+# sum_l h[l] x[n-l] exp(-2 i pi k (n-l) / M)
+def channelizerReference(x,nbChannels,nbTaps,hop):
+    h = prototypeFilter(nbChannels,nbTaps)
+    m = np.arange(len(x))
+    k = np.arange(nbChannels).reshape(nbChannels,1)
+    shifted = x * np.exp(-2j * np.pi * k * m / nbChannels)
+    out = []
+    for n in range(hop-1,len(x),hop):
+        first = max(0,n - len(h) + 1)
+        # Samples before the start of the stream are zero
+        segment = shifted[:,first:n+1][:,::-1]
+        out.append(np.dot(segment,h[:n+1-first]))
+    return(np.array(out))
+
+def writeChannelizerTests(configs):
+    i = 1
+
+    for (nbChannels,nbTaps,hop,nbSamples) in CHANNELIZERS:
+        # Tone at the center of channel 3 and a tone between
+        # the channels 6 and 7
+        m = np.arange(nbSamples)
+        sig = 0.7 * np.exp(2j * np.pi * 3 * m / nbChannels) \
+            + 0.3 * np.exp(2j * np.pi * 6.5 * m / nbChannels) \
+            + 0.05 * (noiseSignal(nbSamples) + 1j * noiseSignal(nbSamples))
+        sig = sig / 4.0
+        out = channelizerReference(sig,nbChannels,nbTaps,hop)
+        for config,mode in configs:
+            config.writeInput(i, asReal(sig),"ComplexInputChannelizerSamples_%d_%d_" % (nbChannels,nbTaps))
+            config.writeInput(i, asReal(out),"ComplexOutputChannelizerSamples_%d_%d_" % (nbChannels,nbTaps))
+        i = i + 1
+
+    return(i)
+
+def generateChannelizerPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","Channelizer","Channelizer")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","Channelizer","Channelizer")
+    
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+    configf16=Tools.Config(PATTERNDIR,PARAMDIR,"f16")
+     
+    print("Channelizer")
+
+    allConfigs=[(configf32,Tools.F32),
+        (configf16,Tools.F16)]
+
+    writeChannelizerTests(allConfigs)
+   
+# Resamplers : (nIn, nOut, overlap, transition, number of input samples)
+# The configurations must be the same as in the ResamplerTests
+RESAMPLERS=[(128,384,64,8,1000),
+            (160,96,60,6,1000)]
+
+# Same algorithm as the resampler in numpy : overlap-save frames
+# with a truncated or zero padded spectrum
+def resamplerReference(x,nIn,nOut,overlap,transition):
+    hopIn = nIn - overlap
+    hopOut = hopIn * nOut // nIn
+    nbBins = min(nIn,nOut) // 2
+    first = (nOut - hopOut) // 2
+    scale = nOut / nIn
+
+    k = np.arange(nbBins + 1)
+    t = np.clip((k + transition - nbBins) / transition,0,1)
+    gain = 0.5 * scale * (1.0 + np.cos(np.pi * t))
+
+    # Half of the overlap is zero history
+    sig = np.concatenate((np.zeros(overlap // 2),x))
+    out = []
+    for start in range(0,len(sig) - nIn + 1,hopIn):
+        spectrum = np.zeros(nOut // 2 + 1,dtype=complex)
+        spectrum[:nbBins+1] = np.fft.rfft(sig[start:start+nIn])[:nbBins+1] * gain
+        out.append(np.fft.irfft(spectrum,nOut)[first:first+hopOut])
+    return(np.concatenate(out))
+
+def writeResamplerTests(configs):
+    i = 1
+
+    for (nIn,nOut,overlap,transition,nbSamples) in RESAMPLERS:
+        sig = noisySineSignal(0.05,0.7,nbSamples) / 4.0
+        out = resamplerReference(sig,nIn,nOut,overlap,transition)
+        for config,mode in configs:
+            config.writeInput(i, sig,"RealInputResamplerSamples_%d_%d_" % (nIn,nOut))
+            config.writeInput(i, out,"RealOutputResamplerSamples_%d_%d_" % (nIn,nOut))
+        i = i + 1
+
+    return(i)
+
+def generateResamplerPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","Resampler","Resampler")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","Resampler","Resampler")
+    
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+    configf16=Tools.Config(PATTERNDIR,PARAMDIR,"f16")
+     
+    print("Resampler")
+
+    allConfigs=[(configf32,Tools.F32),
+        (configf16,Tools.F16)]
+
+    writeResamplerTests(allConfigs)
+   
+# Analytic signal and Hilbert transform : lengths of the tests
+# In fixed point, the output is the analytic signal divided by 2 with the
+# scaling of cifft(cfft(x)) : 2*format bits are lost, so only short
+# lengths are tested in q15.
+# The lengths must be the same as in the AnalyticTests
+ANALYTICSIZES=[64,60]
+ANALYTICSIZESQ15=[8,16]
+
+def writeAnalyticTests(configs):
+    signals = {}
+    for nb in set(ANALYTICSIZES + ANALYTICSIZESQ15):
+        signals[nb] = noisySineSignal(0.05,0.7,nb) / 4.0
+
+    for config,mode in configs:
+        sizes = ANALYTICSIZES
+        if mode == Tools.Q15:
+           sizes = ANALYTICSIZESQ15
+        i = 1
+        for nb in sizes:
+            sig = signals[nb]
+            analytic = scipy.signal.hilbert(sig)
+            if mode == Tools.Q15 or mode == Tools.Q31:
+               analytic = analytic / 2.0
+            config.writeInput(i, sig,"RealInputAnalyticSamples_%d_" % nb)
+            config.writeInput(i, asReal(analytic),"ComplexOutputAnalyticSamples_%d_" % nb)
+            config.writeInput(i, np.imag(analytic),"RealOutputHilbertSamples_%d_" % nb)
+            i = i + 1
+
+def generateAnalyticPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","Analytic","Analytic")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","Analytic","Analytic")
+    
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+    configf16=Tools.Config(PATTERNDIR,PARAMDIR,"f16")
+    configq31=Tools.Config(PATTERNDIR,PARAMDIR,"q31")
+    configq15=Tools.Config(PATTERNDIR,PARAMDIR,"q15")
+     
+    print("Analytic")
+
+    allConfigs=[(configf32,Tools.F32),
+        (configf16,Tools.F16),
+        (configq31,Tools.Q31),
+        (configq15,Tools.Q15)]
+
+    writeAnalyticTests(allConfigs)
+   
+# Correlations : (kind, nx, ny, first lag, number of lags, length of the RFFT)
+# The direct method is used for the partial lags and the RFFT for the others.
+# The streaming correlation is using a template of ny samples and
+# the number of lags is the number of input samples.
+# The configurations must be the same as in the XCorrTests
+XCORRS=[("xcorr",200,100,-99,299,512),
+        ("xcorr",200,100,-10,21,512),
+        ("autocorr",200,0,0,100,512),
+        ("stream",1000,32,0,0,128)]
+
+def writeXCorrTests(configs):
+    i = 1
+
+    for (kind,nx,ny,firstLag,nbLags,nb) in XCORRS:
+        x = noisySineSignal(0.05,0.7,nx) / 4.0
+        if kind == "autocorr":
+           y = x
+        elif kind == "stream":
+           # The template is a part of the stream
+           y = x[300:300+ny]
+        else:
+           y = noiseSignal(ny) / 4.0
+
+        # np.correlate is giving the lags -(ny-1) to nx-1
+        full = np.correlate(x,y,'full')
+        if kind == "stream":
+           # Segments of nb samples starting every nb-ny+1 samples
+           hop = nb - ny + 1
+           nbOut = ((nx - ny + 1) // hop) * hop
+           out = full[len(y)-1:len(y)-1+nbOut]
+        else:
+           out = full[len(y)-1+firstLag:len(y)-1+firstLag+nbLags]
+
+        for config,mode in configs:
+            config.writeInput(i, x,"RealInputXCorrSamples_%s_" % kind)
+            if kind != "autocorr":
+               config.writeInput(i, y,"RealInputYCorrSamples_%s_" % kind)
+            config.writeInput(i, out,"RealOutputCorrSamples_%s_" % kind)
+        i = i + 1
+
+    return(i)
+
+def generateXCorrPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","XCorr","XCorr")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","XCorr","XCorr")
+    
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+    configf16=Tools.Config(PATTERNDIR,PARAMDIR,"f16")
+     
+    print("XCorr")
+
+    allConfigs=[(configf32,Tools.F32),
+        (configf16,Tools.F16)]
+
+    writeXCorrTests(allConfigs)
+   
+# Zoom FFT : (center, zoom factor, taps per decimated sample, length of the CFFT,
+# window, number of input samples)
+# The configurations must be the same as in the ZoomTests
+ZOOMS=[(0.125,8,8,64,"hann",1600),
+       (-0.2,4,6,60,"boxcar",1000)]
+
+# Same computation as the zoom FFT in numpy : decimated samples
+# computed at the last input sample of each block of decimation samples
+# by a FIR with the heterodyne folded into its coefficients and rotated
+# by an oscillator at the decimated rate.
+def zoomReference(x,center,decimation,nbTaps,nb,window):
+    length = decimation * nbTaps
+    l = np.arange(length)
+    middle = 0.5 * (length - 1)
+    # Blackman windowed sinc with a cutoff at 1/(2 decimation)
+    t = (l - middle) / decimation
+    w = 2.0 * np.pi * (l + 1) / (length + 1)
+    h = np.sinc(t) * (0.42 - 0.5 * np.cos(w) + 0.08 * np.cos(2.0 * w))
+    h = h / np.sum(h) * np.exp(2j * np.pi * center * l)
+
+    # The history before the first sample is zero
+    sig = np.concatenate((np.zeros(length),x))
+    nbDecimated = (len(x) // (decimation * nb)) * nb
+    y = np.zeros(nbDecimated,dtype=complex)
+    for m in range(nbDecimated):
+        last = length + (m + 1) * decimation - 1
+        y[m] = np.dot(h,sig[last - l]) * np.exp(-2j * np.pi * center * decimation * m)
+
+    frames = y.reshape(-1,nb) * window
+    return(np.fft.fft(frames,axis=1).reshape(-1))
+
+def writeZoomTests(configs):
+    i = 1
+
+    for (center,decimation,nbTaps,nb,window,nbSamples) in ZOOMS:
+        sig = noisySineSignal(0.05,0.7,nbSamples) / 4.0
+        w = scipy.signal.get_window(window,nb)
+        out = zoomReference(sig,center,decimation,nbTaps,nb,w)
+        for config,mode in configs:
+            config.writeInput(i, sig,"RealInputZoomSamples_%d_%d_" % (decimation,nb))
+            # The rectangular window is tested with a NULL window
+            if window != "boxcar":
+               config.writeInput(i, w,"WindowZoomSamples_%d_%d_" % (decimation,nb))
+            config.writeInput(i, asReal(out),"ComplexOutputZoomSamples_%d_%d_" % (decimation,nb))
+        i = i + 1
+
+    return(i)
+
+def generateZoomPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","Zoom","Zoom")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","Zoom","Zoom")
+    
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+    configf16=Tools.Config(PATTERNDIR,PARAMDIR,"f16")
+     
+    print("Zoom")
+
+    allConfigs=[(configf32,Tools.F32),
+        (configf16,Tools.F16)]
+
+    writeZoomTests(allConfigs)
+   
+# Mixed precision FFTs : lengths of the CFFT and RFFT tests
+# The lengths must be the same as in the MixedTests
+MIXEDSIZES=[256,120]
+
+def writeMixedTests(configs):
+    i = 1
+
+    for nb in MIXEDSIZES:
+        sig = noisySineSignal(0.05,0.7,nb)
+        sigc = np.array([complex(x) for x in sig])
+        for config,mode in configs:
+            writeFFTForSignal(config,mode,sigc,i,nb,"Noisy")
+            writeRFFTForSignal(config,mode,sig,i,nb,"Noisy")
+        i = i + 1
+
+    return(i)
+
+def generateMixedPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","Mixed","Mixed")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","Mixed","Mixed")
+    
+    configf16=Tools.Config(PATTERNDIR,PARAMDIR,"f16")
+    configq31=Tools.Config(PATTERNDIR,PARAMDIR,"q31")
+     
+    print("Mixed")
+
+    allConfigs=[(configf16,Tools.F16),
+       (configq31,Tools.Q31)]
+
+    writeMixedTests(allConfigs)
    
+# Q7 FFTs : lengths of the CFFT and RFFT tests
+# The lengths must be the same as in the FFTTestsQ7
+# The inverse FFTs are only tested for the first length : the
+# output is scaled by 2^-format twice and only a few bits remain
+# for longer lengths.
+Q7SIZES=[4,6,16]
+
+# The Q7 patterns are not divided by 4 like the other ones
+# (with only 8 bits, the outputs would be a few LSB)
+def writeQ7FFTForSignal(config,sig,i,nb,fft,signame,kind):
+    fftoutput = fft * scaling(nb if kind == "FFT" else int(nb/2))
+
+    maxVal = np.max(np.abs(fft))
+    sigifft = fft / maxVal * 0.99
+    ifftoutput = sig / maxVal * 0.99 / 4.0
+
+    if kind == "FFT":
+       config.writeInput(i, asReal(sig),"ComplexInputFFTSamples_%s_%d_" % (signame,nb))
+       config.writeInput(i, asReal(fftoutput),"ComplexOutputFFTSamples_%s_%d_" % (signame,nb))
+       if i == 1:
+          config.writeInput(i, asReal(sigifft),"ComplexInputIFFTSamples_%s_%d_" % (signame,nb))
+          config.writeInput(i, asReal(ifftoutput),"ComplexOutputIFFTSamples_%s_%d_" % (signame,nb))
+    else:
+       config.writeInput(i, asReal(sig),"RealInputRFFTSamples_%s_%d_" % (signame,nb))
+       config.writeInput(i, asReal(fftoutput),"ComplexOutputRFFTSamples_%s_%d_" % (signame,nb))
+       if i == 1:
+          config.writeInput(i, asReal(sigifft),"ComplexInputRIFFTSamples_%s_%d_" % (signame,nb))
+          config.writeInput(i, asReal(ifftoutput),"RealOutputRIFFTSamples_%s_%d_" % (signame,nb))
+
+def writeQ7Tests(configs):
+    i = 1
+
+    for nb in Q7SIZES:
+        sig = noisySineSignal(0.05,0.7,nb)
+        sigc = np.array([complex(x) for x in sig])
+        for config,mode in configs:
+            writeQ7FFTForSignal(config,sigc,i,nb,scipy.fftpack.fft(sigc),"Noisy","FFT")
+            writeQ7FFTForSignal(config,sig,i,nb,scipy.fft.rfft(sig),"Noisy","RFFT")
+        i = i + 1
+
+    return(i)
+
+def generateQ7Patterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","Q7","FFT")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","Q7","FFT")
+    
+    configq7=Tools.Config(PATTERNDIR,PARAMDIR,"q7")
+     
+    print("Q7")
+
+    allConfigs=[(configq7,Tools.Q7)]
+
+    writeQ7Tests(allConfigs)
+   
+# FFT jobs scheduler : plans of the jobs (transform, length)
+# and number of jobs of each plan.
+# The plans must be the same as in the SchedulerTests
+SCHEDULERPLANS=[("cfft",64),("cifft",60),("rfft",128),("rifft",120)]
+SCHEDULERREPEAT=3
+
+# The inputs and outputs of all the jobs are concatenated.
+# The jobs of the different plans are interleaved.
+def writeSchedulerTests(configs):
+    inputs=[]
+    refs=[]
+
+    for r in range(SCHEDULERREPEAT):
+        for kind,nb in SCHEDULERPLANS:
+            sig = noisySineSignal(0.05,0.7,nb)
+            if kind == "cfft":
+               sigc = np.array([complex(x) for x in sig])
+               inputs.append(asReal(sigc))
+               refs.append(asReal(scipy.fftpack.fft(sigc)))
+            if kind == "cifft":
+               sigc = np.array([complex(x) for x in sig])
+               fft = scipy.fftpack.fft(sigc)
+               inputs.append(asReal(fft))
+               refs.append(asReal(sigc))
+            if kind == "rfft":
+               inputs.append(sig)
+               refs.append(asReal(scipy.fft.rfft(sig)))
+            if kind == "rifft":
+               inputs.append(asReal(scipy.fft.rfft(sig)))
+               refs.append(sig)
+
+    for config,mode in configs:
+        config.writeInput(1, np.hstack(inputs),"InputSamples_")
+        config.writeInput(1, np.hstack(refs),"RefSamples_")
+
+def generateSchedulerPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","Scheduler","Scheduler")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","Scheduler","Scheduler")
+    
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+     
+    print("Scheduler")
+
+    allConfigs=[(configf32,Tools.F32)]
+
+    writeSchedulerTests(allConfigs)
+   
+# CFFT 3D : [depth, rows, columns] of the tests
+# The sizes must be the same as in the CFFT3DTests
+# In q15, the output of the inverse FFT is scaled by 2^-format
+# twice so it is only tested for the smallest volume.
+FFT3DSIZES=[(4,8,16),(16,16,16)]
+FFT3DSIZESQ15=[(4,8,16),(2,4,4)]
+
+def writeFFT3DForSignal(config,mode,sig,i,depth,rows,cols,signame,inverse):
+
+    fft=scipy.fft.fftn(sig)
+
+    sigfft = sig 
+    fftoutput = fft 
+
+    sigifft = sig
+    ifftoutput = scipy.fft.ifftn(sigifft)
+
+    if mode == Tools.Q15 or mode == Tools.Q31:
+        fftoutput = fftoutput * scaling(depth) * scaling(rows) * scaling(cols)
+        ifftoutput = ifftoutput / 4.0
+
+    config.writeInput(i, asReal2D(sigfft),"ComplexInputFFTSamples_%s_%d_%d_%d_" % (signame,depth,rows,cols))
+    config.writeInput(i, asReal2D(fftoutput),"ComplexOutputFFTSamples_%s_%d_%d_%d_" % (signame,depth,rows,cols))
+
+    if inverse:
+       config.writeInput(i, asReal2D(sigifft),"ComplexInputIFFTSamples_%s_%d_%d_%d_" % (signame,depth,rows,cols))
+       config.writeInput(i, asReal2D(ifftoutput),"ComplexOutputIFFTSamples_%s_%d_%d_%d_" % (signame,depth,rows,cols))
+
+def writeCFFT3DTests(configs,sizes,inverseSizes):
+    i = 1
+
+    for (depth,rows,cols) in sizes:
+        [Z, Y, X] = np.meshgrid(2 * np.pi * np.arange(depth) / depth,
+                 2 * np.pi * np.arange(rows) / rows,
+                 2 * np.pi * np.arange(cols) / cols,indexing="ij")
+
+        sig = Tools.normalize(np.sin(X) + np.cos(2*Y) + np.sin(Z) + np.random.uniform(0, 1, X.shape))
+        sigc = sig.astype(complex)
+        
+        for config,mode in configs:
+            writeFFT3DForSignal(config,mode,sigc,i,depth,rows,cols,"Noisy",(depth,rows,cols) in inverseSizes)
+        i = i + 1
+
+    return(i)
+
+def generateCFFT3DPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","CFFT3D","CFFT3D")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","CFFT3D","CFFT3D")
+    
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+    configq15=Tools.Config(PATTERNDIR,PARAMDIR,"q15")
+     
+    print("CFFT3D")
+
+    writeCFFT3DTests([(configf32,Tools.F32)],FFT3DSIZES,FFT3DSIZES)
+    writeCFFT3DTests([(configq15,Tools.Q15)],FFT3DSIZESQ15,FFT3DSIZESQ15[-1:])
+   
+# Pair of real FFTs : lengths of the tests
+# The lengths must be even and the same as in the RFFTPairTests
+PAIRSIZES=[64,60]
+
+def writePairTests(configs):
+    i = 1
+    for nb in PAIRSIZES:
+        sig1 = noisySineSignal(0.05,0.7,nb) / 4.0
+        sig2 = stepSignal(0.5,nb) / 4.0
+        rfft1 = scipy.fft.rfft(sig1)
+        rfft2 = scipy.fft.rfft(sig2)
+        for config,mode in configs:
+            # out1 followed by out2
+            fftoutput = np.hstack([asReal(rfft1),asReal(rfft2)])
+            if mode == Tools.Q15 or mode == Tools.Q31:
+               fftoutput = fftoutput * scaling(nb)
+            config.writeInput(i, sig1,"RealInputPairSamples_1_%d_" % nb)
+            config.writeInput(i, sig2,"RealInputPairSamples_2_%d_" % nb)
+            config.writeInput(i, fftoutput,"ComplexOutputPairSamples_%d_" % nb)
+        i = i + 1
+
+def generatePairPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","RFFTPair","RFFTPair")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","RFFTPair","RFFTPair")
+    
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+    configf16=Tools.Config(PATTERNDIR,PARAMDIR,"f16")
+    configq31=Tools.Config(PATTERNDIR,PARAMDIR,"q31")
+    configq15=Tools.Config(PATTERNDIR,PARAMDIR,"q15")
+     
+    print("RFFT Pair")
+
+    allConfigs=[(configf32,Tools.F32),
+        (configf16,Tools.F16),
+        (configq31,Tools.Q31),
+        (configq15,Tools.Q15)]
+
+    writePairTests(allConfigs)
+
+# Split complex format : lengths of the tests
+# The lengths must be the same as in the SplitTests
+SPLITSIZES=[64,60]
+
+def writeSplitTests(configs):
+    i = 1
+    for nb in SPLITSIZES:
+        sig = noisySineSignal(0.05,0.7,nb) + 1j*noisySineSignal(0.05,0.3,nb)
+        sig = sig / 4.0
+        fft = scipy.fftpack.fft(sig)
+        maxVal = np.max(np.abs(fft))
+        sigifft = fft / maxVal / 2.0
+        for config,mode in configs:
+            fftoutput = fft
+            ifftoutput = sig / maxVal / 2.0
+            if mode == Tools.Q15 or mode == Tools.Q31:
+               fftoutput = fftoutput * scaling(nb)
+               ifftoutput = ifftoutput / 4.0
+            # The real parts followed by the imaginary parts
+            config.writeInput(i, np.hstack([np.real(sig),np.imag(sig)]),"SplitInputFFTSamples_%d_" % nb)
+            config.writeInput(i, np.hstack([np.real(fftoutput),np.imag(fftoutput)]),"SplitOutputFFTSamples_%d_" % nb)
+            config.writeInput(i, np.hstack([np.real(sigifft),np.imag(sigifft)]),"SplitInputIFFTSamples_%d_" % nb)
+            config.writeInput(i, np.hstack([np.real(ifftoutput),np.imag(ifftoutput)]),"SplitOutputIFFTSamples_%d_" % nb)
+        i = i + 1
+
+def generateSplitPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","Split","Split")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","Split","Split")
+    
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+    configf16=Tools.Config(PATTERNDIR,PARAMDIR,"f16")
+    configq31=Tools.Config(PATTERNDIR,PARAMDIR,"q31")
+    configq15=Tools.Config(PATTERNDIR,PARAMDIR,"q15")
+     
+    print("Split")
+
+    allConfigs=[(configf32,Tools.F32),
+        (configf16,Tools.F16),
+        (configq31,Tools.Q31),
+        (configq15,Tools.Q15)]
+
+    writeSplitTests(allConfigs)
+
+# Power spectrum : lengths of the tests
+# In fixed point, the output is |X|^2 / 2 where X has the scaling of the RFFT.
+# The log power spectrum is only tested in floating point.
+# In q15, the power has very few bits with the scaling of the mixed radix
+# RFFT of 120 samples : 64 is used instead.
+# The lengths must be the same as in the PowerTests
+POWERSIZES=[256,120]
+POWERSIZESQ15=[256,64]
+
+def writePowerTests(configs):
+    for config,mode in configs:
+        sizes = POWERSIZES
+        if mode == Tools.Q15:
+           sizes = POWERSIZESQ15
+        i = 1
+        for nb in sizes:
+            sig = noisySineSignal(0.05,0.7,nb) / 4.0
+            window = scipy.signal.get_window("hann",nb)
+            rect = np.abs(scipy.fft.rfft(sig))**2
+            hann = np.abs(scipy.fft.rfft(sig*window))**2
+            config.writeInput(i, sig,"RealInputPowerSamples_%d_" % nb)
+            config.writeInput(i, window,"WindowPowerSamples_%d_" % nb)
+            if mode == Tools.Q15 or mode == Tools.Q31:
+               s = scaling(int(nb/2))
+               config.writeInput(i, rect * s * s / 2.0,"RealOutputPowerRectSamples_%d_" % nb)
+               config.writeInput(i, hann * s * s / 2.0,"RealOutputPowerHannSamples_%d_" % nb)
+            else:
+               config.writeInput(i, rect,"RealOutputPowerRectSamples_%d_" % nb)
+               config.writeInput(i, hann,"RealOutputPowerHannSamples_%d_" % nb)
+               config.writeInput(i, np.log(rect + 1.0e-12),"RealOutputLogPowerRectSamples_%d_" % nb)
+               config.writeInput(i, np.log(hann + 1.0e-12),"RealOutputLogPowerHannSamples_%d_" % nb)
+            i = i + 1
+
+def generatePowerPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","Power","Power")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","Power","Power")
+    
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+    configf16=Tools.Config(PATTERNDIR,PARAMDIR,"f16")
+    configq31=Tools.Config(PATTERNDIR,PARAMDIR,"q31")
+    configq15=Tools.Config(PATTERNDIR,PARAMDIR,"q15")
+     
+    print("Power")
+
+    allConfigs=[(configf32,Tools.F32),
+        (configf16,Tools.F16),
+        (configq31,Tools.Q31),
+        (configq15,Tools.Q15)]
+
+    writePowerTests(allConfigs)
+
+# The configurations must be in config.yaml
+# [fftLen, nbMel, nbDct, sampleRate, fmin, fmax]
+MFCCCONFIGS=[[512,40,13,16000,20,8000]]
+
+# Mel filters as a matrix built from the nonzero weights
+def melMatrix(nbSamples,nbMel,sampleRate,fmin,fmax):
+    pos,lengths,coefs=melFilters(nbSamples,nbMel,sampleRate,fmin,fmax)
+    result = np.zeros((nbMel,nbSamples // 2 + 1))
+    k = 0
+    for m in range(nbMel):
+        result[m,pos[m]:pos[m]+lengths[m]] = coefs[k:k+lengths[m]]
+        k = k + lengths[m]
+    return(result)
+
+def writeMfccTests(configs):
+    i = 1
+    for (nb,nbMel,nbDct,sampleRate,fmin,fmax) in MFCCCONFIGS:
+        sig = noisySineSignal(0.05,0.7,nb) / 4.0
+        window = scipy.signal.get_window("hann",nb)
+        mel = melMatrix(nb,nbMel,sampleRate,fmin,fmax)
+        dct = dctMatrix(nbDct,nbMel)
+        rect = np.abs(scipy.fft.rfft(sig))**2
+        hann = np.abs(scipy.fft.rfft(sig*window))**2
+        rect = np.dot(dct,np.log(np.dot(mel,rect) + 1.0e-12))
+        hann = np.dot(dct,np.log(np.dot(mel,hann) + 1.0e-12))
+        for config,mode in configs:
+            config.writeInput(i, sig,"RealInputMfccSamples_%d_" % nb)
+            config.writeInput(i, window,"WindowMfccSamples_%d_" % nb)
+            config.writeInput(i, rect,"MfccRectSamples_%d_" % nb)
+            config.writeInput(i, hann,"MfccHannSamples_%d_" % nb)
+        i = i + 1
+
+def generateMfccPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","MFCC","MFCC")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","MFCC","MFCC")
+    
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+    configf16=Tools.Config(PATTERNDIR,PARAMDIR,"f16")
+     
+    print("MFCC")
+
+    allConfigs=[(configf32,Tools.F32),
+        (configf16,Tools.F16)]
+
+    writeMfccTests(allConfigs)
+
+# Multi-channel FFTs : [length, number of channels]
+# The channels are interleaved in the inputs.
+# The CFFT outputs are interleaved and the RFFT outputs
+# are one after the other.
+# The configurations must be the same as in the MultiTests
+MULTICONFIGS=[[64,2],[60,3]]
+MULTIFREQS=[0.7,0.3,0.5]
+
+def writeMultiTests(configs):
+    i = 1
+    for (nb,nbChannels) in MULTICONFIGS:
+        csig = np.zeros((nb,nbChannels),dtype=complex)
+        rsig = np.zeros((nb,nbChannels))
+        for c in range(nbChannels):
+            csig[:,c] = noisySineSignal(0.05,MULTIFREQS[c],nb) + 1j*noisySineSignal(0.05,MULTIFREQS[c]/2.0,nb)
+            rsig[:,c] = noisySineSignal(0.05,MULTIFREQS[c],nb)
+        csig = csig / 4.0
+        rsig = rsig / 4.0
+        fft = scipy.fft.fft(csig,axis=0)
+        maxVal = np.max(np.abs(fft))
+        sigifft = fft / maxVal / 2.0
+        rfft = scipy.fft.rfft(rsig,axis=0)
+        for config,mode in configs:
+            fftoutput = fft
+            ifftoutput = csig / maxVal / 2.0
+            rfftoutput = rfft
+            if mode == Tools.Q15 or mode == Tools.Q31:
+               fftoutput = fftoutput * scaling(nb)
+               ifftoutput = ifftoutput / 4.0
+               rfftoutput = rfftoutput * scaling(int(nb/2))
+            config.writeInput(i, asReal(csig),"ComplexInputMultiFFTSamples_%d_%d_" % (nb,nbChannels))
+            config.writeInput(i, asReal(fftoutput),"ComplexOutputMultiFFTSamples_%d_%d_" % (nb,nbChannels))
+            config.writeInput(i, asReal(sigifft),"ComplexInputMultiIFFTSamples_%d_%d_" % (nb,nbChannels))
+            config.writeInput(i, asReal(ifftoutput),"ComplexOutputMultiIFFTSamples_%d_%d_" % (nb,nbChannels))
+            config.writeInput(i, rsig.reshape(rsig.size),"RealInputMultiRFFTSamples_%d_%d_" % (nb,nbChannels))
+            # Spectra of the channels one after the other
+            config.writeInput(i, asReal(np.transpose(rfftoutput).copy()),"ComplexOutputMultiRFFTSamples_%d_%d_" % (nb,nbChannels))
+        i = i + 1
+
+def generateMultiPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","Multi","Multi")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","Multi","Multi")
+    
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+    configf16=Tools.Config(PATTERNDIR,PARAMDIR,"f16")
+    configq31=Tools.Config(PATTERNDIR,PARAMDIR,"q31")
+    configq15=Tools.Config(PATTERNDIR,PARAMDIR,"q15")
+     
+    print("Multi")
+
+    allConfigs=[(configf32,Tools.F32),
+        (configf16,Tools.F16),
+        (configq31,Tools.Q31),
+        (configq15,Tools.Q15)]
+
+    writeMultiTests(allConfigs)
+
+# Plans : one pattern for each kind of plan
+# [kind, length, columns for the 2D transforms]
+# The configurations must be the same as in the PlanTests
+PLANCONFIGS=[["CFFT",64,1],["CIFFT",64,1],["RFFT",64,1],["RIFFT",64,1],["CFFT2D",8,4]]
+
+def writePlanTests(configs):
+    i = 1
+    for (kind,nb,cols) in PLANCONFIGS:
+        if kind == "RFFT" or kind == "RIFFT":
+           sig = noisySineSignal(0.05,0.7,nb) / 4.0
+           rfft = scipy.fft.rfft(sig)
+           maxVal = np.max(np.abs(rfft))
+        else:
+           sig = noisySineSignal(0.05,0.7,nb*cols) + 1j*noisySineSignal(0.05,0.3,nb*cols)
+           sig = sig / 4.0
+           sig = sig.reshape((nb,cols))
+           fft = scipy.fft.fftn(sig)
+           maxVal = np.max(np.abs(fft))
+        for config,mode in configs:
+            fixed = mode == Tools.Q15 or mode == Tools.Q31
+            if kind == "CFFT" or kind == "CFFT2D":
+               sigin = sig
+               output = fft
+               if fixed:
+                  output = output * scaling(nb) * scaling(cols)
+            if kind == "CIFFT":
+               sigin = fft / maxVal / 2.0
+               output = sig / maxVal / 2.0
+               if fixed:
+                  output = output / 4.0
+            if kind == "RFFT":
+               sigin = sig
+               output = rfft
+               if fixed:
+                  output = output * scaling(int(nb/2))
+            if kind == "RIFFT":
+               sigin = rfft / maxVal / 2.0
+               output = sig / maxVal / 2.0
+               if fixed:
+                  output = output / 4.0
+            config.writeInput(i, asReal(sigin),"PlanInput%sSamples_%d_" % (kind,nb*cols))
+            config.writeInput(i, asReal(output),"PlanOutput%sSamples_%d_" % (kind,nb*cols))
+        i = i + 1
+
+def generatePlanPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","Plan","Plan")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","Plan","Plan")
+    
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+    configf16=Tools.Config(PATTERNDIR,PARAMDIR,"f16")
+    configq31=Tools.Config(PATTERNDIR,PARAMDIR,"q31")
+    configq15=Tools.Config(PATTERNDIR,PARAMDIR,"q15")
+     
+    print("Plan")
+
+    allConfigs=[(configf32,Tools.F32),
+        (configf16,Tools.F16),
+        (configq31,Tools.Q31),
+        (configq15,Tools.Q15)]
+
+    writePlanTests(allConfigs)
+
+# Pointwise operations on spectra : number of bins
+# (rfft of 64 and 32 samples)
+# The last bins saturate in fixed point.
+# The lengths must be the same as in the SpectrumTests
+SPECTRUMBINS=[33,17]
+
+def randomSpectrum(nb):
+    return(np.random.uniform(-0.5,0.5,nb) + 1j*np.random.uniform(-0.5,0.5,nb))
+
+def saturate(a,mode):
+    if mode == Tools.Q15:
+       m = 1.0 - 2.0**-15
+    else:
+       m = 1.0 - 2.0**-31
+    return(np.clip(np.real(a),-1.0,m) + 1j*np.clip(np.imag(a),-1.0,m))
+
+def writeSpectrumTests(configs):
+    i = 1
+    for nb in SPECTRUMBINS:
+        a = randomSpectrum(nb)
+        b = randomSpectrum(nb)
+        acc = randomSpectrum(nb)
+
+        # a * b and a * conj(b) saturating
+        a[nb-1] = 0.9 + 0.9j
+        b[nb-1] = 0.9 + 0.9j
+        a[nb-2] = 0.9 + 0.9j
+        b[nb-2] = 0.9 - 0.9j
+        a[nb-3] = -0.9 + 0.9j
+        b[nb-3] = 0.9 + 0.9j
+        # Only the accumulation saturating
+        a[nb-4] = 0.5 + 0.5j
+        b[nb-4] = 0.5 - 0.5j
+        acc[nb-4] = 0.9 - 0.9j
+        acc[nb-1] = 0.9 + 0.9j
+
+        mul = a * b
+        mulconj = a * np.conj(b)
+        for config,mode in configs:
+            mac = acc + mul
+            mulout = mul
+            mulconjout = mulconj
+            if mode == Tools.Q15 or mode == Tools.Q31:
+               mulout = saturate(mul,mode)
+               mulconjout = saturate(mulconj,mode)
+               mac = saturate(acc + mulout,mode)
+            config.writeInput(i, asReal(a),"ComplexInputSpectrumASamples_%d_" % nb)
+            config.writeInput(i, asReal(b),"ComplexInputSpectrumBSamples_%d_" % nb)
+            config.writeInput(i, asReal(acc),"ComplexInputSpectrumAccSamples_%d_" % nb)
+            config.writeInput(i, asReal(mulout),"ComplexOutputSpectrumMulSamples_%d_" % nb)
+            config.writeInput(i, asReal(mulconjout),"ComplexOutputSpectrumMulConjSamples_%d_" % nb)
+            config.writeInput(i, asReal(mac),"ComplexOutputSpectrumMacSamples_%d_" % nb)
+        i = i + 1
+
+def generateSpectrumPatterns():
+    PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","Spectrum","Spectrum")
+    PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","Spectrum","Spectrum")
+    
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+    configf16=Tools.Config(PATTERNDIR,PARAMDIR,"f16")
+    configq31=Tools.Config(PATTERNDIR,PARAMDIR,"q31")
+    configq15=Tools.Config(PATTERNDIR,PARAMDIR,"q15")
+     
+    print("Spectrum")
+
+    allConfigs=[(configf32,Tools.F32),
+        (configf16,Tools.F16),
+        (configq31,Tools.Q31),
+        (configq15,Tools.Q15)]
+
+    writeSpectrumTests(allConfigs)
+
 def generatePatterns():
     PATTERNDIR = os.path.join(args.f,"Patterns","DSP","FFT","CFFT","CFFT")
     PARAMDIR = os.path.join(args.f,"Parameters","DSP","FFT","CFFT","CFFT")
@@ -339,6 +1339,33 @@ def generatePatterns():
 
     writeRFFTTests(allConfigs)
 
+    generatePrunedPatterns()
+
+    generateSDFTPatterns()
+
+    generateWelchPatterns()
+
+    generateChannelizerPatterns()
+
+    generateResamplerPatterns()
+
+    generateAnalyticPatterns()
+
+    generateXCorrPatterns()
+
+    generateZoomPatterns()
+
+    generateMixedPatterns()
+    generateQ7Patterns()
+    generateSchedulerPatterns()
+    generateCFFT3DPatterns()
+    generatePairPatterns()
+    generateSplitPatterns()
+    generatePowerPatterns()
+    generateMfccPatterns()
+    generateMultiPatterns()
+    generatePlanPatterns()
+    generateSpectrumPatterns()
 
 
 
@@ -2,346 +2,370 @@
 #include "perm.h"
 #include "twiddle.h"
 
-const uint16_t factors1[4]={4,1,8,2};
+#if RADIX_MASK_F16 != 0x13c
+#error "Generated/config.h does not match Generated/config.cpp : run configgen.py again"
+#endif
+
+#if RADIX_MASK_F32 != 0x13c
+#error "Generated/config.h does not match Generated/config.cpp : run configgen.py again"
+#endif
+
+#if RADIX_MASK_Q15 != 0x03c
+#error "Generated/config.h does not match Generated/config.cpp : run configgen.py again"
+#endif
+
+#if RADIX_MASK_Q31 != 0x03c
+#error "Generated/config.h does not match Generated/config.cpp : run configgen.py again"
+#endif
+
+#if RADIX_MASK_Q7 != 0x01c
+#error "Generated/config.h does not match Generated/config.cpp : run configgen.py again"
+#endif
+
+const uint16_t factors1[2]={2,1};
 
-const uint16_t lengths1[3]={64,8,1};
+const uint16_t lengths1[1]={1};
 
-const uint16_t factors2[2]={4,6};
+const uint16_t factors2[2]={3,1};
 
-const uint16_t lengths2[6]={1024,256,64,16,4,1};
+const uint16_t lengths2[1]={1};
 
-const uint16_t factors3[2]={2,1};
+const uint16_t factors3[2]={4,1};
 
 const uint16_t lengths3[1]={1};
 
-const uint16_t factors4[2]={3,1};
+const uint16_t factors4[4]={2,1,3,1};
 
-const uint16_t lengths4[1]={1};
+const uint16_t lengths4[2]={3,1};
 
-const uint16_t factors5[2]={4,1};
+const uint16_t factors5[4]={2,1,4,1};
 
-const uint16_t lengths5[1]={1};
+const uint16_t lengths5[2]={4,1};
 
-const uint16_t factors6[2]={5,1};
+const uint16_t factors6[2]={4,2};
 
-const uint16_t lengths6[1]={1};
+const uint16_t lengths6[2]={4,1};
 
-const uint16_t factors7[4]={2,1,3,1};
+const uint16_t factors7[2]={5,1};
 
-const uint16_t lengths7[2]={3,1};
+const uint16_t lengths7[1]={1};
 
-const uint16_t factors8[2]={8,3};
+const uint16_t factors8[2]={8,1};
 
-const uint16_t lengths8[3]={64,8,1};
+const uint16_t lengths8[1]={1};
 
-const uint16_t factors9[2]={8,1};
+const uint16_t factors9[2]={3,2};
 
-const uint16_t lengths9[1]={1};
+const uint16_t lengths9[2]={3,1};
 
-const uint16_t factors10[2]={3,2};
+const uint16_t factors10[4]={2,1,5,1};
 
-const uint16_t lengths10[2]={3,1};
+const uint16_t lengths10[2]={5,1};
 
-const uint16_t factors11[4]={2,1,5,1};
+const uint16_t factors11[4]={3,1,4,1};
 
-const uint16_t lengths11[2]={5,1};
+const uint16_t lengths11[2]={4,1};
 
-const uint16_t factors12[4]={2,1,8,2};
+const uint16_t factors12[4]={3,1,5,1};
 
-const uint16_t lengths12[3]={64,8,1};
+const uint16_t lengths12[2]={5,1};
 
-const uint16_t factors13[4]={3,1,4,1};
+const uint16_t factors13[4]={2,1,8,1};
 
-const uint16_t lengths13[2]={4,1};
+const uint16_t lengths13[2]={8,1};
 
-const uint16_t factors14[6]={2,1,3,1,8,2};
+const uint16_t factors14[4]={2,1,3,2};
 
-const uint16_t lengths14[4]={192,64,8,1};
+const uint16_t lengths14[3]={9,3,1};
 
-const uint16_t factors15[4]={3,1,5,1};
+const uint16_t factors15[4]={4,1,5,1};
 
 const uint16_t lengths15[2]={5,1};
 
-const uint16_t factors16[4]={2,1,8,1};
+const uint16_t factors16[4]={3,1,8,1};
 
 const uint16_t lengths16[2]={8,1};
 
-const uint16_t factors17[6]={2,1,3,2,8,1};
+const uint16_t factors17[2]={5,2};
 
-const uint16_t lengths17[4]={72,24,8,1};
+const uint16_t lengths17[2]={5,1};
 
-const uint16_t factors18[4]={2,1,3,2};
+const uint16_t factors18[2]={3,3};
 
 const uint16_t lengths18[3]={9,3,1};
 
-const uint16_t factors19[6]={2,1,5,2,8,1};
+const uint16_t factors19[6]={2,1,3,1,5,1};
 
-const uint16_t lengths19[4]={200,40,8,1};
+const uint16_t lengths19[3]={15,5,1};
 
-const uint16_t factors20[4]={4,1,5,1};
+const uint16_t factors20[4]={4,1,8,1};
 
-const uint16_t lengths20[2]={5,1};
+const uint16_t lengths20[2]={8,1};
 
-const uint16_t factors21[6]={2,1,3,1,5,2};
+const uint16_t factors21[4]={3,2,4,1};
 
-const uint16_t lengths21[4]={75,25,5,1};
+const uint16_t lengths21[3]={12,4,1};
 
-const uint16_t factors22[4]={3,1,8,1};
+const uint16_t factors22[4]={5,1,8,1};
 
 const uint16_t lengths22[2]={8,1};
 
-const uint16_t factors23[2]={5,2};
+const uint16_t factors23[4]={3,2,5,1};
 
-const uint16_t lengths23[2]={5,1};
+const uint16_t lengths23[3]={15,5,1};
 
-const uint16_t factors24[2]={3,3};
+const uint16_t factors24[6]={2,1,3,1,8,1};
 
-const uint16_t lengths24[3]={9,3,1};
+const uint16_t lengths24[3]={24,8,1};
 
-const uint16_t factors25[6]={2,1,3,1,5,1};
+const uint16_t factors25[4]={2,1,5,2};
 
-const uint16_t lengths25[3]={15,5,1};
+const uint16_t lengths25[3]={25,5,1};
 
-const uint16_t factors26[4]={4,1,8,1};
+const uint16_t factors26[4]={2,1,3,3};
 
-const uint16_t lengths26[2]={8,1};
+const uint16_t lengths26[4]={27,9,3,1};
 
-const uint16_t factors27[6]={3,2,4,1,8,1};
+const uint16_t factors27[6]={3,1,4,1,5,1};
 
-const uint16_t lengths27[4]={96,32,8,1};
+const uint16_t lengths27[3]={20,5,1};
 
-const uint16_t factors28[2]={4,5};
+const uint16_t factors28[2]={8,2};
 
-const uint16_t lengths28[5]={256,64,16,4,1};
+const uint16_t lengths28[2]={8,1};
 
-const uint16_t factors29[6]={4,1,5,1,8,1};
+const uint16_t factors29[4]={3,2,8,1};
 
-const uint16_t lengths29[3]={40,8,1};
+const uint16_t lengths29[3]={24,8,1};
 
-const uint16_t factors30[4]={3,2,4,1};
+const uint16_t factors30[4]={3,1,5,2};
 
-const uint16_t lengths30[3]={12,4,1};
+const uint16_t lengths30[3]={25,5,1};
 
-const uint16_t factors31[4]={5,1,8,1};
+const uint16_t factors31[6]={2,1,5,1,8,1};
 
-const uint16_t lengths31[2]={8,1};
+const uint16_t lengths31[3]={40,8,1};
 
-const uint16_t factors32[4]={3,2,5,1};
+const uint16_t factors32[2]={3,4};
 
-const uint16_t lengths32[3]={15,5,1};
+const uint16_t lengths32[4]={27,9,3,1};
 
-const uint16_t factors33[6]={2,1,3,1,8,1};
+const uint16_t factors33[6]={2,1,3,2,5,1};
 
-const uint16_t lengths33[3]={24,8,1};
+const uint16_t lengths33[4]={45,15,5,1};
 
-const uint16_t factors34[4]={2,1,5,2};
+const uint16_t factors34[6]={3,1,4,1,8,1};
 
-const uint16_t lengths34[3]={25,5,1};
+const uint16_t lengths34[3]={32,8,1};
 
-const uint16_t factors35[6]={3,2,4,1,5,1};
+const uint16_t factors35[4]={4,1,5,2};
 
-const uint16_t lengths35[4]={60,20,5,1};
+const uint16_t lengths35[3]={25,5,1};
 
-const uint16_t factors36[4]={2,1,3,3};
+const uint16_t factors36[4]={3,3,4,1};
 
-const uint16_t lengths36[4]={27,9,3,1};
+const uint16_t lengths36[4]={36,12,4,1};
 
-const uint16_t factors37[6]={3,1,4,1,5,1};
+const uint16_t factors37[6]={3,1,5,1,8,1};
 
-const uint16_t lengths37[3]={20,5,1};
+const uint16_t lengths37[3]={40,8,1};
 
-const uint16_t factors38[2]={8,2};
+const uint16_t factors38[2]={5,3};
 
-const uint16_t lengths38[2]={8,1};
+const uint16_t lengths38[3]={25,5,1};
 
-const uint16_t factors39[4]={5,1,8,2};
+const uint16_t factors39[4]={2,1,8,2};
 
 const uint16_t lengths39[3]={64,8,1};
 
-const uint16_t factors40[4]={2,1,4,5};
+const uint16_t factors40[6]={2,1,3,2,8,1};
 
-const uint16_t lengths40[6]={1024,256,64,16,4,1};
+const uint16_t lengths40[4]={72,24,8,1};
 
-const uint16_t factors41[4]={3,1,8,2};
+const uint16_t factors41[6]={2,1,3,1,5,2};
 
-const uint16_t lengths41[3]={64,8,1};
+const uint16_t lengths41[4]={75,25,5,1};
 
-const uint16_t factors42[4]={3,2,8,1};
+const uint16_t factors42[6]={4,1,5,1,8,1};
 
-const uint16_t lengths42[3]={24,8,1};
+const uint16_t lengths42[3]={40,8,1};
 
-const uint16_t factors43[4]={5,2,8,1};
+const uint16_t factors43[6]={3,2,4,1,5,1};
 
-const uint16_t lengths43[3]={40,8,1};
+const uint16_t lengths43[4]={60,20,5,1};
 
-const uint16_t factors44[4]={3,1,5,2};
+const uint16_t factors44[4]={3,1,8,2};
 
-const uint16_t lengths44[3]={25,5,1};
+const uint16_t lengths44[3]={64,8,1};
 
-const uint16_t factors45[6]={2,1,5,1,8,1};
+const uint16_t factors45[4]={5,2,8,1};
 
 const uint16_t lengths45[3]={40,8,1};
 
-const uint16_t factors46[2]={3,4};
+const uint16_t factors46[4]={3,3,8,1};
 
-const uint16_t lengths46[4]={27,9,3,1};
+const uint16_t lengths46[4]={72,24,8,1};
 
-const uint16_t factors47[4]={3,3,8,1};
+const uint16_t factors47[8]={2,1,3,1,5,1,8,1};
 
-const uint16_t lengths47[4]={72,24,8,1};
+const uint16_t lengths47[4]={120,40,8,1};
 
-const uint16_t factors48[6]={2,1,3,2,5,1};
+const uint16_t factors48[4]={4,1,8,2};
 
-const uint16_t lengths48[4]={45,15,5,1};
+const uint16_t lengths48[3]={64,8,1};
 
-const uint16_t factors49[6]={3,1,4,1,8,1};
+const uint16_t factors49[6]={3,2,4,1,8,1};
 
-const uint16_t lengths49[3]={32,8,1};
+const uint16_t lengths49[4]={96,32,8,1};
 
-const uint16_t factors50[4]={4,1,5,2};
+const uint16_t factors50[4]={5,1,8,2};
 
-const uint16_t lengths50[3]={25,5,1};
+const uint16_t lengths50[3]={64,8,1};
 
-const uint16_t factors51[4]={3,3,4,1};
+const uint16_t factors51[6]={2,1,3,1,8,2};
 
-const uint16_t lengths51[4]={36,12,4,1};
+const uint16_t lengths51[4]={192,64,8,1};
 
-const uint16_t factors52[8]={2,1,3,1,5,1,8,1};
+const uint16_t factors52[6]={2,1,5,2,8,1};
 
-const uint16_t lengths52[4]={120,40,8,1};
+const uint16_t lengths52[4]={200,40,8,1};
 
-const uint16_t factors53[6]={3,1,5,1,8,1};
+const uint16_t factors53[2]={8,3};
 
-const uint16_t lengths53[3]={40,8,1};
+const uint16_t lengths53[3]={64,8,1};
 
-const uint16_t factors54[2]={5,3};
+const uint16_t factors54[2]={4,5};
 
-const uint16_t lengths54[3]={25,5,1};
+const uint16_t lengths54[5]={256,64,16,4,1};
 
-const uint16_t factors55[2]={4,4};
+const uint16_t factors55[4]={2,1,4,5};
 
-const uint16_t lengths55[4]={64,16,4,1};
+const uint16_t lengths55[6]={1024,256,64,16,4,1};
 
-const uint16_t factors56[4]={2,1,4,4};
+const uint16_t factors56[2]={4,6};
 
-const uint16_t lengths56[5]={256,64,16,4,1};
+const uint16_t lengths56[6]={1024,256,64,16,4,1};
 
-const uint16_t factors57[4]={2,1,4,1};
+const uint16_t factors57[6]={2,1,3,1,4,1};
 
-const uint16_t lengths57[2]={4,1};
+const uint16_t lengths57[3]={12,4,1};
 
-const uint16_t factors58[4]={2,1,4,3};
+const uint16_t factors58[4]={2,1,4,2};
 
-const uint16_t lengths58[4]={64,16,4,1};
+const uint16_t lengths58[3]={16,4,1};
 
-const uint16_t factors59[6]={2,1,3,1,4,3};
+const uint16_t factors59[6]={2,1,4,1,5,1};
 
-const uint16_t lengths59[5]={192,64,16,4,1};
+const uint16_t lengths59[3]={20,5,1};
 
-const uint16_t factors60[2]={4,2};
+const uint16_t factors60[4]={3,1,4,2};
 
-const uint16_t lengths60[2]={4,1};
+const uint16_t lengths60[3]={16,4,1};
 
-const uint16_t factors61[4]={3,2,4,2};
+const uint16_t factors61[2]={4,3};
 
-const uint16_t lengths61[4]={48,16,4,1};
+const uint16_t lengths61[3]={16,4,1};
 
-const uint16_t factors62[4]={4,2,5,2};
+const uint16_t factors62[6]={2,1,3,2,4,1};
 
-const uint16_t lengths62[4]={100,25,5,1};
+const uint16_t lengths62[4]={36,12,4,1};
 
-const uint16_t factors63[6]={2,1,3,1,4,1};
+const uint16_t factors63[4]={4,2,5,1};
 
-const uint16_t lengths63[3]={12,4,1};
+const uint16_t lengths63[3]={20,5,1};
 
-const uint16_t factors64[4]={2,1,4,2};
+const uint16_t factors64[6]={2,1,3,1,4,2};
 
-const uint16_t lengths64[3]={16,4,1};
+const uint16_t lengths64[4]={48,16,4,1};
 
-const uint16_t factors65[6]={2,1,3,2,4,2};
+const uint16_t factors65[8]={2,1,3,1,4,1,5,1};
 
-const uint16_t lengths65[5]={144,48,16,4,1};
+const uint16_t lengths65[4]={60,20,5,1};
 
-const uint16_t factors66[6]={2,1,4,2,5,1};
+const uint16_t factors66[4]={2,1,4,3};
 
-const uint16_t lengths66[4]={80,20,5,1};
+const uint16_t lengths66[4]={64,16,4,1};
 
-const uint16_t factors67[6]={2,1,4,1,5,1};
+const uint16_t factors67[4]={3,2,4,2};
 
-const uint16_t lengths67[3]={20,5,1};
+const uint16_t lengths67[4]={48,16,4,1};
 
-const uint16_t factors68[4]={3,1,4,2};
+const uint16_t factors68[6]={2,1,4,2,5,1};
 
-const uint16_t lengths68[3]={16,4,1};
+const uint16_t lengths68[4]={80,20,5,1};
 
-const uint16_t factors69[2]={4,3};
+const uint16_t factors69[4]={3,1,4,3};
 
-const uint16_t lengths69[3]={16,4,1};
+const uint16_t lengths69[4]={64,16,4,1};
 
-const uint16_t factors70[4]={4,3,5,1};
+const uint16_t factors70[6]={2,1,4,1,5,2};
 
-const uint16_t lengths70[4]={80,20,5,1};
+const uint16_t lengths70[4]={100,25,5,1};
 
-const uint16_t factors71[4]={3,1,4,3};
+const uint16_t factors71[6]={2,1,3,3,4,1};
 
-const uint16_t lengths71[4]={64,16,4,1};
+const uint16_t lengths71[5]={108,36,12,4,1};
 
-const uint16_t factors72[6]={2,1,3,2,4,1};
+const uint16_t factors72[6]={3,1,4,2,5,1};
 
-const uint16_t lengths72[4]={36,12,4,1};
+const uint16_t lengths72[4]={80,20,5,1};
 
-const uint16_t factors73[6]={2,1,4,1,5,2};
+const uint16_t factors73[2]={4,4};
 
-const uint16_t lengths73[4]={100,25,5,1};
+const uint16_t lengths73[4]={64,16,4,1};
 
-const uint16_t factors74[4]={4,2,5,1};
+const uint16_t factors74[6]={2,1,3,2,4,2};
 
-const uint16_t lengths74[3]={20,5,1};
+const uint16_t lengths74[5]={144,48,16,4,1};
 
-const uint16_t factors75[6]={2,1,3,3,4,1};
+const uint16_t factors75[4]={4,3,5,1};
 
-const uint16_t lengths75[5]={108,36,12,4,1};
+const uint16_t lengths75[4]={80,20,5,1};
 
-const uint16_t factors76[6]={2,1,3,1,4,2};
+const uint16_t factors76[6]={2,1,3,1,4,3};
 
-const uint16_t lengths76[4]={48,16,4,1};
+const uint16_t lengths76[5]={192,64,16,4,1};
 
-const uint16_t factors77[6]={3,1,4,2,5,1};
+const uint16_t factors77[4]={4,2,5,2};
 
-const uint16_t lengths77[4]={80,20,5,1};
+const uint16_t lengths77[4]={100,25,5,1};
 
-const uint16_t factors78[8]={2,1,3,1,4,1,5,1};
+const uint16_t factors78[4]={2,1,4,4};
 
-const uint16_t lengths78[4]={60,20,5,1};
+const uint16_t lengths78[5]={256,64,16,4,1};
 
-cfftconfig<float32_t> config1={
-   .normalization=0.00390625000000000000f,
+const cfftconfig<Q7> cfftConfigsQ7[6]={
+   /* Length 2 */
+   {
+   .normalization=Q7(0x40),
    .nbPerms=NB_PERM1,
    .perms=perm1,
    .nbTwiddle=NB_TWIDDLE1,
    .twiddle=twiddle1,
-   .nbGroupedFactors=2,
-   .nbFactors=3,
+   .nbGroupedFactors=1,
+   .nbFactors=1,
    .factors=factors1,
    .lengths=lengths1,
-   .format=0,
-   .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config2={
-   .normalization=0.00024414062500000000f,
+   .format=1,
+   .reversalVectorizable=1
+   },
+   /* Length 3 */
+   {
+   .normalization=Q7(0x2B),
    .nbPerms=NB_PERM2,
    .perms=perm2,
    .nbTwiddle=NB_TWIDDLE2,
    .twiddle=twiddle2,
    .nbGroupedFactors=1,
-   .nbFactors=6,
+   .nbFactors=1,
    .factors=factors2,
    .lengths=lengths2,
-   .format=0,
+   .format=2,
    .reversalVectorizable=1
-   };
-cfftconfig<float32_t> config3={
-   .normalization=0.50000000000000000000f,
+   },
+   /* Length 4 */
+   {
+   .normalization=Q7(0x20),
    .nbPerms=NB_PERM3,
    .perms=perm3,
    .nbTwiddle=NB_TWIDDLE3,
@@ -350,4638 +374,5075 @@ cfftconfig<float32_t> config3={
    .nbFactors=1,
    .factors=factors3,
    .lengths=lengths3,
-   .format=0,
+   .format=2,
    .reversalVectorizable=1
-   };
-cfftconfig<float32_t> config4={
-   .normalization=0.33333333333333331483f,
+   },
+   /* Length 6 */
+   {
+   .normalization=Q7(0x15),
    .nbPerms=NB_PERM4,
    .perms=perm4,
    .nbTwiddle=NB_TWIDDLE4,
    .twiddle=twiddle4,
-   .nbGroupedFactors=1,
-   .nbFactors=1,
+   .nbGroupedFactors=2,
+   .nbFactors=2,
    .factors=factors4,
    .lengths=lengths4,
-   .format=0,
-   .reversalVectorizable=1
-   };
-cfftconfig<float32_t> config5={
-   .normalization=0.25000000000000000000f,
+   .format=3,
+   .reversalVectorizable=0
+   },
+   /* Length 8 */
+   {
+   .normalization=Q7(0x10),
    .nbPerms=NB_PERM5,
    .perms=perm5,
    .nbTwiddle=NB_TWIDDLE5,
    .twiddle=twiddle5,
-   .nbGroupedFactors=1,
-   .nbFactors=1,
+   .nbGroupedFactors=2,
+   .nbFactors=2,
    .factors=factors5,
    .lengths=lengths5,
-   .format=0,
-   .reversalVectorizable=1
-   };
-cfftconfig<float32_t> config6={
-   .normalization=0.20000000000000001110f,
+   .format=3,
+   .reversalVectorizable=0
+   },
+   /* Length 16 */
+   {
+   .normalization=Q7(0x08),
    .nbPerms=NB_PERM6,
    .perms=perm6,
    .nbTwiddle=NB_TWIDDLE6,
    .twiddle=twiddle6,
    .nbGroupedFactors=1,
-   .nbFactors=1,
+   .nbFactors=2,
    .factors=factors6,
    .lengths=lengths6,
+   .format=4,
+   .reversalVectorizable=1
+   },
+};
+
+const uint16_t cfftLengthsQ7[6]={2,3,4,6,8,16};
+
+
+template<>
+const cfftconfig<Q7> *cfft_config<Q7>(uint32_t nbSamples)
+{
+    return(fft_config_search(cfftLengthsQ7,cfftConfigsQ7,6,nbSamples));
+}
+
+const cfftconfig<float32_t> cfftConfigsF32[54]={
+   /* Length 2 */
+   {
+   .normalization=0.50000000000000000000f,
+   .nbPerms=NB_PERM1,
+   .perms=perm1,
+   .nbTwiddle=NB_TWIDDLE7,
+   .twiddle=twiddle7,
+   .nbGroupedFactors=1,
+   .nbFactors=1,
+   .factors=factors1,
+   .lengths=lengths1,
    .format=0,
    .reversalVectorizable=1
-   };
-cfftconfig<float32_t> config7={
-   .normalization=0.16666666666666665741f,
+   },
+   /* Length 3 */
+   {
+   .normalization=0.33333333333333331483f,
+   .nbPerms=NB_PERM2,
+   .perms=perm2,
+   .nbTwiddle=NB_TWIDDLE8,
+   .twiddle=twiddle8,
+   .nbGroupedFactors=1,
+   .nbFactors=1,
+   .factors=factors2,
+   .lengths=lengths2,
+   .format=0,
+   .reversalVectorizable=1
+   },
+   /* Length 4 */
+   {
+   .normalization=0.25000000000000000000f,
+   .nbPerms=NB_PERM3,
+   .perms=perm3,
+   .nbTwiddle=NB_TWIDDLE9,
+   .twiddle=twiddle9,
+   .nbGroupedFactors=1,
+   .nbFactors=1,
+   .factors=factors3,
+   .lengths=lengths3,
+   .format=0,
+   .reversalVectorizable=1
+   },
+   /* Length 5 */
+   {
+   .normalization=0.20000000000000001110f,
    .nbPerms=NB_PERM7,
    .perms=perm7,
-   .nbTwiddle=NB_TWIDDLE7,
-   .twiddle=twiddle7,
-   .nbGroupedFactors=2,
-   .nbFactors=2,
+   .nbTwiddle=NB_TWIDDLE10,
+   .twiddle=twiddle10,
+   .nbGroupedFactors=1,
+   .nbFactors=1,
    .factors=factors7,
    .lengths=lengths7,
    .format=0,
+   .reversalVectorizable=1
+   },
+   /* Length 6 */
+   {
+   .normalization=0.16666666666666665741f,
+   .nbPerms=NB_PERM4,
+   .perms=perm4,
+   .nbTwiddle=NB_TWIDDLE11,
+   .twiddle=twiddle11,
+   .nbGroupedFactors=2,
+   .nbFactors=2,
+   .factors=factors4,
+   .lengths=lengths4,
+   .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config8={
-   .normalization=0.00195312500000000000f,
+   },
+   /* Length 8 */
+   {
+   .normalization=0.12500000000000000000f,
    .nbPerms=NB_PERM8,
    .perms=perm8,
-   .nbTwiddle=NB_TWIDDLE8,
-   .twiddle=twiddle8,
+   .nbTwiddle=NB_TWIDDLE12,
+   .twiddle=twiddle12,
    .nbGroupedFactors=1,
-   .nbFactors=3,
+   .nbFactors=1,
    .factors=factors8,
    .lengths=lengths8,
    .format=0,
    .reversalVectorizable=1
-   };
-cfftconfig<float32_t> config9={
-   .normalization=0.12500000000000000000f,
+   },
+   /* Length 9 */
+   {
+   .normalization=0.11111111111111110494f,
    .nbPerms=NB_PERM9,
    .perms=perm9,
-   .nbTwiddle=NB_TWIDDLE9,
-   .twiddle=twiddle9,
+   .nbTwiddle=NB_TWIDDLE13,
+   .twiddle=twiddle13,
    .nbGroupedFactors=1,
-   .nbFactors=1,
+   .nbFactors=2,
    .factors=factors9,
    .lengths=lengths9,
    .format=0,
    .reversalVectorizable=1
-   };
-cfftconfig<float32_t> config10={
-   .normalization=0.11111111111111110494f,
+   },
+   /* Length 10 */
+   {
+   .normalization=0.10000000000000000555f,
    .nbPerms=NB_PERM10,
    .perms=perm10,
-   .nbTwiddle=NB_TWIDDLE10,
-   .twiddle=twiddle10,
-   .nbGroupedFactors=1,
+   .nbTwiddle=NB_TWIDDLE14,
+   .twiddle=twiddle14,
+   .nbGroupedFactors=2,
    .nbFactors=2,
    .factors=factors10,
    .lengths=lengths10,
    .format=0,
-   .reversalVectorizable=1
-   };
-cfftconfig<float32_t> config11={
-   .normalization=0.10000000000000000555f,
+   .reversalVectorizable=0
+   },
+   /* Length 12 */
+   {
+   .normalization=0.08333333333333332871f,
    .nbPerms=NB_PERM11,
    .perms=perm11,
-   .nbTwiddle=NB_TWIDDLE11,
-   .twiddle=twiddle11,
+   .nbTwiddle=NB_TWIDDLE15,
+   .twiddle=twiddle15,
    .nbGroupedFactors=2,
    .nbFactors=2,
    .factors=factors11,
    .lengths=lengths11,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config12={
-   .normalization=0.00781250000000000000f,
+   },
+   /* Length 15 */
+   {
+   .normalization=0.06666666666666666574f,
    .nbPerms=NB_PERM12,
    .perms=perm12,
-   .nbTwiddle=NB_TWIDDLE12,
-   .twiddle=twiddle12,
+   .nbTwiddle=NB_TWIDDLE16,
+   .twiddle=twiddle16,
    .nbGroupedFactors=2,
-   .nbFactors=3,
+   .nbFactors=2,
    .factors=factors12,
    .lengths=lengths12,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config13={
-   .normalization=0.08333333333333332871f,
+   },
+   /* Length 16 */
+   {
+   .normalization=0.06250000000000000000f,
    .nbPerms=NB_PERM13,
    .perms=perm13,
-   .nbTwiddle=NB_TWIDDLE13,
-   .twiddle=twiddle13,
+   .nbTwiddle=NB_TWIDDLE17,
+   .twiddle=twiddle17,
    .nbGroupedFactors=2,
    .nbFactors=2,
    .factors=factors13,
    .lengths=lengths13,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config14={
-   .normalization=0.00260416666666666652f,
+   },
+   /* Length 18 */
+   {
+   .normalization=0.05555555555555555247f,
    .nbPerms=NB_PERM14,
    .perms=perm14,
-   .nbTwiddle=NB_TWIDDLE14,
-   .twiddle=twiddle14,
-   .nbGroupedFactors=3,
-   .nbFactors=4,
+   .nbTwiddle=NB_TWIDDLE18,
+   .twiddle=twiddle18,
+   .nbGroupedFactors=2,
+   .nbFactors=3,
    .factors=factors14,
    .lengths=lengths14,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config15={
-   .normalization=0.06666666666666666574f,
+   },
+   /* Length 20 */
+   {
+   .normalization=0.05000000000000000278f,
    .nbPerms=NB_PERM15,
    .perms=perm15,
-   .nbTwiddle=NB_TWIDDLE15,
-   .twiddle=twiddle15,
+   .nbTwiddle=NB_TWIDDLE19,
+   .twiddle=twiddle19,
    .nbGroupedFactors=2,
    .nbFactors=2,
    .factors=factors15,
    .lengths=lengths15,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config16={
-   .normalization=0.06250000000000000000f,
+   },
+   /* Length 24 */
+   {
+   .normalization=0.04166666666666666435f,
    .nbPerms=NB_PERM16,
    .perms=perm16,
-   .nbTwiddle=NB_TWIDDLE16,
-   .twiddle=twiddle16,
+   .nbTwiddle=NB_TWIDDLE20,
+   .twiddle=twiddle20,
    .nbGroupedFactors=2,
    .nbFactors=2,
    .factors=factors16,
    .lengths=lengths16,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config17={
-   .normalization=0.00694444444444444406f,
+   },
+   /* Length 25 */
+   {
+   .normalization=0.04000000000000000083f,
    .nbPerms=NB_PERM17,
    .perms=perm17,
-   .nbTwiddle=NB_TWIDDLE17,
-   .twiddle=twiddle17,
-   .nbGroupedFactors=3,
-   .nbFactors=4,
+   .nbTwiddle=NB_TWIDDLE21,
+   .twiddle=twiddle21,
+   .nbGroupedFactors=1,
+   .nbFactors=2,
    .factors=factors17,
    .lengths=lengths17,
    .format=0,
-   .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config18={
-   .normalization=0.05555555555555555247f,
+   .reversalVectorizable=1
+   },
+   /* Length 27 */
+   {
+   .normalization=0.03703703703703703498f,
    .nbPerms=NB_PERM18,
    .perms=perm18,
-   .nbTwiddle=NB_TWIDDLE18,
-   .twiddle=twiddle18,
-   .nbGroupedFactors=2,
+   .nbTwiddle=NB_TWIDDLE22,
+   .twiddle=twiddle22,
+   .nbGroupedFactors=1,
    .nbFactors=3,
    .factors=factors18,
    .lengths=lengths18,
    .format=0,
-   .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config19={
-   .normalization=0.00250000000000000005f,
+   .reversalVectorizable=1
+   },
+   /* Length 30 */
+   {
+   .normalization=0.03333333333333333287f,
    .nbPerms=NB_PERM19,
    .perms=perm19,
-   .nbTwiddle=NB_TWIDDLE19,
-   .twiddle=twiddle19,
+   .nbTwiddle=NB_TWIDDLE23,
+   .twiddle=twiddle23,
    .nbGroupedFactors=3,
-   .nbFactors=4,
+   .nbFactors=3,
    .factors=factors19,
    .lengths=lengths19,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config20={
-   .normalization=0.05000000000000000278f,
+   },
+   /* Length 32 */
+   {
+   .normalization=0.03125000000000000000f,
    .nbPerms=NB_PERM20,
    .perms=perm20,
-   .nbTwiddle=NB_TWIDDLE20,
-   .twiddle=twiddle20,
+   .nbTwiddle=NB_TWIDDLE24,
+   .twiddle=twiddle24,
    .nbGroupedFactors=2,
    .nbFactors=2,
    .factors=factors20,
    .lengths=lengths20,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config21={
-   .normalization=0.00666666666666666709f,
+   },
+   /* Length 36 */
+   {
+   .normalization=0.02777777777777777624f,
    .nbPerms=NB_PERM21,
    .perms=perm21,
-   .nbTwiddle=NB_TWIDDLE21,
-   .twiddle=twiddle21,
-   .nbGroupedFactors=3,
-   .nbFactors=4,
+   .nbTwiddle=NB_TWIDDLE25,
+   .twiddle=twiddle25,
+   .nbGroupedFactors=2,
+   .nbFactors=3,
    .factors=factors21,
    .lengths=lengths21,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config22={
-   .normalization=0.04166666666666666435f,
+   },
+   /* Length 40 */
+   {
+   .normalization=0.02500000000000000139f,
    .nbPerms=NB_PERM22,
    .perms=perm22,
-   .nbTwiddle=NB_TWIDDLE22,
-   .twiddle=twiddle22,
+   .nbTwiddle=NB_TWIDDLE26,
+   .twiddle=twiddle26,
    .nbGroupedFactors=2,
    .nbFactors=2,
    .factors=factors22,
    .lengths=lengths22,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config23={
-   .normalization=0.04000000000000000083f,
+   },
+   /* Length 45 */
+   {
+   .normalization=0.02222222222222222307f,
    .nbPerms=NB_PERM23,
    .perms=perm23,
-   .nbTwiddle=NB_TWIDDLE23,
-   .twiddle=twiddle23,
-   .nbGroupedFactors=1,
-   .nbFactors=2,
+   .nbTwiddle=NB_TWIDDLE27,
+   .twiddle=twiddle27,
+   .nbGroupedFactors=2,
+   .nbFactors=3,
    .factors=factors23,
    .lengths=lengths23,
    .format=0,
-   .reversalVectorizable=1
-   };
-cfftconfig<float32_t> config24={
-   .normalization=0.03703703703703703498f,
+   .reversalVectorizable=0
+   },
+   /* Length 48 */
+   {
+   .normalization=0.02083333333333333218f,
    .nbPerms=NB_PERM24,
    .perms=perm24,
-   .nbTwiddle=NB_TWIDDLE24,
-   .twiddle=twiddle24,
-   .nbGroupedFactors=1,
+   .nbTwiddle=NB_TWIDDLE28,
+   .twiddle=twiddle28,
+   .nbGroupedFactors=3,
    .nbFactors=3,
    .factors=factors24,
    .lengths=lengths24,
    .format=0,
-   .reversalVectorizable=1
-   };
-cfftconfig<float32_t> config25={
-   .normalization=0.03333333333333333287f,
+   .reversalVectorizable=0
+   },
+   /* Length 50 */
+   {
+   .normalization=0.02000000000000000042f,
    .nbPerms=NB_PERM25,
    .perms=perm25,
-   .nbTwiddle=NB_TWIDDLE25,
-   .twiddle=twiddle25,
-   .nbGroupedFactors=3,
+   .nbTwiddle=NB_TWIDDLE29,
+   .twiddle=twiddle29,
+   .nbGroupedFactors=2,
    .nbFactors=3,
    .factors=factors25,
    .lengths=lengths25,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config26={
-   .normalization=0.03125000000000000000f,
+   },
+   /* Length 54 */
+   {
+   .normalization=0.01851851851851851749f,
    .nbPerms=NB_PERM26,
    .perms=perm26,
-   .nbTwiddle=NB_TWIDDLE26,
-   .twiddle=twiddle26,
+   .nbTwiddle=NB_TWIDDLE30,
+   .twiddle=twiddle30,
    .nbGroupedFactors=2,
-   .nbFactors=2,
+   .nbFactors=4,
    .factors=factors26,
    .lengths=lengths26,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config27={
-   .normalization=0.00347222222222222203f,
+   },
+   /* Length 60 */
+   {
+   .normalization=0.01666666666666666644f,
    .nbPerms=NB_PERM27,
    .perms=perm27,
-   .nbTwiddle=NB_TWIDDLE27,
-   .twiddle=twiddle27,
+   .nbTwiddle=NB_TWIDDLE31,
+   .twiddle=twiddle31,
    .nbGroupedFactors=3,
-   .nbFactors=4,
+   .nbFactors=3,
    .factors=factors27,
    .lengths=lengths27,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config28={
-   .normalization=0.00097656250000000000f,
+   },
+   /* Length 64 */
+   {
+   .normalization=0.01562500000000000000f,
    .nbPerms=NB_PERM28,
    .perms=perm28,
-   .nbTwiddle=NB_TWIDDLE28,
-   .twiddle=twiddle28,
+   .nbTwiddle=NB_TWIDDLE32,
+   .twiddle=twiddle32,
    .nbGroupedFactors=1,
-   .nbFactors=5,
+   .nbFactors=2,
    .factors=factors28,
    .lengths=lengths28,
    .format=0,
    .reversalVectorizable=1
-   };
-cfftconfig<float32_t> config29={
-   .normalization=0.00625000000000000035f,
+   },
+   /* Length 72 */
+   {
+   .normalization=0.01388888888888888812f,
    .nbPerms=NB_PERM29,
    .perms=perm29,
-   .nbTwiddle=NB_TWIDDLE29,
-   .twiddle=twiddle29,
-   .nbGroupedFactors=3,
+   .nbTwiddle=NB_TWIDDLE33,
+   .twiddle=twiddle33,
+   .nbGroupedFactors=2,
    .nbFactors=3,
    .factors=factors29,
    .lengths=lengths29,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config30={
-   .normalization=0.02777777777777777624f,
+   },
+   /* Length 75 */
+   {
+   .normalization=0.01333333333333333419f,
    .nbPerms=NB_PERM30,
    .perms=perm30,
-   .nbTwiddle=NB_TWIDDLE30,
-   .twiddle=twiddle30,
+   .nbTwiddle=NB_TWIDDLE34,
+   .twiddle=twiddle34,
    .nbGroupedFactors=2,
    .nbFactors=3,
    .factors=factors30,
    .lengths=lengths30,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config31={
-   .normalization=0.02500000000000000139f,
+   },
+   /* Length 80 */
+   {
+   .normalization=0.01250000000000000069f,
    .nbPerms=NB_PERM31,
    .perms=perm31,
-   .nbTwiddle=NB_TWIDDLE31,
-   .twiddle=twiddle31,
-   .nbGroupedFactors=2,
-   .nbFactors=2,
+   .nbTwiddle=NB_TWIDDLE35,
+   .twiddle=twiddle35,
+   .nbGroupedFactors=3,
+   .nbFactors=3,
    .factors=factors31,
    .lengths=lengths31,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config32={
-   .normalization=0.02222222222222222307f,
+   },
+   /* Length 81 */
+   {
+   .normalization=0.01234567901234567833f,
    .nbPerms=NB_PERM32,
    .perms=perm32,
-   .nbTwiddle=NB_TWIDDLE32,
-   .twiddle=twiddle32,
-   .nbGroupedFactors=2,
-   .nbFactors=3,
+   .nbTwiddle=NB_TWIDDLE36,
+   .twiddle=twiddle36,
+   .nbGroupedFactors=1,
+   .nbFactors=4,
    .factors=factors32,
    .lengths=lengths32,
    .format=0,
-   .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config33={
-   .normalization=0.02083333333333333218f,
+   .reversalVectorizable=1
+   },
+   /* Length 90 */
+   {
+   .normalization=0.01111111111111111154f,
    .nbPerms=NB_PERM33,
    .perms=perm33,
-   .nbTwiddle=NB_TWIDDLE33,
-   .twiddle=twiddle33,
+   .nbTwiddle=NB_TWIDDLE37,
+   .twiddle=twiddle37,
    .nbGroupedFactors=3,
-   .nbFactors=3,
+   .nbFactors=4,
    .factors=factors33,
    .lengths=lengths33,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config34={
-   .normalization=0.02000000000000000042f,
+   },
+   /* Length 96 */
+   {
+   .normalization=0.01041666666666666609f,
    .nbPerms=NB_PERM34,
    .perms=perm34,
-   .nbTwiddle=NB_TWIDDLE34,
-   .twiddle=twiddle34,
-   .nbGroupedFactors=2,
+   .nbTwiddle=NB_TWIDDLE38,
+   .twiddle=twiddle38,
+   .nbGroupedFactors=3,
    .nbFactors=3,
    .factors=factors34,
    .lengths=lengths34,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config35={
-   .normalization=0.00555555555555555577f,
+   },
+   /* Length 100 */
+   {
+   .normalization=0.01000000000000000021f,
    .nbPerms=NB_PERM35,
    .perms=perm35,
-   .nbTwiddle=NB_TWIDDLE35,
-   .twiddle=twiddle35,
-   .nbGroupedFactors=3,
-   .nbFactors=4,
+   .nbTwiddle=NB_TWIDDLE39,
+   .twiddle=twiddle39,
+   .nbGroupedFactors=2,
+   .nbFactors=3,
    .factors=factors35,
    .lengths=lengths35,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config36={
-   .normalization=0.01851851851851851749f,
+   },
+   /* Length 108 */
+   {
+   .normalization=0.00925925925925925875f,
    .nbPerms=NB_PERM36,
    .perms=perm36,
-   .nbTwiddle=NB_TWIDDLE36,
-   .twiddle=twiddle36,
+   .nbTwiddle=NB_TWIDDLE40,
+   .twiddle=twiddle40,
    .nbGroupedFactors=2,
    .nbFactors=4,
    .factors=factors36,
    .lengths=lengths36,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config37={
-   .normalization=0.01666666666666666644f,
+   },
+   /* Length 120 */
+   {
+   .normalization=0.00833333333333333322f,
    .nbPerms=NB_PERM37,
    .perms=perm37,
-   .nbTwiddle=NB_TWIDDLE37,
-   .twiddle=twiddle37,
+   .nbTwiddle=NB_TWIDDLE41,
+   .twiddle=twiddle41,
    .nbGroupedFactors=3,
    .nbFactors=3,
    .factors=factors37,
    .lengths=lengths37,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config38={
-   .normalization=0.01562500000000000000f,
+   },
+   /* Length 125 */
+   {
+   .normalization=0.00800000000000000017f,
    .nbPerms=NB_PERM38,
    .perms=perm38,
-   .nbTwiddle=NB_TWIDDLE38,
-   .twiddle=twiddle38,
+   .nbTwiddle=NB_TWIDDLE42,
+   .twiddle=twiddle42,
    .nbGroupedFactors=1,
-   .nbFactors=2,
+   .nbFactors=3,
    .factors=factors38,
    .lengths=lengths38,
    .format=0,
    .reversalVectorizable=1
-   };
-cfftconfig<float32_t> config39={
-   .normalization=0.00312500000000000017f,
+   },
+   /* Length 128 */
+   {
+   .normalization=0.00781250000000000000f,
    .nbPerms=NB_PERM39,
    .perms=perm39,
-   .nbTwiddle=NB_TWIDDLE39,
-   .twiddle=twiddle39,
+   .nbTwiddle=NB_TWIDDLE43,
+   .twiddle=twiddle43,
    .nbGroupedFactors=2,
    .nbFactors=3,
    .factors=factors39,
    .lengths=lengths39,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config40={
-   .normalization=0.00048828125000000000f,
+   },
+   /* Length 144 */
+   {
+   .normalization=0.00694444444444444406f,
    .nbPerms=NB_PERM40,
    .perms=perm40,
-   .nbTwiddle=NB_TWIDDLE40,
-   .twiddle=twiddle40,
-   .nbGroupedFactors=2,
-   .nbFactors=6,
+   .nbTwiddle=NB_TWIDDLE44,
+   .twiddle=twiddle44,
+   .nbGroupedFactors=3,
+   .nbFactors=4,
    .factors=factors40,
    .lengths=lengths40,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config41={
-   .normalization=0.00520833333333333304f,
+   },
+   /* Length 150 */
+   {
+   .normalization=0.00666666666666666709f,
    .nbPerms=NB_PERM41,
    .perms=perm41,
-   .nbTwiddle=NB_TWIDDLE41,
-   .twiddle=twiddle41,
-   .nbGroupedFactors=2,
-   .nbFactors=3,
+   .nbTwiddle=NB_TWIDDLE45,
+   .twiddle=twiddle45,
+   .nbGroupedFactors=3,
+   .nbFactors=4,
    .factors=factors41,
    .lengths=lengths41,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config42={
-   .normalization=0.01388888888888888812f,
+   },
+   /* Length 160 */
+   {
+   .normalization=0.00625000000000000035f,
    .nbPerms=NB_PERM42,
    .perms=perm42,
-   .nbTwiddle=NB_TWIDDLE42,
-   .twiddle=twiddle42,
-   .nbGroupedFactors=2,
+   .nbTwiddle=NB_TWIDDLE46,
+   .twiddle=twiddle46,
+   .nbGroupedFactors=3,
    .nbFactors=3,
    .factors=factors42,
    .lengths=lengths42,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config43={
-   .normalization=0.00500000000000000010f,
+   },
+   /* Length 180 */
+   {
+   .normalization=0.00555555555555555577f,
    .nbPerms=NB_PERM43,
    .perms=perm43,
-   .nbTwiddle=NB_TWIDDLE43,
-   .twiddle=twiddle43,
-   .nbGroupedFactors=2,
-   .nbFactors=3,
+   .nbTwiddle=NB_TWIDDLE47,
+   .twiddle=twiddle47,
+   .nbGroupedFactors=3,
+   .nbFactors=4,
    .factors=factors43,
    .lengths=lengths43,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config44={
-   .normalization=0.01333333333333333419f,
+   },
+   /* Length 192 */
+   {
+   .normalization=0.00520833333333333304f,
    .nbPerms=NB_PERM44,
    .perms=perm44,
-   .nbTwiddle=NB_TWIDDLE44,
-   .twiddle=twiddle44,
+   .nbTwiddle=NB_TWIDDLE48,
+   .twiddle=twiddle48,
    .nbGroupedFactors=2,
    .nbFactors=3,
    .factors=factors44,
    .lengths=lengths44,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config45={
-   .normalization=0.01250000000000000069f,
+   },
+   /* Length 200 */
+   {
+   .normalization=0.00500000000000000010f,
    .nbPerms=NB_PERM45,
    .perms=perm45,
-   .nbTwiddle=NB_TWIDDLE45,
-   .twiddle=twiddle45,
-   .nbGroupedFactors=3,
+   .nbTwiddle=NB_TWIDDLE49,
+   .twiddle=twiddle49,
+   .nbGroupedFactors=2,
    .nbFactors=3,
    .factors=factors45,
    .lengths=lengths45,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config46={
-   .normalization=0.01234567901234567833f,
+   },
+   /* Length 216 */
+   {
+   .normalization=0.00462962962962962937f,
    .nbPerms=NB_PERM46,
    .perms=perm46,
-   .nbTwiddle=NB_TWIDDLE46,
-   .twiddle=twiddle46,
-   .nbGroupedFactors=1,
+   .nbTwiddle=NB_TWIDDLE50,
+   .twiddle=twiddle50,
+   .nbGroupedFactors=2,
    .nbFactors=4,
    .factors=factors46,
    .lengths=lengths46,
    .format=0,
-   .reversalVectorizable=1
-   };
-cfftconfig<float32_t> config47={
-   .normalization=0.00462962962962962937f,
+   .reversalVectorizable=0
+   },
+   /* Length 240 */
+   {
+   .normalization=0.00416666666666666661f,
    .nbPerms=NB_PERM47,
    .perms=perm47,
-   .nbTwiddle=NB_TWIDDLE47,
-   .twiddle=twiddle47,
-   .nbGroupedFactors=2,
+   .nbTwiddle=NB_TWIDDLE51,
+   .twiddle=twiddle51,
+   .nbGroupedFactors=4,
    .nbFactors=4,
    .factors=factors47,
    .lengths=lengths47,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config48={
-   .normalization=0.01111111111111111154f,
+   },
+   /* Length 256 */
+   {
+   .normalization=0.00390625000000000000f,
    .nbPerms=NB_PERM48,
    .perms=perm48,
-   .nbTwiddle=NB_TWIDDLE48,
-   .twiddle=twiddle48,
-   .nbGroupedFactors=3,
-   .nbFactors=4,
+   .nbTwiddle=NB_TWIDDLE52,
+   .twiddle=twiddle52,
+   .nbGroupedFactors=2,
+   .nbFactors=3,
    .factors=factors48,
    .lengths=lengths48,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config49={
-   .normalization=0.01041666666666666609f,
+   },
+   /* Length 288 */
+   {
+   .normalization=0.00347222222222222203f,
    .nbPerms=NB_PERM49,
    .perms=perm49,
-   .nbTwiddle=NB_TWIDDLE49,
-   .twiddle=twiddle49,
+   .nbTwiddle=NB_TWIDDLE53,
+   .twiddle=twiddle53,
    .nbGroupedFactors=3,
-   .nbFactors=3,
+   .nbFactors=4,
    .factors=factors49,
    .lengths=lengths49,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config50={
-   .normalization=0.01000000000000000021f,
+   },
+   /* Length 320 */
+   {
+   .normalization=0.00312500000000000017f,
    .nbPerms=NB_PERM50,
    .perms=perm50,
-   .nbTwiddle=NB_TWIDDLE50,
-   .twiddle=twiddle50,
+   .nbTwiddle=NB_TWIDDLE54,
+   .twiddle=twiddle54,
    .nbGroupedFactors=2,
    .nbFactors=3,
    .factors=factors50,
    .lengths=lengths50,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config51={
-   .normalization=0.00925925925925925875f,
+   },
+   /* Length 384 */
+   {
+   .normalization=0.00260416666666666652f,
    .nbPerms=NB_PERM51,
    .perms=perm51,
-   .nbTwiddle=NB_TWIDDLE51,
-   .twiddle=twiddle51,
-   .nbGroupedFactors=2,
+   .nbTwiddle=NB_TWIDDLE55,
+   .twiddle=twiddle55,
+   .nbGroupedFactors=3,
    .nbFactors=4,
    .factors=factors51,
    .lengths=lengths51,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config52={
-   .normalization=0.00416666666666666661f,
+   },
+   /* Length 400 */
+   {
+   .normalization=0.00250000000000000005f,
    .nbPerms=NB_PERM52,
    .perms=perm52,
-   .nbTwiddle=NB_TWIDDLE52,
-   .twiddle=twiddle52,
-   .nbGroupedFactors=4,
+   .nbTwiddle=NB_TWIDDLE56,
+   .twiddle=twiddle56,
+   .nbGroupedFactors=3,
    .nbFactors=4,
    .factors=factors52,
    .lengths=lengths52,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config53={
-   .normalization=0.00833333333333333322f,
+   },
+   /* Length 512 */
+   {
+   .normalization=0.00195312500000000000f,
    .nbPerms=NB_PERM53,
    .perms=perm53,
-   .nbTwiddle=NB_TWIDDLE53,
-   .twiddle=twiddle53,
-   .nbGroupedFactors=3,
+   .nbTwiddle=NB_TWIDDLE57,
+   .twiddle=twiddle57,
+   .nbGroupedFactors=1,
    .nbFactors=3,
    .factors=factors53,
    .lengths=lengths53,
    .format=0,
-   .reversalVectorizable=0
-   };
-cfftconfig<float32_t> config54={
-   .normalization=0.00800000000000000017f,
+   .reversalVectorizable=1
+   },
+   /* Length 1024 */
+   {
+   .normalization=0.00097656250000000000f,
    .nbPerms=NB_PERM54,
    .perms=perm54,
-   .nbTwiddle=NB_TWIDDLE54,
-   .twiddle=twiddle54,
+   .nbTwiddle=NB_TWIDDLE58,
+   .twiddle=twiddle58,
    .nbGroupedFactors=1,
-   .nbFactors=3,
+   .nbFactors=5,
    .factors=factors54,
    .lengths=lengths54,
    .format=0,
    .reversalVectorizable=1
-   };
+   },
+   /* Length 2048 */
+   {
+   .normalization=0.00048828125000000000f,
+   .nbPerms=NB_PERM55,
+   .perms=perm55,
+   .nbTwiddle=NB_TWIDDLE59,
+   .twiddle=twiddle59,
+   .nbGroupedFactors=2,
+   .nbFactors=6,
+   .factors=factors55,
+   .lengths=lengths55,
+   .format=0,
+   .reversalVectorizable=0
+   },
+   /* Length 4096 */
+   {
+   .normalization=0.00024414062500000000f,
+   .nbPerms=NB_PERM56,
+   .perms=perm56,
+   .nbTwiddle=NB_TWIDDLE60,
+   .twiddle=twiddle60,
+   .nbGroupedFactors=1,
+   .nbFactors=6,
+   .factors=factors56,
+   .lengths=lengths56,
+   .format=0,
+   .reversalVectorizable=1
+   },
+};
+
+const uint16_t cfftLengthsF32[54]={2,3,4,5,6,8,9,10,12,15,16,18,20,24,25,27,30,32,36,40,45,48,50,54,60,64,72,75,80,81,90,96,100,108,120,125,128,144,150,160,180,192,200,216,240,256,288,320,384,400,512,1024,2048,4096};
+
 
 template<>
 const cfftconfig<float32_t> *cfft_config<float32_t>(uint32_t nbSamples)
 {
-    switch(nbSamples)
-    {
-        case 2:
-            return(&config3);
-        break;
-        case 3:
-            return(&config4);
-        break;
-        case 4:
-            return(&config5);
-        break;
-        case 5:
-            return(&config6);
-        break;
-        case 6:
-            return(&config7);
-        break;
-        case 8:
-            return(&config9);
-        break;
-        case 9:
-            return(&config10);
-        break;
-        case 10:
-            return(&config11);
-        break;
-        case 12:
-            return(&config13);
-        break;
-        case 15:
-            return(&config15);
-        break;
-        case 16:
-            return(&config16);
-        break;
-        case 18:
-            return(&config18);
-        break;
-        case 20:
-            return(&config20);
-        break;
-        case 24:
-            return(&config22);
-        break;
-        case 25:
-            return(&config23);
-        break;
-        case 27:
-            return(&config24);
-        break;
-        case 30:
-            return(&config25);
-        break;
-        case 32:
-            return(&config26);
-        break;
-        case 36:
-            return(&config30);
-        break;
-        case 40:
-            return(&config31);
-        break;
-        case 45:
-            return(&config32);
-        break;
-        case 48:
-            return(&config33);
-        break;
-        case 50:
-            return(&config34);
-        break;
-        case 54:
-            return(&config36);
-        break;
-        case 60:
-            return(&config37);
-        break;
-        case 64:
-            return(&config38);
-        break;
-        case 72:
-            return(&config42);
-        break;
-        case 75:
-            return(&config44);
-        break;
-        case 80:
-            return(&config45);
-        break;
-        case 81:
-            return(&config46);
-        break;
-        case 90:
-            return(&config48);
-        break;
-        case 96:
-            return(&config49);
-        break;
-        case 100:
-            return(&config50);
-        break;
-        case 108:
-            return(&config51);
-        break;
-        case 120:
-            return(&config53);
-        break;
-        case 125:
-            return(&config54);
-        break;
-        case 128:
-            return(&config12);
-        break;
-        case 144:
-            return(&config17);
-        break;
-        case 150:
-            return(&config21);
-        break;
-        case 160:
-            return(&config29);
-        break;
-        case 180:
-            return(&config35);
-        break;
-        case 192:
-            return(&config41);
-        break;
-        case 200:
-            return(&config43);
-        break;
-        case 216:
-            return(&config47);
-        break;
-        case 240:
-            return(&config52);
-        break;
-        case 256:
-            return(&config1);
-        break;
-        case 288:
-            return(&config27);
-        break;
-        case 320:
-            return(&config39);
-        break;
-        case 384:
-            return(&config14);
-        break;
-        case 400:
-            return(&config19);
-        break;
-        case 512:
-            return(&config8);
-        break;
-        case 1024:
-            return(&config28);
-        break;
-        case 2048:
-            return(&config40);
-        break;
-        case 4096:
-            return(&config2);
-        break;
-
-    }
-    return(NULL);
+    return(fft_config_search(cfftLengthsF32,cfftConfigsF32,54,nbSamples));
 }
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-cfftconfig<float16_t> config55={
-   .normalization=0.00390625000000000000f16,
+const cfftconfig<float16_t> cfftConfigsF16[54]={
+   /* Length 2 */
+   {
+   .normalization=0.50000000000000000000f16,
    .nbPerms=NB_PERM1,
    .perms=perm1,
-   .nbTwiddle=NB_TWIDDLE55,
-   .twiddle=twiddle55,
-   .nbGroupedFactors=2,
-   .nbFactors=3,
+   .nbTwiddle=NB_TWIDDLE61,
+   .twiddle=twiddle61,
+   .nbGroupedFactors=1,
+   .nbFactors=1,
    .factors=factors1,
    .lengths=lengths1,
    .format=0,
-   .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config56={
-   .normalization=0.00024414062500000000f16,
+   .reversalVectorizable=1
+   },
+   /* Length 3 */
+   {
+   .normalization=0.33333333333333331483f16,
    .nbPerms=NB_PERM2,
    .perms=perm2,
-   .nbTwiddle=NB_TWIDDLE56,
-   .twiddle=twiddle56,
+   .nbTwiddle=NB_TWIDDLE62,
+   .twiddle=twiddle62,
    .nbGroupedFactors=1,
-   .nbFactors=6,
+   .nbFactors=1,
    .factors=factors2,
    .lengths=lengths2,
    .format=0,
    .reversalVectorizable=1
-   };
-cfftconfig<float16_t> config57={
-   .normalization=0.50000000000000000000f16,
+   },
+   /* Length 4 */
+   {
+   .normalization=0.25000000000000000000f16,
    .nbPerms=NB_PERM3,
    .perms=perm3,
-   .nbTwiddle=NB_TWIDDLE57,
-   .twiddle=twiddle57,
+   .nbTwiddle=NB_TWIDDLE63,
+   .twiddle=twiddle63,
    .nbGroupedFactors=1,
    .nbFactors=1,
    .factors=factors3,
    .lengths=lengths3,
    .format=0,
    .reversalVectorizable=1
-   };
-cfftconfig<float16_t> config58={
-   .normalization=0.33333333333333331483f16,
-   .nbPerms=NB_PERM4,
-   .perms=perm4,
-   .nbTwiddle=NB_TWIDDLE58,
-   .twiddle=twiddle58,
-   .nbGroupedFactors=1,
-   .nbFactors=1,
-   .factors=factors4,
-   .lengths=lengths4,
-   .format=0,
-   .reversalVectorizable=1
-   };
-cfftconfig<float16_t> config59={
-   .normalization=0.25000000000000000000f16,
-   .nbPerms=NB_PERM5,
-   .perms=perm5,
-   .nbTwiddle=NB_TWIDDLE59,
-   .twiddle=twiddle59,
-   .nbGroupedFactors=1,
-   .nbFactors=1,
-   .factors=factors5,
-   .lengths=lengths5,
-   .format=0,
-   .reversalVectorizable=1
-   };
-cfftconfig<float16_t> config60={
+   },
+   /* Length 5 */
+   {
    .normalization=0.20000000000000001110f16,
-   .nbPerms=NB_PERM6,
-   .perms=perm6,
-   .nbTwiddle=NB_TWIDDLE60,
-   .twiddle=twiddle60,
+   .nbPerms=NB_PERM7,
+   .perms=perm7,
+   .nbTwiddle=NB_TWIDDLE64,
+   .twiddle=twiddle64,
    .nbGroupedFactors=1,
    .nbFactors=1,
-   .factors=factors6,
-   .lengths=lengths6,
+   .factors=factors7,
+   .lengths=lengths7,
    .format=0,
    .reversalVectorizable=1
-   };
-cfftconfig<float16_t> config61={
+   },
+   /* Length 6 */
+   {
    .normalization=0.16666666666666665741f16,
-   .nbPerms=NB_PERM7,
-   .perms=perm7,
-   .nbTwiddle=NB_TWIDDLE61,
-   .twiddle=twiddle61,
+   .nbPerms=NB_PERM4,
+   .perms=perm4,
+   .nbTwiddle=NB_TWIDDLE65,
+   .twiddle=twiddle65,
    .nbGroupedFactors=2,
    .nbFactors=2,
-   .factors=factors7,
-   .lengths=lengths7,
+   .factors=factors4,
+   .lengths=lengths4,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config62={
-   .normalization=0.00195312500000000000f16,
+   },
+   /* Length 8 */
+   {
+   .normalization=0.12500000000000000000f16,
    .nbPerms=NB_PERM8,
    .perms=perm8,
-   .nbTwiddle=NB_TWIDDLE62,
-   .twiddle=twiddle62,
+   .nbTwiddle=NB_TWIDDLE66,
+   .twiddle=twiddle66,
    .nbGroupedFactors=1,
-   .nbFactors=3,
+   .nbFactors=1,
    .factors=factors8,
    .lengths=lengths8,
    .format=0,
    .reversalVectorizable=1
-   };
-cfftconfig<float16_t> config63={
-   .normalization=0.12500000000000000000f16,
+   },
+   /* Length 9 */
+   {
+   .normalization=0.11111111111111110494f16,
    .nbPerms=NB_PERM9,
    .perms=perm9,
-   .nbTwiddle=NB_TWIDDLE63,
-   .twiddle=twiddle63,
+   .nbTwiddle=NB_TWIDDLE67,
+   .twiddle=twiddle67,
    .nbGroupedFactors=1,
-   .nbFactors=1,
+   .nbFactors=2,
    .factors=factors9,
    .lengths=lengths9,
    .format=0,
    .reversalVectorizable=1
-   };
-cfftconfig<float16_t> config64={
-   .normalization=0.11111111111111110494f16,
+   },
+   /* Length 10 */
+   {
+   .normalization=0.10000000000000000555f16,
    .nbPerms=NB_PERM10,
    .perms=perm10,
-   .nbTwiddle=NB_TWIDDLE64,
-   .twiddle=twiddle64,
-   .nbGroupedFactors=1,
+   .nbTwiddle=NB_TWIDDLE68,
+   .twiddle=twiddle68,
+   .nbGroupedFactors=2,
    .nbFactors=2,
    .factors=factors10,
    .lengths=lengths10,
    .format=0,
-   .reversalVectorizable=1
-   };
-cfftconfig<float16_t> config65={
-   .normalization=0.10000000000000000555f16,
+   .reversalVectorizable=0
+   },
+   /* Length 12 */
+   {
+   .normalization=0.08333333333333332871f16,
    .nbPerms=NB_PERM11,
    .perms=perm11,
-   .nbTwiddle=NB_TWIDDLE65,
-   .twiddle=twiddle65,
+   .nbTwiddle=NB_TWIDDLE69,
+   .twiddle=twiddle69,
    .nbGroupedFactors=2,
    .nbFactors=2,
    .factors=factors11,
    .lengths=lengths11,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config66={
-   .normalization=0.00781250000000000000f16,
+   },
+   /* Length 15 */
+   {
+   .normalization=0.06666666666666666574f16,
    .nbPerms=NB_PERM12,
    .perms=perm12,
-   .nbTwiddle=NB_TWIDDLE66,
-   .twiddle=twiddle66,
+   .nbTwiddle=NB_TWIDDLE70,
+   .twiddle=twiddle70,
    .nbGroupedFactors=2,
-   .nbFactors=3,
+   .nbFactors=2,
    .factors=factors12,
    .lengths=lengths12,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config67={
-   .normalization=0.08333333333333332871f16,
+   },
+   /* Length 16 */
+   {
+   .normalization=0.06250000000000000000f16,
    .nbPerms=NB_PERM13,
    .perms=perm13,
-   .nbTwiddle=NB_TWIDDLE67,
-   .twiddle=twiddle67,
+   .nbTwiddle=NB_TWIDDLE71,
+   .twiddle=twiddle71,
    .nbGroupedFactors=2,
    .nbFactors=2,
    .factors=factors13,
    .lengths=lengths13,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config68={
-   .normalization=0.00260416666666666652f16,
+   },
+   /* Length 18 */
+   {
+   .normalization=0.05555555555555555247f16,
    .nbPerms=NB_PERM14,
    .perms=perm14,
-   .nbTwiddle=NB_TWIDDLE68,
-   .twiddle=twiddle68,
-   .nbGroupedFactors=3,
-   .nbFactors=4,
+   .nbTwiddle=NB_TWIDDLE72,
+   .twiddle=twiddle72,
+   .nbGroupedFactors=2,
+   .nbFactors=3,
    .factors=factors14,
    .lengths=lengths14,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config69={
-   .normalization=0.06666666666666666574f16,
+   },
+   /* Length 20 */
+   {
+   .normalization=0.05000000000000000278f16,
    .nbPerms=NB_PERM15,
    .perms=perm15,
-   .nbTwiddle=NB_TWIDDLE69,
-   .twiddle=twiddle69,
+   .nbTwiddle=NB_TWIDDLE73,
+   .twiddle=twiddle73,
    .nbGroupedFactors=2,
    .nbFactors=2,
    .factors=factors15,
    .lengths=lengths15,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config70={
-   .normalization=0.06250000000000000000f16,
+   },
+   /* Length 24 */
+   {
+   .normalization=0.04166666666666666435f16,
    .nbPerms=NB_PERM16,
    .perms=perm16,
-   .nbTwiddle=NB_TWIDDLE70,
-   .twiddle=twiddle70,
+   .nbTwiddle=NB_TWIDDLE74,
+   .twiddle=twiddle74,
    .nbGroupedFactors=2,
    .nbFactors=2,
    .factors=factors16,
    .lengths=lengths16,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config71={
-   .normalization=0.00694444444444444406f16,
+   },
+   /* Length 25 */
+   {
+   .normalization=0.04000000000000000083f16,
    .nbPerms=NB_PERM17,
    .perms=perm17,
-   .nbTwiddle=NB_TWIDDLE71,
-   .twiddle=twiddle71,
-   .nbGroupedFactors=3,
-   .nbFactors=4,
+   .nbTwiddle=NB_TWIDDLE75,
+   .twiddle=twiddle75,
+   .nbGroupedFactors=1,
+   .nbFactors=2,
    .factors=factors17,
    .lengths=lengths17,
    .format=0,
-   .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config72={
-   .normalization=0.05555555555555555247f16,
+   .reversalVectorizable=1
+   },
+   /* Length 27 */
+   {
+   .normalization=0.03703703703703703498f16,
    .nbPerms=NB_PERM18,
    .perms=perm18,
-   .nbTwiddle=NB_TWIDDLE72,
-   .twiddle=twiddle72,
-   .nbGroupedFactors=2,
+   .nbTwiddle=NB_TWIDDLE76,
+   .twiddle=twiddle76,
+   .nbGroupedFactors=1,
    .nbFactors=3,
    .factors=factors18,
    .lengths=lengths18,
    .format=0,
-   .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config73={
-   .normalization=0.00250000000000000005f16,
+   .reversalVectorizable=1
+   },
+   /* Length 30 */
+   {
+   .normalization=0.03333333333333333287f16,
    .nbPerms=NB_PERM19,
    .perms=perm19,
-   .nbTwiddle=NB_TWIDDLE73,
-   .twiddle=twiddle73,
+   .nbTwiddle=NB_TWIDDLE77,
+   .twiddle=twiddle77,
    .nbGroupedFactors=3,
-   .nbFactors=4,
+   .nbFactors=3,
    .factors=factors19,
    .lengths=lengths19,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config74={
-   .normalization=0.05000000000000000278f16,
+   },
+   /* Length 32 */
+   {
+   .normalization=0.03125000000000000000f16,
    .nbPerms=NB_PERM20,
    .perms=perm20,
-   .nbTwiddle=NB_TWIDDLE74,
-   .twiddle=twiddle74,
+   .nbTwiddle=NB_TWIDDLE78,
+   .twiddle=twiddle78,
    .nbGroupedFactors=2,
    .nbFactors=2,
    .factors=factors20,
    .lengths=lengths20,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config75={
-   .normalization=0.00666666666666666709f16,
+   },
+   /* Length 36 */
+   {
+   .normalization=0.02777777777777777624f16,
    .nbPerms=NB_PERM21,
    .perms=perm21,
-   .nbTwiddle=NB_TWIDDLE75,
-   .twiddle=twiddle75,
-   .nbGroupedFactors=3,
-   .nbFactors=4,
+   .nbTwiddle=NB_TWIDDLE79,
+   .twiddle=twiddle79,
+   .nbGroupedFactors=2,
+   .nbFactors=3,
    .factors=factors21,
    .lengths=lengths21,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config76={
-   .normalization=0.04166666666666666435f16,
+   },
+   /* Length 40 */
+   {
+   .normalization=0.02500000000000000139f16,
    .nbPerms=NB_PERM22,
    .perms=perm22,
-   .nbTwiddle=NB_TWIDDLE76,
-   .twiddle=twiddle76,
+   .nbTwiddle=NB_TWIDDLE80,
+   .twiddle=twiddle80,
    .nbGroupedFactors=2,
    .nbFactors=2,
    .factors=factors22,
    .lengths=lengths22,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config77={
-   .normalization=0.04000000000000000083f16,
+   },
+   /* Length 45 */
+   {
+   .normalization=0.02222222222222222307f16,
    .nbPerms=NB_PERM23,
    .perms=perm23,
-   .nbTwiddle=NB_TWIDDLE77,
-   .twiddle=twiddle77,
-   .nbGroupedFactors=1,
-   .nbFactors=2,
+   .nbTwiddle=NB_TWIDDLE81,
+   .twiddle=twiddle81,
+   .nbGroupedFactors=2,
+   .nbFactors=3,
    .factors=factors23,
    .lengths=lengths23,
    .format=0,
-   .reversalVectorizable=1
-   };
-cfftconfig<float16_t> config78={
-   .normalization=0.03703703703703703498f16,
+   .reversalVectorizable=0
+   },
+   /* Length 48 */
+   {
+   .normalization=0.02083333333333333218f16,
    .nbPerms=NB_PERM24,
    .perms=perm24,
-   .nbTwiddle=NB_TWIDDLE78,
-   .twiddle=twiddle78,
-   .nbGroupedFactors=1,
+   .nbTwiddle=NB_TWIDDLE82,
+   .twiddle=twiddle82,
+   .nbGroupedFactors=3,
    .nbFactors=3,
    .factors=factors24,
    .lengths=lengths24,
    .format=0,
-   .reversalVectorizable=1
-   };
-cfftconfig<float16_t> config79={
-   .normalization=0.03333333333333333287f16,
+   .reversalVectorizable=0
+   },
+   /* Length 50 */
+   {
+   .normalization=0.02000000000000000042f16,
    .nbPerms=NB_PERM25,
    .perms=perm25,
-   .nbTwiddle=NB_TWIDDLE79,
-   .twiddle=twiddle79,
-   .nbGroupedFactors=3,
+   .nbTwiddle=NB_TWIDDLE83,
+   .twiddle=twiddle83,
+   .nbGroupedFactors=2,
    .nbFactors=3,
    .factors=factors25,
    .lengths=lengths25,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config80={
-   .normalization=0.03125000000000000000f16,
+   },
+   /* Length 54 */
+   {
+   .normalization=0.01851851851851851749f16,
    .nbPerms=NB_PERM26,
    .perms=perm26,
-   .nbTwiddle=NB_TWIDDLE80,
-   .twiddle=twiddle80,
+   .nbTwiddle=NB_TWIDDLE84,
+   .twiddle=twiddle84,
    .nbGroupedFactors=2,
-   .nbFactors=2,
+   .nbFactors=4,
    .factors=factors26,
    .lengths=lengths26,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config81={
-   .normalization=0.00347222222222222203f16,
+   },
+   /* Length 60 */
+   {
+   .normalization=0.01666666666666666644f16,
    .nbPerms=NB_PERM27,
    .perms=perm27,
-   .nbTwiddle=NB_TWIDDLE81,
-   .twiddle=twiddle81,
+   .nbTwiddle=NB_TWIDDLE85,
+   .twiddle=twiddle85,
    .nbGroupedFactors=3,
-   .nbFactors=4,
+   .nbFactors=3,
    .factors=factors27,
    .lengths=lengths27,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config82={
-   .normalization=0.00097656250000000000f16,
+   },
+   /* Length 64 */
+   {
+   .normalization=0.01562500000000000000f16,
    .nbPerms=NB_PERM28,
    .perms=perm28,
-   .nbTwiddle=NB_TWIDDLE82,
-   .twiddle=twiddle82,
+   .nbTwiddle=NB_TWIDDLE86,
+   .twiddle=twiddle86,
    .nbGroupedFactors=1,
-   .nbFactors=5,
+   .nbFactors=2,
    .factors=factors28,
    .lengths=lengths28,
    .format=0,
    .reversalVectorizable=1
-   };
-cfftconfig<float16_t> config83={
-   .normalization=0.00625000000000000035f16,
+   },
+   /* Length 72 */
+   {
+   .normalization=0.01388888888888888812f16,
    .nbPerms=NB_PERM29,
    .perms=perm29,
-   .nbTwiddle=NB_TWIDDLE83,
-   .twiddle=twiddle83,
-   .nbGroupedFactors=3,
+   .nbTwiddle=NB_TWIDDLE87,
+   .twiddle=twiddle87,
+   .nbGroupedFactors=2,
    .nbFactors=3,
    .factors=factors29,
    .lengths=lengths29,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config84={
-   .normalization=0.02777777777777777624f16,
+   },
+   /* Length 75 */
+   {
+   .normalization=0.01333333333333333419f16,
    .nbPerms=NB_PERM30,
    .perms=perm30,
-   .nbTwiddle=NB_TWIDDLE84,
-   .twiddle=twiddle84,
+   .nbTwiddle=NB_TWIDDLE88,
+   .twiddle=twiddle88,
    .nbGroupedFactors=2,
    .nbFactors=3,
    .factors=factors30,
    .lengths=lengths30,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config85={
-   .normalization=0.02500000000000000139f16,
+   },
+   /* Length 80 */
+   {
+   .normalization=0.01250000000000000069f16,
    .nbPerms=NB_PERM31,
    .perms=perm31,
-   .nbTwiddle=NB_TWIDDLE85,
-   .twiddle=twiddle85,
-   .nbGroupedFactors=2,
-   .nbFactors=2,
+   .nbTwiddle=NB_TWIDDLE89,
+   .twiddle=twiddle89,
+   .nbGroupedFactors=3,
+   .nbFactors=3,
    .factors=factors31,
    .lengths=lengths31,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config86={
-   .normalization=0.02222222222222222307f16,
+   },
+   /* Length 81 */
+   {
+   .normalization=0.01234567901234567833f16,
    .nbPerms=NB_PERM32,
    .perms=perm32,
-   .nbTwiddle=NB_TWIDDLE86,
-   .twiddle=twiddle86,
-   .nbGroupedFactors=2,
-   .nbFactors=3,
+   .nbTwiddle=NB_TWIDDLE90,
+   .twiddle=twiddle90,
+   .nbGroupedFactors=1,
+   .nbFactors=4,
    .factors=factors32,
    .lengths=lengths32,
    .format=0,
-   .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config87={
-   .normalization=0.02083333333333333218f16,
+   .reversalVectorizable=1
+   },
+   /* Length 90 */
+   {
+   .normalization=0.01111111111111111154f16,
    .nbPerms=NB_PERM33,
    .perms=perm33,
-   .nbTwiddle=NB_TWIDDLE87,
-   .twiddle=twiddle87,
+   .nbTwiddle=NB_TWIDDLE91,
+   .twiddle=twiddle91,
    .nbGroupedFactors=3,
-   .nbFactors=3,
+   .nbFactors=4,
    .factors=factors33,
    .lengths=lengths33,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config88={
-   .normalization=0.02000000000000000042f16,
+   },
+   /* Length 96 */
+   {
+   .normalization=0.01041666666666666609f16,
    .nbPerms=NB_PERM34,
    .perms=perm34,
-   .nbTwiddle=NB_TWIDDLE88,
-   .twiddle=twiddle88,
-   .nbGroupedFactors=2,
+   .nbTwiddle=NB_TWIDDLE92,
+   .twiddle=twiddle92,
+   .nbGroupedFactors=3,
    .nbFactors=3,
    .factors=factors34,
    .lengths=lengths34,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config89={
-   .normalization=0.00555555555555555577f16,
+   },
+   /* Length 100 */
+   {
+   .normalization=0.01000000000000000021f16,
    .nbPerms=NB_PERM35,
    .perms=perm35,
-   .nbTwiddle=NB_TWIDDLE89,
-   .twiddle=twiddle89,
-   .nbGroupedFactors=3,
-   .nbFactors=4,
+   .nbTwiddle=NB_TWIDDLE93,
+   .twiddle=twiddle93,
+   .nbGroupedFactors=2,
+   .nbFactors=3,
    .factors=factors35,
    .lengths=lengths35,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config90={
-   .normalization=0.01851851851851851749f16,
+   },
+   /* Length 108 */
+   {
+   .normalization=0.00925925925925925875f16,
    .nbPerms=NB_PERM36,
    .perms=perm36,
-   .nbTwiddle=NB_TWIDDLE90,
-   .twiddle=twiddle90,
+   .nbTwiddle=NB_TWIDDLE94,
+   .twiddle=twiddle94,
    .nbGroupedFactors=2,
    .nbFactors=4,
    .factors=factors36,
    .lengths=lengths36,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config91={
-   .normalization=0.01666666666666666644f16,
+   },
+   /* Length 120 */
+   {
+   .normalization=0.00833333333333333322f16,
    .nbPerms=NB_PERM37,
    .perms=perm37,
-   .nbTwiddle=NB_TWIDDLE91,
-   .twiddle=twiddle91,
+   .nbTwiddle=NB_TWIDDLE95,
+   .twiddle=twiddle95,
    .nbGroupedFactors=3,
    .nbFactors=3,
    .factors=factors37,
    .lengths=lengths37,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config92={
-   .normalization=0.01562500000000000000f16,
+   },
+   /* Length 125 */
+   {
+   .normalization=0.00800000000000000017f16,
    .nbPerms=NB_PERM38,
    .perms=perm38,
-   .nbTwiddle=NB_TWIDDLE92,
-   .twiddle=twiddle92,
+   .nbTwiddle=NB_TWIDDLE96,
+   .twiddle=twiddle96,
    .nbGroupedFactors=1,
-   .nbFactors=2,
+   .nbFactors=3,
    .factors=factors38,
    .lengths=lengths38,
    .format=0,
    .reversalVectorizable=1
-   };
-cfftconfig<float16_t> config93={
-   .normalization=0.00312500000000000017f16,
+   },
+   /* Length 128 */
+   {
+   .normalization=0.00781250000000000000f16,
    .nbPerms=NB_PERM39,
    .perms=perm39,
-   .nbTwiddle=NB_TWIDDLE93,
-   .twiddle=twiddle93,
+   .nbTwiddle=NB_TWIDDLE97,
+   .twiddle=twiddle97,
    .nbGroupedFactors=2,
    .nbFactors=3,
    .factors=factors39,
    .lengths=lengths39,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config94={
-   .normalization=0.00048828125000000000f16,
+   },
+   /* Length 144 */
+   {
+   .normalization=0.00694444444444444406f16,
    .nbPerms=NB_PERM40,
    .perms=perm40,
-   .nbTwiddle=NB_TWIDDLE94,
-   .twiddle=twiddle94,
-   .nbGroupedFactors=2,
-   .nbFactors=6,
+   .nbTwiddle=NB_TWIDDLE98,
+   .twiddle=twiddle98,
+   .nbGroupedFactors=3,
+   .nbFactors=4,
    .factors=factors40,
    .lengths=lengths40,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config95={
-   .normalization=0.00520833333333333304f16,
+   },
+   /* Length 150 */
+   {
+   .normalization=0.00666666666666666709f16,
    .nbPerms=NB_PERM41,
    .perms=perm41,
-   .nbTwiddle=NB_TWIDDLE95,
-   .twiddle=twiddle95,
-   .nbGroupedFactors=2,
-   .nbFactors=3,
+   .nbTwiddle=NB_TWIDDLE99,
+   .twiddle=twiddle99,
+   .nbGroupedFactors=3,
+   .nbFactors=4,
    .factors=factors41,
    .lengths=lengths41,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config96={
-   .normalization=0.01388888888888888812f16,
+   },
+   /* Length 160 */
+   {
+   .normalization=0.00625000000000000035f16,
    .nbPerms=NB_PERM42,
    .perms=perm42,
-   .nbTwiddle=NB_TWIDDLE96,
-   .twiddle=twiddle96,
-   .nbGroupedFactors=2,
+   .nbTwiddle=NB_TWIDDLE100,
+   .twiddle=twiddle100,
+   .nbGroupedFactors=3,
    .nbFactors=3,
    .factors=factors42,
    .lengths=lengths42,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config97={
-   .normalization=0.00500000000000000010f16,
+   },
+   /* Length 180 */
+   {
+   .normalization=0.00555555555555555577f16,
    .nbPerms=NB_PERM43,
    .perms=perm43,
-   .nbTwiddle=NB_TWIDDLE97,
-   .twiddle=twiddle97,
-   .nbGroupedFactors=2,
-   .nbFactors=3,
+   .nbTwiddle=NB_TWIDDLE101,
+   .twiddle=twiddle101,
+   .nbGroupedFactors=3,
+   .nbFactors=4,
    .factors=factors43,
    .lengths=lengths43,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config98={
-   .normalization=0.01333333333333333419f16,
+   },
+   /* Length 192 */
+   {
+   .normalization=0.00520833333333333304f16,
    .nbPerms=NB_PERM44,
    .perms=perm44,
-   .nbTwiddle=NB_TWIDDLE98,
-   .twiddle=twiddle98,
+   .nbTwiddle=NB_TWIDDLE102,
+   .twiddle=twiddle102,
    .nbGroupedFactors=2,
    .nbFactors=3,
    .factors=factors44,
    .lengths=lengths44,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config99={
-   .normalization=0.01250000000000000069f16,
+   },
+   /* Length 200 */
+   {
+   .normalization=0.00500000000000000010f16,
    .nbPerms=NB_PERM45,
    .perms=perm45,
-   .nbTwiddle=NB_TWIDDLE99,
-   .twiddle=twiddle99,
-   .nbGroupedFactors=3,
+   .nbTwiddle=NB_TWIDDLE103,
+   .twiddle=twiddle103,
+   .nbGroupedFactors=2,
    .nbFactors=3,
    .factors=factors45,
    .lengths=lengths45,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config100={
-   .normalization=0.01234567901234567833f16,
+   },
+   /* Length 216 */
+   {
+   .normalization=0.00462962962962962937f16,
    .nbPerms=NB_PERM46,
    .perms=perm46,
-   .nbTwiddle=NB_TWIDDLE100,
-   .twiddle=twiddle100,
-   .nbGroupedFactors=1,
+   .nbTwiddle=NB_TWIDDLE104,
+   .twiddle=twiddle104,
+   .nbGroupedFactors=2,
    .nbFactors=4,
    .factors=factors46,
    .lengths=lengths46,
    .format=0,
-   .reversalVectorizable=1
-   };
-cfftconfig<float16_t> config101={
-   .normalization=0.00462962962962962937f16,
-   .nbPerms=NB_PERM47,
+   .reversalVectorizable=0
+   },
+   /* Length 240 */
+   {
+   .normalization=0.00416666666666666661f16,
+   .nbPerms=NB_PERM47,
    .perms=perm47,
-   .nbTwiddle=NB_TWIDDLE101,
-   .twiddle=twiddle101,
-   .nbGroupedFactors=2,
+   .nbTwiddle=NB_TWIDDLE105,
+   .twiddle=twiddle105,
+   .nbGroupedFactors=4,
    .nbFactors=4,
    .factors=factors47,
    .lengths=lengths47,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config102={
-   .normalization=0.01111111111111111154f16,
+   },
+   /* Length 256 */
+   {
+   .normalization=0.00390625000000000000f16,
    .nbPerms=NB_PERM48,
    .perms=perm48,
-   .nbTwiddle=NB_TWIDDLE102,
-   .twiddle=twiddle102,
-   .nbGroupedFactors=3,
-   .nbFactors=4,
+   .nbTwiddle=NB_TWIDDLE106,
+   .twiddle=twiddle106,
+   .nbGroupedFactors=2,
+   .nbFactors=3,
    .factors=factors48,
    .lengths=lengths48,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config103={
-   .normalization=0.01041666666666666609f16,
+   },
+   /* Length 288 */
+   {
+   .normalization=0.00347222222222222203f16,
    .nbPerms=NB_PERM49,
    .perms=perm49,
-   .nbTwiddle=NB_TWIDDLE103,
-   .twiddle=twiddle103,
+   .nbTwiddle=NB_TWIDDLE107,
+   .twiddle=twiddle107,
    .nbGroupedFactors=3,
-   .nbFactors=3,
+   .nbFactors=4,
    .factors=factors49,
    .lengths=lengths49,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config104={
-   .normalization=0.01000000000000000021f16,
+   },
+   /* Length 320 */
+   {
+   .normalization=0.00312500000000000017f16,
    .nbPerms=NB_PERM50,
    .perms=perm50,
-   .nbTwiddle=NB_TWIDDLE104,
-   .twiddle=twiddle104,
+   .nbTwiddle=NB_TWIDDLE108,
+   .twiddle=twiddle108,
    .nbGroupedFactors=2,
    .nbFactors=3,
    .factors=factors50,
    .lengths=lengths50,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config105={
-   .normalization=0.00925925925925925875f16,
+   },
+   /* Length 384 */
+   {
+   .normalization=0.00260416666666666652f16,
    .nbPerms=NB_PERM51,
    .perms=perm51,
-   .nbTwiddle=NB_TWIDDLE105,
-   .twiddle=twiddle105,
-   .nbGroupedFactors=2,
+   .nbTwiddle=NB_TWIDDLE109,
+   .twiddle=twiddle109,
+   .nbGroupedFactors=3,
    .nbFactors=4,
    .factors=factors51,
    .lengths=lengths51,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config106={
-   .normalization=0.00416666666666666661f16,
+   },
+   /* Length 400 */
+   {
+   .normalization=0.00250000000000000005f16,
    .nbPerms=NB_PERM52,
    .perms=perm52,
-   .nbTwiddle=NB_TWIDDLE106,
-   .twiddle=twiddle106,
-   .nbGroupedFactors=4,
+   .nbTwiddle=NB_TWIDDLE110,
+   .twiddle=twiddle110,
+   .nbGroupedFactors=3,
    .nbFactors=4,
    .factors=factors52,
    .lengths=lengths52,
    .format=0,
    .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config107={
-   .normalization=0.00833333333333333322f16,
+   },
+   /* Length 512 */
+   {
+   .normalization=0.00195312500000000000f16,
    .nbPerms=NB_PERM53,
    .perms=perm53,
-   .nbTwiddle=NB_TWIDDLE107,
-   .twiddle=twiddle107,
-   .nbGroupedFactors=3,
+   .nbTwiddle=NB_TWIDDLE111,
+   .twiddle=twiddle111,
+   .nbGroupedFactors=1,
    .nbFactors=3,
    .factors=factors53,
    .lengths=lengths53,
    .format=0,
-   .reversalVectorizable=0
-   };
-cfftconfig<float16_t> config108={
-   .normalization=0.00800000000000000017f16,
+   .reversalVectorizable=1
+   },
+   /* Length 1024 */
+   {
+   .normalization=0.00097656250000000000f16,
    .nbPerms=NB_PERM54,
    .perms=perm54,
-   .nbTwiddle=NB_TWIDDLE108,
-   .twiddle=twiddle108,
+   .nbTwiddle=NB_TWIDDLE112,
+   .twiddle=twiddle112,
    .nbGroupedFactors=1,
-   .nbFactors=3,
+   .nbFactors=5,
    .factors=factors54,
    .lengths=lengths54,
    .format=0,
    .reversalVectorizable=1
-   };
+   },
+   /* Length 2048 */
+   {
+   .normalization=0.00048828125000000000f16,
+   .nbPerms=NB_PERM55,
+   .perms=perm55,
+   .nbTwiddle=NB_TWIDDLE113,
+   .twiddle=twiddle113,
+   .nbGroupedFactors=2,
+   .nbFactors=6,
+   .factors=factors55,
+   .lengths=lengths55,
+   .format=0,
+   .reversalVectorizable=0
+   },
+   /* Length 4096 */
+   {
+   .normalization=0.00024414062500000000f16,
+   .nbPerms=NB_PERM56,
+   .perms=perm56,
+   .nbTwiddle=NB_TWIDDLE114,
+   .twiddle=twiddle114,
+   .nbGroupedFactors=1,
+   .nbFactors=6,
+   .factors=factors56,
+   .lengths=lengths56,
+   .format=0,
+   .reversalVectorizable=1
+   },
+};
+
+const uint16_t cfftLengthsF16[54]={2,3,4,5,6,8,9,10,12,15,16,18,20,24,25,27,30,32,36,40,45,48,50,54,60,64,72,75,80,81,90,96,100,108,120,125,128,144,150,160,180,192,200,216,240,256,288,320,384,400,512,1024,2048,4096};
+
 
 template<>
 const cfftconfig<float16_t> *cfft_config<float16_t>(uint32_t nbSamples)
 {
-    switch(nbSamples)
-    {
-        case 2:
-            return(&config57);
-        break;
-        case 3:
-            return(&config58);
-        break;
-        case 4:
-            return(&config59);
-        break;
-        case 5:
-            return(&config60);
-        break;
-        case 6:
-            return(&config61);
-        break;
-        case 8:
-            return(&config63);
-        break;
-        case 9:
-            return(&config64);
-        break;
-        case 10:
-            return(&config65);
-        break;
-        case 12:
-            return(&config67);
-        break;
-        case 15:
-            return(&config69);
-        break;
-        case 16:
-            return(&config70);
-        break;
-        case 18:
-            return(&config72);
-        break;
-        case 20:
-            return(&config74);
-        break;
-        case 24:
-            return(&config76);
-        break;
-        case 25:
-            return(&config77);
-        break;
-        case 27:
-            return(&config78);
-        break;
-        case 30:
-            return(&config79);
-        break;
-        case 32:
-            return(&config80);
-        break;
-        case 36:
-            return(&config84);
-        break;
-        case 40:
-            return(&config85);
-        break;
-        case 45:
-            return(&config86);
-        break;
-        case 48:
-            return(&config87);
-        break;
-        case 50:
-            return(&config88);
-        break;
-        case 54:
-            return(&config90);
-        break;
-        case 60:
-            return(&config91);
-        break;
-        case 64:
-            return(&config92);
-        break;
-        case 72:
-            return(&config96);
-        break;
-        case 75:
-            return(&config98);
-        break;
-        case 80:
-            return(&config99);
-        break;
-        case 81:
-            return(&config100);
-        break;
-        case 90:
-            return(&config102);
-        break;
-        case 96:
-            return(&config103);
-        break;
-        case 100:
-            return(&config104);
-        break;
-        case 108:
-            return(&config105);
-        break;
-        case 120:
-            return(&config107);
-        break;
-        case 125:
-            return(&config108);
-        break;
-        case 128:
-            return(&config66);
-        break;
-        case 144:
-            return(&config71);
-        break;
-        case 150:
-            return(&config75);
-        break;
-        case 160:
-            return(&config83);
-        break;
-        case 180:
-            return(&config89);
-        break;
-        case 192:
-            return(&config95);
-        break;
-        case 200:
-            return(&config97);
-        break;
-        case 216:
-            return(&config101);
-        break;
-        case 240:
-            return(&config106);
-        break;
-        case 256:
-            return(&config55);
-        break;
-        case 288:
-            return(&config81);
-        break;
-        case 320:
-            return(&config93);
-        break;
-        case 384:
-            return(&config68);
-        break;
-        case 400:
-            return(&config73);
-        break;
-        case 512:
-            return(&config62);
-        break;
-        case 1024:
-            return(&config82);
-        break;
-        case 2048:
-            return(&config94);
-        break;
-        case 4096:
-            return(&config56);
-        break;
-
-    }
-    return(NULL);
+    return(fft_config_search(cfftLengthsF16,cfftConfigsF16,54,nbSamples));
 }
 
 #endif
 
-cfftconfig<Q31> config109={
-   .normalization=Q31(0x00800000),
-   .nbPerms=NB_PERM55,
-   .perms=perm55,
-   .nbTwiddle=NB_TWIDDLE109,
-   .twiddle=twiddle109,
+const cfftconfig<Q31> cfftConfigsQ31[54]={
+   /* Length 2 */
+   {
+   .normalization=Q31(0x40000000),
+   .nbPerms=NB_PERM1,
+   .perms=perm1,
+   .nbTwiddle=NB_TWIDDLE115,
+   .twiddle=twiddle115,
    .nbGroupedFactors=1,
-   .nbFactors=4,
-   .factors=factors55,
-   .lengths=lengths55,
-   .format=8,
+   .nbFactors=1,
+   .factors=factors1,
+   .lengths=lengths1,
+   .format=1,
    .reversalVectorizable=1
-   };
-cfftconfig<Q31> config110={
-   .normalization=Q31(0x00080000),
+   },
+   /* Length 3 */
+   {
+   .normalization=Q31(0x2AAAAAAB),
    .nbPerms=NB_PERM2,
    .perms=perm2,
-   .nbTwiddle=NB_TWIDDLE110,
-   .twiddle=twiddle110,
+   .nbTwiddle=NB_TWIDDLE116,
+   .twiddle=twiddle116,
    .nbGroupedFactors=1,
-   .nbFactors=6,
+   .nbFactors=1,
    .factors=factors2,
    .lengths=lengths2,
-   .format=12,
+   .format=2,
    .reversalVectorizable=1
-   };
-cfftconfig<Q31> config111={
-   .normalization=Q31(0x40000000),
+   },
+   /* Length 4 */
+   {
+   .normalization=Q31(0x20000000),
    .nbPerms=NB_PERM3,
    .perms=perm3,
-   .nbTwiddle=NB_TWIDDLE111,
-   .twiddle=twiddle111,
+   .nbTwiddle=NB_TWIDDLE117,
+   .twiddle=twiddle117,
    .nbGroupedFactors=1,
    .nbFactors=1,
    .factors=factors3,
    .lengths=lengths3,
-   .format=1,
-   .reversalVectorizable=1
-   };
-cfftconfig<Q31> config112={
-   .normalization=Q31(0x2AAAAAAB),
-   .nbPerms=NB_PERM4,
-   .perms=perm4,
-   .nbTwiddle=NB_TWIDDLE112,
-   .twiddle=twiddle112,
-   .nbGroupedFactors=1,
-   .nbFactors=1,
-   .factors=factors4,
-   .lengths=lengths4,
-   .format=2,
-   .reversalVectorizable=1
-   };
-cfftconfig<Q31> config113={
-   .normalization=Q31(0x20000000),
-   .nbPerms=NB_PERM5,
-   .perms=perm5,
-   .nbTwiddle=NB_TWIDDLE113,
-   .twiddle=twiddle113,
-   .nbGroupedFactors=1,
-   .nbFactors=1,
-   .factors=factors5,
-   .lengths=lengths5,
    .format=2,
    .reversalVectorizable=1
-   };
-cfftconfig<Q31> config114={
+   },
+   /* Length 5 */
+   {
    .normalization=Q31(0x1999999A),
-   .nbPerms=NB_PERM6,
-   .perms=perm6,
-   .nbTwiddle=NB_TWIDDLE114,
-   .twiddle=twiddle114,
+   .nbPerms=NB_PERM7,
+   .perms=perm7,
+   .nbTwiddle=NB_TWIDDLE118,
+   .twiddle=twiddle118,
    .nbGroupedFactors=1,
    .nbFactors=1,
-   .factors=factors6,
-   .lengths=lengths6,
+   .factors=factors7,
+   .lengths=lengths7,
    .format=4,
    .reversalVectorizable=1
-   };
-cfftconfig<Q31> config115={
+   },
+   /* Length 6 */
+   {
    .normalization=Q31(0x15555555),
-   .nbPerms=NB_PERM7,
-   .perms=perm7,
-   .nbTwiddle=NB_TWIDDLE115,
-   .twiddle=twiddle115,
+   .nbPerms=NB_PERM4,
+   .perms=perm4,
+   .nbTwiddle=NB_TWIDDLE119,
+   .twiddle=twiddle119,
    .nbGroupedFactors=2,
    .nbFactors=2,
-   .factors=factors7,
-   .lengths=lengths7,
+   .factors=factors4,
+   .lengths=lengths4,
    .format=3,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config116={
-   .normalization=Q31(0x00400000),
-   .nbPerms=NB_PERM56,
-   .perms=perm56,
-   .nbTwiddle=NB_TWIDDLE116,
-   .twiddle=twiddle116,
-   .nbGroupedFactors=2,
-   .nbFactors=5,
-   .factors=factors56,
-   .lengths=lengths56,
-   .format=9,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q31> config117={
+   },
+   /* Length 8 */
+   {
    .normalization=Q31(0x10000000),
-   .nbPerms=NB_PERM57,
-   .perms=perm57,
-   .nbTwiddle=NB_TWIDDLE117,
-   .twiddle=twiddle117,
+   .nbPerms=NB_PERM5,
+   .perms=perm5,
+   .nbTwiddle=NB_TWIDDLE120,
+   .twiddle=twiddle120,
    .nbGroupedFactors=2,
    .nbFactors=2,
-   .factors=factors57,
-   .lengths=lengths57,
+   .factors=factors5,
+   .lengths=lengths5,
    .format=3,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config118={
+   },
+   /* Length 9 */
+   {
    .normalization=Q31(0x0E38E38E),
-   .nbPerms=NB_PERM10,
-   .perms=perm10,
-   .nbTwiddle=NB_TWIDDLE118,
-   .twiddle=twiddle118,
+   .nbPerms=NB_PERM9,
+   .perms=perm9,
+   .nbTwiddle=NB_TWIDDLE121,
+   .twiddle=twiddle121,
    .nbGroupedFactors=1,
    .nbFactors=2,
-   .factors=factors10,
-   .lengths=lengths10,
+   .factors=factors9,
+   .lengths=lengths9,
    .format=4,
    .reversalVectorizable=1
-   };
-cfftconfig<Q31> config119={
+   },
+   /* Length 10 */
+   {
    .normalization=Q31(0x0CCCCCCD),
+   .nbPerms=NB_PERM10,
+   .perms=perm10,
+   .nbTwiddle=NB_TWIDDLE122,
+   .twiddle=twiddle122,
+   .nbGroupedFactors=2,
+   .nbFactors=2,
+   .factors=factors10,
+   .lengths=lengths10,
+   .format=5,
+   .reversalVectorizable=0
+   },
+   /* Length 12 */
+   {
+   .normalization=Q31(0x0AAAAAAB),
    .nbPerms=NB_PERM11,
    .perms=perm11,
-   .nbTwiddle=NB_TWIDDLE119,
-   .twiddle=twiddle119,
+   .nbTwiddle=NB_TWIDDLE123,
+   .twiddle=twiddle123,
    .nbGroupedFactors=2,
    .nbFactors=2,
    .factors=factors11,
    .lengths=lengths11,
-   .format=5,
+   .format=4,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config120={
-   .normalization=Q31(0x01000000),
-   .nbPerms=NB_PERM58,
-   .perms=perm58,
-   .nbTwiddle=NB_TWIDDLE120,
-   .twiddle=twiddle120,
-   .nbGroupedFactors=2,
-   .nbFactors=4,
-   .factors=factors58,
-   .lengths=lengths58,
-   .format=7,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q31> config121={
-   .normalization=Q31(0x0AAAAAAB),
-   .nbPerms=NB_PERM13,
-   .perms=perm13,
-   .nbTwiddle=NB_TWIDDLE121,
-   .twiddle=twiddle121,
-   .nbGroupedFactors=2,
-   .nbFactors=2,
-   .factors=factors13,
-   .lengths=lengths13,
-   .format=4,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q31> config122={
-   .normalization=Q31(0x00555555),
-   .nbPerms=NB_PERM59,
-   .perms=perm59,
-   .nbTwiddle=NB_TWIDDLE122,
-   .twiddle=twiddle122,
-   .nbGroupedFactors=3,
-   .nbFactors=5,
-   .factors=factors59,
-   .lengths=lengths59,
-   .format=9,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q31> config123={
-   .normalization=Q31(0x08888889),
-   .nbPerms=NB_PERM15,
-   .perms=perm15,
-   .nbTwiddle=NB_TWIDDLE123,
-   .twiddle=twiddle123,
+   },
+   /* Length 15 */
+   {
+   .normalization=Q31(0x08888889),
+   .nbPerms=NB_PERM12,
+   .perms=perm12,
+   .nbTwiddle=NB_TWIDDLE124,
+   .twiddle=twiddle124,
    .nbGroupedFactors=2,
    .nbFactors=2,
-   .factors=factors15,
-   .lengths=lengths15,
+   .factors=factors12,
+   .lengths=lengths12,
    .format=6,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config124={
+   },
+   /* Length 16 */
+   {
    .normalization=Q31(0x08000000),
-   .nbPerms=NB_PERM60,
-   .perms=perm60,
-   .nbTwiddle=NB_TWIDDLE124,
-   .twiddle=twiddle124,
+   .nbPerms=NB_PERM6,
+   .perms=perm6,
+   .nbTwiddle=NB_TWIDDLE125,
+   .twiddle=twiddle125,
    .nbGroupedFactors=1,
    .nbFactors=2,
-   .factors=factors60,
-   .lengths=lengths60,
+   .factors=factors6,
+   .lengths=lengths6,
    .format=4,
    .reversalVectorizable=1
-   };
-cfftconfig<Q31> config125={
-   .normalization=Q31(0x00E38E39),
-   .nbPerms=NB_PERM61,
-   .perms=perm61,
-   .nbTwiddle=NB_TWIDDLE125,
-   .twiddle=twiddle125,
-   .nbGroupedFactors=2,
-   .nbFactors=4,
-   .factors=factors61,
-   .lengths=lengths61,
-   .format=8,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q31> config126={
+   },
+   /* Length 18 */
+   {
    .normalization=Q31(0x071C71C7),
-   .nbPerms=NB_PERM18,
-   .perms=perm18,
+   .nbPerms=NB_PERM14,
+   .perms=perm14,
    .nbTwiddle=NB_TWIDDLE126,
    .twiddle=twiddle126,
    .nbGroupedFactors=2,
    .nbFactors=3,
-   .factors=factors18,
-   .lengths=lengths18,
+   .factors=factors14,
+   .lengths=lengths14,
    .format=5,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config127={
-   .normalization=Q31(0x0051EB85),
-   .nbPerms=NB_PERM62,
-   .perms=perm62,
+   },
+   /* Length 20 */
+   {
+   .normalization=Q31(0x06666666),
+   .nbPerms=NB_PERM15,
+   .perms=perm15,
    .nbTwiddle=NB_TWIDDLE127,
    .twiddle=twiddle127,
    .nbGroupedFactors=2,
-   .nbFactors=4,
-   .factors=factors62,
-   .lengths=lengths62,
-   .format=12,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q31> config128={
-   .normalization=Q31(0x06666666),
-   .nbPerms=NB_PERM20,
-   .perms=perm20,
-   .nbTwiddle=NB_TWIDDLE128,
-   .twiddle=twiddle128,
-   .nbGroupedFactors=2,
    .nbFactors=2,
-   .factors=factors20,
-   .lengths=lengths20,
+   .factors=factors15,
+   .lengths=lengths15,
    .format=6,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config129={
-   .normalization=Q31(0x00DA740E),
-   .nbPerms=NB_PERM21,
-   .perms=perm21,
-   .nbTwiddle=NB_TWIDDLE129,
-   .twiddle=twiddle129,
-   .nbGroupedFactors=3,
-   .nbFactors=4,
-   .factors=factors21,
-   .lengths=lengths21,
-   .format=11,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q31> config130={
+   },
+   /* Length 24 */
+   {
    .normalization=Q31(0x05555555),
-   .nbPerms=NB_PERM63,
-   .perms=perm63,
-   .nbTwiddle=NB_TWIDDLE130,
-   .twiddle=twiddle130,
+   .nbPerms=NB_PERM57,
+   .perms=perm57,
+   .nbTwiddle=NB_TWIDDLE128,
+   .twiddle=twiddle128,
    .nbGroupedFactors=3,
    .nbFactors=3,
-   .factors=factors63,
-   .lengths=lengths63,
+   .factors=factors57,
+   .lengths=lengths57,
    .format=5,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config131={
+   },
+   /* Length 25 */
+   {
    .normalization=Q31(0x051EB852),
-   .nbPerms=NB_PERM23,
-   .perms=perm23,
-   .nbTwiddle=NB_TWIDDLE131,
-   .twiddle=twiddle131,
+   .nbPerms=NB_PERM17,
+   .perms=perm17,
+   .nbTwiddle=NB_TWIDDLE129,
+   .twiddle=twiddle129,
    .nbGroupedFactors=1,
    .nbFactors=2,
-   .factors=factors23,
-   .lengths=lengths23,
+   .factors=factors17,
+   .lengths=lengths17,
    .format=8,
    .reversalVectorizable=1
-   };
-cfftconfig<Q31> config132={
+   },
+   /* Length 27 */
+   {
    .normalization=Q31(0x04BDA12F),
-   .nbPerms=NB_PERM24,
-   .perms=perm24,
-   .nbTwiddle=NB_TWIDDLE132,
-   .twiddle=twiddle132,
+   .nbPerms=NB_PERM18,
+   .perms=perm18,
+   .nbTwiddle=NB_TWIDDLE130,
+   .twiddle=twiddle130,
    .nbGroupedFactors=1,
    .nbFactors=3,
-   .factors=factors24,
-   .lengths=lengths24,
+   .factors=factors18,
+   .lengths=lengths18,
    .format=6,
    .reversalVectorizable=1
-   };
-cfftconfig<Q31> config133={
+   },
+   /* Length 30 */
+   {
    .normalization=Q31(0x04444444),
-   .nbPerms=NB_PERM25,
-   .perms=perm25,
-   .nbTwiddle=NB_TWIDDLE133,
-   .twiddle=twiddle133,
+   .nbPerms=NB_PERM19,
+   .perms=perm19,
+   .nbTwiddle=NB_TWIDDLE131,
+   .twiddle=twiddle131,
    .nbGroupedFactors=3,
    .nbFactors=3,
-   .factors=factors25,
-   .lengths=lengths25,
+   .factors=factors19,
+   .lengths=lengths19,
    .format=7,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config134={
+   },
+   /* Length 32 */
+   {
    .normalization=Q31(0x04000000),
-   .nbPerms=NB_PERM64,
-   .perms=perm64,
-   .nbTwiddle=NB_TWIDDLE134,
-   .twiddle=twiddle134,
+   .nbPerms=NB_PERM58,
+   .perms=perm58,
+   .nbTwiddle=NB_TWIDDLE132,
+   .twiddle=twiddle132,
    .nbGroupedFactors=2,
    .nbFactors=3,
-   .factors=factors64,
-   .lengths=lengths64,
+   .factors=factors58,
+   .lengths=lengths58,
    .format=5,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config135={
-   .normalization=Q31(0x0071C71C),
-   .nbPerms=NB_PERM65,
-   .perms=perm65,
-   .nbTwiddle=NB_TWIDDLE135,
-   .twiddle=twiddle135,
-   .nbGroupedFactors=3,
-   .nbFactors=5,
-   .factors=factors65,
-   .lengths=lengths65,
-   .format=9,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q31> config136={
-   .normalization=Q31(0x00200000),
-   .nbPerms=NB_PERM28,
-   .perms=perm28,
-   .nbTwiddle=NB_TWIDDLE136,
-   .twiddle=twiddle136,
-   .nbGroupedFactors=1,
-   .nbFactors=5,
-   .factors=factors28,
-   .lengths=lengths28,
-   .format=10,
-   .reversalVectorizable=1
-   };
-cfftconfig<Q31> config137={
-   .normalization=Q31(0x00CCCCCD),
-   .nbPerms=NB_PERM66,
-   .perms=perm66,
-   .nbTwiddle=NB_TWIDDLE137,
-   .twiddle=twiddle137,
-   .nbGroupedFactors=3,
-   .nbFactors=4,
-   .factors=factors66,
-   .lengths=lengths66,
-   .format=9,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q31> config138={
+   },
+   /* Length 36 */
+   {
    .normalization=Q31(0x038E38E4),
-   .nbPerms=NB_PERM30,
-   .perms=perm30,
-   .nbTwiddle=NB_TWIDDLE138,
-   .twiddle=twiddle138,
+   .nbPerms=NB_PERM21,
+   .perms=perm21,
+   .nbTwiddle=NB_TWIDDLE133,
+   .twiddle=twiddle133,
    .nbGroupedFactors=2,
    .nbFactors=3,
-   .factors=factors30,
-   .lengths=lengths30,
+   .factors=factors21,
+   .lengths=lengths21,
    .format=6,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config139={
+   },
+   /* Length 40 */
+   {
    .normalization=Q31(0x03333333),
-   .nbPerms=NB_PERM67,
-   .perms=perm67,
-   .nbTwiddle=NB_TWIDDLE139,
-   .twiddle=twiddle139,
+   .nbPerms=NB_PERM59,
+   .perms=perm59,
+   .nbTwiddle=NB_TWIDDLE134,
+   .twiddle=twiddle134,
    .nbGroupedFactors=3,
    .nbFactors=3,
-   .factors=factors67,
-   .lengths=lengths67,
+   .factors=factors59,
+   .lengths=lengths59,
    .format=7,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config140={
+   },
+   /* Length 45 */
+   {
    .normalization=Q31(0x02D82D83),
-   .nbPerms=NB_PERM32,
-   .perms=perm32,
-   .nbTwiddle=NB_TWIDDLE140,
-   .twiddle=twiddle140,
+   .nbPerms=NB_PERM23,
+   .perms=perm23,
+   .nbTwiddle=NB_TWIDDLE135,
+   .twiddle=twiddle135,
    .nbGroupedFactors=2,
    .nbFactors=3,
-   .factors=factors32,
-   .lengths=lengths32,
+   .factors=factors23,
+   .lengths=lengths23,
    .format=8,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config141={
+   },
+   /* Length 48 */
+   {
    .normalization=Q31(0x02AAAAAB),
-   .nbPerms=NB_PERM68,
-   .perms=perm68,
-   .nbTwiddle=NB_TWIDDLE141,
-   .twiddle=twiddle141,
-   .nbGroupedFactors=2,
-   .nbFactors=3,
-   .factors=factors68,
-   .lengths=lengths68,
+   .nbPerms=NB_PERM60,
+   .perms=perm60,
+   .nbTwiddle=NB_TWIDDLE136,
+   .twiddle=twiddle136,
+   .nbGroupedFactors=2,
+   .nbFactors=3,
+   .factors=factors60,
+   .lengths=lengths60,
    .format=6,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config142={
+   },
+   /* Length 50 */
+   {
    .normalization=Q31(0x028F5C29),
-   .nbPerms=NB_PERM34,
-   .perms=perm34,
-   .nbTwiddle=NB_TWIDDLE142,
-   .twiddle=twiddle142,
+   .nbPerms=NB_PERM25,
+   .perms=perm25,
+   .nbTwiddle=NB_TWIDDLE137,
+   .twiddle=twiddle137,
    .nbGroupedFactors=2,
    .nbFactors=3,
-   .factors=factors34,
-   .lengths=lengths34,
+   .factors=factors25,
+   .lengths=lengths25,
    .format=9,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config143={
-   .normalization=Q31(0x00B60B61),
-   .nbPerms=NB_PERM35,
-   .perms=perm35,
-   .nbTwiddle=NB_TWIDDLE143,
-   .twiddle=twiddle143,
-   .nbGroupedFactors=3,
-   .nbFactors=4,
-   .factors=factors35,
-   .lengths=lengths35,
-   .format=10,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q31> config144={
+   },
+   /* Length 54 */
+   {
    .normalization=Q31(0x025ED098),
-   .nbPerms=NB_PERM36,
-   .perms=perm36,
-   .nbTwiddle=NB_TWIDDLE144,
-   .twiddle=twiddle144,
+   .nbPerms=NB_PERM26,
+   .perms=perm26,
+   .nbTwiddle=NB_TWIDDLE138,
+   .twiddle=twiddle138,
    .nbGroupedFactors=2,
    .nbFactors=4,
-   .factors=factors36,
-   .lengths=lengths36,
+   .factors=factors26,
+   .lengths=lengths26,
    .format=7,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config145={
+   },
+   /* Length 60 */
+   {
    .normalization=Q31(0x02222222),
-   .nbPerms=NB_PERM37,
-   .perms=perm37,
-   .nbTwiddle=NB_TWIDDLE145,
-   .twiddle=twiddle145,
+   .nbPerms=NB_PERM27,
+   .perms=perm27,
+   .nbTwiddle=NB_TWIDDLE139,
+   .twiddle=twiddle139,
    .nbGroupedFactors=3,
    .nbFactors=3,
-   .factors=factors37,
-   .lengths=lengths37,
+   .factors=factors27,
+   .lengths=lengths27,
    .format=8,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config146={
+   },
+   /* Length 64 */
+   {
    .normalization=Q31(0x02000000),
-   .nbPerms=NB_PERM69,
-   .perms=perm69,
-   .nbTwiddle=NB_TWIDDLE146,
-   .twiddle=twiddle146,
+   .nbPerms=NB_PERM61,
+   .perms=perm61,
+   .nbTwiddle=NB_TWIDDLE140,
+   .twiddle=twiddle140,
    .nbGroupedFactors=1,
    .nbFactors=3,
-   .factors=factors69,
-   .lengths=lengths69,
+   .factors=factors61,
+   .lengths=lengths61,
    .format=6,
    .reversalVectorizable=1
-   };
-cfftconfig<Q31> config147={
-   .normalization=Q31(0x00666666),
-   .nbPerms=NB_PERM70,
-   .perms=perm70,
-   .nbTwiddle=NB_TWIDDLE147,
-   .twiddle=twiddle147,
-   .nbGroupedFactors=2,
-   .nbFactors=4,
-   .factors=factors70,
-   .lengths=lengths70,
-   .format=10,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q31> config148={
-   .normalization=Q31(0x00100000),
-   .nbPerms=NB_PERM40,
-   .perms=perm40,
-   .nbTwiddle=NB_TWIDDLE148,
-   .twiddle=twiddle148,
-   .nbGroupedFactors=2,
-   .nbFactors=6,
-   .factors=factors40,
-   .lengths=lengths40,
-   .format=11,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q31> config149={
-   .normalization=Q31(0x00AAAAAB),
-   .nbPerms=NB_PERM71,
-   .perms=perm71,
-   .nbTwiddle=NB_TWIDDLE149,
-   .twiddle=twiddle149,
-   .nbGroupedFactors=2,
-   .nbFactors=4,
-   .factors=factors71,
-   .lengths=lengths71,
-   .format=8,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q31> config150={
+   },
+   /* Length 72 */
+   {
    .normalization=Q31(0x01C71C72),
-   .nbPerms=NB_PERM72,
-   .perms=perm72,
-   .nbTwiddle=NB_TWIDDLE150,
-   .twiddle=twiddle150,
+   .nbPerms=NB_PERM62,
+   .perms=perm62,
+   .nbTwiddle=NB_TWIDDLE141,
+   .twiddle=twiddle141,
    .nbGroupedFactors=3,
    .nbFactors=4,
-   .factors=factors72,
-   .lengths=lengths72,
+   .factors=factors62,
+   .lengths=lengths62,
    .format=7,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config151={
-   .normalization=Q31(0x00A3D70A),
-   .nbPerms=NB_PERM73,
-   .perms=perm73,
-   .nbTwiddle=NB_TWIDDLE151,
-   .twiddle=twiddle151,
-   .nbGroupedFactors=3,
-   .nbFactors=4,
-   .factors=factors73,
-   .lengths=lengths73,
-   .format=11,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q31> config152={
+   },
+   /* Length 75 */
+   {
    .normalization=Q31(0x01B4E81B),
-   .nbPerms=NB_PERM44,
-   .perms=perm44,
-   .nbTwiddle=NB_TWIDDLE152,
-   .twiddle=twiddle152,
+   .nbPerms=NB_PERM30,
+   .perms=perm30,
+   .nbTwiddle=NB_TWIDDLE142,
+   .twiddle=twiddle142,
    .nbGroupedFactors=2,
    .nbFactors=3,
-   .factors=factors44,
-   .lengths=lengths44,
+   .factors=factors30,
+   .lengths=lengths30,
    .format=10,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config153={
+   },
+   /* Length 80 */
+   {
    .normalization=Q31(0x0199999A),
-   .nbPerms=NB_PERM74,
-   .perms=perm74,
-   .nbTwiddle=NB_TWIDDLE153,
-   .twiddle=twiddle153,
+   .nbPerms=NB_PERM63,
+   .perms=perm63,
+   .nbTwiddle=NB_TWIDDLE143,
+   .twiddle=twiddle143,
    .nbGroupedFactors=2,
    .nbFactors=3,
-   .factors=factors74,
-   .lengths=lengths74,
+   .factors=factors63,
+   .lengths=lengths63,
    .format=8,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config154={
+   },
+   /* Length 81 */
+   {
    .normalization=Q31(0x01948B10),
-   .nbPerms=NB_PERM46,
-   .perms=perm46,
-   .nbTwiddle=NB_TWIDDLE154,
-   .twiddle=twiddle154,
+   .nbPerms=NB_PERM32,
+   .perms=perm32,
+   .nbTwiddle=NB_TWIDDLE144,
+   .twiddle=twiddle144,
    .nbGroupedFactors=1,
    .nbFactors=4,
-   .factors=factors46,
-   .lengths=lengths46,
+   .factors=factors32,
+   .lengths=lengths32,
    .format=8,
    .reversalVectorizable=1
-   };
-cfftconfig<Q31> config155={
-   .normalization=Q31(0x0097B426),
-   .nbPerms=NB_PERM75,
-   .perms=perm75,
-   .nbTwiddle=NB_TWIDDLE155,
-   .twiddle=twiddle155,
-   .nbGroupedFactors=3,
-   .nbFactors=5,
-   .factors=factors75,
-   .lengths=lengths75,
-   .format=9,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q31> config156={
+   },
+   /* Length 90 */
+   {
    .normalization=Q31(0x016C16C1),
-   .nbPerms=NB_PERM48,
-   .perms=perm48,
-   .nbTwiddle=NB_TWIDDLE156,
-   .twiddle=twiddle156,
+   .nbPerms=NB_PERM33,
+   .perms=perm33,
+   .nbTwiddle=NB_TWIDDLE145,
+   .twiddle=twiddle145,
    .nbGroupedFactors=3,
    .nbFactors=4,
-   .factors=factors48,
-   .lengths=lengths48,
+   .factors=factors33,
+   .lengths=lengths33,
    .format=9,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config157={
+   },
+   /* Length 96 */
+   {
    .normalization=Q31(0x01555555),
-   .nbPerms=NB_PERM76,
-   .perms=perm76,
-   .nbTwiddle=NB_TWIDDLE157,
-   .twiddle=twiddle157,
+   .nbPerms=NB_PERM64,
+   .perms=perm64,
+   .nbTwiddle=NB_TWIDDLE146,
+   .twiddle=twiddle146,
    .nbGroupedFactors=3,
    .nbFactors=4,
-   .factors=factors76,
-   .lengths=lengths76,
+   .factors=factors64,
+   .lengths=lengths64,
    .format=7,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config158={
+   },
+   /* Length 100 */
+   {
    .normalization=Q31(0x0147AE14),
-   .nbPerms=NB_PERM50,
-   .perms=perm50,
-   .nbTwiddle=NB_TWIDDLE158,
-   .twiddle=twiddle158,
+   .nbPerms=NB_PERM35,
+   .perms=perm35,
+   .nbTwiddle=NB_TWIDDLE147,
+   .twiddle=twiddle147,
    .nbGroupedFactors=2,
    .nbFactors=3,
-   .factors=factors50,
-   .lengths=lengths50,
+   .factors=factors35,
+   .lengths=lengths35,
    .format=10,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config159={
+   },
+   /* Length 108 */
+   {
    .normalization=Q31(0x012F684C),
-   .nbPerms=NB_PERM51,
-   .perms=perm51,
-   .nbTwiddle=NB_TWIDDLE159,
-   .twiddle=twiddle159,
+   .nbPerms=NB_PERM36,
+   .perms=perm36,
+   .nbTwiddle=NB_TWIDDLE148,
+   .twiddle=twiddle148,
    .nbGroupedFactors=2,
    .nbFactors=4,
-   .factors=factors51,
-   .lengths=lengths51,
+   .factors=factors36,
+   .lengths=lengths36,
    .format=8,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config160={
-   .normalization=Q31(0x00888889),
-   .nbPerms=NB_PERM77,
-   .perms=perm77,
-   .nbTwiddle=NB_TWIDDLE160,
-   .twiddle=twiddle160,
-   .nbGroupedFactors=3,
-   .nbFactors=4,
-   .factors=factors77,
-   .lengths=lengths77,
-   .format=10,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q31> config161={
+   },
+   /* Length 120 */
+   {
    .normalization=Q31(0x01111111),
-   .nbPerms=NB_PERM78,
-   .perms=perm78,
-   .nbTwiddle=NB_TWIDDLE161,
-   .twiddle=twiddle161,
-   .nbGroupedFactors=4,
+   .nbPerms=NB_PERM65,
+   .perms=perm65,
+   .nbTwiddle=NB_TWIDDLE149,
+   .twiddle=twiddle149,
+   .nbGroupedFactors=4,
+   .nbFactors=4,
+   .factors=factors65,
+   .lengths=lengths65,
+   .format=9,
+   .reversalVectorizable=0
+   },
+   /* Length 125 */
+   {
+   .normalization=Q31(0x010624DD),
+   .nbPerms=NB_PERM38,
+   .perms=perm38,
+   .nbTwiddle=NB_TWIDDLE150,
+   .twiddle=twiddle150,
+   .nbGroupedFactors=1,
+   .nbFactors=3,
+   .factors=factors38,
+   .lengths=lengths38,
+   .format=12,
+   .reversalVectorizable=1
+   },
+   /* Length 128 */
+   {
+   .normalization=Q31(0x01000000),
+   .nbPerms=NB_PERM66,
+   .perms=perm66,
+   .nbTwiddle=NB_TWIDDLE151,
+   .twiddle=twiddle151,
+   .nbGroupedFactors=2,
+   .nbFactors=4,
+   .factors=factors66,
+   .lengths=lengths66,
+   .format=7,
+   .reversalVectorizable=0
+   },
+   /* Length 144 */
+   {
+   .normalization=Q31(0x00E38E39),
+   .nbPerms=NB_PERM67,
+   .perms=perm67,
+   .nbTwiddle=NB_TWIDDLE152,
+   .twiddle=twiddle152,
+   .nbGroupedFactors=2,
+   .nbFactors=4,
+   .factors=factors67,
+   .lengths=lengths67,
+   .format=8,
+   .reversalVectorizable=0
+   },
+   /* Length 150 */
+   {
+   .normalization=Q31(0x00DA740E),
+   .nbPerms=NB_PERM41,
+   .perms=perm41,
+   .nbTwiddle=NB_TWIDDLE153,
+   .twiddle=twiddle153,
+   .nbGroupedFactors=3,
+   .nbFactors=4,
+   .factors=factors41,
+   .lengths=lengths41,
+   .format=11,
+   .reversalVectorizable=0
+   },
+   /* Length 160 */
+   {
+   .normalization=Q31(0x00CCCCCD),
+   .nbPerms=NB_PERM68,
+   .perms=perm68,
+   .nbTwiddle=NB_TWIDDLE154,
+   .twiddle=twiddle154,
+   .nbGroupedFactors=3,
+   .nbFactors=4,
+   .factors=factors68,
+   .lengths=lengths68,
+   .format=9,
+   .reversalVectorizable=0
+   },
+   /* Length 180 */
+   {
+   .normalization=Q31(0x00B60B61),
+   .nbPerms=NB_PERM43,
+   .perms=perm43,
+   .nbTwiddle=NB_TWIDDLE155,
+   .twiddle=twiddle155,
+   .nbGroupedFactors=3,
+   .nbFactors=4,
+   .factors=factors43,
+   .lengths=lengths43,
+   .format=10,
+   .reversalVectorizable=0
+   },
+   /* Length 192 */
+   {
+   .normalization=Q31(0x00AAAAAB),
+   .nbPerms=NB_PERM69,
+   .perms=perm69,
+   .nbTwiddle=NB_TWIDDLE156,
+   .twiddle=twiddle156,
+   .nbGroupedFactors=2,
+   .nbFactors=4,
+   .factors=factors69,
+   .lengths=lengths69,
+   .format=8,
+   .reversalVectorizable=0
+   },
+   /* Length 200 */
+   {
+   .normalization=Q31(0x00A3D70A),
+   .nbPerms=NB_PERM70,
+   .perms=perm70,
+   .nbTwiddle=NB_TWIDDLE157,
+   .twiddle=twiddle157,
+   .nbGroupedFactors=3,
+   .nbFactors=4,
+   .factors=factors70,
+   .lengths=lengths70,
+   .format=11,
+   .reversalVectorizable=0
+   },
+   /* Length 216 */
+   {
+   .normalization=Q31(0x0097B426),
+   .nbPerms=NB_PERM71,
+   .perms=perm71,
+   .nbTwiddle=NB_TWIDDLE158,
+   .twiddle=twiddle158,
+   .nbGroupedFactors=3,
+   .nbFactors=5,
+   .factors=factors71,
+   .lengths=lengths71,
+   .format=9,
+   .reversalVectorizable=0
+   },
+   /* Length 240 */
+   {
+   .normalization=Q31(0x00888889),
+   .nbPerms=NB_PERM72,
+   .perms=perm72,
+   .nbTwiddle=NB_TWIDDLE159,
+   .twiddle=twiddle159,
+   .nbGroupedFactors=3,
+   .nbFactors=4,
+   .factors=factors72,
+   .lengths=lengths72,
+   .format=10,
+   .reversalVectorizable=0
+   },
+   /* Length 256 */
+   {
+   .normalization=Q31(0x00800000),
+   .nbPerms=NB_PERM73,
+   .perms=perm73,
+   .nbTwiddle=NB_TWIDDLE160,
+   .twiddle=twiddle160,
+   .nbGroupedFactors=1,
+   .nbFactors=4,
+   .factors=factors73,
+   .lengths=lengths73,
+   .format=8,
+   .reversalVectorizable=1
+   },
+   /* Length 288 */
+   {
+   .normalization=Q31(0x0071C71C),
+   .nbPerms=NB_PERM74,
+   .perms=perm74,
+   .nbTwiddle=NB_TWIDDLE161,
+   .twiddle=twiddle161,
+   .nbGroupedFactors=3,
+   .nbFactors=5,
+   .factors=factors74,
+   .lengths=lengths74,
+   .format=9,
+   .reversalVectorizable=0
+   },
+   /* Length 320 */
+   {
+   .normalization=Q31(0x00666666),
+   .nbPerms=NB_PERM75,
+   .perms=perm75,
+   .nbTwiddle=NB_TWIDDLE162,
+   .twiddle=twiddle162,
+   .nbGroupedFactors=2,
    .nbFactors=4,
+   .factors=factors75,
+   .lengths=lengths75,
+   .format=10,
+   .reversalVectorizable=0
+   },
+   /* Length 384 */
+   {
+   .normalization=Q31(0x00555555),
+   .nbPerms=NB_PERM76,
+   .perms=perm76,
+   .nbTwiddle=NB_TWIDDLE163,
+   .twiddle=twiddle163,
+   .nbGroupedFactors=3,
+   .nbFactors=5,
+   .factors=factors76,
+   .lengths=lengths76,
+   .format=9,
+   .reversalVectorizable=0
+   },
+   /* Length 400 */
+   {
+   .normalization=Q31(0x0051EB85),
+   .nbPerms=NB_PERM77,
+   .perms=perm77,
+   .nbTwiddle=NB_TWIDDLE164,
+   .twiddle=twiddle164,
+   .nbGroupedFactors=2,
+   .nbFactors=4,
+   .factors=factors77,
+   .lengths=lengths77,
+   .format=12,
+   .reversalVectorizable=0
+   },
+   /* Length 512 */
+   {
+   .normalization=Q31(0x00400000),
+   .nbPerms=NB_PERM78,
+   .perms=perm78,
+   .nbTwiddle=NB_TWIDDLE165,
+   .twiddle=twiddle165,
+   .nbGroupedFactors=2,
+   .nbFactors=5,
    .factors=factors78,
    .lengths=lengths78,
    .format=9,
    .reversalVectorizable=0
-   };
-cfftconfig<Q31> config162={
-   .normalization=Q31(0x010624DD),
+   },
+   /* Length 1024 */
+   {
+   .normalization=Q31(0x00200000),
    .nbPerms=NB_PERM54,
    .perms=perm54,
-   .nbTwiddle=NB_TWIDDLE162,
-   .twiddle=twiddle162,
+   .nbTwiddle=NB_TWIDDLE166,
+   .twiddle=twiddle166,
    .nbGroupedFactors=1,
-   .nbFactors=3,
+   .nbFactors=5,
    .factors=factors54,
    .lengths=lengths54,
+   .format=10,
+   .reversalVectorizable=1
+   },
+   /* Length 2048 */
+   {
+   .normalization=Q31(0x00100000),
+   .nbPerms=NB_PERM55,
+   .perms=perm55,
+   .nbTwiddle=NB_TWIDDLE167,
+   .twiddle=twiddle167,
+   .nbGroupedFactors=2,
+   .nbFactors=6,
+   .factors=factors55,
+   .lengths=lengths55,
+   .format=11,
+   .reversalVectorizable=0
+   },
+   /* Length 4096 */
+   {
+   .normalization=Q31(0x00080000),
+   .nbPerms=NB_PERM56,
+   .perms=perm56,
+   .nbTwiddle=NB_TWIDDLE168,
+   .twiddle=twiddle168,
+   .nbGroupedFactors=1,
+   .nbFactors=6,
+   .factors=factors56,
+   .lengths=lengths56,
    .format=12,
    .reversalVectorizable=1
-   };
+   },
+};
+
+const uint16_t cfftLengthsQ31[54]={2,3,4,5,6,8,9,10,12,15,16,18,20,24,25,27,30,32,36,40,45,48,50,54,60,64,72,75,80,81,90,96,100,108,120,125,128,144,150,160,180,192,200,216,240,256,288,320,384,400,512,1024,2048,4096};
+
 
 template<>
 const cfftconfig<Q31> *cfft_config<Q31>(uint32_t nbSamples)
 {
-    switch(nbSamples)
-    {
-        case 2:
-            return(&config111);
-        break;
-        case 3:
-            return(&config112);
-        break;
-        case 4:
-            return(&config113);
-        break;
-        case 5:
-            return(&config114);
-        break;
-        case 6:
-            return(&config115);
-        break;
-        case 8:
-            return(&config117);
-        break;
-        case 9:
-            return(&config118);
-        break;
-        case 10:
-            return(&config119);
-        break;
-        case 12:
-            return(&config121);
-        break;
-        case 15:
-            return(&config123);
-        break;
-        case 16:
-            return(&config124);
-        break;
-        case 18:
-            return(&config126);
-        break;
-        case 20:
-            return(&config128);
-        break;
-        case 24:
-            return(&config130);
-        break;
-        case 25:
-            return(&config131);
-        break;
-        case 27:
-            return(&config132);
-        break;
-        case 30:
-            return(&config133);
-        break;
-        case 32:
-            return(&config134);
-        break;
-        case 36:
-            return(&config138);
-        break;
-        case 40:
-            return(&config139);
-        break;
-        case 45:
-            return(&config140);
-        break;
-        case 48:
-            return(&config141);
-        break;
-        case 50:
-            return(&config142);
-        break;
-        case 54:
-            return(&config144);
-        break;
-        case 60:
-            return(&config145);
-        break;
-        case 64:
-            return(&config146);
-        break;
-        case 72:
-            return(&config150);
-        break;
-        case 75:
-            return(&config152);
-        break;
-        case 80:
-            return(&config153);
-        break;
-        case 81:
-            return(&config154);
-        break;
-        case 90:
-            return(&config156);
-        break;
-        case 96:
-            return(&config157);
-        break;
-        case 100:
-            return(&config158);
-        break;
-        case 108:
-            return(&config159);
-        break;
-        case 120:
-            return(&config161);
-        break;
-        case 125:
-            return(&config162);
-        break;
-        case 128:
-            return(&config120);
-        break;
-        case 144:
-            return(&config125);
-        break;
-        case 150:
-            return(&config129);
-        break;
-        case 160:
-            return(&config137);
-        break;
-        case 180:
-            return(&config143);
-        break;
-        case 192:
-            return(&config149);
-        break;
-        case 200:
-            return(&config151);
-        break;
-        case 216:
-            return(&config155);
-        break;
-        case 240:
-            return(&config160);
-        break;
-        case 256:
-            return(&config109);
-        break;
-        case 288:
-            return(&config135);
-        break;
-        case 320:
-            return(&config147);
-        break;
-        case 384:
-            return(&config122);
-        break;
-        case 400:
-            return(&config127);
-        break;
-        case 512:
-            return(&config116);
-        break;
-        case 1024:
-            return(&config136);
-        break;
-        case 2048:
-            return(&config148);
-        break;
-        case 4096:
-            return(&config110);
-        break;
-
-    }
-    return(NULL);
+    return(fft_config_search(cfftLengthsQ31,cfftConfigsQ31,54,nbSamples));
 }
 
-cfftconfig<Q15> config163={
-   .normalization=Q15(0x0080),
-   .nbPerms=NB_PERM55,
-   .perms=perm55,
-   .nbTwiddle=NB_TWIDDLE163,
-   .twiddle=twiddle163,
+const cfftconfig<Q15> cfftConfigsQ15[54]={
+   /* Length 2 */
+   {
+   .normalization=Q15(0x4000),
+   .nbPerms=NB_PERM1,
+   .perms=perm1,
+   .nbTwiddle=NB_TWIDDLE169,
+   .twiddle=twiddle169,
    .nbGroupedFactors=1,
-   .nbFactors=4,
-   .factors=factors55,
-   .lengths=lengths55,
-   .format=8,
+   .nbFactors=1,
+   .factors=factors1,
+   .lengths=lengths1,
+   .format=1,
    .reversalVectorizable=1
-   };
-cfftconfig<Q15> config164={
-   .normalization=Q15(0x0008),
+   },
+   /* Length 3 */
+   {
+   .normalization=Q15(0x2AAB),
    .nbPerms=NB_PERM2,
    .perms=perm2,
-   .nbTwiddle=NB_TWIDDLE164,
-   .twiddle=twiddle164,
+   .nbTwiddle=NB_TWIDDLE170,
+   .twiddle=twiddle170,
    .nbGroupedFactors=1,
-   .nbFactors=6,
+   .nbFactors=1,
    .factors=factors2,
    .lengths=lengths2,
-   .format=12,
+   .format=2,
    .reversalVectorizable=1
-   };
-cfftconfig<Q15> config165={
-   .normalization=Q15(0x4000),
+   },
+   /* Length 4 */
+   {
+   .normalization=Q15(0x2000),
    .nbPerms=NB_PERM3,
    .perms=perm3,
-   .nbTwiddle=NB_TWIDDLE165,
-   .twiddle=twiddle165,
+   .nbTwiddle=NB_TWIDDLE171,
+   .twiddle=twiddle171,
    .nbGroupedFactors=1,
    .nbFactors=1,
    .factors=factors3,
    .lengths=lengths3,
-   .format=1,
+   .format=2,
    .reversalVectorizable=1
-   };
-cfftconfig<Q15> config166={
-   .normalization=Q15(0x2AAB),
-   .nbPerms=NB_PERM4,
-   .perms=perm4,
-   .nbTwiddle=NB_TWIDDLE166,
-   .twiddle=twiddle166,
+   },
+   /* Length 5 */
+   {
+   .normalization=Q15(0x199A),
+   .nbPerms=NB_PERM7,
+   .perms=perm7,
+   .nbTwiddle=NB_TWIDDLE172,
+   .twiddle=twiddle172,
    .nbGroupedFactors=1,
    .nbFactors=1,
+   .factors=factors7,
+   .lengths=lengths7,
+   .format=4,
+   .reversalVectorizable=1
+   },
+   /* Length 6 */
+   {
+   .normalization=Q15(0x1555),
+   .nbPerms=NB_PERM4,
+   .perms=perm4,
+   .nbTwiddle=NB_TWIDDLE173,
+   .twiddle=twiddle173,
+   .nbGroupedFactors=2,
+   .nbFactors=2,
    .factors=factors4,
    .lengths=lengths4,
-   .format=2,
-   .reversalVectorizable=1
-   };
-cfftconfig<Q15> config167={
-   .normalization=Q15(0x2000),
+   .format=3,
+   .reversalVectorizable=0
+   },
+   /* Length 8 */
+   {
+   .normalization=Q15(0x1000),
    .nbPerms=NB_PERM5,
    .perms=perm5,
-   .nbTwiddle=NB_TWIDDLE167,
-   .twiddle=twiddle167,
-   .nbGroupedFactors=1,
-   .nbFactors=1,
+   .nbTwiddle=NB_TWIDDLE174,
+   .twiddle=twiddle174,
+   .nbGroupedFactors=2,
+   .nbFactors=2,
    .factors=factors5,
    .lengths=lengths5,
-   .format=2,
-   .reversalVectorizable=1
-   };
-cfftconfig<Q15> config168={
-   .normalization=Q15(0x199A),
-   .nbPerms=NB_PERM6,
-   .perms=perm6,
-   .nbTwiddle=NB_TWIDDLE168,
-   .twiddle=twiddle168,
+   .format=3,
+   .reversalVectorizable=0
+   },
+   /* Length 9 */
+   {
+   .normalization=Q15(0x0E39),
+   .nbPerms=NB_PERM9,
+   .perms=perm9,
+   .nbTwiddle=NB_TWIDDLE175,
+   .twiddle=twiddle175,
    .nbGroupedFactors=1,
-   .nbFactors=1,
-   .factors=factors6,
-   .lengths=lengths6,
+   .nbFactors=2,
+   .factors=factors9,
+   .lengths=lengths9,
    .format=4,
    .reversalVectorizable=1
-   };
-cfftconfig<Q15> config169={
-   .normalization=Q15(0x1555),
-   .nbPerms=NB_PERM7,
-   .perms=perm7,
-   .nbTwiddle=NB_TWIDDLE169,
-   .twiddle=twiddle169,
+   },
+   /* Length 10 */
+   {
+   .normalization=Q15(0x0CCD),
+   .nbPerms=NB_PERM10,
+   .perms=perm10,
+   .nbTwiddle=NB_TWIDDLE176,
+   .twiddle=twiddle176,
+   .nbGroupedFactors=2,
+   .nbFactors=2,
+   .factors=factors10,
+   .lengths=lengths10,
+   .format=5,
+   .reversalVectorizable=0
+   },
+   /* Length 12 */
+   {
+   .normalization=Q15(0x0AAB),
+   .nbPerms=NB_PERM11,
+   .perms=perm11,
+   .nbTwiddle=NB_TWIDDLE177,
+   .twiddle=twiddle177,
    .nbGroupedFactors=2,
    .nbFactors=2,
-   .factors=factors7,
-   .lengths=lengths7,
-   .format=3,
+   .factors=factors11,
+   .lengths=lengths11,
+   .format=4,
+   .reversalVectorizable=0
+   },
+   /* Length 15 */
+   {
+   .normalization=Q15(0x0889),
+   .nbPerms=NB_PERM12,
+   .perms=perm12,
+   .nbTwiddle=NB_TWIDDLE178,
+   .twiddle=twiddle178,
+   .nbGroupedFactors=2,
+   .nbFactors=2,
+   .factors=factors12,
+   .lengths=lengths12,
+   .format=6,
+   .reversalVectorizable=0
+   },
+   /* Length 16 */
+   {
+   .normalization=Q15(0x0800),
+   .nbPerms=NB_PERM6,
+   .perms=perm6,
+   .nbTwiddle=NB_TWIDDLE179,
+   .twiddle=twiddle179,
+   .nbGroupedFactors=1,
+   .nbFactors=2,
+   .factors=factors6,
+   .lengths=lengths6,
+   .format=4,
+   .reversalVectorizable=1
+   },
+   /* Length 18 */
+   {
+   .normalization=Q15(0x071C),
+   .nbPerms=NB_PERM14,
+   .perms=perm14,
+   .nbTwiddle=NB_TWIDDLE180,
+   .twiddle=twiddle180,
+   .nbGroupedFactors=2,
+   .nbFactors=3,
+   .factors=factors14,
+   .lengths=lengths14,
+   .format=5,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config170={
-   .normalization=Q15(0x0040),
-   .nbPerms=NB_PERM56,
-   .perms=perm56,
-   .nbTwiddle=NB_TWIDDLE170,
-   .twiddle=twiddle170,
+   },
+   /* Length 20 */
+   {
+   .normalization=Q15(0x0666),
+   .nbPerms=NB_PERM15,
+   .perms=perm15,
+   .nbTwiddle=NB_TWIDDLE181,
+   .twiddle=twiddle181,
    .nbGroupedFactors=2,
-   .nbFactors=5,
-   .factors=factors56,
-   .lengths=lengths56,
-   .format=9,
+   .nbFactors=2,
+   .factors=factors15,
+   .lengths=lengths15,
+   .format=6,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config171={
-   .normalization=Q15(0x1000),
+   },
+   /* Length 24 */
+   {
+   .normalization=Q15(0x0555),
    .nbPerms=NB_PERM57,
    .perms=perm57,
-   .nbTwiddle=NB_TWIDDLE171,
-   .twiddle=twiddle171,
-   .nbGroupedFactors=2,
-   .nbFactors=2,
+   .nbTwiddle=NB_TWIDDLE182,
+   .twiddle=twiddle182,
+   .nbGroupedFactors=3,
+   .nbFactors=3,
    .factors=factors57,
    .lengths=lengths57,
-   .format=3,
+   .format=5,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config172={
-   .normalization=Q15(0x0E39),
-   .nbPerms=NB_PERM10,
-   .perms=perm10,
-   .nbTwiddle=NB_TWIDDLE172,
-   .twiddle=twiddle172,
+   },
+   /* Length 25 */
+   {
+   .normalization=Q15(0x051F),
+   .nbPerms=NB_PERM17,
+   .perms=perm17,
+   .nbTwiddle=NB_TWIDDLE183,
+   .twiddle=twiddle183,
    .nbGroupedFactors=1,
    .nbFactors=2,
-   .factors=factors10,
-   .lengths=lengths10,
-   .format=4,
+   .factors=factors17,
+   .lengths=lengths17,
+   .format=8,
    .reversalVectorizable=1
-   };
-cfftconfig<Q15> config173={
-   .normalization=Q15(0x0CCD),
-   .nbPerms=NB_PERM11,
-   .perms=perm11,
-   .nbTwiddle=NB_TWIDDLE173,
-   .twiddle=twiddle173,
-   .nbGroupedFactors=2,
-   .nbFactors=2,
-   .factors=factors11,
-   .lengths=lengths11,
-   .format=5,
+   },
+   /* Length 27 */
+   {
+   .normalization=Q15(0x04BE),
+   .nbPerms=NB_PERM18,
+   .perms=perm18,
+   .nbTwiddle=NB_TWIDDLE184,
+   .twiddle=twiddle184,
+   .nbGroupedFactors=1,
+   .nbFactors=3,
+   .factors=factors18,
+   .lengths=lengths18,
+   .format=6,
+   .reversalVectorizable=1
+   },
+   /* Length 30 */
+   {
+   .normalization=Q15(0x0444),
+   .nbPerms=NB_PERM19,
+   .perms=perm19,
+   .nbTwiddle=NB_TWIDDLE185,
+   .twiddle=twiddle185,
+   .nbGroupedFactors=3,
+   .nbFactors=3,
+   .factors=factors19,
+   .lengths=lengths19,
+   .format=7,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config174={
-   .normalization=Q15(0x0100),
+   },
+   /* Length 32 */
+   {
+   .normalization=Q15(0x0400),
    .nbPerms=NB_PERM58,
    .perms=perm58,
-   .nbTwiddle=NB_TWIDDLE174,
-   .twiddle=twiddle174,
+   .nbTwiddle=NB_TWIDDLE186,
+   .twiddle=twiddle186,
    .nbGroupedFactors=2,
-   .nbFactors=4,
+   .nbFactors=3,
    .factors=factors58,
    .lengths=lengths58,
-   .format=7,
+   .format=5,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config175={
-   .normalization=Q15(0x0AAB),
-   .nbPerms=NB_PERM13,
-   .perms=perm13,
-   .nbTwiddle=NB_TWIDDLE175,
-   .twiddle=twiddle175,
+   },
+   /* Length 36 */
+   {
+   .normalization=Q15(0x038E),
+   .nbPerms=NB_PERM21,
+   .perms=perm21,
+   .nbTwiddle=NB_TWIDDLE187,
+   .twiddle=twiddle187,
    .nbGroupedFactors=2,
-   .nbFactors=2,
-   .factors=factors13,
-   .lengths=lengths13,
-   .format=4,
+   .nbFactors=3,
+   .factors=factors21,
+   .lengths=lengths21,
+   .format=6,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config176={
-   .normalization=Q15(0x0055),
+   },
+   /* Length 40 */
+   {
+   .normalization=Q15(0x0333),
    .nbPerms=NB_PERM59,
    .perms=perm59,
-   .nbTwiddle=NB_TWIDDLE176,
-   .twiddle=twiddle176,
+   .nbTwiddle=NB_TWIDDLE188,
+   .twiddle=twiddle188,
    .nbGroupedFactors=3,
-   .nbFactors=5,
+   .nbFactors=3,
    .factors=factors59,
    .lengths=lengths59,
-   .format=9,
+   .format=7,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config177={
-   .normalization=Q15(0x0889),
-   .nbPerms=NB_PERM15,
-   .perms=perm15,
-   .nbTwiddle=NB_TWIDDLE177,
-   .twiddle=twiddle177,
+   },
+   /* Length 45 */
+   {
+   .normalization=Q15(0x02D8),
+   .nbPerms=NB_PERM23,
+   .perms=perm23,
+   .nbTwiddle=NB_TWIDDLE189,
+   .twiddle=twiddle189,
    .nbGroupedFactors=2,
-   .nbFactors=2,
-   .factors=factors15,
-   .lengths=lengths15,
-   .format=6,
+   .nbFactors=3,
+   .factors=factors23,
+   .lengths=lengths23,
+   .format=8,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config178={
-   .normalization=Q15(0x0800),
+   },
+   /* Length 48 */
+   {
+   .normalization=Q15(0x02AB),
    .nbPerms=NB_PERM60,
    .perms=perm60,
-   .nbTwiddle=NB_TWIDDLE178,
-   .twiddle=twiddle178,
-   .nbGroupedFactors=1,
-   .nbFactors=2,
+   .nbTwiddle=NB_TWIDDLE190,
+   .twiddle=twiddle190,
+   .nbGroupedFactors=2,
+   .nbFactors=3,
    .factors=factors60,
    .lengths=lengths60,
-   .format=4,
-   .reversalVectorizable=1
-   };
-cfftconfig<Q15> config179={
-   .normalization=Q15(0x00E4),
-   .nbPerms=NB_PERM61,
-   .perms=perm61,
-   .nbTwiddle=NB_TWIDDLE179,
-   .twiddle=twiddle179,
-   .nbGroupedFactors=2,
-   .nbFactors=4,
-   .factors=factors61,
-   .lengths=lengths61,
-   .format=8,
+   .format=6,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config180={
-   .normalization=Q15(0x071C),
-   .nbPerms=NB_PERM18,
-   .perms=perm18,
-   .nbTwiddle=NB_TWIDDLE180,
-   .twiddle=twiddle180,
+   },
+   /* Length 50 */
+   {
+   .normalization=Q15(0x028F),
+   .nbPerms=NB_PERM25,
+   .perms=perm25,
+   .nbTwiddle=NB_TWIDDLE191,
+   .twiddle=twiddle191,
    .nbGroupedFactors=2,
    .nbFactors=3,
-   .factors=factors18,
-   .lengths=lengths18,
-   .format=5,
+   .factors=factors25,
+   .lengths=lengths25,
+   .format=9,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config181={
-   .normalization=Q15(0x0052),
-   .nbPerms=NB_PERM62,
-   .perms=perm62,
-   .nbTwiddle=NB_TWIDDLE181,
-   .twiddle=twiddle181,
+   },
+   /* Length 54 */
+   {
+   .normalization=Q15(0x025F),
+   .nbPerms=NB_PERM26,
+   .perms=perm26,
+   .nbTwiddle=NB_TWIDDLE192,
+   .twiddle=twiddle192,
    .nbGroupedFactors=2,
    .nbFactors=4,
-   .factors=factors62,
-   .lengths=lengths62,
-   .format=12,
+   .factors=factors26,
+   .lengths=lengths26,
+   .format=7,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config182={
-   .normalization=Q15(0x0666),
-   .nbPerms=NB_PERM20,
-   .perms=perm20,
-   .nbTwiddle=NB_TWIDDLE182,
-   .twiddle=twiddle182,
-   .nbGroupedFactors=2,
-   .nbFactors=2,
-   .factors=factors20,
-   .lengths=lengths20,
-   .format=6,
+   },
+   /* Length 60 */
+   {
+   .normalization=Q15(0x0222),
+   .nbPerms=NB_PERM27,
+   .perms=perm27,
+   .nbTwiddle=NB_TWIDDLE193,
+   .twiddle=twiddle193,
+   .nbGroupedFactors=3,
+   .nbFactors=3,
+   .factors=factors27,
+   .lengths=lengths27,
+   .format=8,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config183={
-   .normalization=Q15(0x00DA),
-   .nbPerms=NB_PERM21,
-   .perms=perm21,
-   .nbTwiddle=NB_TWIDDLE183,
-   .twiddle=twiddle183,
+   },
+   /* Length 64 */
+   {
+   .normalization=Q15(0x0200),
+   .nbPerms=NB_PERM61,
+   .perms=perm61,
+   .nbTwiddle=NB_TWIDDLE194,
+   .twiddle=twiddle194,
+   .nbGroupedFactors=1,
+   .nbFactors=3,
+   .factors=factors61,
+   .lengths=lengths61,
+   .format=6,
+   .reversalVectorizable=1
+   },
+   /* Length 72 */
+   {
+   .normalization=Q15(0x01C7),
+   .nbPerms=NB_PERM62,
+   .perms=perm62,
+   .nbTwiddle=NB_TWIDDLE195,
+   .twiddle=twiddle195,
    .nbGroupedFactors=3,
    .nbFactors=4,
-   .factors=factors21,
-   .lengths=lengths21,
-   .format=11,
+   .factors=factors62,
+   .lengths=lengths62,
+   .format=7,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config184={
-   .normalization=Q15(0x0555),
+   },
+   /* Length 75 */
+   {
+   .normalization=Q15(0x01B5),
+   .nbPerms=NB_PERM30,
+   .perms=perm30,
+   .nbTwiddle=NB_TWIDDLE196,
+   .twiddle=twiddle196,
+   .nbGroupedFactors=2,
+   .nbFactors=3,
+   .factors=factors30,
+   .lengths=lengths30,
+   .format=10,
+   .reversalVectorizable=0
+   },
+   /* Length 80 */
+   {
+   .normalization=Q15(0x019A),
    .nbPerms=NB_PERM63,
    .perms=perm63,
-   .nbTwiddle=NB_TWIDDLE184,
-   .twiddle=twiddle184,
-   .nbGroupedFactors=3,
+   .nbTwiddle=NB_TWIDDLE197,
+   .twiddle=twiddle197,
+   .nbGroupedFactors=2,
    .nbFactors=3,
    .factors=factors63,
    .lengths=lengths63,
-   .format=5,
+   .format=8,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config185={
-   .normalization=Q15(0x051F),
-   .nbPerms=NB_PERM23,
-   .perms=perm23,
-   .nbTwiddle=NB_TWIDDLE185,
-   .twiddle=twiddle185,
+   },
+   /* Length 81 */
+   {
+   .normalization=Q15(0x0195),
+   .nbPerms=NB_PERM32,
+   .perms=perm32,
+   .nbTwiddle=NB_TWIDDLE198,
+   .twiddle=twiddle198,
    .nbGroupedFactors=1,
-   .nbFactors=2,
-   .factors=factors23,
-   .lengths=lengths23,
+   .nbFactors=4,
+   .factors=factors32,
+   .lengths=lengths32,
    .format=8,
    .reversalVectorizable=1
-   };
-cfftconfig<Q15> config186={
-   .normalization=Q15(0x04BE),
-   .nbPerms=NB_PERM24,
-   .perms=perm24,
-   .nbTwiddle=NB_TWIDDLE186,
-   .twiddle=twiddle186,
-   .nbGroupedFactors=1,
-   .nbFactors=3,
-   .factors=factors24,
-   .lengths=lengths24,
-   .format=6,
-   .reversalVectorizable=1
-   };
-cfftconfig<Q15> config187={
-   .normalization=Q15(0x0444),
-   .nbPerms=NB_PERM25,
-   .perms=perm25,
-   .nbTwiddle=NB_TWIDDLE187,
-   .twiddle=twiddle187,
+   },
+   /* Length 90 */
+   {
+   .normalization=Q15(0x016C),
+   .nbPerms=NB_PERM33,
+   .perms=perm33,
+   .nbTwiddle=NB_TWIDDLE199,
+   .twiddle=twiddle199,
    .nbGroupedFactors=3,
-   .nbFactors=3,
-   .factors=factors25,
-   .lengths=lengths25,
-   .format=7,
+   .nbFactors=4,
+   .factors=factors33,
+   .lengths=lengths33,
+   .format=9,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config188={
-   .normalization=Q15(0x0400),
+   },
+   /* Length 96 */
+   {
+   .normalization=Q15(0x0155),
    .nbPerms=NB_PERM64,
    .perms=perm64,
-   .nbTwiddle=NB_TWIDDLE188,
-   .twiddle=twiddle188,
-   .nbGroupedFactors=2,
-   .nbFactors=3,
+   .nbTwiddle=NB_TWIDDLE200,
+   .twiddle=twiddle200,
+   .nbGroupedFactors=3,
+   .nbFactors=4,
    .factors=factors64,
    .lengths=lengths64,
-   .format=5,
+   .format=7,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config189={
-   .normalization=Q15(0x0072),
+   },
+   /* Length 100 */
+   {
+   .normalization=Q15(0x0148),
+   .nbPerms=NB_PERM35,
+   .perms=perm35,
+   .nbTwiddle=NB_TWIDDLE201,
+   .twiddle=twiddle201,
+   .nbGroupedFactors=2,
+   .nbFactors=3,
+   .factors=factors35,
+   .lengths=lengths35,
+   .format=10,
+   .reversalVectorizable=0
+   },
+   /* Length 108 */
+   {
+   .normalization=Q15(0x012F),
+   .nbPerms=NB_PERM36,
+   .perms=perm36,
+   .nbTwiddle=NB_TWIDDLE202,
+   .twiddle=twiddle202,
+   .nbGroupedFactors=2,
+   .nbFactors=4,
+   .factors=factors36,
+   .lengths=lengths36,
+   .format=8,
+   .reversalVectorizable=0
+   },
+   /* Length 120 */
+   {
+   .normalization=Q15(0x0111),
    .nbPerms=NB_PERM65,
    .perms=perm65,
-   .nbTwiddle=NB_TWIDDLE189,
-   .twiddle=twiddle189,
-   .nbGroupedFactors=3,
-   .nbFactors=5,
+   .nbTwiddle=NB_TWIDDLE203,
+   .twiddle=twiddle203,
+   .nbGroupedFactors=4,
+   .nbFactors=4,
    .factors=factors65,
    .lengths=lengths65,
    .format=9,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config190={
-   .normalization=Q15(0x0020),
-   .nbPerms=NB_PERM28,
-   .perms=perm28,
-   .nbTwiddle=NB_TWIDDLE190,
-   .twiddle=twiddle190,
+   },
+   /* Length 125 */
+   {
+   .normalization=Q15(0x0106),
+   .nbPerms=NB_PERM38,
+   .perms=perm38,
+   .nbTwiddle=NB_TWIDDLE204,
+   .twiddle=twiddle204,
    .nbGroupedFactors=1,
-   .nbFactors=5,
-   .factors=factors28,
-   .lengths=lengths28,
-   .format=10,
+   .nbFactors=3,
+   .factors=factors38,
+   .lengths=lengths38,
+   .format=12,
    .reversalVectorizable=1
-   };
-cfftconfig<Q15> config191={
-   .normalization=Q15(0x00CD),
+   },
+   /* Length 128 */
+   {
+   .normalization=Q15(0x0100),
    .nbPerms=NB_PERM66,
    .perms=perm66,
-   .nbTwiddle=NB_TWIDDLE191,
-   .twiddle=twiddle191,
-   .nbGroupedFactors=3,
+   .nbTwiddle=NB_TWIDDLE205,
+   .twiddle=twiddle205,
+   .nbGroupedFactors=2,
    .nbFactors=4,
    .factors=factors66,
    .lengths=lengths66,
-   .format=9,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q15> config192={
-   .normalization=Q15(0x038E),
-   .nbPerms=NB_PERM30,
-   .perms=perm30,
-   .nbTwiddle=NB_TWIDDLE192,
-   .twiddle=twiddle192,
-   .nbGroupedFactors=2,
-   .nbFactors=3,
-   .factors=factors30,
-   .lengths=lengths30,
-   .format=6,
+   .format=7,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config193={
-   .normalization=Q15(0x0333),
+   },
+   /* Length 144 */
+   {
+   .normalization=Q15(0x00E4),
    .nbPerms=NB_PERM67,
    .perms=perm67,
-   .nbTwiddle=NB_TWIDDLE193,
-   .twiddle=twiddle193,
-   .nbGroupedFactors=3,
-   .nbFactors=3,
+   .nbTwiddle=NB_TWIDDLE206,
+   .twiddle=twiddle206,
+   .nbGroupedFactors=2,
+   .nbFactors=4,
    .factors=factors67,
    .lengths=lengths67,
-   .format=7,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q15> config194={
-   .normalization=Q15(0x02D8),
-   .nbPerms=NB_PERM32,
-   .perms=perm32,
-   .nbTwiddle=NB_TWIDDLE194,
-   .twiddle=twiddle194,
-   .nbGroupedFactors=2,
-   .nbFactors=3,
-   .factors=factors32,
-   .lengths=lengths32,
    .format=8,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config195={
-   .normalization=Q15(0x02AB),
+   },
+   /* Length 150 */
+   {
+   .normalization=Q15(0x00DA),
+   .nbPerms=NB_PERM41,
+   .perms=perm41,
+   .nbTwiddle=NB_TWIDDLE207,
+   .twiddle=twiddle207,
+   .nbGroupedFactors=3,
+   .nbFactors=4,
+   .factors=factors41,
+   .lengths=lengths41,
+   .format=11,
+   .reversalVectorizable=0
+   },
+   /* Length 160 */
+   {
+   .normalization=Q15(0x00CD),
    .nbPerms=NB_PERM68,
    .perms=perm68,
-   .nbTwiddle=NB_TWIDDLE195,
-   .twiddle=twiddle195,
-   .nbGroupedFactors=2,
-   .nbFactors=3,
+   .nbTwiddle=NB_TWIDDLE208,
+   .twiddle=twiddle208,
+   .nbGroupedFactors=3,
+   .nbFactors=4,
    .factors=factors68,
    .lengths=lengths68,
-   .format=6,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q15> config196={
-   .normalization=Q15(0x028F),
-   .nbPerms=NB_PERM34,
-   .perms=perm34,
-   .nbTwiddle=NB_TWIDDLE196,
-   .twiddle=twiddle196,
-   .nbGroupedFactors=2,
-   .nbFactors=3,
-   .factors=factors34,
-   .lengths=lengths34,
    .format=9,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config197={
+   },
+   /* Length 180 */
+   {
    .normalization=Q15(0x00B6),
-   .nbPerms=NB_PERM35,
-   .perms=perm35,
-   .nbTwiddle=NB_TWIDDLE197,
-   .twiddle=twiddle197,
-   .nbGroupedFactors=3,
-   .nbFactors=4,
-   .factors=factors35,
-   .lengths=lengths35,
-   .format=10,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q15> config198={
-   .normalization=Q15(0x025F),
-   .nbPerms=NB_PERM36,
-   .perms=perm36,
-   .nbTwiddle=NB_TWIDDLE198,
-   .twiddle=twiddle198,
-   .nbGroupedFactors=2,
-   .nbFactors=4,
-   .factors=factors36,
-   .lengths=lengths36,
-   .format=7,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q15> config199={
-   .normalization=Q15(0x0222),
-   .nbPerms=NB_PERM37,
-   .perms=perm37,
-   .nbTwiddle=NB_TWIDDLE199,
-   .twiddle=twiddle199,
+   .nbPerms=NB_PERM43,
+   .perms=perm43,
+   .nbTwiddle=NB_TWIDDLE209,
+   .twiddle=twiddle209,
    .nbGroupedFactors=3,
-   .nbFactors=3,
-   .factors=factors37,
-   .lengths=lengths37,
-   .format=8,
+   .nbFactors=4,
+   .factors=factors43,
+   .lengths=lengths43,
+   .format=10,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config200={
-   .normalization=Q15(0x0200),
+   },
+   /* Length 192 */
+   {
+   .normalization=Q15(0x00AB),
    .nbPerms=NB_PERM69,
    .perms=perm69,
-   .nbTwiddle=NB_TWIDDLE200,
-   .twiddle=twiddle200,
-   .nbGroupedFactors=1,
-   .nbFactors=3,
+   .nbTwiddle=NB_TWIDDLE210,
+   .twiddle=twiddle210,
+   .nbGroupedFactors=2,
+   .nbFactors=4,
    .factors=factors69,
    .lengths=lengths69,
-   .format=6,
-   .reversalVectorizable=1
-   };
-cfftconfig<Q15> config201={
-   .normalization=Q15(0x0066),
+   .format=8,
+   .reversalVectorizable=0
+   },
+   /* Length 200 */
+   {
+   .normalization=Q15(0x00A4),
    .nbPerms=NB_PERM70,
    .perms=perm70,
-   .nbTwiddle=NB_TWIDDLE201,
-   .twiddle=twiddle201,
-   .nbGroupedFactors=2,
+   .nbTwiddle=NB_TWIDDLE211,
+   .twiddle=twiddle211,
+   .nbGroupedFactors=3,
    .nbFactors=4,
    .factors=factors70,
    .lengths=lengths70,
-   .format=10,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q15> config202={
-   .normalization=Q15(0x0010),
-   .nbPerms=NB_PERM40,
-   .perms=perm40,
-   .nbTwiddle=NB_TWIDDLE202,
-   .twiddle=twiddle202,
-   .nbGroupedFactors=2,
-   .nbFactors=6,
-   .factors=factors40,
-   .lengths=lengths40,
    .format=11,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config203={
-   .normalization=Q15(0x00AB),
+   },
+   /* Length 216 */
+   {
+   .normalization=Q15(0x0098),
    .nbPerms=NB_PERM71,
    .perms=perm71,
-   .nbTwiddle=NB_TWIDDLE203,
-   .twiddle=twiddle203,
-   .nbGroupedFactors=2,
-   .nbFactors=4,
+   .nbTwiddle=NB_TWIDDLE212,
+   .twiddle=twiddle212,
+   .nbGroupedFactors=3,
+   .nbFactors=5,
    .factors=factors71,
    .lengths=lengths71,
-   .format=8,
+   .format=9,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config204={
-   .normalization=Q15(0x01C7),
+   },
+   /* Length 240 */
+   {
+   .normalization=Q15(0x0089),
    .nbPerms=NB_PERM72,
    .perms=perm72,
-   .nbTwiddle=NB_TWIDDLE204,
-   .twiddle=twiddle204,
+   .nbTwiddle=NB_TWIDDLE213,
+   .twiddle=twiddle213,
    .nbGroupedFactors=3,
    .nbFactors=4,
    .factors=factors72,
    .lengths=lengths72,
-   .format=7,
+   .format=10,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config205={
-   .normalization=Q15(0x00A4),
+   },
+   /* Length 256 */
+   {
+   .normalization=Q15(0x0080),
    .nbPerms=NB_PERM73,
    .perms=perm73,
-   .nbTwiddle=NB_TWIDDLE205,
-   .twiddle=twiddle205,
-   .nbGroupedFactors=3,
+   .nbTwiddle=NB_TWIDDLE214,
+   .twiddle=twiddle214,
+   .nbGroupedFactors=1,
    .nbFactors=4,
    .factors=factors73,
    .lengths=lengths73,
-   .format=11,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q15> config206={
-   .normalization=Q15(0x01B5),
-   .nbPerms=NB_PERM44,
-   .perms=perm44,
-   .nbTwiddle=NB_TWIDDLE206,
-   .twiddle=twiddle206,
-   .nbGroupedFactors=2,
-   .nbFactors=3,
-   .factors=factors44,
-   .lengths=lengths44,
-   .format=10,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q15> config207={
-   .normalization=Q15(0x019A),
+   .format=8,
+   .reversalVectorizable=1
+   },
+   /* Length 288 */
+   {
+   .normalization=Q15(0x0072),
    .nbPerms=NB_PERM74,
    .perms=perm74,
-   .nbTwiddle=NB_TWIDDLE207,
-   .twiddle=twiddle207,
-   .nbGroupedFactors=2,
-   .nbFactors=3,
+   .nbTwiddle=NB_TWIDDLE215,
+   .twiddle=twiddle215,
+   .nbGroupedFactors=3,
+   .nbFactors=5,
    .factors=factors74,
    .lengths=lengths74,
-   .format=8,
+   .format=9,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config208={
-   .normalization=Q15(0x0195),
-   .nbPerms=NB_PERM46,
-   .perms=perm46,
-   .nbTwiddle=NB_TWIDDLE208,
-   .twiddle=twiddle208,
-   .nbGroupedFactors=1,
-   .nbFactors=4,
-   .factors=factors46,
-   .lengths=lengths46,
-   .format=8,
-   .reversalVectorizable=1
-   };
-cfftconfig<Q15> config209={
-   .normalization=Q15(0x0098),
+   },
+   /* Length 320 */
+   {
+   .normalization=Q15(0x0066),
    .nbPerms=NB_PERM75,
    .perms=perm75,
-   .nbTwiddle=NB_TWIDDLE209,
-   .twiddle=twiddle209,
-   .nbGroupedFactors=3,
-   .nbFactors=5,
+   .nbTwiddle=NB_TWIDDLE216,
+   .twiddle=twiddle216,
+   .nbGroupedFactors=2,
+   .nbFactors=4,
    .factors=factors75,
    .lengths=lengths75,
-   .format=9,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q15> config210={
-   .normalization=Q15(0x016C),
-   .nbPerms=NB_PERM48,
-   .perms=perm48,
-   .nbTwiddle=NB_TWIDDLE210,
-   .twiddle=twiddle210,
-   .nbGroupedFactors=3,
-   .nbFactors=4,
-   .factors=factors48,
-   .lengths=lengths48,
-   .format=9,
+   .format=10,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config211={
-   .normalization=Q15(0x0155),
+   },
+   /* Length 384 */
+   {
+   .normalization=Q15(0x0055),
    .nbPerms=NB_PERM76,
    .perms=perm76,
-   .nbTwiddle=NB_TWIDDLE211,
-   .twiddle=twiddle211,
+   .nbTwiddle=NB_TWIDDLE217,
+   .twiddle=twiddle217,
    .nbGroupedFactors=3,
-   .nbFactors=4,
+   .nbFactors=5,
    .factors=factors76,
    .lengths=lengths76,
-   .format=7,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q15> config212={
-   .normalization=Q15(0x0148),
-   .nbPerms=NB_PERM50,
-   .perms=perm50,
-   .nbTwiddle=NB_TWIDDLE212,
-   .twiddle=twiddle212,
-   .nbGroupedFactors=2,
-   .nbFactors=3,
-   .factors=factors50,
-   .lengths=lengths50,
-   .format=10,
-   .reversalVectorizable=0
-   };
-cfftconfig<Q15> config213={
-   .normalization=Q15(0x012F),
-   .nbPerms=NB_PERM51,
-   .perms=perm51,
-   .nbTwiddle=NB_TWIDDLE213,
-   .twiddle=twiddle213,
-   .nbGroupedFactors=2,
-   .nbFactors=4,
-   .factors=factors51,
-   .lengths=lengths51,
-   .format=8,
+   .format=9,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config214={
-   .normalization=Q15(0x0089),
+   },
+   /* Length 400 */
+   {
+   .normalization=Q15(0x0052),
    .nbPerms=NB_PERM77,
    .perms=perm77,
-   .nbTwiddle=NB_TWIDDLE214,
-   .twiddle=twiddle214,
-   .nbGroupedFactors=3,
+   .nbTwiddle=NB_TWIDDLE218,
+   .twiddle=twiddle218,
+   .nbGroupedFactors=2,
    .nbFactors=4,
    .factors=factors77,
    .lengths=lengths77,
-   .format=10,
+   .format=12,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config215={
-   .normalization=Q15(0x0111),
+   },
+   /* Length 512 */
+   {
+   .normalization=Q15(0x0040),
    .nbPerms=NB_PERM78,
    .perms=perm78,
-   .nbTwiddle=NB_TWIDDLE215,
-   .twiddle=twiddle215,
-   .nbGroupedFactors=4,
-   .nbFactors=4,
+   .nbTwiddle=NB_TWIDDLE219,
+   .twiddle=twiddle219,
+   .nbGroupedFactors=2,
+   .nbFactors=5,
    .factors=factors78,
    .lengths=lengths78,
    .format=9,
    .reversalVectorizable=0
-   };
-cfftconfig<Q15> config216={
-   .normalization=Q15(0x0106),
+   },
+   /* Length 1024 */
+   {
+   .normalization=Q15(0x0020),
    .nbPerms=NB_PERM54,
    .perms=perm54,
-   .nbTwiddle=NB_TWIDDLE216,
-   .twiddle=twiddle216,
+   .nbTwiddle=NB_TWIDDLE220,
+   .twiddle=twiddle220,
    .nbGroupedFactors=1,
-   .nbFactors=3,
+   .nbFactors=5,
    .factors=factors54,
    .lengths=lengths54,
+   .format=10,
+   .reversalVectorizable=1
+   },
+   /* Length 2048 */
+   {
+   .normalization=Q15(0x0010),
+   .nbPerms=NB_PERM55,
+   .perms=perm55,
+   .nbTwiddle=NB_TWIDDLE221,
+   .twiddle=twiddle221,
+   .nbGroupedFactors=2,
+   .nbFactors=6,
+   .factors=factors55,
+   .lengths=lengths55,
+   .format=11,
+   .reversalVectorizable=0
+   },
+   /* Length 4096 */
+   {
+   .normalization=Q15(0x0008),
+   .nbPerms=NB_PERM56,
+   .perms=perm56,
+   .nbTwiddle=NB_TWIDDLE222,
+   .twiddle=twiddle222,
+   .nbGroupedFactors=1,
+   .nbFactors=6,
+   .factors=factors56,
+   .lengths=lengths56,
    .format=12,
    .reversalVectorizable=1
-   };
+   },
+};
+
+const uint16_t cfftLengthsQ15[54]={2,3,4,5,6,8,9,10,12,15,16,18,20,24,25,27,30,32,36,40,45,48,50,54,60,64,72,75,80,81,90,96,100,108,120,125,128,144,150,160,180,192,200,216,240,256,288,320,384,400,512,1024,2048,4096};
+
 
 template<>
 const cfftconfig<Q15> *cfft_config<Q15>(uint32_t nbSamples)
 {
-    switch(nbSamples)
-    {
-        case 2:
-            return(&config165);
-        break;
-        case 3:
-            return(&config166);
-        break;
-        case 4:
-            return(&config167);
-        break;
-        case 5:
-            return(&config168);
-        break;
-        case 6:
-            return(&config169);
-        break;
-        case 8:
-            return(&config171);
-        break;
-        case 9:
-            return(&config172);
-        break;
-        case 10:
-            return(&config173);
-        break;
-        case 12:
-            return(&config175);
-        break;
-        case 15:
-            return(&config177);
-        break;
-        case 16:
-            return(&config178);
-        break;
-        case 18:
-            return(&config180);
-        break;
-        case 20:
-            return(&config182);
-        break;
-        case 24:
-            return(&config184);
-        break;
-        case 25:
-            return(&config185);
-        break;
-        case 27:
-            return(&config186);
-        break;
-        case 30:
-            return(&config187);
-        break;
-        case 32:
-            return(&config188);
-        break;
-        case 36:
-            return(&config192);
-        break;
-        case 40:
-            return(&config193);
-        break;
-        case 45:
-            return(&config194);
-        break;
-        case 48:
-            return(&config195);
-        break;
-        case 50:
-            return(&config196);
-        break;
-        case 54:
-            return(&config198);
-        break;
-        case 60:
-            return(&config199);
-        break;
-        case 64:
-            return(&config200);
-        break;
-        case 72:
-            return(&config204);
-        break;
-        case 75:
-            return(&config206);
-        break;
-        case 80:
-            return(&config207);
-        break;
-        case 81:
-            return(&config208);
-        break;
-        case 90:
-            return(&config210);
-        break;
-        case 96:
-            return(&config211);
-        break;
-        case 100:
-            return(&config212);
-        break;
-        case 108:
-            return(&config213);
-        break;
-        case 120:
-            return(&config215);
-        break;
-        case 125:
-            return(&config216);
-        break;
-        case 128:
-            return(&config174);
-        break;
-        case 144:
-            return(&config179);
-        break;
-        case 150:
-            return(&config183);
-        break;
-        case 160:
-            return(&config191);
-        break;
-        case 180:
-            return(&config197);
-        break;
-        case 192:
-            return(&config203);
-        break;
-        case 200:
-            return(&config205);
-        break;
-        case 216:
-            return(&config209);
-        break;
-        case 240:
-            return(&config214);
-        break;
-        case 256:
-            return(&config163);
-        break;
-        case 288:
-            return(&config189);
-        break;
-        case 320:
-            return(&config201);
-        break;
-        case 384:
-            return(&config176);
-        break;
-        case 400:
-            return(&config181);
-        break;
-        case 512:
-            return(&config170);
-        break;
-        case 1024:
-            return(&config190);
-        break;
-        case 2048:
-            return(&config202);
-        break;
-        case 4096:
-            return(&config164);
-        break;
-
-    }
-    return(NULL);
+    return(fft_config_search(cfftLengthsQ15,cfftConfigsQ15,54,nbSamples));
 }
 
-rfftconfig<float32_t> config217={
-   .nbTwiddle=NB_TWIDDLE217,
-   .twiddle=twiddle217
-   };
-rfftconfig<float32_t> config218={
-   .nbTwiddle=NB_TWIDDLE218,
-   .twiddle=twiddle218
-   };
-rfftconfig<float32_t> config219={
-   .nbTwiddle=NB_TWIDDLE219,
-   .twiddle=twiddle219
-   };
-rfftconfig<float32_t> config220={
-   .nbTwiddle=NB_TWIDDLE220,
-   .twiddle=twiddle220
-   };
-rfftconfig<float32_t> config221={
-   .nbTwiddle=NB_TWIDDLE221,
-   .twiddle=twiddle221
-   };
-rfftconfig<float32_t> config222={
-   .nbTwiddle=NB_TWIDDLE222,
-   .twiddle=twiddle222
-   };
-rfftconfig<float32_t> config223={
+const rfftconfig<Q7> rfftConfigsQ7[3]={
+   /* Length 4 */
+   {
    .nbTwiddle=NB_TWIDDLE223,
    .twiddle=twiddle223
-   };
-rfftconfig<float32_t> config224={
+   },
+   /* Length 6 */
+   {
    .nbTwiddle=NB_TWIDDLE224,
    .twiddle=twiddle224
-   };
-rfftconfig<float32_t> config225={
+   },
+   /* Length 16 */
+   {
    .nbTwiddle=NB_TWIDDLE225,
    .twiddle=twiddle225
-   };
-rfftconfig<float32_t> config226={
+   },
+};
+
+const uint16_t rfftLengthsQ7[3]={4,6,16};
+
+
+template<>
+const rfftconfig<Q7> *rfft_config<Q7>(uint32_t nbSamples)
+{
+    return(fft_config_search(rfftLengthsQ7,rfftConfigsQ7,3,nbSamples));
+}
+
+const rfftconfig<float32_t> rfftConfigsF32[40]={
+   /* Length 4 */
+   {
    .nbTwiddle=NB_TWIDDLE226,
    .twiddle=twiddle226
-   };
-rfftconfig<float32_t> config227={
+   },
+   /* Length 6 */
+   {
    .nbTwiddle=NB_TWIDDLE227,
    .twiddle=twiddle227
-   };
-rfftconfig<float32_t> config228={
+   },
+   /* Length 8 */
+   {
    .nbTwiddle=NB_TWIDDLE228,
    .twiddle=twiddle228
-   };
-rfftconfig<float32_t> config229={
+   },
+   /* Length 10 */
+   {
    .nbTwiddle=NB_TWIDDLE229,
    .twiddle=twiddle229
-   };
-rfftconfig<float32_t> config230={
+   },
+   /* Length 12 */
+   {
    .nbTwiddle=NB_TWIDDLE230,
    .twiddle=twiddle230
-   };
-rfftconfig<float32_t> config231={
+   },
+   /* Length 16 */
+   {
    .nbTwiddle=NB_TWIDDLE231,
    .twiddle=twiddle231
-   };
-rfftconfig<float32_t> config232={
+   },
+   /* Length 18 */
+   {
    .nbTwiddle=NB_TWIDDLE232,
    .twiddle=twiddle232
-   };
-rfftconfig<float32_t> config233={
+   },
+   /* Length 20 */
+   {
    .nbTwiddle=NB_TWIDDLE233,
    .twiddle=twiddle233
-   };
-rfftconfig<float32_t> config234={
+   },
+   /* Length 24 */
+   {
    .nbTwiddle=NB_TWIDDLE234,
    .twiddle=twiddle234
-   };
-rfftconfig<float32_t> config235={
+   },
+   /* Length 30 */
+   {
    .nbTwiddle=NB_TWIDDLE235,
    .twiddle=twiddle235
-   };
-rfftconfig<float32_t> config236={
+   },
+   /* Length 32 */
+   {
    .nbTwiddle=NB_TWIDDLE236,
    .twiddle=twiddle236
-   };
-rfftconfig<float32_t> config237={
+   },
+   /* Length 36 */
+   {
    .nbTwiddle=NB_TWIDDLE237,
    .twiddle=twiddle237
-   };
-rfftconfig<float32_t> config238={
+   },
+   /* Length 40 */
+   {
    .nbTwiddle=NB_TWIDDLE238,
    .twiddle=twiddle238
-   };
-rfftconfig<float32_t> config239={
+   },
+   /* Length 48 */
+   {
    .nbTwiddle=NB_TWIDDLE239,
    .twiddle=twiddle239
-   };
-rfftconfig<float32_t> config240={
+   },
+   /* Length 50 */
+   {
    .nbTwiddle=NB_TWIDDLE240,
    .twiddle=twiddle240
-   };
-rfftconfig<float32_t> config241={
+   },
+   /* Length 54 */
+   {
    .nbTwiddle=NB_TWIDDLE241,
    .twiddle=twiddle241
-   };
-rfftconfig<float32_t> config242={
+   },
+   /* Length 60 */
+   {
    .nbTwiddle=NB_TWIDDLE242,
    .twiddle=twiddle242
-   };
-rfftconfig<float32_t> config243={
+   },
+   /* Length 64 */
+   {
    .nbTwiddle=NB_TWIDDLE243,
    .twiddle=twiddle243
-   };
-rfftconfig<float32_t> config244={
+   },
+   /* Length 72 */
+   {
    .nbTwiddle=NB_TWIDDLE244,
    .twiddle=twiddle244
-   };
-rfftconfig<float32_t> config245={
+   },
+   /* Length 80 */
+   {
    .nbTwiddle=NB_TWIDDLE245,
    .twiddle=twiddle245
-   };
-rfftconfig<float32_t> config246={
+   },
+   /* Length 90 */
+   {
    .nbTwiddle=NB_TWIDDLE246,
    .twiddle=twiddle246
-   };
-rfftconfig<float32_t> config247={
+   },
+   /* Length 96 */
+   {
    .nbTwiddle=NB_TWIDDLE247,
    .twiddle=twiddle247
-   };
-rfftconfig<float32_t> config248={
+   },
+   /* Length 100 */
+   {
    .nbTwiddle=NB_TWIDDLE248,
    .twiddle=twiddle248
-   };
-rfftconfig<float32_t> config249={
+   },
+   /* Length 108 */
+   {
    .nbTwiddle=NB_TWIDDLE249,
    .twiddle=twiddle249
-   };
-rfftconfig<float32_t> config250={
+   },
+   /* Length 120 */
+   {
    .nbTwiddle=NB_TWIDDLE250,
    .twiddle=twiddle250
-   };
-rfftconfig<float32_t> config251={
+   },
+   /* Length 128 */
+   {
    .nbTwiddle=NB_TWIDDLE251,
    .twiddle=twiddle251
-   };
-rfftconfig<float32_t> config252={
+   },
+   /* Length 144 */
+   {
    .nbTwiddle=NB_TWIDDLE252,
    .twiddle=twiddle252
-   };
-rfftconfig<float32_t> config253={
+   },
+   /* Length 150 */
+   {
    .nbTwiddle=NB_TWIDDLE253,
    .twiddle=twiddle253
-   };
-rfftconfig<float32_t> config254={
+   },
+   /* Length 160 */
+   {
    .nbTwiddle=NB_TWIDDLE254,
    .twiddle=twiddle254
-   };
-rfftconfig<float32_t> config255={
+   },
+   /* Length 180 */
+   {
    .nbTwiddle=NB_TWIDDLE255,
    .twiddle=twiddle255
-   };
-rfftconfig<float32_t> config256={
+   },
+   /* Length 192 */
+   {
    .nbTwiddle=NB_TWIDDLE256,
    .twiddle=twiddle256
-   };
-
-template<>
-const rfftconfig<float32_t> *rfft_config<float32_t>(uint32_t nbSamples)
-{
-    switch(nbSamples)
-    {
-        case 4:
-            return(&config217);
-        break;
-        case 6:
-            return(&config218);
-        break;
-        case 8:
-            return(&config219);
-        break;
-        case 10:
-            return(&config220);
-        break;
-        case 12:
-            return(&config221);
-        break;
-        case 16:
-            return(&config222);
-        break;
-        case 18:
-            return(&config223);
-        break;
-        case 20:
-            return(&config224);
-        break;
-        case 24:
-            return(&config225);
-        break;
-        case 30:
-            return(&config226);
-        break;
-        case 32:
-            return(&config227);
-        break;
-        case 36:
-            return(&config228);
-        break;
-        case 40:
-            return(&config229);
-        break;
-        case 48:
-            return(&config230);
-        break;
-        case 50:
-            return(&config231);
-        break;
-        case 54:
-            return(&config232);
-        break;
-        case 60:
-            return(&config233);
-        break;
-        case 64:
-            return(&config234);
-        break;
-        case 72:
-            return(&config235);
-        break;
-        case 80:
-            return(&config236);
-        break;
-        case 90:
-            return(&config237);
-        break;
-        case 96:
-            return(&config238);
-        break;
-        case 100:
-            return(&config239);
-        break;
-        case 108:
-            return(&config240);
-        break;
-        case 120:
-            return(&config241);
-        break;
-        case 128:
-            return(&config242);
-        break;
-        case 144:
-            return(&config243);
-        break;
-        case 150:
-            return(&config244);
-        break;
-        case 160:
-            return(&config245);
-        break;
-        case 180:
-            return(&config246);
-        break;
-        case 192:
-            return(&config247);
-        break;
-        case 200:
-            return(&config248);
-        break;
-        case 216:
-            return(&config249);
-        break;
-        case 240:
-            return(&config250);
-        break;
-        case 256:
-            return(&config251);
-        break;
-        case 288:
-            return(&config252);
-        break;
-        case 320:
-            return(&config253);
-        break;
-        case 384:
-            return(&config254);
-        break;
-        case 512:
-            return(&config255);
-        break;
-        case 1024:
-            return(&config256);
-        break;
-
-    }
-    return(NULL);
-}
-
-#if defined(ARM_FLOAT16_SUPPORTED)
-rfftconfig<float16_t> config257={
+   },
+   /* Length 200 */
+   {
    .nbTwiddle=NB_TWIDDLE257,
    .twiddle=twiddle257
-   };
-rfftconfig<float16_t> config258={
+   },
+   /* Length 216 */
+   {
    .nbTwiddle=NB_TWIDDLE258,
    .twiddle=twiddle258
-   };
-rfftconfig<float16_t> config259={
+   },
+   /* Length 240 */
+   {
    .nbTwiddle=NB_TWIDDLE259,
    .twiddle=twiddle259
-   };
-rfftconfig<float16_t> config260={
+   },
+   /* Length 256 */
+   {
    .nbTwiddle=NB_TWIDDLE260,
    .twiddle=twiddle260
-   };
-rfftconfig<float16_t> config261={
+   },
+   /* Length 288 */
+   {
    .nbTwiddle=NB_TWIDDLE261,
    .twiddle=twiddle261
-   };
-rfftconfig<float16_t> config262={
+   },
+   /* Length 320 */
+   {
    .nbTwiddle=NB_TWIDDLE262,
    .twiddle=twiddle262
-   };
-rfftconfig<float16_t> config263={
+   },
+   /* Length 384 */
+   {
    .nbTwiddle=NB_TWIDDLE263,
    .twiddle=twiddle263
-   };
-rfftconfig<float16_t> config264={
+   },
+   /* Length 512 */
+   {
    .nbTwiddle=NB_TWIDDLE264,
    .twiddle=twiddle264
-   };
-rfftconfig<float16_t> config265={
+   },
+   /* Length 1024 */
+   {
    .nbTwiddle=NB_TWIDDLE265,
    .twiddle=twiddle265
-   };
-rfftconfig<float16_t> config266={
+   },
+};
+
+const uint16_t rfftLengthsF32[40]={4,6,8,10,12,16,18,20,24,30,32,36,40,48,50,54,60,64,72,80,90,96,100,108,120,128,144,150,160,180,192,200,216,240,256,288,320,384,512,1024};
+
+
+template<>
+const rfftconfig<float32_t> *rfft_config<float32_t>(uint32_t nbSamples)
+{
+    return(fft_config_search(rfftLengthsF32,rfftConfigsF32,40,nbSamples));
+}
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+const rfftconfig<float16_t> rfftConfigsF16[40]={
+   /* Length 4 */
+   {
    .nbTwiddle=NB_TWIDDLE266,
    .twiddle=twiddle266
-   };
-rfftconfig<float16_t> config267={
+   },
+   /* Length 6 */
+   {
    .nbTwiddle=NB_TWIDDLE267,
    .twiddle=twiddle267
-   };
-rfftconfig<float16_t> config268={
+   },
+   /* Length 8 */
+   {
    .nbTwiddle=NB_TWIDDLE268,
    .twiddle=twiddle268
-   };
-rfftconfig<float16_t> config269={
+   },
+   /* Length 10 */
+   {
    .nbTwiddle=NB_TWIDDLE269,
    .twiddle=twiddle269
-   };
-rfftconfig<float16_t> config270={
+   },
+   /* Length 12 */
+   {
    .nbTwiddle=NB_TWIDDLE270,
    .twiddle=twiddle270
-   };
-rfftconfig<float16_t> config271={
+   },
+   /* Length 16 */
+   {
    .nbTwiddle=NB_TWIDDLE271,
    .twiddle=twiddle271
-   };
-rfftconfig<float16_t> config272={
+   },
+   /* Length 18 */
+   {
    .nbTwiddle=NB_TWIDDLE272,
    .twiddle=twiddle272
-   };
-rfftconfig<float16_t> config273={
+   },
+   /* Length 20 */
+   {
    .nbTwiddle=NB_TWIDDLE273,
    .twiddle=twiddle273
-   };
-rfftconfig<float16_t> config274={
+   },
+   /* Length 24 */
+   {
    .nbTwiddle=NB_TWIDDLE274,
    .twiddle=twiddle274
-   };
-rfftconfig<float16_t> config275={
+   },
+   /* Length 30 */
+   {
    .nbTwiddle=NB_TWIDDLE275,
    .twiddle=twiddle275
-   };
-rfftconfig<float16_t> config276={
+   },
+   /* Length 32 */
+   {
    .nbTwiddle=NB_TWIDDLE276,
    .twiddle=twiddle276
-   };
-rfftconfig<float16_t> config277={
+   },
+   /* Length 36 */
+   {
    .nbTwiddle=NB_TWIDDLE277,
    .twiddle=twiddle277
-   };
-rfftconfig<float16_t> config278={
+   },
+   /* Length 40 */
+   {
    .nbTwiddle=NB_TWIDDLE278,
    .twiddle=twiddle278
-   };
-rfftconfig<float16_t> config279={
+   },
+   /* Length 48 */
+   {
    .nbTwiddle=NB_TWIDDLE279,
    .twiddle=twiddle279
-   };
-rfftconfig<float16_t> config280={
+   },
+   /* Length 50 */
+   {
    .nbTwiddle=NB_TWIDDLE280,
    .twiddle=twiddle280
-   };
-rfftconfig<float16_t> config281={
+   },
+   /* Length 54 */
+   {
    .nbTwiddle=NB_TWIDDLE281,
    .twiddle=twiddle281
-   };
-rfftconfig<float16_t> config282={
+   },
+   /* Length 60 */
+   {
    .nbTwiddle=NB_TWIDDLE282,
    .twiddle=twiddle282
-   };
-rfftconfig<float16_t> config283={
+   },
+   /* Length 64 */
+   {
    .nbTwiddle=NB_TWIDDLE283,
    .twiddle=twiddle283
-   };
-rfftconfig<float16_t> config284={
+   },
+   /* Length 72 */
+   {
    .nbTwiddle=NB_TWIDDLE284,
    .twiddle=twiddle284
-   };
-rfftconfig<float16_t> config285={
+   },
+   /* Length 80 */
+   {
    .nbTwiddle=NB_TWIDDLE285,
    .twiddle=twiddle285
-   };
-rfftconfig<float16_t> config286={
+   },
+   /* Length 90 */
+   {
    .nbTwiddle=NB_TWIDDLE286,
    .twiddle=twiddle286
-   };
-rfftconfig<float16_t> config287={
+   },
+   /* Length 96 */
+   {
    .nbTwiddle=NB_TWIDDLE287,
    .twiddle=twiddle287
-   };
-rfftconfig<float16_t> config288={
+   },
+   /* Length 100 */
+   {
    .nbTwiddle=NB_TWIDDLE288,
    .twiddle=twiddle288
-   };
-rfftconfig<float16_t> config289={
+   },
+   /* Length 108 */
+   {
    .nbTwiddle=NB_TWIDDLE289,
    .twiddle=twiddle289
-   };
-rfftconfig<float16_t> config290={
+   },
+   /* Length 120 */
+   {
    .nbTwiddle=NB_TWIDDLE290,
    .twiddle=twiddle290
-   };
-rfftconfig<float16_t> config291={
+   },
+   /* Length 128 */
+   {
    .nbTwiddle=NB_TWIDDLE291,
    .twiddle=twiddle291
-   };
-rfftconfig<float16_t> config292={
+   },
+   /* Length 144 */
+   {
    .nbTwiddle=NB_TWIDDLE292,
    .twiddle=twiddle292
-   };
-rfftconfig<float16_t> config293={
+   },
+   /* Length 150 */
+   {
    .nbTwiddle=NB_TWIDDLE293,
    .twiddle=twiddle293
-   };
-rfftconfig<float16_t> config294={
+   },
+   /* Length 160 */
+   {
    .nbTwiddle=NB_TWIDDLE294,
    .twiddle=twiddle294
-   };
-rfftconfig<float16_t> config295={
+   },
+   /* Length 180 */
+   {
    .nbTwiddle=NB_TWIDDLE295,
    .twiddle=twiddle295
-   };
-rfftconfig<float16_t> config296={
+   },
+   /* Length 192 */
+   {
    .nbTwiddle=NB_TWIDDLE296,
    .twiddle=twiddle296
-   };
-
-template<>
-const rfftconfig<float16_t> *rfft_config<float16_t>(uint32_t nbSamples)
-{
-    switch(nbSamples)
-    {
-        case 4:
-            return(&config257);
-        break;
-        case 6:
-            return(&config258);
-        break;
-        case 8:
-            return(&config259);
-        break;
-        case 10:
-            return(&config260);
-        break;
-        case 12:
-            return(&config261);
-        break;
-        case 16:
-            return(&config262);
-        break;
-        case 18:
-            return(&config263);
-        break;
-        case 20:
-            return(&config264);
-        break;
-        case 24:
-            return(&config265);
-        break;
-        case 30:
-            return(&config266);
-        break;
-        case 32:
-            return(&config267);
-        break;
-        case 36:
-            return(&config268);
-        break;
-        case 40:
-            return(&config269);
-        break;
-        case 48:
-            return(&config270);
-        break;
-        case 50:
-            return(&config271);
-        break;
-        case 54:
-            return(&config272);
-        break;
-        case 60:
-            return(&config273);
-        break;
-        case 64:
-            return(&config274);
-        break;
-        case 72:
-            return(&config275);
-        break;
-        case 80:
-            return(&config276);
-        break;
-        case 90:
-            return(&config277);
-        break;
-        case 96:
-            return(&config278);
-        break;
-        case 100:
-            return(&config279);
-        break;
-        case 108:
-            return(&config280);
-        break;
-        case 120:
-            return(&config281);
-        break;
-        case 128:
-            return(&config282);
-        break;
-        case 144:
-            return(&config283);
-        break;
-        case 150:
-            return(&config284);
-        break;
-        case 160:
-            return(&config285);
-        break;
-        case 180:
-            return(&config286);
-        break;
-        case 192:
-            return(&config287);
-        break;
-        case 200:
-            return(&config288);
-        break;
-        case 216:
-            return(&config289);
-        break;
-        case 240:
-            return(&config290);
-        break;
-        case 256:
-            return(&config291);
-        break;
-        case 288:
-            return(&config292);
-        break;
-        case 320:
-            return(&config293);
-        break;
-        case 384:
-            return(&config294);
-        break;
-        case 512:
-            return(&config295);
-        break;
-        case 1024:
-            return(&config296);
-        break;
-
-    }
-    return(NULL);
-}
-
-#endif
-
-rfftconfig<Q31> config297={
+   },
+   /* Length 200 */
+   {
    .nbTwiddle=NB_TWIDDLE297,
    .twiddle=twiddle297
-   };
-rfftconfig<Q31> config298={
+   },
+   /* Length 216 */
+   {
    .nbTwiddle=NB_TWIDDLE298,
    .twiddle=twiddle298
-   };
-rfftconfig<Q31> config299={
+   },
+   /* Length 240 */
+   {
    .nbTwiddle=NB_TWIDDLE299,
    .twiddle=twiddle299
-   };
-rfftconfig<Q31> config300={
+   },
+   /* Length 256 */
+   {
    .nbTwiddle=NB_TWIDDLE300,
    .twiddle=twiddle300
-   };
-rfftconfig<Q31> config301={
+   },
+   /* Length 288 */
+   {
    .nbTwiddle=NB_TWIDDLE301,
    .twiddle=twiddle301
-   };
-rfftconfig<Q31> config302={
+   },
+   /* Length 320 */
+   {
    .nbTwiddle=NB_TWIDDLE302,
    .twiddle=twiddle302
-   };
-rfftconfig<Q31> config303={
+   },
+   /* Length 384 */
+   {
    .nbTwiddle=NB_TWIDDLE303,
    .twiddle=twiddle303
-   };
-rfftconfig<Q31> config304={
+   },
+   /* Length 512 */
+   {
    .nbTwiddle=NB_TWIDDLE304,
    .twiddle=twiddle304
-   };
-rfftconfig<Q31> config305={
+   },
+   /* Length 1024 */
+   {
    .nbTwiddle=NB_TWIDDLE305,
    .twiddle=twiddle305
-   };
-rfftconfig<Q31> config306={
+   },
+};
+
+const uint16_t rfftLengthsF16[40]={4,6,8,10,12,16,18,20,24,30,32,36,40,48,50,54,60,64,72,80,90,96,100,108,120,128,144,150,160,180,192,200,216,240,256,288,320,384,512,1024};
+
+
+template<>
+const rfftconfig<float16_t> *rfft_config<float16_t>(uint32_t nbSamples)
+{
+    return(fft_config_search(rfftLengthsF16,rfftConfigsF16,40,nbSamples));
+}
+
+#endif
+
+const rfftconfig<Q31> rfftConfigsQ31[40]={
+   /* Length 4 */
+   {
    .nbTwiddle=NB_TWIDDLE306,
    .twiddle=twiddle306
-   };
-rfftconfig<Q31> config307={
+   },
+   /* Length 6 */
+   {
    .nbTwiddle=NB_TWIDDLE307,
    .twiddle=twiddle307
-   };
-rfftconfig<Q31> config308={
+   },
+   /* Length 8 */
+   {
    .nbTwiddle=NB_TWIDDLE308,
    .twiddle=twiddle308
-   };
-rfftconfig<Q31> config309={
+   },
+   /* Length 10 */
+   {
    .nbTwiddle=NB_TWIDDLE309,
    .twiddle=twiddle309
-   };
-rfftconfig<Q31> config310={
+   },
+   /* Length 12 */
+   {
    .nbTwiddle=NB_TWIDDLE310,
    .twiddle=twiddle310
-   };
-rfftconfig<Q31> config311={
+   },
+   /* Length 16 */
+   {
    .nbTwiddle=NB_TWIDDLE311,
    .twiddle=twiddle311
-   };
-rfftconfig<Q31> config312={
+   },
+   /* Length 18 */
+   {
    .nbTwiddle=NB_TWIDDLE312,
    .twiddle=twiddle312
-   };
-rfftconfig<Q31> config313={
+   },
+   /* Length 20 */
+   {
    .nbTwiddle=NB_TWIDDLE313,
    .twiddle=twiddle313
-   };
-rfftconfig<Q31> config314={
+   },
+   /* Length 24 */
+   {
    .nbTwiddle=NB_TWIDDLE314,
    .twiddle=twiddle314
-   };
-rfftconfig<Q31> config315={
+   },
+   /* Length 30 */
+   {
    .nbTwiddle=NB_TWIDDLE315,
    .twiddle=twiddle315
-   };
-rfftconfig<Q31> config316={
+   },
+   /* Length 32 */
+   {
    .nbTwiddle=NB_TWIDDLE316,
    .twiddle=twiddle316
-   };
-rfftconfig<Q31> config317={
+   },
+   /* Length 36 */
+   {
    .nbTwiddle=NB_TWIDDLE317,
    .twiddle=twiddle317
-   };
-rfftconfig<Q31> config318={
+   },
+   /* Length 40 */
+   {
    .nbTwiddle=NB_TWIDDLE318,
    .twiddle=twiddle318
-   };
-rfftconfig<Q31> config319={
+   },
+   /* Length 48 */
+   {
    .nbTwiddle=NB_TWIDDLE319,
    .twiddle=twiddle319
-   };
-rfftconfig<Q31> config320={
+   },
+   /* Length 50 */
+   {
    .nbTwiddle=NB_TWIDDLE320,
    .twiddle=twiddle320
-   };
-rfftconfig<Q31> config321={
+   },
+   /* Length 54 */
+   {
    .nbTwiddle=NB_TWIDDLE321,
    .twiddle=twiddle321
-   };
-rfftconfig<Q31> config322={
+   },
+   /* Length 60 */
+   {
    .nbTwiddle=NB_TWIDDLE322,
    .twiddle=twiddle322
-   };
-rfftconfig<Q31> config323={
+   },
+   /* Length 64 */
+   {
    .nbTwiddle=NB_TWIDDLE323,
    .twiddle=twiddle323
-   };
-rfftconfig<Q31> config324={
+   },
+   /* Length 72 */
+   {
    .nbTwiddle=NB_TWIDDLE324,
    .twiddle=twiddle324
-   };
-rfftconfig<Q31> config325={
+   },
+   /* Length 80 */
+   {
    .nbTwiddle=NB_TWIDDLE325,
    .twiddle=twiddle325
-   };
-rfftconfig<Q31> config326={
+   },
+   /* Length 90 */
+   {
    .nbTwiddle=NB_TWIDDLE326,
    .twiddle=twiddle326
-   };
-rfftconfig<Q31> config327={
+   },
+   /* Length 96 */
+   {
    .nbTwiddle=NB_TWIDDLE327,
    .twiddle=twiddle327
-   };
-rfftconfig<Q31> config328={
+   },
+   /* Length 100 */
+   {
    .nbTwiddle=NB_TWIDDLE328,
    .twiddle=twiddle328
-   };
-rfftconfig<Q31> config329={
+   },
+   /* Length 108 */
+   {
    .nbTwiddle=NB_TWIDDLE329,
    .twiddle=twiddle329
-   };
-rfftconfig<Q31> config330={
+   },
+   /* Length 120 */
+   {
    .nbTwiddle=NB_TWIDDLE330,
    .twiddle=twiddle330
-   };
-rfftconfig<Q31> config331={
+   },
+   /* Length 128 */
+   {
    .nbTwiddle=NB_TWIDDLE331,
    .twiddle=twiddle331
-   };
-rfftconfig<Q31> config332={
+   },
+   /* Length 144 */
+   {
    .nbTwiddle=NB_TWIDDLE332,
    .twiddle=twiddle332
-   };
-rfftconfig<Q31> config333={
+   },
+   /* Length 150 */
+   {
    .nbTwiddle=NB_TWIDDLE333,
    .twiddle=twiddle333
-   };
-rfftconfig<Q31> config334={
+   },
+   /* Length 160 */
+   {
    .nbTwiddle=NB_TWIDDLE334,
    .twiddle=twiddle334
-   };
-rfftconfig<Q31> config335={
+   },
+   /* Length 180 */
+   {
    .nbTwiddle=NB_TWIDDLE335,
    .twiddle=twiddle335
-   };
-rfftconfig<Q31> config336={
+   },
+   /* Length 192 */
+   {
    .nbTwiddle=NB_TWIDDLE336,
    .twiddle=twiddle336
-   };
-
-template<>
-const rfftconfig<Q31> *rfft_config<Q31>(uint32_t nbSamples)
-{
-    switch(nbSamples)
-    {
-        case 4:
-            return(&config297);
-        break;
-        case 6:
-            return(&config298);
-        break;
-        case 8:
-            return(&config299);
-        break;
-        case 10:
-            return(&config300);
-        break;
-        case 12:
-            return(&config301);
-        break;
-        case 16:
-            return(&config302);
-        break;
-        case 18:
-            return(&config303);
-        break;
-        case 20:
-            return(&config304);
-        break;
-        case 24:
-            return(&config305);
-        break;
-        case 30:
-            return(&config306);
-        break;
-        case 32:
-            return(&config307);
-        break;
-        case 36:
-            return(&config308);
-        break;
-        case 40:
-            return(&config309);
-        break;
-        case 48:
-            return(&config310);
-        break;
-        case 50:
-            return(&config311);
-        break;
-        case 54:
-            return(&config312);
-        break;
-        case 60:
-            return(&config313);
-        break;
-        case 64:
-            return(&config314);
-        break;
-        case 72:
-            return(&config315);
-        break;
-        case 80:
-            return(&config316);
-        break;
-        case 90:
-            return(&config317);
-        break;
-        case 96:
-            return(&config318);
-        break;
-        case 100:
-            return(&config319);
-        break;
-        case 108:
-            return(&config320);
-        break;
-        case 120:
-            return(&config321);
-        break;
-        case 128:
-            return(&config322);
-        break;
-        case 144:
-            return(&config323);
-        break;
-        case 150:
-            return(&config324);
-        break;
-        case 160:
-            return(&config325);
-        break;
-        case 180:
-            return(&config326);
-        break;
-        case 192:
-            return(&config327);
-        break;
-        case 200:
-            return(&config328);
-        break;
-        case 216:
-            return(&config329);
-        break;
-        case 240:
-            return(&config330);
-        break;
-        case 256:
-            return(&config331);
-        break;
-        case 288:
-            return(&config332);
-        break;
-        case 320:
-            return(&config333);
-        break;
-        case 384:
-            return(&config334);
-        break;
-        case 512:
-            return(&config335);
-        break;
-        case 1024:
-            return(&config336);
-        break;
-
-    }
-    return(NULL);
-}
-
-rfftconfig<Q15> config337={
+   },
+   /* Length 200 */
+   {
    .nbTwiddle=NB_TWIDDLE337,
    .twiddle=twiddle337
-   };
-rfftconfig<Q15> config338={
+   },
+   /* Length 216 */
+   {
    .nbTwiddle=NB_TWIDDLE338,
    .twiddle=twiddle338
-   };
-rfftconfig<Q15> config339={
+   },
+   /* Length 240 */
+   {
    .nbTwiddle=NB_TWIDDLE339,
    .twiddle=twiddle339
-   };
-rfftconfig<Q15> config340={
+   },
+   /* Length 256 */
+   {
    .nbTwiddle=NB_TWIDDLE340,
    .twiddle=twiddle340
-   };
-rfftconfig<Q15> config341={
+   },
+   /* Length 288 */
+   {
    .nbTwiddle=NB_TWIDDLE341,
    .twiddle=twiddle341
-   };
-rfftconfig<Q15> config342={
+   },
+   /* Length 320 */
+   {
    .nbTwiddle=NB_TWIDDLE342,
    .twiddle=twiddle342
-   };
-rfftconfig<Q15> config343={
+   },
+   /* Length 384 */
+   {
    .nbTwiddle=NB_TWIDDLE343,
    .twiddle=twiddle343
-   };
-rfftconfig<Q15> config344={
+   },
+   /* Length 512 */
+   {
    .nbTwiddle=NB_TWIDDLE344,
    .twiddle=twiddle344
-   };
-rfftconfig<Q15> config345={
+   },
+   /* Length 1024 */
+   {
    .nbTwiddle=NB_TWIDDLE345,
    .twiddle=twiddle345
-   };
-rfftconfig<Q15> config346={
+   },
+};
+
+const uint16_t rfftLengthsQ31[40]={4,6,8,10,12,16,18,20,24,30,32,36,40,48,50,54,60,64,72,80,90,96,100,108,120,128,144,150,160,180,192,200,216,240,256,288,320,384,512,1024};
+
+
+template<>
+const rfftconfig<Q31> *rfft_config<Q31>(uint32_t nbSamples)
+{
+    return(fft_config_search(rfftLengthsQ31,rfftConfigsQ31,40,nbSamples));
+}
+
+const rfftconfig<Q15> rfftConfigsQ15[40]={
+   /* Length 4 */
+   {
    .nbTwiddle=NB_TWIDDLE346,
    .twiddle=twiddle346
-   };
-rfftconfig<Q15> config347={
+   },
+   /* Length 6 */
+   {
    .nbTwiddle=NB_TWIDDLE347,
    .twiddle=twiddle347
-   };
-rfftconfig<Q15> config348={
+   },
+   /* Length 8 */
+   {
    .nbTwiddle=NB_TWIDDLE348,
    .twiddle=twiddle348
-   };
-rfftconfig<Q15> config349={
+   },
+   /* Length 10 */
+   {
    .nbTwiddle=NB_TWIDDLE349,
    .twiddle=twiddle349
-   };
-rfftconfig<Q15> config350={
+   },
+   /* Length 12 */
+   {
    .nbTwiddle=NB_TWIDDLE350,
    .twiddle=twiddle350
-   };
-rfftconfig<Q15> config351={
+   },
+   /* Length 16 */
+   {
    .nbTwiddle=NB_TWIDDLE351,
    .twiddle=twiddle351
-   };
-rfftconfig<Q15> config352={
+   },
+   /* Length 18 */
+   {
    .nbTwiddle=NB_TWIDDLE352,
    .twiddle=twiddle352
-   };
-rfftconfig<Q15> config353={
+   },
+   /* Length 20 */
+   {
    .nbTwiddle=NB_TWIDDLE353,
    .twiddle=twiddle353
-   };
-rfftconfig<Q15> config354={
+   },
+   /* Length 24 */
+   {
    .nbTwiddle=NB_TWIDDLE354,
    .twiddle=twiddle354
-   };
-rfftconfig<Q15> config355={
+   },
+   /* Length 30 */
+   {
    .nbTwiddle=NB_TWIDDLE355,
    .twiddle=twiddle355
-   };
-rfftconfig<Q15> config356={
+   },
+   /* Length 32 */
+   {
    .nbTwiddle=NB_TWIDDLE356,
    .twiddle=twiddle356
-   };
-rfftconfig<Q15> config357={
+   },
+   /* Length 36 */
+   {
    .nbTwiddle=NB_TWIDDLE357,
    .twiddle=twiddle357
-   };
-rfftconfig<Q15> config358={
+   },
+   /* Length 40 */
+   {
    .nbTwiddle=NB_TWIDDLE358,
    .twiddle=twiddle358
-   };
-rfftconfig<Q15> config359={
+   },
+   /* Length 48 */
+   {
    .nbTwiddle=NB_TWIDDLE359,
    .twiddle=twiddle359
-   };
-rfftconfig<Q15> config360={
+   },
+   /* Length 50 */
+   {
    .nbTwiddle=NB_TWIDDLE360,
    .twiddle=twiddle360
-   };
-rfftconfig<Q15> config361={
+   },
+   /* Length 54 */
+   {
    .nbTwiddle=NB_TWIDDLE361,
    .twiddle=twiddle361
-   };
-rfftconfig<Q15> config362={
+   },
+   /* Length 60 */
+   {
    .nbTwiddle=NB_TWIDDLE362,
    .twiddle=twiddle362
-   };
-rfftconfig<Q15> config363={
+   },
+   /* Length 64 */
+   {
    .nbTwiddle=NB_TWIDDLE363,
    .twiddle=twiddle363
-   };
-rfftconfig<Q15> config364={
+   },
+   /* Length 72 */
+   {
    .nbTwiddle=NB_TWIDDLE364,
    .twiddle=twiddle364
-   };
-rfftconfig<Q15> config365={
+   },
+   /* Length 80 */
+   {
    .nbTwiddle=NB_TWIDDLE365,
    .twiddle=twiddle365
-   };
-rfftconfig<Q15> config366={
+   },
+   /* Length 90 */
+   {
    .nbTwiddle=NB_TWIDDLE366,
    .twiddle=twiddle366
-   };
-rfftconfig<Q15> config367={
+   },
+   /* Length 96 */
+   {
    .nbTwiddle=NB_TWIDDLE367,
    .twiddle=twiddle367
-   };
-rfftconfig<Q15> config368={
+   },
+   /* Length 100 */
+   {
    .nbTwiddle=NB_TWIDDLE368,
    .twiddle=twiddle368
-   };
-rfftconfig<Q15> config369={
+   },
+   /* Length 108 */
+   {
    .nbTwiddle=NB_TWIDDLE369,
    .twiddle=twiddle369
-   };
-rfftconfig<Q15> config370={
+   },
+   /* Length 120 */
+   {
    .nbTwiddle=NB_TWIDDLE370,
    .twiddle=twiddle370
-   };
-rfftconfig<Q15> config371={
+   },
+   /* Length 128 */
+   {
    .nbTwiddle=NB_TWIDDLE371,
    .twiddle=twiddle371
-   };
-rfftconfig<Q15> config372={
+   },
+   /* Length 144 */
+   {
    .nbTwiddle=NB_TWIDDLE372,
    .twiddle=twiddle372
-   };
-rfftconfig<Q15> config373={
+   },
+   /* Length 150 */
+   {
    .nbTwiddle=NB_TWIDDLE373,
    .twiddle=twiddle373
-   };
-rfftconfig<Q15> config374={
+   },
+   /* Length 160 */
+   {
    .nbTwiddle=NB_TWIDDLE374,
    .twiddle=twiddle374
-   };
-rfftconfig<Q15> config375={
+   },
+   /* Length 180 */
+   {
    .nbTwiddle=NB_TWIDDLE375,
    .twiddle=twiddle375
-   };
-rfftconfig<Q15> config376={
+   },
+   /* Length 192 */
+   {
    .nbTwiddle=NB_TWIDDLE376,
    .twiddle=twiddle376
-   };
+   },
+   /* Length 200 */
+   {
+   .nbTwiddle=NB_TWIDDLE377,
+   .twiddle=twiddle377
+   },
+   /* Length 216 */
+   {
+   .nbTwiddle=NB_TWIDDLE378,
+   .twiddle=twiddle378
+   },
+   /* Length 240 */
+   {
+   .nbTwiddle=NB_TWIDDLE379,
+   .twiddle=twiddle379
+   },
+   /* Length 256 */
+   {
+   .nbTwiddle=NB_TWIDDLE380,
+   .twiddle=twiddle380
+   },
+   /* Length 288 */
+   {
+   .nbTwiddle=NB_TWIDDLE381,
+   .twiddle=twiddle381
+   },
+   /* Length 320 */
+   {
+   .nbTwiddle=NB_TWIDDLE382,
+   .twiddle=twiddle382
+   },
+   /* Length 384 */
+   {
+   .nbTwiddle=NB_TWIDDLE383,
+   .twiddle=twiddle383
+   },
+   /* Length 512 */
+   {
+   .nbTwiddle=NB_TWIDDLE384,
+   .twiddle=twiddle384
+   },
+   /* Length 1024 */
+   {
+   .nbTwiddle=NB_TWIDDLE385,
+   .twiddle=twiddle385
+   },
+};
+
+const uint16_t rfftLengthsQ15[40]={4,6,8,10,12,16,18,20,24,30,32,36,40,48,50,54,60,64,72,80,90,96,100,108,120,128,144,150,160,180,192,200,216,240,256,288,320,384,512,1024};
+
 
 template<>
 const rfftconfig<Q15> *rfft_config<Q15>(uint32_t nbSamples)
 {
-    switch(nbSamples)
+    return(fft_config_search(rfftLengthsQ15,rfftConfigsQ15,40,nbSamples));
+}
+
+const uint16_t mfccFilterPos1[40]={1,3,4,6,7,9,11,13,16,18,20,23,26,29,32,35,39,43,47,51,56,61,66,71,77,83,90,97,104,112,121,130,139,149,160,171,184,196,210,225};
+
+const uint16_t mfccFilterLengths1[40]={3,3,3,3,4,4,5,5,4,5,6,6,6,6,7,8,8,8,9,10,10,10,11,12,13,14,14,15,17,18,18,19,21,22,24,25,26,29,30,31};
+
+__ALIGNED(8) const float32_t mfccFilterCoefs1[492]={
+0.25510263125962129305f, 0.94364619530879056963f, 0.39547018415119017387f, 
+0.60452981584880982613f, 0.76010977494786458042f, 0.14837425870003409512f, 
+0.23989022505213547509f, 0.85162574129996593264f, 0.55856952985512153820f, 
+0.44143047014487846180f, 0.98917741574276818461f, 0.43883212861438980479f, 
+0.01082258425723181018f, 0.56116787138561019521f, 0.90630053021148049286f, 
+0.39046549131673224942f, 0.09369946978851956265f, 0.60953450868326775058f, 
+0.89031178151718004532f, 0.40491404110383355519f, 0.10968821848281992692f, 
+0.59508595889616644481f, 0.93342647695900515803f, 0.47507399415692930233f, 
+0.02914452971904925305f, 0.06657352304099488360f, 0.52492600584307069767f, 
+0.97085547028095076083f, 0.59498239812506659163f, 0.17198249245950267272f, 
+0.40501760187493340837f, 0.82801750754049729952f, 0.75958521247559918077f, 
+0.35727201289817056562f, 0.24041478752440087474f, 0.64272798710182943438f, 
+0.96456148311637157633f, 0.58100588392084440148f, 0.20618807879862779964f, 
+0.03543851688362836816f, 0.41899411607915554301f, 0.79381192120137222812f, 
+0.83971880704458423672f, 0.48123425399421504434f, 0.13039388035574323021f, 
+0.16028119295541576328f, 0.51876574600578495566f, 0.86960611964425682530f, 
+0.78687847817772593739f, 0.45038842563676489972f, 0.12064211673328052721f, 
+0.21312152182227409036f, 0.54961157436323504477f, 0.87935788326671948667f, 
+0.79737454527244133740f, 0.48033602528976948598f, 0.16929103244220844449f, 
+0.20262545472755866260f, 0.51966397471023051402f, 0.83070896755779155551f, 
+0.86401715289625113936f, 0.56430412796242079843f, 0.26995298419711294402f, 
+0.13598284710374883288f, 0.43569587203757925709f, 0.73004701580288700047f, 
+0.98077523995783277844f, 0.69659218048762105990f, 0.41723419454659071981f, 
+0.14254016642451231012f, 0.01922476004216718340f, 0.30340781951237888459f, 
+0.58276580545340928019f, 0.85745983357548771764f, 0.87235691787729718882f, 
+0.60653869514744496172f, 0.34494669676722017337f, 0.08744863831471852422f, 
+0.12764308212270275567f, 0.39346130485255503828f, 0.65505330323277977111f, 
+0.91255136168528150353f, 0.83391835070587205792f, 0.58423540896879833095f, 
+0.33828478876612849691f, 0.09595654821311445926f, 0.16608164929412796984f, 
+0.41576459103120166905f, 0.66171521123387155860f, 0.90404345178688549911f, 
+0.85714553278839311634f, 0.62175110135492639429f, 0.38967687150446200794f, 
+0.16083048261278831692f, 0.14285446721160691141f, 0.37824889864507360571f, 
+0.61032312849553793654f, 0.83916951738721168308f, 0.93512337514788423931f, 
+0.71247058491135439873f, 0.49279055101658847393f, 0.27600493651777069370f, 
+0.06203846070255354672f, 0.06487662485211570518f, 0.28752941508864554576f, 
+0.50720944898341147056f, 0.72399506348222930630f, 0.93796153929744641164f, 
+0.85081874214982899929f, 0.64227615173403984627f, 0.43634367482894004242f, 
+0.23295678202848885130f, 0.03205330776081887628f, 0.14918125785017100071f, 
+0.35772384826596015373f, 0.56365632517105990207f, 0.76704321797151120421f, 
+0.96794669223918117229f, 0.83357333622404394813f, 0.63745909412013568307f, 
+0.44365484970648244589f, 0.25210681772379123222f, 0.06276306979455575918f, 
+0.16642666377595602412f, 0.36254090587986431693f, 0.55634515029351749860f, 
+0.74789318227620882329f, 0.93723693020544418530f, 0.87557344991862651185f, 
+0.69048949472194354193f, 0.50746435814100310235f, 0.32645274025045961652f, 
+0.14741081996314200908f, 0.12442655008137351591f, 0.30951050527805645807f, 
+0.49253564185899684214f, 0.67354725974954043899f, 0.85258918003685801867f, 
+0.97029619135251832240f, 0.79506780336606708293f, 0.62168590271509449607f, 
+0.45011197974239580688f, 0.28030871708320947988f, 0.11223994094834681412f, 
+0.02970380864748162208f, 0.20493219663393291707f, 0.37831409728490544842f, 
+0.54988802025760419312f, 0.71969128291679052012f, 0.88776005905165322751f, 
+0.94587057487039705173f, 0.78116659576503666429f, 0.61809499216981511616f, 
+0.45662372453213351253f, 0.29672168742696736210f, 0.13835867359293804735f, 
+0.05412942512960289276f, 0.21883340423496330795f, 0.38190500783018488384f, 
+0.54337627546786648747f, 0.70327831257303263790f, 0.86164132640706192490f, 
+0.98150533968254261019f, 0.82613317362966243174f, 0.67221446354338887375f, 
+0.51972226804334620276f, 0.36863038795708602535f, 0.21891333930522918760f, 
+0.07054632750460339274f, 0.01849466031745743144f, 0.17386682637033756826f, 
+0.32778553645661112625f, 0.48027773195665374173f, 0.63136961204291397465f, 
+0.78108666069477084015f, 0.92945367249539656562f, 0.92350522272409496516f, 
+0.77776653633200354410f, 0.63330739837729987940f, 0.49010553605089929308f, 
+0.34813925307613258209f, 0.20738740998076271582f, 0.06782940520569009923f, 
+0.07649477727590499321f, 0.22223346366799651141f, 0.36669260162270017611f, 
+0.50989446394910065141f, 0.65186074692386741791f, 0.79261259001923733969f, 
+0.93217059479430985913f, 0.92944515700805530045f, 0.79221508611910551600f, 
+0.65612009911922863914f, 0.52114157249497761182f, 0.38726133734468226599f, 
+0.25446166470132236537f, 0.12272525144297552480f, 0.07055484299194468567f, 
+0.20778491388089448400f, 0.34387990088077136086f, 0.47885842750502238818f, 
+0.61273866265531773401f, 0.74553833529867763463f, 0.87727474855702447520f, 
+0.99203520676280854129f, 0.86237503917220525995f, 0.73372864401200332818f, 
+0.60608029144815023237f, 0.47941461492948861389f, 0.35371660008635069650f, 
+0.22897157405008816689f, 0.10516519517437603048f, 0.00796479323719150034f, 
+0.13762496082779476780f, 0.26627135598799661631f, 0.39391970855184971212f, 
+0.52058538507051144162f, 0.64628339991364924799f, 0.77102842594991183311f, 
+0.89483480482562394176f, 0.98228344314034587992f, 0.86031260942850529272f, 
+0.73923928814122008557f, 0.61905036716036176969f, 0.49973301962561822442f, 
+0.38127469571953370719f, 0.26366311474616710431f, 0.14688625749087289019f, 
+0.03093235884927555968f, 0.01771655685965413049f, 0.13968739057149467953f, 
+0.26076071185877991443f, 0.38094963283963828582f, 0.50026698037438177558f, 
+0.61872530428046634832f, 0.73633688525383289569f, 0.85311374250912708206f, 
+0.96906764115072441257f, 0.91578990071414134722f, 0.80144760510950630028f, 
+0.68789442756158813985f, 0.57511955069700315679f, 0.46311237805880633989f, 
+0.35186252813164581310f, 0.24135982856753127046f, 0.13159431060417778325f, 
+0.02255620366838946220f, 0.08421009928585866666f, 0.19855239489049369972f, 
+0.31210557243841180464f, 0.42488044930299689872f, 0.53688762194119366011f, 
+0.64813747186835413139f, 0.75864017143246875730f, 0.86840568939582218899f, 
+0.97744379633161049270f, 0.91423593015698023656f, 0.80662410038844711835f, 
+0.69971150771859691453f, 0.59348912381390572790f, 0.48794809407642397714f, 
+0.38307973321447014170f, 0.27887552095365603089f, 0.17532709788279315921f, 
+0.07242626142974059600f, 0.08576406984301973568f, 0.19337589961155285390f, 
+0.30028849228140308547f, 0.40651087618609427210f, 0.51205190592357607837f, 
+0.61692026678552991381f, 0.72112447904634402462f, 0.82467290211720678528f, 
+0.92757373857025937625f, 0.97016496196228729776f, 0.86853529900948933662f, 
+0.76752951759894538775f, 0.66714000470582368596f, 0.56735928580960115486f, 
+0.46818002155450694213f, 0.36959500451008403532f, 0.27159715602817741109f, 
+0.17417952319300347708f, 0.07733527586090778450f, 0.02983503803771265714f, 
+0.13146470099051069114f, 0.23247048240105461225f, 0.33285999529417636955f, 
+0.43264071419039890065f, 0.53181997844549300236f, 0.63040499548991590917f, 
+0.72840284397182264442f, 0.82582047680699655068f, 0.92266472413909217387f, 
+0.98105770378684942212f, 0.88534021383434002850f, 0.79017632726616748862f, 
+0.69555967711293731348f, 0.60148400561693504685f, 0.50794316174855480561f, 
+0.41493109879299566733f, 0.32244187200473173327f, 0.23046963632760927854f, 
+0.13900864417820829599f, 0.04805324329059017935f, 0.01894229621315055706f, 
+0.11465978616565995762f, 0.20982367273383251138f, 0.30444032288706268652f, 
+0.39851599438306489764f, 0.49205683825144519439f, 0.58506890120700438818f, 
+0.67755812799526826673f, 0.76953036367239069371f, 0.86099135582179175952f, 
+0.95194675670940986922f, 0.95759787462017975646f, 0.86763707030504289008f, 
+0.77816545168252138076f, 0.68917772735954530017f, 0.60066869133483002940f, 
+0.51263322117131893130f, 0.42506627621727027799f, 0.33796289587436983970f, 
+0.25131819791152731902f, 0.16512737682279618467f, 0.07938570222807016241f, 
+0.04240212537982026436f, 0.13236292969495713767f, 0.22183454831747861924f, 
+0.31082227264045475534f, 0.39933130866516997060f, 0.48736677882868106870f, 
+0.57493372378272966650f, 0.66203710412563010479f, 0.74868180208847268098f, 
+0.83487262317720378757f, 0.92061429777192982371f, 0.99408851731523395490f, 
+0.90923123732252086882f, 0.82480934805979588820f, 0.74081840446752234008f, 
+0.65725402921239006737f, 0.57411191131842298496f, 0.49138780483243788000f, 
+0.40907752752297071863f, 0.32717695961148307582f, 0.24568204253509068336f, 
+0.16458877773973273895f, 0.08389322550289866898f, 0.00359150378518193272f, 
+0.00591148268476608153f, 0.09076876267747918670f, 0.17519065194020416731f, 
+0.25918159553247765992f, 0.34274597078760993263f, 0.42588808868157695953f, 
+0.50861219516756206449f, 0.59092247247702922586f, 0.67282304038851692418f, 
+0.75431795746490937216f, 0.83541122226026720554f, 0.91610677449710131715f, 
+0.99640849621481808462f, 0.92367978710961884392f, 0.84415430546818126523f, 
+0.76501134325452757601f, 0.68624723822232003290f, 0.60785838046836082604f, 
+0.52984121143978657464f, 0.45219222296479338885f, 0.37490795630599410559f, 
+0.29798500123601012746f, 0.22141999513450780213f, 0.14520962210620114163f, 
+0.06935061211911722201f, 0.07632021289038116996f, 0.15584569453181870702f, 
+0.23498865674547247950f, 0.31375276177767996710f, 0.39214161953163917396f, 
+0.47015878856021342536f, 0.54780777703520666666f, 0.62509204369400594992f, 
+0.70201499876398987254f, 0.77858000486549217012f, 0.85479037789379885837f, 
+0.93064938788088280575f, 0.99383974016271925400f, 0.91867382542515052535f, 
+0.84384973048932654383f, 0.76936436054707313392f, 0.69521466263110920369f, 
+0.62139762486414706899f, 0.54791027572483419483f, 0.47474968332999611942f, 
+0.40191295473271204663f, 0.32939723523598035682f, 0.25719970772128142311f, 
+0.18531759199197961330f, 0.11374814413085980458f, 0.04248865587164577656f, 
+0.00616025983728075727f, 0.08132617457484951629f, 0.15615026951067342842f, 
+0.23063563945292689383f, 0.30478533736889074079f, 0.37860237513585298652f, 
+0.45208972427516580517f, 0.52525031667000388058f, 0.59808704526728795337f, 
+0.67060276476401969870f, 0.74280029227871857689f, 0.81468240800802038670f, 
+0.88625185586914023705f, 0.95751134412835425813f, 0.97153645398407595390f, 
+0.90088889967215768362f, 0.83054338798526849974f, 0.76049734724185824586f, 
+0.69074823846529420646f, 0.62129355483161730067f, 0.55213082112900879750f, 
+0.48325759322839201282f, 0.41467145756525991551f, 0.34637003063209259590f, 
+0.27835095848139068675f, 0.21061191623884004120f, 0.14315060762655454352f, 
+0.07596476449594603830f, 0.00905214637020064841f, 0.02846354601592407385f, 
+0.09911110032784234414f, 0.16945661201473152802f, 0.23950265275814178190f, 
+0.30925176153470573803f, 0.37870644516838269933f, 0.44786917887099120250f, 
+0.51674240677160798718f, 0.58532854243474008449f, 0.65362996936790740410f, 
+0.72164904151860931325f, 0.78938808376115998655f, 0.85684939237344548424f, 
+0.92403523550405397557f, 0.99094785362979931342f, 0.94241053999594404100f, 
+0.87603775890395552128f, 0.80993164297876563129f, 0.74409005803678507363f, 
+0.67851089541289777429f, 0.61319207155526112007f, 0.54813152762806593987f, 
+0.48332722912215647648f, 0.41877716547331383934f, 0.35447934968793326505f, 
+0.29043181797603273564f, 0.22663262939136455398f, 0.16307986547849814829f, 
+0.09977162992662867713f, 0.03670604823011733298f, 0.05758946000405599369f, 
+0.12396224109604450647f, 0.19006835702123434095f, 0.25590994196321498189f, 
+0.32148910458710222571f, 0.38680792844473882441f, 0.45186847237193411564f, 
+0.51667277087784346801f, 0.58122283452668621617f, 0.64552065031206673495f, 
+0.70956818202396720885f, 0.77336737060863547377f, 0.83692013452150182395f, 
+0.90022837007337130899f, 0.96329395176988263927f, 0.97388126735540547774f, 
+0.91129545541436185463f, 0.84894680134373179392f, 0.78683351459071326772f, 
+0.72495382480442305262f, 0.66330598153304487496f, 0.60188825392684797144f, 
+0.54069893044649530722f, 0.47973631857688370239f, 0.41899874454622804132f, 
+0.35848455305037085772f, 0.29819210698203779675f, 0.23811978716510606713f, 
+0.17826599209370563859f, 0.11862913767602140114f, 0.05920765698272927730f, 
+};
+
+__ALIGNED(8) const float32_t mfccDct1[520]={
+0.15811388300841894283f, 0.15811388300841894283f, 0.15811388300841894283f, 
+0.15811388300841894283f, 0.15811388300841894283f, 0.15811388300841894283f, 
+0.15811388300841894283f, 0.15811388300841894283f, 0.15811388300841894283f, 
+0.15811388300841894283f, 0.15811388300841894283f, 0.15811388300841894283f, 
+0.15811388300841894283f, 0.15811388300841894283f, 0.15811388300841894283f, 
+0.15811388300841894283f, 0.15811388300841894283f, 0.15811388300841894283f, 
+0.15811388300841894283f, 0.15811388300841894283f, 0.15811388300841894283f, 
+0.15811388300841894283f, 0.15811388300841894283f, 0.15811388300841894283f, 
+0.15811388300841894283f, 0.15811388300841894283f, 0.15811388300841894283f, 
+0.15811388300841894283f, 0.15811388300841894283f, 0.15811388300841894283f, 
+0.15811388300841894283f, 0.15811388300841894283f, 0.15811388300841894283f, 
+0.15811388300841894283f, 0.15811388300841894283f, 0.15811388300841894283f, 
+0.15811388300841894283f, 0.15811388300841894283f, 0.15811388300841894283f, 
+0.15811388300841894283f, 0.22343440501258571285f, 0.22205685760620388902f, 
+0.21931025583128155310f, 0.21521153340109888674f, 0.20978596030240148629f, 
+0.20306698699752892545f, 0.19509603819119117341f, 0.18592225743338866573f, 
+0.17560220413308494369f, 0.16419950485064235823f, 0.15178446101891945874f, 
+0.13843361551155980438f, 0.12422928073072289634f, 0.10925903112375323634f, 
+0.09361516325759096369f, 0.07739412677974490118f, 0.06069592977414297458f, 
+0.04362352217803867893f, 0.02628216106141360517f, 0.00877876168213950411f, 
+-0.00877876168213942779f, -0.02628216106141357741f, -0.04362352217803864424f, 
+-0.06069592977414295376f, -0.07739412677974492893f, -0.09361516325759089430f, 
+-0.10925903112375318083f, -0.12422928073072281308f, -0.13843361551155980438f, 
+-0.15178446101891945874f, -0.16419950485064230272f, -0.17560220413308488818f, 
+-0.18592225743338866573f, -0.19509603819119117341f, -0.20306698699752895321f, 
+-0.20978596030240145853f, -0.21521153340109885899f, -0.21931025583128155310f, 
+-0.22205685760620388902f, -0.22343440501258571285f, 0.22291749261751181432f, 
+0.21742852412852639588f, 0.20658574377159641400f, 0.19065613678423432020f, 
+0.17003194295780357792f, 0.14522099839208590932f, 0.11683423088509348187f, 
+0.08557061686312839033f, 0.05219997026139770735f, 0.01754398715006247680f, 
+-0.01754398715006244905f, -0.05219997026139762408f, -0.08557061686312837645f, 
+-0.11683423088509345411f, -0.14522099839208590932f, -0.17003194295780357792f, 
+-0.19065613678423432020f, -0.20658574377159641400f, -0.21742852412852639588f, 
+-0.22291749261751181432f, -0.22291749261751184208f, -0.21742852412852642363f, 
+-0.20658574377159644175f, -0.19065613678423434796f, -0.17003194295780352241f, 
+-0.14522099839208604810f, -0.11683423088509357901f, -0.08557061686312851523f, 
+-0.05219997026139763102f, -0.01754398715006240395f, 0.01754398715006232415f, 
+0.05219997026139754775f, 0.08557061686312843196f, 0.11683423088509350962f, 
+0.14522099839208599259f, 0.17003194295780346690f, 0.19065613678423423694f, 
+0.20658574377159635849f, 0.21742852412852642363f, 0.22291749261751181432f, 
+0.22205685760620388902f, 0.20978596030240148629f, 0.18592225743338866573f, 
+0.15178446101891945874f, 0.10925903112375323634f, 0.06069592977414297458f, 
+0.00877876168213950411f, -0.04362352217803864424f, -0.09361516325759089430f, 
+-0.13843361551155972111f, -0.17560220413308497145f, -0.20306698699752889770f, 
+-0.21931025583128155310f, -0.22343440501258571285f, -0.21521153340109891450f, 
+-0.19509603819119114565f, -0.16419950485064241374f, -0.12422928073072286859f, 
+-0.07739412677974498445f, -0.02628216106141358435f, 0.02628216106141350455f, 
+0.07739412677974490118f, 0.12422928073072279920f, 0.16419950485064235823f, 
+0.19509603819119120116f, 0.21521153340109883123f, 0.22343440501258571285f, 
+0.21931025583128155310f, 0.20306698699752898096f, 0.17560220413308494369f, 
+0.13843361551155985989f, 0.09361516325759096369f, 0.04362352217803877608f, 
+-0.00877876168213947289f, -0.06069592977414284274f, -0.10925903112375304205f, 
+-0.15178446101891948650f, -0.18592225743338863797f, -0.20978596030240143078f, 
+-0.22205685760620391678f, 0.22085382701546929507f, 0.19923511564810011953f, 
+0.15811388300841897059f, 0.10151536185567272552f, 0.03497980978537706953f, 
+-0.03497980978537709729f, -0.10151536185567269777f, -0.15811388300841894283f, 
+-0.19923511564810009178f, -0.22085382701546929507f, -0.22085382701546929507f, 
+-0.19923511564810017505f, -0.15811388300841899834f, -0.10151536185567273940f, 
+-0.03497980978537709729f, 0.03497980978537701402f, 0.10151536185567268389f, 
+0.15811388300841891508f, 0.19923511564810009178f, 0.22085382701546929507f, 
+0.22085382701546932283f, 0.19923511564810014729f, 0.15811388300841899834f, 
+0.10151536185567276716f, 0.03497980978537693075f, -0.03497980978537679198f, 
+-0.10151536185567247572f, -0.15811388300841877630f, -0.19923511564810017505f, 
+-0.22085382701546929507f, -0.22085382701546932283f, -0.19923511564810023056f, 
+-0.15811388300841888732f, -0.10151536185567261450f, -0.03497980978537695157f, 
+0.03497980978537676422f, 0.10151536185567244797f, 0.15811388300841874854f, 
+0.19923511564810014729f, 0.22085382701546929507f, 0.21931025583128155310f, 
+0.18592225743338866573f, 0.12422928073072289634f, 0.04362352217803867893f, 
+-0.04362352217803864424f, -0.12422928073072289634f, -0.18592225743338866573f, 
+-0.21931025583128155310f, -0.21931025583128158085f, -0.18592225743338869348f, 
+-0.12422928073072286859f, -0.04362352217803874832f, 0.04362352217803867199f, 
+0.12422928073072296573f, 0.18592225743338866573f, 0.21931025583128152534f, 
+0.21931025583128160861f, 0.18592225743338869348f, 0.12422928073072289634f, 
+0.04362352217803877608f, -0.04362352217803844301f, -0.12422928073072277144f, 
+-0.18592225743338863797f, -0.21931025583128158085f, -0.21931025583128152534f, 
+-0.18592225743338872124f, -0.12422928073072292410f, -0.04362352217803860954f, 
+0.04362352217803881077f, 0.12422928073072309063f, 0.18592225743338841593f, 
+0.21931025583128146983f, 0.21931025583128160861f, 0.18592225743338874899f, 
+0.12422928073072293798f, 0.04362352217803902588f, -0.04362352217803838750f, 
+-0.12422928073072271593f, -0.18592225743338861021f, -0.21931025583128155310f, 
+0.21742852412852639588f, 0.17003194295780357792f, 0.08557061686312839033f, 
+-0.01754398715006244905f, -0.11683423088509345411f, -0.19065613678423432020f, 
+-0.22291749261751181432f, -0.20658574377159644175f, -0.14522099839208604810f, 
+-0.05219997026139782531f, 0.05219997026139774898f, 0.14522099839208582606f, 
+0.20658574377159635849f, 0.22291749261751181432f, 0.19065613678423440347f, 
+0.11683423088509342636f, 0.01754398715006262946f, -0.08557061686312840421f, 
+-0.17003194295780346690f, -0.21742852412852642363f, -0.21742852412852645139f, 
+-0.17003194295780357792f, -0.08557061686312855686f, 0.01754398715006246640f, 
+0.11683423088509363452f, 0.19065613678423412591f, 0.22291749261751181432f, 
+0.20658574377159641400f, 0.14522099839208610361f, 0.05219997026139771429f, 
+-0.05219997026139747837f, -0.14522099839208590932f, -0.20658574377159633073f, 
+-0.22291749261751181432f, -0.19065613678423443123f, -0.11683423088509385657f, 
+-0.01754398715006231721f, 0.08557061686312833482f, 0.17003194295780341139f, 
+0.21742852412852650690f, 0.21521153340109888674f, 0.15178446101891945874f, 
+0.04362352217803867893f, -0.07739412677974483179f, -0.17560220413308497145f, 
+-0.22205685760620388902f, -0.20306698699752892545f, -0.12422928073072286859f, 
+-0.00877876168213958218f, 0.10925903112375305593f, 0.19509603819119120116f, 
+0.22343440501258574060f, 0.18592225743338869348f, 0.09361516325759096369f, 
+-0.02628216106141347680f, -0.13843361551155974887f, -0.20978596030240143078f, 
+-0.21931025583128160861f, -0.16419950485064230272f, -0.06069592977414300233f, 
+0.06069592977414281498f, 0.16419950485064219170f, 0.21931025583128155310f, 
+0.20978596030240151404f, 0.13843361551155961009f, 0.02628216106141386538f, 
+-0.09361516325759061674f, -0.18592225743338861021f, -0.22343440501258571285f, 
+-0.19509603819119109014f, -0.10925903112375323634f, 0.00877876168213939136f, 
+0.12422928073072271593f, 0.20306698699752881443f, 0.22205685760620383351f, 
+0.17560220413308527676f, 0.07739412677974548405f, -0.04362352217803873444f, 
+-0.15178446101891943099f, -0.21521153340109885899f, 0.21266270208800996944f, 
+0.13143277802978339808f, 0.00000000000000001369f, -0.13143277802978337032f, 
+-0.21266270208800996944f, -0.21266270208800996944f, -0.13143277802978342583f, 
+-0.00000000000000004108f, 0.13143277802978334257f, 0.21266270208800996944f, 
+0.21266270208800999719f, 0.13143277802978359237f, 0.00000000000000006846f, 
+-0.13143277802978334257f, -0.21266270208800994168f, -0.21266270208800999719f, 
+-0.13143277802978348134f, -0.00000000000000009584f, 0.13143277802978331481f, 
+0.21266270208800994168f, 0.21266270208801013597f, 0.13143277802978350910f, 
+0.00000000000000012323f, -0.13143277802978328705f, -0.21266270208801008046f, 
+-0.21266270208801013597f, -0.13143277802978384217f, -0.00000000000000054782f, 
+0.13143277802978359237f, 0.21266270208801005270f, 0.21266270208801013597f, 
+0.13143277802978384217f, -0.00000000000000021921f, -0.13143277802978356461f, 
+-0.21266270208801005270f, -0.21266270208801016373f, -0.13143277802978386992f, 
+-0.00000000000000060258f, 0.13143277802978353686f, 0.21266270208801005270f, 
+0.20978596030240148629f, 0.10925903112375323634f, -0.04362352217803864424f, 
+-0.17560220413308488818f, -0.22343440501258571285f, -0.16419950485064233048f, 
+-0.02628216106141358435f, 0.12422928073072279920f, 0.21521153340109888674f, 
+0.20306698699752898096f, 0.09361516325759096369f, -0.06069592977414284274f, 
+-0.18592225743338863797f, -0.22205685760620388902f, -0.15178446101891962527f, 
+-0.00877876168213963595f, 0.13843361551155974887f, 0.21931025583128155310f, 
+0.19509603819119109014f, 0.07739412677974505383f, -0.07739412677974444321f, 
+-0.19509603819119097912f, -0.21931025583128160861f, -0.13843361551155991540f, 
+0.00877876168213939136f, 0.15178446101891884812f, 0.22205685760620388902f, 
+0.18592225743338855470f, 0.06069592977414270396f, -0.09361516325759129675f, 
+-0.20306698699752881443f, -0.21521153340109897001f, -0.12422928073072299349f, 
+0.02628216106141353925f, 0.16419950485064238599f, 0.22343440501258571285f, 
+0.17560220413308530452f, 0.04362352217803912996f, -0.10925903112375290327f, 
+-0.20978596030240140302f, 0.20658574377159641400f, 0.08557061686312839033f, 
+-0.08557061686312837645f, -0.20658574377159641400f, -0.20658574377159644175f, 
+-0.08557061686312832094f, 0.08557061686312843196f, 0.20658574377159635849f, 
+0.20658574377159646951f, 0.08557061686312852911f, -0.08557061686312840421f, 
+-0.20658574377159633073f, -0.20658574377159641400f, -0.08557061686312819604f, 
+0.08557061686312839033f, 0.20658574377159633073f, 0.20658574377159655278f, 
+0.08557061686312858462f, -0.08557061686312836257f, -0.20658574377159633073f, 
+-0.20658574377159658053f, -0.08557061686312861237f, 0.08557061686312833482f, 
+0.20658574377159646951f, 0.20658574377159627522f, 0.08557061686312862625f, 
+-0.08557061686312830706f, -0.20658574377159646951f, -0.20658574377159630298f, 
+-0.08557061686312793236f, 0.08557061686312755766f, 0.20658574377159613644f, 
+0.20658574377159660829f, 0.08557061686312868176f, -0.08557061686312826543f, 
+-0.20658574377159613644f, -0.20658574377159663604f, -0.08557061686312870952f, 
+0.08557061686312823767f, 0.20658574377159644175f, 0.20306698699752892545f, 
+0.06069592977414303009f, -0.12422928073072281308f, -0.22205685760620386127f, 
+-0.16419950485064241374f, 0.00877876168213949891f, 0.17560220413308486043f, 
+0.21931025583128160861f, 0.10925903112375351389f, -0.07739412677974451260f, 
+-0.20978596030240143078f, -0.19509603819119147872f, -0.04362352217803899812f, 
+0.13843361551155974887f, 0.22343440501258571285f, 0.15178446101891962527f, 
+-0.02628216106141283148f, -0.18592225743338838817f, -0.21521153340109894225f, 
+-0.09361516325759158819f, 0.09361516325758988122f, 0.21521153340109863694f, 
+0.18592225743338899879f, 0.02628216106141391742f, -0.15178446101891943099f, 
+-0.22343440501258576836f, -0.13843361551156058153f, 0.04362352217803792259f, 
+0.19509603819119092361f, 0.20978596030240154180f, 0.07739412677974627508f, 
+-0.10925903112375220938f, -0.21931025583128138656f, -0.17560220413308530452f, 
+-0.00877876168213980075f, 0.16419950485064127577f, 0.22205685760620405556f, 
+0.12422928073072374289f, -0.06069592977414225987f, -0.20306698699752875892f, 
+0.19923511564810011953f, 0.03497980978537706953f, -0.15811388300841894283f, 
+-0.22085382701546929507f, -0.10151536185567273940f, 0.10151536185567268389f, 
+0.22085382701546929507f, 0.15811388300841899834f, -0.03497980978537679198f, 
+-0.19923511564810000851f, -0.19923511564810006402f, -0.03497980978537734709f, 
+0.15811388300841874854f, 0.22085382701546929507f, 0.10151536185567300308f, 
+-0.10151536185567278103f, -0.22085382701546923956f, -0.15811388300841891508f, 
+0.03497980978537670871f, 0.19923511564810011953f, 0.19923511564810025831f, 
+0.03497980978537704178f, -0.15811388300841869303f, -0.22085382701546929507f, 
+-0.10151536185567236470f, 0.10151536185567200388f, 0.22085382701546923956f, 
+0.15811388300841897059f, -0.03497980978537663238f, -0.19923511564810009178f, 
+-0.19923511564810031382f, -0.03497980978537711810f, 0.15811388300841863752f, 
+0.22085382701546929507f, 0.10151536185567314186f, -0.10151536185567192061f, 
+-0.22085382701546932283f, -0.15811388300841905385f, 0.03497980978537654911f, 
+0.19923511564810042485f, };
+
+mfccconfig<float32_t> mfccconfig1={
+   .fftLen=512,
+   .nbMel=40,
+   .nbDct=13,
+   .filterPos=mfccFilterPos1,
+   .filterLengths=mfccFilterLengths1,
+   .filterCoefs=mfccFilterCoefs1,
+   .dct=mfccDct1
+   };
+
+
+template<>
+const mfccconfig<float32_t> *mfcc_config<float32_t>(uint32_t fftLen,uint32_t nbMel,uint32_t nbDct)
+{
+    if ((fftLen == 512) && (nbMel == 40) && (nbDct == 13))
+    {
+        return(&mfccconfig1);
+    }
+    return(NULL);
+}
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+const uint16_t mfccFilterPos2[40]={1,3,4,6,7,9,11,13,16,18,20,23,26,29,32,35,39,43,47,51,56,61,66,71,77,83,90,97,104,112,121,130,139,149,160,171,184,196,210,225};
+
+const uint16_t mfccFilterLengths2[40]={3,3,3,3,4,4,5,5,4,5,6,6,6,6,7,8,8,8,9,10,10,10,11,12,13,14,14,15,17,18,18,19,21,22,24,25,26,29,30,31};
+
+__ALIGNED(8) const float16_t mfccFilterCoefs2[492]={
+0.25510263f16, 0.94364620f16, 0.39547018f16, 
+0.60452982f16, 0.76010977f16, 0.14837426f16, 
+0.23989023f16, 0.85162574f16, 0.55856953f16, 
+0.44143047f16, 0.98917742f16, 0.43883213f16, 
+0.01082258f16, 0.56116787f16, 0.90630053f16, 
+0.39046549f16, 0.09369947f16, 0.60953451f16, 
+0.89031178f16, 0.40491404f16, 0.10968822f16, 
+0.59508596f16, 0.93342648f16, 0.47507399f16, 
+0.02914453f16, 0.06657352f16, 0.52492601f16, 
+0.97085547f16, 0.59498240f16, 0.17198249f16, 
+0.40501760f16, 0.82801751f16, 0.75958521f16, 
+0.35727201f16, 0.24041479f16, 0.64272799f16, 
+0.96456148f16, 0.58100588f16, 0.20618808f16, 
+0.03543852f16, 0.41899412f16, 0.79381192f16, 
+0.83971881f16, 0.48123425f16, 0.13039388f16, 
+0.16028119f16, 0.51876575f16, 0.86960612f16, 
+0.78687848f16, 0.45038843f16, 0.12064212f16, 
+0.21312152f16, 0.54961157f16, 0.87935788f16, 
+0.79737455f16, 0.48033603f16, 0.16929103f16, 
+0.20262545f16, 0.51966397f16, 0.83070897f16, 
+0.86401715f16, 0.56430413f16, 0.26995298f16, 
+0.13598285f16, 0.43569587f16, 0.73004702f16, 
+0.98077524f16, 0.69659218f16, 0.41723419f16, 
+0.14254017f16, 0.01922476f16, 0.30340782f16, 
+0.58276581f16, 0.85745983f16, 0.87235692f16, 
+0.60653870f16, 0.34494670f16, 0.08744864f16, 
+0.12764308f16, 0.39346130f16, 0.65505330f16, 
+0.91255136f16, 0.83391835f16, 0.58423541f16, 
+0.33828479f16, 0.09595655f16, 0.16608165f16, 
+0.41576459f16, 0.66171521f16, 0.90404345f16, 
+0.85714553f16, 0.62175110f16, 0.38967687f16, 
+0.16083048f16, 0.14285447f16, 0.37824890f16, 
+0.61032313f16, 0.83916952f16, 0.93512338f16, 
+0.71247058f16, 0.49279055f16, 0.27600494f16, 
+0.06203846f16, 0.06487662f16, 0.28752942f16, 
+0.50720945f16, 0.72399506f16, 0.93796154f16, 
+0.85081874f16, 0.64227615f16, 0.43634367f16, 
+0.23295678f16, 0.03205331f16, 0.14918126f16, 
+0.35772385f16, 0.56365633f16, 0.76704322f16, 
+0.96794669f16, 0.83357334f16, 0.63745909f16, 
+0.44365485f16, 0.25210682f16, 0.06276307f16, 
+0.16642666f16, 0.36254091f16, 0.55634515f16, 
+0.74789318f16, 0.93723693f16, 0.87557345f16, 
+0.69048949f16, 0.50746436f16, 0.32645274f16, 
+0.14741082f16, 0.12442655f16, 0.30951051f16, 
+0.49253564f16, 0.67354726f16, 0.85258918f16, 
+0.97029619f16, 0.79506780f16, 0.62168590f16, 
+0.45011198f16, 0.28030872f16, 0.11223994f16, 
+0.02970381f16, 0.20493220f16, 0.37831410f16, 
+0.54988802f16, 0.71969128f16, 0.88776006f16, 
+0.94587057f16, 0.78116660f16, 0.61809499f16, 
+0.45662372f16, 0.29672169f16, 0.13835867f16, 
+0.05412943f16, 0.21883340f16, 0.38190501f16, 
+0.54337628f16, 0.70327831f16, 0.86164133f16, 
+0.98150534f16, 0.82613317f16, 0.67221446f16, 
+0.51972227f16, 0.36863039f16, 0.21891334f16, 
+0.07054633f16, 0.01849466f16, 0.17386683f16, 
+0.32778554f16, 0.48027773f16, 0.63136961f16, 
+0.78108666f16, 0.92945367f16, 0.92350522f16, 
+0.77776654f16, 0.63330740f16, 0.49010554f16, 
+0.34813925f16, 0.20738741f16, 0.06782941f16, 
+0.07649478f16, 0.22223346f16, 0.36669260f16, 
+0.50989446f16, 0.65186075f16, 0.79261259f16, 
+0.93217059f16, 0.92944516f16, 0.79221509f16, 
+0.65612010f16, 0.52114157f16, 0.38726134f16, 
+0.25446166f16, 0.12272525f16, 0.07055484f16, 
+0.20778491f16, 0.34387990f16, 0.47885843f16, 
+0.61273866f16, 0.74553834f16, 0.87727475f16, 
+0.99203521f16, 0.86237504f16, 0.73372864f16, 
+0.60608029f16, 0.47941461f16, 0.35371660f16, 
+0.22897157f16, 0.10516520f16, 0.00796479f16, 
+0.13762496f16, 0.26627136f16, 0.39391971f16, 
+0.52058539f16, 0.64628340f16, 0.77102843f16, 
+0.89483480f16, 0.98228344f16, 0.86031261f16, 
+0.73923929f16, 0.61905037f16, 0.49973302f16, 
+0.38127470f16, 0.26366311f16, 0.14688626f16, 
+0.03093236f16, 0.01771656f16, 0.13968739f16, 
+0.26076071f16, 0.38094963f16, 0.50026698f16, 
+0.61872530f16, 0.73633689f16, 0.85311374f16, 
+0.96906764f16, 0.91578990f16, 0.80144761f16, 
+0.68789443f16, 0.57511955f16, 0.46311238f16, 
+0.35186253f16, 0.24135983f16, 0.13159431f16, 
+0.02255620f16, 0.08421010f16, 0.19855239f16, 
+0.31210557f16, 0.42488045f16, 0.53688762f16, 
+0.64813747f16, 0.75864017f16, 0.86840569f16, 
+0.97744380f16, 0.91423593f16, 0.80662410f16, 
+0.69971151f16, 0.59348912f16, 0.48794809f16, 
+0.38307973f16, 0.27887552f16, 0.17532710f16, 
+0.07242626f16, 0.08576407f16, 0.19337590f16, 
+0.30028849f16, 0.40651088f16, 0.51205191f16, 
+0.61692027f16, 0.72112448f16, 0.82467290f16, 
+0.92757374f16, 0.97016496f16, 0.86853530f16, 
+0.76752952f16, 0.66714000f16, 0.56735929f16, 
+0.46818002f16, 0.36959500f16, 0.27159716f16, 
+0.17417952f16, 0.07733528f16, 0.02983504f16, 
+0.13146470f16, 0.23247048f16, 0.33286000f16, 
+0.43264071f16, 0.53181998f16, 0.63040500f16, 
+0.72840284f16, 0.82582048f16, 0.92266472f16, 
+0.98105770f16, 0.88534021f16, 0.79017633f16, 
+0.69555968f16, 0.60148401f16, 0.50794316f16, 
+0.41493110f16, 0.32244187f16, 0.23046964f16, 
+0.13900864f16, 0.04805324f16, 0.01894230f16, 
+0.11465979f16, 0.20982367f16, 0.30444032f16, 
+0.39851599f16, 0.49205684f16, 0.58506890f16, 
+0.67755813f16, 0.76953036f16, 0.86099136f16, 
+0.95194676f16, 0.95759787f16, 0.86763707f16, 
+0.77816545f16, 0.68917773f16, 0.60066869f16, 
+0.51263322f16, 0.42506628f16, 0.33796290f16, 
+0.25131820f16, 0.16512738f16, 0.07938570f16, 
+0.04240213f16, 0.13236293f16, 0.22183455f16, 
+0.31082227f16, 0.39933131f16, 0.48736678f16, 
+0.57493372f16, 0.66203710f16, 0.74868180f16, 
+0.83487262f16, 0.92061430f16, 0.99408852f16, 
+0.90923124f16, 0.82480935f16, 0.74081840f16, 
+0.65725403f16, 0.57411191f16, 0.49138780f16, 
+0.40907753f16, 0.32717696f16, 0.24568204f16, 
+0.16458878f16, 0.08389323f16, 0.00359150f16, 
+0.00591148f16, 0.09076876f16, 0.17519065f16, 
+0.25918160f16, 0.34274597f16, 0.42588809f16, 
+0.50861220f16, 0.59092247f16, 0.67282304f16, 
+0.75431796f16, 0.83541122f16, 0.91610677f16, 
+0.99640850f16, 0.92367979f16, 0.84415431f16, 
+0.76501134f16, 0.68624724f16, 0.60785838f16, 
+0.52984121f16, 0.45219222f16, 0.37490796f16, 
+0.29798500f16, 0.22142000f16, 0.14520962f16, 
+0.06935061f16, 0.07632021f16, 0.15584569f16, 
+0.23498866f16, 0.31375276f16, 0.39214162f16, 
+0.47015879f16, 0.54780778f16, 0.62509204f16, 
+0.70201500f16, 0.77858000f16, 0.85479038f16, 
+0.93064939f16, 0.99383974f16, 0.91867383f16, 
+0.84384973f16, 0.76936436f16, 0.69521466f16, 
+0.62139762f16, 0.54791028f16, 0.47474968f16, 
+0.40191295f16, 0.32939724f16, 0.25719971f16, 
+0.18531759f16, 0.11374814f16, 0.04248866f16, 
+0.00616026f16, 0.08132617f16, 0.15615027f16, 
+0.23063564f16, 0.30478534f16, 0.37860238f16, 
+0.45208972f16, 0.52525032f16, 0.59808705f16, 
+0.67060276f16, 0.74280029f16, 0.81468241f16, 
+0.88625186f16, 0.95751134f16, 0.97153645f16, 
+0.90088890f16, 0.83054339f16, 0.76049735f16, 
+0.69074824f16, 0.62129355f16, 0.55213082f16, 
+0.48325759f16, 0.41467146f16, 0.34637003f16, 
+0.27835096f16, 0.21061192f16, 0.14315061f16, 
+0.07596476f16, 0.00905215f16, 0.02846355f16, 
+0.09911110f16, 0.16945661f16, 0.23950265f16, 
+0.30925176f16, 0.37870645f16, 0.44786918f16, 
+0.51674241f16, 0.58532854f16, 0.65362997f16, 
+0.72164904f16, 0.78938808f16, 0.85684939f16, 
+0.92403524f16, 0.99094785f16, 0.94241054f16, 
+0.87603776f16, 0.80993164f16, 0.74409006f16, 
+0.67851090f16, 0.61319207f16, 0.54813153f16, 
+0.48332723f16, 0.41877717f16, 0.35447935f16, 
+0.29043182f16, 0.22663263f16, 0.16307987f16, 
+0.09977163f16, 0.03670605f16, 0.05758946f16, 
+0.12396224f16, 0.19006836f16, 0.25590994f16, 
+0.32148910f16, 0.38680793f16, 0.45186847f16, 
+0.51667277f16, 0.58122283f16, 0.64552065f16, 
+0.70956818f16, 0.77336737f16, 0.83692013f16, 
+0.90022837f16, 0.96329395f16, 0.97388127f16, 
+0.91129546f16, 0.84894680f16, 0.78683351f16, 
+0.72495382f16, 0.66330598f16, 0.60188825f16, 
+0.54069893f16, 0.47973632f16, 0.41899874f16, 
+0.35848455f16, 0.29819211f16, 0.23811979f16, 
+0.17826599f16, 0.11862914f16, 0.05920766f16, 
+};
+
+__ALIGNED(8) const float16_t mfccDct2[520]={
+0.15811388f16, 0.15811388f16, 0.15811388f16, 
+0.15811388f16, 0.15811388f16, 0.15811388f16, 
+0.15811388f16, 0.15811388f16, 0.15811388f16, 
+0.15811388f16, 0.15811388f16, 0.15811388f16, 
+0.15811388f16, 0.15811388f16, 0.15811388f16, 
+0.15811388f16, 0.15811388f16, 0.15811388f16, 
+0.15811388f16, 0.15811388f16, 0.15811388f16, 
+0.15811388f16, 0.15811388f16, 0.15811388f16, 
+0.15811388f16, 0.15811388f16, 0.15811388f16, 
+0.15811388f16, 0.15811388f16, 0.15811388f16, 
+0.15811388f16, 0.15811388f16, 0.15811388f16, 
+0.15811388f16, 0.15811388f16, 0.15811388f16, 
+0.15811388f16, 0.15811388f16, 0.15811388f16, 
+0.15811388f16, 0.22343441f16, 0.22205686f16, 
+0.21931026f16, 0.21521153f16, 0.20978596f16, 
+0.20306699f16, 0.19509604f16, 0.18592226f16, 
+0.17560220f16, 0.16419950f16, 0.15178446f16, 
+0.13843362f16, 0.12422928f16, 0.10925903f16, 
+0.09361516f16, 0.07739413f16, 0.06069593f16, 
+0.04362352f16, 0.02628216f16, 0.00877876f16, 
+-0.00877876f16, -0.02628216f16, -0.04362352f16, 
+-0.06069593f16, -0.07739413f16, -0.09361516f16, 
+-0.10925903f16, -0.12422928f16, -0.13843362f16, 
+-0.15178446f16, -0.16419950f16, -0.17560220f16, 
+-0.18592226f16, -0.19509604f16, -0.20306699f16, 
+-0.20978596f16, -0.21521153f16, -0.21931026f16, 
+-0.22205686f16, -0.22343441f16, 0.22291749f16, 
+0.21742852f16, 0.20658574f16, 0.19065614f16, 
+0.17003194f16, 0.14522100f16, 0.11683423f16, 
+0.08557062f16, 0.05219997f16, 0.01754399f16, 
+-0.01754399f16, -0.05219997f16, -0.08557062f16, 
+-0.11683423f16, -0.14522100f16, -0.17003194f16, 
+-0.19065614f16, -0.20658574f16, -0.21742852f16, 
+-0.22291749f16, -0.22291749f16, -0.21742852f16, 
+-0.20658574f16, -0.19065614f16, -0.17003194f16, 
+-0.14522100f16, -0.11683423f16, -0.08557062f16, 
+-0.05219997f16, -0.01754399f16, 0.01754399f16, 
+0.05219997f16, 0.08557062f16, 0.11683423f16, 
+0.14522100f16, 0.17003194f16, 0.19065614f16, 
+0.20658574f16, 0.21742852f16, 0.22291749f16, 
+0.22205686f16, 0.20978596f16, 0.18592226f16, 
+0.15178446f16, 0.10925903f16, 0.06069593f16, 
+0.00877876f16, -0.04362352f16, -0.09361516f16, 
+-0.13843362f16, -0.17560220f16, -0.20306699f16, 
+-0.21931026f16, -0.22343441f16, -0.21521153f16, 
+-0.19509604f16, -0.16419950f16, -0.12422928f16, 
+-0.07739413f16, -0.02628216f16, 0.02628216f16, 
+0.07739413f16, 0.12422928f16, 0.16419950f16, 
+0.19509604f16, 0.21521153f16, 0.22343441f16, 
+0.21931026f16, 0.20306699f16, 0.17560220f16, 
+0.13843362f16, 0.09361516f16, 0.04362352f16, 
+-0.00877876f16, -0.06069593f16, -0.10925903f16, 
+-0.15178446f16, -0.18592226f16, -0.20978596f16, 
+-0.22205686f16, 0.22085383f16, 0.19923512f16, 
+0.15811388f16, 0.10151536f16, 0.03497981f16, 
+-0.03497981f16, -0.10151536f16, -0.15811388f16, 
+-0.19923512f16, -0.22085383f16, -0.22085383f16, 
+-0.19923512f16, -0.15811388f16, -0.10151536f16, 
+-0.03497981f16, 0.03497981f16, 0.10151536f16, 
+0.15811388f16, 0.19923512f16, 0.22085383f16, 
+0.22085383f16, 0.19923512f16, 0.15811388f16, 
+0.10151536f16, 0.03497981f16, -0.03497981f16, 
+-0.10151536f16, -0.15811388f16, -0.19923512f16, 
+-0.22085383f16, -0.22085383f16, -0.19923512f16, 
+-0.15811388f16, -0.10151536f16, -0.03497981f16, 
+0.03497981f16, 0.10151536f16, 0.15811388f16, 
+0.19923512f16, 0.22085383f16, 0.21931026f16, 
+0.18592226f16, 0.12422928f16, 0.04362352f16, 
+-0.04362352f16, -0.12422928f16, -0.18592226f16, 
+-0.21931026f16, -0.21931026f16, -0.18592226f16, 
+-0.12422928f16, -0.04362352f16, 0.04362352f16, 
+0.12422928f16, 0.18592226f16, 0.21931026f16, 
+0.21931026f16, 0.18592226f16, 0.12422928f16, 
+0.04362352f16, -0.04362352f16, -0.12422928f16, 
+-0.18592226f16, -0.21931026f16, -0.21931026f16, 
+-0.18592226f16, -0.12422928f16, -0.04362352f16, 
+0.04362352f16, 0.12422928f16, 0.18592226f16, 
+0.21931026f16, 0.21931026f16, 0.18592226f16, 
+0.12422928f16, 0.04362352f16, -0.04362352f16, 
+-0.12422928f16, -0.18592226f16, -0.21931026f16, 
+0.21742852f16, 0.17003194f16, 0.08557062f16, 
+-0.01754399f16, -0.11683423f16, -0.19065614f16, 
+-0.22291749f16, -0.20658574f16, -0.14522100f16, 
+-0.05219997f16, 0.05219997f16, 0.14522100f16, 
+0.20658574f16, 0.22291749f16, 0.19065614f16, 
+0.11683423f16, 0.01754399f16, -0.08557062f16, 
+-0.17003194f16, -0.21742852f16, -0.21742852f16, 
+-0.17003194f16, -0.08557062f16, 0.01754399f16, 
+0.11683423f16, 0.19065614f16, 0.22291749f16, 
+0.20658574f16, 0.14522100f16, 0.05219997f16, 
+-0.05219997f16, -0.14522100f16, -0.20658574f16, 
+-0.22291749f16, -0.19065614f16, -0.11683423f16, 
+-0.01754399f16, 0.08557062f16, 0.17003194f16, 
+0.21742852f16, 0.21521153f16, 0.15178446f16, 
+0.04362352f16, -0.07739413f16, -0.17560220f16, 
+-0.22205686f16, -0.20306699f16, -0.12422928f16, 
+-0.00877876f16, 0.10925903f16, 0.19509604f16, 
+0.22343441f16, 0.18592226f16, 0.09361516f16, 
+-0.02628216f16, -0.13843362f16, -0.20978596f16, 
+-0.21931026f16, -0.16419950f16, -0.06069593f16, 
+0.06069593f16, 0.16419950f16, 0.21931026f16, 
+0.20978596f16, 0.13843362f16, 0.02628216f16, 
+-0.09361516f16, -0.18592226f16, -0.22343441f16, 
+-0.19509604f16, -0.10925903f16, 0.00877876f16, 
+0.12422928f16, 0.20306699f16, 0.22205686f16, 
+0.17560220f16, 0.07739413f16, -0.04362352f16, 
+-0.15178446f16, -0.21521153f16, 0.21266270f16, 
+0.13143278f16, 0.00000000f16, -0.13143278f16, 
+-0.21266270f16, -0.21266270f16, -0.13143278f16, 
+-0.00000000f16, 0.13143278f16, 0.21266270f16, 
+0.21266270f16, 0.13143278f16, 0.00000000f16, 
+-0.13143278f16, -0.21266270f16, -0.21266270f16, 
+-0.13143278f16, -0.00000000f16, 0.13143278f16, 
+0.21266270f16, 0.21266270f16, 0.13143278f16, 
+0.00000000f16, -0.13143278f16, -0.21266270f16, 
+-0.21266270f16, -0.13143278f16, -0.00000000f16, 
+0.13143278f16, 0.21266270f16, 0.21266270f16, 
+0.13143278f16, -0.00000000f16, -0.13143278f16, 
+-0.21266270f16, -0.21266270f16, -0.13143278f16, 
+-0.00000000f16, 0.13143278f16, 0.21266270f16, 
+0.20978596f16, 0.10925903f16, -0.04362352f16, 
+-0.17560220f16, -0.22343441f16, -0.16419950f16, 
+-0.02628216f16, 0.12422928f16, 0.21521153f16, 
+0.20306699f16, 0.09361516f16, -0.06069593f16, 
+-0.18592226f16, -0.22205686f16, -0.15178446f16, 
+-0.00877876f16, 0.13843362f16, 0.21931026f16, 
+0.19509604f16, 0.07739413f16, -0.07739413f16, 
+-0.19509604f16, -0.21931026f16, -0.13843362f16, 
+0.00877876f16, 0.15178446f16, 0.22205686f16, 
+0.18592226f16, 0.06069593f16, -0.09361516f16, 
+-0.20306699f16, -0.21521153f16, -0.12422928f16, 
+0.02628216f16, 0.16419950f16, 0.22343441f16, 
+0.17560220f16, 0.04362352f16, -0.10925903f16, 
+-0.20978596f16, 0.20658574f16, 0.08557062f16, 
+-0.08557062f16, -0.20658574f16, -0.20658574f16, 
+-0.08557062f16, 0.08557062f16, 0.20658574f16, 
+0.20658574f16, 0.08557062f16, -0.08557062f16, 
+-0.20658574f16, -0.20658574f16, -0.08557062f16, 
+0.08557062f16, 0.20658574f16, 0.20658574f16, 
+0.08557062f16, -0.08557062f16, -0.20658574f16, 
+-0.20658574f16, -0.08557062f16, 0.08557062f16, 
+0.20658574f16, 0.20658574f16, 0.08557062f16, 
+-0.08557062f16, -0.20658574f16, -0.20658574f16, 
+-0.08557062f16, 0.08557062f16, 0.20658574f16, 
+0.20658574f16, 0.08557062f16, -0.08557062f16, 
+-0.20658574f16, -0.20658574f16, -0.08557062f16, 
+0.08557062f16, 0.20658574f16, 0.20306699f16, 
+0.06069593f16, -0.12422928f16, -0.22205686f16, 
+-0.16419950f16, 0.00877876f16, 0.17560220f16, 
+0.21931026f16, 0.10925903f16, -0.07739413f16, 
+-0.20978596f16, -0.19509604f16, -0.04362352f16, 
+0.13843362f16, 0.22343441f16, 0.15178446f16, 
+-0.02628216f16, -0.18592226f16, -0.21521153f16, 
+-0.09361516f16, 0.09361516f16, 0.21521153f16, 
+0.18592226f16, 0.02628216f16, -0.15178446f16, 
+-0.22343441f16, -0.13843362f16, 0.04362352f16, 
+0.19509604f16, 0.20978596f16, 0.07739413f16, 
+-0.10925903f16, -0.21931026f16, -0.17560220f16, 
+-0.00877876f16, 0.16419950f16, 0.22205686f16, 
+0.12422928f16, -0.06069593f16, -0.20306699f16, 
+0.19923512f16, 0.03497981f16, -0.15811388f16, 
+-0.22085383f16, -0.10151536f16, 0.10151536f16, 
+0.22085383f16, 0.15811388f16, -0.03497981f16, 
+-0.19923512f16, -0.19923512f16, -0.03497981f16, 
+0.15811388f16, 0.22085383f16, 0.10151536f16, 
+-0.10151536f16, -0.22085383f16, -0.15811388f16, 
+0.03497981f16, 0.19923512f16, 0.19923512f16, 
+0.03497981f16, -0.15811388f16, -0.22085383f16, 
+-0.10151536f16, 0.10151536f16, 0.22085383f16, 
+0.15811388f16, -0.03497981f16, -0.19923512f16, 
+-0.19923512f16, -0.03497981f16, 0.15811388f16, 
+0.22085383f16, 0.10151536f16, -0.10151536f16, 
+-0.22085383f16, -0.15811388f16, 0.03497981f16, 
+0.19923512f16, };
+
+mfccconfig<float16_t> mfccconfig2={
+   .fftLen=512,
+   .nbMel=40,
+   .nbDct=13,
+   .filterPos=mfccFilterPos2,
+   .filterLengths=mfccFilterLengths2,
+   .filterCoefs=mfccFilterCoefs2,
+   .dct=mfccDct2
+   };
+
+
+template<>
+const mfccconfig<float16_t> *mfcc_config<float16_t>(uint32_t fftLen,uint32_t nbMel,uint32_t nbDct)
+{
+    if ((fftLen == 512) && (nbMel == 40) && (nbDct == 13))
+    {
+        return(&mfccconfig2);
+    }
+    return(NULL);
+}
+
+#endif
+
+__ALIGNED(8) const float32_t channelizerCoefs1[128]={
+-0.00000114901562339671f, -0.00000541434031169462f, -0.00001293417251488731f, 
+-0.00002434461818514174f, -0.00004002849956232746f, -0.00005998017582537625f, 
+-0.00008367227254994504f, -0.00010993822964997192f, -0.00013688612937484029f, 
+-0.00016185969274025959f, -0.00018146140310315413f, -0.00019165028179626579f, 
+-0.00018792286311635642f, -0.00016558048070003742f, -0.00012007930593285242f, 
+-0.00004745202754483632f, 0.00005521789158945335f, 0.00018929622185709597f, 
+0.00035410603969707291f, 0.00054648314582654870f, 0.00076042147221448654f, 
+0.00098685181545009456f, 0.00121359483978596572f, 0.00142552357096113703f, 
+0.00160496153153281734f, 0.00173233047330578565f, 0.00178704681894301608f, 
+0.00174864915334587388f, 0.00159812134229641981f, 0.00131935820711923764f, 
+0.00090070436231258282f, 0.00033648307124787500f, -0.00037157801810394072f, 
+-0.00121312258319825604f, -0.00216824067084743586f, -0.00320693438220393066f, 
+-0.00428905262518363990f, -0.00536475442431843998f, -0.00637553594447694272f, 
+-0.00725582771339061423f, -0.00793513693641912168f, -0.00834067699318431603f, 
+-0.00840039409421483585f, -0.00804627164654891751f, -0.00721776808205149261f, 
+-0.00586522552659913404f, -0.00395307622815844681f, -0.00146267221258954117f, 
+0.00160542819702680405f, 0.00522986552555937748f, 0.00936769750602576938f, 
+0.01395451718780895724f, 0.01890551589805596761f, 0.02411749040119789272f, 
+0.02947174592304387108f, 0.03483779972263776475f, 0.04007774626614292457f, 
+0.04505110732625326742f, 0.04961996076871089123f, 0.05365412224763475846f, 
+0.05703614582791100701f, 0.05966591337153878682f, 0.06146459837030070206f, 
+0.06237781709268607616f, 0.06237781709268607616f, 0.06146459837030070206f, 
+0.05966591337153878682f, 0.05703614582791100701f, 0.05365412224763475846f, 
+0.04961996076871089123f, 0.04505110732625326742f, 0.04007774626614292457f, 
+0.03483779972263776475f, 0.02947174592304387108f, 0.02411749040119789272f, 
+0.01890551589805596761f, 0.01395451718780895724f, 0.00936769750602576938f, 
+0.00522986552555937748f, 0.00160542819702680405f, -0.00146267221258954117f, 
+-0.00395307622815844681f, -0.00586522552659913404f, -0.00721776808205149261f, 
+-0.00804627164654891751f, -0.00840039409421483585f, -0.00834067699318431603f, 
+-0.00793513693641912168f, -0.00725582771339061423f, -0.00637553594447694272f, 
+-0.00536475442431843998f, -0.00428905262518363990f, -0.00320693438220393066f, 
+-0.00216824067084743586f, -0.00121312258319825604f, -0.00037157801810394072f, 
+0.00033648307124787500f, 0.00090070436231258282f, 0.00131935820711923764f, 
+0.00159812134229641981f, 0.00174864915334587388f, 0.00178704681894301608f, 
+0.00173233047330578565f, 0.00160496153153281734f, 0.00142552357096113703f, 
+0.00121359483978596572f, 0.00098685181545009456f, 0.00076042147221448654f, 
+0.00054648314582654870f, 0.00035410603969707291f, 0.00018929622185709597f, 
+0.00005521789158945335f, -0.00004745202754483632f, -0.00012007930593285242f, 
+-0.00016558048070003742f, -0.00018792286311635642f, -0.00019165028179626579f, 
+-0.00018146140310315413f, -0.00016185969274025959f, -0.00013688612937484029f, 
+-0.00010993822964997192f, -0.00008367227254994504f, -0.00005998017582537625f, 
+-0.00004002849956232746f, -0.00002434461818514174f, -0.00001293417251488731f, 
+-0.00000541434031169462f, -0.00000114901562339671f, };
+
+channelizerconfig<float32_t> channelizerconfig1={
+   .nbChannels=16,
+   .nbTaps=8,
+   .coefs=channelizerCoefs1
+   };
+
+__ALIGNED(8) const float32_t channelizerCoefs2[256]={
+-0.00000028647271787606f, -0.00000109315712253109f, -0.00000225342285322616f, 
+-0.00000381600422119213f, -0.00000582625535209288f, -0.00000832426099493394f, 
+-0.00001134282065946041f, -0.00001490534103487628f, -0.00001902367757036158f, 
+-0.00002369597164345976f, -0.00002890453474897467f, -0.00003461383545158818f, 
+-0.00004076864830647674f, -0.00004729242641724001f, -0.00005408596063358773f, 
+-0.00006102638847081405f, -0.00006796661455528598f, -0.00007473520168229713f, 
+-0.00008113678735630132f, -0.00008695307493746063f, -0.00009194444124083610f, 
+-0.00009585219365510151f, -0.00009840149962890003f, -0.00009930499981108716f, 
+-0.00009826710335614703f, -0.00009498895008138991f, -0.00008917400948361161f, 
+-0.00008053427131539624f, -0.00006879696673836720f, -0.00005371174328988764f, 
+-0.00003505820131863262f, -0.00001265368447633633f, 0.00001363879737841333f, 
+0.00004390264757477521f, 0.00007815991060704464f, 0.00011636380474122937f, 
+0.00015839172294176981f, 0.00020403887105171990f, 0.00025301271474230028f, 
+0.00030492840644665275f, 0.00035930536012348895f, 0.00041556513511993896f, 
+0.00047303078053032135f, 0.00053092777824412316f, 0.00058838670636576220f, 
+0.00064444772495447767f, 0.00069806696322121926f, 0.00074812486163923497f, 
+0.00079343649414697975f, 0.00083276386507693547f, 0.00086483014302013417f, 
+0.00088833575997500423f, 0.00090197626931988462f, 0.00090446182092186668f, 
+0.00089453807661553277f, 0.00087100835494425448f, 0.00083275676106155973f, 
+0.00077877202665484928f, 0.00070817175628965065f, 0.00062022675127623261f, 
+0.00051438506060413327f, 0.00039029539120982623f, 0.00024782949732868570f, 
+0.00008710316136760149f, -0.00009150462301374950f, -0.00028733465081487994f, 
+-0.00049943306362394690f, -0.00072653982422450853f, -0.00096708044396362914f, 
+-0.00121916127025342648f, -0.00148056860690616316f, -0.00174877189964966584f, 
+-0.00202093117351561475f, -0.00229390885831677041f, -0.00256428608370395288f, 
+-0.00282838346698138397f, -0.00308228635570153902f, -0.00332187442387163207f, 
+-0.00354285545625627075f, -0.00374080309067650755f, -0.00391119822434065397f, 
+-0.00404947372807340500f, -0.00415106205281962938f, -0.00421144525695934385f, 
+-0.00422620693172756981f, -0.00419108545629161711f, -0.00410202797464652175f, 
+-0.00395524445422269343f, -0.00374726116164780234f, -0.00347497287505793865f, 
+-0.00313569314519060666f, -0.00272720191957198134f, -0.00224778985566200830f, 
+-0.00169629866993470141f, -0.00107215690049915864f, -0.00037541050081652016f, 
+0.00039325226899579322f, 0.00123248212933618523f, 0.00214025665749036868f, 
+0.00311387509143358976f, 0.00414996032051680001f, 0.00524446823840122624f, 
+0.00639270454527852191f, 0.00758934899500376872f, 0.00882848698949637370f, 
+0.01010364832890107978f, 0.01140785283284661417f, 0.01273366245700578887f, 
+0.01407323944134903845f, 0.01541840994326831339f, 0.01676073253135384675f, 
+0.01809157084519094280f, 0.01940216966417847647f, 0.02068373357502424625f, 
+0.02192750738409302708f, 0.02312485738788860531f, 0.02426735259321220403f, 
+0.02534684496837283710f, 0.02635554780848291256f, 0.02728611131144341798f, 
+0.02813169448661778649f, 0.02888603255516293544f, 0.02954349904910092903f, 
+0.03009916187489576622f, 0.03054883267580231140f, 0.03088910890469859921f, 
+0.03111740810447897326f, 0.03123199398524465972f, 0.03123199398524465972f, 
+0.03111740810447897326f, 0.03088910890469859921f, 0.03054883267580231140f, 
+0.03009916187489576622f, 0.02954349904910092903f, 0.02888603255516293544f, 
+0.02813169448661778649f, 0.02728611131144341798f, 0.02635554780848291256f, 
+0.02534684496837283710f, 0.02426735259321220403f, 0.02312485738788860531f, 
+0.02192750738409302708f, 0.02068373357502424625f, 0.01940216966417847647f, 
+0.01809157084519094280f, 0.01676073253135384675f, 0.01541840994326831339f, 
+0.01407323944134903845f, 0.01273366245700578887f, 0.01140785283284661417f, 
+0.01010364832890107978f, 0.00882848698949637370f, 0.00758934899500376872f, 
+0.00639270454527852191f, 0.00524446823840122624f, 0.00414996032051680001f, 
+0.00311387509143358976f, 0.00214025665749036868f, 0.00123248212933618523f, 
+0.00039325226899579322f, -0.00037541050081652016f, -0.00107215690049915864f, 
+-0.00169629866993470141f, -0.00224778985566200830f, -0.00272720191957198134f, 
+-0.00313569314519060666f, -0.00347497287505793865f, -0.00374726116164780234f, 
+-0.00395524445422269343f, -0.00410202797464652175f, -0.00419108545629161711f, 
+-0.00422620693172756981f, -0.00421144525695934385f, -0.00415106205281962938f, 
+-0.00404947372807340500f, -0.00391119822434065397f, -0.00374080309067650755f, 
+-0.00354285545625627075f, -0.00332187442387163207f, -0.00308228635570153902f, 
+-0.00282838346698138397f, -0.00256428608370395288f, -0.00229390885831677041f, 
+-0.00202093117351561475f, -0.00174877189964966584f, -0.00148056860690616316f, 
+-0.00121916127025342648f, -0.00096708044396362914f, -0.00072653982422450853f, 
+-0.00049943306362394690f, -0.00028733465081487994f, -0.00009150462301374950f, 
+0.00008710316136760149f, 0.00024782949732868570f, 0.00039029539120982623f, 
+0.00051438506060413327f, 0.00062022675127623261f, 0.00070817175628965065f, 
+0.00077877202665484928f, 0.00083275676106155973f, 0.00087100835494425448f, 
+0.00089453807661553277f, 0.00090446182092186668f, 0.00090197626931988462f, 
+0.00088833575997500423f, 0.00086483014302013417f, 0.00083276386507693547f, 
+0.00079343649414697975f, 0.00074812486163923497f, 0.00069806696322121926f, 
+0.00064444772495447767f, 0.00058838670636576220f, 0.00053092777824412316f, 
+0.00047303078053032135f, 0.00041556513511993896f, 0.00035930536012348895f, 
+0.00030492840644665275f, 0.00025301271474230028f, 0.00020403887105171990f, 
+0.00015839172294176981f, 0.00011636380474122937f, 0.00007815991060704464f, 
+0.00004390264757477521f, 0.00001363879737841333f, -0.00001265368447633633f, 
+-0.00003505820131863262f, -0.00005371174328988764f, -0.00006879696673836720f, 
+-0.00008053427131539624f, -0.00008917400948361161f, -0.00009498895008138991f, 
+-0.00009826710335614703f, -0.00009930499981108716f, -0.00009840149962890003f, 
+-0.00009585219365510151f, -0.00009194444124083610f, -0.00008695307493746063f, 
+-0.00008113678735630132f, -0.00007473520168229713f, -0.00006796661455528598f, 
+-0.00006102638847081405f, -0.00005408596063358773f, -0.00004729242641724001f, 
+-0.00004076864830647674f, -0.00003461383545158818f, -0.00002890453474897467f, 
+-0.00002369597164345976f, -0.00001902367757036158f, -0.00001490534103487628f, 
+-0.00001134282065946041f, -0.00000832426099493394f, -0.00000582625535209288f, 
+-0.00000381600422119213f, -0.00000225342285322616f, -0.00000109315712253109f, 
+-0.00000028647271787606f, };
+
+channelizerconfig<float32_t> channelizerconfig2={
+   .nbChannels=32,
+   .nbTaps=8,
+   .coefs=channelizerCoefs2
+   };
+
+
+template<>
+const channelizerconfig<float32_t> *channelizer_config<float32_t>(uint32_t nbChannels,uint32_t nbTaps)
+{
+    if ((nbChannels == 16) && (nbTaps == 8))
     {
-        case 4:
-            return(&config337);
-        break;
-        case 6:
-            return(&config338);
-        break;
-        case 8:
-            return(&config339);
-        break;
-        case 10:
-            return(&config340);
-        break;
-        case 12:
-            return(&config341);
-        break;
-        case 16:
-            return(&config342);
-        break;
-        case 18:
-            return(&config343);
-        break;
-        case 20:
-            return(&config344);
-        break;
-        case 24:
-            return(&config345);
-        break;
-        case 30:
-            return(&config346);
-        break;
-        case 32:
-            return(&config347);
-        break;
-        case 36:
-            return(&config348);
-        break;
-        case 40:
-            return(&config349);
-        break;
-        case 48:
-            return(&config350);
-        break;
-        case 50:
-            return(&config351);
-        break;
-        case 54:
-            return(&config352);
-        break;
-        case 60:
-            return(&config353);
-        break;
-        case 64:
-            return(&config354);
-        break;
-        case 72:
-            return(&config355);
-        break;
-        case 80:
-            return(&config356);
-        break;
-        case 90:
-            return(&config357);
-        break;
-        case 96:
-            return(&config358);
-        break;
-        case 100:
-            return(&config359);
-        break;
-        case 108:
-            return(&config360);
-        break;
-        case 120:
-            return(&config361);
-        break;
-        case 128:
-            return(&config362);
-        break;
-        case 144:
-            return(&config363);
-        break;
-        case 150:
-            return(&config364);
-        break;
-        case 160:
-            return(&config365);
-        break;
-        case 180:
-            return(&config366);
-        break;
-        case 192:
-            return(&config367);
-        break;
-        case 200:
-            return(&config368);
-        break;
-        case 216:
-            return(&config369);
-        break;
-        case 240:
-            return(&config370);
-        break;
-        case 256:
-            return(&config371);
-        break;
-        case 288:
-            return(&config372);
-        break;
-        case 320:
-            return(&config373);
-        break;
-        case 384:
-            return(&config374);
-        break;
-        case 512:
-            return(&config375);
-        break;
-        case 1024:
-            return(&config376);
-        break;
+        return(&channelizerconfig1);
+    }
+    if ((nbChannels == 32) && (nbTaps == 8))
+    {
+        return(&channelizerconfig2);
+    }
+    return(NULL);
+}
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+__ALIGNED(8) const float16_t channelizerCoefs3[128]={
+-0.00000115f16, -0.00000541f16, -0.00001293f16, 
+-0.00002434f16, -0.00004003f16, -0.00005998f16, 
+-0.00008367f16, -0.00010994f16, -0.00013689f16, 
+-0.00016186f16, -0.00018146f16, -0.00019165f16, 
+-0.00018792f16, -0.00016558f16, -0.00012008f16, 
+-0.00004745f16, 0.00005522f16, 0.00018930f16, 
+0.00035411f16, 0.00054648f16, 0.00076042f16, 
+0.00098685f16, 0.00121359f16, 0.00142552f16, 
+0.00160496f16, 0.00173233f16, 0.00178705f16, 
+0.00174865f16, 0.00159812f16, 0.00131936f16, 
+0.00090070f16, 0.00033648f16, -0.00037158f16, 
+-0.00121312f16, -0.00216824f16, -0.00320693f16, 
+-0.00428905f16, -0.00536475f16, -0.00637554f16, 
+-0.00725583f16, -0.00793514f16, -0.00834068f16, 
+-0.00840039f16, -0.00804627f16, -0.00721777f16, 
+-0.00586523f16, -0.00395308f16, -0.00146267f16, 
+0.00160543f16, 0.00522987f16, 0.00936770f16, 
+0.01395452f16, 0.01890552f16, 0.02411749f16, 
+0.02947175f16, 0.03483780f16, 0.04007775f16, 
+0.04505111f16, 0.04961996f16, 0.05365412f16, 
+0.05703615f16, 0.05966591f16, 0.06146460f16, 
+0.06237782f16, 0.06237782f16, 0.06146460f16, 
+0.05966591f16, 0.05703615f16, 0.05365412f16, 
+0.04961996f16, 0.04505111f16, 0.04007775f16, 
+0.03483780f16, 0.02947175f16, 0.02411749f16, 
+0.01890552f16, 0.01395452f16, 0.00936770f16, 
+0.00522987f16, 0.00160543f16, -0.00146267f16, 
+-0.00395308f16, -0.00586523f16, -0.00721777f16, 
+-0.00804627f16, -0.00840039f16, -0.00834068f16, 
+-0.00793514f16, -0.00725583f16, -0.00637554f16, 
+-0.00536475f16, -0.00428905f16, -0.00320693f16, 
+-0.00216824f16, -0.00121312f16, -0.00037158f16, 
+0.00033648f16, 0.00090070f16, 0.00131936f16, 
+0.00159812f16, 0.00174865f16, 0.00178705f16, 
+0.00173233f16, 0.00160496f16, 0.00142552f16, 
+0.00121359f16, 0.00098685f16, 0.00076042f16, 
+0.00054648f16, 0.00035411f16, 0.00018930f16, 
+0.00005522f16, -0.00004745f16, -0.00012008f16, 
+-0.00016558f16, -0.00018792f16, -0.00019165f16, 
+-0.00018146f16, -0.00016186f16, -0.00013689f16, 
+-0.00010994f16, -0.00008367f16, -0.00005998f16, 
+-0.00004003f16, -0.00002434f16, -0.00001293f16, 
+-0.00000541f16, -0.00000115f16, };
+
+channelizerconfig<float16_t> channelizerconfig3={
+   .nbChannels=16,
+   .nbTaps=8,
+   .coefs=channelizerCoefs3
+   };
+
+__ALIGNED(8) const float16_t channelizerCoefs4[256]={
+-0.00000029f16, -0.00000109f16, -0.00000225f16, 
+-0.00000382f16, -0.00000583f16, -0.00000832f16, 
+-0.00001134f16, -0.00001491f16, -0.00001902f16, 
+-0.00002370f16, -0.00002890f16, -0.00003461f16, 
+-0.00004077f16, -0.00004729f16, -0.00005409f16, 
+-0.00006103f16, -0.00006797f16, -0.00007474f16, 
+-0.00008114f16, -0.00008695f16, -0.00009194f16, 
+-0.00009585f16, -0.00009840f16, -0.00009930f16, 
+-0.00009827f16, -0.00009499f16, -0.00008917f16, 
+-0.00008053f16, -0.00006880f16, -0.00005371f16, 
+-0.00003506f16, -0.00001265f16, 0.00001364f16, 
+0.00004390f16, 0.00007816f16, 0.00011636f16, 
+0.00015839f16, 0.00020404f16, 0.00025301f16, 
+0.00030493f16, 0.00035931f16, 0.00041557f16, 
+0.00047303f16, 0.00053093f16, 0.00058839f16, 
+0.00064445f16, 0.00069807f16, 0.00074812f16, 
+0.00079344f16, 0.00083276f16, 0.00086483f16, 
+0.00088834f16, 0.00090198f16, 0.00090446f16, 
+0.00089454f16, 0.00087101f16, 0.00083276f16, 
+0.00077877f16, 0.00070817f16, 0.00062023f16, 
+0.00051439f16, 0.00039030f16, 0.00024783f16, 
+0.00008710f16, -0.00009150f16, -0.00028733f16, 
+-0.00049943f16, -0.00072654f16, -0.00096708f16, 
+-0.00121916f16, -0.00148057f16, -0.00174877f16, 
+-0.00202093f16, -0.00229391f16, -0.00256429f16, 
+-0.00282838f16, -0.00308229f16, -0.00332187f16, 
+-0.00354286f16, -0.00374080f16, -0.00391120f16, 
+-0.00404947f16, -0.00415106f16, -0.00421145f16, 
+-0.00422621f16, -0.00419109f16, -0.00410203f16, 
+-0.00395524f16, -0.00374726f16, -0.00347497f16, 
+-0.00313569f16, -0.00272720f16, -0.00224779f16, 
+-0.00169630f16, -0.00107216f16, -0.00037541f16, 
+0.00039325f16, 0.00123248f16, 0.00214026f16, 
+0.00311388f16, 0.00414996f16, 0.00524447f16, 
+0.00639270f16, 0.00758935f16, 0.00882849f16, 
+0.01010365f16, 0.01140785f16, 0.01273366f16, 
+0.01407324f16, 0.01541841f16, 0.01676073f16, 
+0.01809157f16, 0.01940217f16, 0.02068373f16, 
+0.02192751f16, 0.02312486f16, 0.02426735f16, 
+0.02534684f16, 0.02635555f16, 0.02728611f16, 
+0.02813169f16, 0.02888603f16, 0.02954350f16, 
+0.03009916f16, 0.03054883f16, 0.03088911f16, 
+0.03111741f16, 0.03123199f16, 0.03123199f16, 
+0.03111741f16, 0.03088911f16, 0.03054883f16, 
+0.03009916f16, 0.02954350f16, 0.02888603f16, 
+0.02813169f16, 0.02728611f16, 0.02635555f16, 
+0.02534684f16, 0.02426735f16, 0.02312486f16, 
+0.02192751f16, 0.02068373f16, 0.01940217f16, 
+0.01809157f16, 0.01676073f16, 0.01541841f16, 
+0.01407324f16, 0.01273366f16, 0.01140785f16, 
+0.01010365f16, 0.00882849f16, 0.00758935f16, 
+0.00639270f16, 0.00524447f16, 0.00414996f16, 
+0.00311388f16, 0.00214026f16, 0.00123248f16, 
+0.00039325f16, -0.00037541f16, -0.00107216f16, 
+-0.00169630f16, -0.00224779f16, -0.00272720f16, 
+-0.00313569f16, -0.00347497f16, -0.00374726f16, 
+-0.00395524f16, -0.00410203f16, -0.00419109f16, 
+-0.00422621f16, -0.00421145f16, -0.00415106f16, 
+-0.00404947f16, -0.00391120f16, -0.00374080f16, 
+-0.00354286f16, -0.00332187f16, -0.00308229f16, 
+-0.00282838f16, -0.00256429f16, -0.00229391f16, 
+-0.00202093f16, -0.00174877f16, -0.00148057f16, 
+-0.00121916f16, -0.00096708f16, -0.00072654f16, 
+-0.00049943f16, -0.00028733f16, -0.00009150f16, 
+0.00008710f16, 0.00024783f16, 0.00039030f16, 
+0.00051439f16, 0.00062023f16, 0.00070817f16, 
+0.00077877f16, 0.00083276f16, 0.00087101f16, 
+0.00089454f16, 0.00090446f16, 0.00090198f16, 
+0.00088834f16, 0.00086483f16, 0.00083276f16, 
+0.00079344f16, 0.00074812f16, 0.00069807f16, 
+0.00064445f16, 0.00058839f16, 0.00053093f16, 
+0.00047303f16, 0.00041557f16, 0.00035931f16, 
+0.00030493f16, 0.00025301f16, 0.00020404f16, 
+0.00015839f16, 0.00011636f16, 0.00007816f16, 
+0.00004390f16, 0.00001364f16, -0.00001265f16, 
+-0.00003506f16, -0.00005371f16, -0.00006880f16, 
+-0.00008053f16, -0.00008917f16, -0.00009499f16, 
+-0.00009827f16, -0.00009930f16, -0.00009840f16, 
+-0.00009585f16, -0.00009194f16, -0.00008695f16, 
+-0.00008114f16, -0.00007474f16, -0.00006797f16, 
+-0.00006103f16, -0.00005409f16, -0.00004729f16, 
+-0.00004077f16, -0.00003461f16, -0.00002890f16, 
+-0.00002370f16, -0.00001902f16, -0.00001491f16, 
+-0.00001134f16, -0.00000832f16, -0.00000583f16, 
+-0.00000382f16, -0.00000225f16, -0.00000109f16, 
+-0.00000029f16, };
+
+channelizerconfig<float16_t> channelizerconfig4={
+   .nbChannels=32,
+   .nbTaps=8,
+   .coefs=channelizerCoefs4
+   };
 
+
+template<>
+const channelizerconfig<float16_t> *channelizer_config<float16_t>(uint32_t nbChannels,uint32_t nbTaps)
+{
+    if ((nbChannels == 16) && (nbTaps == 8))
+    {
+        return(&channelizerconfig3);
+    }
+    if ((nbChannels == 32) && (nbTaps == 8))
+    {
+        return(&channelizerconfig4);
     }
     return(NULL);
 }
 
+#endif
+
 
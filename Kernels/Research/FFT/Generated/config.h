@@ -16,14 +16,26 @@
 
 #define RADIX8
 
-#define DATATYPE_Q15
-
 #define DATATYPE_F16
 
 #define DATATYPE_F32
 
+#define DATATYPE_Q15
+
 #define DATATYPE_Q31
 
+#define DATATYPE_Q7
+
+#define RADIX_MASK_F16 0x13c
+
+#define RADIX_MASK_F32 0x13c
+
+#define RADIX_MASK_Q15 0x03c
+
+#define RADIX_MASK_Q31 0x03c
+
+#define RADIX_MASK_Q7 0x01c
+
 
 
 
@@ -8,6 +8,10 @@
 
 using namespace FFTSCI;
 
+#define FUNC_CFFT_Q7
+
+extern template const cfftconfig<Q7> *cfft_config<Q7>(uint32_t nbSamples);
+
 #define FUNC_CFFT_F32
 
 extern template const cfftconfig<float32_t> *cfft_config<float32_t>(uint32_t nbSamples);
@@ -27,6 +31,10 @@ extern template const cfftconfig<Q31> *cfft_config<Q31>(uint32_t nbSamples);
 
 extern template const cfftconfig<Q15> *cfft_config<Q15>(uint32_t nbSamples);
 
+#define FUNC_RFFT_Q7
+
+extern template const rfftconfig<Q7> *rfft_config<Q7>(uint32_t nbSamples);
+
 #define FUNC_RFFT_F32
 
 extern template const rfftconfig<float32_t> *rfft_config<float32_t>(uint32_t nbSamples);
@@ -46,6 +54,34 @@ extern template const rfftconfig<Q31> *rfft_config<Q31>(uint32_t nbSamples);
 
 extern template const rfftconfig<Q15> *rfft_config<Q15>(uint32_t nbSamples);
 
+#define FUNC_CFFT_Q31MIX
+
+
+#define FUNC_RFFT_Q31MIX
+
+
+#define FUNC_MFCC_F32
+
+extern template const mfccconfig<float32_t> *mfcc_config<float32_t>(uint32_t fftLen,uint32_t nbMel,uint32_t nbDct);
+
+#define FUNC_MFCC_F16
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+extern template const mfccconfig<float16_t> *mfcc_config<float16_t>(uint32_t fftLen,uint32_t nbMel,uint32_t nbDct);
+#endif
+
+
+#define FUNC_CHANNELIZER_F32
+
+extern template const channelizerconfig<float32_t> *channelizer_config<float32_t>(uint32_t nbChannels,uint32_t nbTaps);
+
+#define FUNC_CHANNELIZER_F16
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+extern template const channelizerconfig<float16_t> *channelizer_config<float16_t>(uint32_t nbChannels,uint32_t nbTaps);
+#endif
+
+
 
 
 #endif /* #ifdef CONFIG_FUNC_H */
@@ -0,0 +1,66 @@
+#ifndef KERNELS_H
+#define KERNELS_H
+
+
+
+
+
+#define RADIX_F16_2
+#define RADIX_F16_3
+#define RADIX_F16_4
+#define RADIX_F16_5
+#define RADIX_F16_8
+
+#define RADIX_F32_2
+#define RADIX_F32_3
+#define RADIX_F32_4
+#define RADIX_F32_5
+#define RADIX_F32_8
+
+#define RADIX_Q15_2
+#define RADIX_Q15_3
+#define RADIX_Q15_4
+#define RADIX_Q15_5
+
+#define RADIX_Q31_2
+#define RADIX_Q31_3
+#define RADIX_Q31_4
+#define RADIX_Q31_5
+
+#define RADIX_Q7_2
+#define RADIX_Q7_3
+#define RADIX_Q7_4
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+template<> struct radixused<float16_t,2>{ enum { value = 1 }; };
+template<> struct radixused<float16_t,3>{ enum { value = 1 }; };
+template<> struct radixused<float16_t,4>{ enum { value = 1 }; };
+template<> struct radixused<float16_t,5>{ enum { value = 1 }; };
+template<> struct radixused<float16_t,8>{ enum { value = 1 }; };
+#endif
+
+template<> struct radixused<float32_t,2>{ enum { value = 1 }; };
+template<> struct radixused<float32_t,3>{ enum { value = 1 }; };
+template<> struct radixused<float32_t,4>{ enum { value = 1 }; };
+template<> struct radixused<float32_t,5>{ enum { value = 1 }; };
+template<> struct radixused<float32_t,8>{ enum { value = 1 }; };
+
+template<> struct radixused<Q15,2>{ enum { value = 1 }; };
+template<> struct radixused<Q15,3>{ enum { value = 1 }; };
+template<> struct radixused<Q15,4>{ enum { value = 1 }; };
+template<> struct radixused<Q15,5>{ enum { value = 1 }; };
+
+template<> struct radixused<Q31,2>{ enum { value = 1 }; };
+template<> struct radixused<Q31,3>{ enum { value = 1 }; };
+template<> struct radixused<Q31,4>{ enum { value = 1 }; };
+template<> struct radixused<Q31,5>{ enum { value = 1 }; };
+
+template<> struct radixused<Q7,2>{ enum { value = 1 }; };
+template<> struct radixused<Q7,3>{ enum { value = 1 }; };
+template<> struct radixused<Q7,4>{ enum { value = 1 }; };
+
+
+
+
+#endif /* #ifdef KERNELS_H */
+
@@ -6,6 +6,8 @@
 
 #define DSPE_Q15 1
 
+#define DSPE_Q7 1
+
 
 #endif /* #ifdef MODE_H */
 
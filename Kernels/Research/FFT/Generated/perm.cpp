@@ -3,7391 +3,6043 @@
 #include "perm.h"
 
 __ALIGNED(8) const uint16_t perm1[NB_PERM1]={
-128, 4, 4, 
-256, 256, 8, 
-8, 16, 16, 
-32, 32, 64, 
-64, 2, 384, 
-12, 12, 272, 
-272, 40, 40, 
-80, 80, 34, 
-34, 192, 192, 
-6, 144, 36, 
-36, 320, 320, 
-10, 400, 44, 
-44, 336, 336, 
-42, 42, 208, 
-208, 38, 38, 
-448, 448, 14, 
-160, 68, 68, 
-258, 258, 136, 
-136, 20, 20, 
-288, 288, 72, 
-72, 18, 416, 
-76, 76, 274, 
-274, 168, 168, 
-84, 84, 290, 
-290, 200, 200, 
-22, 48, 96, 
-96, 66, 66, 
-130, 130, 132, 
-132, 260, 260, 
-264, 264, 24, 
-176, 100, 100, 
-322, 322, 138, 
-138, 148, 148, 
-292, 292, 328, 
-328, 26, 304, 
-104, 104, 82, 
-82, 162, 162, 
-196, 196, 262, 
-262, 392, 392, 
-28, 432, 108, 
-108, 338, 338, 
-170, 170, 212, 
-212, 294, 294, 
-456, 456, 30, 
-464, 46, 224, 
-70, 70, 386, 
-386, 140, 140, 
-276, 276, 296, 
-296, 88, 88, 
-50, 352, 74, 
-74, 146, 146, 
-164, 164, 324, 
-324, 266, 266, 
-152, 152, 52, 
-480, 78, 78, 
-402, 402, 172, 
-172, 340, 340, 
-298, 298, 216, 
-216, 54, 112, 
-98, 98, 194, 
-194, 134, 134, 
-388, 388, 268, 
-268, 280, 280, 
-56, 240, 102, 
-102, 450, 450, 
-142, 142, 404, 
-404, 300, 300, 
-344, 344, 58, 
-368, 106, 106, 
-210, 210, 166, 
-166, 452, 452, 
-270, 270, 408, 
-408, 60, 496, 
-110, 110, 466, 
-466, 174, 174, 
-468, 468, 302, 
-302, 472, 472, 
-62, 418, 204, 
-204, 278, 278, 
-424, 424, 92, 
-92, 306, 306, 
-232, 232, 86, 
-178, 228, 228, 
-326, 326, 394, 
-394, 156, 156, 
-308, 308, 360, 
-360, 90, 434, 
-236, 236, 342, 
-342, 426, 426, 
-220, 220, 310, 
-310, 488, 488, 
-94, 226, 198, 
-198, 390, 390, 
-396, 396, 284, 
-284, 312, 312, 
-120, 120, 114, 
-354, 202, 202, 
-150, 150, 420, 
-420, 332, 332, 
-282, 282, 184, 
-184, 116, 482, 
-206, 206, 406, 
-406, 428, 428, 
-348, 348, 314, 
-314, 248, 248, 
-118, 242, 230, 
-230, 454, 454, 
-398, 398, 412, 
-412, 316, 316, 
-376, 376, 122, 
-370, 234, 234, 
-214, 214, 422, 
-422, 460, 460, 
-286, 286, 440, 
-440, 124, 498, 
-238, 238, 470, 
-470, 430, 430, 
-476, 476, 318, 
-318, 504, 504, 
-126, 180, 356, 
-356, 330, 330, 
-154, 436, 364, 
-364, 346, 346, 
-186, 186, 244, 
-244, 358, 358, 
-458, 458, 158, 
-484, 334, 334, 
-410, 410, 188, 
-188, 372, 372, 
-362, 362, 218, 
-218, 182, 500, 
-366, 366, 474, 
-474, 190, 438, 
-492, 492, 350, 
-350, 442, 442, 
-252, 252, 374, 
-374, 490, 490, 
-222, 486, 462, 
-462, 414, 414, 
-444, 444, 380, 
-380, 378, 378, 
-250, 250, 246, 
-502, 494, 494, 
-478, 478, 446, 
-446, 508, 508, 
-382, 382, 506, 
-506, 254, };
+};
 __ALIGNED(8) const uint16_t perm2[NB_PERM2]={
-2048, 2, 4096, 
-4, 6144, 6, 
-512, 8, 2560, 
-10, 4608, 12, 
-6656, 14, 1024, 
-16, 3072, 18, 
-5120, 20, 7168, 
-22, 1536, 24, 
-3584, 26, 5632, 
-28, 7680, 30, 
-128, 32, 2176, 
-34, 4224, 36, 
-6272, 38, 640, 
-40, 2688, 42, 
-4736, 44, 6784, 
-46, 1152, 48, 
-3200, 50, 5248, 
-52, 7296, 54, 
-1664, 56, 3712, 
-58, 5760, 60, 
-7808, 62, 256, 
-64, 2304, 66, 
-4352, 68, 6400, 
-70, 768, 72, 
-2816, 74, 4864, 
-76, 6912, 78, 
-1280, 80, 3328, 
-82, 5376, 84, 
-7424, 86, 1792, 
-88, 3840, 90, 
-5888, 92, 7936, 
-94, 384, 96, 
-2432, 98, 4480, 
-100, 6528, 102, 
-896, 104, 2944, 
-106, 4992, 108, 
-7040, 110, 1408, 
-112, 3456, 114, 
-5504, 116, 7552, 
-118, 1920, 120, 
-3968, 122, 6016, 
-124, 8064, 126, 
-2080, 130, 4128, 
-132, 6176, 134, 
-544, 136, 2592, 
-138, 4640, 140, 
-6688, 142, 1056, 
-144, 3104, 146, 
-5152, 148, 7200, 
-150, 1568, 152, 
-3616, 154, 5664, 
-156, 7712, 158, 
-2208, 162, 4256, 
-164, 6304, 166, 
-672, 168, 2720, 
-170, 4768, 172, 
-6816, 174, 1184, 
-176, 3232, 178, 
-5280, 180, 7328, 
-182, 1696, 184, 
-3744, 186, 5792, 
-188, 7840, 190, 
-288, 192, 2336, 
-194, 4384, 196, 
-6432, 198, 800, 
-200, 2848, 202, 
-4896, 204, 6944, 
-206, 1312, 208, 
-3360, 210, 5408, 
-212, 7456, 214, 
-1824, 216, 3872, 
-218, 5920, 220, 
-7968, 222, 416, 
-224, 2464, 226, 
-4512, 228, 6560, 
-230, 928, 232, 
-2976, 234, 5024, 
-236, 7072, 238, 
-1440, 240, 3488, 
-242, 5536, 244, 
-7584, 246, 1952, 
-248, 4000, 250, 
-6048, 252, 8096, 
-254, 2112, 258, 
-4160, 260, 6208, 
-262, 576, 264, 
-2624, 266, 4672, 
-268, 6720, 270, 
-1088, 272, 3136, 
-274, 5184, 276, 
-7232, 278, 1600, 
-280, 3648, 282, 
-5696, 284, 7744, 
-286, 2240, 290, 
-4288, 292, 6336, 
-294, 704, 296, 
-2752, 298, 4800, 
-300, 6848, 302, 
-1216, 304, 3264, 
-306, 5312, 308, 
-7360, 310, 1728, 
-312, 3776, 314, 
-5824, 316, 7872, 
-318, 2368, 322, 
-4416, 324, 6464, 
-326, 832, 328, 
-2880, 330, 4928, 
-332, 6976, 334, 
-1344, 336, 3392, 
-338, 5440, 340, 
-7488, 342, 1856, 
-344, 3904, 346, 
-5952, 348, 8000, 
-350, 448, 352, 
-2496, 354, 4544, 
-356, 6592, 358, 
-960, 360, 3008, 
-362, 5056, 364, 
-7104, 366, 1472, 
-368, 3520, 370, 
-5568, 372, 7616, 
-374, 1984, 376, 
-4032, 378, 6080, 
-380, 8128, 382, 
-2144, 386, 4192, 
-388, 6240, 390, 
-608, 392, 2656, 
-394, 4704, 396, 
-6752, 398, 1120, 
-400, 3168, 402, 
-5216, 404, 7264, 
-406, 1632, 408, 
-3680, 410, 5728, 
-412, 7776, 414, 
-2272, 418, 4320, 
-420, 6368, 422, 
-736, 424, 2784, 
-426, 4832, 428, 
-6880, 430, 1248, 
-432, 3296, 434, 
-5344, 436, 7392, 
-438, 1760, 440, 
-3808, 442, 5856, 
-444, 7904, 446, 
-2400, 450, 4448, 
-452, 6496, 454, 
-864, 456, 2912, 
-458, 4960, 460, 
-7008, 462, 1376, 
-464, 3424, 466, 
-5472, 468, 7520, 
-470, 1888, 472, 
-3936, 474, 5984, 
-476, 8032, 478, 
-2528, 482, 4576, 
-484, 6624, 486, 
-992, 488, 3040, 
-490, 5088, 492, 
-7136, 494, 1504, 
-496, 3552, 498, 
-5600, 500, 7648, 
-502, 2016, 504, 
-4064, 506, 6112, 
-508, 8160, 510, 
-2056, 514, 4104, 
-516, 6152, 518, 
-2568, 522, 4616, 
-524, 6664, 526, 
-1032, 528, 3080, 
-530, 5128, 532, 
-7176, 534, 1544, 
-536, 3592, 538, 
-5640, 540, 7688, 
-542, 2184, 546, 
-4232, 548, 6280, 
-550, 648, 552, 
-2696, 554, 4744, 
-556, 6792, 558, 
-1160, 560, 3208, 
-562, 5256, 564, 
-7304, 566, 1672, 
-568, 3720, 570, 
-5768, 572, 7816, 
-574, 2312, 578, 
-4360, 580, 6408, 
-582, 776, 584, 
-2824, 586, 4872, 
-588, 6920, 590, 
-1288, 592, 3336, 
-594, 5384, 596, 
-7432, 598, 1800, 
-600, 3848, 602, 
-5896, 604, 7944, 
-606, 2440, 610, 
-4488, 612, 6536, 
-614, 904, 616, 
-2952, 618, 5000, 
-620, 7048, 622, 
-1416, 624, 3464, 
-626, 5512, 628, 
-7560, 630, 1928, 
-632, 3976, 634, 
-6024, 636, 8072, 
-638, 2088, 642, 
-4136, 644, 6184, 
-646, 2600, 650, 
-4648, 652, 6696, 
-654, 1064, 656, 
-3112, 658, 5160, 
-660, 7208, 662, 
-1576, 664, 3624, 
-666, 5672, 668, 
-7720, 670, 2216, 
-674, 4264, 676, 
-6312, 678, 2728, 
-682, 4776, 684, 
-6824, 686, 1192, 
-688, 3240, 690, 
-5288, 692, 7336, 
-694, 1704, 696, 
-3752, 698, 5800, 
-700, 7848, 702, 
-2344, 706, 4392, 
-708, 6440, 710, 
-808, 712, 2856, 
-714, 4904, 716, 
-6952, 718, 1320, 
-720, 3368, 722, 
-5416, 724, 7464, 
-726, 1832, 728, 
-3880, 730, 5928, 
-732, 7976, 734, 
-2472, 738, 4520, 
-740, 6568, 742, 
-936, 744, 2984, 
-746, 5032, 748, 
-7080, 750, 1448, 
-752, 3496, 754, 
-5544, 756, 7592, 
-758, 1960, 760, 
-4008, 762, 6056, 
-764, 8104, 766, 
-2120, 770, 4168, 
-772, 6216, 774, 
-2632, 778, 4680, 
-780, 6728, 782, 
-1096, 784, 3144, 
-786, 5192, 788, 
-7240, 790, 1608, 
-792, 3656, 794, 
-5704, 796, 7752, 
-798, 2248, 802, 
-4296, 804, 6344, 
-806, 2760, 810, 
-4808, 812, 6856, 
-814, 1224, 816, 
-3272, 818, 5320, 
-820, 7368, 822, 
-1736, 824, 3784, 
-826, 5832, 828, 
-7880, 830, 2376, 
-834, 4424, 836, 
-6472, 838, 2888, 
-842, 4936, 844, 
-6984, 846, 1352, 
-848, 3400, 850, 
-5448, 852, 7496, 
-854, 1864, 856, 
-3912, 858, 5960, 
-860, 8008, 862, 
-2504, 866, 4552, 
-868, 6600, 870, 
-968, 872, 3016, 
-874, 5064, 876, 
-7112, 878, 1480, 
-880, 3528, 882, 
-5576, 884, 7624, 
-886, 1992, 888, 
-4040, 890, 6088, 
-892, 8136, 894, 
-2152, 898, 4200, 
-900, 6248, 902, 
-2664, 906, 4712, 
-908, 6760, 910, 
-1128, 912, 3176, 
-914, 5224, 916, 
-7272, 918, 1640, 
-920, 3688, 922, 
-5736, 924, 7784, 
-926, 2280, 930, 
-4328, 932, 6376, 
-934, 2792, 938, 
-4840, 940, 6888, 
-942, 1256, 944, 
-3304, 946, 5352, 
-948, 7400, 950, 
-1768, 952, 3816, 
-954, 5864, 956, 
-7912, 958, 2408, 
-962, 4456, 964, 
-6504, 966, 2920, 
-970, 4968, 972, 
-7016, 974, 1384, 
-976, 3432, 978, 
-5480, 980, 7528, 
-982, 1896, 984, 
-3944, 986, 5992, 
-988, 8040, 990, 
-2536, 994, 4584, 
-996, 6632, 998, 
-3048, 1002, 5096, 
-1004, 7144, 1006, 
-1512, 1008, 3560, 
-1010, 5608, 1012, 
-7656, 1014, 2024, 
-1016, 4072, 1018, 
-6120, 1020, 8168, 
-1022, 2064, 1026, 
-4112, 1028, 6160, 
-1030, 2576, 1034, 
-4624, 1036, 6672, 
-1038, 3088, 1042, 
-5136, 1044, 7184, 
-1046, 1552, 1048, 
-3600, 1050, 5648, 
-1052, 7696, 1054, 
-2192, 1058, 4240, 
-1060, 6288, 1062, 
-2704, 1066, 4752, 
-1068, 6800, 1070, 
-1168, 1072, 3216, 
-1074, 5264, 1076, 
-7312, 1078, 1680, 
-1080, 3728, 1082, 
-5776, 1084, 7824, 
-1086, 2320, 1090, 
-4368, 1092, 6416, 
-1094, 2832, 1098, 
-4880, 1100, 6928, 
-1102, 1296, 1104, 
-3344, 1106, 5392, 
-1108, 7440, 1110, 
-1808, 1112, 3856, 
-1114, 5904, 1116, 
-7952, 1118, 2448, 
-1122, 4496, 1124, 
-6544, 1126, 2960, 
-1130, 5008, 1132, 
-7056, 1134, 1424, 
-1136, 3472, 1138, 
-5520, 1140, 7568, 
-1142, 1936, 1144, 
-3984, 1146, 6032, 
-1148, 8080, 1150, 
-2096, 1154, 4144, 
-1156, 6192, 1158, 
-2608, 1162, 4656, 
-1164, 6704, 1166, 
-3120, 1170, 5168, 
-1172, 7216, 1174, 
-1584, 1176, 3632, 
-1178, 5680, 1180, 
-7728, 1182, 2224, 
-1186, 4272, 1188, 
-6320, 1190, 2736, 
-1194, 4784, 1196, 
-6832, 1198, 3248, 
-1202, 5296, 1204, 
-7344, 1206, 1712, 
-1208, 3760, 1210, 
-5808, 1212, 7856, 
-1214, 2352, 1218, 
-4400, 1220, 6448, 
-1222, 2864, 1226, 
-4912, 1228, 6960, 
-1230, 1328, 1232, 
-3376, 1234, 5424, 
-1236, 7472, 1238, 
-1840, 1240, 3888, 
-1242, 5936, 1244, 
-7984, 1246, 2480, 
-1250, 4528, 1252, 
-6576, 1254, 2992, 
-1258, 5040, 1260, 
-7088, 1262, 1456, 
-1264, 3504, 1266, 
-5552, 1268, 7600, 
-1270, 1968, 1272, 
-4016, 1274, 6064, 
-1276, 8112, 1278, 
-2128, 1282, 4176, 
-1284, 6224, 1286, 
-2640, 1290, 4688, 
-1292, 6736, 1294, 
-3152, 1298, 5200, 
-1300, 7248, 1302, 
-1616, 1304, 3664, 
-1306, 5712, 1308, 
-7760, 1310, 2256, 
-1314, 4304, 1316, 
-6352, 1318, 2768, 
-1322, 4816, 1324, 
-6864, 1326, 3280, 
-1330, 5328, 1332, 
-7376, 1334, 1744, 
-1336, 3792, 1338, 
-5840, 1340, 7888, 
-1342, 2384, 1346, 
-4432, 1348, 6480, 
-1350, 2896, 1354, 
-4944, 1356, 6992, 
-1358, 3408, 1362, 
-5456, 1364, 7504, 
-1366, 1872, 1368, 
-3920, 1370, 5968, 
-1372, 8016, 1374, 
-2512, 1378, 4560, 
-1380, 6608, 1382, 
-3024, 1386, 5072, 
-1388, 7120, 1390, 
-1488, 1392, 3536, 
-1394, 5584, 1396, 
-7632, 1398, 2000, 
-1400, 4048, 1402, 
-6096, 1404, 8144, 
-1406, 2160, 1410, 
-4208, 1412, 6256, 
-1414, 2672, 1418, 
-4720, 1420, 6768, 
-1422, 3184, 1426, 
-5232, 1428, 7280, 
-1430, 1648, 1432, 
-3696, 1434, 5744, 
-1436, 7792, 1438, 
-2288, 1442, 4336, 
-1444, 6384, 1446, 
-2800, 1450, 4848, 
-1452, 6896, 1454, 
-3312, 1458, 5360, 
-1460, 7408, 1462, 
-1776, 1464, 3824, 
-1466, 5872, 1468, 
-7920, 1470, 2416, 
-1474, 4464, 1476, 
-6512, 1478, 2928, 
-1482, 4976, 1484, 
-7024, 1486, 3440, 
-1490, 5488, 1492, 
-7536, 1494, 1904, 
-1496, 3952, 1498, 
-6000, 1500, 8048, 
-1502, 2544, 1506, 
-4592, 1508, 6640, 
-1510, 3056, 1514, 
-5104, 1516, 7152, 
-1518, 3568, 1522, 
-5616, 1524, 7664, 
-1526, 2032, 1528, 
-4080, 1530, 6128, 
-1532, 8176, 1534, 
-2072, 1538, 4120, 
-1540, 6168, 1542, 
-2584, 1546, 4632, 
-1548, 6680, 1550, 
-3096, 1554, 5144, 
-1556, 7192, 1558, 
-3608, 1562, 5656, 
-1564, 7704, 1566, 
-2200, 1570, 4248, 
-1572, 6296, 1574, 
-2712, 1578, 4760, 
-1580, 6808, 1582, 
-3224, 1586, 5272, 
-1588, 7320, 1590, 
-1688, 1592, 3736, 
-1594, 5784, 1596, 
-7832, 1598, 2328, 
-1602, 4376, 1604, 
-6424, 1606, 2840, 
-1610, 4888, 1612, 
-6936, 1614, 3352, 
-1618, 5400, 1620, 
-7448, 1622, 1816, 
-1624, 3864, 1626, 
-5912, 1628, 7960, 
-1630, 2456, 1634, 
-4504, 1636, 6552, 
-1638, 2968, 1642, 
-5016, 1644, 7064, 
-1646, 3480, 1650, 
-5528, 1652, 7576, 
-1654, 1944, 1656, 
-3992, 1658, 6040, 
-1660, 8088, 1662, 
-2104, 1666, 4152, 
-1668, 6200, 1670, 
-2616, 1674, 4664, 
-1676, 6712, 1678, 
-3128, 1682, 5176, 
-1684, 7224, 1686, 
-3640, 1690, 5688, 
-1692, 7736, 1694, 
-2232, 1698, 4280, 
-1700, 6328, 1702, 
-2744, 1706, 4792, 
-1708, 6840, 1710, 
-3256, 1714, 5304, 
-1716, 7352, 1718, 
-3768, 1722, 5816, 
-1724, 7864, 1726, 
-2360, 1730, 4408, 
-1732, 6456, 1734, 
-2872, 1738, 4920, 
-1740, 6968, 1742, 
-3384, 1746, 5432, 
-1748, 7480, 1750, 
-1848, 1752, 3896, 
-1754, 5944, 1756, 
-7992, 1758, 2488, 
-1762, 4536, 1764, 
-6584, 1766, 3000, 
-1770, 5048, 1772, 
-7096, 1774, 3512, 
-1778, 5560, 1780, 
-7608, 1782, 1976, 
-1784, 4024, 1786, 
-6072, 1788, 8120, 
-1790, 2136, 1794, 
-4184, 1796, 6232, 
-1798, 2648, 1802, 
-4696, 1804, 6744, 
-1806, 3160, 1810, 
-5208, 1812, 7256, 
-1814, 3672, 1818, 
-5720, 1820, 7768, 
-1822, 2264, 1826, 
-4312, 1828, 6360, 
-1830, 2776, 1834, 
-4824, 1836, 6872, 
-1838, 3288, 1842, 
-5336, 1844, 7384, 
-1846, 3800, 1850, 
-5848, 1852, 7896, 
-1854, 2392, 1858, 
-4440, 1860, 6488, 
-1862, 2904, 1866, 
-4952, 1868, 7000, 
-1870, 3416, 1874, 
-5464, 1876, 7512, 
-1878, 3928, 1882, 
-5976, 1884, 8024, 
-1886, 2520, 1890, 
-4568, 1892, 6616, 
-1894, 3032, 1898, 
-5080, 1900, 7128, 
-1902, 3544, 1906, 
-5592, 1908, 7640, 
-1910, 2008, 1912, 
-4056, 1914, 6104, 
-1916, 8152, 1918, 
-2168, 1922, 4216, 
-1924, 6264, 1926, 
-2680, 1930, 4728, 
-1932, 6776, 1934, 
-3192, 1938, 5240, 
-1940, 7288, 1942, 
-3704, 1946, 5752, 
-1948, 7800, 1950, 
-2296, 1954, 4344, 
-1956, 6392, 1958, 
-2808, 1962, 4856, 
-1964, 6904, 1966, 
-3320, 1970, 5368, 
-1972, 7416, 1974, 
-3832, 1978, 5880, 
-1980, 7928, 1982, 
-2424, 1986, 4472, 
-1988, 6520, 1990, 
-2936, 1994, 4984, 
-1996, 7032, 1998, 
-3448, 2002, 5496, 
-2004, 7544, 2006, 
-3960, 2010, 6008, 
-2012, 8056, 2014, 
-2552, 2018, 4600, 
-2020, 6648, 2022, 
-3064, 2026, 5112, 
-2028, 7160, 2030, 
-3576, 2034, 5624, 
-2036, 7672, 2038, 
-4088, 2042, 6136, 
-2044, 8184, 2046, 
-4098, 2052, 6146, 
-2054, 2562, 2058, 
-4610, 2060, 6658, 
-2062, 3074, 2066, 
-5122, 2068, 7170, 
-2070, 3586, 2074, 
-5634, 2076, 7682, 
-2078, 2178, 2082, 
-4226, 2084, 6274, 
-2086, 2690, 2090, 
-4738, 2092, 6786, 
-2094, 3202, 2098, 
-5250, 2100, 7298, 
-2102, 3714, 2106, 
-5762, 2108, 7810, 
-2110, 2306, 2114, 
-4354, 2116, 6402, 
-2118, 2818, 2122, 
-4866, 2124, 6914, 
-2126, 3330, 2130, 
-5378, 2132, 7426, 
-2134, 3842, 2138, 
-5890, 2140, 7938, 
-2142, 2434, 2146, 
-4482, 2148, 6530, 
-2150, 2946, 2154, 
-4994, 2156, 7042, 
-2158, 3458, 2162, 
-5506, 2164, 7554, 
-2166, 3970, 2170, 
-6018, 2172, 8066, 
-2174, 4130, 2180, 
-6178, 2182, 2594, 
-2186, 4642, 2188, 
-6690, 2190, 3106, 
-2194, 5154, 2196, 
-7202, 2198, 3618, 
-2202, 5666, 2204, 
-7714, 2206, 4258, 
-2212, 6306, 2214, 
-2722, 2218, 4770, 
-2220, 6818, 2222, 
-3234, 2226, 5282, 
-2228, 7330, 2230, 
-3746, 2234, 5794, 
-2236, 7842, 2238, 
-2338, 2242, 4386, 
-2244, 6434, 2246, 
-2850, 2250, 4898, 
-2252, 6946, 2254, 
-3362, 2258, 5410, 
-2260, 7458, 2262, 
-3874, 2266, 5922, 
-2268, 7970, 2270, 
-2466, 2274, 4514, 
-2276, 6562, 2278, 
-2978, 2282, 5026, 
-2284, 7074, 2286, 
-3490, 2290, 5538, 
-2292, 7586, 2294, 
-4002, 2298, 6050, 
-2300, 8098, 2302, 
-4162, 2308, 6210, 
-2310, 2626, 2314, 
-4674, 2316, 6722, 
-2318, 3138, 2322, 
-5186, 2324, 7234, 
-2326, 3650, 2330, 
-5698, 2332, 7746, 
-2334, 4290, 2340, 
-6338, 2342, 2754, 
-2346, 4802, 2348, 
-6850, 2350, 3266, 
-2354, 5314, 2356, 
-7362, 2358, 3778, 
-2362, 5826, 2364, 
-7874, 2366, 4418, 
-2372, 6466, 2374, 
-2882, 2378, 4930, 
-2380, 6978, 2382, 
-3394, 2386, 5442, 
-2388, 7490, 2390, 
-3906, 2394, 5954, 
-2396, 8002, 2398, 
-2498, 2402, 4546, 
-2404, 6594, 2406, 
-3010, 2410, 5058, 
-2412, 7106, 2414, 
-3522, 2418, 5570, 
-2420, 7618, 2422, 
-4034, 2426, 6082, 
-2428, 8130, 2430, 
-4194, 2436, 6242, 
-2438, 2658, 2442, 
-4706, 2444, 6754, 
-2446, 3170, 2450, 
-5218, 2452, 7266, 
-2454, 3682, 2458, 
-5730, 2460, 7778, 
-2462, 4322, 2468, 
-6370, 2470, 2786, 
-2474, 4834, 2476, 
-6882, 2478, 3298, 
-2482, 5346, 2484, 
-7394, 2486, 3810, 
-2490, 5858, 2492, 
-7906, 2494, 4450, 
-2500, 6498, 2502, 
-2914, 2506, 4962, 
-2508, 7010, 2510, 
-3426, 2514, 5474, 
-2516, 7522, 2518, 
-3938, 2522, 5986, 
-2524, 8034, 2526, 
-4578, 2532, 6626, 
-2534, 3042, 2538, 
-5090, 2540, 7138, 
-2542, 3554, 2546, 
-5602, 2548, 7650, 
-2550, 4066, 2554, 
-6114, 2556, 8162, 
-2558, 4106, 2564, 
-6154, 2566, 4618, 
-2572, 6666, 2574, 
-3082, 2578, 5130, 
-2580, 7178, 2582, 
-3594, 2586, 5642, 
-2588, 7690, 2590, 
-4234, 2596, 6282, 
-2598, 2698, 2602, 
-4746, 2604, 6794, 
-2606, 3210, 2610, 
-5258, 2612, 7306, 
-2614, 3722, 2618, 
-5770, 2620, 7818, 
-2622, 4362, 2628, 
-6410, 2630, 2826, 
-2634, 4874, 2636, 
-6922, 2638, 3338, 
-2642, 5386, 2644, 
-7434, 2646, 3850, 
-2650, 5898, 2652, 
-7946, 2654, 4490, 
-2660, 6538, 2662, 
-2954, 2666, 5002, 
-2668, 7050, 2670, 
-3466, 2674, 5514, 
-2676, 7562, 2678, 
-3978, 2682, 6026, 
-2684, 8074, 2686, 
-4138, 2692, 6186, 
-2694, 4650, 2700, 
-6698, 2702, 3114, 
-2706, 5162, 2708, 
-7210, 2710, 3626, 
-2714, 5674, 2716, 
-7722, 2718, 4266, 
-2724, 6314, 2726, 
-4778, 2732, 6826, 
-2734, 3242, 2738, 
-5290, 2740, 7338, 
-2742, 3754, 2746, 
-5802, 2748, 7850, 
-2750, 4394, 2756, 
-6442, 2758, 2858, 
-2762, 4906, 2764, 
-6954, 2766, 3370, 
-2770, 5418, 2772, 
-7466, 2774, 3882, 
-2778, 5930, 2780, 
-7978, 2782, 4522, 
-2788, 6570, 2790, 
-2986, 2794, 5034, 
-2796, 7082, 2798, 
-3498, 2802, 5546, 
-2804, 7594, 2806, 
-4010, 2810, 6058, 
-2812, 8106, 2814, 
-4170, 2820, 6218, 
-2822, 4682, 2828, 
-6730, 2830, 3146, 
-2834, 5194, 2836, 
-7242, 2838, 3658, 
-2842, 5706, 2844, 
-7754, 2846, 4298, 
-2852, 6346, 2854, 
-4810, 2860, 6858, 
-2862, 3274, 2866, 
-5322, 2868, 7370, 
-2870, 3786, 2874, 
-5834, 2876, 7882, 
-2878, 4426, 2884, 
-6474, 2886, 4938, 
-2892, 6986, 2894, 
-3402, 2898, 5450, 
-2900, 7498, 2902, 
-3914, 2906, 5962, 
-2908, 8010, 2910, 
-4554, 2916, 6602, 
-2918, 3018, 2922, 
-5066, 2924, 7114, 
-2926, 3530, 2930, 
-5578, 2932, 7626, 
-2934, 4042, 2938, 
-6090, 2940, 8138, 
-2942, 4202, 2948, 
-6250, 2950, 4714, 
-2956, 6762, 2958, 
-3178, 2962, 5226, 
-2964, 7274, 2966, 
-3690, 2970, 5738, 
-2972, 7786, 2974, 
-4330, 2980, 6378, 
-2982, 4842, 2988, 
-6890, 2990, 3306, 
-2994, 5354, 2996, 
-7402, 2998, 3818, 
-3002, 5866, 3004, 
-7914, 3006, 4458, 
-3012, 6506, 3014, 
-4970, 3020, 7018, 
-3022, 3434, 3026, 
-5482, 3028, 7530, 
-3030, 3946, 3034, 
-5994, 3036, 8042, 
-3038, 4586, 3044, 
-6634, 3046, 5098, 
-3052, 7146, 3054, 
-3562, 3058, 5610, 
-3060, 7658, 3062, 
-4074, 3066, 6122, 
-3068, 8170, 3070, 
-4114, 3076, 6162, 
-3078, 4626, 3084, 
-6674, 3086, 5138, 
-3092, 7186, 3094, 
-3602, 3098, 5650, 
-3100, 7698, 3102, 
-4242, 3108, 6290, 
-3110, 4754, 3116, 
-6802, 3118, 3218, 
-3122, 5266, 3124, 
-7314, 3126, 3730, 
-3130, 5778, 3132, 
-7826, 3134, 4370, 
-3140, 6418, 3142, 
-4882, 3148, 6930, 
-3150, 3346, 3154, 
-5394, 3156, 7442, 
-3158, 3858, 3162, 
-5906, 3164, 7954, 
-3166, 4498, 3172, 
-6546, 3174, 5010, 
-3180, 7058, 3182, 
-3474, 3186, 5522, 
-3188, 7570, 3190, 
-3986, 3194, 6034, 
-3196, 8082, 3198, 
-4146, 3204, 6194, 
-3206, 4658, 3212, 
-6706, 3214, 5170, 
-3220, 7218, 3222, 
-3634, 3226, 5682, 
-3228, 7730, 3230, 
-4274, 3236, 6322, 
-3238, 4786, 3244, 
-6834, 3246, 5298, 
-3252, 7346, 3254, 
-3762, 3258, 5810, 
-3260, 7858, 3262, 
-4402, 3268, 6450, 
-3270, 4914, 3276, 
-6962, 3278, 3378, 
-3282, 5426, 3284, 
-7474, 3286, 3890, 
-3290, 5938, 3292, 
-7986, 3294, 4530, 
-3300, 6578, 3302, 
-5042, 3308, 7090, 
-3310, 3506, 3314, 
-5554, 3316, 7602, 
-3318, 4018, 3322, 
-6066, 3324, 8114, 
-3326, 4178, 3332, 
-6226, 3334, 4690, 
-3340, 6738, 3342, 
-5202, 3348, 7250, 
-3350, 3666, 3354, 
-5714, 3356, 7762, 
-3358, 4306, 3364, 
-6354, 3366, 4818, 
-3372, 6866, 3374, 
-5330, 3380, 7378, 
-3382, 3794, 3386, 
-5842, 3388, 7890, 
-3390, 4434, 3396, 
-6482, 3398, 4946, 
-3404, 6994, 3406, 
-5458, 3412, 7506, 
-3414, 3922, 3418, 
-5970, 3420, 8018, 
-3422, 4562, 3428, 
-6610, 3430, 5074, 
-3436, 7122, 3438, 
-3538, 3442, 5586, 
-3444, 7634, 3446, 
-4050, 3450, 6098, 
-3452, 8146, 3454, 
-4210, 3460, 6258, 
-3462, 4722, 3468, 
-6770, 3470, 5234, 
-3476, 7282, 3478, 
-3698, 3482, 5746, 
-3484, 7794, 3486, 
-4338, 3492, 6386, 
-3494, 4850, 3500, 
-6898, 3502, 5362, 
-3508, 7410, 3510, 
-3826, 3514, 5874, 
-3516, 7922, 3518, 
-4466, 3524, 6514, 
-3526, 4978, 3532, 
-7026, 3534, 5490, 
-3540, 7538, 3542, 
-3954, 3546, 6002, 
-3548, 8050, 3550, 
-4594, 3556, 6642, 
-3558, 5106, 3564, 
-7154, 3566, 5618, 
-3572, 7666, 3574, 
-4082, 3578, 6130, 
-3580, 8178, 3582, 
-4122, 3588, 6170, 
-3590, 4634, 3596, 
-6682, 3598, 5146, 
-3604, 7194, 3606, 
-5658, 3612, 7706, 
-3614, 4250, 3620, 
-6298, 3622, 4762, 
-3628, 6810, 3630, 
-5274, 3636, 7322, 
-3638, 3738, 3642, 
-5786, 3644, 7834, 
-3646, 4378, 3652, 
-6426, 3654, 4890, 
-3660, 6938, 3662, 
-5402, 3668, 7450, 
-3670, 3866, 3674, 
-5914, 3676, 7962, 
-3678, 4506, 3684, 
-6554, 3686, 5018, 
-3692, 7066, 3694, 
-5530, 3700, 7578, 
-3702, 3994, 3706, 
-6042, 3708, 8090, 
-3710, 4154, 3716, 
-6202, 3718, 4666, 
-3724, 6714, 3726, 
-5178, 3732, 7226, 
-3734, 5690, 3740, 
-7738, 3742, 4282, 
-3748, 6330, 3750, 
-4794, 3756, 6842, 
-3758, 5306, 3764, 
-7354, 3766, 5818, 
-3772, 7866, 3774, 
-4410, 3780, 6458, 
-3782, 4922, 3788, 
-6970, 3790, 5434, 
-3796, 7482, 3798, 
-3898, 3802, 5946, 
-3804, 7994, 3806, 
-4538, 3812, 6586, 
-3814, 5050, 3820, 
-7098, 3822, 5562, 
-3828, 7610, 3830, 
-4026, 3834, 6074, 
-3836, 8122, 3838, 
-4186, 3844, 6234, 
-3846, 4698, 3852, 
-6746, 3854, 5210, 
-3860, 7258, 3862, 
-5722, 3868, 7770, 
-3870, 4314, 3876, 
-6362, 3878, 4826, 
-3884, 6874, 3886, 
-5338, 3892, 7386, 
-3894, 5850, 3900, 
-7898, 3902, 4442, 
-3908, 6490, 3910, 
-4954, 3916, 7002, 
-3918, 5466, 3924, 
-7514, 3926, 5978, 
-3932, 8026, 3934, 
-4570, 3940, 6618, 
-3942, 5082, 3948, 
-7130, 3950, 5594, 
-3956, 7642, 3958, 
-4058, 3962, 6106, 
-3964, 8154, 3966, 
-4218, 3972, 6266, 
-3974, 4730, 3980, 
-6778, 3982, 5242, 
-3988, 7290, 3990, 
-5754, 3996, 7802, 
-3998, 4346, 4004, 
-6394, 4006, 4858, 
-4012, 6906, 4014, 
-5370, 4020, 7418, 
-4022, 5882, 4028, 
-7930, 4030, 4474, 
-4036, 6522, 4038, 
-4986, 4044, 7034, 
-4046, 5498, 4052, 
-7546, 4054, 6010, 
-4060, 8058, 4062, 
-4602, 4068, 6650, 
-4070, 5114, 4076, 
-7162, 4078, 5626, 
-4084, 7674, 4086, 
-6138, 4092, 8186, 
-4094, 6148, 4102, 
-4612, 4108, 6660, 
-4110, 5124, 4116, 
-7172, 4118, 5636, 
-4124, 7684, 4126, 
-4228, 4132, 6276, 
-4134, 4740, 4140, 
-6788, 4142, 5252, 
-4148, 7300, 4150, 
-5764, 4156, 7812, 
-4158, 4356, 4164, 
-6404, 4166, 4868, 
-4172, 6916, 4174, 
-5380, 4180, 7428, 
-4182, 5892, 4188, 
-7940, 4190, 4484, 
-4196, 6532, 4198, 
-4996, 4204, 7044, 
-4206, 5508, 4212, 
-7556, 4214, 6020, 
-4220, 8068, 4222, 
-6180, 4230, 4644, 
-4236, 6692, 4238, 
-5156, 4244, 7204, 
-4246, 5668, 4252, 
-7716, 4254, 6308, 
-4262, 4772, 4268, 
-6820, 4270, 5284, 
-4276, 7332, 4278, 
-5796, 4284, 7844, 
-4286, 4388, 4292, 
-6436, 4294, 4900, 
-4300, 6948, 4302, 
-5412, 4308, 7460, 
-4310, 5924, 4316, 
-7972, 4318, 4516, 
-4324, 6564, 4326, 
-5028, 4332, 7076, 
-4334, 5540, 4340, 
-7588, 4342, 6052, 
-4348, 8100, 4350, 
-6212, 4358, 4676, 
-4364, 6724, 4366, 
-5188, 4372, 7236, 
-4374, 5700, 4380, 
-7748, 4382, 6340, 
-4390, 4804, 4396, 
-6852, 4398, 5316, 
-4404, 7364, 4406, 
-5828, 4412, 7876, 
-4414, 6468, 4422, 
-4932, 4428, 6980, 
-4430, 5444, 4436, 
-7492, 4438, 5956, 
-4444, 8004, 4446, 
-4548, 4452, 6596, 
-4454, 5060, 4460, 
-7108, 4462, 5572, 
-4468, 7620, 4470, 
-6084, 4476, 8132, 
-4478, 6244, 4486, 
-4708, 4492, 6756, 
-4494, 5220, 4500, 
-7268, 4502, 5732, 
-4508, 7780, 4510, 
-6372, 4518, 4836, 
-4524, 6884, 4526, 
-5348, 4532, 7396, 
-4534, 5860, 4540, 
-7908, 4542, 6500, 
-4550, 4964, 4556, 
-7012, 4558, 5476, 
-4564, 7524, 4566, 
-5988, 4572, 8036, 
-4574, 6628, 4582, 
-5092, 4588, 7140, 
-4590, 5604, 4596, 
-7652, 4598, 6116, 
-4604, 8164, 4606, 
-6156, 4614, 6668, 
-4622, 5132, 4628, 
-7180, 4630, 5644, 
-4636, 7692, 4638, 
-6284, 4646, 4748, 
-4652, 6796, 4654, 
-5260, 4660, 7308, 
-4662, 5772, 4668, 
-7820, 4670, 6412, 
-4678, 4876, 4684, 
-6924, 4686, 5388, 
-4692, 7436, 4694, 
-5900, 4700, 7948, 
-4702, 6540, 4710, 
-5004, 4716, 7052, 
-4718, 5516, 4724, 
-7564, 4726, 6028, 
-4732, 8076, 4734, 
-6188, 4742, 6700, 
-4750, 5164, 4756, 
-7212, 4758, 5676, 
-4764, 7724, 4766, 
-6316, 4774, 6828, 
-4782, 5292, 4788, 
-7340, 4790, 5804, 
-4796, 7852, 4798, 
-6444, 4806, 4908, 
-4812, 6956, 4814, 
-5420, 4820, 7468, 
-4822, 5932, 4828, 
-7980, 4830, 6572, 
-4838, 5036, 4844, 
-7084, 4846, 5548, 
-4852, 7596, 4854, 
-6060, 4860, 8108, 
-4862, 6220, 4870, 
-6732, 4878, 5196, 
-4884, 7244, 4886, 
-5708, 4892, 7756, 
-4894, 6348, 4902, 
-6860, 4910, 5324, 
-4916, 7372, 4918, 
-5836, 4924, 7884, 
-4926, 6476, 4934, 
-6988, 4942, 5452, 
-4948, 7500, 4950, 
-5964, 4956, 8012, 
-4958, 6604, 4966, 
-5068, 4972, 7116, 
-4974, 5580, 4980, 
-7628, 4982, 6092, 
-4988, 8140, 4990, 
-6252, 4998, 6764, 
-5006, 5228, 5012, 
-7276, 5014, 5740, 
-5020, 7788, 5022, 
-6380, 5030, 6892, 
-5038, 5356, 5044, 
-7404, 5046, 5868, 
-5052, 7916, 5054, 
-6508, 5062, 7020, 
-5070, 5484, 5076, 
-7532, 5078, 5996, 
-5084, 8044, 5086, 
-6636, 5094, 7148, 
-5102, 5612, 5108, 
-7660, 5110, 6124, 
-5116, 8172, 5118, 
-6164, 5126, 6676, 
-5134, 7188, 5142, 
-5652, 5148, 7700, 
-5150, 6292, 5158, 
-6804, 5166, 5268, 
-5172, 7316, 5174, 
-5780, 5180, 7828, 
-5182, 6420, 5190, 
-6932, 5198, 5396, 
-5204, 7444, 5206, 
-5908, 5212, 7956, 
-5214, 6548, 5222, 
-7060, 5230, 5524, 
-5236, 7572, 5238, 
-6036, 5244, 8084, 
-5246, 6196, 5254, 
-6708, 5262, 7220, 
-5270, 5684, 5276, 
-7732, 5278, 6324, 
-5286, 6836, 5294, 
-7348, 5302, 5812, 
-5308, 7860, 5310, 
-6452, 5318, 6964, 
-5326, 5428, 5332, 
-7476, 5334, 5940, 
-5340, 7988, 5342, 
-6580, 5350, 7092, 
-5358, 5556, 5364, 
-7604, 5366, 6068, 
-5372, 8116, 5374, 
-6228, 5382, 6740, 
-5390, 7252, 5398, 
-5716, 5404, 7764, 
-5406, 6356, 5414, 
-6868, 5422, 7380, 
-5430, 5844, 5436, 
-7892, 5438, 6484, 
-5446, 6996, 5454, 
-7508, 5462, 5972, 
-5468, 8020, 5470, 
-6612, 5478, 7124, 
-5486, 5588, 5492, 
-7636, 5494, 6100, 
-5500, 8148, 5502, 
-6260, 5510, 6772, 
-5518, 7284, 5526, 
-5748, 5532, 7796, 
-5534, 6388, 5542, 
-6900, 5550, 7412, 
-5558, 5876, 5564, 
-7924, 5566, 6516, 
-5574, 7028, 5582, 
-7540, 5590, 6004, 
-5596, 8052, 5598, 
-6644, 5606, 7156, 
-5614, 7668, 5622, 
-6132, 5628, 8180, 
-5630, 6172, 5638, 
-6684, 5646, 7196, 
-5654, 7708, 5662, 
-6300, 5670, 6812, 
-5678, 7324, 5686, 
-5788, 5692, 7836, 
-5694, 6428, 5702, 
-6940, 5710, 7452, 
-5718, 5916, 5724, 
-7964, 5726, 6556, 
-5734, 7068, 5742, 
-7580, 5750, 6044, 
-5756, 8092, 5758, 
-6204, 5766, 6716, 
-5774, 7228, 5782, 
-7740, 5790, 6332, 
-5798, 6844, 5806, 
-7356, 5814, 7868, 
-5822, 6460, 5830, 
-6972, 5838, 7484, 
-5846, 5948, 5852, 
-7996, 5854, 6588, 
-5862, 7100, 5870, 
-7612, 5878, 6076, 
-5884, 8124, 5886, 
-6236, 5894, 6748, 
-5902, 7260, 5910, 
-7772, 5918, 6364, 
-5926, 6876, 5934, 
-7388, 5942, 7900, 
-5950, 6492, 5958, 
-7004, 5966, 7516, 
-5974, 8028, 5982, 
-6620, 5990, 7132, 
-5998, 7644, 6006, 
-6108, 6012, 8156, 
-6014, 6268, 6022, 
-6780, 6030, 7292, 
-6038, 7804, 6046, 
-6396, 6054, 6908, 
-6062, 7420, 6070, 
-7932, 6078, 6524, 
-6086, 7036, 6094, 
-7548, 6102, 8060, 
-6110, 6652, 6118, 
-7164, 6126, 7676, 
-6134, 8188, 6142, 
-6662, 6158, 7174, 
-6166, 7686, 6174, 
-6278, 6182, 6790, 
-6190, 7302, 6198, 
-7814, 6206, 6406, 
-6214, 6918, 6222, 
-7430, 6230, 7942, 
-6238, 6534, 6246, 
-7046, 6254, 7558, 
-6262, 8070, 6270, 
-6694, 6286, 7206, 
-6294, 7718, 6302, 
-6822, 6318, 7334, 
-6326, 7846, 6334, 
-6438, 6342, 6950, 
-6350, 7462, 6358, 
-7974, 6366, 6566, 
-6374, 7078, 6382, 
-7590, 6390, 8102, 
-6398, 6726, 6414, 
-7238, 6422, 7750, 
-6430, 6854, 6446, 
-7366, 6454, 7878, 
-6462, 6982, 6478, 
-7494, 6486, 8006, 
-6494, 6598, 6502, 
-7110, 6510, 7622, 
-6518, 8134, 6526, 
-6758, 6542, 7270, 
-6550, 7782, 6558, 
-6886, 6574, 7398, 
-6582, 7910, 6590, 
-7014, 6606, 7526, 
-6614, 8038, 6622, 
-7142, 6638, 7654, 
-6646, 8166, 6654, 
-7182, 6678, 7694, 
-6686, 6798, 6702, 
-7310, 6710, 7822, 
-6718, 6926, 6734, 
-7438, 6742, 7950, 
-6750, 7054, 6766, 
-7566, 6774, 8078, 
-6782, 7214, 6806, 
-7726, 6814, 7342, 
-6838, 7854, 6846, 
-6958, 6862, 7470, 
-6870, 7982, 6878, 
-7086, 6894, 7598, 
-6902, 8110, 6910, 
-7246, 6934, 7758, 
-6942, 7374, 6966, 
-7886, 6974, 7502, 
-6998, 8014, 7006, 
-7118, 7022, 7630, 
-7030, 8142, 7038, 
-7278, 7062, 7790, 
-7070, 7406, 7094, 
-7918, 7102, 7534, 
-7126, 8046, 7134, 
-7662, 7158, 8174, 
-7166, 7702, 7198, 
-7318, 7222, 7830, 
-7230, 7446, 7254, 
-7958, 7262, 7574, 
-7286, 8086, 7294, 
-7734, 7326, 7862, 
-7358, 7478, 7382, 
-7990, 7390, 7606, 
-7414, 8118, 7422, 
-7766, 7454, 7894, 
-7486, 8022, 7518, 
-7638, 7542, 8150, 
-7550, 7798, 7582, 
-7926, 7614, 8054, 
-7646, 8182, 7678, 
-7838, 7742, 7966, 
-7774, 8094, 7806, 
-7998, 7902, 8126, 
-7934, 8158, 8062, 
-};
-__ALIGNED(8) const uint16_t perm3[NB_PERM3]={
-};
-__ALIGNED(8) const uint16_t perm4[NB_PERM4]={
-};
-__ALIGNED(8) const uint16_t perm5[NB_PERM5]={
-};
-__ALIGNED(8) const uint16_t perm6[NB_PERM6]={
-};
-__ALIGNED(8) const uint16_t perm7[NB_PERM7]={
-6, 8, 8, 
-4, 4, 2, 
-};
-__ALIGNED(8) const uint16_t perm8[NB_PERM8]={
-128, 2, 256, 
-4, 384, 6, 
-512, 8, 640, 
-10, 768, 12, 
-896, 14, 144, 
-18, 272, 20, 
-400, 22, 528, 
-24, 656, 26, 
-784, 28, 912, 
-30, 160, 34, 
-288, 36, 416, 
-38, 544, 40, 
-672, 42, 800, 
-44, 928, 46, 
-176, 50, 304, 
-52, 432, 54, 
-560, 56, 688, 
-58, 816, 60, 
-944, 62, 192, 
-66, 320, 68, 
-448, 70, 576, 
-72, 704, 74, 
-832, 76, 960, 
-78, 208, 82, 
-336, 84, 464, 
-86, 592, 88, 
-720, 90, 848, 
-92, 976, 94, 
-224, 98, 352, 
-100, 480, 102, 
-608, 104, 736, 
-106, 864, 108, 
-992, 110, 240, 
-114, 368, 116, 
-496, 118, 624, 
-120, 752, 122, 
-880, 124, 1008, 
-126, 258, 132, 
-386, 134, 514, 
-136, 642, 138, 
-770, 140, 898, 
-142, 274, 148, 
-402, 150, 530, 
-152, 658, 154, 
-786, 156, 914, 
-158, 290, 164, 
-418, 166, 546, 
-168, 674, 170, 
-802, 172, 930, 
-174, 306, 180, 
-434, 182, 562, 
-184, 690, 186, 
-818, 188, 946, 
-190, 322, 196, 
-450, 198, 578, 
-200, 706, 202, 
-834, 204, 962, 
-206, 338, 212, 
-466, 214, 594, 
-216, 722, 218, 
-850, 220, 978, 
-222, 354, 228, 
-482, 230, 610, 
-232, 738, 234, 
-866, 236, 994, 
-238, 370, 244, 
-498, 246, 626, 
-248, 754, 250, 
-882, 252, 1010, 
-254, 388, 262, 
-516, 264, 644, 
-266, 772, 268, 
-900, 270, 404, 
-278, 532, 280, 
-660, 282, 788, 
-284, 916, 286, 
-420, 294, 548, 
-296, 676, 298, 
-804, 300, 932, 
-302, 436, 310, 
-564, 312, 692, 
-314, 820, 316, 
-948, 318, 452, 
-326, 580, 328, 
-708, 330, 836, 
-332, 964, 334, 
-468, 342, 596, 
-344, 724, 346, 
-852, 348, 980, 
-350, 484, 358, 
-612, 360, 740, 
-362, 868, 364, 
-996, 366, 500, 
-374, 628, 376, 
-756, 378, 884, 
-380, 1012, 382, 
-518, 392, 646, 
-394, 774, 396, 
-902, 398, 534, 
-408, 662, 410, 
-790, 412, 918, 
-414, 550, 424, 
-678, 426, 806, 
-428, 934, 430, 
-566, 440, 694, 
-442, 822, 444, 
-950, 446, 582, 
-456, 710, 458, 
-838, 460, 966, 
-462, 598, 472, 
-726, 474, 854, 
-476, 982, 478, 
-614, 488, 742, 
-490, 870, 492, 
-998, 494, 630, 
-504, 758, 506, 
-886, 508, 1014, 
-510, 648, 522, 
-776, 524, 904, 
-526, 664, 538, 
-792, 540, 920, 
-542, 680, 554, 
-808, 556, 936, 
-558, 696, 570, 
-824, 572, 952, 
-574, 712, 586, 
-840, 588, 968, 
-590, 728, 602, 
-856, 604, 984, 
-606, 744, 618, 
-872, 620, 1000, 
-622, 760, 634, 
-888, 636, 1016, 
-638, 778, 652, 
-906, 654, 794, 
-668, 922, 670, 
-810, 684, 938, 
-686, 826, 700, 
-954, 702, 842, 
-716, 970, 718, 
-858, 732, 986, 
-734, 874, 748, 
-1002, 750, 890, 
-764, 1018, 766, 
-908, 782, 924, 
-798, 940, 814, 
-956, 830, 972, 
-846, 988, 862, 
-1004, 878, 1020, 
-894, };
-__ALIGNED(8) const uint16_t perm9[NB_PERM9]={
-};
-__ALIGNED(8) const uint16_t perm10[NB_PERM10]={
-6, 2, 12, 
-4, 14, 10, 
-};
-__ALIGNED(8) const uint16_t perm11[NB_PERM11]={
-10, 14, 14, 
-16, 16, 8, 
-8, 4, 4, 
-2, 12, 6, 
-};
-__ALIGNED(8) const uint16_t perm12[NB_PERM12]={
-128, 8, 8, 
-32, 32, 2, 
-16, 64, 64, 
-4, 144, 72, 
-72, 36, 36, 
-18, 18, 192, 
-192, 12, 12, 
-48, 48, 66, 
-66, 132, 132, 
-24, 24, 96, 
-96, 6, 160, 
-10, 176, 74, 
-74, 164, 164, 
-26, 26, 224, 
-224, 14, 80, 
-68, 68, 20, 
-208, 76, 76, 
-52, 52, 82, 
-82, 196, 196, 
-28, 28, 112, 
-112, 70, 70, 
-148, 148, 88, 
-88, 100, 100, 
-22, 240, 78, 
-78, 180, 180, 
-90, 90, 228, 
-228, 30, 130, 
-136, 136, 40, 
-40, 34, 146, 
-200, 200, 44, 
-44, 50, 50, 
-194, 194, 140, 
-140, 56, 56, 
-98, 98, 134, 
-134, 152, 152, 
-104, 104, 38, 
-162, 138, 138, 
-168, 168, 42, 
-178, 202, 202, 
-172, 172, 58, 
-58, 226, 226, 
-142, 142, 184, 
-184, 106, 106, 
-166, 166, 154, 
-154, 232, 232, 
-46, 210, 204, 
-204, 60, 60, 
-114, 114, 198, 
-198, 156, 156, 
-120, 120, 102, 
-102, 150, 150, 
-216, 216, 108, 
-108, 54, 242, 
-206, 206, 188, 
-188, 122, 122, 
-230, 230, 158, 
-158, 248, 248, 
-110, 110, 182, 
-182, 218, 218, 
-236, 236, 62, 
-212, 92, 92, 
-116, 116, 86, 
-244, 94, 214, 
-220, 220, 124, 
-124, 118, 246, 
-222, 222, 252, 
-252, 126, 186, 
-234, 234, 174, 
-250, 238, 238, 
-190, };
-__ALIGNED(8) const uint16_t perm13[NB_PERM13]={
-8, 10, 10, 
-18, 18, 6, 
-6, 2, 16, 
-20, 20, 14, 
-14, 12, 12, 
-4, };
-__ALIGNED(8) const uint16_t perm14[NB_PERM14]={
-384, 8, 8, 
-256, 256, 212, 
-212, 276, 276, 
-116, 116, 274, 
-274, 740, 740, 
-350, 350, 470, 
-470, 504, 504, 
-42, 42, 560, 
-560, 362, 362, 
-486, 486, 522, 
-522, 570, 570, 
-634, 634, 716, 
-716, 318, 318, 
-550, 550, 730, 
-730, 718, 718, 
-702, 702, 558, 
-558, 618, 618, 
-572, 572, 378, 
-378, 630, 630, 
-588, 588, 28, 
-28, 160, 160, 
-210, 210, 532, 
-532, 202, 202, 
-644, 644, 348, 
-348, 86, 86, 
-496, 496, 154, 
-154, 706, 706, 
-686, 686, 414, 
-414, 552, 552, 
-106, 106, 642, 
-642, 604, 604, 
-172, 172, 226, 
-226, 676, 676, 
-142, 142, 690, 
-690, 542, 542, 
-474, 474, 632, 
-632, 332, 332, 
-310, 310, 662, 
-662, 508, 508, 
-170, 170, 482, 
-482, 394, 394, 
-648, 648, 108, 
-108, 18, 18, 
-528, 528, 74, 
-74, 480, 480, 
-10, 10, 640, 
-640, 220, 220, 
-164, 164, 338, 
-338, 454, 454, 
-728, 728, 334, 
-334, 694, 694, 
-670, 670, 764, 
-764, 382, 382, 
-758, 758, 510, 
-510, 554, 554, 
-490, 490, 650, 
-650, 492, 492, 
-26, 26, 416, 
-416, 296, 296, 
-262, 262, 724, 
-724, 206, 206, 
-404, 404, 280, 
-280, 244, 244, 
-196, 196, 132, 
-132, 50, 50, 
-448, 448, 216, 
-216, 36, 36, 
-48, 48, 64, 
-64, 208, 208, 
-148, 148, 194, 
-194, 388, 388, 
-136, 136, 178, 
-178, 738, 738, 
-606, 606, 556, 
-556, 234, 234, 
-564, 564, 122, 
-122, 418, 418, 
-680, 680, 270, 
-270, 612, 612, 
-60, 60, 80, 
-80, 352, 352, 
-214, 214, 660, 
-660, 124, 124, 
-162, 162, 594, 
-594, 540, 540, 
-90, 90, 624, 
-624, 76, 76, 
-224, 224, 292, 
-292, 134, 134, 
-434, 434, 456, 
-456, 104, 104, 
-258, 258, 596, 
-596, 284, 284, 
-372, 372, 118, 
-118, 658, 658, 
-748, 748, 238, 
-238, 692, 692, 
-286, 286, 756, 
-756, 126, 126, 
-546, 546, 602, 
-602, 428, 428, 
-312, 312, 38, 
-38, 432, 432, 
-72, 72, 96, 
-96, 2, 128, 
-290, 290, 390, 
-390, 520, 520, 
-186, 186, 626, 
-626, 460, 460, 
-232, 232, 180, 
-180, 114, 114, 
-530, 530, 458, 
-458, 488, 488, 
-266, 266, 484, 
-484, 138, 138, 
-562, 562, 746, 
-746, 494, 494, 
-410, 410, 424, 
-424, 184, 184, 
-242, 242, 452, 
-452, 344, 344, 
-326, 326, 438, 
-438, 584, 584, 
-268, 268, 228, 
-228, 52, 52, 
-192, 192, 4, 
-512, 298, 298, 
-646, 646, 732, 
-732, 94, 94, 
-752, 752, 366, 
-366, 614, 614, 
-444, 444, 88, 
-88, 240, 240, 
-68, 68, 336, 
-336, 70, 70, 
-720, 720, 78, 
-78, 608, 608, 
-300, 300, 22, 
-22, 656, 656, 
-364, 364, 230, 
-230, 436, 436, 
-200, 200, 260, 
-260, 340, 340, 
-198, 198, 516, 
-516, 58, 58, 
-704, 704, 302, 
-302, 406, 406, 
-664, 664, 252, 
-252, 84, 84, 
-112, 112, 146, 
-146, 450, 450, 
-600, 600, 44, 
-44, 304, 304, 
-150, 150, 578, 
-578, 396, 396, 
-24, 24, 32, 
-32, 288, 288, 
-6, 16, 144, 
-144, 66, 66, 
-592, 592, 156, 
-156, 82, 82, 
-736, 736, 222, 
-222, 548, 548, 
-346, 346, 710, 
-710, 446, 446, 
-472, 472, 248, 
-248, 324, 324, 
-54, 54, 576, 
-576, 12, 400, 
-152, 152, 322, 
-322, 678, 678, 
-526, 526, 698, 
-698, 430, 430, 
-696, 696, 46, 
-46, 688, 688, 
-158, 158, 466, 
-466, 744, 744, 
-110, 110, 402, 
-402, 536, 536, 
-330, 330, 566, 
-566, 506, 506, 
-426, 426, 568, 
-568, 250, 250, 
-708, 708, 62, 
-62, 464, 464, 
-360, 360, 102, 
-102, 514, 514, 
-682, 682, 654, 
-654, 620, 620, 
-316, 316, 166, 
-166, 722, 722, 
-462, 462, 616, 
-616, 188, 188, 
-370, 370, 742, 
-742, 734, 734, 
-478, 478, 760, 
-760, 254, 254, 
-468, 468, 120, 
-120, 34, 34, 
-672, 672, 14, 
-272, 356, 356, 
-342, 342, 582, 
-582, 524, 524, 
-314, 314, 422, 
-422, 440, 440, 
-328, 328, 182, 
-182, 498, 498, 
-538, 538, 714, 
-714, 574, 574, 
-762, 762, 638, 
-638, 476, 476, 
-376, 376, 246, 
-246, 580, 580, 
-140, 140, 306, 
-306, 534, 534, 
-586, 586, 652, 
-652, 236, 236, 
-308, 308, 278, 
-278, 500, 500, 
-282, 282, 628, 
-628, 204, 204, 
-20, 544, 218, 
-218, 420, 420, 
-56, 56, 320, 
-320, 294, 294, 
-518, 518, 442, 
-442, 712, 712, 
-190, 190, 754, 
-754, 750, 750, 
-622, 622, 700, 
-700, 174, 174, 
-610, 610, 684, 
-684, 30, 176, 
-354, 354, 598, 
-598, 668, 668, 
-380, 380, 374, 
-374, 502, 502, 
-666, 666, 636, 
-636, 92, 92, 
-368, 368, 358, 
-358, 726, 726, 
-590, 590, 412, 
-412, 168, 168, 
-98, 98, 386, 
-386, 392, 392, 
-264, 264, 100, 
-100, 130, 130, 
-674, 674, 398, 
-398, 408, 408, 
-40, };
-__ALIGNED(8) const uint16_t perm15[NB_PERM15]={
-10, 22, 22, 
-26, 26, 18, 
-18, 6, 6, 
-2, 20, 16, 
-16, 24, 24, 
-8, 8, 12, 
-12, 4, };
-__ALIGNED(8) const uint16_t perm16[NB_PERM16]={
-16, 8, 8, 
-4, 4, 2, 
-18, 24, 24, 
-12, 12, 6, 
-20, 10, 22, 
-26, 26, 28, 
-28, 14, };
-__ALIGNED(8) const uint16_t perm17[NB_PERM17]={
-144, 8, 8, 
-96, 96, 36, 
-36, 2, 48, 
-18, 18, 208, 
-208, 90, 90, 
-212, 212, 138, 
-138, 230, 230, 
-172, 172, 88, 
-88, 68, 68, 
-130, 130, 262, 
-262, 254, 254, 
-158, 158, 168, 
-168, 40, 40, 
-50, 50, 162, 
-162, 216, 216, 
-12, 12, 16, 
-16, 64, 64, 
-82, 82, 244, 
-244, 92, 92, 
-116, 116, 102, 
-102, 228, 228, 
-28, 28, 80, 
-80, 100, 100, 
-84, 84, 20, 
-20, 112, 112, 
-54, 54, 210, 
-210, 234, 234, 
-220, 220, 60, 
-60, 34, 34, 
-272, 272, 126, 
-126, 214, 214, 
-282, 282, 238, 
-238, 268, 268, 
-78, 78, 196, 
-196, 74, 74, 
-148, 148, 56, 
-56, 114, 114, 
-198, 198, 218, 
-218, 156, 156, 
-24, 24, 32, 
-32, 128, 128, 
-118, 118, 246, 
-246, 236, 236, 
-124, 124, 70, 
-70, 274, 274, 
-270, 270, 222, 
-222, 204, 204, 
-42, 42, 194, 
-194, 170, 170, 
-184, 184, 58, 
-58, 258, 258, 
-206, 206, 186, 
-186, 202, 202, 
-266, 266, 174, 
-174, 232, 232, 
-76, 76, 52, 
-52, 66, 66, 
-226, 226, 252, 
-252, 14, 14, 
-160, 160, 72, 
-72, 4, 192, 
-26, 26, 176, 
-176, 136, 136, 
-86, 86, 164, 
-164, 120, 120, 
-22, 22, 256, 
-256, 62, 62, 
-178, 178, 280, 
-280, 94, 94, 
-260, 260, 110, 
-110, 150, 150, 
-200, 200, 122, 
-122, 166, 166, 
-264, 264, 30, 
-30, 224, 224, 
-108, 108, 6, 
-240, 44, 44, 
-98, 98, 180, 
-180, 10, 146, 
-152, 152, 104, 
-104, 132, 132, 
-38, 242, 188, 
-188, 106, 106, 
-276, 276, 46, 
-182, 154, 154, 
-248, 248, 140, 
-140, 134, 278, 
-190, 190, 250, 
-250, 284, 284, 
-142, };
-__ALIGNED(8) const uint16_t perm18[NB_PERM18]={
-18, 26, 26, 
-22, 22, 32, 
-32, 16, 16, 
-8, 8, 12, 
-12, 2, 6, 
-24, 24, 4, 
-30, 28, 28, 
-10, 20, 14, 
-};
-__ALIGNED(8) const uint16_t perm19[NB_PERM19]={
-400, 8, 8, 
-160, 160, 50, 
-50, 592, 592, 
-314, 314, 646, 
-646, 524, 524, 
-106, 106, 482, 
-482, 472, 472, 
-296, 296, 388, 
-388, 230, 230, 
-580, 580, 74, 
-74, 688, 688, 
-236, 236, 340, 
-340, 38, 38, 
-736, 736, 350, 
-350, 598, 598, 
-794, 794, 718, 
-718, 734, 734, 
-670, 670, 620, 
-620, 28, 28, 
-176, 176, 370, 
-370, 614, 614, 
-652, 652, 284, 
-284, 148, 148, 
-194, 194, 706, 
-706, 494, 494, 
-712, 712, 254, 
-254, 676, 676, 
-380, 380, 70, 
-70, 608, 608, 
-172, 172, 290, 
-290, 628, 628, 
-188, 188, 226, 
-226, 500, 500, 
-10, 10, 560, 
-560, 58, 58, 
-752, 752, 286, 
-286, 548, 548, 
-202, 202, 404, 
-404, 88, 88, 
-224, 224, 100, 
-100, 2, 80, 
-64, 64, 128, 
-128, 178, 178, 
-770, 770, 622, 
-622, 428, 428, 
-184, 184, 146, 
-146, 514, 514, 
-650, 650, 604, 
-604, 92, 92, 
-304, 304, 86, 
-86, 544, 544, 
-122, 122, 418, 
-418, 728, 728, 
-190, 190, 626, 
-626, 508, 508, 
-170, 170, 610, 
-610, 572, 572, 
-298, 298, 788, 
-788, 238, 238, 
-740, 740, 46, 
-46, 512, 512, 
-250, 250, 596, 
-596, 394, 394, 
-710, 710, 574, 
-574, 698, 698, 
-796, 796, 398, 
-398, 790, 790, 
-638, 638, 748, 
-748, 206, 206, 
-484, 484, 152, 
-152, 274, 274, 
-692, 692, 316, 
-316, 326, 326, 
-502, 502, 410, 
-410, 568, 568, 
-218, 218, 724, 
-724, 110, 110, 
-562, 562, 458, 
-458, 760, 760, 
-62, 62, 448, 
-448, 200, 200, 
-4, 480, 72, 
-72, 288, 288, 
-228, 228, 180, 
-180, 66, 66, 
-528, 528, 186, 
-186, 546, 546, 
-522, 522, 426, 
-426, 504, 504, 
-90, 90, 624, 
-624, 108, 108, 
-162, 162, 450, 
-450, 600, 600, 
-12, 12, 240, 
-240, 36, 36, 
-336, 336, 342, 
-342, 438, 438, 
-744, 744, 126, 
-126, 498, 498, 
-792, 792, 318, 
-318, 726, 726, 
-510, 510, 570, 
-570, 618, 618, 
-732, 732, 270, 
-270, 612, 612, 
-252, 252, 276, 
-276, 372, 372, 
-294, 294, 708, 
-708, 174, 174, 
-690, 690, 636, 
-636, 348, 348, 
-198, 198, 786, 
-786, 558, 558, 
-762, 762, 462, 
-462, 456, 456, 
-360, 360, 54, 
-54, 672, 672, 
-300, 300, 6, 
-640, 44, 44, 
-112, 112, 242, 
-242, 436, 436, 
-344, 344, 118, 
-118, 722, 722, 
-430, 430, 584, 
-584, 154, 154, 
-674, 674, 700, 
-700, 14, 320, 
-22, 22, 416, 
-416, 328, 328, 
-182, 182, 466, 
-466, 536, 536, 
-346, 346, 518, 
-518, 730, 730, 
-590, 590, 634, 
-634, 668, 668, 
-220, 220, 20, 
-20, 16, 720, 
-30, 30, 576, 
-576, 378, 378, 
-774, 774, 702, 
-702, 414, 414, 
-648, 648, 204, 
-204, 84, 84, 
-144, 144, 114, 
-114, 642, 642, 
-444, 444, 120, 
-120, 18, 96, 
-384, 384, 150, 
-150, 594, 594, 
-714, 714, 654, 
-654, 684, 684, 
-156, 156, 354, 
-354, 678, 678, 
-780, 780, 78, 
-78, 768, 768, 
-222, 222, 420, 
-420, 24, 496, 
-392, 392, 310, 
-310, 566, 566, 
-538, 538, 746, 
-746, 526, 526, 
-506, 506, 490, 
-490, 632, 632, 
-268, 268, 212, 
-212, 244, 244, 
-116, 116, 322, 
-322, 422, 422, 
-424, 424, 104, 
-104, 82, 82, 
-464, 464, 136, 
-136, 338, 338, 
-742, 742, 446, 
-446, 520, 520, 
-26, 256, 356, 
-356, 358, 358, 
-758, 758, 766, 
-766, 542, 542, 
-442, 442, 440, 
-440, 40, 40, 
-32, 656, 364, 
-364, 134, 134, 
-658, 658, 764, 
-764, 142, 142, 
-434, 434, 664, 
-664, 140, 140, 
-34, 432, 264, 
-264, 132, 132, 
-258, 258, 756, 
-756, 366, 366, 
-534, 534, 666, 
-666, 540, 540, 
-42, 192, 306, 
-306, 486, 486, 
-552, 552, 282, 
-282, 468, 468, 
-216, 216, 324, 
-324, 102, 102, 
-402, 402, 408, 
-408, 168, 168, 
-210, 210, 564, 
-564, 138, 138, 
-738, 738, 750, 
-750, 606, 606, 
-492, 492, 312, 
-312, 246, 246, 
-516, 516, 330, 
-330, 582, 582, 
-474, 474, 696, 
-696, 396, 396, 
-390, 390, 630, 
-630, 588, 588, 
-234, 234, 660, 
-660, 60, 60, 
-48, 272, 292, 
-292, 308, 308, 
-166, 166, 530, 
-530, 586, 586, 
-554, 554, 682, 
-682, 476, 476, 
-376, 376, 374, 
-374, 694, 694, 
-716, 716, 334, 
-334, 662, 662, 
-460, 460, 56, 
-56, 352, 352, 
-278, 278, 772, 
-772, 302, 302, 
-406, 406, 488, 
-488, 232, 232, 
-260, 260, 52, 
-208, 164, 164, 
-130, 130, 578, 
-578, 778, 778, 
-782, 782, 478, 
-478, 776, 776, 
-382, 382, 470, 
-470, 616, 616, 
-332, 332, 262, 
-262, 452, 452, 
-280, 280, 68, 
-368, 214, 214, 
-644, 644, 124, 
-124, 98, 98, 
-784, 784, 158, 
-158, 754, 754, 
-686, 686, 556, 
-556, 362, 362, 
-454, 454, 680, 
-680, 76, 704, 
-94, 386, 550, 
-550, 602, 602, 
-412, 412, 248, 
-248, 196, 532, 
-266, };
-__ALIGNED(8) const uint16_t perm20[NB_PERM20]={
-10, 12, 12, 
-22, 22, 34, 
-34, 18, 18, 
-14, 14, 32, 
-32, 8, 8, 
-2, 20, 24, 
-24, 6, 6, 
-30, 30, 36, 
-36, 28, 28, 
-26, 26, 16, 
-16, 4, };
-__ALIGNED(8) const uint16_t perm21[NB_PERM21]={
-150, 224, 224, 
-136, 136, 64, 
-64, 52, 52, 
-90, 90, 222, 
-222, 236, 236, 
-146, 146, 174, 
-174, 244, 244, 
-58, 58, 290, 
-290, 198, 198, 
-216, 216, 36, 
-36, 30, 30, 
-220, 220, 86, 
-86, 172, 172, 
-94, 94, 272, 
-272, 128, 128, 
-104, 104, 132, 
-132, 14, 14, 
-160, 160, 84, 
-84, 22, 22, 
-260, 260, 118, 
-118, 292, 292, 
-98, 98, 182, 
-182, 156, 156, 
-34, 34, 270, 
-270, 228, 228, 
-46, 46, 280, 
-280, 88, 88, 
-72, 72, 12, 
-12, 10, 10, 
-250, 250, 258, 
-258, 218, 218, 
-186, 186, 206, 
-206, 176, 176, 
-144, 144, 24, 
-24, 20, 20, 
-110, 110, 192, 
-192, 16, 16, 
-60, 60, 2, 
-50, 190, 190, 
-256, 256, 68, 
-68, 102, 102, 
-232, 232, 96, 
-96, 32, 32, 
-120, 120, 4, 
-200, 116, 116, 
-142, 142, 264, 
-264, 28, 28, 
-70, 70, 252, 
-252, 18, 18, 
-210, 210, 226, 
-226, 286, 286, 
-288, 288, 48, 
-48, 40, 40, 
-80, 80, 112, 
-112, 92, 92, 
-122, 122, 154, 
-154, 274, 274, 
-278, 278, 188, 
-188, 106, 106, 
-282, 282, 238, 
-238, 296, 296, 
-148, 148, 74, 
-74, 162, 162, 
-234, 234, 246, 
-246, 208, 208, 
-76, 76, 62, 
-62, 152, 152, 
-124, 124, 54, 
-54, 240, 240, 
-8, 8, 100, 
-100, 82, 82, 
-262, 262, 268, 
-268, 78, 78, 
-212, 212, 126, 
-126, 204, 204, 
-26, 26, 170, 
-170, 194, 194, 
-166, 166, 284, 
-284, 138, 138, 
-214, 214, 276, 
-276, 38, 38, 
-180, 180, 6, 
-230, 196, 196, 
-66, 66, 202, 
-202, 266, 266, 
-178, 178, 294, 
-294, 248, 248, 
-108, 108, 42, 
-130, 254, 254, 
-168, 168, 44, 
-140, 114, 114, 
-242, 242, 158, 
-158, 184, 184, 
-56, 164, 134, 
-};
-__ALIGNED(8) const uint16_t perm22[NB_PERM22]={
-16, 36, 36, 
-12, 12, 4, 
-4, 32, 32, 
-26, 26, 24, 
-24, 8, 8, 
-18, 18, 6, 
-6, 2, 34, 
-42, 42, 14, 
-14, 20, 20, 
-22, 22, 38, 
-38, 28, 28, 
-40, 40, 44, 
-44, 30, 30, 
-10, };
-__ALIGNED(8) const uint16_t perm23[NB_PERM23]={
-10, 2, 20, 
-4, 30, 6, 
-40, 8, 22, 
-14, 32, 16, 
-42, 18, 34, 
-26, 44, 28, 
-46, 38, };
-__ALIGNED(8) const uint16_t perm24[NB_PERM24]={
-18, 2, 36, 
-4, 24, 8, 
-42, 10, 30, 
-14, 48, 16, 
-38, 22, 44, 
-28, 50, 34, 
-};
-__ALIGNED(8) const uint16_t perm25[NB_PERM25]={
-30, 44, 44, 
-26, 26, 34, 
-34, 54, 54, 
-48, 48, 8, 
-8, 20, 20, 
-22, 22, 52, 
-52, 18, 18, 
-42, 42, 46, 
-46, 56, 56, 
-28, 28, 14, 
-14, 32, 32, 
-24, 24, 4, 
-4, 10, 10, 
-50, 50, 38, 
-38, 36, 36, 
-6, 6, 40, 
-40, 16, 16, 
-12, 12, 2, 
-};
-__ALIGNED(8) const uint16_t perm26[NB_PERM26]={
-16, 4, 4, 
-32, 32, 8, 
-8, 2, 48, 
-12, 12, 34, 
-34, 24, 24, 
-6, 18, 20, 
-20, 36, 36, 
-40, 40, 10, 
-50, 28, 28, 
-38, 38, 56, 
-56, 14, 52, 
-44, 44, 42, 
-42, 26, 26, 
-22, 54, 60, 
-60, 46, 46, 
-58, 58, 30, 
-};
-__ALIGNED(8) const uint16_t perm27[NB_PERM27]={
-192, 164, 164, 
-212, 212, 372, 
-372, 138, 138, 
-178, 178, 532, 
-532, 478, 478, 
-492, 492, 124, 
-124, 546, 546, 
-110, 110, 226, 
-226, 454, 454, 
-412, 412, 554, 
-554, 366, 366, 
-74, 74, 194, 
-194, 356, 356, 
-376, 376, 522, 
-522, 30, 30, 
-144, 144, 4, 
-4, 384, 384, 
-90, 90, 18, 
-18, 16, 16, 
-512, 512, 270, 
-270, 54, 54, 
-48, 48, 160, 
-160, 516, 516, 
-142, 142, 562, 
-562, 446, 446, 
-332, 332, 296, 
-296, 264, 264, 
-166, 166, 404, 
-404, 298, 298, 
-456, 456, 92, 
-92, 210, 210, 
-180, 180, 36, 
-36, 32, 32, 
-336, 336, 168, 
-168, 84, 84, 
-130, 130, 434, 
-434, 204, 204, 
-116, 116, 290, 
-290, 200, 200, 
-244, 244, 470, 
-470, 236, 236, 
-214, 214, 564, 
-564, 126, 126, 
-50, 50, 352, 
-352, 504, 504, 
-14, 14, 320, 
-320, 344, 344, 
-248, 248, 342, 
-342, 56, 56, 
-240, 240, 86, 
-86, 322, 322, 
-536, 536, 350, 
-350, 312, 312, 
-88, 88, 514, 
-514, 462, 462, 
-156, 156, 132, 
-132, 114, 114, 
-98, 98, 274, 
-274, 438, 438, 
-76, 76, 386, 
-386, 282, 282, 
-182, 182, 228, 
-228, 134, 134, 
-306, 306, 24, 
-24, 80, 80, 
-258, 258, 102, 
-102, 146, 146, 
-196, 196, 548, 
-548, 302, 302, 
-328, 328, 424, 
-424, 506, 506, 
-206, 206, 308, 
-308, 216, 216, 
-6, 6, 64, 
-64, 496, 496, 
-508, 508, 398, 
-398, 234, 234, 
-22, 22, 400, 
-400, 426, 426, 
-186, 186, 100, 
-100, 466, 466, 
-540, 540, 46, 
-46, 480, 480, 
-172, 172, 468, 
-468, 44, 44, 
-288, 288, 8, 
-8, 256, 256, 
-422, 422, 314, 
-314, 280, 280, 
-502, 502, 572, 
-572, 382, 382, 
-410, 410, 362, 
-362, 202, 202, 
-436, 436, 396, 
-396, 42, 42, 
-96, 96, 82, 
-82, 450, 450, 
-28, 28, 464, 
-464, 348, 348, 
-120, 120, 162, 
-162, 20, 20, 
-208, 208, 500, 
-500, 380, 380, 
-218, 218, 198, 
-198, 52, 52, 
-544, 544, 430, 
-430, 570, 570, 
-190, 190, 484, 
-484, 556, 556, 
-558, 558, 62, 
-62, 304, 304, 
-520, 520, 526, 
-526, 414, 414, 
-58, 58, 432, 
-432, 12, 12, 
-128, 128, 242, 
-242, 278, 278, 
-310, 310, 408, 
-408, 170, 170, 
-276, 276, 118, 
-118, 482, 482, 
-364, 364, 394, 
-394, 538, 538, 
-542, 542, 238, 
-238, 406, 406, 
-490, 490, 444, 
-444, 140, 140, 
-370, 370, 458, 
-458, 284, 284, 
-374, 374, 330, 
-330, 104, 104, 
-338, 338, 360, 
-360, 10, 10, 
-448, 448, 524, 
-524, 222, 222, 
-70, 70, 560, 
-560, 254, 254, 
-230, 230, 326, 
-326, 232, 232, 
-518, 518, 334, 
-334, 488, 488, 
-252, 252, 38, 
-38, 224, 224, 
-262, 262, 486, 
-486, 60, 60, 
-112, 112, 418, 
-418, 442, 442, 
-460, 460, 476, 
-476, 300, 300, 
-136, 136, 498, 
-498, 188, 188, 
-292, 292, 392, 
-392, 346, 346, 
-440, 440, 268, 
-268, 550, 550, 
-494, 494, 316, 
-316, 472, 472, 
-428, 428, 378, 
-378, 26, 26, 
-272, 272, 246, 
-246, 150, 150, 
-68, 68, 368, 
-368, 266, 266, 
-358, 358, 568, 
-568, 510, 510, 
-78, 78, 66, 
-66, 176, 176, 
-340, 340, 552, 
-552, 174, 174, 
-148, 148, 388, 
-388, 474, 474, 
-108, 108, 34, 
-34, 528, 528, 
-94, 94, 402, 
-402, 106, 106, 
-530, 530, 286, 
-286, 566, 566, 
-318, 318, 152, 
-152, 260, 260, 
-294, 294, 72, 
-72, 2, 416, 
-250, 250, 534, 
-534, 158, 158, 
-324, 324, 40, 
-354, 184, 184, 
-420, 420, 122, 
-452, 220, 220, 
-390, 390, 154, 
-};
-__ALIGNED(8) const uint16_t perm28[NB_PERM28]={
-512, 2, 1024, 
-4, 1536, 6, 
-128, 8, 640, 
-10, 1152, 12, 
-1664, 14, 256, 
-16, 768, 18, 
-1280, 20, 1792, 
-22, 384, 24, 
-896, 26, 1408, 
-28, 1920, 30, 
-544, 34, 1056, 
-36, 1568, 38, 
-160, 40, 672, 
-42, 1184, 44, 
-1696, 46, 288, 
-48, 800, 50, 
-1312, 52, 1824, 
-54, 416, 56, 
-928, 58, 1440, 
-60, 1952, 62, 
-576, 66, 1088, 
-68, 1600, 70, 
-192, 72, 704, 
-74, 1216, 76, 
-1728, 78, 320, 
-80, 832, 82, 
-1344, 84, 1856, 
-86, 448, 88, 
-960, 90, 1472, 
-92, 1984, 94, 
-608, 98, 1120, 
-100, 1632, 102, 
-224, 104, 736, 
-106, 1248, 108, 
-1760, 110, 352, 
-112, 864, 114, 
-1376, 116, 1888, 
-118, 480, 120, 
-992, 122, 1504, 
-124, 2016, 126, 
-520, 130, 1032, 
-132, 1544, 134, 
-648, 138, 1160, 
-140, 1672, 142, 
-264, 144, 776, 
-146, 1288, 148, 
-1800, 150, 392, 
-152, 904, 154, 
-1416, 156, 1928, 
-158, 552, 162, 
-1064, 164, 1576, 
-166, 680, 170, 
-1192, 172, 1704, 
-174, 296, 176, 
-808, 178, 1320, 
-180, 1832, 182, 
-424, 184, 936, 
-186, 1448, 188, 
-1960, 190, 584, 
-194, 1096, 196, 
-1608, 198, 712, 
-202, 1224, 204, 
-1736, 206, 328, 
-208, 840, 210, 
-1352, 212, 1864, 
-214, 456, 216, 
-968, 218, 1480, 
-220, 1992, 222, 
-616, 226, 1128, 
-228, 1640, 230, 
-744, 234, 1256, 
-236, 1768, 238, 
-360, 240, 872, 
-242, 1384, 244, 
-1896, 246, 488, 
-248, 1000, 250, 
-1512, 252, 2024, 
-254, 528, 258, 
-1040, 260, 1552, 
-262, 656, 266, 
-1168, 268, 1680, 
-270, 784, 274, 
-1296, 276, 1808, 
-278, 400, 280, 
-912, 282, 1424, 
-284, 1936, 286, 
-560, 290, 1072, 
-292, 1584, 294, 
-688, 298, 1200, 
-300, 1712, 302, 
-816, 306, 1328, 
-308, 1840, 310, 
-432, 312, 944, 
-314, 1456, 316, 
-1968, 318, 592, 
-322, 1104, 324, 
-1616, 326, 720, 
-330, 1232, 332, 
-1744, 334, 848, 
-338, 1360, 340, 
-1872, 342, 464, 
-344, 976, 346, 
-1488, 348, 2000, 
-350, 624, 354, 
-1136, 356, 1648, 
-358, 752, 362, 
-1264, 364, 1776, 
-366, 880, 370, 
-1392, 372, 1904, 
-374, 496, 376, 
-1008, 378, 1520, 
-380, 2032, 382, 
-536, 386, 1048, 
-388, 1560, 390, 
-664, 394, 1176, 
-396, 1688, 398, 
-792, 402, 1304, 
-404, 1816, 406, 
-920, 410, 1432, 
-412, 1944, 414, 
-568, 418, 1080, 
-420, 1592, 422, 
-696, 426, 1208, 
-428, 1720, 430, 
-824, 434, 1336, 
-436, 1848, 438, 
-952, 442, 1464, 
-444, 1976, 446, 
-600, 450, 1112, 
-452, 1624, 454, 
-728, 458, 1240, 
-460, 1752, 462, 
-856, 466, 1368, 
-468, 1880, 470, 
-984, 474, 1496, 
-476, 2008, 478, 
-632, 482, 1144, 
-484, 1656, 486, 
-760, 490, 1272, 
-492, 1784, 494, 
-888, 498, 1400, 
-500, 1912, 502, 
-1016, 506, 1528, 
-508, 2040, 510, 
-1026, 516, 1538, 
-518, 642, 522, 
-1154, 524, 1666, 
-526, 770, 530, 
-1282, 532, 1794, 
-534, 898, 538, 
-1410, 540, 1922, 
-542, 1058, 548, 
-1570, 550, 674, 
-554, 1186, 556, 
-1698, 558, 802, 
-562, 1314, 564, 
-1826, 566, 930, 
-570, 1442, 572, 
-1954, 574, 1090, 
-580, 1602, 582, 
-706, 586, 1218, 
-588, 1730, 590, 
-834, 594, 1346, 
-596, 1858, 598, 
-962, 602, 1474, 
-604, 1986, 606, 
-1122, 612, 1634, 
-614, 738, 618, 
-1250, 620, 1762, 
-622, 866, 626, 
-1378, 628, 1890, 
-630, 994, 634, 
-1506, 636, 2018, 
-638, 1034, 644, 
-1546, 646, 1162, 
-652, 1674, 654, 
-778, 658, 1290, 
-660, 1802, 662, 
-906, 666, 1418, 
-668, 1930, 670, 
-1066, 676, 1578, 
-678, 1194, 684, 
-1706, 686, 810, 
-690, 1322, 692, 
-1834, 694, 938, 
-698, 1450, 700, 
-1962, 702, 1098, 
-708, 1610, 710, 
-1226, 716, 1738, 
-718, 842, 722, 
-1354, 724, 1866, 
-726, 970, 730, 
-1482, 732, 1994, 
-734, 1130, 740, 
-1642, 742, 1258, 
-748, 1770, 750, 
-874, 754, 1386, 
-756, 1898, 758, 
-1002, 762, 1514, 
-764, 2026, 766, 
-1042, 772, 1554, 
-774, 1170, 780, 
-1682, 782, 1298, 
-788, 1810, 790, 
-914, 794, 1426, 
-796, 1938, 798, 
-1074, 804, 1586, 
-806, 1202, 812, 
-1714, 814, 1330, 
-820, 1842, 822, 
-946, 826, 1458, 
-828, 1970, 830, 
-1106, 836, 1618, 
-838, 1234, 844, 
-1746, 846, 1362, 
-852, 1874, 854, 
-978, 858, 1490, 
-860, 2002, 862, 
-1138, 868, 1650, 
-870, 1266, 876, 
-1778, 878, 1394, 
-884, 1906, 886, 
-1010, 890, 1522, 
-892, 2034, 894, 
-1050, 900, 1562, 
-902, 1178, 908, 
-1690, 910, 1306, 
-916, 1818, 918, 
-1434, 924, 1946, 
-926, 1082, 932, 
-1594, 934, 1210, 
-940, 1722, 942, 
-1338, 948, 1850, 
-950, 1466, 956, 
-1978, 958, 1114, 
-964, 1626, 966, 
-1242, 972, 1754, 
-974, 1370, 980, 
-1882, 982, 1498, 
-988, 2010, 990, 
-1146, 996, 1658, 
-998, 1274, 1004, 
-1786, 1006, 1402, 
-1012, 1914, 1014, 
-1530, 1020, 2042, 
-1022, 1540, 1030, 
-1156, 1036, 1668, 
-1038, 1284, 1044, 
-1796, 1046, 1412, 
-1052, 1924, 1054, 
-1572, 1062, 1188, 
-1068, 1700, 1070, 
-1316, 1076, 1828, 
-1078, 1444, 1084, 
-1956, 1086, 1604, 
-1094, 1220, 1100, 
-1732, 1102, 1348, 
-1108, 1860, 1110, 
-1476, 1116, 1988, 
-1118, 1636, 1126, 
-1252, 1132, 1764, 
-1134, 1380, 1140, 
-1892, 1142, 1508, 
-1148, 2020, 1150, 
-1548, 1158, 1676, 
-1166, 1292, 1172, 
-1804, 1174, 1420, 
-1180, 1932, 1182, 
-1580, 1190, 1708, 
-1198, 1324, 1204, 
-1836, 1206, 1452, 
-1212, 1964, 1214, 
-1612, 1222, 1740, 
-1230, 1356, 1236, 
-1868, 1238, 1484, 
-1244, 1996, 1246, 
-1644, 1254, 1772, 
-1262, 1388, 1268, 
-1900, 1270, 1516, 
-1276, 2028, 1278, 
-1556, 1286, 1684, 
-1294, 1812, 1302, 
-1428, 1308, 1940, 
-1310, 1588, 1318, 
-1716, 1326, 1844, 
-1334, 1460, 1340, 
-1972, 1342, 1620, 
-1350, 1748, 1358, 
-1876, 1366, 1492, 
-1372, 2004, 1374, 
-1652, 1382, 1780, 
-1390, 1908, 1398, 
-1524, 1404, 2036, 
-1406, 1564, 1414, 
-1692, 1422, 1820, 
-1430, 1948, 1438, 
-1596, 1446, 1724, 
-1454, 1852, 1462, 
-1980, 1470, 1628, 
-1478, 1756, 1486, 
-1884, 1494, 2012, 
-1502, 1660, 1510, 
-1788, 1518, 1916, 
-1526, 2044, 1534, 
-1670, 1550, 1798, 
-1558, 1926, 1566, 
-1702, 1582, 1830, 
-1590, 1958, 1598, 
-1734, 1614, 1862, 
-1622, 1990, 1630, 
-1766, 1646, 1894, 
-1654, 2022, 1662, 
-1806, 1686, 1934, 
-1694, 1838, 1718, 
-1966, 1726, 1870, 
-1750, 1998, 1758, 
-1902, 1782, 2030, 
-1790, 1942, 1822, 
-1974, 1854, 2006, 
-1886, 2038, 1918, 
-};
-__ALIGNED(8) const uint16_t perm29[NB_PERM29]={
-80, 4, 4, 
-160, 160, 8, 
-8, 16, 16, 
-32, 32, 64, 
-64, 50, 50, 
-98, 98, 116, 
-116, 228, 228, 
-218, 218, 122, 
-122, 86, 86, 
-244, 244, 172, 
-172, 184, 184, 
-56, 56, 34, 
-34, 144, 144, 
-54, 54, 258, 
-258, 124, 124, 
-166, 166, 248, 
-248, 28, 28, 
-208, 208, 26, 
-26, 128, 128, 
-22, 22, 272, 
-272, 76, 76, 
-226, 226, 138, 
-138, 118, 118, 
-308, 308, 222, 
-222, 282, 282, 
-94, 94, 260, 
-260, 204, 204, 
-170, 170, 104, 
-104, 52, 52, 
-178, 178, 120, 
-120, 6, 6, 
-240, 240, 12, 
-12, 176, 176, 
-40, 40, 2, 
-96, 36, 36, 
-224, 224, 58, 
-58, 114, 114, 
-148, 148, 214, 
-214, 266, 266, 
-140, 140, 198, 
-198, 312, 312, 
-78, 78, 306, 
-306, 142, 142, 
-278, 278, 316, 
-316, 238, 238, 
-314, 314, 158, 
-158, 310, 310, 
-302, 302, 286, 
-286, 254, 254, 
-268, 268, 220, 
-220, 202, 202, 
-90, 90, 100, 
-100, 196, 196, 
-232, 232, 74, 
-74, 146, 146, 
-134, 134, 262, 
-262, 284, 284, 
-174, 174, 264, 
-264, 60, 60, 
-194, 194, 152, 
-152, 70, 70, 
-290, 290, 110, 
-110, 292, 292, 
-190, 190, 296, 
-296, 46, 46, 
-242, 242, 92, 
-92, 180, 180, 
-200, 200, 10, 
-256, 44, 44, 
-162, 162, 88, 
-88, 20, 20, 
-192, 192, 72, 
-72, 66, 66, 
-130, 130, 102, 
-102, 276, 276, 
-236, 236, 234, 
-234, 154, 154, 
-150, 150, 294, 
-294, 270, 270, 
-300, 300, 206, 
-206, 250, 250, 
-108, 108, 212, 
-212, 186, 186, 
-136, 136, 38, 
-38, 304, 304, 
-62, 62, 274, 
-274, 156, 156, 
-230, 230, 298, 
-298, 126, 126, 
-246, 246, 252, 
-252, 188, 188, 
-216, 216, 42, 
-42, 82, 82, 
-84, 84, 164, 
-164, 168, 168, 
-24, 24, 48, 
-48, 18, 18, 
-112, 112, 68, 
-68, 210, 210, 
-106, 106, 132, 
-132, 182, 182, 
-280, 280, 14, 
-288, 30, };
-__ALIGNED(8) const uint16_t perm30[NB_PERM30]={
-24, 10, 10, 
-56, 56, 30, 
-30, 18, 18, 
-2, 48, 20, 
-20, 26, 26, 
-34, 34, 66, 
-66, 22, 22, 
-50, 50, 44, 
-44, 36, 36, 
-4, 8, 32, 
-32, 42, 42, 
-12, 12, 16, 
-16, 64, 64, 
-62, 62, 38, 
-38, 28, 28, 
-58, 58, 54, 
-54, 6, 40, 
-52, 52, 68, 
-68, 46, 46, 
-60, 60, 14, 
-};
-__ALIGNED(8) const uint16_t perm31[NB_PERM31]={
-16, 50, 50, 
-10, 10, 2, 
-32, 22, 22, 
-20, 20, 4, 
-48, 72, 72, 
-30, 30, 6, 
-64, 44, 44, 
-40, 40, 8, 
-18, 66, 66, 
-60, 60, 12, 
-34, 38, 38, 
-70, 70, 14, 
-36, 54, 54, 
-42, 42, 24, 
-52, 26, 68, 
-76, 76, 62, 
-62, 28, 56, 
-58, 58, 74, 
-74, 46, };
-__ALIGNED(8) const uint16_t perm32[NB_PERM32]={
-30, 22, 22, 
-62, 62, 46, 
-46, 74, 74, 
-38, 38, 34, 
-34, 82, 82, 
-78, 78, 18, 
-18, 2, 60, 
-16, 16, 80, 
-80, 48, 48, 
-24, 24, 12, 
-12, 20, 20, 
-32, 32, 52, 
-52, 84, 84, 
-28, 28, 72, 
-72, 8, 8, 
-40, 40, 64, 
-64, 76, 76, 
-68, 68, 56, 
-56, 36, 36, 
-4, 10, 70, 
-70, 86, 86, 
-58, 58, 66, 
-66, 26, 26, 
-42, 42, 14, 
-14, 50, 50, 
-54, 54, 6, 
-};
-__ALIGNED(8) const uint16_t perm33[NB_PERM33]={
-48, 8, 8, 
-32, 32, 36, 
-36, 6, 6, 
-64, 64, 26, 
-26, 52, 52, 
-24, 24, 4, 
-4, 16, 16, 
-18, 18, 66, 
-66, 74, 74, 
-60, 60, 10, 
-10, 80, 80, 
-44, 44, 38, 
-38, 54, 54, 
-72, 72, 12, 
-12, 2, 50, 
-56, 56, 40, 
-40, 22, 22, 
-82, 82, 92, 
-92, 46, 46, 
-86, 86, 62, 
-62, 58, 58, 
-88, 88, 30, 
-30, 68, 68, 
-42, 42, 70, 
-70, 90, 90, 
-78, 78, 76, 
-76, 28, 28, 
-20, 20, 34, 
-34, 84, 84, 
-14, };
-__ALIGNED(8) const uint16_t perm34[NB_PERM34]={
-50, 74, 74, 
-86, 86, 68, 
-68, 26, 26, 
-62, 62, 56, 
-56, 44, 44, 
-14, 14, 80, 
-80, 8, 8, 
-20, 20, 2, 
-10, 70, 70, 
-76, 76, 46, 
-46, 64, 64, 
-16, 16, 40, 
-40, 4, 60, 
-6, 30, 72, 
-72, 36, 36, 
-42, 42, 54, 
-54, 84, 84, 
-18, 18, 90, 
-90, 78, 78, 
-96, 96, 48, 
-48, 24, 24, 
-12, 52, 34, 
-34, 82, 82, 
-58, 58, 94, 
-94, 88, 88, 
-28, 28, 22, 
-92, 38, };
-__ALIGNED(8) const uint16_t perm35[NB_PERM35]={
-120, 102, 102, 
-92, 92, 132, 
-132, 72, 72, 
-2, 240, 56, 
-56, 150, 150, 
-44, 44, 180, 
-180, 24, 24, 
-50, 50, 220, 
-220, 246, 246, 
-96, 96, 52, 
-52, 340, 340, 
-348, 348, 78, 
-78, 42, 42, 
-60, 60, 70, 
-70, 350, 350, 
-198, 198, 34, 
-34, 330, 330, 
-68, 68, 230, 
-230, 206, 206, 
-194, 194, 224, 
-224, 166, 166, 
-254, 254, 146, 
-146, 124, 124, 
-342, 342, 38, 
-38, 140, 140, 
-232, 232, 326, 
-326, 148, 148, 
-244, 244, 296, 
-296, 168, 168, 
-54, 54, 30, 
-30, 90, 90, 
-12, 12, 80, 
-80, 162, 162, 
-14, 14, 200, 
-200, 154, 154, 
-284, 284, 236, 
-236, 136, 136, 
-312, 312, 58, 
-58, 270, 270, 
-36, 36, 20, 
-20, 130, 130, 
-272, 272, 156, 
-156, 84, 84, 
-82, 82, 282, 
-282, 116, 116, 
-182, 182, 144, 
-144, 4, 40, 
-260, 260, 186, 
-186, 64, 64, 
-310, 310, 258, 
-258, 66, 66, 
-110, 110, 142, 
-142, 352, 352, 
-318, 318, 98, 
-98, 172, 172, 
-294, 294, 48, 
-48, 100, 100, 
-292, 292, 248, 
-248, 216, 216, 
-6, 160, 324, 
-324, 28, 28, 
-290, 290, 128, 
-128, 152, 152, 
-164, 164, 134, 
-134, 192, 192, 
-104, 104, 212, 
-212, 234, 234, 
-16, 16, 320, 
-320, 218, 218, 
-126, 126, 32, 
-32, 210, 210, 
-114, 114, 62, 
-62, 190, 190, 
-304, 304, 328, 
-328, 268, 268, 
-346, 346, 278, 
-278, 196, 196, 
-344, 344, 158, 
-158, 204, 204, 
-74, 74, 122, 
-122, 222, 222, 
-46, 46, 300, 
-300, 88, 88, 
-322, 322, 338, 
-338, 228, 228, 
-86, 86, 202, 
-202, 274, 274, 
-276, 276, 76, 
-76, 242, 242, 
-176, 176, 214, 
-214, 354, 354, 
-118, 118, 302, 
-302, 208, 208, 
-314, 314, 178, 
-178, 334, 334, 
-308, 308, 138, 
-138, 112, 112, 
-262, 262, 306, 
-306, 18, 18, 
-10, 10, 280, 
-280, 316, 316, 
-298, 298, 288, 
-288, 8, 250, 
-336, 336, 108, 
-108, 22, 170, 
-174, 174, 94, 
-94, 252, 252, 
-26, 332, 188, 
-188, 184, 184, 
-264, 264, 106, 
-286, 356, 356, 
-238, 238, 256, 
-256, 266, 266, 
-226, };
-__ALIGNED(8) const uint16_t perm36[NB_PERM36]={
-54, 80, 80, 
-40, 40, 20, 
-20, 42, 42, 
-74, 74, 58, 
-58, 98, 98, 
-70, 70, 104, 
-104, 52, 52, 
-26, 26, 66, 
-66, 86, 86, 
-64, 64, 32, 
-32, 48, 48, 
-8, 8, 36, 
-36, 2, 18, 
-78, 78, 76, 
-76, 22, 22, 
-96, 96, 16, 
-16, 24, 24, 
-12, 12, 6, 
-6, 72, 72, 
-4, 90, 82, 
-82, 94, 94, 
-100, 100, 34, 
-34, 102, 102, 
-88, 88, 28, 
-28, 30, 30, 
-84, 84, 10, 
-60, 14, 56, 
-44, 44, 38, 
-92, 46, 62, 
-68, 68, 50, 
-};
-__ALIGNED(8) const uint16_t perm37[NB_PERM37]={
-40, 102, 102, 
-18, 18, 30, 
-30, 12, 12, 
-20, 20, 70, 
-70, 114, 114, 
-38, 38, 62, 
-62, 64, 64, 
-104, 104, 58, 
-58, 94, 94, 
-116, 116, 78, 
-78, 16, 16, 
-100, 100, 88, 
-88, 106, 106, 
-98, 98, 48, 
-48, 4, 4, 
-80, 80, 56, 
-56, 54, 54, 
-14, 14, 60, 
-60, 24, 24, 
-2, 10, 90, 
-90, 36, 36, 
-22, 22, 110, 
-110, 68, 68, 
-74, 74, 46, 
-46, 112, 112, 
-108, 108, 28, 
-28, 82, 82, 
-96, 96, 8, 
-8, 50, 50, 
-44, 44, 72, 
-72, 6, 42, 
-32, 32, 52, 
-52, 84, 84, 
-26, 92, 76, 
-76, 86, 86, 
-66, 66, 34, 
-};
-__ALIGNED(8) const uint16_t perm38[NB_PERM38]={
-16, 2, 32, 
-4, 48, 6, 
-64, 8, 80, 
-10, 96, 12, 
-112, 14, 34, 
-20, 50, 22, 
-66, 24, 82, 
-26, 98, 28, 
-114, 30, 52, 
-38, 68, 40, 
-84, 42, 100, 
-44, 116, 46, 
-70, 56, 86, 
-58, 102, 60, 
-118, 62, 88, 
-74, 104, 76, 
-120, 78, 106, 
-92, 122, 94, 
-124, 110, };
-__ALIGNED(8) const uint16_t perm39[NB_PERM39]={
-128, 578, 578, 
-542, 542, 236, 
-236, 500, 500, 
-44, 44, 320, 
-320, 8, 8, 
-512, 512, 188, 
-188, 548, 548, 
-620, 620, 110, 
-110, 50, 50, 
-80, 80, 2, 
-256, 406, 406, 
-394, 394, 376, 
-376, 472, 472, 
-250, 250, 22, 
-22, 160, 160, 
-4, 384, 360, 
-360, 72, 72, 
-240, 240, 6, 
-16, 400, 400, 
-10, 144, 354, 
-354, 312, 312, 
-246, 246, 390, 
-390, 120, 120, 
-66, 66, 480, 
-480, 12, 272, 
-182, 182, 164, 
-164, 260, 260, 
-38, 38, 560, 
-560, 14, 528, 
-588, 588, 558, 
-558, 636, 636, 
-510, 510, 60, 
-60, 96, 96, 
-402, 402, 138, 
-138, 594, 594, 
-318, 318, 630, 
-630, 126, 126, 
-450, 450, 90, 
-90, 18, 32, 
-176, 176, 404, 
-404, 266, 266, 
-422, 422, 170, 
-170, 20, 288, 
-582, 582, 174, 
-174, 276, 276, 
-438, 438, 570, 
-570, 30, 30, 
-48, 48, 576, 
-576, 414, 414, 
-282, 282, 198, 
-198, 564, 564, 
-270, 270, 54, 
-54, 336, 336, 
-408, 408, 522, 
-522, 204, 204, 
-324, 324, 264, 
-264, 294, 294, 
-342, 342, 168, 
-168, 516, 516, 
-444, 444, 330, 
-330, 24, 416, 
-410, 410, 26, 
-544, 364, 364, 
-328, 328, 520, 
-520, 76, 76, 
-496, 496, 412, 
-412, 154, 154, 
-370, 370, 88, 
-88, 514, 514, 
-316, 316, 502, 
-502, 172, 172, 
-148, 148, 610, 
-610, 94, 94, 
-274, 274, 310, 
-310, 118, 118, 
-562, 562, 142, 
-142, 226, 226, 
-484, 484, 268, 
-268, 550, 550, 
-124, 124, 322, 
-322, 136, 136, 
-466, 466, 490, 
-490, 28, 304, 
-358, 358, 568, 
-568, 526, 526, 
-460, 460, 106, 
-106, 418, 418, 
-538, 538, 604, 
-604, 334, 334, 
-280, 280, 70, 
-70, 112, 112, 
-178, 178, 532, 
-532, 220, 220, 
-100, 100, 34, 
-432, 186, 186, 
-420, 420, 42, 
-42, 192, 192, 
-180, 180, 36, 
-64, 352, 352, 
-184, 184, 292, 
-292, 214, 214, 
-340, 340, 40, 
-448, 586, 586, 
-430, 430, 58, 
-58, 592, 592, 
-190, 190, 52, 
-52, 208, 208, 
-580, 580, 46, 
-464, 362, 362, 
-200, 200, 68, 
-68, 608, 608, 
-590, 590, 62, 
-62, 224, 224, 
-356, 356, 440, 
-440, 74, 74, 
-368, 368, 584, 
-584, 302, 302, 
-230, 230, 116, 
-116, 434, 434, 
-314, 314, 374, 
-374, 344, 344, 
-296, 296, 470, 
-470, 122, 122, 
-194, 194, 308, 
-308, 614, 614, 
-350, 350, 56, 
-624, 366, 366, 
-456, 456, 474, 
-474, 378, 378, 
-600, 600, 78, 
-130, 82, 258, 
-534, 534, 348, 
-348, 552, 552, 
-252, 252, 150, 
-150, 114, 114, 
-306, 306, 486, 
-486, 396, 396, 
-504, 504, 300, 
-300, 102, 102, 
-162, 162, 132, 
-132, 210, 210, 
-84, 386, 488, 
-488, 524, 524, 
-332, 332, 152, 
-152, 242, 242, 
-134, 134, 338, 
-338, 536, 536, 
-476, 476, 506, 
-506, 428, 428, 
-554, 554, 380, 
-380, 104, 104, 
-290, 290, 86, 
-146, 482, 482, 
-140, 140, 98, 
-98, 530, 530, 
-92, 546, 492, 
-492, 156, 156, 
-498, 498, 540, 
-540, 108, 626, 
-494, 494, 284, 
-284, 326, 326, 
-392, 392, 248, 
-248, 518, 518, 
-572, 572, 158, 
-388, 616, 616, 
-478, 478, 634, 
-634, 382, 382, 
-232, 232, 244, 
-244, 262, 262, 
-166, 436, 442, 
-442, 202, 202, 
-196, 452, 218, 
-218, 596, 596, 
-446, 446, 458, 
-458, 602, 602, 
-206, 468, 618, 
-618, 606, 606, 
-462, 462, 234, 
-234, 372, 372, 
-216, 228, 612, 
-612, 222, 628, 
-622, 622, 238, 
-278, 566, 566, 
-398, 398, 632, 
-632, 254, 454, 
-346, 346, 424, 
-424, 298, 298, 
-598, 598, 574, 
-574, 286, 556, 
-508, };
-__ALIGNED(8) const uint16_t perm40[NB_PERM40]={
-2048, 4, 4, 
-512, 512, 16, 
-16, 128, 128, 
-64, 64, 32, 
-32, 256, 256, 
-8, 8, 1024, 
-1024, 2, 2560, 
-20, 20, 640, 
-640, 80, 80, 
-160, 160, 320, 
-320, 40, 40, 
-1280, 1280, 10, 
-10, 3072, 3072, 
-6, 1536, 18, 
-18, 2176, 2176, 
-68, 68, 544, 
-544, 272, 272, 
-136, 136, 1088, 
-1088, 34, 34, 
-2304, 2304, 12, 
-3584, 22, 22, 
-2688, 2688, 84, 
-84, 672, 672, 
-336, 336, 168, 
-168, 1344, 1344, 
-42, 42, 3328, 
-3328, 14, 1152, 
-66, 66, 2080, 
-2080, 260, 260, 
-520, 520, 1040, 
-1040, 130, 130, 
-2112, 2112, 36, 
-36, 768, 768, 
-24, 3200, 70, 
-70, 2592, 2592, 
-276, 276, 648, 
-648, 1104, 1104, 
-162, 162, 2368, 
-2368, 44, 44, 
-1792, 1792, 26, 
-1664, 82, 82, 
-2208, 2208, 324, 
-324, 552, 552, 
-1296, 1296, 138, 
-138, 3136, 3136, 
-38, 38, 2816, 
-2816, 28, 3712, 
-86, 86, 2720, 
-2720, 340, 340, 
-680, 680, 1360, 
-1360, 170, 170, 
-3392, 3392, 46, 
-46, 3840, 3840, 
-30, 384, 72, 
-72, 1056, 1056, 
-258, 258, 2056, 
-2056, 1028, 1028, 
-514, 514, 2064, 
-2064, 132, 132, 
-576, 576, 48, 
-2432, 76, 76, 
-1568, 1568, 274, 
-274, 2184, 2184, 
-1092, 1092, 546, 
-546, 2320, 2320, 
-140, 140, 1600, 
-1600, 50, 896, 
-88, 88, 1184, 
-1184, 322, 322, 
-2088, 2088, 1284, 
-1284, 522, 522, 
-3088, 3088, 134, 
-134, 2624, 2624, 
-52, 2944, 92, 
-92, 1696, 1696, 
-338, 338, 2216, 
-2216, 1348, 1348, 
-554, 554, 3344, 
-3344, 142, 142, 
-3648, 3648, 54, 
-1408, 74, 74, 
-3104, 3104, 262, 
-262, 2568, 2568, 
-1044, 1044, 642, 
-642, 2128, 2128, 
-164, 164, 832, 
-832, 56, 3456, 
-78, 78, 3616, 
-3616, 278, 278, 
-2696, 2696, 1108, 
-1108, 674, 674, 
-2384, 2384, 172, 
-172, 1856, 1856, 
-58, 1920, 90, 
-90, 3232, 3232, 
-326, 326, 2600, 
-2600, 1300, 1300, 
-650, 650, 3152, 
-3152, 166, 166, 
-2880, 2880, 60, 
-3968, 94, 94, 
-3744, 3744, 342, 
-342, 2728, 2728, 
-1364, 1364, 682, 
-682, 3408, 3408, 
-174, 174, 3904, 
-3904, 62, 288, 
-264, 264, 1032, 
-1032, 1026, 1026, 
-2050, 2050, 2052, 
-2052, 516, 516, 
-528, 528, 144, 
-144, 192, 192, 
-96, 2336, 268, 
-268, 1544, 1544, 
-1042, 1042, 2178, 
-2178, 2116, 2116, 
-548, 548, 784, 
-784, 152, 152, 
-1216, 1216, 98, 
-800, 280, 280, 
-1160, 1160, 1090, 
-1090, 2082, 2082, 
-2308, 2308, 524, 
-524, 1552, 1552, 
-146, 146, 2240, 
-2240, 100, 2848, 
-284, 284, 1672, 
-1672, 1106, 1106, 
-2210, 2210, 2372, 
-2372, 556, 556, 
-1808, 1808, 154, 
-154, 3264, 3264, 
-102, 1312, 266, 
-266, 3080, 3080, 
-1030, 1030, 2562, 
-2562, 2068, 2068, 
-644, 644, 592, 
-592, 176, 176, 
-448, 448, 104, 
-3360, 270, 270, 
-3592, 3592, 1046, 
-1046, 2690, 2690, 
-2132, 2132, 676, 
-676, 848, 848, 
-184, 184, 1472, 
-1472, 106, 1824, 
-282, 282, 3208, 
-3208, 1094, 1094, 
-2594, 2594, 2324, 
-2324, 652, 652, 
-1616, 1616, 178, 
-178, 2496, 2496, 
-108, 3872, 286, 
-286, 3720, 3720, 
-1110, 1110, 2722, 
-2722, 2388, 2388, 
-684, 684, 1872, 
-1872, 186, 186, 
-3520, 3520, 110, 
-416, 328, 328, 
-1064, 1064, 1282, 
-1282, 2058, 2058, 
-3076, 3076, 518, 
-518, 2576, 2576, 
-148, 148, 704, 
-704, 112, 2464, 
-332, 332, 1576, 
-1576, 1298, 1298, 
-2186, 2186, 3140, 
-3140, 550, 550, 
-2832, 2832, 156, 
-156, 1728, 1728, 
-114, 928, 344, 
-344, 1192, 1192, 
-1346, 1346, 2090, 
-2090, 3332, 3332, 
-526, 526, 3600, 
-3600, 150, 150, 
-2752, 2752, 116, 
-2976, 348, 348, 
-1704, 1704, 1362, 
-1362, 2218, 2218, 
-3396, 3396, 558, 
-558, 3856, 3856, 
-158, 158, 3776, 
-3776, 118, 1440, 
-330, 330, 3112, 
-3112, 1286, 1286, 
-2570, 2570, 3092, 
-3092, 646, 646, 
-2640, 2640, 180, 
-180, 960, 960, 
-120, 3488, 334, 
-334, 3624, 3624, 
-1302, 1302, 2698, 
-2698, 3156, 3156, 
-678, 678, 2896, 
-2896, 188, 188, 
-1984, 1984, 122, 
-1952, 346, 346, 
-3240, 3240, 1350, 
-1350, 2602, 2602, 
-3348, 3348, 654, 
-654, 3664, 3664, 
-182, 182, 3008, 
-3008, 124, 4000, 
-350, 350, 3752, 
-3752, 1366, 1366, 
-2730, 2730, 3412, 
-3412, 686, 686, 
-3920, 3920, 190, 
-190, 4032, 4032, 
-126, 2144, 292, 
-292, 776, 776, 
-1048, 1048, 1154, 
-1154, 2114, 2114, 
-2084, 2084, 772, 
-772, 536, 536, 
-1168, 1168, 194, 
-608, 304, 304, 
-392, 392, 1096, 
-1096, 1058, 1058, 
-2306, 2306, 2060, 
-2060, 1540, 1540, 
-530, 530, 2192, 
-2192, 196, 2656, 
-308, 308, 904, 
-904, 1112, 1112, 
-1186, 1186, 2370, 
-2370, 2092, 2092, 
-1796, 1796, 538, 
-538, 3216, 3216, 
-198, 1120, 290, 
-290, 2312, 2312, 
-1036, 1036, 1538, 
-1538, 2066, 2066, 
-2180, 2180, 580, 
-580, 560, 560, 
-400, 400, 200, 
-3168, 294, 294, 
-2824, 2824, 1052, 
-1052, 1666, 1666, 
-2130, 2130, 2212, 
-2212, 836, 836, 
-568, 568, 1424, 
-1424, 202, 1632, 
-306, 306, 2440, 
-2440, 1100, 1100, 
-1570, 1570, 2322, 
-2322, 2188, 2188, 
-1604, 1604, 562, 
-562, 2448, 2448, 
-204, 3680, 310, 
-310, 2952, 2952, 
-1116, 1116, 1698, 
-1698, 2386, 2386, 
-2220, 2220, 1860, 
-1860, 570, 570, 
-3472, 3472, 206, 
-224, 352, 352, 
-296, 296, 1288, 
-1288, 1034, 1034, 
-3074, 3074, 2054, 
-2054, 2564, 2564, 
-532, 532, 656, 
-656, 208, 2272, 
-356, 356, 808, 
-808, 1304, 1304, 
-1162, 1162, 3138, 
-3138, 2086, 2086, 
-2820, 2820, 540, 
-540, 1680, 1680, 
-210, 736, 368, 
-368, 424, 424, 
-1352, 1352, 1066, 
-1066, 3330, 3330, 
-2062, 2062, 3588, 
-3588, 534, 534, 
-2704, 2704, 212, 
-2784, 372, 372, 
-936, 936, 1368, 
-1368, 1194, 1194, 
-3394, 3394, 2094, 
-2094, 3844, 3844, 
-542, 542, 3728, 
-3728, 214, 1248, 
-354, 354, 2344, 
-2344, 1292, 1292, 
-1546, 1546, 3090, 
-3090, 2182, 2182, 
-2628, 2628, 564, 
-564, 912, 912, 
-216, 3296, 358, 
-358, 2856, 2856, 
-1308, 1308, 1674, 
-1674, 3154, 3154, 
-2214, 2214, 2884, 
-2884, 572, 572, 
-1936, 1936, 218, 
-1760, 370, 370, 
-2472, 2472, 1356, 
-1356, 1578, 1578, 
-3346, 3346, 2190, 
-2190, 3652, 3652, 
-566, 566, 2960, 
-2960, 220, 3808, 
-374, 374, 2984, 
-2984, 1372, 1372, 
-1706, 1706, 3410, 
-3410, 2222, 2222, 
-3908, 3908, 574, 
-574, 3984, 3984, 
-222, 2400, 300, 
-300, 1800, 1800, 
-1050, 1050, 3202, 
-3202, 2118, 2118, 
-2596, 2596, 788, 
-788, 664, 664, 
-1232, 1232, 226, 
-864, 312, 312, 
-1416, 1416, 1098, 
-1098, 3106, 3106, 
-2310, 2310, 2572, 
-2572, 1556, 1556, 
-658, 658, 2256, 
-2256, 228, 2912, 
-316, 316, 1928, 
-1928, 1114, 1114, 
-3234, 3234, 2374, 
-2374, 2604, 2604, 
-1812, 1812, 666, 
-666, 3280, 3280, 
-230, 1376, 298, 
-298, 3336, 3336, 
-1038, 1038, 3586, 
-3586, 2070, 2070, 
-2692, 2692, 596, 
-596, 688, 688, 
-464, 464, 232, 
-3424, 302, 302, 
-3848, 3848, 1054, 
-1054, 3714, 3714, 
-2134, 2134, 2724, 
-2724, 852, 852, 
-696, 696, 1488, 
-1488, 234, 1888, 
-314, 314, 3464, 
-3464, 1102, 1102, 
-3618, 3618, 2326, 
-2326, 2700, 2700, 
-1620, 1620, 690, 
-690, 2512, 2512, 
-236, 3936, 318, 
-318, 3976, 3976, 
-1118, 1118, 3746, 
-3746, 2390, 2390, 
-2732, 2732, 1876, 
-1876, 698, 698, 
-3536, 3536, 238, 
-480, 360, 360, 
-1320, 1320, 1290, 
-1290, 3082, 3082, 
-3078, 3078, 2566, 
-2566, 2580, 2580, 
-660, 660, 720, 
-720, 240, 2528, 
-364, 364, 1832, 
-1832, 1306, 1306, 
-3210, 3210, 3142, 
-3142, 2598, 2598, 
-2836, 2836, 668, 
-668, 1744, 1744, 
-242, 992, 376, 
-376, 1448, 1448, 
-1354, 1354, 3114, 
-3114, 3334, 3334, 
-2574, 2574, 3604, 
-3604, 662, 662, 
-2768, 2768, 244, 
-3040, 380, 380, 
-1960, 1960, 1370, 
-1370, 3242, 3242, 
-3398, 3398, 2606, 
-2606, 3860, 3860, 
-670, 670, 3792, 
-3792, 246, 1504, 
-362, 362, 3368, 
-3368, 1294, 1294, 
-3594, 3594, 3094, 
-3094, 2694, 2694, 
-2644, 2644, 692, 
-692, 976, 976, 
-248, 3552, 366, 
-366, 3880, 3880, 
-1310, 1310, 3722, 
-3722, 3158, 3158, 
-2726, 2726, 2900, 
-2900, 700, 700, 
-2000, 2000, 250, 
-2016, 378, 378, 
-3496, 3496, 1358, 
-1358, 3626, 3626, 
-3350, 3350, 2702, 
-2702, 3668, 3668, 
-694, 694, 3024, 
-3024, 252, 4064, 
-382, 382, 4008, 
-4008, 1374, 1374, 
-3754, 3754, 3414, 
-3414, 2734, 2734, 
-3924, 3924, 702, 
-702, 4048, 4048, 
-254, 2120, 1060, 
-1060, 770, 770, 
-2072, 2072, 1156, 
-1156, 578, 578, 
-2096, 2096, 388, 
-388, 584, 584, 
-1072, 1072, 386, 
-2632, 1076, 1076, 
-898, 898, 2136, 
-2136, 1188, 1188, 
-834, 834, 2104, 
-2104, 1412, 1412, 
-586, 586, 3120, 
-3120, 390, 3144, 
-1062, 1062, 2818, 
-2818, 2076, 2076, 
-1668, 1668, 594, 
-594, 2224, 2224, 
-452, 452, 616, 
-616, 1328, 1328, 
-394, 1608, 1074, 
-1074, 2434, 2434, 
-2124, 2124, 1572, 
-1572, 786, 786, 
-2200, 2200, 1220, 
-1220, 610, 610, 
-2352, 2352, 396, 
-3656, 1078, 1078, 
-2946, 2946, 2140, 
-2140, 1700, 1700, 
-850, 850, 2232, 
-2232, 1476, 1476, 
-618, 618, 3376, 
-3376, 398, 2248, 
-1124, 1124, 802, 
-802, 2328, 2328, 
-1164, 1164, 1602, 
-1602, 2098, 2098, 
-2436, 2436, 588, 
-588, 1584, 1584, 
-402, 712, 1136, 
-1136, 418, 418, 
-2376, 2376, 1068, 
-1068, 1794, 1794, 
-2074, 2074, 3204, 
-3204, 582, 582, 
-2608, 2608, 404, 
-2760, 1140, 1140, 
-930, 930, 2392, 
-2392, 1196, 1196, 
-1858, 1858, 2106, 
-2106, 3460, 3460, 
-590, 590, 3632, 
-3632, 406, 1224, 
-1122, 1122, 2338, 
-2338, 2316, 2316, 
-1548, 1548, 1554, 
-1554, 2194, 2194, 
-2244, 2244, 612, 
-612, 816, 816, 
-408, 3272, 1126, 
-1126, 2850, 2850, 
-2332, 2332, 1676, 
-1676, 1618, 1618, 
-2226, 2226, 2500, 
-2500, 620, 620, 
-1840, 1840, 410, 
-1736, 1138, 1138, 
-2466, 2466, 2380, 
-2380, 1580, 1580, 
-1810, 1810, 2202, 
-2202, 3268, 3268, 
-614, 614, 2864, 
-2864, 412, 3784, 
-1142, 1142, 2978, 
-2978, 2396, 2396, 
-1708, 1708, 1874, 
-1874, 2234, 2234, 
-3524, 3524, 622, 
-622, 3888, 3888, 
-414, 840, 1080, 
-1080, 1410, 1410, 
-2122, 2122, 3108, 
-3108, 774, 774, 
-2584, 2584, 1172, 
-1172, 706, 706, 
-2160, 2160, 420, 
-2888, 1084, 1084, 
-1922, 1922, 2138, 
-2138, 3236, 3236, 
-838, 838, 2616, 
-2616, 1428, 1428, 
-714, 714, 3184, 
-3184, 422, 3400, 
-1070, 1070, 3842, 
-3842, 2078, 2078, 
-3716, 3716, 598, 
-598, 2736, 2736, 
-468, 468, 744, 
-744, 1392, 1392, 
-426, 1864, 1082, 
-1082, 3458, 3458, 
-2126, 2126, 3620, 
-3620, 790, 790, 
-2712, 2712, 1236, 
-1236, 738, 738, 
-2416, 2416, 428, 
-3912, 1086, 1086, 
-3970, 3970, 2142, 
-2142, 3748, 3748, 
-854, 854, 2744, 
-2744, 1492, 1492, 
-746, 746, 3440, 
-3440, 430, 456, 
-1128, 1128, 1314, 
-1314, 2314, 2314, 
-3084, 3084, 1542, 
-1542, 2578, 2578, 
-2196, 2196, 708, 
-708, 624, 624, 
-432, 2504, 1132, 
-1132, 1826, 1826, 
-2330, 2330, 3212, 
-3212, 1606, 1606, 
-2610, 2610, 2452, 
-2452, 716, 716, 
-1648, 1648, 434, 
-968, 1144, 1144, 
-1442, 1442, 2378, 
-2378, 3116, 3116, 
-1798, 1798, 2586, 
-2586, 3220, 3220, 
-710, 710, 2672, 
-2672, 436, 3016, 
-1148, 1148, 1954, 
-1954, 2394, 2394, 
-3244, 3244, 1862, 
-1862, 2618, 2618, 
-3476, 3476, 718, 
-718, 3696, 3696, 
-438, 1480, 1130, 
-1130, 3362, 3362, 
-2318, 2318, 3596, 
-3596, 1558, 1558, 
-2706, 2706, 2260, 
-2260, 740, 740, 
-880, 880, 440, 
-3528, 1134, 1134, 
-3874, 3874, 2334, 
-2334, 3724, 3724, 
-1622, 1622, 2738, 
-2738, 2516, 2516, 
-748, 748, 1904, 
-1904, 442, 1992, 
-1146, 1146, 3490, 
-3490, 2382, 2382, 
-3628, 3628, 1814, 
-1814, 2714, 2714, 
-3284, 3284, 742, 
-742, 2928, 2928, 
-444, 4040, 1150, 
-1150, 4002, 4002, 
-2398, 2398, 3756, 
-3756, 1878, 1878, 
-2746, 2746, 3540, 
-3540, 750, 750, 
-3952, 3952, 446, 
-2152, 1316, 1316, 
-778, 778, 3096, 
-3096, 1158, 1158, 
-2626, 2626, 2100, 
-2100, 900, 900, 
-600, 600, 1200, 
-1200, 450, 2664, 
-1332, 1332, 906, 
-906, 3160, 3160, 
-1190, 1190, 2882, 
-2882, 2108, 2108, 
-1924, 1924, 602, 
-602, 3248, 3248, 
-454, 3176, 1318, 
-1318, 2826, 2826, 
-3100, 3100, 1670, 
-1670, 2642, 2642, 
-2228, 2228, 964, 
-964, 632, 632, 
-1456, 1456, 458, 
-1640, 1330, 1330, 
-2442, 2442, 3148, 
-3148, 1574, 1574, 
-2834, 2834, 2204, 
-2204, 1732, 1732, 
-626, 626, 2480, 
-2480, 460, 3688, 
-1334, 1334, 2954, 
-2954, 3164, 3164, 
-1702, 1702, 2898, 
-2898, 2236, 2236, 
-1988, 1988, 634, 
-634, 3504, 3504, 
-462, 2280, 1380, 
-1380, 810, 810, 
-3352, 3352, 1166, 
-1166, 3650, 3650, 
-2102, 2102, 2948, 
-2948, 604, 604, 
-1712, 1712, 466, 
-2792, 1396, 1396, 
-938, 938, 3416, 
-3416, 1198, 1198, 
-3906, 3906, 2110, 
-2110, 3972, 3972, 
-606, 606, 3760, 
-3760, 470, 1256, 
-1378, 1378, 2346, 
-2346, 3340, 3340, 
-1550, 1550, 3602, 
-3602, 2198, 2198, 
-2756, 2756, 628, 
-628, 944, 944, 
-472, 3304, 1382, 
-1382, 2858, 2858, 
-3356, 3356, 1678, 
-1678, 3666, 3666, 
-2230, 2230, 3012, 
-3012, 636, 636, 
-1968, 1968, 474, 
-1768, 1394, 1394, 
-2474, 2474, 3404, 
-3404, 1582, 1582, 
-3858, 3858, 2206, 
-2206, 3780, 3780, 
-630, 630, 2992, 
-2992, 476, 3816, 
-1398, 1398, 2986, 
-2986, 3420, 3420, 
-1710, 1710, 3922, 
-3922, 2238, 2238, 
-4036, 4036, 638, 
-638, 4016, 4016, 
-478, 2408, 1324, 
-1324, 1802, 1802, 
-3098, 3098, 3206, 
-3206, 2630, 2630, 
-2612, 2612, 916, 
-916, 728, 728, 
-1264, 1264, 482, 
-872, 1336, 1336, 
-1418, 1418, 3146, 
-3146, 3110, 3110, 
-2822, 2822, 2588, 
-2588, 1684, 1684, 
-722, 722, 2288, 
-2288, 484, 2920, 
-1340, 1340, 1930, 
-1930, 3162, 3162, 
-3238, 3238, 2886, 
-2886, 2620, 2620, 
-1940, 1940, 730, 
-730, 3312, 3312, 
-486, 1384, 1322, 
-1322, 3338, 3338, 
-3086, 3086, 3590, 
-3590, 2582, 2582, 
-2708, 2708, 724, 
-724, 752, 752, 
-496, 496, 488, 
-3432, 1326, 1326, 
-3850, 3850, 3102, 
-3102, 3718, 3718, 
-2646, 2646, 2740, 
-2740, 980, 980, 
-760, 760, 1520, 
-1520, 490, 1896, 
-1338, 1338, 3466, 
-3466, 3150, 3150, 
-3622, 3622, 2838, 
-2838, 2716, 2716, 
-1748, 1748, 754, 
-754, 2544, 2544, 
-492, 3944, 1342, 
-1342, 3978, 3978, 
-3166, 3166, 3750, 
-3750, 2902, 2902, 
-2748, 2748, 2004, 
-2004, 762, 762, 
-3568, 3568, 494, 
-2536, 1388, 1388, 
-1834, 1834, 3354, 
-3354, 3214, 3214, 
-3654, 3654, 2614, 
-2614, 2964, 2964, 
-732, 732, 1776, 
-1776, 498, 1000, 
-1400, 1400, 1450, 
-1450, 3402, 3402, 
-3118, 3118, 3846, 
-3846, 2590, 2590, 
-3732, 3732, 726, 
-726, 2800, 2800, 
-500, 3048, 1404, 
-1404, 1962, 1962, 
-3418, 3418, 3246, 
-3246, 3910, 3910, 
-2622, 2622, 3988, 
-3988, 734, 734, 
-3824, 3824, 502, 
-1512, 1386, 1386, 
-3370, 3370, 3342, 
-3342, 3598, 3598, 
-3606, 3606, 2710, 
-2710, 2772, 2772, 
-756, 756, 1008, 
-1008, 504, 3560, 
-1390, 1390, 3882, 
-3882, 3358, 3358, 
-3726, 3726, 3670, 
-3670, 2742, 2742, 
-3028, 3028, 764, 
-764, 2032, 2032, 
-506, 2024, 1402, 
-1402, 3498, 3498, 
-3406, 3406, 3630, 
-3630, 3862, 3862, 
-2718, 2718, 3796, 
-3796, 758, 758, 
-3056, 3056, 508, 
-4072, 1406, 1406, 
-4010, 4010, 3422, 
-3422, 3758, 3758, 
-3926, 3926, 2750, 
-2750, 4052, 4052, 
-766, 766, 4080, 
-4080, 510, 1560, 
-1170, 1170, 2242, 
-2242, 2148, 2148, 
-804, 804, 792, 
-792, 1176, 1176, 
-1218, 1218, 2146, 
-2146, 2340, 2340, 
-780, 3608, 1174, 
-1174, 2754, 2754, 
-2164, 2164, 932, 
-932, 856, 856, 
-1208, 1208, 1474, 
-1474, 2154, 2154, 
-3364, 3364, 782, 
-3224, 1222, 1222, 
-2658, 2658, 2356, 
-2356, 908, 908, 
-1624, 1624, 1202, 
-1202, 2498, 2498, 
-2156, 2156, 1828, 
-1828, 794, 1688, 
-1234, 1234, 2274, 
-2274, 2404, 2404, 
-812, 812, 1816, 
-1816, 1178, 1178, 
-3266, 3266, 2150, 
-2150, 2852, 2852, 
-796, 3736, 1238, 
-1238, 2786, 2786, 
-2420, 2420, 940, 
-940, 1880, 1880, 
-1210, 1210, 3522, 
-3522, 2158, 2158, 
-3876, 3876, 798, 
-2840, 1180, 1180, 
-1730, 1730, 2162, 
-2162, 2468, 2468, 
-844, 844, 1592, 
-1592, 1426, 1426, 
-2250, 2250, 3172, 
-3172, 806, 3864, 
-1182, 1182, 3778, 
-3778, 2166, 2166, 
-2980, 2980, 860, 
-860, 1720, 1720, 
-1490, 1490, 2282, 
-2282, 3428, 3428, 
-814, 2456, 1228, 
-1228, 1634, 1634, 
-2354, 2354, 2444, 
-2444, 1612, 1612, 
-1586, 1586, 2450, 
-2450, 2252, 2252, 
-1636, 1636, 818, 
-920, 1240, 1240, 
-1250, 1250, 2402, 
-2402, 2348, 2348, 
-1804, 1804, 1562, 
-1562, 3218, 3218, 
-2246, 2246, 2660, 
-2660, 820, 2968, 
-1244, 1244, 1762, 
-1762, 2418, 2418, 
-2476, 2476, 1868, 
-1868, 1594, 1594, 
-3474, 3474, 2254, 
-2254, 3684, 3684, 
-822, 1432, 1226, 
-1226, 3170, 3170, 
-2342, 2342, 2828, 
-2828, 1564, 1564, 
-1682, 1682, 2258, 
-2258, 2276, 2276, 
-868, 868, 824, 
-3480, 1230, 1230, 
-3682, 3682, 2358, 
-2358, 2956, 2956, 
-1628, 1628, 1714, 
-1714, 2514, 2514, 
-2284, 2284, 1892, 
-1892, 826, 1944, 
-1242, 1242, 3298, 
-3298, 2406, 2406, 
-2860, 2860, 1820, 
-1820, 1690, 1690, 
-3282, 3282, 2278, 
-2278, 2916, 2916, 
-828, 3992, 1246, 
-1246, 3810, 3810, 
-2422, 2422, 2988, 
-2988, 1884, 1884, 
-1722, 1722, 3538, 
-3538, 2286, 2286, 
-3940, 3940, 830, 
-3128, 1414, 1414, 
-2634, 2634, 3124, 
-3124, 902, 902, 
-2648, 2648, 1204, 
-1204, 962, 962, 
-2168, 2168, 1444, 
-1444, 842, 3640, 
-1430, 1430, 2762, 
-2762, 3188, 3188, 
-934, 934, 2904, 
-2904, 1212, 1212, 
-1986, 1986, 2170, 
-2170, 3492, 3492, 
-846, 3256, 1478, 
-1478, 2666, 2666, 
-3380, 3380, 910, 
-910, 3672, 3672, 
-1206, 1206, 3010, 
-3010, 2172, 2172, 
-1956, 1956, 858, 
-3768, 1494, 1494, 
-2794, 2794, 3444, 
-3444, 942, 942, 
-3928, 3928, 1214, 
-1214, 4034, 4034, 
-2174, 2174, 4004, 
-4004, 862, 2360, 
-1420, 1420, 1610, 
-1610, 3122, 3122, 
-2438, 2438, 2636, 
-2636, 1588, 1588, 
-914, 914, 2264, 
-2264, 1252, 1252, 
-866, 2872, 1436, 
-1436, 1738, 1738, 
-3186, 3186, 2470, 
-2470, 2892, 2892, 
-1596, 1596, 1938, 
-1938, 2266, 2266, 
-3300, 3300, 870, 
-3384, 1422, 1422, 
-3658, 3658, 3126, 
-3126, 2950, 2950, 
-2652, 2652, 1716, 
-1716, 978, 978, 
-2296, 2296, 1508, 
-1508, 874, 1848, 
-1434, 1434, 3274, 
-3274, 3174, 3174, 
-2854, 2854, 2844, 
-2844, 1692, 1692, 
-1746, 1746, 2290, 
-2290, 2532, 2532, 
-876, 3896, 1438, 
-1438, 3786, 3786, 
-3190, 3190, 2982, 
-2982, 2908, 2908, 
-1724, 1724, 2002, 
-2002, 2298, 2298, 
-3556, 3556, 878, 
-2488, 1484, 1484, 
-1642, 1642, 3378, 
-3378, 2446, 2446, 
-3660, 3660, 1590, 
-1590, 2962, 2962, 
-2268, 2268, 1764, 
-1764, 882, 952, 
-1496, 1496, 1258, 
-1258, 3426, 3426, 
-2350, 2350, 3852, 
-3852, 1566, 1566, 
-3730, 3730, 2262, 
-2262, 2788, 2788, 
-884, 3000, 1500, 
-1500, 1770, 1770, 
-3442, 3442, 2478, 
-2478, 3916, 3916, 
-1598, 1598, 3986, 
-3986, 2270, 2270, 
-3812, 3812, 886, 
-1464, 1482, 1482, 
-3178, 3178, 3366, 
-3366, 2830, 2830, 
-3612, 3612, 1686, 
-1686, 2770, 2770, 
-2292, 2292, 996, 
-996, 888, 3512, 
-1486, 1486, 3690, 
-3690, 3382, 3382, 
-2958, 2958, 3676, 
-3676, 1718, 1718, 
-3026, 3026, 2300, 
-2300, 2020, 2020, 
-890, 1976, 1498, 
-1498, 3306, 3306, 
-3430, 3430, 2862, 
-2862, 3868, 3868, 
-1694, 1694, 3794, 
-3794, 2294, 2294, 
-3044, 3044, 892, 
-4024, 1502, 1502, 
-3818, 3818, 3446, 
-3446, 2990, 2990, 
-3932, 3932, 1726, 
-1726, 4050, 4050, 
-2302, 2302, 4068, 
-4068, 894, 2776, 
-1268, 1268, 994, 
-994, 2424, 2424, 
-1452, 1452, 1866, 
-1866, 3130, 3130, 
-3462, 3462, 2638, 
-2638, 3636, 3636, 
-918, 3288, 1254, 
-1254, 2914, 2914, 
-2364, 2364, 1932, 
-1932, 1626, 1626, 
-3250, 3250, 2502, 
-2502, 2668, 2668, 
-1844, 1844, 922, 
-1752, 1266, 1266, 
-2530, 2530, 2412, 
-2412, 1836, 1836, 
-1818, 1818, 3226, 
-3226, 3270, 3270, 
-2662, 2662, 2868, 
-2868, 924, 3800, 
-1270, 1270, 3042, 
-3042, 2428, 2428, 
-1964, 1964, 1882, 
-1882, 3258, 3258, 
-3526, 3526, 2670, 
-2670, 3892, 3892, 
-926, 2520, 1260, 
-1260, 1890, 1890, 
-2362, 2362, 3468, 
-3468, 1614, 1614, 
-3634, 3634, 2454, 
-2454, 2764, 2764, 
-1652, 1652, 946, 
-984, 1272, 1272, 
-1506, 1506, 2410, 
-2410, 3372, 3372, 
-1806, 1806, 3610, 
-3610, 3222, 3222, 
-2758, 2758, 2676, 
-2676, 948, 3032, 
-1276, 1276, 2018, 
-2018, 2426, 2426, 
-3500, 3500, 1870, 
-1870, 3642, 3642, 
-3478, 3478, 2766, 
-2766, 3700, 3700, 
-950, 3544, 1262, 
-1262, 3938, 3938, 
-2366, 2366, 3980, 
-3980, 1630, 1630, 
-3762, 3762, 2518, 
-2518, 2796, 2796, 
-1908, 1908, 954, 
-2008, 1274, 1274, 
-3554, 3554, 2414, 
-2414, 3884, 3884, 
-1822, 1822, 3738, 
-3738, 3286, 3286, 
-2790, 2790, 2932, 
-2932, 956, 4056, 
-1278, 1278, 4066, 
-4066, 2430, 2430, 
-4012, 4012, 1886, 
-1886, 3770, 3770, 
-3542, 3542, 2798, 
-2798, 3956, 3956, 
-958, 2680, 1460, 
-1460, 970, 970, 
-3192, 3192, 1446, 
-1446, 2890, 2890, 
-3132, 3132, 1926, 
-1926, 2650, 2650, 
-3252, 3252, 966, 
-1656, 1458, 1458, 
-2506, 2506, 3180, 
-3180, 1830, 1830, 
-2842, 2842, 3228, 
-3228, 1734, 1734, 
-2674, 2674, 2484, 
-2484, 972, 3704, 
-1462, 1462, 3018, 
-3018, 3196, 3196, 
-1958, 1958, 2906, 
-2906, 3260, 3260, 
-1990, 1990, 2682, 
-2682, 3508, 3508, 
-974, 2808, 1524, 
-1524, 1002, 1002, 
-3448, 3448, 1454, 
-1454, 3914, 3914, 
-3134, 3134, 3974, 
-3974, 2654, 2654, 
-3764, 3764, 982, 
-3320, 1510, 1510, 
-2922, 2922, 3388, 
-3388, 1934, 1934, 
-3674, 3674, 3254, 
-3254, 3014, 3014, 
-2684, 2684, 1972, 
-1972, 986, 1784, 
-1522, 1522, 2538, 
-2538, 3436, 3436, 
-1838, 1838, 3866, 
-3866, 3230, 3230, 
-3782, 3782, 2678, 
-2678, 2996, 2996, 
-988, 3832, 1526, 
-1526, 3050, 3050, 
-3452, 3452, 1966, 
-1966, 3930, 3930, 
-3262, 3262, 4038, 
-4038, 2686, 2686, 
-4020, 4020, 990, 
-2936, 1468, 1468, 
-1994, 1994, 3194, 
-3194, 3494, 3494, 
-2894, 2894, 3644, 
-3644, 1942, 1942, 
-2778, 2778, 3316, 
-3316, 998, 1912, 
-1466, 1466, 3530, 
-3530, 3182, 3182, 
-3878, 3878, 2846, 
-2846, 3740, 3740, 
-1750, 1750, 2802, 
-2802, 2548, 2548, 
-1004, 3960, 1470, 
-1470, 4042, 4042, 
-3198, 3198, 4006, 
-4006, 2910, 2910, 
-3772, 3772, 2006, 
-2006, 2810, 2810, 
-3572, 3572, 1006, 
-2552, 1516, 1516, 
-1898, 1898, 3386, 
-3386, 3470, 3470, 
-3662, 3662, 3638, 
-3638, 2966, 2966, 
-2780, 2780, 1780, 
-1780, 1010, 1016, 
-1528, 1528, 1514, 
-1514, 3434, 3434, 
-3374, 3374, 3854, 
-3854, 3614, 3614, 
-3734, 3734, 2774, 
-2774, 2804, 2804, 
-1012, 3064, 1532, 
-1532, 2026, 2026, 
-3450, 3450, 3502, 
-3502, 3918, 3918, 
-3646, 3646, 3990, 
-3990, 2782, 2782, 
-3828, 3828, 1014, 
-3576, 1518, 1518, 
-3946, 3946, 3390, 
-3390, 3982, 3982, 
-3678, 3678, 3766, 
-3766, 3030, 3030, 
-2812, 2812, 2036, 
-2036, 1018, 2040, 
-1530, 1530, 3562, 
-3562, 3438, 3438, 
-3886, 3886, 3870, 
-3870, 3742, 3742, 
-3798, 3798, 2806, 
-2806, 3060, 3060, 
-1020, 4088, 1534, 
-1534, 4074, 4074, 
-3454, 3454, 4014, 
-4014, 3934, 3934, 
-3774, 3774, 4054, 
-4054, 2814, 2814, 
-4084, 4084, 1022, 
-2866, 2460, 2460, 
-1740, 1740, 1650, 
-1650, 2482, 2482, 
-2508, 2508, 1644, 
-1644, 1842, 1842, 
-2458, 2458, 3276, 
-3276, 1638, 3890, 
-2462, 2462, 3788, 
-3788, 1654, 1654, 
-2994, 2994, 2524, 
-2524, 1772, 1772, 
-1906, 1906, 2490, 
-2490, 3532, 3532, 
-1646, 3506, 2510, 
-2510, 3692, 3692, 
-1846, 1846, 2970, 
-2970, 3292, 3292, 
-1766, 1766, 2930, 
-2930, 2492, 2492, 
-1996, 1996, 1658, 
-1970, 2522, 2522, 
-3308, 3308, 1894, 
-1894, 2874, 2874, 
-3484, 3484, 1742, 
-1742, 3698, 3698, 
-2486, 2486, 3020, 
-3020, 1660, 4018, 
-2526, 2526, 3820, 
-3820, 1910, 1910, 
-3002, 3002, 3548, 
-3548, 1774, 1774, 
-3954, 3954, 2494, 
-2494, 4044, 4044, 
-1662, 3314, 2534, 
-2534, 2924, 2924, 
-1852, 1852, 1946, 
-1946, 3290, 3290, 
-3302, 3302, 2918, 
-2918, 2876, 2876, 
-1948, 1948, 1754, 
-1778, 2546, 2546, 
-2540, 2540, 1900, 
-1900, 1850, 1850, 
-3482, 3482, 3278, 
-3278, 3686, 3686, 
-2870, 2870, 2972, 
-2972, 1756, 3826, 
-2550, 2550, 3052, 
-3052, 1916, 1916, 
-1978, 1978, 3546, 
-3546, 3310, 3310, 
-3942, 3942, 2878, 
-2878, 3996, 3996, 
-1758, 3058, 2556, 
-2556, 2028, 2028, 
-1914, 1914, 3514, 
-3514, 3534, 3534, 
-3694, 3694, 3894, 
-3894, 2974, 2974, 
-3804, 3804, 1782, 
-3570, 2542, 2542, 
-3948, 3948, 1854, 
-1854, 3994, 3994, 
-3294, 3294, 3814, 
-3814, 2934, 2934, 
-3004, 3004, 2012, 
-2012, 1786, 2034, 
-2554, 2554, 3564, 
-3564, 1902, 1902, 
-3898, 3898, 3486, 
-3486, 3790, 3790, 
-3702, 3702, 2998, 
-2998, 3036, 3036, 
-1788, 4082, 2558, 
-2558, 4076, 4076, 
-1918, 1918, 4026, 
-4026, 3550, 3550, 
-3822, 3822, 3958, 
-3958, 3006, 3006, 
-4060, 4060, 1790, 
-3802, 3318, 3318, 
-3046, 3046, 2940, 
-2940, 1980, 1980, 
-2010, 2010, 3322, 
-3322, 3558, 3558, 
-2926, 2926, 3900, 
-3900, 1950, 3034, 
-3324, 3324, 2022, 
-2022, 2938, 2938, 
-3516, 3516, 1998, 
-1998, 3706, 3706, 
-3510, 3510, 3022, 
-3022, 3708, 3708, 
-1974, 4058, 3326, 
-3326, 4070, 4070, 
-2942, 2942, 4028, 
-4028, 2014, 2014, 
-3834, 3834, 3574, 
-3574, 3054, 3054, 
-3964, 3964, 1982, 
-3962, 3518, 3518, 
-4046, 4046, 3710, 
-3710, 4022, 4022, 
-3038, 3038, 3836, 
-3836, 2038, 2038, 
-3066, 3066, 3580, 
-3580, 2030, 3578, 
-3566, 3566, 3950, 
-3950, 3902, 3902, 
-3998, 3998, 3806, 
-3806, 3830, 3830, 
-3062, 3062, 3068, 
-3068, 2044, 2044, 
-2042, 4090, 3582, 
-3582, 4078, 4078, 
-3966, 3966, 4030, 
-4030, 4062, 4062, 
-3838, 3838, 4086, 
-4086, 3070, 3070, 
-4092, 4092, 2046, 
-};
-__ALIGNED(8) const uint16_t perm41[NB_PERM41]={
-128, 212, 212, 
-184, 184, 358, 
-358, 318, 318, 
-92, 92, 242, 
-242, 138, 138, 
-116, 116, 180, 
-180, 102, 102, 
-20, 20, 176, 
-176, 214, 214, 
-312, 312, 76, 
-76, 322, 322, 
-348, 348, 46, 
-46, 368, 368, 
-222, 222, 88, 
-88, 354, 354, 
-62, 62, 162, 
-162, 54, 54, 
-18, 18, 48, 
-48, 2, 256, 
-298, 298, 284, 
-284, 250, 250, 
-282, 282, 122, 
-122, 196, 196, 
-264, 264, 74, 
-74, 194, 194, 
-136, 136, 356, 
-356, 190, 190, 
-374, 374, 238, 
-238, 376, 376, 
-366, 366, 94, 
-94, 370, 370, 
-350, 350, 174, 
-174, 86, 86, 
-226, 226, 344, 
-344, 158, 158, 
-166, 166, 310, 
-310, 316, 316, 
-332, 332, 252, 
-252, 42, 42, 
-112, 112, 292, 
-292, 268, 268, 
-330, 330, 124, 
-124, 324, 324, 
-108, 108, 36, 
-36, 96, 96, 
-4, 16, 288, 
-288, 12, 12, 
-32, 32, 208, 
-208, 296, 296, 
-156, 156, 38, 
-38, 224, 224, 
-216, 216, 72, 
-72, 66, 66, 
-50, 50, 130, 
-130, 340, 340, 
-270, 270, 90, 
-90, 114, 114, 
-52, 52, 258, 
-258, 58, 58, 
-274, 274, 346, 
-346, 286, 286, 
-378, 378, 126, 
-126, 84, 84, 
-98, 98, 132, 
-132, 100, 100, 
-260, 260, 186, 
-186, 118, 118, 
-308, 308, 188, 
-188, 246, 246, 
-26, 26, 192, 
-192, 8, 8, 
-144, 144, 6, 
-272, 218, 218, 
-200, 200, 152, 
-152, 150, 150, 
-22, 22, 304, 
-304, 300, 300, 
-44, 44, 240, 
-240, 10, 160, 
-294, 294, 28, 
-28, 320, 320, 
-220, 220, 328, 
-328, 364, 364, 
-334, 334, 380, 
-380, 254, 254, 
-170, 170, 198, 
-198, 24, 24, 
-64, 64, 290, 
-290, 140, 140, 
-244, 244, 266, 
-266, 202, 202, 
-280, 280, 362, 
-362, 206, 206, 
-168, 168, 70, 
-70, 306, 306, 
-60, 60, 34, 
-34, 336, 336, 
-14, 80, 210, 
-210, 56, 56, 
-146, 146, 134, 
-134, 228, 228, 
-104, 104, 148, 
-148, 262, 262, 
-314, 314, 204, 
-204, 40, 40, 
-352, 352, 302, 
-302, 172, 172, 
-326, 326, 236, 
-236, 248, 248, 
-154, 154, 278, 
-278, 234, 234, 
-120, 120, 68, 
-68, 178, 178, 
-342, 342, 30, 
-82, 338, 338, 
-142, 142, 372, 
-372, 110, 110, 
-164, 164, 182, 
-182, 230, 230, 
-232, 232, 360, 
-360, 78, 276, 
-106, };
-__ALIGNED(8) const uint16_t perm42[NB_PERM42]={
-48, 36, 36, 
-4, 4, 96, 
-96, 26, 26, 
-66, 66, 38, 
-38, 52, 52, 
-132, 132, 30, 
-30, 34, 34, 
-130, 130, 110, 
-110, 60, 60, 
-22, 22, 98, 
-98, 74, 74, 
-56, 56, 54, 
-54, 6, 6, 
-16, 16, 128, 
-128, 62, 62, 
-70, 70, 134, 
-134, 78, 78, 
-24, 24, 18, 
-18, 2, 64, 
-118, 118, 124, 
-124, 140, 140, 
-94, 94, 106, 
-106, 138, 138, 
-46, 46, 116, 
-116, 76, 76, 
-104, 104, 90, 
-90, 10, 10, 
-112, 112, 108, 
-108, 12, 12, 
-32, 32, 82, 
-82, 120, 120, 
-44, 44, 68, 
-68, 86, 86, 
-88, 88, 136, 
-136, 126, 126, 
-14, 14, 80, 
-80, 72, 72, 
-8, 50, 84, 
-84, 40, 40, 
-100, 100, 122, 
-122, 92, 92, 
-58, 58, 102, 
-102, 42, 42, 
-20, 114, 28, 
-};
-__ALIGNED(8) const uint16_t perm43[NB_PERM43]={
-80, 50, 50, 
-2, 160, 22, 
-22, 112, 112, 
-100, 100, 4, 
-240, 72, 72, 
-114, 114, 180, 
-180, 54, 54, 
-162, 162, 102, 
-102, 84, 84, 
-210, 210, 24, 
-24, 192, 192, 
-150, 150, 6, 
-320, 44, 44, 
-224, 224, 200, 
-200, 8, 16, 
-256, 256, 250, 
-250, 10, 96, 
-306, 306, 252, 
-252, 90, 90, 
-66, 66, 258, 
-258, 330, 330, 
-60, 60, 18, 
-18, 336, 336, 
-300, 300, 12, 
-176, 278, 278, 
-362, 362, 110, 
-110, 20, 20, 
-32, 32, 128, 
-128, 356, 356, 
-254, 254, 170, 
-170, 38, 38, 
-368, 368, 350, 
-350, 14, 272, 
-122, 122, 116, 
-116, 260, 260, 
-26, 352, 94, 
-94, 226, 226, 
-280, 280, 58, 
-58, 322, 322, 
-124, 124, 196, 
-196, 310, 310, 
-28, 48, 384, 
-384, 222, 222, 
-120, 120, 36, 
-36, 288, 288, 
-378, 378, 366, 
-366, 270, 270, 
-42, 42, 144, 
-144, 228, 228, 
-360, 360, 30, 
-208, 328, 328, 
-364, 364, 190, 
-190, 70, 70, 
-34, 64, 178, 
-178, 358, 358, 
-334, 334, 220, 
-220, 40, 304, 
-172, 172, 118, 
-118, 340, 340, 
-76, 76, 274, 
-274, 202, 202, 
-88, 88, 370, 
-370, 46, 82, 
-130, 130, 52, 
-242, 152, 152, 
-86, 86, 290, 
-290, 74, 74, 
-194, 194, 230, 
-230, 56, 98, 
-386, 386, 302, 
-302, 92, 92, 
-146, 146, 308, 
-308, 332, 332, 
-140, 140, 68, 
-68, 338, 338, 
-380, 380, 62, 
-354, 174, 174, 
-198, 198, 390, 
-390, 78, 164, 
-182, 182, 134, 
-134, 212, 212, 
-104, 244, 232, 
-232, 136, 136, 
-292, 292, 154, 
-154, 166, 166, 
-262, 262, 106, 
-324, 204, 204, 
-168, 168, 342, 
-342, 156, 156, 
-246, 246, 312, 
-312, 108, 276, 
-282, 282, 138, 
-138, 372, 372, 
-126, 148, 388, 
-388, 382, 382, 
-142, 326, 284, 
-284, 218, 218, 
-344, 344, 236, 
-236, 296, 296, 
-314, 314, 188, 
-188, 374, 374, 
-206, 206, 248, 
-248, 392, 392, 
-158, 214, 184, 
-294, 234, 234, 
-216, 216, 264, 
-264, 186, 376, 
-286, 286, 298, 
-298, 394, 394, 
-238, 346, 316, 
-316, 268, 348, 
-396, 396, 318, 
-};
-__ALIGNED(8) const uint16_t perm44[NB_PERM44]={
-50, 82, 82, 
-134, 134, 78, 
-78, 34, 34, 
-102, 102, 26, 
-26, 90, 90, 
-6, 6, 10, 
-10, 110, 110, 
-86, 86, 94, 
-94, 106, 106, 
-126, 126, 18, 
-18, 30, 30, 
-2, 100, 116, 
-116, 96, 96, 
-16, 16, 120, 
-120, 8, 8, 
-60, 60, 4, 
-20, 80, 80, 
-84, 84, 44, 
-44, 72, 72, 
-24, 24, 40, 
-40, 112, 112, 
-136, 136, 128, 
-128, 68, 68, 
-64, 64, 104, 
-104, 76, 76, 
-124, 124, 108, 
-108, 36, 36, 
-12, 70, 114, 
-114, 46, 46, 
-122, 122, 58, 
-58, 142, 142, 
-138, 138, 38, 
-38, 62, 62, 
-54, 54, 42, 
-42, 22, 22, 
-130, 130, 118, 
-118, 146, 146, 
-98, 98, 66, 
-66, 14, 140, 
-88, 88, 144, 
-144, 48, 48, 
-32, 32, 52, 
-52, 132, 132, 
-28, 92, 56, 
-};
-__ALIGNED(8) const uint16_t perm45[NB_PERM45]={
-80, 8, 8, 
-32, 32, 50, 
-50, 116, 116, 
-74, 74, 134, 
-134, 140, 140, 
-14, 14, 128, 
-128, 44, 44, 
-20, 20, 2, 
-16, 64, 64, 
-22, 22, 82, 
-82, 88, 88, 
-40, 40, 4, 
-96, 72, 72, 
-54, 54, 132, 
-132, 60, 60, 
-6, 112, 58, 
-58, 148, 148, 
-46, 46, 100, 
-100, 10, 48, 
-36, 36, 66, 
-66, 102, 102, 
-90, 90, 120, 
-120, 12, 144, 
-30, 30, 114, 
-114, 138, 138, 
-156, 156, 78, 
-78, 150, 150, 
-126, 126, 108, 
-108, 42, 42, 
-84, 84, 24, 
-24, 18, 98, 
-152, 152, 62, 
-62, 86, 86, 
-104, 104, 26, 
-34, 130, 130, 
-124, 124, 28, 
-146, 110, 110, 
-122, 122, 92, 
-92, 56, 56, 
-68, 68, 38, 
-118, 154, 154, 
-142, 142, 94, 
-94, 136, 136, 
-76, 76, 70, 
-};
-__ALIGNED(8) const uint16_t perm46[NB_PERM46]={
-54, 2, 108, 
-4, 18, 6, 
-72, 8, 126, 
-10, 36, 12, 
-90, 14, 144, 
-16, 60, 20, 
-114, 22, 78, 
-26, 132, 28, 
-42, 30, 96, 
-32, 150, 34, 
-66, 38, 120, 
-40, 84, 44, 
-138, 46, 102, 
-50, 156, 52, 
-110, 58, 74, 
-62, 128, 64, 
-92, 68, 146, 
-70, 116, 76, 
-134, 82, 98, 
-86, 152, 88, 
-122, 94, 140, 
-100, 158, 106, 
-130, 118, 148, 
-124, 154, 142, 
-};
-__ALIGNED(8) const uint16_t perm47[NB_PERM47]={
-144, 36, 36, 
-32, 32, 256, 
-256, 328, 328, 
-300, 300, 122, 
-122, 244, 244, 
-360, 360, 44, 
-44, 224, 224, 
-200, 200, 182, 
-182, 166, 166, 
-294, 294, 74, 
-74, 162, 162, 
-6, 6, 48, 
-48, 128, 128, 
-164, 164, 150, 
-150, 84, 84, 
-114, 114, 52, 
-52, 416, 416, 
-190, 190, 358, 
-358, 412, 412, 
-414, 414, 46, 
-46, 368, 368, 
-236, 236, 168, 
-168, 54, 54, 
-2, 288, 26, 
-26, 208, 208, 
-374, 374, 284, 
-284, 250, 250, 
-408, 408, 126, 
-126, 20, 20, 
-160, 160, 420, 
-420, 94, 94, 
-322, 322, 426, 
-426, 142, 142, 
-404, 404, 222, 
-222, 56, 56, 
-146, 146, 180, 
-180, 22, 22, 
-304, 304, 410, 
-410, 270, 270, 
-10, 10, 336, 
-336, 108, 108, 
-4, 192, 118, 
-118, 340, 340, 
-396, 396, 30, 
-30, 112, 112, 
-292, 292, 314, 
-314, 234, 234, 
-24, 24, 64, 
-64, 338, 338, 
-252, 252, 40, 
-40, 320, 320, 
-282, 282, 106, 
-106, 418, 418, 
-334, 334, 348, 
-348, 76, 76, 
-306, 306, 42, 
-42, 80, 80, 
-210, 210, 134, 
-134, 212, 212, 
-278, 278, 202, 
-202, 326, 326, 
-156, 156, 132, 
-132, 68, 68, 
-242, 242, 216, 
-216, 8, 96, 
-82, 82, 354, 
-354, 124, 124, 
-388, 388, 350, 
-350, 220, 220, 
-296, 296, 218, 
-218, 152, 152, 
-228, 228, 104, 
-104, 274, 274, 
-298, 298, 362, 
-362, 188, 188, 
-214, 214, 422, 
-422, 238, 238, 
-312, 312, 90, 
-90, 34, 34, 
-400, 400, 318, 
-318, 138, 138, 
-116, 116, 196, 
-196, 406, 406, 
-366, 366, 92, 
-92, 178, 178, 
-390, 390, 110, 
-110, 148, 148, 
-324, 324, 12, 
-240, 72, 72, 
-18, 18, 16, 
-16, 384, 384, 
-62, 62, 194, 
-194, 262, 262, 
-376, 376, 428, 
-428, 286, 286, 
-394, 394, 398, 
-398, 174, 174, 
-102, 102, 130, 
-130, 308, 308, 
-186, 186, 70, 
-70, 386, 386, 
-206, 206, 230, 
-230, 248, 248, 
-264, 264, 136, 
-136, 356, 356, 
-268, 268, 424, 
-424, 382, 382, 
-302, 302, 266, 
-266, 280, 280, 
-346, 346, 316, 
-316, 378, 378, 
-14, 352, 364, 
-364, 332, 332, 
-204, 204, 86, 
-86, 258, 258, 
-88, 88, 402, 
-402, 78, 78, 
-66, 66, 98, 
-98, 226, 226, 
-344, 344, 172, 
-172, 342, 342, 
-28, 176, 246, 
-246, 120, 120, 
-100, 100, 370, 
-370, 380, 380, 
-158, 158, 276, 
-276, 58, 58, 
-290, 290, 170, 
-170, 198, 198, 
-38, 272, 154, 
-154, 372, 372, 
-140, 140, 260, 
-260, 232, 232, 
-392, 392, 254, 
-254, 184, 184, 
-310, 310, 330, 
-330, 60, 60, 
-50, };
-__ALIGNED(8) const uint16_t perm48[NB_PERM48]={
-90, 134, 134, 
-116, 116, 66, 
-66, 142, 142, 
-176, 176, 88, 
-88, 44, 44, 
-62, 62, 112, 
-112, 36, 36, 
-2, 30, 140, 
-140, 86, 86, 
-104, 104, 84, 
-84, 14, 14, 
-100, 100, 54, 
-54, 132, 132, 
-26, 26, 110, 
-110, 96, 96, 
-24, 24, 20, 
-20, 70, 70, 
-172, 172, 58, 
-58, 162, 162, 
-138, 138, 146, 
-146, 98, 98, 
-114, 114, 126, 
-126, 136, 136, 
-56, 56, 72, 
-72, 4, 120, 
-16, 16, 40, 
-40, 32, 32, 
-80, 80, 64, 
-64, 52, 52, 
-42, 42, 122, 
-122, 106, 106, 
-174, 174, 148, 
-148, 38, 38, 
-92, 92, 74, 
-74, 94, 94, 
-164, 164, 78, 
-78, 124, 124, 
-46, 46, 152, 
-152, 68, 68, 
-82, 82, 154, 
-154, 158, 158, 
-108, 108, 6, 
-60, 22, 22, 
-160, 160, 48, 
-48, 12, 12, 
-10, 10, 150, 
-150, 128, 128, 
-76, 76, 34, 
-34, 170, 170, 
-118, 118, 156, 
-156, 18, 18, 
-130, 130, 166, 
-166, 168, 168, 
-28, 28, 50, 
-50, 102, 102, 
-144, 144, 8, 
-};
-__ALIGNED(8) const uint16_t perm49[NB_PERM49]={
-64, 164, 164, 
-124, 124, 138, 
-138, 58, 58, 
-148, 148, 140, 
-140, 122, 122, 
-74, 74, 70, 
-70, 180, 180, 
-46, 46, 178, 
-178, 158, 158, 
-108, 108, 40, 
-40, 162, 162, 
-60, 60, 36, 
-36, 34, 34, 
-146, 146, 76, 
-76, 134, 134, 
-106, 106, 152, 
-152, 92, 92, 
-118, 118, 184, 
-184, 174, 174, 
-30, 30, 18, 
-18, 48, 48, 
-4, 4, 128, 
-128, 90, 90, 
-54, 54, 20, 
-20, 112, 112, 
-168, 168, 14, 
-14, 96, 96, 
-8, 8, 80, 
-80, 86, 86, 
-102, 102, 24, 
-24, 2, 16, 
-160, 160, 172, 
-172, 142, 142, 
-186, 186, 62, 
-62, 100, 100, 
-136, 136, 170, 
-170, 78, 78, 
-22, 22, 176, 
-176, 94, 94, 
-182, 182, 110, 
-110, 104, 104, 
-88, 88, 166, 
-166, 188, 188, 
-126, 126, 26, 
-26, 66, 66, 
-52, 52, 132, 
-132, 42, 42, 
-50, 50, 68, 
-68, 116, 116, 
-120, 120, 10, 
-10, 144, 144, 
-12, 12, 32, 
-32, 82, 82, 
-150, 150, 28, 
-28, 130, 130, 
-154, 154, 156, 
-156, 44, 44, 
-114, 114, 56, 
-56, 84, 84, 
-38, 38, 98, 
-98, 72, 72, 
-6, };
-__ALIGNED(8) const uint16_t perm50[NB_PERM50]={
-50, 62, 62, 
-172, 172, 118, 
-118, 194, 194, 
-98, 98, 74, 
-74, 92, 92, 
-114, 114, 94, 
-94, 164, 164, 
-108, 108, 134, 
-134, 166, 166, 
-158, 158, 196, 
-196, 148, 148, 
-136, 136, 26, 
-26, 80, 80, 
-4, 4, 100, 
-100, 124, 124, 
-106, 106, 84, 
-84, 104, 104, 
-34, 34, 90, 
-90, 64, 64, 
-32, 32, 40, 
-40, 2, 150, 
-186, 186, 88, 
-88, 14, 14, 
-160, 160, 8, 
-8, 10, 10, 
-60, 60, 122, 
-122, 56, 56, 
-22, 22, 170, 
-170, 68, 68, 
-132, 132, 116, 
-116, 144, 144, 
-36, 36, 140, 
-140, 126, 126, 
-156, 156, 146, 
-146, 86, 86, 
-154, 154, 96, 
-96, 24, 24, 
-30, 30, 180, 
-180, 128, 128, 
-16, 16, 20, 
-20, 120, 120, 
-6, 110, 184, 
-184, 38, 38, 
-190, 190, 188, 
-188, 138, 138, 
-76, 76, 142, 
-142, 176, 176, 
-28, 28, 130, 
-130, 66, 66, 
-82, 82, 54, 
-54, 162, 162, 
-58, 58, 72, 
-72, 42, 42, 
-52, 52, 112, 
-112, 44, 44, 
-102, 102, 174, 
-174, 168, 168, 
-18, 18, 70, 
-70, 182, 182, 
-178, 178, 78, 
-78, 192, 192, 
-48, 48, 12, 
-152, 46, };
-__ALIGNED(8) const uint16_t perm51[NB_PERM51]={
-72, 10, 10, 
-168, 168, 30, 
-30, 56, 56, 
-74, 74, 82, 
-82, 178, 178, 
-198, 198, 22, 
-22, 152, 152, 
-116, 116, 100, 
-100, 186, 186, 
-38, 38, 88, 
-88, 202, 202, 
-166, 166, 150, 
-150, 44, 44, 
-112, 112, 148, 
-148, 164, 164, 
-78, 78, 34, 
-34, 200, 200, 
-94, 94, 162, 
-162, 6, 6, 
-24, 24, 32, 
-32, 128, 128, 
-84, 84, 58, 
-58, 146, 146, 
-92, 92, 90, 
-90, 18, 18, 
-8, 8, 96, 
-96, 42, 42, 
-40, 40, 160, 
-160, 212, 212, 
-142, 142, 204, 
-204, 46, 46, 
-184, 184, 158, 
-158, 140, 140, 
-132, 132, 36, 
-36, 16, 16, 
-192, 192, 62, 
-62, 98, 98, 
-114, 114, 28, 
-28, 176, 176, 
-126, 126, 12, 
-12, 48, 48, 
-64, 64, 170, 
-170, 102, 102, 
-66, 66, 50, 
-50, 136, 136, 
-180, 180, 14, 
-14, 120, 120, 
-52, 52, 208, 
-208, 190, 190, 
-182, 182, 86, 
-86, 130, 130, 
-156, 156, 68, 
-68, 122, 122, 
-124, 124, 196, 
-196, 206, 206, 
-118, 118, 172, 
-172, 174, 174, 
-54, 54, 2, 
-144, 20, 20, 
-80, 80, 106, 
-106, 210, 210, 
-70, 70, 194, 
-194, 134, 134, 
-108, 108, 4, 
-104, 138, 138, 
-60, 60, 26, 
-154, 188, 188, 
-110, 110, 76, 
-};
-__ALIGNED(8) const uint16_t perm52[NB_PERM52]={
-240, 8, 8, 
-160, 160, 132, 
-132, 20, 20, 
-176, 176, 228, 
-228, 70, 70, 
-402, 402, 380, 
-380, 188, 188, 
-166, 166, 452, 
-452, 206, 206, 
-278, 278, 296, 
-296, 232, 232, 
-150, 150, 356, 
-356, 234, 234, 
-390, 390, 364, 
-364, 92, 92, 
-194, 194, 262, 
-262, 424, 424, 
-94, 94, 434, 
-434, 270, 270, 
-360, 360, 12, 
-12, 16, 16, 
-96, 96, 50, 
-50, 304, 304, 
-90, 90, 354, 
-354, 394, 394, 
-444, 444, 46, 
-46, 448, 448, 
-126, 126, 324, 
-324, 42, 42, 
-368, 368, 172, 
-172, 148, 148, 
-116, 116, 226, 
-226, 454, 454, 
-446, 446, 286, 
-286, 456, 456, 
-62, 62, 242, 
-242, 248, 248, 
-168, 168, 68, 
-68, 162, 162, 
-372, 372, 28, 
-28, 112, 112, 
-146, 146, 276, 
-276, 56, 56, 
-224, 224, 214, 
-214, 438, 438, 
-350, 350, 314, 
-314, 266, 266, 
-280, 280, 136, 
-136, 100, 100, 
-130, 130, 404, 
-404, 220, 220, 
-134, 134, 260, 
-260, 184, 184, 
-86, 86, 274, 
-274, 440, 440, 
-190, 190, 406, 
-406, 460, 460, 
-142, 142, 420, 
-420, 14, 14, 
-256, 256, 104, 
-104, 210, 210, 
-358, 358, 474, 
-474, 398, 398, 
-300, 300, 10, 
-10, 400, 400, 
-140, 140, 180, 
-180, 6, 6, 
-320, 320, 186, 
-186, 326, 326, 
-282, 282, 376, 
-376, 108, 108, 
-66, 66, 322, 
-322, 426, 426, 
-334, 334, 442, 
-442, 430, 430, 
-414, 414, 396, 
-396, 60, 60, 
-2, 80, 178, 
-178, 468, 468, 
-78, 78, 338, 
-338, 298, 298, 
-472, 472, 158, 
-158, 292, 292, 
-152, 152, 196, 
-196, 102, 102, 
-370, 370, 412, 
-412, 156, 156, 
-52, 52, 144, 
-144, 36, 36, 
-48, 48, 64, 
-64, 82, 82, 
-418, 418, 476, 
-476, 238, 238, 
-470, 470, 318, 
-318, 346, 346, 
-458, 458, 302, 
-302, 250, 250, 
-408, 408, 76, 
-76, 98, 98, 
-290, 290, 312, 
-312, 26, 26, 
-272, 272, 200, 
-200, 182, 182, 
-246, 246, 328, 
-328, 122, 122, 
-244, 244, 88, 
-88, 114, 114, 
-386, 386, 284, 
-284, 216, 216, 
-54, 54, 384, 
-384, 44, 44, 
-208, 208, 118, 
-118, 466, 466, 
-462, 462, 382, 
-382, 428, 428, 
-174, 174, 388, 
-388, 124, 124, 
-84, 84, 34, 
-34, 432, 432, 
-30, 30, 352, 
-352, 154, 154, 
-436, 436, 110, 
-110, 306, 306, 
-330, 330, 362, 
-362, 252, 252, 
-24, 24, 32, 
-32, 192, 192, 
-22, 22, 416, 
-416, 236, 236, 
-230, 230, 310, 
-310, 410, 410, 
-316, 316, 106, 
-106, 450, 450, 
-366, 366, 332, 
-332, 202, 202, 
-422, 422, 254, 
-254, 264, 264, 
-40, 40, 128, 
-128, 164, 164, 
-212, 212, 198, 
-198, 342, 342, 
-378, 378, 348, 
-348, 74, 74, 
-258, 258, 344, 
-344, 218, 218, 
-294, 294, 392, 
-392, 204, 204, 
-38, 38, 288, 
-288, 72, 72, 
-18, 18, 336, 
-336, 58, 58, 
-464, 464, 222, 
-222, 374, 374, 
-268, 268, 120, 
-120, 4, 340, 
-138, 308, 170, 
-};
-__ALIGNED(8) const uint16_t perm53[NB_PERM53]={
-80, 132, 132, 
-40, 40, 178, 
-178, 234, 234, 
-78, 78, 52, 
-52, 210, 210, 
-14, 14, 112, 
-112, 214, 214, 
-174, 174, 74, 
-74, 116, 116, 
-150, 150, 10, 
-10, 176, 176, 
-154, 154, 170, 
-170, 138, 138, 
-56, 56, 146, 
-146, 152, 152, 
-90, 90, 6, 
-6, 16, 16, 
-192, 192, 44, 
-44, 114, 114, 
-70, 70, 180, 
-180, 12, 12, 
-32, 32, 82, 
-82, 212, 212, 
-94, 94, 166, 
-166, 202, 202, 
-220, 220, 190, 
-190, 188, 188, 
-108, 108, 54, 
-54, 66, 66, 
-20, 20, 128, 
-128, 104, 104, 
-118, 118, 230, 
-230, 142, 142, 
-216, 216, 30, 
-30, 2, 160, 
-186, 186, 28, 
-28, 224, 224, 
-126, 126, 24, 
-24, 64, 64, 
-164, 164, 122, 
-122, 88, 88, 
-228, 228, 62, 
-62, 84, 84, 
-68, 68, 100, 
-100, 182, 182, 
-92, 92, 86, 
-86, 148, 148, 
-232, 232, 222, 
-222, 46, 46, 
-194, 194, 124, 
-124, 168, 168, 
-58, 58, 226, 
-226, 206, 206, 
-156, 156, 26, 
-26, 144, 144, 
-72, 72, 36, 
-36, 18, 18, 
-48, 48, 50, 
-50, 130, 130, 
-184, 184, 172, 
-172, 218, 218, 
-110, 110, 134, 
-134, 120, 120, 
-8, 8, 96, 
-96, 22, 22, 
-208, 208, 236, 
-236, 158, 158, 
-106, 106, 198, 
-198, 60, 60, 
-4, 162, 42, 
-42, 34, 98, 
-102, 102, 38, 
-196, 204, 204, 
-76, 200, 140, 
-140, 136, };
-__ALIGNED(8) const uint16_t perm54[NB_PERM54]={
-50, 2, 100, 
-4, 150, 6, 
-200, 8, 60, 
-12, 110, 14, 
-160, 16, 210, 
-18, 70, 22, 
-120, 24, 170, 
-26, 220, 28, 
-80, 32, 130, 
-34, 180, 36, 
-230, 38, 90, 
-42, 140, 44, 
-190, 46, 240, 
-48, 102, 54, 
-152, 56, 202, 
-58, 112, 64, 
-162, 66, 212, 
-68, 122, 74, 
-172, 76, 222, 
-78, 132, 84, 
-182, 86, 232, 
-88, 142, 94, 
-192, 96, 242, 
-98, 154, 106, 
-204, 108, 164, 
-116, 214, 118, 
-174, 126, 224, 
-128, 184, 136, 
-234, 138, 194, 
-146, 244, 148, 
-206, 158, 216, 
-168, 226, 178, 
-236, 188, 246, 
-198, };
-__ALIGNED(8) const uint16_t perm55[NB_PERM55]={
-128, 2, 256, 
-4, 384, 6, 
-32, 8, 160, 
-10, 288, 12, 
-416, 14, 64, 
-16, 192, 18, 
-320, 20, 448, 
-22, 96, 24, 
-224, 26, 352, 
-28, 480, 30, 
-136, 34, 264, 
-36, 392, 38, 
-168, 42, 296, 
-44, 424, 46, 
-72, 48, 200, 
-50, 328, 52, 
-456, 54, 104, 
-56, 232, 58, 
-360, 60, 488, 
-62, 144, 66, 
-272, 68, 400, 
-70, 176, 74, 
-304, 76, 432, 
-78, 208, 82, 
-336, 84, 464, 
-86, 112, 88, 
-240, 90, 368, 
-92, 496, 94, 
-152, 98, 280, 
-100, 408, 102, 
-184, 106, 312, 
-108, 440, 110, 
-216, 114, 344, 
-116, 472, 118, 
-248, 122, 376, 
-124, 504, 126, 
-258, 132, 386, 
-134, 162, 138, 
-290, 140, 418, 
-142, 194, 146, 
-322, 148, 450, 
-150, 226, 154, 
-354, 156, 482, 
-158, 266, 164, 
-394, 166, 298, 
-172, 426, 174, 
-202, 178, 330, 
-180, 458, 182, 
-234, 186, 362, 
-188, 490, 190, 
-274, 196, 402, 
-198, 306, 204, 
-434, 206, 338, 
-212, 466, 214, 
-242, 218, 370, 
-220, 498, 222, 
-282, 228, 410, 
-230, 314, 236, 
-442, 238, 346, 
-244, 474, 246, 
-378, 252, 506, 
-254, 388, 262, 
-292, 268, 420, 
-270, 324, 276, 
-452, 278, 356, 
-284, 484, 286, 
-396, 294, 428, 
-302, 332, 308, 
-460, 310, 364, 
-316, 492, 318, 
-404, 326, 436, 
-334, 468, 342, 
-372, 348, 500, 
-350, 412, 358, 
-444, 366, 476, 
-374, 508, 382, 
-422, 398, 454, 
-406, 486, 414, 
-462, 438, 494, 
-446, 502, 478, 
-};
-__ALIGNED(8) const uint16_t perm56[NB_PERM56]={
-512, 4, 4, 
-128, 128, 16, 
-16, 32, 32, 
-64, 64, 8, 
-8, 256, 256, 
-2, 640, 20, 
-20, 160, 160, 
-80, 80, 40, 
-40, 320, 320, 
-10, 10, 768, 
-768, 6, 384, 
-18, 18, 544, 
-544, 68, 68, 
-136, 136, 272, 
-272, 34, 34, 
-576, 576, 12, 
-896, 22, 22, 
-672, 672, 84, 
-84, 168, 168, 
-336, 336, 42, 
-42, 832, 832, 
-14, 288, 66, 
-66, 520, 520, 
-260, 260, 130, 
-130, 528, 528, 
-36, 36, 192, 
-192, 24, 800, 
-70, 70, 648, 
-648, 276, 276, 
-162, 162, 592, 
-592, 44, 44, 
-448, 448, 26, 
-416, 82, 82, 
-552, 552, 324, 
-324, 138, 138, 
-784, 784, 38, 
-38, 704, 704, 
-28, 928, 86, 
-86, 680, 680, 
-340, 340, 170, 
-170, 848, 848, 
-46, 46, 960, 
-960, 30, 96, 
-72, 72, 264, 
-264, 258, 258, 
-514, 514, 516, 
-516, 132, 132, 
-144, 144, 48, 
-608, 76, 76, 
-392, 392, 274, 
-274, 546, 546, 
-580, 580, 140, 
-140, 400, 400, 
-50, 224, 88, 
-88, 296, 296, 
-322, 322, 522, 
-522, 772, 772, 
-134, 134, 656, 
-656, 52, 736, 
-92, 92, 424, 
-424, 338, 338, 
-554, 554, 836, 
-836, 142, 142, 
-912, 912, 54, 
-352, 74, 74, 
-776, 776, 262, 
-262, 642, 642, 
-532, 532, 164, 
-164, 208, 208, 
-56, 864, 78, 
-78, 904, 904, 
-278, 278, 674, 
-674, 596, 596, 
-172, 172, 464, 
-464, 58, 480, 
-90, 90, 808, 
-808, 326, 326, 
-650, 650, 788, 
-788, 166, 166, 
-720, 720, 60, 
-992, 94, 94, 
-936, 936, 342, 
-342, 682, 682, 
-852, 852, 174, 
-174, 976, 976, 
-62, 584, 268, 
-268, 386, 386, 
-530, 530, 548, 
-548, 196, 196, 
-152, 152, 304, 
-304, 98, 200, 
-280, 280, 290, 
-290, 578, 578, 
-524, 524, 388, 
-388, 146, 146, 
-560, 560, 100, 
-712, 284, 284, 
-418, 418, 594, 
-594, 556, 556, 
-452, 452, 154, 
-154, 816, 816, 
-102, 328, 266, 
-266, 770, 770, 
-518, 518, 644, 
-644, 148, 148, 
-176, 176, 112, 
-112, 104, 840, 
-270, 270, 898, 
-898, 534, 534, 
-676, 676, 212, 
-212, 184, 184, 
-368, 368, 106, 
-456, 282, 282, 
-802, 802, 582, 
-582, 652, 652, 
-404, 404, 178, 
-178, 624, 624, 
-108, 968, 286, 
-286, 930, 930, 
-598, 598, 684, 
-684, 468, 468, 
-186, 186, 880, 
-880, 110, 616, 
-332, 332, 394, 
-394, 786, 786, 
-550, 550, 708, 
-708, 156, 156, 
-432, 432, 114, 
-232, 344, 344, 
-298, 298, 834, 
-834, 526, 526, 
-900, 900, 150, 
-150, 688, 688, 
-116, 744, 348, 
-348, 426, 426, 
-850, 850, 558, 
-558, 964, 964, 
-158, 158, 944, 
-944, 118, 360, 
-330, 330, 778, 
-778, 774, 774, 
-646, 646, 660, 
-660, 180, 180, 
-240, 240, 120, 
-872, 334, 334, 
-906, 906, 790, 
-790, 678, 678, 
-724, 724, 188, 
-188, 496, 496, 
-122, 488, 346, 
-346, 810, 810, 
-838, 838, 654, 
-654, 916, 916, 
-182, 182, 752, 
-752, 124, 1000, 
-350, 350, 938, 
-938, 854, 854, 
-686, 686, 980, 
-980, 190, 190, 
-1008, 1008, 126, 
-536, 292, 292, 
-194, 664, 308, 
-308, 226, 226, 
-600, 600, 300, 
-300, 450, 450, 
-538, 538, 804, 
-804, 198, 792, 
-294, 294, 706, 
-706, 540, 540, 
-420, 420, 210, 
-210, 568, 568, 
-356, 356, 202, 
-408, 306, 306, 
-610, 610, 588, 
-588, 396, 396, 
-402, 402, 562, 
-562, 612, 612, 
-204, 920, 310, 
-310, 738, 738, 
-604, 604, 428, 
-428, 466, 466, 
-570, 570, 868, 
-868, 206, 696, 
-372, 372, 234, 
-234, 856, 856, 
-302, 302, 962, 
-962, 542, 542, 
-932, 932, 214, 
-312, 354, 354, 
-586, 586, 780, 
-780, 390, 390, 
-658, 658, 564, 
-564, 228, 228, 
-216, 824, 358, 
-358, 714, 714, 
-796, 796, 422, 
-422, 722, 722, 
-572, 572, 484, 
-484, 218, 440, 
-370, 370, 618, 
-618, 844, 844, 
-398, 398, 914, 
-914, 566, 566, 
-740, 740, 220, 
-952, 374, 374, 
-746, 746, 860, 
-860, 430, 430, 
-978, 978, 574, 
-574, 996, 996, 
-222, 728, 316, 
-316, 482, 482, 
-602, 602, 812, 
-812, 454, 454, 
-666, 666, 820, 
-820, 230, 472, 
-314, 314, 866, 
-866, 590, 590, 
-908, 908, 406, 
-406, 690, 690, 
-628, 628, 236, 
-984, 318, 318, 
-994, 994, 606, 
-606, 940, 940, 
-470, 470, 698, 
-698, 884, 884, 
-238, 632, 364, 
-364, 458, 458, 
-794, 794, 806, 
-806, 710, 710, 
-668, 668, 436, 
-436, 242, 248, 
-376, 376, 362, 
-362, 842, 842, 
-782, 782, 902, 
-902, 662, 662, 
-692, 692, 244, 
-760, 380, 380, 
-490, 490, 858, 
-858, 814, 814, 
-966, 966, 670, 
-670, 948, 948, 
-246, 888, 366, 
-366, 970, 970, 
-798, 798, 934, 
-934, 726, 726, 
-700, 700, 500, 
-500, 250, 504, 
-378, 378, 874, 
-874, 846, 846, 
-910, 910, 918, 
-918, 694, 694, 
-756, 756, 252, 
-1016, 382, 382, 
-1002, 1002, 862, 
-862, 942, 942, 
-982, 982, 702, 
-702, 1012, 1012, 
-254, 818, 614, 
-614, 716, 716, 
-412, 412, 434, 
-434, 626, 626, 
-620, 620, 460, 
-460, 410, 946, 
-630, 630, 748, 
-748, 476, 476, 
-442, 442, 882, 
-882, 622, 622, 
-972, 972, 414, 
-754, 636, 636, 
-492, 492, 474, 
-474, 826, 826, 
-870, 870, 718, 
-718, 924, 924, 
-438, 498, 634, 
-634, 876, 876, 
-462, 462, 922, 
-922, 822, 822, 
-742, 742, 732, 
-732, 444, 1010, 
-638, 638, 1004, 
-1004, 478, 478, 
-954, 954, 886, 
-886, 750, 750, 
-988, 988, 446, 
-730, 828, 828, 
-486, 986, 830, 
-830, 998, 998, 
-734, 734, 956, 
-956, 502, 502, 
-762, 762, 892, 
-892, 494, 890, 
-878, 878, 974, 
-974, 926, 926, 
-950, 950, 758, 
-758, 764, 764, 
-508, 508, 506, 
-1018, 894, 894, 
-1006, 1006, 990, 
-990, 958, 958, 
-1014, 1014, 766, 
-766, 1020, 1020, 
-510, };
-__ALIGNED(8) const uint16_t perm57[NB_PERM57]={
-8, 4, 4, 
-2, 10, 12, 
-12, 6, };
-__ALIGNED(8) const uint16_t perm58[NB_PERM58]={
-128, 4, 4, 
-32, 32, 16, 
-16, 8, 8, 
-64, 64, 2, 
-160, 20, 20, 
-40, 40, 80, 
-80, 10, 10, 
-192, 192, 6, 
-96, 18, 18, 
-136, 136, 68, 
-68, 34, 34, 
-144, 144, 12, 
-224, 22, 22, 
-168, 168, 84, 
-84, 42, 42, 
-208, 208, 14, 
-72, 66, 66, 
-130, 130, 132, 
-132, 36, 36, 
-48, 48, 24, 
-200, 70, 70, 
-162, 162, 148, 
-148, 44, 44, 
-112, 112, 26, 
-104, 82, 82, 
-138, 138, 196, 
-196, 38, 38, 
-176, 176, 28, 
-232, 86, 86, 
-170, 170, 212, 
-212, 46, 46, 
-240, 240, 30, 
-152, 76, 76, 
-98, 98, 146, 
-146, 140, 140, 
-100, 100, 50, 
-56, 88, 88, 
-74, 74, 194, 
-194, 134, 134, 
-164, 164, 52, 
-184, 92, 92, 
-106, 106, 210, 
-210, 142, 142, 
-228, 228, 54, 
-216, 78, 78, 
-226, 226, 150, 
-150, 172, 172, 
-116, 116, 58, 
-120, 90, 90, 
-202, 202, 198, 
-198, 166, 166, 
-180, 180, 60, 
-248, 94, 94, 
-234, 234, 214, 
-214, 174, 174, 
-244, 244, 62, 
-178, 156, 156, 
-108, 108, 114, 
-114, 154, 154, 
-204, 204, 102, 
-242, 158, 158, 
-236, 236, 118, 
-118, 186, 186, 
-220, 220, 110, 
-218, 206, 206, 
-230, 230, 182, 
-182, 188, 188, 
-124, 124, 122, 
-250, 222, 222, 
-238, 238, 246, 
-246, 190, 190, 
-252, 252, 126, 
-};
-__ALIGNED(8) const uint16_t perm59[NB_PERM59]={
-384, 4, 4, 
-128, 128, 336, 
-336, 26, 26, 
-448, 448, 172, 
-172, 216, 216, 
-66, 66, 552, 
-552, 92, 92, 
-360, 360, 90, 
-90, 616, 616, 
-230, 230, 482, 
-482, 404, 404, 
-292, 292, 146, 
-146, 408, 408, 
-68, 68, 296, 
-296, 274, 274, 
-714, 714, 630, 
-630, 526, 526, 
-756, 756, 126, 
-126, 592, 592, 
-166, 166, 696, 
-696, 86, 86, 
-488, 488, 276, 
-276, 106, 106, 
-656, 656, 334, 
-334, 754, 754, 
-734, 734, 446, 
-446, 428, 428, 
-356, 356, 314, 
-314, 466, 466, 
-716, 716, 374, 
-374, 506, 506, 
-468, 468, 108, 
-108, 48, 48, 
-8, 8, 256, 
-256, 170, 170, 
-472, 472, 236, 
-236, 354, 354, 
-570, 570, 636, 
-636, 46, 46, 
-736, 736, 190, 
-190, 760, 760, 
-254, 254, 426, 
-426, 612, 612, 
-102, 102, 528, 
-528, 28, 28, 
-192, 192, 2, 
-512, 340, 340, 
-154, 154, 664, 
-664, 238, 238, 
-738, 738, 574, 
-574, 764, 764, 
-382, 382, 762, 
-762, 638, 638, 
-430, 430, 740, 
-740, 318, 318, 
-594, 594, 550, 
-550, 700, 700, 
-214, 214, 674, 
-674, 406, 406, 
-676, 676, 150, 
-150, 536, 536, 
-284, 284, 362, 
-362, 474, 474, 
-620, 620, 358, 
-358, 698, 698, 
-470, 470, 492, 
-492, 52, 52, 
-136, 136, 240, 
-240, 10, 10, 
-640, 640, 174, 
-174, 600, 600, 
-70, 70, 680, 
-680, 278, 278, 
-490, 490, 660, 
-660, 110, 110, 
-432, 432, 12, 
-12, 32, 32, 
-320, 320, 338, 
-338, 410, 410, 
-452, 452, 300, 
-300, 50, 50, 
-392, 392, 260, 
-260, 298, 298, 
-658, 658, 718, 
-718, 758, 758, 
-510, 510, 596, 
-596, 294, 294, 
-530, 530, 412, 
-412, 196, 196, 
-130, 130, 720, 
-720, 30, 30, 
-576, 576, 6, 
-416, 324, 324, 
-114, 114, 560, 
-560, 348, 348, 
-58, 58, 648, 
-648, 78, 78, 
-584, 584, 262, 
-262, 682, 682, 
-662, 662, 494, 
-494, 436, 436, 
-140, 140, 368, 
-368, 346, 346, 
-666, 666, 622, 
-622, 742, 742, 
-702, 702, 598, 
-598, 678, 678, 
-534, 534, 540, 
-540, 60, 60, 
-40, 40, 224, 
-224, 322, 322, 
-722, 722, 414, 
-414, 580, 580, 
-134, 134, 496, 
-496, 180, 180, 
-120, 120, 80, 
-80, 328, 328, 
-242, 242, 394, 
-394, 644, 644, 
-302, 302, 434, 
-434, 396, 396, 
-36, 36, 96, 
-96, 16, 16, 
-160, 160, 184, 
-184, 248, 248, 
-266, 266, 458, 
-458, 460, 460, 
-204, 204, 34, 
-34, 704, 704, 
-342, 342, 538, 
-538, 668, 668, 
-366, 366, 602, 
-602, 454, 454, 
-684, 684, 54, 
-54, 520, 520, 
-244, 244, 138, 
-138, 624, 624, 
-14, 544, 188, 
-188, 376, 376, 
-250, 250, 650, 
-650, 462, 462, 
-588, 588, 38, 
-38, 480, 480, 
-20, 20, 288, 
-288, 18, 672, 
-22, 64, 168, 
-168, 88, 88, 
-232, 232, 226, 
-226, 706, 706, 
-726, 726, 542, 
-542, 444, 444, 
-44, 44, 352, 
-352, 186, 186, 
-632, 632, 270, 
-270, 586, 586, 
-646, 646, 686, 
-686, 438, 438, 
-524, 524, 372, 
-372, 122, 122, 
-464, 464, 332, 
-332, 370, 370, 
-730, 730, 670, 
-670, 750, 750, 
-606, 606, 582, 
-582, 518, 518, 
-500, 500, 308, 
-308, 306, 306, 
-562, 562, 732, 
-732, 62, 62, 
-424, 424, 228, 
-228, 98, 98, 
-400, 400, 164, 
-164, 312, 312, 
-82, 82, 712, 
-712, 246, 246, 
-522, 522, 628, 
-628, 142, 142, 
-752, 752, 350, 
-350, 442, 442, 
-652, 652, 206, 
-206, 418, 418, 
-708, 708, 118, 
-118, 688, 688, 
-182, 182, 504, 
-504, 84, 84, 
-104, 104, 272, 
-272, 330, 330, 
-626, 626, 398, 
-398, 420, 420, 
-100, 100, 144, 
-144, 24, 608, 
-326, 326, 498, 
-498, 564, 564, 
-124, 124, 208, 
-208, 162, 162, 
-568, 568, 252, 
-252, 42, 264, 
-74, 74, 456, 
-456, 76, 76, 
-200, 200, 258, 
-258, 554, 554, 
-476, 476, 364, 
-364, 218, 218, 
-450, 450, 556, 
-556, 220, 220, 
-194, 194, 386, 
-386, 388, 388, 
-132, 132, 112, 
-112, 176, 176, 
-344, 344, 282, 
-282, 618, 618, 
-614, 614, 486, 
-486, 532, 532, 
-156, 156, 56, 
-744, 94, 304, 
-178, 178, 728, 
-728, 286, 286, 
-746, 746, 478, 
-478, 748, 748, 
-222, 222, 578, 
-578, 390, 390, 
-516, 516, 116, 
-152, 280, 280, 
-234, 234, 610, 
-610, 710, 710, 
-502, 502, 692, 
-692, 310, 310, 
-690, 690, 566, 
-566, 508, 508, 
-212, 212, 290, 
-290, 402, 402, 
-548, 548, 316, 
-316, 210, 210, 
-546, 546, 572, 
-572, 380, 380, 
-378, 378, 634, 
-634, 654, 654, 
-590, 590, 422, 
-422, 484, 484, 
-148, 440, 268, 
-268, 202, 202, 
-642, 642, 558, 
-558, 604, 604, 
-198, 198, 514, 
-514, 724, 724, 
-158, };
-__ALIGNED(8) const uint16_t perm60[NB_PERM60]={
-8, 2, 16, 
-4, 24, 6, 
-18, 12, 26, 
-14, 28, 22, 
-};
-__ALIGNED(8) const uint16_t perm61[NB_PERM61]={
-96, 42, 42, 
-48, 48, 80, 
-80, 130, 130, 
-218, 218, 102, 
-102, 74, 74, 
-98, 98, 138, 
-138, 90, 90, 
-10, 10, 224, 
-224, 134, 134, 
-154, 154, 228, 
-228, 70, 70, 
-280, 280, 254, 
-254, 118, 118, 
-242, 242, 142, 
-142, 282, 282, 
-94, 94, 202, 
-202, 220, 220, 
-198, 198, 28, 
-28, 232, 232, 
-262, 262, 246, 
-246, 78, 78, 
-34, 34, 264, 
-264, 86, 86, 
-162, 162, 12, 
-12, 64, 64, 
-248, 248, 174, 
-174, 76, 76, 
-194, 194, 180, 
-180, 20, 20, 
-104, 104, 170, 
-170, 140, 140, 
-186, 186, 52, 
-52, 272, 272, 
-126, 126, 26, 
-26, 136, 136, 
-250, 250, 270, 
-270, 30, 30, 
-72, 72, 2, 
-192, 84, 84, 
-66, 66, 88, 
-88, 258, 258, 
-54, 54, 24, 
-24, 40, 40, 
-208, 208, 252, 
-252, 22, 22, 
-200, 200, 124, 
-124, 274, 274, 
-222, 222, 38, 
-38, 112, 112, 
-210, 210, 92, 
-92, 106, 106, 
-266, 266, 182, 
-182, 116, 116, 
-146, 146, 100, 
-100, 234, 234, 
-14, 14, 160, 
-160, 260, 260, 
-150, 150, 36, 
-36, 16, 16, 
-256, 256, 214, 
-214, 284, 284, 
-190, 190, 244, 
-244, 238, 238, 
-206, 206, 156, 
-156, 68, 68, 
-184, 184, 212, 
-212, 188, 188, 
-148, 148, 196, 
-196, 276, 276, 
-62, 62, 152, 
-152, 132, 132, 
-58, 58, 216, 
-216, 6, 6, 
-32, 32, 168, 
-168, 44, 44, 
-144, 144, 4, 
-128, 122, 122, 
-178, 178, 268, 
-268, 278, 278, 
-158, 158, 164, 
-164, 108, 108, 
-18, 18, 8, 
-240, 46, 176, 
-172, 172, 236, 
-236, 110, 110, 
-114, 114, 50, 
-120, 82, 82, 
-226, 226, 230, 
-230, 166, 166, 
-204, 204, 60, 
-60, 56, };
-__ALIGNED(8) const uint16_t perm62[NB_PERM62]={
-200, 62, 62, 
-760, 760, 188, 
-188, 552, 552, 
-76, 76, 470, 
-470, 744, 744, 
-88, 88, 170, 
-170, 252, 252, 
-572, 572, 576, 
-576, 36, 36, 
-410, 410, 374, 
-374, 714, 714, 
-278, 278, 732, 
-732, 578, 578, 
-236, 236, 472, 
-472, 194, 194, 
-212, 212, 512, 
-512, 16, 16, 
-100, 100, 430, 
-430, 684, 684, 
-468, 468, 544, 
-544, 26, 26, 
-350, 350, 754, 
-754, 338, 338, 
-304, 304, 142, 
-142, 690, 690, 
-318, 318, 792, 
-792, 198, 198, 
-612, 612, 446, 
-446, 784, 784, 
-148, 148, 540, 
-540, 566, 566, 
-726, 726, 728, 
-728, 178, 178, 
-302, 302, 692, 
-692, 518, 518, 
-616, 616, 96, 
-96, 30, 30, 
-750, 750, 688, 
-688, 118, 118, 
-730, 730, 378, 
-378, 364, 364, 
-464, 464, 144, 
-144, 140, 140, 
-490, 490, 256, 
-256, 32, 32, 
-10, 10, 250, 
-250, 372, 372, 
-514, 514, 216, 
-216, 162, 162, 
-202, 202, 262, 
-262, 632, 632, 
-196, 196, 412, 
-412, 574, 574, 
-776, 776, 98, 
-98, 230, 230, 
-622, 622, 696, 
-696, 168, 168, 
-52, 52, 510, 
-510, 756, 756, 
-538, 538, 366, 
-366, 664, 664, 
-158, 158, 790, 
-790, 748, 748, 
-488, 488, 56, 
-56, 160, 160, 
-2, 400, 124, 
-124, 580, 580, 
-436, 436, 534, 
-534, 716, 716, 
-478, 478, 794, 
-794, 398, 398, 
-674, 674, 218, 
-218, 362, 362, 
-264, 264, 82, 
-82, 320, 320, 
-4, 600, 186, 
-186, 352, 352, 
-14, 14, 650, 
-650, 258, 258, 
-232, 232, 72, 
-72, 70, 70, 
-620, 620, 496, 
-496, 106, 106, 
-280, 280, 182, 
-182, 702, 702, 
-768, 768, 48, 
-48, 110, 110, 
-680, 680, 68, 
-68, 420, 420, 
-434, 434, 334, 
-334, 654, 654, 
-658, 658, 308, 
-308, 542, 542, 
-766, 766, 788, 
-788, 548, 548, 
-426, 426, 284, 
-284, 582, 582, 
-636, 636, 596, 
-596, 536, 536, 
-166, 166, 602, 
-602, 386, 386, 
-224, 224, 22, 
-22, 700, 700, 
-568, 568, 176, 
-176, 102, 102, 
-630, 630, 746, 
-746, 288, 288, 
-42, 42, 260, 
-260, 432, 432, 
-134, 134, 640, 
-640, 8, 8, 
-50, 50, 310, 
-310, 742, 742, 
-638, 638, 796, 
-796, 598, 598, 
-736, 736, 38, 
-38, 610, 610, 
-246, 246, 722, 
-722, 328, 328, 
-54, 54, 710, 
-710, 628, 628, 
-546, 546, 226, 
-226, 222, 222, 
-762, 762, 388, 
-388, 424, 424, 
-84, 84, 520, 
-520, 66, 66, 
-220, 220, 562, 
-562, 326, 326, 
-604, 604, 586, 
-586, 286, 286, 
-782, 782, 698, 
-698, 368, 368, 
-114, 114, 330, 
-330, 254, 254, 
-772, 772, 448, 
-448, 44, 44, 
-460, 460, 494, 
-494, 656, 656, 
-108, 108, 480, 
-480, 6, 450, 
-244, 244, 522, 
-522, 266, 266, 
-282, 282, 382, 
-382, 764, 764, 
-588, 588, 486, 
-486, 606, 606, 
-786, 786, 348, 
-348, 554, 554, 
-276, 276, 532, 
-532, 516, 516, 
-416, 416, 34, 
-34, 210, 210, 
-312, 312, 192, 
-192, 12, 300, 
-492, 492, 456, 
-456, 94, 94, 
-770, 770, 248, 
-248, 172, 172, 
-452, 452, 444, 
-444, 584, 584, 
-86, 86, 720, 
-720, 128, 128, 
-40, 40, 60, 
-60, 560, 560, 
-126, 126, 780, 
-780, 498, 498, 
-306, 306, 342, 
-342, 704, 704, 
-28, 28, 550, 
-550, 626, 626, 
-346, 346, 354, 
-354, 214, 214, 
-712, 712, 78, 
-78, 670, 670, 
-758, 758, 738, 
-738, 238, 238, 
-672, 672, 18, 
-500, 506, 506, 
-356, 356, 414, 
-414, 774, 774, 
-648, 648, 58, 
-58, 360, 360, 
-64, 64, 20, 
-150, 740, 740, 
-438, 438, 734, 
-734, 778, 778, 
-298, 298, 292, 
-292, 442, 442, 
-384, 384, 24, 
-660, 508, 508, 
-556, 556, 476, 
-476, 594, 594, 
-336, 336, 104, 
-104, 80, 80, 
-120, 120, 180, 
-180, 502, 502, 
-706, 706, 228, 
-228, 422, 422, 
-634, 634, 396, 
-396, 474, 474, 
-394, 394, 274, 
-274, 332, 332, 
-454, 454, 644, 
-644, 408, 408, 
-174, 174, 652, 
-652, 458, 458, 
-294, 294, 642, 
-642, 208, 208, 
-112, 112, 130, 
-130, 240, 240, 
-122, 122, 380, 
-380, 564, 564, 
-526, 526, 666, 
-666, 358, 358, 
-614, 614, 646, 
-646, 608, 608, 
-46, 270, 682, 
-682, 268, 268, 
-482, 482, 206, 
-206, 662, 662, 
-708, 708, 428, 
-428, 484, 484, 
-406, 406, 724, 
-724, 528, 528, 
-116, 116, 530, 
-530, 316, 316, 
-592, 592, 136, 
-136, 90, 90, 
-370, 370, 314, 
-314, 392, 392, 
-74, 570, 376, 
-376, 164, 164, 
-402, 402, 324, 
-324, 404, 404, 
-524, 524, 466, 
-466, 344, 344, 
-154, 154, 390, 
-390, 624, 624, 
-146, 146, 340, 
-340, 504, 504, 
-156, 156, 590, 
-590, 686, 686, 
-668, 668, 558, 
-558, 676, 676, 
-418, 418, 234, 
-234, 272, 272, 
-132, 132, 440, 
-440, 184, 184, 
-152, 152, 190, 
-190, 752, 752, 
-138, 138, 290, 
-290, 242, 242, 
-322, 322, 204, 
-204, 462, 462, 
-694, 694, 718, 
-718, 678, 678, 
-618, 618, 296, 
-296, 92, };
-__ALIGNED(8) const uint16_t perm63[NB_PERM63]={
-24, 4, 4, 
-8, 8, 16, 
-16, 10, 10, 
-40, 40, 14, 
-14, 26, 26, 
-28, 28, 12, 
-12, 2, 32, 
-20, 20, 18, 
-18, 34, 34, 
-44, 44, 22, 
-22, 42, 42, 
-38, 38, 30, 
-30, 36, 36, 
+};
+__ALIGNED(8) const uint16_t perm3[NB_PERM3]={
+};
+__ALIGNED(8) const uint16_t perm4[NB_PERM4]={
+6, 8, 8, 
+4, 4, 2, 
+};
+__ALIGNED(8) const uint16_t perm5[NB_PERM5]={
+8, 4, 4, 
+2, 10, 12, 
+12, 6, };
+__ALIGNED(8) const uint16_t perm6[NB_PERM6]={
+8, 2, 16, 
+4, 24, 6, 
+18, 12, 26, 
+14, 28, 22, 
+};
+__ALIGNED(8) const uint16_t perm7[NB_PERM7]={
+};
+__ALIGNED(8) const uint16_t perm8[NB_PERM8]={
+};
+__ALIGNED(8) const uint16_t perm9[NB_PERM9]={
+6, 2, 12, 
+4, 14, 10, 
+};
+__ALIGNED(8) const uint16_t perm10[NB_PERM10]={
+10, 14, 14, 
+16, 16, 8, 
+8, 4, 4, 
+2, 12, 6, 
+};
+__ALIGNED(8) const uint16_t perm11[NB_PERM11]={
+8, 10, 10, 
+18, 18, 6, 
+6, 2, 16, 
+20, 20, 14, 
+14, 12, 12, 
+4, };
+__ALIGNED(8) const uint16_t perm12[NB_PERM12]={
+10, 22, 22, 
+26, 26, 18, 
+18, 6, 6, 
+2, 20, 16, 
+16, 24, 24, 
+8, 8, 12, 
+12, 4, };
+__ALIGNED(8) const uint16_t perm13[NB_PERM13]={
+16, 8, 8, 
+4, 4, 2, 
+18, 24, 24, 
+12, 12, 6, 
+20, 10, 22, 
+26, 26, 28, 
+28, 14, };
+__ALIGNED(8) const uint16_t perm14[NB_PERM14]={
+18, 26, 26, 
+22, 22, 32, 
+32, 16, 16, 
+8, 8, 12, 
+12, 2, 6, 
+24, 24, 4, 
+30, 28, 28, 
+10, 20, 14, 
+};
+__ALIGNED(8) const uint16_t perm15[NB_PERM15]={
+10, 12, 12, 
+22, 22, 34, 
+34, 18, 18, 
+14, 14, 32, 
+32, 8, 8, 
+2, 20, 24, 
+24, 6, 6, 
+30, 30, 36, 
+36, 28, 28, 
+26, 26, 16, 
+16, 4, };
+__ALIGNED(8) const uint16_t perm16[NB_PERM16]={
+16, 36, 36, 
+12, 12, 4, 
+4, 32, 32, 
+26, 26, 24, 
+24, 8, 8, 
+18, 18, 6, 
+6, 2, 34, 
+42, 42, 14, 
+14, 20, 20, 
+22, 22, 38, 
+38, 28, 28, 
+40, 40, 44, 
+44, 30, 30, 
+10, };
+__ALIGNED(8) const uint16_t perm17[NB_PERM17]={
+10, 2, 20, 
+4, 30, 6, 
+40, 8, 22, 
+14, 32, 16, 
+42, 18, 34, 
+26, 44, 28, 
+46, 38, };
+__ALIGNED(8) const uint16_t perm18[NB_PERM18]={
+18, 2, 36, 
+4, 24, 8, 
+42, 10, 30, 
+14, 48, 16, 
+38, 22, 44, 
+28, 50, 34, 
+};
+__ALIGNED(8) const uint16_t perm19[NB_PERM19]={
+30, 44, 44, 
+26, 26, 34, 
+34, 54, 54, 
+48, 48, 8, 
+8, 20, 20, 
+22, 22, 52, 
+52, 18, 18, 
+42, 42, 46, 
+46, 56, 56, 
+28, 28, 14, 
+14, 32, 32, 
+24, 24, 4, 
+4, 10, 10, 
+50, 50, 38, 
+38, 36, 36, 
+6, 6, 40, 
+40, 16, 16, 
+12, 12, 2, 
+};
+__ALIGNED(8) const uint16_t perm20[NB_PERM20]={
+16, 4, 4, 
+32, 32, 8, 
+8, 2, 48, 
+12, 12, 34, 
+34, 24, 24, 
+6, 18, 20, 
+20, 36, 36, 
+40, 40, 10, 
+50, 28, 28, 
+38, 38, 56, 
+56, 14, 52, 
+44, 44, 42, 
+42, 26, 26, 
+22, 54, 60, 
+60, 46, 46, 
+58, 58, 30, 
+};
+__ALIGNED(8) const uint16_t perm21[NB_PERM21]={
+24, 10, 10, 
+56, 56, 30, 
+30, 18, 18, 
+2, 48, 20, 
+20, 26, 26, 
+34, 34, 66, 
+66, 22, 22, 
+50, 50, 44, 
+44, 36, 36, 
+4, 8, 32, 
+32, 42, 42, 
+12, 12, 16, 
+16, 64, 64, 
+62, 62, 38, 
+38, 28, 28, 
+58, 58, 54, 
+54, 6, 40, 
+52, 52, 68, 
+68, 46, 46, 
+60, 60, 14, 
+};
+__ALIGNED(8) const uint16_t perm22[NB_PERM22]={
+16, 50, 50, 
+10, 10, 2, 
+32, 22, 22, 
+20, 20, 4, 
+48, 72, 72, 
+30, 30, 6, 
+64, 44, 44, 
+40, 40, 8, 
+18, 66, 66, 
+60, 60, 12, 
+34, 38, 38, 
+70, 70, 14, 
+36, 54, 54, 
+42, 42, 24, 
+52, 26, 68, 
+76, 76, 62, 
+62, 28, 56, 
+58, 58, 74, 
+74, 46, };
+__ALIGNED(8) const uint16_t perm23[NB_PERM23]={
+30, 22, 22, 
+62, 62, 46, 
+46, 74, 74, 
+38, 38, 34, 
+34, 82, 82, 
+78, 78, 18, 
+18, 2, 60, 
+16, 16, 80, 
+80, 48, 48, 
+24, 24, 12, 
+12, 20, 20, 
+32, 32, 52, 
+52, 84, 84, 
+28, 28, 72, 
+72, 8, 8, 
+40, 40, 64, 
+64, 76, 76, 
+68, 68, 56, 
+56, 36, 36, 
+4, 10, 70, 
+70, 86, 86, 
+58, 58, 66, 
+66, 26, 26, 
+42, 42, 14, 
+14, 50, 50, 
+54, 54, 6, 
+};
+__ALIGNED(8) const uint16_t perm24[NB_PERM24]={
+48, 8, 8, 
+32, 32, 36, 
+36, 6, 6, 
+64, 64, 26, 
+26, 52, 52, 
+24, 24, 4, 
+4, 16, 16, 
+18, 18, 66, 
+66, 74, 74, 
+60, 60, 10, 
+10, 80, 80, 
+44, 44, 38, 
+38, 54, 54, 
+72, 72, 12, 
+12, 2, 50, 
+56, 56, 40, 
+40, 22, 22, 
+82, 82, 92, 
+92, 46, 46, 
+86, 86, 62, 
+62, 58, 58, 
+88, 88, 30, 
+30, 68, 68, 
+42, 42, 70, 
+70, 90, 90, 
+78, 78, 76, 
+76, 28, 28, 
+20, 20, 34, 
+34, 84, 84, 
+14, };
+__ALIGNED(8) const uint16_t perm25[NB_PERM25]={
+50, 74, 74, 
+86, 86, 68, 
+68, 26, 26, 
+62, 62, 56, 
+56, 44, 44, 
+14, 14, 80, 
+80, 8, 8, 
+20, 20, 2, 
+10, 70, 70, 
+76, 76, 46, 
+46, 64, 64, 
+16, 16, 40, 
+40, 4, 60, 
+6, 30, 72, 
+72, 36, 36, 
+42, 42, 54, 
+54, 84, 84, 
+18, 18, 90, 
+90, 78, 78, 
+96, 96, 48, 
+48, 24, 24, 
+12, 52, 34, 
+34, 82, 82, 
+58, 58, 94, 
+94, 88, 88, 
+28, 28, 22, 
+92, 38, };
+__ALIGNED(8) const uint16_t perm26[NB_PERM26]={
+54, 80, 80, 
+40, 40, 20, 
+20, 42, 42, 
+74, 74, 58, 
+58, 98, 98, 
+70, 70, 104, 
+104, 52, 52, 
+26, 26, 66, 
+66, 86, 86, 
+64, 64, 32, 
+32, 48, 48, 
+8, 8, 36, 
+36, 2, 18, 
+78, 78, 76, 
+76, 22, 22, 
+96, 96, 16, 
+16, 24, 24, 
+12, 12, 6, 
+6, 72, 72, 
+4, 90, 82, 
+82, 94, 94, 
+100, 100, 34, 
+34, 102, 102, 
+88, 88, 28, 
+28, 30, 30, 
+84, 84, 10, 
+60, 14, 56, 
+44, 44, 38, 
+92, 46, 62, 
+68, 68, 50, 
+};
+__ALIGNED(8) const uint16_t perm27[NB_PERM27]={
+40, 102, 102, 
+18, 18, 30, 
+30, 12, 12, 
+20, 20, 70, 
+70, 114, 114, 
+38, 38, 62, 
+62, 64, 64, 
+104, 104, 58, 
+58, 94, 94, 
+116, 116, 78, 
+78, 16, 16, 
+100, 100, 88, 
+88, 106, 106, 
+98, 98, 48, 
+48, 4, 4, 
+80, 80, 56, 
+56, 54, 54, 
+14, 14, 60, 
+60, 24, 24, 
+2, 10, 90, 
+90, 36, 36, 
+22, 22, 110, 
+110, 68, 68, 
+74, 74, 46, 
+46, 112, 112, 
+108, 108, 28, 
+28, 82, 82, 
+96, 96, 8, 
+8, 50, 50, 
+44, 44, 72, 
+72, 6, 42, 
+32, 32, 52, 
+52, 84, 84, 
+26, 92, 76, 
+76, 86, 86, 
+66, 66, 34, 
+};
+__ALIGNED(8) const uint16_t perm28[NB_PERM28]={
+16, 2, 32, 
+4, 48, 6, 
+64, 8, 80, 
+10, 96, 12, 
+112, 14, 34, 
+20, 50, 22, 
+66, 24, 82, 
+26, 98, 28, 
+114, 30, 52, 
+38, 68, 40, 
+84, 42, 100, 
+44, 116, 46, 
+70, 56, 86, 
+58, 102, 60, 
+118, 62, 88, 
+74, 104, 76, 
+120, 78, 106, 
+92, 122, 94, 
+124, 110, };
+__ALIGNED(8) const uint16_t perm29[NB_PERM29]={
+48, 36, 36, 
+4, 4, 96, 
+96, 26, 26, 
+66, 66, 38, 
+38, 52, 52, 
+132, 132, 30, 
+30, 34, 34, 
+130, 130, 110, 
+110, 60, 60, 
+22, 22, 98, 
+98, 74, 74, 
+56, 56, 54, 
+54, 6, 6, 
+16, 16, 128, 
+128, 62, 62, 
+70, 70, 134, 
+134, 78, 78, 
+24, 24, 18, 
+18, 2, 64, 
+118, 118, 124, 
+124, 140, 140, 
+94, 94, 106, 
+106, 138, 138, 
+46, 46, 116, 
+116, 76, 76, 
+104, 104, 90, 
+90, 10, 10, 
+112, 112, 108, 
+108, 12, 12, 
+32, 32, 82, 
+82, 120, 120, 
+44, 44, 68, 
+68, 86, 86, 
+88, 88, 136, 
+136, 126, 126, 
+14, 14, 80, 
+80, 72, 72, 
+8, 50, 84, 
+84, 40, 40, 
+100, 100, 122, 
+122, 92, 92, 
+58, 58, 102, 
+102, 42, 42, 
+20, 114, 28, 
+};
+__ALIGNED(8) const uint16_t perm30[NB_PERM30]={
+50, 82, 82, 
+134, 134, 78, 
+78, 34, 34, 
+102, 102, 26, 
+26, 90, 90, 
+6, 6, 10, 
+10, 110, 110, 
+86, 86, 94, 
+94, 106, 106, 
+126, 126, 18, 
+18, 30, 30, 
+2, 100, 116, 
+116, 96, 96, 
+16, 16, 120, 
+120, 8, 8, 
+60, 60, 4, 
+20, 80, 80, 
+84, 84, 44, 
+44, 72, 72, 
+24, 24, 40, 
+40, 112, 112, 
+136, 136, 128, 
+128, 68, 68, 
+64, 64, 104, 
+104, 76, 76, 
+124, 124, 108, 
+108, 36, 36, 
+12, 70, 114, 
+114, 46, 46, 
+122, 122, 58, 
+58, 142, 142, 
+138, 138, 38, 
+38, 62, 62, 
+54, 54, 42, 
+42, 22, 22, 
+130, 130, 118, 
+118, 146, 146, 
+98, 98, 66, 
+66, 14, 140, 
+88, 88, 144, 
+144, 48, 48, 
+32, 32, 52, 
+52, 132, 132, 
+28, 92, 56, 
+};
+__ALIGNED(8) const uint16_t perm31[NB_PERM31]={
+80, 8, 8, 
+32, 32, 50, 
+50, 116, 116, 
+74, 74, 134, 
+134, 140, 140, 
+14, 14, 128, 
+128, 44, 44, 
+20, 20, 2, 
+16, 64, 64, 
+22, 22, 82, 
+82, 88, 88, 
+40, 40, 4, 
+96, 72, 72, 
+54, 54, 132, 
+132, 60, 60, 
+6, 112, 58, 
+58, 148, 148, 
+46, 46, 100, 
+100, 10, 48, 
+36, 36, 66, 
+66, 102, 102, 
+90, 90, 120, 
+120, 12, 144, 
+30, 30, 114, 
+114, 138, 138, 
+156, 156, 78, 
+78, 150, 150, 
+126, 126, 108, 
+108, 42, 42, 
+84, 84, 24, 
+24, 18, 98, 
+152, 152, 62, 
+62, 86, 86, 
+104, 104, 26, 
+34, 130, 130, 
+124, 124, 28, 
+146, 110, 110, 
+122, 122, 92, 
+92, 56, 56, 
+68, 68, 38, 
+118, 154, 154, 
+142, 142, 94, 
+94, 136, 136, 
+76, 76, 70, 
+};
+__ALIGNED(8) const uint16_t perm32[NB_PERM32]={
+54, 2, 108, 
+4, 18, 6, 
+72, 8, 126, 
+10, 36, 12, 
+90, 14, 144, 
+16, 60, 20, 
+114, 22, 78, 
+26, 132, 28, 
+42, 30, 96, 
+32, 150, 34, 
+66, 38, 120, 
+40, 84, 44, 
+138, 46, 102, 
+50, 156, 52, 
+110, 58, 74, 
+62, 128, 64, 
+92, 68, 146, 
+70, 116, 76, 
+134, 82, 98, 
+86, 152, 88, 
+122, 94, 140, 
+100, 158, 106, 
+130, 118, 148, 
+124, 154, 142, 
+};
+__ALIGNED(8) const uint16_t perm33[NB_PERM33]={
+90, 134, 134, 
+116, 116, 66, 
+66, 142, 142, 
+176, 176, 88, 
+88, 44, 44, 
+62, 62, 112, 
+112, 36, 36, 
+2, 30, 140, 
+140, 86, 86, 
+104, 104, 84, 
+84, 14, 14, 
+100, 100, 54, 
+54, 132, 132, 
+26, 26, 110, 
+110, 96, 96, 
+24, 24, 20, 
+20, 70, 70, 
+172, 172, 58, 
+58, 162, 162, 
+138, 138, 146, 
+146, 98, 98, 
+114, 114, 126, 
+126, 136, 136, 
+56, 56, 72, 
+72, 4, 120, 
+16, 16, 40, 
+40, 32, 32, 
+80, 80, 64, 
+64, 52, 52, 
+42, 42, 122, 
+122, 106, 106, 
+174, 174, 148, 
+148, 38, 38, 
+92, 92, 74, 
+74, 94, 94, 
+164, 164, 78, 
+78, 124, 124, 
+46, 46, 152, 
+152, 68, 68, 
+82, 82, 154, 
+154, 158, 158, 
+108, 108, 6, 
+60, 22, 22, 
+160, 160, 48, 
+48, 12, 12, 
+10, 10, 150, 
+150, 128, 128, 
+76, 76, 34, 
+34, 170, 170, 
+118, 118, 156, 
+156, 18, 18, 
+130, 130, 166, 
+166, 168, 168, 
+28, 28, 50, 
+50, 102, 102, 
+144, 144, 8, 
+};
+__ALIGNED(8) const uint16_t perm34[NB_PERM34]={
+64, 164, 164, 
+124, 124, 138, 
+138, 58, 58, 
+148, 148, 140, 
+140, 122, 122, 
+74, 74, 70, 
+70, 180, 180, 
+46, 46, 178, 
+178, 158, 158, 
+108, 108, 40, 
+40, 162, 162, 
+60, 60, 36, 
+36, 34, 34, 
+146, 146, 76, 
+76, 134, 134, 
+106, 106, 152, 
+152, 92, 92, 
+118, 118, 184, 
+184, 174, 174, 
+30, 30, 18, 
+18, 48, 48, 
+4, 4, 128, 
+128, 90, 90, 
+54, 54, 20, 
+20, 112, 112, 
+168, 168, 14, 
+14, 96, 96, 
+8, 8, 80, 
+80, 86, 86, 
+102, 102, 24, 
+24, 2, 16, 
+160, 160, 172, 
+172, 142, 142, 
+186, 186, 62, 
+62, 100, 100, 
+136, 136, 170, 
+170, 78, 78, 
+22, 22, 176, 
+176, 94, 94, 
+182, 182, 110, 
+110, 104, 104, 
+88, 88, 166, 
+166, 188, 188, 
+126, 126, 26, 
+26, 66, 66, 
+52, 52, 132, 
+132, 42, 42, 
+50, 50, 68, 
+68, 116, 116, 
+120, 120, 10, 
+10, 144, 144, 
+12, 12, 32, 
+32, 82, 82, 
+150, 150, 28, 
+28, 130, 130, 
+154, 154, 156, 
+156, 44, 44, 
+114, 114, 56, 
+56, 84, 84, 
+38, 38, 98, 
+98, 72, 72, 
 6, };
-__ALIGNED(8) const uint16_t perm64[NB_PERM64]={
-32, 4, 4, 
-8, 8, 16, 
-16, 2, 40, 
-20, 20, 10, 
-10, 48, 48, 
-6, 24, 18, 
-18, 34, 34, 
-36, 36, 12, 
-56, 22, 22, 
-42, 42, 52, 
-52, 14, 50, 
-38, 38, 44, 
-44, 28, 28, 
-26, 58, 54, 
-54, 46, 46, 
-60, 60, 30, 
+__ALIGNED(8) const uint16_t perm35[NB_PERM35]={
+50, 62, 62, 
+172, 172, 118, 
+118, 194, 194, 
+98, 98, 74, 
+74, 92, 92, 
+114, 114, 94, 
+94, 164, 164, 
+108, 108, 134, 
+134, 166, 166, 
+158, 158, 196, 
+196, 148, 148, 
+136, 136, 26, 
+26, 80, 80, 
+4, 4, 100, 
+100, 124, 124, 
+106, 106, 84, 
+84, 104, 104, 
+34, 34, 90, 
+90, 64, 64, 
+32, 32, 40, 
+40, 2, 150, 
+186, 186, 88, 
+88, 14, 14, 
+160, 160, 8, 
+8, 10, 10, 
+60, 60, 122, 
+122, 56, 56, 
+22, 22, 170, 
+170, 68, 68, 
+132, 132, 116, 
+116, 144, 144, 
+36, 36, 140, 
+140, 126, 126, 
+156, 156, 146, 
+146, 86, 86, 
+154, 154, 96, 
+96, 24, 24, 
+30, 30, 180, 
+180, 128, 128, 
+16, 16, 20, 
+20, 120, 120, 
+6, 110, 184, 
+184, 38, 38, 
+190, 190, 188, 
+188, 138, 138, 
+76, 76, 142, 
+142, 176, 176, 
+28, 28, 130, 
+130, 66, 66, 
+82, 82, 54, 
+54, 162, 162, 
+58, 58, 72, 
+72, 42, 42, 
+52, 52, 112, 
+112, 44, 44, 
+102, 102, 174, 
+174, 168, 168, 
+18, 18, 70, 
+70, 182, 182, 
+178, 178, 78, 
+78, 192, 192, 
+48, 48, 12, 
+152, 46, };
+__ALIGNED(8) const uint16_t perm36[NB_PERM36]={
+72, 10, 10, 
+168, 168, 30, 
+30, 56, 56, 
+74, 74, 82, 
+82, 178, 178, 
+198, 198, 22, 
+22, 152, 152, 
+116, 116, 100, 
+100, 186, 186, 
+38, 38, 88, 
+88, 202, 202, 
+166, 166, 150, 
+150, 44, 44, 
+112, 112, 148, 
+148, 164, 164, 
+78, 78, 34, 
+34, 200, 200, 
+94, 94, 162, 
+162, 6, 6, 
+24, 24, 32, 
+32, 128, 128, 
+84, 84, 58, 
+58, 146, 146, 
+92, 92, 90, 
+90, 18, 18, 
+8, 8, 96, 
+96, 42, 42, 
+40, 40, 160, 
+160, 212, 212, 
+142, 142, 204, 
+204, 46, 46, 
+184, 184, 158, 
+158, 140, 140, 
+132, 132, 36, 
+36, 16, 16, 
+192, 192, 62, 
+62, 98, 98, 
+114, 114, 28, 
+28, 176, 176, 
+126, 126, 12, 
+12, 48, 48, 
+64, 64, 170, 
+170, 102, 102, 
+66, 66, 50, 
+50, 136, 136, 
+180, 180, 14, 
+14, 120, 120, 
+52, 52, 208, 
+208, 190, 190, 
+182, 182, 86, 
+86, 130, 130, 
+156, 156, 68, 
+68, 122, 122, 
+124, 124, 196, 
+196, 206, 206, 
+118, 118, 172, 
+172, 174, 174, 
+54, 54, 2, 
+144, 20, 20, 
+80, 80, 106, 
+106, 210, 210, 
+70, 70, 194, 
+194, 134, 134, 
+108, 108, 4, 
+104, 138, 138, 
+60, 60, 26, 
+154, 188, 188, 
+110, 110, 76, 
+};
+__ALIGNED(8) const uint16_t perm37[NB_PERM37]={
+80, 132, 132, 
+40, 40, 178, 
+178, 234, 234, 
+78, 78, 52, 
+52, 210, 210, 
+14, 14, 112, 
+112, 214, 214, 
+174, 174, 74, 
+74, 116, 116, 
+150, 150, 10, 
+10, 176, 176, 
+154, 154, 170, 
+170, 138, 138, 
+56, 56, 146, 
+146, 152, 152, 
+90, 90, 6, 
+6, 16, 16, 
+192, 192, 44, 
+44, 114, 114, 
+70, 70, 180, 
+180, 12, 12, 
+32, 32, 82, 
+82, 212, 212, 
+94, 94, 166, 
+166, 202, 202, 
+220, 220, 190, 
+190, 188, 188, 
+108, 108, 54, 
+54, 66, 66, 
+20, 20, 128, 
+128, 104, 104, 
+118, 118, 230, 
+230, 142, 142, 
+216, 216, 30, 
+30, 2, 160, 
+186, 186, 28, 
+28, 224, 224, 
+126, 126, 24, 
+24, 64, 64, 
+164, 164, 122, 
+122, 88, 88, 
+228, 228, 62, 
+62, 84, 84, 
+68, 68, 100, 
+100, 182, 182, 
+92, 92, 86, 
+86, 148, 148, 
+232, 232, 222, 
+222, 46, 46, 
+194, 194, 124, 
+124, 168, 168, 
+58, 58, 226, 
+226, 206, 206, 
+156, 156, 26, 
+26, 144, 144, 
+72, 72, 36, 
+36, 18, 18, 
+48, 48, 50, 
+50, 130, 130, 
+184, 184, 172, 
+172, 218, 218, 
+110, 110, 134, 
+134, 120, 120, 
+8, 8, 96, 
+96, 22, 22, 
+208, 208, 236, 
+236, 158, 158, 
+106, 106, 198, 
+198, 60, 60, 
+4, 162, 42, 
+42, 34, 98, 
+102, 102, 38, 
+196, 204, 204, 
+76, 200, 140, 
+140, 136, };
+__ALIGNED(8) const uint16_t perm38[NB_PERM38]={
+50, 2, 100, 
+4, 150, 6, 
+200, 8, 60, 
+12, 110, 14, 
+160, 16, 210, 
+18, 70, 22, 
+120, 24, 170, 
+26, 220, 28, 
+80, 32, 130, 
+34, 180, 36, 
+230, 38, 90, 
+42, 140, 44, 
+190, 46, 240, 
+48, 102, 54, 
+152, 56, 202, 
+58, 112, 64, 
+162, 66, 212, 
+68, 122, 74, 
+172, 76, 222, 
+78, 132, 84, 
+182, 86, 232, 
+88, 142, 94, 
+192, 96, 242, 
+98, 154, 106, 
+204, 108, 164, 
+116, 214, 118, 
+174, 126, 224, 
+128, 184, 136, 
+234, 138, 194, 
+146, 244, 148, 
+206, 158, 216, 
+168, 226, 178, 
+236, 188, 246, 
+198, };
+__ALIGNED(8) const uint16_t perm39[NB_PERM39]={
+128, 8, 8, 
+32, 32, 2, 
+16, 64, 64, 
+4, 144, 72, 
+72, 36, 36, 
+18, 18, 192, 
+192, 12, 12, 
+48, 48, 66, 
+66, 132, 132, 
+24, 24, 96, 
+96, 6, 160, 
+10, 176, 74, 
+74, 164, 164, 
+26, 26, 224, 
+224, 14, 80, 
+68, 68, 20, 
+208, 76, 76, 
+52, 52, 82, 
+82, 196, 196, 
+28, 28, 112, 
+112, 70, 70, 
+148, 148, 88, 
+88, 100, 100, 
+22, 240, 78, 
+78, 180, 180, 
+90, 90, 228, 
+228, 30, 130, 
+136, 136, 40, 
+40, 34, 146, 
+200, 200, 44, 
+44, 50, 50, 
+194, 194, 140, 
+140, 56, 56, 
+98, 98, 134, 
+134, 152, 152, 
+104, 104, 38, 
+162, 138, 138, 
+168, 168, 42, 
+178, 202, 202, 
+172, 172, 58, 
+58, 226, 226, 
+142, 142, 184, 
+184, 106, 106, 
+166, 166, 154, 
+154, 232, 232, 
+46, 210, 204, 
+204, 60, 60, 
+114, 114, 198, 
+198, 156, 156, 
+120, 120, 102, 
+102, 150, 150, 
+216, 216, 108, 
+108, 54, 242, 
+206, 206, 188, 
+188, 122, 122, 
+230, 230, 158, 
+158, 248, 248, 
+110, 110, 182, 
+182, 218, 218, 
+236, 236, 62, 
+212, 92, 92, 
+116, 116, 86, 
+244, 94, 214, 
+220, 220, 124, 
+124, 118, 246, 
+222, 222, 252, 
+252, 126, 186, 
+234, 234, 174, 
+250, 238, 238, 
+190, };
+__ALIGNED(8) const uint16_t perm40[NB_PERM40]={
+144, 8, 8, 
+96, 96, 36, 
+36, 2, 48, 
+18, 18, 208, 
+208, 90, 90, 
+212, 212, 138, 
+138, 230, 230, 
+172, 172, 88, 
+88, 68, 68, 
+130, 130, 262, 
+262, 254, 254, 
+158, 158, 168, 
+168, 40, 40, 
+50, 50, 162, 
+162, 216, 216, 
+12, 12, 16, 
+16, 64, 64, 
+82, 82, 244, 
+244, 92, 92, 
+116, 116, 102, 
+102, 228, 228, 
+28, 28, 80, 
+80, 100, 100, 
+84, 84, 20, 
+20, 112, 112, 
+54, 54, 210, 
+210, 234, 234, 
+220, 220, 60, 
+60, 34, 34, 
+272, 272, 126, 
+126, 214, 214, 
+282, 282, 238, 
+238, 268, 268, 
+78, 78, 196, 
+196, 74, 74, 
+148, 148, 56, 
+56, 114, 114, 
+198, 198, 218, 
+218, 156, 156, 
+24, 24, 32, 
+32, 128, 128, 
+118, 118, 246, 
+246, 236, 236, 
+124, 124, 70, 
+70, 274, 274, 
+270, 270, 222, 
+222, 204, 204, 
+42, 42, 194, 
+194, 170, 170, 
+184, 184, 58, 
+58, 258, 258, 
+206, 206, 186, 
+186, 202, 202, 
+266, 266, 174, 
+174, 232, 232, 
+76, 76, 52, 
+52, 66, 66, 
+226, 226, 252, 
+252, 14, 14, 
+160, 160, 72, 
+72, 4, 192, 
+26, 26, 176, 
+176, 136, 136, 
+86, 86, 164, 
+164, 120, 120, 
+22, 22, 256, 
+256, 62, 62, 
+178, 178, 280, 
+280, 94, 94, 
+260, 260, 110, 
+110, 150, 150, 
+200, 200, 122, 
+122, 166, 166, 
+264, 264, 30, 
+30, 224, 224, 
+108, 108, 6, 
+240, 44, 44, 
+98, 98, 180, 
+180, 10, 146, 
+152, 152, 104, 
+104, 132, 132, 
+38, 242, 188, 
+188, 106, 106, 
+276, 276, 46, 
+182, 154, 154, 
+248, 248, 140, 
+140, 134, 278, 
+190, 190, 250, 
+250, 284, 284, 
+142, };
+__ALIGNED(8) const uint16_t perm41[NB_PERM41]={
+150, 224, 224, 
+136, 136, 64, 
+64, 52, 52, 
+90, 90, 222, 
+222, 236, 236, 
+146, 146, 174, 
+174, 244, 244, 
+58, 58, 290, 
+290, 198, 198, 
+216, 216, 36, 
+36, 30, 30, 
+220, 220, 86, 
+86, 172, 172, 
+94, 94, 272, 
+272, 128, 128, 
+104, 104, 132, 
+132, 14, 14, 
+160, 160, 84, 
+84, 22, 22, 
+260, 260, 118, 
+118, 292, 292, 
+98, 98, 182, 
+182, 156, 156, 
+34, 34, 270, 
+270, 228, 228, 
+46, 46, 280, 
+280, 88, 88, 
+72, 72, 12, 
+12, 10, 10, 
+250, 250, 258, 
+258, 218, 218, 
+186, 186, 206, 
+206, 176, 176, 
+144, 144, 24, 
+24, 20, 20, 
+110, 110, 192, 
+192, 16, 16, 
+60, 60, 2, 
+50, 190, 190, 
+256, 256, 68, 
+68, 102, 102, 
+232, 232, 96, 
+96, 32, 32, 
+120, 120, 4, 
+200, 116, 116, 
+142, 142, 264, 
+264, 28, 28, 
+70, 70, 252, 
+252, 18, 18, 
+210, 210, 226, 
+226, 286, 286, 
+288, 288, 48, 
+48, 40, 40, 
+80, 80, 112, 
+112, 92, 92, 
+122, 122, 154, 
+154, 274, 274, 
+278, 278, 188, 
+188, 106, 106, 
+282, 282, 238, 
+238, 296, 296, 
+148, 148, 74, 
+74, 162, 162, 
+234, 234, 246, 
+246, 208, 208, 
+76, 76, 62, 
+62, 152, 152, 
+124, 124, 54, 
+54, 240, 240, 
+8, 8, 100, 
+100, 82, 82, 
+262, 262, 268, 
+268, 78, 78, 
+212, 212, 126, 
+126, 204, 204, 
+26, 26, 170, 
+170, 194, 194, 
+166, 166, 284, 
+284, 138, 138, 
+214, 214, 276, 
+276, 38, 38, 
+180, 180, 6, 
+230, 196, 196, 
+66, 66, 202, 
+202, 266, 266, 
+178, 178, 294, 
+294, 248, 248, 
+108, 108, 42, 
+130, 254, 254, 
+168, 168, 44, 
+140, 114, 114, 
+242, 242, 158, 
+158, 184, 184, 
+56, 164, 134, 
 };
-__ALIGNED(8) const uint16_t perm65[NB_PERM65]={
-288, 4, 4, 
-96, 96, 80, 
-80, 208, 208, 
-170, 170, 354, 
-354, 460, 460, 
-166, 166, 514, 
-514, 502, 502, 
-558, 558, 446, 
-446, 326, 326, 
-300, 300, 36, 
-36, 8, 8, 
-192, 192, 42, 
-42, 392, 392, 
-276, 276, 90, 
-90, 432, 432, 
-6, 6, 384, 
-384, 84, 84, 
-48, 48, 40, 
-40, 104, 104, 
-272, 272, 250, 
-250, 562, 562, 
-542, 542, 318, 
-318, 452, 452, 
-230, 230, 338, 
-338, 332, 332, 
-204, 204, 74, 
-74, 304, 304, 
-132, 132, 88, 
-88, 144, 144, 
-2, 480, 46, 
-46, 488, 488, 
-238, 238, 530, 
-530, 374, 374, 
-340, 340, 140, 
-140, 280, 280, 
-186, 186, 394, 
-394, 564, 564, 
-94, 94, 528, 
-528, 86, 86, 
-336, 336, 44, 
-44, 200, 200, 
-234, 234, 434, 
-434, 294, 294, 
-388, 388, 180, 
-180, 10, 32, 
-256, 256, 122, 
-122, 344, 344, 
-236, 236, 242, 
-242, 370, 370, 
-500, 500, 270, 
-270, 442, 442, 
-486, 486, 430, 
-430, 572, 572, 
-286, 286, 570, 
-570, 478, 478, 
-494, 494, 366, 
-366, 404, 404, 
-220, 220, 114, 
-114, 408, 408, 
-60, 60, 72, 
-72, 16, 16, 
-128, 128, 248, 
-248, 274, 274, 
-538, 538, 566, 
-566, 382, 382, 
-532, 532, 182, 
-182, 298, 298, 
-484, 484, 142, 
-142, 568, 568, 
-190, 190, 490, 
-490, 526, 526, 
-534, 534, 470, 
-470, 302, 302, 
-324, 324, 12, 
-320, 260, 260, 
-218, 218, 306, 
-306, 420, 420, 
-92, 92, 240, 
-240, 82, 82, 
-496, 496, 174, 
-174, 450, 450, 
-422, 422, 380, 
-380, 244, 244, 
-178, 178, 546, 
-546, 414, 414, 
-444, 444, 38, 
-38, 296, 296, 
-196, 196, 138, 
-138, 472, 472, 
-110, 110, 312, 
-312, 68, 68, 
-264, 264, 58, 
-58, 520, 520, 
-150, 150, 386, 
-386, 372, 372, 
-52, 52, 136, 
-136, 184, 184, 
-106, 106, 560, 
-560, 254, 254, 
-314, 314, 356, 
-356, 268, 268, 
-154, 154, 482, 
-482, 334, 334, 
-492, 492, 78, 
-78, 400, 400, 
-124, 124, 152, 
-152, 194, 194, 
-330, 330, 396, 
-396, 28, 28, 
-160, 160, 130, 
-130, 536, 536, 
-278, 278, 378, 
-378, 436, 436, 
-102, 102, 464, 
-464, 262, 262, 
-506, 506, 310, 
-310, 516, 516, 
-54, 54, 424, 
-424, 188, 188, 
-202, 202, 522, 
-522, 438, 438, 
-390, 390, 468, 
-468, 14, 416, 
-252, 252, 26, 
-26, 352, 352, 
-172, 172, 162, 
-162, 418, 418, 
-540, 540, 30, 
-30, 448, 448, 
-134, 134, 376, 
-376, 148, 148, 
-98, 98, 368, 
-368, 212, 212, 
-266, 266, 346, 
-346, 524, 524, 
-246, 246, 466, 
-466, 550, 550, 
-510, 510, 406, 
-406, 508, 508, 
-118, 118, 504, 
-504, 22, 22, 
-512, 512, 214, 
-214, 554, 554, 
-350, 350, 364, 
-364, 116, 116, 
-216, 216, 18, 
-224, 210, 210, 
-458, 458, 358, 
-358, 556, 556, 
-158, 158, 322, 
-322, 548, 548, 
-222, 222, 402, 
-402, 412, 412, 
-156, 156, 34, 
-34, 544, 544, 
-126, 126, 440, 
-440, 198, 198, 
-426, 426, 476, 
-476, 206, 206, 
-362, 362, 308, 
-308, 228, 228, 
-50, 50, 328, 
-328, 108, 108, 
+__ALIGNED(8) const uint16_t perm42[NB_PERM42]={
+80, 4, 4, 
+160, 160, 8, 
+8, 16, 16, 
+32, 32, 64, 
+64, 50, 50, 
+98, 98, 116, 
+116, 228, 228, 
+218, 218, 122, 
+122, 86, 86, 
+244, 244, 172, 
+172, 184, 184, 
+56, 56, 34, 
+34, 144, 144, 
+54, 54, 258, 
+258, 124, 124, 
+166, 166, 248, 
+248, 28, 28, 
+208, 208, 26, 
+26, 128, 128, 
+22, 22, 272, 
+272, 76, 76, 
+226, 226, 138, 
+138, 118, 118, 
+308, 308, 222, 
+222, 282, 282, 
+94, 94, 260, 
+260, 204, 204, 
+170, 170, 104, 
+104, 52, 52, 
+178, 178, 120, 
+120, 6, 6, 
+240, 240, 12, 
+12, 176, 176, 
+40, 40, 2, 
+96, 36, 36, 
+224, 224, 58, 
+58, 114, 114, 
+148, 148, 214, 
+214, 266, 266, 
+140, 140, 198, 
+198, 312, 312, 
+78, 78, 306, 
+306, 142, 142, 
+278, 278, 316, 
+316, 238, 238, 
+314, 314, 158, 
+158, 310, 310, 
+302, 302, 286, 
+286, 254, 254, 
+268, 268, 220, 
+220, 202, 202, 
+90, 90, 100, 
+100, 196, 196, 
+232, 232, 74, 
+74, 146, 146, 
+134, 134, 262, 
+262, 284, 284, 
+174, 174, 264, 
+264, 60, 60, 
+194, 194, 152, 
+152, 70, 70, 
+290, 290, 110, 
+110, 292, 292, 
+190, 190, 296, 
+296, 46, 46, 
+242, 242, 92, 
+92, 180, 180, 
+200, 200, 10, 
+256, 44, 44, 
+162, 162, 88, 
+88, 20, 20, 
+192, 192, 72, 
+72, 66, 66, 
+130, 130, 102, 
+102, 276, 276, 
+236, 236, 234, 
+234, 154, 154, 
+150, 150, 294, 
+294, 270, 270, 
+300, 300, 206, 
+206, 250, 250, 
+108, 108, 212, 
+212, 186, 186, 
+136, 136, 38, 
+38, 304, 304, 
+62, 62, 274, 
+274, 156, 156, 
+230, 230, 298, 
+298, 126, 126, 
+246, 246, 252, 
+252, 188, 188, 
+216, 216, 42, 
+42, 82, 82, 
+84, 84, 164, 
+164, 168, 168, 
+24, 24, 48, 
+48, 18, 18, 
+112, 112, 68, 
+68, 210, 210, 
+106, 106, 132, 
+132, 182, 182, 
+280, 280, 14, 
+288, 30, };
+__ALIGNED(8) const uint16_t perm43[NB_PERM43]={
+120, 102, 102, 
+92, 92, 132, 
+132, 72, 72, 
+2, 240, 56, 
+56, 150, 150, 
+44, 44, 180, 
+180, 24, 24, 
+50, 50, 220, 
+220, 246, 246, 
+96, 96, 52, 
+52, 340, 340, 
+348, 348, 78, 
+78, 42, 42, 
+60, 60, 70, 
+70, 350, 350, 
+198, 198, 34, 
+34, 330, 330, 
+68, 68, 230, 
+230, 206, 206, 
+194, 194, 224, 
+224, 166, 166, 
+254, 254, 146, 
+146, 124, 124, 
+342, 342, 38, 
+38, 140, 140, 
+232, 232, 326, 
+326, 148, 148, 
+244, 244, 296, 
+296, 168, 168, 
+54, 54, 30, 
+30, 90, 90, 
+12, 12, 80, 
+80, 162, 162, 
+14, 14, 200, 
+200, 154, 154, 
+284, 284, 236, 
+236, 136, 136, 
+312, 312, 58, 
+58, 270, 270, 
+36, 36, 20, 
+20, 130, 130, 
+272, 272, 156, 
+156, 84, 84, 
+82, 82, 282, 
+282, 116, 116, 
+182, 182, 144, 
+144, 4, 40, 
+260, 260, 186, 
+186, 64, 64, 
+310, 310, 258, 
+258, 66, 66, 
+110, 110, 142, 
+142, 352, 352, 
+318, 318, 98, 
+98, 172, 172, 
+294, 294, 48, 
+48, 100, 100, 
+292, 292, 248, 
+248, 216, 216, 
+6, 160, 324, 
+324, 28, 28, 
+290, 290, 128, 
+128, 152, 152, 
+164, 164, 134, 
+134, 192, 192, 
+104, 104, 212, 
+212, 234, 234, 
+16, 16, 320, 
+320, 218, 218, 
+126, 126, 32, 
+32, 210, 210, 
+114, 114, 62, 
+62, 190, 190, 
+304, 304, 328, 
+328, 268, 268, 
+346, 346, 278, 
+278, 196, 196, 
+344, 344, 158, 
+158, 204, 204, 
+74, 74, 122, 
+122, 222, 222, 
+46, 46, 300, 
+300, 88, 88, 
+322, 322, 338, 
+338, 228, 228, 
+86, 86, 202, 
+202, 274, 274, 
+276, 276, 76, 
+76, 242, 242, 
+176, 176, 214, 
+214, 354, 354, 
+118, 118, 302, 
+302, 208, 208, 
+314, 314, 178, 
+178, 334, 334, 
+308, 308, 138, 
+138, 112, 112, 
+262, 262, 306, 
+306, 18, 18, 
+10, 10, 280, 
+280, 316, 316, 
+298, 298, 288, 
+288, 8, 250, 
+336, 336, 108, 
+108, 22, 170, 
+174, 174, 94, 
+94, 252, 252, 
+26, 332, 188, 
+188, 184, 184, 
+264, 264, 106, 
+286, 356, 356, 
+238, 238, 256, 
+256, 266, 266, 
+226, };
+__ALIGNED(8) const uint16_t perm44[NB_PERM44]={
+128, 212, 212, 
+184, 184, 358, 
+358, 318, 318, 
+92, 92, 242, 
+242, 138, 138, 
+116, 116, 180, 
+180, 102, 102, 
+20, 20, 176, 
+176, 214, 214, 
+312, 312, 76, 
+76, 322, 322, 
+348, 348, 46, 
+46, 368, 368, 
+222, 222, 88, 
+88, 354, 354, 
+62, 62, 162, 
+162, 54, 54, 
+18, 18, 48, 
+48, 2, 256, 
+298, 298, 284, 
+284, 250, 250, 
+282, 282, 122, 
+122, 196, 196, 
+264, 264, 74, 
+74, 194, 194, 
+136, 136, 356, 
+356, 190, 190, 
+374, 374, 238, 
+238, 376, 376, 
+366, 366, 94, 
+94, 370, 370, 
+350, 350, 174, 
+174, 86, 86, 
+226, 226, 344, 
+344, 158, 158, 
+166, 166, 310, 
+310, 316, 316, 
+332, 332, 252, 
+252, 42, 42, 
+112, 112, 292, 
+292, 268, 268, 
+330, 330, 124, 
+124, 324, 324, 
+108, 108, 36, 
+36, 96, 96, 
+4, 16, 288, 
+288, 12, 12, 
+32, 32, 208, 
+208, 296, 296, 
+156, 156, 38, 
+38, 224, 224, 
+216, 216, 72, 
+72, 66, 66, 
+50, 50, 130, 
+130, 340, 340, 
+270, 270, 90, 
+90, 114, 114, 
+52, 52, 258, 
+258, 58, 58, 
+274, 274, 346, 
+346, 286, 286, 
+378, 378, 126, 
+126, 84, 84, 
+98, 98, 132, 
+132, 100, 100, 
+260, 260, 186, 
+186, 118, 118, 
+308, 308, 188, 
+188, 246, 246, 
+26, 26, 192, 
+192, 8, 8, 
+144, 144, 6, 
+272, 218, 218, 
+200, 200, 152, 
+152, 150, 150, 
+22, 22, 304, 
+304, 300, 300, 
+44, 44, 240, 
+240, 10, 160, 
+294, 294, 28, 
+28, 320, 320, 
+220, 220, 328, 
+328, 364, 364, 
+334, 334, 380, 
+380, 254, 254, 
+170, 170, 198, 
+198, 24, 24, 
+64, 64, 290, 
+290, 140, 140, 
+244, 244, 266, 
+266, 202, 202, 
+280, 280, 362, 
+362, 206, 206, 
+168, 168, 70, 
+70, 306, 306, 
+60, 60, 34, 
+34, 336, 336, 
+14, 80, 210, 
+210, 56, 56, 
+146, 146, 134, 
+134, 228, 228, 
+104, 104, 148, 
+148, 262, 262, 
+314, 314, 204, 
+204, 40, 40, 
+352, 352, 302, 
+302, 172, 172, 
+326, 326, 236, 
+236, 248, 248, 
+154, 154, 278, 
+278, 234, 234, 
+120, 120, 68, 
+68, 178, 178, 
+342, 342, 30, 
+82, 338, 338, 
+142, 142, 372, 
+372, 110, 110, 
+164, 164, 182, 
+182, 230, 230, 
+232, 232, 360, 
+360, 78, 276, 
+106, };
+__ALIGNED(8) const uint16_t perm45[NB_PERM45]={
+80, 50, 50, 
+2, 160, 22, 
+22, 112, 112, 
+100, 100, 4, 
+240, 72, 72, 
+114, 114, 180, 
+180, 54, 54, 
+162, 162, 102, 
+102, 84, 84, 
+210, 210, 24, 
+24, 192, 192, 
+150, 150, 6, 
+320, 44, 44, 
+224, 224, 200, 
+200, 8, 16, 
+256, 256, 250, 
+250, 10, 96, 
+306, 306, 252, 
+252, 90, 90, 
+66, 66, 258, 
+258, 330, 330, 
+60, 60, 18, 
+18, 336, 336, 
+300, 300, 12, 
+176, 278, 278, 
+362, 362, 110, 
+110, 20, 20, 
+32, 32, 128, 
+128, 356, 356, 
+254, 254, 170, 
+170, 38, 38, 
+368, 368, 350, 
+350, 14, 272, 
+122, 122, 116, 
+116, 260, 260, 
+26, 352, 94, 
+94, 226, 226, 
+280, 280, 58, 
+58, 322, 322, 
+124, 124, 196, 
+196, 310, 310, 
+28, 48, 384, 
+384, 222, 222, 
+120, 120, 36, 
+36, 288, 288, 
+378, 378, 366, 
+366, 270, 270, 
+42, 42, 144, 
+144, 228, 228, 
+360, 360, 30, 
+208, 328, 328, 
+364, 364, 190, 
+190, 70, 70, 
+34, 64, 178, 
+178, 358, 358, 
+334, 334, 220, 
+220, 40, 304, 
+172, 172, 118, 
+118, 340, 340, 
+76, 76, 274, 
+274, 202, 202, 
+88, 88, 370, 
+370, 46, 82, 
+130, 130, 52, 
+242, 152, 152, 
+86, 86, 290, 
+290, 74, 74, 
+194, 194, 230, 
+230, 56, 98, 
+386, 386, 302, 
+302, 92, 92, 
+146, 146, 308, 
+308, 332, 332, 
+140, 140, 68, 
+68, 338, 338, 
+380, 380, 62, 
+354, 174, 174, 
+198, 198, 390, 
+390, 78, 164, 
+182, 182, 134, 
+134, 212, 212, 
+104, 244, 232, 
+232, 136, 136, 
+292, 292, 154, 
+154, 166, 166, 
+262, 262, 106, 
+324, 204, 204, 
+168, 168, 342, 
+342, 156, 156, 
+246, 246, 312, 
+312, 108, 276, 
+282, 282, 138, 
+138, 372, 372, 
+126, 148, 388, 
+388, 382, 382, 
+142, 326, 284, 
+284, 218, 218, 
+344, 344, 236, 
+236, 296, 296, 
+314, 314, 188, 
+188, 374, 374, 
+206, 206, 248, 
+248, 392, 392, 
+158, 214, 184, 
+294, 234, 234, 
+216, 216, 264, 
+264, 186, 376, 
+286, 286, 298, 
+298, 394, 394, 
+238, 346, 316, 
+316, 268, 348, 
+396, 396, 318, 
+};
+__ALIGNED(8) const uint16_t perm46[NB_PERM46]={
+144, 36, 36, 
+32, 32, 256, 
+256, 328, 328, 
+300, 300, 122, 
+122, 244, 244, 
+360, 360, 44, 
+44, 224, 224, 
+200, 200, 182, 
+182, 166, 166, 
+294, 294, 74, 
+74, 162, 162, 
+6, 6, 48, 
+48, 128, 128, 
+164, 164, 150, 
+150, 84, 84, 
+114, 114, 52, 
+52, 416, 416, 
+190, 190, 358, 
+358, 412, 412, 
+414, 414, 46, 
+46, 368, 368, 
+236, 236, 168, 
+168, 54, 54, 
+2, 288, 26, 
+26, 208, 208, 
+374, 374, 284, 
+284, 250, 250, 
+408, 408, 126, 
+126, 20, 20, 
+160, 160, 420, 
+420, 94, 94, 
+322, 322, 426, 
+426, 142, 142, 
+404, 404, 222, 
+222, 56, 56, 
+146, 146, 180, 
+180, 22, 22, 
+304, 304, 410, 
+410, 270, 270, 
+10, 10, 336, 
+336, 108, 108, 
+4, 192, 118, 
+118, 340, 340, 
+396, 396, 30, 
+30, 112, 112, 
+292, 292, 314, 
+314, 234, 234, 
 24, 24, 64, 
-64, 168, 168, 
-66, 66, 456, 
-456, 70, 70, 
-552, 552, 62, 
-62, 360, 360, 
-20, 232, 146, 
-146, 290, 290, 
-292, 292, 100, 
-100, 176, 176, 
-258, 258, 410, 
-410, 348, 348, 
-76, 76, 112, 
-112, 120, 120, 
-56, 226, 498, 
-498, 462, 462, 
-454, 454, 518, 
-518, 342, 342, 
-428, 428, 284, 
-284, 282, 282, 
-474, 474, 398, 
-398, 316, 316, 
-164, };
-__ALIGNED(8) const uint16_t perm66[NB_PERM66]={
-160, 24, 24, 
-90, 90, 252, 
-252, 156, 156, 
-134, 134, 204, 
-204, 126, 126, 
-312, 312, 118, 
-118, 232, 232, 
-106, 106, 262, 
-262, 208, 208, 
-16, 16, 10, 
-10, 240, 240, 
-36, 36, 60, 
-60, 150, 150, 
-214, 214, 216, 
-216, 96, 96, 
-22, 22, 210, 
-210, 176, 176, 
-34, 34, 180, 
-180, 74, 74, 
-242, 242, 196, 
-196, 46, 46, 
-300, 300, 148, 
-148, 54, 54, 
-230, 230, 226, 
-226, 186, 186, 
-274, 274, 178, 
-178, 194, 194, 
-166, 166, 224, 
-224, 26, 26, 
-250, 250, 276, 
+64, 338, 338, 
+252, 252, 40, 
+40, 320, 320, 
+282, 282, 106, 
+106, 418, 418, 
+334, 334, 348, 
+348, 76, 76, 
+306, 306, 42, 
+42, 80, 80, 
+210, 210, 134, 
+134, 212, 212, 
+278, 278, 202, 
+202, 326, 326, 
+156, 156, 132, 
+132, 68, 68, 
+242, 242, 216, 
+216, 8, 96, 
+82, 82, 354, 
+354, 124, 124, 
+388, 388, 350, 
+350, 220, 220, 
+296, 296, 218, 
+218, 152, 152, 
+228, 228, 104, 
+104, 274, 274, 
+298, 298, 362, 
+362, 188, 188, 
+214, 214, 422, 
+422, 238, 238, 
+312, 312, 90, 
+90, 34, 34, 
+400, 400, 318, 
+318, 138, 138, 
+116, 116, 196, 
+196, 406, 406, 
+366, 366, 92, 
+92, 178, 178, 
+390, 390, 110, 
+110, 148, 148, 
+324, 324, 12, 
+240, 72, 72, 
+18, 18, 16, 
+16, 384, 384, 
+62, 62, 194, 
+194, 262, 262, 
+376, 376, 428, 
+428, 286, 286, 
+394, 394, 398, 
+398, 174, 174, 
+102, 102, 130, 
+130, 308, 308, 
+186, 186, 70, 
+70, 386, 386, 
+206, 206, 230, 
+230, 248, 248, 
+264, 264, 136, 
+136, 356, 356, 
+268, 268, 424, 
+424, 382, 382, 
+302, 302, 266, 
+266, 280, 280, 
+346, 346, 316, 
+316, 378, 378, 
+14, 352, 364, 
+364, 332, 332, 
+204, 204, 86, 
+86, 258, 258, 
+88, 88, 402, 
+402, 78, 78, 
+66, 66, 98, 
+98, 226, 226, 
+344, 344, 172, 
+172, 342, 342, 
+28, 176, 246, 
+246, 120, 120, 
+100, 100, 370, 
+370, 380, 380, 
+158, 158, 276, 
 276, 58, 58, 
-270, 270, 288, 
-288, 28, 28, 
-130, 130, 164, 
-164, 64, 64, 
-2, 40, 100, 
-100, 62, 62, 
-310, 310, 238, 
-238, 306, 306, 
-198, 198, 206, 
-206, 286, 286, 
-298, 298, 268, 
-268, 128, 128, 
-4, 200, 86, 
-86, 212, 212, 
-56, 56, 110, 
-110, 302, 302, 
-308, 308, 78, 
-78, 282, 282, 
-258, 258, 168, 
-168, 104, 104, 
-102, 102, 222, 
-222, 296, 296, 
-108, 108, 142, 
-142, 284, 284, 
-138, 138, 244, 
-244, 76, 76, 
-122, 122, 272, 
-272, 18, 18, 
-170, 170, 264, 
-264, 88, 88, 
-92, 92, 132, 
-132, 44, 44, 
-140, 140, 124, 
-124, 152, 152, 
-94, 94, 292, 
-292, 68, 68, 
-42, 42, 260, 
-260, 48, 48, 
-30, 30, 290, 
-290, 188, 188, 
-154, 154, 254, 
-254, 316, 316, 
-158, 158, 294, 
-294, 228, 228, 
-66, 66, 162, 
-162, 184, 184, 
-114, 114, 192, 
-192, 6, 80, 
-12, 12, 120, 
-120, 112, 112, 
-32, 32, 20, 
-20, 50, 50, 
-190, 190, 314, 
-314, 278, 278, 
-218, 218, 256, 
-256, 8, 280, 
-98, 98, 182, 
-182, 234, 234, 
-266, 266, 248, 
-248, 116, 116, 
-72, 72, 82, 
-82, 172, 172, 
-144, 144, 14, 
-220, 136, 136, 
-84, 84, 52, 
-52, 70, 70, 
-202, 202, 246, 
-246, 236, 236, 
-146, 146, 174, 
-174, 304, 304, 
-38, };
-__ALIGNED(8) const uint16_t perm67[NB_PERM67]={
+290, 290, 170, 
+170, 198, 198, 
+38, 272, 154, 
+154, 372, 372, 
+140, 140, 260, 
+260, 232, 232, 
+392, 392, 254, 
+254, 184, 184, 
+310, 310, 330, 
+330, 60, 60, 
+50, };
+__ALIGNED(8) const uint16_t perm47[NB_PERM47]={
+240, 8, 8, 
+160, 160, 132, 
+132, 20, 20, 
+176, 176, 228, 
+228, 70, 70, 
+402, 402, 380, 
+380, 188, 188, 
+166, 166, 452, 
+452, 206, 206, 
+278, 278, 296, 
+296, 232, 232, 
+150, 150, 356, 
+356, 234, 234, 
+390, 390, 364, 
+364, 92, 92, 
+194, 194, 262, 
+262, 424, 424, 
+94, 94, 434, 
+434, 270, 270, 
+360, 360, 12, 
+12, 16, 16, 
+96, 96, 50, 
+50, 304, 304, 
+90, 90, 354, 
+354, 394, 394, 
+444, 444, 46, 
+46, 448, 448, 
+126, 126, 324, 
+324, 42, 42, 
+368, 368, 172, 
+172, 148, 148, 
+116, 116, 226, 
+226, 454, 454, 
+446, 446, 286, 
+286, 456, 456, 
+62, 62, 242, 
+242, 248, 248, 
+168, 168, 68, 
+68, 162, 162, 
+372, 372, 28, 
+28, 112, 112, 
+146, 146, 276, 
+276, 56, 56, 
+224, 224, 214, 
+214, 438, 438, 
+350, 350, 314, 
+314, 266, 266, 
+280, 280, 136, 
+136, 100, 100, 
+130, 130, 404, 
+404, 220, 220, 
+134, 134, 260, 
+260, 184, 184, 
+86, 86, 274, 
+274, 440, 440, 
+190, 190, 406, 
+406, 460, 460, 
+142, 142, 420, 
+420, 14, 14, 
+256, 256, 104, 
+104, 210, 210, 
+358, 358, 474, 
+474, 398, 398, 
+300, 300, 10, 
+10, 400, 400, 
+140, 140, 180, 
+180, 6, 6, 
+320, 320, 186, 
+186, 326, 326, 
+282, 282, 376, 
+376, 108, 108, 
+66, 66, 322, 
+322, 426, 426, 
+334, 334, 442, 
+442, 430, 430, 
+414, 414, 396, 
+396, 60, 60, 
+2, 80, 178, 
+178, 468, 468, 
+78, 78, 338, 
+338, 298, 298, 
+472, 472, 158, 
+158, 292, 292, 
+152, 152, 196, 
+196, 102, 102, 
+370, 370, 412, 
+412, 156, 156, 
+52, 52, 144, 
+144, 36, 36, 
+48, 48, 64, 
+64, 82, 82, 
+418, 418, 476, 
+476, 238, 238, 
+470, 470, 318, 
+318, 346, 346, 
+458, 458, 302, 
+302, 250, 250, 
+408, 408, 76, 
+76, 98, 98, 
+290, 290, 312, 
+312, 26, 26, 
+272, 272, 200, 
+200, 182, 182, 
+246, 246, 328, 
+328, 122, 122, 
+244, 244, 88, 
+88, 114, 114, 
+386, 386, 284, 
+284, 216, 216, 
+54, 54, 384, 
+384, 44, 44, 
+208, 208, 118, 
+118, 466, 466, 
+462, 462, 382, 
+382, 428, 428, 
+174, 174, 388, 
+388, 124, 124, 
+84, 84, 34, 
+34, 432, 432, 
+30, 30, 352, 
+352, 154, 154, 
+436, 436, 110, 
+110, 306, 306, 
+330, 330, 362, 
+362, 252, 252, 
+24, 24, 32, 
+32, 192, 192, 
+22, 22, 416, 
+416, 236, 236, 
+230, 230, 310, 
+310, 410, 410, 
+316, 316, 106, 
+106, 450, 450, 
+366, 366, 332, 
+332, 202, 202, 
+422, 422, 254, 
+254, 264, 264, 
+40, 40, 128, 
+128, 164, 164, 
+212, 212, 198, 
+198, 342, 342, 
+378, 378, 348, 
+348, 74, 74, 
+258, 258, 344, 
+344, 218, 218, 
+294, 294, 392, 
+392, 204, 204, 
+38, 38, 288, 
+288, 72, 72, 
+18, 18, 336, 
+336, 58, 58, 
+464, 464, 222, 
+222, 374, 374, 
+268, 268, 120, 
+120, 4, 340, 
+138, 308, 170, 
+};
+__ALIGNED(8) const uint16_t perm48[NB_PERM48]={
+128, 4, 4, 
+256, 256, 8, 
+8, 16, 16, 
+32, 32, 64, 
+64, 2, 384, 
+12, 12, 272, 
+272, 40, 40, 
+80, 80, 34, 
+34, 192, 192, 
+6, 144, 36, 
+36, 320, 320, 
+10, 400, 44, 
+44, 336, 336, 
+42, 42, 208, 
+208, 38, 38, 
+448, 448, 14, 
+160, 68, 68, 
+258, 258, 136, 
+136, 20, 20, 
+288, 288, 72, 
+72, 18, 416, 
+76, 76, 274, 
+274, 168, 168, 
+84, 84, 290, 
+290, 200, 200, 
+22, 48, 96, 
+96, 66, 66, 
+130, 130, 132, 
+132, 260, 260, 
+264, 264, 24, 
+176, 100, 100, 
+322, 322, 138, 
+138, 148, 148, 
+292, 292, 328, 
+328, 26, 304, 
+104, 104, 82, 
+82, 162, 162, 
+196, 196, 262, 
+262, 392, 392, 
+28, 432, 108, 
+108, 338, 338, 
+170, 170, 212, 
+212, 294, 294, 
+456, 456, 30, 
+464, 46, 224, 
+70, 70, 386, 
+386, 140, 140, 
+276, 276, 296, 
+296, 88, 88, 
+50, 352, 74, 
+74, 146, 146, 
+164, 164, 324, 
+324, 266, 266, 
+152, 152, 52, 
+480, 78, 78, 
+402, 402, 172, 
+172, 340, 340, 
+298, 298, 216, 
+216, 54, 112, 
+98, 98, 194, 
+194, 134, 134, 
+388, 388, 268, 
+268, 280, 280, 
+56, 240, 102, 
+102, 450, 450, 
+142, 142, 404, 
+404, 300, 300, 
+344, 344, 58, 
+368, 106, 106, 
+210, 210, 166, 
+166, 452, 452, 
+270, 270, 408, 
+408, 60, 496, 
+110, 110, 466, 
+466, 174, 174, 
+468, 468, 302, 
+302, 472, 472, 
+62, 418, 204, 
+204, 278, 278, 
+424, 424, 92, 
+92, 306, 306, 
+232, 232, 86, 
+178, 228, 228, 
+326, 326, 394, 
+394, 156, 156, 
+308, 308, 360, 
+360, 90, 434, 
+236, 236, 342, 
+342, 426, 426, 
+220, 220, 310, 
+310, 488, 488, 
+94, 226, 198, 
+198, 390, 390, 
+396, 396, 284, 
+284, 312, 312, 
+120, 120, 114, 
+354, 202, 202, 
+150, 150, 420, 
+420, 332, 332, 
+282, 282, 184, 
+184, 116, 482, 
+206, 206, 406, 
+406, 428, 428, 
+348, 348, 314, 
+314, 248, 248, 
+118, 242, 230, 
+230, 454, 454, 
+398, 398, 412, 
+412, 316, 316, 
+376, 376, 122, 
+370, 234, 234, 
+214, 214, 422, 
+422, 460, 460, 
+286, 286, 440, 
+440, 124, 498, 
+238, 238, 470, 
+470, 430, 430, 
+476, 476, 318, 
+318, 504, 504, 
+126, 180, 356, 
+356, 330, 330, 
+154, 436, 364, 
+364, 346, 346, 
+186, 186, 244, 
+244, 358, 358, 
+458, 458, 158, 
+484, 334, 334, 
+410, 410, 188, 
+188, 372, 372, 
+362, 362, 218, 
+218, 182, 500, 
+366, 366, 474, 
+474, 190, 438, 
+492, 492, 350, 
+350, 442, 442, 
+252, 252, 374, 
+374, 490, 490, 
+222, 486, 462, 
+462, 414, 414, 
+444, 444, 380, 
+380, 378, 378, 
+250, 250, 246, 
+502, 494, 494, 
+478, 478, 446, 
+446, 508, 508, 
+382, 382, 506, 
+506, 254, };
+__ALIGNED(8) const uint16_t perm49[NB_PERM49]={
+192, 164, 164, 
+212, 212, 372, 
+372, 138, 138, 
+178, 178, 532, 
+532, 478, 478, 
+492, 492, 124, 
+124, 546, 546, 
+110, 110, 226, 
+226, 454, 454, 
+412, 412, 554, 
+554, 366, 366, 
+74, 74, 194, 
+194, 356, 356, 
+376, 376, 522, 
+522, 30, 30, 
+144, 144, 4, 
+4, 384, 384, 
+90, 90, 18, 
+18, 16, 16, 
+512, 512, 270, 
+270, 54, 54, 
+48, 48, 160, 
+160, 516, 516, 
+142, 142, 562, 
+562, 446, 446, 
+332, 332, 296, 
+296, 264, 264, 
+166, 166, 404, 
+404, 298, 298, 
+456, 456, 92, 
+92, 210, 210, 
+180, 180, 36, 
+36, 32, 32, 
+336, 336, 168, 
+168, 84, 84, 
+130, 130, 434, 
+434, 204, 204, 
+116, 116, 290, 
+290, 200, 200, 
+244, 244, 470, 
+470, 236, 236, 
+214, 214, 564, 
+564, 126, 126, 
+50, 50, 352, 
+352, 504, 504, 
+14, 14, 320, 
+320, 344, 344, 
+248, 248, 342, 
+342, 56, 56, 
+240, 240, 86, 
+86, 322, 322, 
+536, 536, 350, 
+350, 312, 312, 
+88, 88, 514, 
+514, 462, 462, 
+156, 156, 132, 
+132, 114, 114, 
+98, 98, 274, 
+274, 438, 438, 
+76, 76, 386, 
+386, 282, 282, 
+182, 182, 228, 
+228, 134, 134, 
+306, 306, 24, 
+24, 80, 80, 
+258, 258, 102, 
+102, 146, 146, 
+196, 196, 548, 
+548, 302, 302, 
+328, 328, 424, 
+424, 506, 506, 
+206, 206, 308, 
+308, 216, 216, 
+6, 6, 64, 
+64, 496, 496, 
+508, 508, 398, 
+398, 234, 234, 
+22, 22, 400, 
+400, 426, 426, 
+186, 186, 100, 
+100, 466, 466, 
+540, 540, 46, 
+46, 480, 480, 
+172, 172, 468, 
+468, 44, 44, 
+288, 288, 8, 
+8, 256, 256, 
+422, 422, 314, 
+314, 280, 280, 
+502, 502, 572, 
+572, 382, 382, 
+410, 410, 362, 
+362, 202, 202, 
+436, 436, 396, 
+396, 42, 42, 
+96, 96, 82, 
+82, 450, 450, 
+28, 28, 464, 
+464, 348, 348, 
+120, 120, 162, 
+162, 20, 20, 
+208, 208, 500, 
+500, 380, 380, 
+218, 218, 198, 
+198, 52, 52, 
+544, 544, 430, 
+430, 570, 570, 
+190, 190, 484, 
+484, 556, 556, 
+558, 558, 62, 
+62, 304, 304, 
+520, 520, 526, 
+526, 414, 414, 
+58, 58, 432, 
+432, 12, 12, 
+128, 128, 242, 
+242, 278, 278, 
+310, 310, 408, 
+408, 170, 170, 
+276, 276, 118, 
+118, 482, 482, 
+364, 364, 394, 
+394, 538, 538, 
+542, 542, 238, 
+238, 406, 406, 
+490, 490, 444, 
+444, 140, 140, 
+370, 370, 458, 
+458, 284, 284, 
+374, 374, 330, 
+330, 104, 104, 
+338, 338, 360, 
+360, 10, 10, 
+448, 448, 524, 
+524, 222, 222, 
+70, 70, 560, 
+560, 254, 254, 
+230, 230, 326, 
+326, 232, 232, 
+518, 518, 334, 
+334, 488, 488, 
+252, 252, 38, 
+38, 224, 224, 
+262, 262, 486, 
+486, 60, 60, 
+112, 112, 418, 
+418, 442, 442, 
+460, 460, 476, 
+476, 300, 300, 
+136, 136, 498, 
+498, 188, 188, 
+292, 292, 392, 
+392, 346, 346, 
+440, 440, 268, 
+268, 550, 550, 
+494, 494, 316, 
+316, 472, 472, 
+428, 428, 378, 
+378, 26, 26, 
+272, 272, 246, 
+246, 150, 150, 
+68, 68, 368, 
+368, 266, 266, 
+358, 358, 568, 
+568, 510, 510, 
+78, 78, 66, 
+66, 176, 176, 
+340, 340, 552, 
+552, 174, 174, 
+148, 148, 388, 
+388, 474, 474, 
+108, 108, 34, 
+34, 528, 528, 
+94, 94, 402, 
+402, 106, 106, 
+530, 530, 286, 
+286, 566, 566, 
+318, 318, 152, 
+152, 260, 260, 
+294, 294, 72, 
+72, 2, 416, 
+250, 250, 534, 
+534, 158, 158, 
+324, 324, 40, 
+354, 184, 184, 
+420, 420, 122, 
+452, 220, 220, 
+390, 390, 154, 
+};
+__ALIGNED(8) const uint16_t perm50[NB_PERM50]={
+128, 578, 578, 
+542, 542, 236, 
+236, 500, 500, 
+44, 44, 320, 
+320, 8, 8, 
+512, 512, 188, 
+188, 548, 548, 
+620, 620, 110, 
+110, 50, 50, 
+80, 80, 2, 
+256, 406, 406, 
+394, 394, 376, 
+376, 472, 472, 
+250, 250, 22, 
+22, 160, 160, 
+4, 384, 360, 
+360, 72, 72, 
+240, 240, 6, 
+16, 400, 400, 
+10, 144, 354, 
+354, 312, 312, 
+246, 246, 390, 
+390, 120, 120, 
+66, 66, 480, 
+480, 12, 272, 
+182, 182, 164, 
+164, 260, 260, 
+38, 38, 560, 
+560, 14, 528, 
+588, 588, 558, 
+558, 636, 636, 
+510, 510, 60, 
+60, 96, 96, 
+402, 402, 138, 
+138, 594, 594, 
+318, 318, 630, 
+630, 126, 126, 
+450, 450, 90, 
+90, 18, 32, 
+176, 176, 404, 
+404, 266, 266, 
+422, 422, 170, 
+170, 20, 288, 
+582, 582, 174, 
+174, 276, 276, 
+438, 438, 570, 
+570, 30, 30, 
+48, 48, 576, 
+576, 414, 414, 
+282, 282, 198, 
+198, 564, 564, 
+270, 270, 54, 
+54, 336, 336, 
+408, 408, 522, 
+522, 204, 204, 
+324, 324, 264, 
+264, 294, 294, 
+342, 342, 168, 
+168, 516, 516, 
+444, 444, 330, 
+330, 24, 416, 
+410, 410, 26, 
+544, 364, 364, 
+328, 328, 520, 
+520, 76, 76, 
+496, 496, 412, 
+412, 154, 154, 
+370, 370, 88, 
+88, 514, 514, 
+316, 316, 502, 
+502, 172, 172, 
+148, 148, 610, 
+610, 94, 94, 
+274, 274, 310, 
+310, 118, 118, 
+562, 562, 142, 
+142, 226, 226, 
+484, 484, 268, 
+268, 550, 550, 
+124, 124, 322, 
+322, 136, 136, 
+466, 466, 490, 
+490, 28, 304, 
+358, 358, 568, 
+568, 526, 526, 
+460, 460, 106, 
+106, 418, 418, 
+538, 538, 604, 
+604, 334, 334, 
+280, 280, 70, 
+70, 112, 112, 
+178, 178, 532, 
+532, 220, 220, 
+100, 100, 34, 
+432, 186, 186, 
+420, 420, 42, 
+42, 192, 192, 
+180, 180, 36, 
+64, 352, 352, 
+184, 184, 292, 
+292, 214, 214, 
+340, 340, 40, 
+448, 586, 586, 
+430, 430, 58, 
+58, 592, 592, 
+190, 190, 52, 
+52, 208, 208, 
+580, 580, 46, 
+464, 362, 362, 
+200, 200, 68, 
+68, 608, 608, 
+590, 590, 62, 
+62, 224, 224, 
+356, 356, 440, 
+440, 74, 74, 
+368, 368, 584, 
+584, 302, 302, 
+230, 230, 116, 
+116, 434, 434, 
+314, 314, 374, 
+374, 344, 344, 
+296, 296, 470, 
+470, 122, 122, 
+194, 194, 308, 
+308, 614, 614, 
+350, 350, 56, 
+624, 366, 366, 
+456, 456, 474, 
+474, 378, 378, 
+600, 600, 78, 
+130, 82, 258, 
+534, 534, 348, 
+348, 552, 552, 
+252, 252, 150, 
+150, 114, 114, 
+306, 306, 486, 
+486, 396, 396, 
+504, 504, 300, 
+300, 102, 102, 
+162, 162, 132, 
+132, 210, 210, 
+84, 386, 488, 
+488, 524, 524, 
+332, 332, 152, 
+152, 242, 242, 
+134, 134, 338, 
+338, 536, 536, 
+476, 476, 506, 
+506, 428, 428, 
+554, 554, 380, 
+380, 104, 104, 
+290, 290, 86, 
+146, 482, 482, 
+140, 140, 98, 
+98, 530, 530, 
+92, 546, 492, 
+492, 156, 156, 
+498, 498, 540, 
+540, 108, 626, 
+494, 494, 284, 
+284, 326, 326, 
+392, 392, 248, 
+248, 518, 518, 
+572, 572, 158, 
+388, 616, 616, 
+478, 478, 634, 
+634, 382, 382, 
+232, 232, 244, 
+244, 262, 262, 
+166, 436, 442, 
+442, 202, 202, 
+196, 452, 218, 
+218, 596, 596, 
+446, 446, 458, 
+458, 602, 602, 
+206, 468, 618, 
+618, 606, 606, 
+462, 462, 234, 
+234, 372, 372, 
+216, 228, 612, 
+612, 222, 628, 
+622, 622, 238, 
+278, 566, 566, 
+398, 398, 632, 
+632, 254, 454, 
+346, 346, 424, 
+424, 298, 298, 
+598, 598, 574, 
+574, 286, 556, 
+508, };
+__ALIGNED(8) const uint16_t perm51[NB_PERM51]={
+384, 8, 8, 
+256, 256, 212, 
+212, 276, 276, 
+116, 116, 274, 
+274, 740, 740, 
+350, 350, 470, 
+470, 504, 504, 
+42, 42, 560, 
+560, 362, 362, 
+486, 486, 522, 
+522, 570, 570, 
+634, 634, 716, 
+716, 318, 318, 
+550, 550, 730, 
+730, 718, 718, 
+702, 702, 558, 
+558, 618, 618, 
+572, 572, 378, 
+378, 630, 630, 
+588, 588, 28, 
+28, 160, 160, 
+210, 210, 532, 
+532, 202, 202, 
+644, 644, 348, 
+348, 86, 86, 
+496, 496, 154, 
+154, 706, 706, 
+686, 686, 414, 
+414, 552, 552, 
+106, 106, 642, 
+642, 604, 604, 
+172, 172, 226, 
+226, 676, 676, 
+142, 142, 690, 
+690, 542, 542, 
+474, 474, 632, 
+632, 332, 332, 
+310, 310, 662, 
+662, 508, 508, 
+170, 170, 482, 
+482, 394, 394, 
+648, 648, 108, 
+108, 18, 18, 
+528, 528, 74, 
+74, 480, 480, 
+10, 10, 640, 
+640, 220, 220, 
+164, 164, 338, 
+338, 454, 454, 
+728, 728, 334, 
+334, 694, 694, 
+670, 670, 764, 
+764, 382, 382, 
+758, 758, 510, 
+510, 554, 554, 
+490, 490, 650, 
+650, 492, 492, 
+26, 26, 416, 
+416, 296, 296, 
+262, 262, 724, 
+724, 206, 206, 
+404, 404, 280, 
+280, 244, 244, 
+196, 196, 132, 
+132, 50, 50, 
+448, 448, 216, 
+216, 36, 36, 
+48, 48, 64, 
+64, 208, 208, 
+148, 148, 194, 
+194, 388, 388, 
+136, 136, 178, 
+178, 738, 738, 
+606, 606, 556, 
+556, 234, 234, 
+564, 564, 122, 
+122, 418, 418, 
+680, 680, 270, 
+270, 612, 612, 
+60, 60, 80, 
+80, 352, 352, 
+214, 214, 660, 
+660, 124, 124, 
+162, 162, 594, 
+594, 540, 540, 
+90, 90, 624, 
+624, 76, 76, 
+224, 224, 292, 
+292, 134, 134, 
+434, 434, 456, 
+456, 104, 104, 
+258, 258, 596, 
+596, 284, 284, 
+372, 372, 118, 
+118, 658, 658, 
+748, 748, 238, 
+238, 692, 692, 
+286, 286, 756, 
+756, 126, 126, 
+546, 546, 602, 
+602, 428, 428, 
+312, 312, 38, 
+38, 432, 432, 
+72, 72, 96, 
+96, 2, 128, 
+290, 290, 390, 
+390, 520, 520, 
+186, 186, 626, 
+626, 460, 460, 
+232, 232, 180, 
+180, 114, 114, 
+530, 530, 458, 
+458, 488, 488, 
+266, 266, 484, 
+484, 138, 138, 
+562, 562, 746, 
+746, 494, 494, 
+410, 410, 424, 
+424, 184, 184, 
+242, 242, 452, 
+452, 344, 344, 
+326, 326, 438, 
+438, 584, 584, 
+268, 268, 228, 
+228, 52, 52, 
+192, 192, 4, 
+512, 298, 298, 
+646, 646, 732, 
+732, 94, 94, 
+752, 752, 366, 
+366, 614, 614, 
+444, 444, 88, 
+88, 240, 240, 
+68, 68, 336, 
+336, 70, 70, 
+720, 720, 78, 
+78, 608, 608, 
+300, 300, 22, 
+22, 656, 656, 
+364, 364, 230, 
+230, 436, 436, 
+200, 200, 260, 
+260, 340, 340, 
+198, 198, 516, 
+516, 58, 58, 
+704, 704, 302, 
+302, 406, 406, 
+664, 664, 252, 
+252, 84, 84, 
+112, 112, 146, 
+146, 450, 450, 
+600, 600, 44, 
+44, 304, 304, 
+150, 150, 578, 
+578, 396, 396, 
+24, 24, 32, 
+32, 288, 288, 
+6, 16, 144, 
+144, 66, 66, 
+592, 592, 156, 
+156, 82, 82, 
+736, 736, 222, 
+222, 548, 548, 
+346, 346, 710, 
+710, 446, 446, 
+472, 472, 248, 
+248, 324, 324, 
+54, 54, 576, 
+576, 12, 400, 
+152, 152, 322, 
+322, 678, 678, 
+526, 526, 698, 
+698, 430, 430, 
+696, 696, 46, 
+46, 688, 688, 
+158, 158, 466, 
+466, 744, 744, 
+110, 110, 402, 
+402, 536, 536, 
+330, 330, 566, 
+566, 506, 506, 
+426, 426, 568, 
+568, 250, 250, 
+708, 708, 62, 
+62, 464, 464, 
+360, 360, 102, 
+102, 514, 514, 
+682, 682, 654, 
+654, 620, 620, 
+316, 316, 166, 
+166, 722, 722, 
+462, 462, 616, 
+616, 188, 188, 
+370, 370, 742, 
+742, 734, 734, 
+478, 478, 760, 
+760, 254, 254, 
+468, 468, 120, 
+120, 34, 34, 
+672, 672, 14, 
+272, 356, 356, 
+342, 342, 582, 
+582, 524, 524, 
+314, 314, 422, 
+422, 440, 440, 
+328, 328, 182, 
+182, 498, 498, 
+538, 538, 714, 
+714, 574, 574, 
+762, 762, 638, 
+638, 476, 476, 
+376, 376, 246, 
+246, 580, 580, 
+140, 140, 306, 
+306, 534, 534, 
+586, 586, 652, 
+652, 236, 236, 
+308, 308, 278, 
+278, 500, 500, 
+282, 282, 628, 
+628, 204, 204, 
+20, 544, 218, 
+218, 420, 420, 
+56, 56, 320, 
+320, 294, 294, 
+518, 518, 442, 
+442, 712, 712, 
+190, 190, 754, 
+754, 750, 750, 
+622, 622, 700, 
+700, 174, 174, 
+610, 610, 684, 
+684, 30, 176, 
+354, 354, 598, 
+598, 668, 668, 
+380, 380, 374, 
+374, 502, 502, 
+666, 666, 636, 
+636, 92, 92, 
+368, 368, 358, 
+358, 726, 726, 
+590, 590, 412, 
+412, 168, 168, 
+98, 98, 386, 
+386, 392, 392, 
+264, 264, 100, 
+100, 130, 130, 
+674, 674, 398, 
+398, 408, 408, 
+40, };
+__ALIGNED(8) const uint16_t perm52[NB_PERM52]={
+400, 8, 8, 
+160, 160, 50, 
+50, 592, 592, 
+314, 314, 646, 
+646, 524, 524, 
+106, 106, 482, 
+482, 472, 472, 
+296, 296, 388, 
+388, 230, 230, 
+580, 580, 74, 
+74, 688, 688, 
+236, 236, 340, 
+340, 38, 38, 
+736, 736, 350, 
+350, 598, 598, 
+794, 794, 718, 
+718, 734, 734, 
+670, 670, 620, 
+620, 28, 28, 
+176, 176, 370, 
+370, 614, 614, 
+652, 652, 284, 
+284, 148, 148, 
+194, 194, 706, 
+706, 494, 494, 
+712, 712, 254, 
+254, 676, 676, 
+380, 380, 70, 
+70, 608, 608, 
+172, 172, 290, 
+290, 628, 628, 
+188, 188, 226, 
+226, 500, 500, 
+10, 10, 560, 
+560, 58, 58, 
+752, 752, 286, 
+286, 548, 548, 
+202, 202, 404, 
+404, 88, 88, 
+224, 224, 100, 
+100, 2, 80, 
+64, 64, 128, 
+128, 178, 178, 
+770, 770, 622, 
+622, 428, 428, 
+184, 184, 146, 
+146, 514, 514, 
+650, 650, 604, 
+604, 92, 92, 
+304, 304, 86, 
+86, 544, 544, 
+122, 122, 418, 
+418, 728, 728, 
+190, 190, 626, 
+626, 508, 508, 
+170, 170, 610, 
+610, 572, 572, 
+298, 298, 788, 
+788, 238, 238, 
+740, 740, 46, 
+46, 512, 512, 
+250, 250, 596, 
+596, 394, 394, 
+710, 710, 574, 
+574, 698, 698, 
+796, 796, 398, 
+398, 790, 790, 
+638, 638, 748, 
+748, 206, 206, 
+484, 484, 152, 
+152, 274, 274, 
+692, 692, 316, 
+316, 326, 326, 
+502, 502, 410, 
+410, 568, 568, 
+218, 218, 724, 
+724, 110, 110, 
+562, 562, 458, 
+458, 760, 760, 
+62, 62, 448, 
+448, 200, 200, 
+4, 480, 72, 
+72, 288, 288, 
+228, 228, 180, 
+180, 66, 66, 
+528, 528, 186, 
+186, 546, 546, 
+522, 522, 426, 
+426, 504, 504, 
+90, 90, 624, 
+624, 108, 108, 
+162, 162, 450, 
+450, 600, 600, 
+12, 12, 240, 
+240, 36, 36, 
+336, 336, 342, 
+342, 438, 438, 
+744, 744, 126, 
+126, 498, 498, 
+792, 792, 318, 
+318, 726, 726, 
+510, 510, 570, 
+570, 618, 618, 
+732, 732, 270, 
+270, 612, 612, 
+252, 252, 276, 
+276, 372, 372, 
+294, 294, 708, 
+708, 174, 174, 
+690, 690, 636, 
+636, 348, 348, 
+198, 198, 786, 
+786, 558, 558, 
+762, 762, 462, 
+462, 456, 456, 
+360, 360, 54, 
+54, 672, 672, 
+300, 300, 6, 
+640, 44, 44, 
+112, 112, 242, 
+242, 436, 436, 
+344, 344, 118, 
+118, 722, 722, 
+430, 430, 584, 
+584, 154, 154, 
+674, 674, 700, 
+700, 14, 320, 
+22, 22, 416, 
+416, 328, 328, 
+182, 182, 466, 
+466, 536, 536, 
+346, 346, 518, 
+518, 730, 730, 
+590, 590, 634, 
+634, 668, 668, 
+220, 220, 20, 
+20, 16, 720, 
+30, 30, 576, 
+576, 378, 378, 
+774, 774, 702, 
+702, 414, 414, 
+648, 648, 204, 
+204, 84, 84, 
+144, 144, 114, 
+114, 642, 642, 
+444, 444, 120, 
+120, 18, 96, 
+384, 384, 150, 
+150, 594, 594, 
+714, 714, 654, 
+654, 684, 684, 
+156, 156, 354, 
+354, 678, 678, 
+780, 780, 78, 
+78, 768, 768, 
+222, 222, 420, 
+420, 24, 496, 
+392, 392, 310, 
+310, 566, 566, 
+538, 538, 746, 
+746, 526, 526, 
+506, 506, 490, 
+490, 632, 632, 
+268, 268, 212, 
+212, 244, 244, 
+116, 116, 322, 
+322, 422, 422, 
+424, 424, 104, 
+104, 82, 82, 
+464, 464, 136, 
+136, 338, 338, 
+742, 742, 446, 
+446, 520, 520, 
+26, 256, 356, 
+356, 358, 358, 
+758, 758, 766, 
+766, 542, 542, 
+442, 442, 440, 
+440, 40, 40, 
+32, 656, 364, 
+364, 134, 134, 
+658, 658, 764, 
+764, 142, 142, 
+434, 434, 664, 
+664, 140, 140, 
+34, 432, 264, 
+264, 132, 132, 
+258, 258, 756, 
+756, 366, 366, 
+534, 534, 666, 
+666, 540, 540, 
+42, 192, 306, 
+306, 486, 486, 
+552, 552, 282, 
+282, 468, 468, 
+216, 216, 324, 
+324, 102, 102, 
+402, 402, 408, 
+408, 168, 168, 
+210, 210, 564, 
+564, 138, 138, 
+738, 738, 750, 
+750, 606, 606, 
+492, 492, 312, 
+312, 246, 246, 
+516, 516, 330, 
+330, 582, 582, 
+474, 474, 696, 
+696, 396, 396, 
+390, 390, 630, 
+630, 588, 588, 
+234, 234, 660, 
+660, 60, 60, 
+48, 272, 292, 
+292, 308, 308, 
+166, 166, 530, 
+530, 586, 586, 
+554, 554, 682, 
+682, 476, 476, 
+376, 376, 374, 
+374, 694, 694, 
+716, 716, 334, 
+334, 662, 662, 
+460, 460, 56, 
+56, 352, 352, 
+278, 278, 772, 
+772, 302, 302, 
+406, 406, 488, 
+488, 232, 232, 
+260, 260, 52, 
+208, 164, 164, 
+130, 130, 578, 
+578, 778, 778, 
+782, 782, 478, 
+478, 776, 776, 
+382, 382, 470, 
+470, 616, 616, 
+332, 332, 262, 
+262, 452, 452, 
+280, 280, 68, 
+368, 214, 214, 
+644, 644, 124, 
+124, 98, 98, 
+784, 784, 158, 
+158, 754, 754, 
+686, 686, 556, 
+556, 362, 362, 
+454, 454, 680, 
+680, 76, 704, 
+94, 386, 550, 
+550, 602, 602, 
+412, 412, 248, 
+248, 196, 532, 
+266, };
+__ALIGNED(8) const uint16_t perm53[NB_PERM53]={
+128, 2, 256, 
+4, 384, 6, 
+512, 8, 640, 
+10, 768, 12, 
+896, 14, 144, 
+18, 272, 20, 
+400, 22, 528, 
+24, 656, 26, 
+784, 28, 912, 
+30, 160, 34, 
+288, 36, 416, 
+38, 544, 40, 
+672, 42, 800, 
+44, 928, 46, 
+176, 50, 304, 
+52, 432, 54, 
+560, 56, 688, 
+58, 816, 60, 
+944, 62, 192, 
+66, 320, 68, 
+448, 70, 576, 
+72, 704, 74, 
+832, 76, 960, 
+78, 208, 82, 
+336, 84, 464, 
+86, 592, 88, 
+720, 90, 848, 
+92, 976, 94, 
+224, 98, 352, 
+100, 480, 102, 
+608, 104, 736, 
+106, 864, 108, 
+992, 110, 240, 
+114, 368, 116, 
+496, 118, 624, 
+120, 752, 122, 
+880, 124, 1008, 
+126, 258, 132, 
+386, 134, 514, 
+136, 642, 138, 
+770, 140, 898, 
+142, 274, 148, 
+402, 150, 530, 
+152, 658, 154, 
+786, 156, 914, 
+158, 290, 164, 
+418, 166, 546, 
+168, 674, 170, 
+802, 172, 930, 
+174, 306, 180, 
+434, 182, 562, 
+184, 690, 186, 
+818, 188, 946, 
+190, 322, 196, 
+450, 198, 578, 
+200, 706, 202, 
+834, 204, 962, 
+206, 338, 212, 
+466, 214, 594, 
+216, 722, 218, 
+850, 220, 978, 
+222, 354, 228, 
+482, 230, 610, 
+232, 738, 234, 
+866, 236, 994, 
+238, 370, 244, 
+498, 246, 626, 
+248, 754, 250, 
+882, 252, 1010, 
+254, 388, 262, 
+516, 264, 644, 
+266, 772, 268, 
+900, 270, 404, 
+278, 532, 280, 
+660, 282, 788, 
+284, 916, 286, 
+420, 294, 548, 
+296, 676, 298, 
+804, 300, 932, 
+302, 436, 310, 
+564, 312, 692, 
+314, 820, 316, 
+948, 318, 452, 
+326, 580, 328, 
+708, 330, 836, 
+332, 964, 334, 
+468, 342, 596, 
+344, 724, 346, 
+852, 348, 980, 
+350, 484, 358, 
+612, 360, 740, 
+362, 868, 364, 
+996, 366, 500, 
+374, 628, 376, 
+756, 378, 884, 
+380, 1012, 382, 
+518, 392, 646, 
+394, 774, 396, 
+902, 398, 534, 
+408, 662, 410, 
+790, 412, 918, 
+414, 550, 424, 
+678, 426, 806, 
+428, 934, 430, 
+566, 440, 694, 
+442, 822, 444, 
+950, 446, 582, 
+456, 710, 458, 
+838, 460, 966, 
+462, 598, 472, 
+726, 474, 854, 
+476, 982, 478, 
+614, 488, 742, 
+490, 870, 492, 
+998, 494, 630, 
+504, 758, 506, 
+886, 508, 1014, 
+510, 648, 522, 
+776, 524, 904, 
+526, 664, 538, 
+792, 540, 920, 
+542, 680, 554, 
+808, 556, 936, 
+558, 696, 570, 
+824, 572, 952, 
+574, 712, 586, 
+840, 588, 968, 
+590, 728, 602, 
+856, 604, 984, 
+606, 744, 618, 
+872, 620, 1000, 
+622, 760, 634, 
+888, 636, 1016, 
+638, 778, 652, 
+906, 654, 794, 
+668, 922, 670, 
+810, 684, 938, 
+686, 826, 700, 
+954, 702, 842, 
+716, 970, 718, 
+858, 732, 986, 
+734, 874, 748, 
+1002, 750, 890, 
+764, 1018, 766, 
+908, 782, 924, 
+798, 940, 814, 
+956, 830, 972, 
+846, 988, 862, 
+1004, 878, 1020, 
+894, };
+__ALIGNED(8) const uint16_t perm54[NB_PERM54]={
+512, 2, 1024, 
+4, 1536, 6, 
+128, 8, 640, 
+10, 1152, 12, 
+1664, 14, 256, 
+16, 768, 18, 
+1280, 20, 1792, 
+22, 384, 24, 
+896, 26, 1408, 
+28, 1920, 30, 
+544, 34, 1056, 
+36, 1568, 38, 
+160, 40, 672, 
+42, 1184, 44, 
+1696, 46, 288, 
+48, 800, 50, 
+1312, 52, 1824, 
+54, 416, 56, 
+928, 58, 1440, 
+60, 1952, 62, 
+576, 66, 1088, 
+68, 1600, 70, 
+192, 72, 704, 
+74, 1216, 76, 
+1728, 78, 320, 
+80, 832, 82, 
+1344, 84, 1856, 
+86, 448, 88, 
+960, 90, 1472, 
+92, 1984, 94, 
+608, 98, 1120, 
+100, 1632, 102, 
+224, 104, 736, 
+106, 1248, 108, 
+1760, 110, 352, 
+112, 864, 114, 
+1376, 116, 1888, 
+118, 480, 120, 
+992, 122, 1504, 
+124, 2016, 126, 
+520, 130, 1032, 
+132, 1544, 134, 
+648, 138, 1160, 
+140, 1672, 142, 
+264, 144, 776, 
+146, 1288, 148, 
+1800, 150, 392, 
+152, 904, 154, 
+1416, 156, 1928, 
+158, 552, 162, 
+1064, 164, 1576, 
+166, 680, 170, 
+1192, 172, 1704, 
+174, 296, 176, 
+808, 178, 1320, 
+180, 1832, 182, 
+424, 184, 936, 
+186, 1448, 188, 
+1960, 190, 584, 
+194, 1096, 196, 
+1608, 198, 712, 
+202, 1224, 204, 
+1736, 206, 328, 
+208, 840, 210, 
+1352, 212, 1864, 
+214, 456, 216, 
+968, 218, 1480, 
+220, 1992, 222, 
+616, 226, 1128, 
+228, 1640, 230, 
+744, 234, 1256, 
+236, 1768, 238, 
+360, 240, 872, 
+242, 1384, 244, 
+1896, 246, 488, 
+248, 1000, 250, 
+1512, 252, 2024, 
+254, 528, 258, 
+1040, 260, 1552, 
+262, 656, 266, 
+1168, 268, 1680, 
+270, 784, 274, 
+1296, 276, 1808, 
+278, 400, 280, 
+912, 282, 1424, 
+284, 1936, 286, 
+560, 290, 1072, 
+292, 1584, 294, 
+688, 298, 1200, 
+300, 1712, 302, 
+816, 306, 1328, 
+308, 1840, 310, 
+432, 312, 944, 
+314, 1456, 316, 
+1968, 318, 592, 
+322, 1104, 324, 
+1616, 326, 720, 
+330, 1232, 332, 
+1744, 334, 848, 
+338, 1360, 340, 
+1872, 342, 464, 
+344, 976, 346, 
+1488, 348, 2000, 
+350, 624, 354, 
+1136, 356, 1648, 
+358, 752, 362, 
+1264, 364, 1776, 
+366, 880, 370, 
+1392, 372, 1904, 
+374, 496, 376, 
+1008, 378, 1520, 
+380, 2032, 382, 
+536, 386, 1048, 
+388, 1560, 390, 
+664, 394, 1176, 
+396, 1688, 398, 
+792, 402, 1304, 
+404, 1816, 406, 
+920, 410, 1432, 
+412, 1944, 414, 
+568, 418, 1080, 
+420, 1592, 422, 
+696, 426, 1208, 
+428, 1720, 430, 
+824, 434, 1336, 
+436, 1848, 438, 
+952, 442, 1464, 
+444, 1976, 446, 
+600, 450, 1112, 
+452, 1624, 454, 
+728, 458, 1240, 
+460, 1752, 462, 
+856, 466, 1368, 
+468, 1880, 470, 
+984, 474, 1496, 
+476, 2008, 478, 
+632, 482, 1144, 
+484, 1656, 486, 
+760, 490, 1272, 
+492, 1784, 494, 
+888, 498, 1400, 
+500, 1912, 502, 
+1016, 506, 1528, 
+508, 2040, 510, 
+1026, 516, 1538, 
+518, 642, 522, 
+1154, 524, 1666, 
+526, 770, 530, 
+1282, 532, 1794, 
+534, 898, 538, 
+1410, 540, 1922, 
+542, 1058, 548, 
+1570, 550, 674, 
+554, 1186, 556, 
+1698, 558, 802, 
+562, 1314, 564, 
+1826, 566, 930, 
+570, 1442, 572, 
+1954, 574, 1090, 
+580, 1602, 582, 
+706, 586, 1218, 
+588, 1730, 590, 
+834, 594, 1346, 
+596, 1858, 598, 
+962, 602, 1474, 
+604, 1986, 606, 
+1122, 612, 1634, 
+614, 738, 618, 
+1250, 620, 1762, 
+622, 866, 626, 
+1378, 628, 1890, 
+630, 994, 634, 
+1506, 636, 2018, 
+638, 1034, 644, 
+1546, 646, 1162, 
+652, 1674, 654, 
+778, 658, 1290, 
+660, 1802, 662, 
+906, 666, 1418, 
+668, 1930, 670, 
+1066, 676, 1578, 
+678, 1194, 684, 
+1706, 686, 810, 
+690, 1322, 692, 
+1834, 694, 938, 
+698, 1450, 700, 
+1962, 702, 1098, 
+708, 1610, 710, 
+1226, 716, 1738, 
+718, 842, 722, 
+1354, 724, 1866, 
+726, 970, 730, 
+1482, 732, 1994, 
+734, 1130, 740, 
+1642, 742, 1258, 
+748, 1770, 750, 
+874, 754, 1386, 
+756, 1898, 758, 
+1002, 762, 1514, 
+764, 2026, 766, 
+1042, 772, 1554, 
+774, 1170, 780, 
+1682, 782, 1298, 
+788, 1810, 790, 
+914, 794, 1426, 
+796, 1938, 798, 
+1074, 804, 1586, 
+806, 1202, 812, 
+1714, 814, 1330, 
+820, 1842, 822, 
+946, 826, 1458, 
+828, 1970, 830, 
+1106, 836, 1618, 
+838, 1234, 844, 
+1746, 846, 1362, 
+852, 1874, 854, 
+978, 858, 1490, 
+860, 2002, 862, 
+1138, 868, 1650, 
+870, 1266, 876, 
+1778, 878, 1394, 
+884, 1906, 886, 
+1010, 890, 1522, 
+892, 2034, 894, 
+1050, 900, 1562, 
+902, 1178, 908, 
+1690, 910, 1306, 
+916, 1818, 918, 
+1434, 924, 1946, 
+926, 1082, 932, 
+1594, 934, 1210, 
+940, 1722, 942, 
+1338, 948, 1850, 
+950, 1466, 956, 
+1978, 958, 1114, 
+964, 1626, 966, 
+1242, 972, 1754, 
+974, 1370, 980, 
+1882, 982, 1498, 
+988, 2010, 990, 
+1146, 996, 1658, 
+998, 1274, 1004, 
+1786, 1006, 1402, 
+1012, 1914, 1014, 
+1530, 1020, 2042, 
+1022, 1540, 1030, 
+1156, 1036, 1668, 
+1038, 1284, 1044, 
+1796, 1046, 1412, 
+1052, 1924, 1054, 
+1572, 1062, 1188, 
+1068, 1700, 1070, 
+1316, 1076, 1828, 
+1078, 1444, 1084, 
+1956, 1086, 1604, 
+1094, 1220, 1100, 
+1732, 1102, 1348, 
+1108, 1860, 1110, 
+1476, 1116, 1988, 
+1118, 1636, 1126, 
+1252, 1132, 1764, 
+1134, 1380, 1140, 
+1892, 1142, 1508, 
+1148, 2020, 1150, 
+1548, 1158, 1676, 
+1166, 1292, 1172, 
+1804, 1174, 1420, 
+1180, 1932, 1182, 
+1580, 1190, 1708, 
+1198, 1324, 1204, 
+1836, 1206, 1452, 
+1212, 1964, 1214, 
+1612, 1222, 1740, 
+1230, 1356, 1236, 
+1868, 1238, 1484, 
+1244, 1996, 1246, 
+1644, 1254, 1772, 
+1262, 1388, 1268, 
+1900, 1270, 1516, 
+1276, 2028, 1278, 
+1556, 1286, 1684, 
+1294, 1812, 1302, 
+1428, 1308, 1940, 
+1310, 1588, 1318, 
+1716, 1326, 1844, 
+1334, 1460, 1340, 
+1972, 1342, 1620, 
+1350, 1748, 1358, 
+1876, 1366, 1492, 
+1372, 2004, 1374, 
+1652, 1382, 1780, 
+1390, 1908, 1398, 
+1524, 1404, 2036, 
+1406, 1564, 1414, 
+1692, 1422, 1820, 
+1430, 1948, 1438, 
+1596, 1446, 1724, 
+1454, 1852, 1462, 
+1980, 1470, 1628, 
+1478, 1756, 1486, 
+1884, 1494, 2012, 
+1502, 1660, 1510, 
+1788, 1518, 1916, 
+1526, 2044, 1534, 
+1670, 1550, 1798, 
+1558, 1926, 1566, 
+1702, 1582, 1830, 
+1590, 1958, 1598, 
+1734, 1614, 1862, 
+1622, 1990, 1630, 
+1766, 1646, 1894, 
+1654, 2022, 1662, 
+1806, 1686, 1934, 
+1694, 1838, 1718, 
+1966, 1726, 1870, 
+1750, 1998, 1758, 
+1902, 1782, 2030, 
+1790, 1942, 1822, 
+1974, 1854, 2006, 
+1886, 2038, 1918, 
+};
+__ALIGNED(8) const uint16_t perm55[NB_PERM55]={
+2048, 4, 4, 
+512, 512, 16, 
+16, 128, 128, 
+64, 64, 32, 
+32, 256, 256, 
+8, 8, 1024, 
+1024, 2, 2560, 
+20, 20, 640, 
+640, 80, 80, 
+160, 160, 320, 
+320, 40, 40, 
+1280, 1280, 10, 
+10, 3072, 3072, 
+6, 1536, 18, 
+18, 2176, 2176, 
+68, 68, 544, 
+544, 272, 272, 
+136, 136, 1088, 
+1088, 34, 34, 
+2304, 2304, 12, 
+3584, 22, 22, 
+2688, 2688, 84, 
+84, 672, 672, 
+336, 336, 168, 
+168, 1344, 1344, 
+42, 42, 3328, 
+3328, 14, 1152, 
+66, 66, 2080, 
+2080, 260, 260, 
+520, 520, 1040, 
+1040, 130, 130, 
+2112, 2112, 36, 
+36, 768, 768, 
+24, 3200, 70, 
+70, 2592, 2592, 
+276, 276, 648, 
+648, 1104, 1104, 
+162, 162, 2368, 
+2368, 44, 44, 
+1792, 1792, 26, 
+1664, 82, 82, 
+2208, 2208, 324, 
+324, 552, 552, 
+1296, 1296, 138, 
+138, 3136, 3136, 
+38, 38, 2816, 
+2816, 28, 3712, 
+86, 86, 2720, 
+2720, 340, 340, 
+680, 680, 1360, 
+1360, 170, 170, 
+3392, 3392, 46, 
+46, 3840, 3840, 
+30, 384, 72, 
+72, 1056, 1056, 
+258, 258, 2056, 
+2056, 1028, 1028, 
+514, 514, 2064, 
+2064, 132, 132, 
+576, 576, 48, 
+2432, 76, 76, 
+1568, 1568, 274, 
+274, 2184, 2184, 
+1092, 1092, 546, 
+546, 2320, 2320, 
+140, 140, 1600, 
+1600, 50, 896, 
+88, 88, 1184, 
+1184, 322, 322, 
+2088, 2088, 1284, 
+1284, 522, 522, 
+3088, 3088, 134, 
+134, 2624, 2624, 
+52, 2944, 92, 
+92, 1696, 1696, 
+338, 338, 2216, 
+2216, 1348, 1348, 
+554, 554, 3344, 
+3344, 142, 142, 
+3648, 3648, 54, 
+1408, 74, 74, 
+3104, 3104, 262, 
+262, 2568, 2568, 
+1044, 1044, 642, 
+642, 2128, 2128, 
+164, 164, 832, 
+832, 56, 3456, 
+78, 78, 3616, 
+3616, 278, 278, 
+2696, 2696, 1108, 
+1108, 674, 674, 
+2384, 2384, 172, 
+172, 1856, 1856, 
+58, 1920, 90, 
+90, 3232, 3232, 
+326, 326, 2600, 
+2600, 1300, 1300, 
+650, 650, 3152, 
+3152, 166, 166, 
+2880, 2880, 60, 
+3968, 94, 94, 
+3744, 3744, 342, 
+342, 2728, 2728, 
+1364, 1364, 682, 
+682, 3408, 3408, 
+174, 174, 3904, 
+3904, 62, 288, 
+264, 264, 1032, 
+1032, 1026, 1026, 
+2050, 2050, 2052, 
+2052, 516, 516, 
+528, 528, 144, 
+144, 192, 192, 
+96, 2336, 268, 
+268, 1544, 1544, 
+1042, 1042, 2178, 
+2178, 2116, 2116, 
+548, 548, 784, 
+784, 152, 152, 
+1216, 1216, 98, 
+800, 280, 280, 
+1160, 1160, 1090, 
+1090, 2082, 2082, 
+2308, 2308, 524, 
+524, 1552, 1552, 
+146, 146, 2240, 
+2240, 100, 2848, 
+284, 284, 1672, 
+1672, 1106, 1106, 
+2210, 2210, 2372, 
+2372, 556, 556, 
+1808, 1808, 154, 
+154, 3264, 3264, 
+102, 1312, 266, 
+266, 3080, 3080, 
+1030, 1030, 2562, 
+2562, 2068, 2068, 
+644, 644, 592, 
+592, 176, 176, 
+448, 448, 104, 
+3360, 270, 270, 
+3592, 3592, 1046, 
+1046, 2690, 2690, 
+2132, 2132, 676, 
+676, 848, 848, 
+184, 184, 1472, 
+1472, 106, 1824, 
+282, 282, 3208, 
+3208, 1094, 1094, 
+2594, 2594, 2324, 
+2324, 652, 652, 
+1616, 1616, 178, 
+178, 2496, 2496, 
+108, 3872, 286, 
+286, 3720, 3720, 
+1110, 1110, 2722, 
+2722, 2388, 2388, 
+684, 684, 1872, 
+1872, 186, 186, 
+3520, 3520, 110, 
+416, 328, 328, 
+1064, 1064, 1282, 
+1282, 2058, 2058, 
+3076, 3076, 518, 
+518, 2576, 2576, 
+148, 148, 704, 
+704, 112, 2464, 
+332, 332, 1576, 
+1576, 1298, 1298, 
+2186, 2186, 3140, 
+3140, 550, 550, 
+2832, 2832, 156, 
+156, 1728, 1728, 
+114, 928, 344, 
+344, 1192, 1192, 
+1346, 1346, 2090, 
+2090, 3332, 3332, 
+526, 526, 3600, 
+3600, 150, 150, 
+2752, 2752, 116, 
+2976, 348, 348, 
+1704, 1704, 1362, 
+1362, 2218, 2218, 
+3396, 3396, 558, 
+558, 3856, 3856, 
+158, 158, 3776, 
+3776, 118, 1440, 
+330, 330, 3112, 
+3112, 1286, 1286, 
+2570, 2570, 3092, 
+3092, 646, 646, 
+2640, 2640, 180, 
+180, 960, 960, 
+120, 3488, 334, 
+334, 3624, 3624, 
+1302, 1302, 2698, 
+2698, 3156, 3156, 
+678, 678, 2896, 
+2896, 188, 188, 
+1984, 1984, 122, 
+1952, 346, 346, 
+3240, 3240, 1350, 
+1350, 2602, 2602, 
+3348, 3348, 654, 
+654, 3664, 3664, 
+182, 182, 3008, 
+3008, 124, 4000, 
+350, 350, 3752, 
+3752, 1366, 1366, 
+2730, 2730, 3412, 
+3412, 686, 686, 
+3920, 3920, 190, 
+190, 4032, 4032, 
+126, 2144, 292, 
+292, 776, 776, 
+1048, 1048, 1154, 
+1154, 2114, 2114, 
+2084, 2084, 772, 
+772, 536, 536, 
+1168, 1168, 194, 
+608, 304, 304, 
+392, 392, 1096, 
+1096, 1058, 1058, 
+2306, 2306, 2060, 
+2060, 1540, 1540, 
+530, 530, 2192, 
+2192, 196, 2656, 
+308, 308, 904, 
+904, 1112, 1112, 
+1186, 1186, 2370, 
+2370, 2092, 2092, 
+1796, 1796, 538, 
+538, 3216, 3216, 
+198, 1120, 290, 
+290, 2312, 2312, 
+1036, 1036, 1538, 
+1538, 2066, 2066, 
+2180, 2180, 580, 
+580, 560, 560, 
+400, 400, 200, 
+3168, 294, 294, 
+2824, 2824, 1052, 
+1052, 1666, 1666, 
+2130, 2130, 2212, 
+2212, 836, 836, 
+568, 568, 1424, 
+1424, 202, 1632, 
+306, 306, 2440, 
+2440, 1100, 1100, 
+1570, 1570, 2322, 
+2322, 2188, 2188, 
+1604, 1604, 562, 
+562, 2448, 2448, 
+204, 3680, 310, 
+310, 2952, 2952, 
+1116, 1116, 1698, 
+1698, 2386, 2386, 
+2220, 2220, 1860, 
+1860, 570, 570, 
+3472, 3472, 206, 
+224, 352, 352, 
+296, 296, 1288, 
+1288, 1034, 1034, 
+3074, 3074, 2054, 
+2054, 2564, 2564, 
+532, 532, 656, 
+656, 208, 2272, 
+356, 356, 808, 
+808, 1304, 1304, 
+1162, 1162, 3138, 
+3138, 2086, 2086, 
+2820, 2820, 540, 
+540, 1680, 1680, 
+210, 736, 368, 
+368, 424, 424, 
+1352, 1352, 1066, 
+1066, 3330, 3330, 
+2062, 2062, 3588, 
+3588, 534, 534, 
+2704, 2704, 212, 
+2784, 372, 372, 
+936, 936, 1368, 
+1368, 1194, 1194, 
+3394, 3394, 2094, 
+2094, 3844, 3844, 
+542, 542, 3728, 
+3728, 214, 1248, 
+354, 354, 2344, 
+2344, 1292, 1292, 
+1546, 1546, 3090, 
+3090, 2182, 2182, 
+2628, 2628, 564, 
+564, 912, 912, 
+216, 3296, 358, 
+358, 2856, 2856, 
+1308, 1308, 1674, 
+1674, 3154, 3154, 
+2214, 2214, 2884, 
+2884, 572, 572, 
+1936, 1936, 218, 
+1760, 370, 370, 
+2472, 2472, 1356, 
+1356, 1578, 1578, 
+3346, 3346, 2190, 
+2190, 3652, 3652, 
+566, 566, 2960, 
+2960, 220, 3808, 
+374, 374, 2984, 
+2984, 1372, 1372, 
+1706, 1706, 3410, 
+3410, 2222, 2222, 
+3908, 3908, 574, 
+574, 3984, 3984, 
+222, 2400, 300, 
+300, 1800, 1800, 
+1050, 1050, 3202, 
+3202, 2118, 2118, 
+2596, 2596, 788, 
+788, 664, 664, 
+1232, 1232, 226, 
+864, 312, 312, 
+1416, 1416, 1098, 
+1098, 3106, 3106, 
+2310, 2310, 2572, 
+2572, 1556, 1556, 
+658, 658, 2256, 
+2256, 228, 2912, 
+316, 316, 1928, 
+1928, 1114, 1114, 
+3234, 3234, 2374, 
+2374, 2604, 2604, 
+1812, 1812, 666, 
+666, 3280, 3280, 
+230, 1376, 298, 
+298, 3336, 3336, 
+1038, 1038, 3586, 
+3586, 2070, 2070, 
+2692, 2692, 596, 
+596, 688, 688, 
+464, 464, 232, 
+3424, 302, 302, 
+3848, 3848, 1054, 
+1054, 3714, 3714, 
+2134, 2134, 2724, 
+2724, 852, 852, 
+696, 696, 1488, 
+1488, 234, 1888, 
+314, 314, 3464, 
+3464, 1102, 1102, 
+3618, 3618, 2326, 
+2326, 2700, 2700, 
+1620, 1620, 690, 
+690, 2512, 2512, 
+236, 3936, 318, 
+318, 3976, 3976, 
+1118, 1118, 3746, 
+3746, 2390, 2390, 
+2732, 2732, 1876, 
+1876, 698, 698, 
+3536, 3536, 238, 
+480, 360, 360, 
+1320, 1320, 1290, 
+1290, 3082, 3082, 
+3078, 3078, 2566, 
+2566, 2580, 2580, 
+660, 660, 720, 
+720, 240, 2528, 
+364, 364, 1832, 
+1832, 1306, 1306, 
+3210, 3210, 3142, 
+3142, 2598, 2598, 
+2836, 2836, 668, 
+668, 1744, 1744, 
+242, 992, 376, 
+376, 1448, 1448, 
+1354, 1354, 3114, 
+3114, 3334, 3334, 
+2574, 2574, 3604, 
+3604, 662, 662, 
+2768, 2768, 244, 
+3040, 380, 380, 
+1960, 1960, 1370, 
+1370, 3242, 3242, 
+3398, 3398, 2606, 
+2606, 3860, 3860, 
+670, 670, 3792, 
+3792, 246, 1504, 
+362, 362, 3368, 
+3368, 1294, 1294, 
+3594, 3594, 3094, 
+3094, 2694, 2694, 
+2644, 2644, 692, 
+692, 976, 976, 
+248, 3552, 366, 
+366, 3880, 3880, 
+1310, 1310, 3722, 
+3722, 3158, 3158, 
+2726, 2726, 2900, 
+2900, 700, 700, 
+2000, 2000, 250, 
+2016, 378, 378, 
+3496, 3496, 1358, 
+1358, 3626, 3626, 
+3350, 3350, 2702, 
+2702, 3668, 3668, 
+694, 694, 3024, 
+3024, 252, 4064, 
+382, 382, 4008, 
+4008, 1374, 1374, 
+3754, 3754, 3414, 
+3414, 2734, 2734, 
+3924, 3924, 702, 
+702, 4048, 4048, 
+254, 2120, 1060, 
+1060, 770, 770, 
+2072, 2072, 1156, 
+1156, 578, 578, 
+2096, 2096, 388, 
+388, 584, 584, 
+1072, 1072, 386, 
+2632, 1076, 1076, 
+898, 898, 2136, 
+2136, 1188, 1188, 
+834, 834, 2104, 
+2104, 1412, 1412, 
+586, 586, 3120, 
+3120, 390, 3144, 
+1062, 1062, 2818, 
+2818, 2076, 2076, 
+1668, 1668, 594, 
+594, 2224, 2224, 
+452, 452, 616, 
+616, 1328, 1328, 
+394, 1608, 1074, 
+1074, 2434, 2434, 
+2124, 2124, 1572, 
+1572, 786, 786, 
+2200, 2200, 1220, 
+1220, 610, 610, 
+2352, 2352, 396, 
+3656, 1078, 1078, 
+2946, 2946, 2140, 
+2140, 1700, 1700, 
+850, 850, 2232, 
+2232, 1476, 1476, 
+618, 618, 3376, 
+3376, 398, 2248, 
+1124, 1124, 802, 
+802, 2328, 2328, 
+1164, 1164, 1602, 
+1602, 2098, 2098, 
+2436, 2436, 588, 
+588, 1584, 1584, 
+402, 712, 1136, 
+1136, 418, 418, 
+2376, 2376, 1068, 
+1068, 1794, 1794, 
+2074, 2074, 3204, 
+3204, 582, 582, 
+2608, 2608, 404, 
+2760, 1140, 1140, 
+930, 930, 2392, 
+2392, 1196, 1196, 
+1858, 1858, 2106, 
+2106, 3460, 3460, 
+590, 590, 3632, 
+3632, 406, 1224, 
+1122, 1122, 2338, 
+2338, 2316, 2316, 
+1548, 1548, 1554, 
+1554, 2194, 2194, 
+2244, 2244, 612, 
+612, 816, 816, 
+408, 3272, 1126, 
+1126, 2850, 2850, 
+2332, 2332, 1676, 
+1676, 1618, 1618, 
+2226, 2226, 2500, 
+2500, 620, 620, 
+1840, 1840, 410, 
+1736, 1138, 1138, 
+2466, 2466, 2380, 
+2380, 1580, 1580, 
+1810, 1810, 2202, 
+2202, 3268, 3268, 
+614, 614, 2864, 
+2864, 412, 3784, 
+1142, 1142, 2978, 
+2978, 2396, 2396, 
+1708, 1708, 1874, 
+1874, 2234, 2234, 
+3524, 3524, 622, 
+622, 3888, 3888, 
+414, 840, 1080, 
+1080, 1410, 1410, 
+2122, 2122, 3108, 
+3108, 774, 774, 
+2584, 2584, 1172, 
+1172, 706, 706, 
+2160, 2160, 420, 
+2888, 1084, 1084, 
+1922, 1922, 2138, 
+2138, 3236, 3236, 
+838, 838, 2616, 
+2616, 1428, 1428, 
+714, 714, 3184, 
+3184, 422, 3400, 
+1070, 1070, 3842, 
+3842, 2078, 2078, 
+3716, 3716, 598, 
+598, 2736, 2736, 
+468, 468, 744, 
+744, 1392, 1392, 
+426, 1864, 1082, 
+1082, 3458, 3458, 
+2126, 2126, 3620, 
+3620, 790, 790, 
+2712, 2712, 1236, 
+1236, 738, 738, 
+2416, 2416, 428, 
+3912, 1086, 1086, 
+3970, 3970, 2142, 
+2142, 3748, 3748, 
+854, 854, 2744, 
+2744, 1492, 1492, 
+746, 746, 3440, 
+3440, 430, 456, 
+1128, 1128, 1314, 
+1314, 2314, 2314, 
+3084, 3084, 1542, 
+1542, 2578, 2578, 
+2196, 2196, 708, 
+708, 624, 624, 
+432, 2504, 1132, 
+1132, 1826, 1826, 
+2330, 2330, 3212, 
+3212, 1606, 1606, 
+2610, 2610, 2452, 
+2452, 716, 716, 
+1648, 1648, 434, 
+968, 1144, 1144, 
+1442, 1442, 2378, 
+2378, 3116, 3116, 
+1798, 1798, 2586, 
+2586, 3220, 3220, 
+710, 710, 2672, 
+2672, 436, 3016, 
+1148, 1148, 1954, 
+1954, 2394, 2394, 
+3244, 3244, 1862, 
+1862, 2618, 2618, 
+3476, 3476, 718, 
+718, 3696, 3696, 
+438, 1480, 1130, 
+1130, 3362, 3362, 
+2318, 2318, 3596, 
+3596, 1558, 1558, 
+2706, 2706, 2260, 
+2260, 740, 740, 
+880, 880, 440, 
+3528, 1134, 1134, 
+3874, 3874, 2334, 
+2334, 3724, 3724, 
+1622, 1622, 2738, 
+2738, 2516, 2516, 
+748, 748, 1904, 
+1904, 442, 1992, 
+1146, 1146, 3490, 
+3490, 2382, 2382, 
+3628, 3628, 1814, 
+1814, 2714, 2714, 
+3284, 3284, 742, 
+742, 2928, 2928, 
+444, 4040, 1150, 
+1150, 4002, 4002, 
+2398, 2398, 3756, 
+3756, 1878, 1878, 
+2746, 2746, 3540, 
+3540, 750, 750, 
+3952, 3952, 446, 
+2152, 1316, 1316, 
+778, 778, 3096, 
+3096, 1158, 1158, 
+2626, 2626, 2100, 
+2100, 900, 900, 
+600, 600, 1200, 
+1200, 450, 2664, 
+1332, 1332, 906, 
+906, 3160, 3160, 
+1190, 1190, 2882, 
+2882, 2108, 2108, 
+1924, 1924, 602, 
+602, 3248, 3248, 
+454, 3176, 1318, 
+1318, 2826, 2826, 
+3100, 3100, 1670, 
+1670, 2642, 2642, 
+2228, 2228, 964, 
+964, 632, 632, 
+1456, 1456, 458, 
+1640, 1330, 1330, 
+2442, 2442, 3148, 
+3148, 1574, 1574, 
+2834, 2834, 2204, 
+2204, 1732, 1732, 
+626, 626, 2480, 
+2480, 460, 3688, 
+1334, 1334, 2954, 
+2954, 3164, 3164, 
+1702, 1702, 2898, 
+2898, 2236, 2236, 
+1988, 1988, 634, 
+634, 3504, 3504, 
+462, 2280, 1380, 
+1380, 810, 810, 
+3352, 3352, 1166, 
+1166, 3650, 3650, 
+2102, 2102, 2948, 
+2948, 604, 604, 
+1712, 1712, 466, 
+2792, 1396, 1396, 
+938, 938, 3416, 
+3416, 1198, 1198, 
+3906, 3906, 2110, 
+2110, 3972, 3972, 
+606, 606, 3760, 
+3760, 470, 1256, 
+1378, 1378, 2346, 
+2346, 3340, 3340, 
+1550, 1550, 3602, 
+3602, 2198, 2198, 
+2756, 2756, 628, 
+628, 944, 944, 
+472, 3304, 1382, 
+1382, 2858, 2858, 
+3356, 3356, 1678, 
+1678, 3666, 3666, 
+2230, 2230, 3012, 
+3012, 636, 636, 
+1968, 1968, 474, 
+1768, 1394, 1394, 
+2474, 2474, 3404, 
+3404, 1582, 1582, 
+3858, 3858, 2206, 
+2206, 3780, 3780, 
+630, 630, 2992, 
+2992, 476, 3816, 
+1398, 1398, 2986, 
+2986, 3420, 3420, 
+1710, 1710, 3922, 
+3922, 2238, 2238, 
+4036, 4036, 638, 
+638, 4016, 4016, 
+478, 2408, 1324, 
+1324, 1802, 1802, 
+3098, 3098, 3206, 
+3206, 2630, 2630, 
+2612, 2612, 916, 
+916, 728, 728, 
+1264, 1264, 482, 
+872, 1336, 1336, 
+1418, 1418, 3146, 
+3146, 3110, 3110, 
+2822, 2822, 2588, 
+2588, 1684, 1684, 
+722, 722, 2288, 
+2288, 484, 2920, 
+1340, 1340, 1930, 
+1930, 3162, 3162, 
+3238, 3238, 2886, 
+2886, 2620, 2620, 
+1940, 1940, 730, 
+730, 3312, 3312, 
+486, 1384, 1322, 
+1322, 3338, 3338, 
+3086, 3086, 3590, 
+3590, 2582, 2582, 
+2708, 2708, 724, 
+724, 752, 752, 
+496, 496, 488, 
+3432, 1326, 1326, 
+3850, 3850, 3102, 
+3102, 3718, 3718, 
+2646, 2646, 2740, 
+2740, 980, 980, 
+760, 760, 1520, 
+1520, 490, 1896, 
+1338, 1338, 3466, 
+3466, 3150, 3150, 
+3622, 3622, 2838, 
+2838, 2716, 2716, 
+1748, 1748, 754, 
+754, 2544, 2544, 
+492, 3944, 1342, 
+1342, 3978, 3978, 
+3166, 3166, 3750, 
+3750, 2902, 2902, 
+2748, 2748, 2004, 
+2004, 762, 762, 
+3568, 3568, 494, 
+2536, 1388, 1388, 
+1834, 1834, 3354, 
+3354, 3214, 3214, 
+3654, 3654, 2614, 
+2614, 2964, 2964, 
+732, 732, 1776, 
+1776, 498, 1000, 
+1400, 1400, 1450, 
+1450, 3402, 3402, 
+3118, 3118, 3846, 
+3846, 2590, 2590, 
+3732, 3732, 726, 
+726, 2800, 2800, 
+500, 3048, 1404, 
+1404, 1962, 1962, 
+3418, 3418, 3246, 
+3246, 3910, 3910, 
+2622, 2622, 3988, 
+3988, 734, 734, 
+3824, 3824, 502, 
+1512, 1386, 1386, 
+3370, 3370, 3342, 
+3342, 3598, 3598, 
+3606, 3606, 2710, 
+2710, 2772, 2772, 
+756, 756, 1008, 
+1008, 504, 3560, 
+1390, 1390, 3882, 
+3882, 3358, 3358, 
+3726, 3726, 3670, 
+3670, 2742, 2742, 
+3028, 3028, 764, 
+764, 2032, 2032, 
+506, 2024, 1402, 
+1402, 3498, 3498, 
+3406, 3406, 3630, 
+3630, 3862, 3862, 
+2718, 2718, 3796, 
+3796, 758, 758, 
+3056, 3056, 508, 
+4072, 1406, 1406, 
+4010, 4010, 3422, 
+3422, 3758, 3758, 
+3926, 3926, 2750, 
+2750, 4052, 4052, 
+766, 766, 4080, 
+4080, 510, 1560, 
+1170, 1170, 2242, 
+2242, 2148, 2148, 
+804, 804, 792, 
+792, 1176, 1176, 
+1218, 1218, 2146, 
+2146, 2340, 2340, 
+780, 3608, 1174, 
+1174, 2754, 2754, 
+2164, 2164, 932, 
+932, 856, 856, 
+1208, 1208, 1474, 
+1474, 2154, 2154, 
+3364, 3364, 782, 
+3224, 1222, 1222, 
+2658, 2658, 2356, 
+2356, 908, 908, 
+1624, 1624, 1202, 
+1202, 2498, 2498, 
+2156, 2156, 1828, 
+1828, 794, 1688, 
+1234, 1234, 2274, 
+2274, 2404, 2404, 
+812, 812, 1816, 
+1816, 1178, 1178, 
+3266, 3266, 2150, 
+2150, 2852, 2852, 
+796, 3736, 1238, 
+1238, 2786, 2786, 
+2420, 2420, 940, 
+940, 1880, 1880, 
+1210, 1210, 3522, 
+3522, 2158, 2158, 
+3876, 3876, 798, 
+2840, 1180, 1180, 
+1730, 1730, 2162, 
+2162, 2468, 2468, 
+844, 844, 1592, 
+1592, 1426, 1426, 
+2250, 2250, 3172, 
+3172, 806, 3864, 
+1182, 1182, 3778, 
+3778, 2166, 2166, 
+2980, 2980, 860, 
+860, 1720, 1720, 
+1490, 1490, 2282, 
+2282, 3428, 3428, 
+814, 2456, 1228, 
+1228, 1634, 1634, 
+2354, 2354, 2444, 
+2444, 1612, 1612, 
+1586, 1586, 2450, 
+2450, 2252, 2252, 
+1636, 1636, 818, 
+920, 1240, 1240, 
+1250, 1250, 2402, 
+2402, 2348, 2348, 
+1804, 1804, 1562, 
+1562, 3218, 3218, 
+2246, 2246, 2660, 
+2660, 820, 2968, 
+1244, 1244, 1762, 
+1762, 2418, 2418, 
+2476, 2476, 1868, 
+1868, 1594, 1594, 
+3474, 3474, 2254, 
+2254, 3684, 3684, 
+822, 1432, 1226, 
+1226, 3170, 3170, 
+2342, 2342, 2828, 
+2828, 1564, 1564, 
+1682, 1682, 2258, 
+2258, 2276, 2276, 
+868, 868, 824, 
+3480, 1230, 1230, 
+3682, 3682, 2358, 
+2358, 2956, 2956, 
+1628, 1628, 1714, 
+1714, 2514, 2514, 
+2284, 2284, 1892, 
+1892, 826, 1944, 
+1242, 1242, 3298, 
+3298, 2406, 2406, 
+2860, 2860, 1820, 
+1820, 1690, 1690, 
+3282, 3282, 2278, 
+2278, 2916, 2916, 
+828, 3992, 1246, 
+1246, 3810, 3810, 
+2422, 2422, 2988, 
+2988, 1884, 1884, 
+1722, 1722, 3538, 
+3538, 2286, 2286, 
+3940, 3940, 830, 
+3128, 1414, 1414, 
+2634, 2634, 3124, 
+3124, 902, 902, 
+2648, 2648, 1204, 
+1204, 962, 962, 
+2168, 2168, 1444, 
+1444, 842, 3640, 
+1430, 1430, 2762, 
+2762, 3188, 3188, 
+934, 934, 2904, 
+2904, 1212, 1212, 
+1986, 1986, 2170, 
+2170, 3492, 3492, 
+846, 3256, 1478, 
+1478, 2666, 2666, 
+3380, 3380, 910, 
+910, 3672, 3672, 
+1206, 1206, 3010, 
+3010, 2172, 2172, 
+1956, 1956, 858, 
+3768, 1494, 1494, 
+2794, 2794, 3444, 
+3444, 942, 942, 
+3928, 3928, 1214, 
+1214, 4034, 4034, 
+2174, 2174, 4004, 
+4004, 862, 2360, 
+1420, 1420, 1610, 
+1610, 3122, 3122, 
+2438, 2438, 2636, 
+2636, 1588, 1588, 
+914, 914, 2264, 
+2264, 1252, 1252, 
+866, 2872, 1436, 
+1436, 1738, 1738, 
+3186, 3186, 2470, 
+2470, 2892, 2892, 
+1596, 1596, 1938, 
+1938, 2266, 2266, 
+3300, 3300, 870, 
+3384, 1422, 1422, 
+3658, 3658, 3126, 
+3126, 2950, 2950, 
+2652, 2652, 1716, 
+1716, 978, 978, 
+2296, 2296, 1508, 
+1508, 874, 1848, 
+1434, 1434, 3274, 
+3274, 3174, 3174, 
+2854, 2854, 2844, 
+2844, 1692, 1692, 
+1746, 1746, 2290, 
+2290, 2532, 2532, 
+876, 3896, 1438, 
+1438, 3786, 3786, 
+3190, 3190, 2982, 
+2982, 2908, 2908, 
+1724, 1724, 2002, 
+2002, 2298, 2298, 
+3556, 3556, 878, 
+2488, 1484, 1484, 
+1642, 1642, 3378, 
+3378, 2446, 2446, 
+3660, 3660, 1590, 
+1590, 2962, 2962, 
+2268, 2268, 1764, 
+1764, 882, 952, 
+1496, 1496, 1258, 
+1258, 3426, 3426, 
+2350, 2350, 3852, 
+3852, 1566, 1566, 
+3730, 3730, 2262, 
+2262, 2788, 2788, 
+884, 3000, 1500, 
+1500, 1770, 1770, 
+3442, 3442, 2478, 
+2478, 3916, 3916, 
+1598, 1598, 3986, 
+3986, 2270, 2270, 
+3812, 3812, 886, 
+1464, 1482, 1482, 
+3178, 3178, 3366, 
+3366, 2830, 2830, 
+3612, 3612, 1686, 
+1686, 2770, 2770, 
+2292, 2292, 996, 
+996, 888, 3512, 
+1486, 1486, 3690, 
+3690, 3382, 3382, 
+2958, 2958, 3676, 
+3676, 1718, 1718, 
+3026, 3026, 2300, 
+2300, 2020, 2020, 
+890, 1976, 1498, 
+1498, 3306, 3306, 
+3430, 3430, 2862, 
+2862, 3868, 3868, 
+1694, 1694, 3794, 
+3794, 2294, 2294, 
+3044, 3044, 892, 
+4024, 1502, 1502, 
+3818, 3818, 3446, 
+3446, 2990, 2990, 
+3932, 3932, 1726, 
+1726, 4050, 4050, 
+2302, 2302, 4068, 
+4068, 894, 2776, 
+1268, 1268, 994, 
+994, 2424, 2424, 
+1452, 1452, 1866, 
+1866, 3130, 3130, 
+3462, 3462, 2638, 
+2638, 3636, 3636, 
+918, 3288, 1254, 
+1254, 2914, 2914, 
+2364, 2364, 1932, 
+1932, 1626, 1626, 
+3250, 3250, 2502, 
+2502, 2668, 2668, 
+1844, 1844, 922, 
+1752, 1266, 1266, 
+2530, 2530, 2412, 
+2412, 1836, 1836, 
+1818, 1818, 3226, 
+3226, 3270, 3270, 
+2662, 2662, 2868, 
+2868, 924, 3800, 
+1270, 1270, 3042, 
+3042, 2428, 2428, 
+1964, 1964, 1882, 
+1882, 3258, 3258, 
+3526, 3526, 2670, 
+2670, 3892, 3892, 
+926, 2520, 1260, 
+1260, 1890, 1890, 
+2362, 2362, 3468, 
+3468, 1614, 1614, 
+3634, 3634, 2454, 
+2454, 2764, 2764, 
+1652, 1652, 946, 
+984, 1272, 1272, 
+1506, 1506, 2410, 
+2410, 3372, 3372, 
+1806, 1806, 3610, 
+3610, 3222, 3222, 
+2758, 2758, 2676, 
+2676, 948, 3032, 
+1276, 1276, 2018, 
+2018, 2426, 2426, 
+3500, 3500, 1870, 
+1870, 3642, 3642, 
+3478, 3478, 2766, 
+2766, 3700, 3700, 
+950, 3544, 1262, 
+1262, 3938, 3938, 
+2366, 2366, 3980, 
+3980, 1630, 1630, 
+3762, 3762, 2518, 
+2518, 2796, 2796, 
+1908, 1908, 954, 
+2008, 1274, 1274, 
+3554, 3554, 2414, 
+2414, 3884, 3884, 
+1822, 1822, 3738, 
+3738, 3286, 3286, 
+2790, 2790, 2932, 
+2932, 956, 4056, 
+1278, 1278, 4066, 
+4066, 2430, 2430, 
+4012, 4012, 1886, 
+1886, 3770, 3770, 
+3542, 3542, 2798, 
+2798, 3956, 3956, 
+958, 2680, 1460, 
+1460, 970, 970, 
+3192, 3192, 1446, 
+1446, 2890, 2890, 
+3132, 3132, 1926, 
+1926, 2650, 2650, 
+3252, 3252, 966, 
+1656, 1458, 1458, 
+2506, 2506, 3180, 
+3180, 1830, 1830, 
+2842, 2842, 3228, 
+3228, 1734, 1734, 
+2674, 2674, 2484, 
+2484, 972, 3704, 
+1462, 1462, 3018, 
+3018, 3196, 3196, 
+1958, 1958, 2906, 
+2906, 3260, 3260, 
+1990, 1990, 2682, 
+2682, 3508, 3508, 
+974, 2808, 1524, 
+1524, 1002, 1002, 
+3448, 3448, 1454, 
+1454, 3914, 3914, 
+3134, 3134, 3974, 
+3974, 2654, 2654, 
+3764, 3764, 982, 
+3320, 1510, 1510, 
+2922, 2922, 3388, 
+3388, 1934, 1934, 
+3674, 3674, 3254, 
+3254, 3014, 3014, 
+2684, 2684, 1972, 
+1972, 986, 1784, 
+1522, 1522, 2538, 
+2538, 3436, 3436, 
+1838, 1838, 3866, 
+3866, 3230, 3230, 
+3782, 3782, 2678, 
+2678, 2996, 2996, 
+988, 3832, 1526, 
+1526, 3050, 3050, 
+3452, 3452, 1966, 
+1966, 3930, 3930, 
+3262, 3262, 4038, 
+4038, 2686, 2686, 
+4020, 4020, 990, 
+2936, 1468, 1468, 
+1994, 1994, 3194, 
+3194, 3494, 3494, 
+2894, 2894, 3644, 
+3644, 1942, 1942, 
+2778, 2778, 3316, 
+3316, 998, 1912, 
+1466, 1466, 3530, 
+3530, 3182, 3182, 
+3878, 3878, 2846, 
+2846, 3740, 3740, 
+1750, 1750, 2802, 
+2802, 2548, 2548, 
+1004, 3960, 1470, 
+1470, 4042, 4042, 
+3198, 3198, 4006, 
+4006, 2910, 2910, 
+3772, 3772, 2006, 
+2006, 2810, 2810, 
+3572, 3572, 1006, 
+2552, 1516, 1516, 
+1898, 1898, 3386, 
+3386, 3470, 3470, 
+3662, 3662, 3638, 
+3638, 2966, 2966, 
+2780, 2780, 1780, 
+1780, 1010, 1016, 
+1528, 1528, 1514, 
+1514, 3434, 3434, 
+3374, 3374, 3854, 
+3854, 3614, 3614, 
+3734, 3734, 2774, 
+2774, 2804, 2804, 
+1012, 3064, 1532, 
+1532, 2026, 2026, 
+3450, 3450, 3502, 
+3502, 3918, 3918, 
+3646, 3646, 3990, 
+3990, 2782, 2782, 
+3828, 3828, 1014, 
+3576, 1518, 1518, 
+3946, 3946, 3390, 
+3390, 3982, 3982, 
+3678, 3678, 3766, 
+3766, 3030, 3030, 
+2812, 2812, 2036, 
+2036, 1018, 2040, 
+1530, 1530, 3562, 
+3562, 3438, 3438, 
+3886, 3886, 3870, 
+3870, 3742, 3742, 
+3798, 3798, 2806, 
+2806, 3060, 3060, 
+1020, 4088, 1534, 
+1534, 4074, 4074, 
+3454, 3454, 4014, 
+4014, 3934, 3934, 
+3774, 3774, 4054, 
+4054, 2814, 2814, 
+4084, 4084, 1022, 
+2866, 2460, 2460, 
+1740, 1740, 1650, 
+1650, 2482, 2482, 
+2508, 2508, 1644, 
+1644, 1842, 1842, 
+2458, 2458, 3276, 
+3276, 1638, 3890, 
+2462, 2462, 3788, 
+3788, 1654, 1654, 
+2994, 2994, 2524, 
+2524, 1772, 1772, 
+1906, 1906, 2490, 
+2490, 3532, 3532, 
+1646, 3506, 2510, 
+2510, 3692, 3692, 
+1846, 1846, 2970, 
+2970, 3292, 3292, 
+1766, 1766, 2930, 
+2930, 2492, 2492, 
+1996, 1996, 1658, 
+1970, 2522, 2522, 
+3308, 3308, 1894, 
+1894, 2874, 2874, 
+3484, 3484, 1742, 
+1742, 3698, 3698, 
+2486, 2486, 3020, 
+3020, 1660, 4018, 
+2526, 2526, 3820, 
+3820, 1910, 1910, 
+3002, 3002, 3548, 
+3548, 1774, 1774, 
+3954, 3954, 2494, 
+2494, 4044, 4044, 
+1662, 3314, 2534, 
+2534, 2924, 2924, 
+1852, 1852, 1946, 
+1946, 3290, 3290, 
+3302, 3302, 2918, 
+2918, 2876, 2876, 
+1948, 1948, 1754, 
+1778, 2546, 2546, 
+2540, 2540, 1900, 
+1900, 1850, 1850, 
+3482, 3482, 3278, 
+3278, 3686, 3686, 
+2870, 2870, 2972, 
+2972, 1756, 3826, 
+2550, 2550, 3052, 
+3052, 1916, 1916, 
+1978, 1978, 3546, 
+3546, 3310, 3310, 
+3942, 3942, 2878, 
+2878, 3996, 3996, 
+1758, 3058, 2556, 
+2556, 2028, 2028, 
+1914, 1914, 3514, 
+3514, 3534, 3534, 
+3694, 3694, 3894, 
+3894, 2974, 2974, 
+3804, 3804, 1782, 
+3570, 2542, 2542, 
+3948, 3948, 1854, 
+1854, 3994, 3994, 
+3294, 3294, 3814, 
+3814, 2934, 2934, 
+3004, 3004, 2012, 
+2012, 1786, 2034, 
+2554, 2554, 3564, 
+3564, 1902, 1902, 
+3898, 3898, 3486, 
+3486, 3790, 3790, 
+3702, 3702, 2998, 
+2998, 3036, 3036, 
+1788, 4082, 2558, 
+2558, 4076, 4076, 
+1918, 1918, 4026, 
+4026, 3550, 3550, 
+3822, 3822, 3958, 
+3958, 3006, 3006, 
+4060, 4060, 1790, 
+3802, 3318, 3318, 
+3046, 3046, 2940, 
+2940, 1980, 1980, 
+2010, 2010, 3322, 
+3322, 3558, 3558, 
+2926, 2926, 3900, 
+3900, 1950, 3034, 
+3324, 3324, 2022, 
+2022, 2938, 2938, 
+3516, 3516, 1998, 
+1998, 3706, 3706, 
+3510, 3510, 3022, 
+3022, 3708, 3708, 
+1974, 4058, 3326, 
+3326, 4070, 4070, 
+2942, 2942, 4028, 
+4028, 2014, 2014, 
+3834, 3834, 3574, 
+3574, 3054, 3054, 
+3964, 3964, 1982, 
+3962, 3518, 3518, 
+4046, 4046, 3710, 
+3710, 4022, 4022, 
+3038, 3038, 3836, 
+3836, 2038, 2038, 
+3066, 3066, 3580, 
+3580, 2030, 3578, 
+3566, 3566, 3950, 
+3950, 3902, 3902, 
+3998, 3998, 3806, 
+3806, 3830, 3830, 
+3062, 3062, 3068, 
+3068, 2044, 2044, 
+2042, 4090, 3582, 
+3582, 4078, 4078, 
+3966, 3966, 4030, 
+4030, 4062, 4062, 
+3838, 3838, 4086, 
+4086, 3070, 3070, 
+4092, 4092, 2046, 
+};
+__ALIGNED(8) const uint16_t perm56[NB_PERM56]={
+2048, 2, 4096, 
+4, 6144, 6, 
+512, 8, 2560, 
+10, 4608, 12, 
+6656, 14, 1024, 
+16, 3072, 18, 
+5120, 20, 7168, 
+22, 1536, 24, 
+3584, 26, 5632, 
+28, 7680, 30, 
+128, 32, 2176, 
+34, 4224, 36, 
+6272, 38, 640, 
+40, 2688, 42, 
+4736, 44, 6784, 
+46, 1152, 48, 
+3200, 50, 5248, 
+52, 7296, 54, 
+1664, 56, 3712, 
+58, 5760, 60, 
+7808, 62, 256, 
+64, 2304, 66, 
+4352, 68, 6400, 
+70, 768, 72, 
+2816, 74, 4864, 
+76, 6912, 78, 
+1280, 80, 3328, 
+82, 5376, 84, 
+7424, 86, 1792, 
+88, 3840, 90, 
+5888, 92, 7936, 
+94, 384, 96, 
+2432, 98, 4480, 
+100, 6528, 102, 
+896, 104, 2944, 
+106, 4992, 108, 
+7040, 110, 1408, 
+112, 3456, 114, 
+5504, 116, 7552, 
+118, 1920, 120, 
+3968, 122, 6016, 
+124, 8064, 126, 
+2080, 130, 4128, 
+132, 6176, 134, 
+544, 136, 2592, 
+138, 4640, 140, 
+6688, 142, 1056, 
+144, 3104, 146, 
+5152, 148, 7200, 
+150, 1568, 152, 
+3616, 154, 5664, 
+156, 7712, 158, 
+2208, 162, 4256, 
+164, 6304, 166, 
+672, 168, 2720, 
+170, 4768, 172, 
+6816, 174, 1184, 
+176, 3232, 178, 
+5280, 180, 7328, 
+182, 1696, 184, 
+3744, 186, 5792, 
+188, 7840, 190, 
+288, 192, 2336, 
+194, 4384, 196, 
+6432, 198, 800, 
+200, 2848, 202, 
+4896, 204, 6944, 
+206, 1312, 208, 
+3360, 210, 5408, 
+212, 7456, 214, 
+1824, 216, 3872, 
+218, 5920, 220, 
+7968, 222, 416, 
+224, 2464, 226, 
+4512, 228, 6560, 
+230, 928, 232, 
+2976, 234, 5024, 
+236, 7072, 238, 
+1440, 240, 3488, 
+242, 5536, 244, 
+7584, 246, 1952, 
+248, 4000, 250, 
+6048, 252, 8096, 
+254, 2112, 258, 
+4160, 260, 6208, 
+262, 576, 264, 
+2624, 266, 4672, 
+268, 6720, 270, 
+1088, 272, 3136, 
+274, 5184, 276, 
+7232, 278, 1600, 
+280, 3648, 282, 
+5696, 284, 7744, 
+286, 2240, 290, 
+4288, 292, 6336, 
+294, 704, 296, 
+2752, 298, 4800, 
+300, 6848, 302, 
+1216, 304, 3264, 
+306, 5312, 308, 
+7360, 310, 1728, 
+312, 3776, 314, 
+5824, 316, 7872, 
+318, 2368, 322, 
+4416, 324, 6464, 
+326, 832, 328, 
+2880, 330, 4928, 
+332, 6976, 334, 
+1344, 336, 3392, 
+338, 5440, 340, 
+7488, 342, 1856, 
+344, 3904, 346, 
+5952, 348, 8000, 
+350, 448, 352, 
+2496, 354, 4544, 
+356, 6592, 358, 
+960, 360, 3008, 
+362, 5056, 364, 
+7104, 366, 1472, 
+368, 3520, 370, 
+5568, 372, 7616, 
+374, 1984, 376, 
+4032, 378, 6080, 
+380, 8128, 382, 
+2144, 386, 4192, 
+388, 6240, 390, 
+608, 392, 2656, 
+394, 4704, 396, 
+6752, 398, 1120, 
+400, 3168, 402, 
+5216, 404, 7264, 
+406, 1632, 408, 
+3680, 410, 5728, 
+412, 7776, 414, 
+2272, 418, 4320, 
+420, 6368, 422, 
+736, 424, 2784, 
+426, 4832, 428, 
+6880, 430, 1248, 
+432, 3296, 434, 
+5344, 436, 7392, 
+438, 1760, 440, 
+3808, 442, 5856, 
+444, 7904, 446, 
+2400, 450, 4448, 
+452, 6496, 454, 
+864, 456, 2912, 
+458, 4960, 460, 
+7008, 462, 1376, 
+464, 3424, 466, 
+5472, 468, 7520, 
+470, 1888, 472, 
+3936, 474, 5984, 
+476, 8032, 478, 
+2528, 482, 4576, 
+484, 6624, 486, 
+992, 488, 3040, 
+490, 5088, 492, 
+7136, 494, 1504, 
+496, 3552, 498, 
+5600, 500, 7648, 
+502, 2016, 504, 
+4064, 506, 6112, 
+508, 8160, 510, 
+2056, 514, 4104, 
+516, 6152, 518, 
+2568, 522, 4616, 
+524, 6664, 526, 
+1032, 528, 3080, 
+530, 5128, 532, 
+7176, 534, 1544, 
+536, 3592, 538, 
+5640, 540, 7688, 
+542, 2184, 546, 
+4232, 548, 6280, 
+550, 648, 552, 
+2696, 554, 4744, 
+556, 6792, 558, 
+1160, 560, 3208, 
+562, 5256, 564, 
+7304, 566, 1672, 
+568, 3720, 570, 
+5768, 572, 7816, 
+574, 2312, 578, 
+4360, 580, 6408, 
+582, 776, 584, 
+2824, 586, 4872, 
+588, 6920, 590, 
+1288, 592, 3336, 
+594, 5384, 596, 
+7432, 598, 1800, 
+600, 3848, 602, 
+5896, 604, 7944, 
+606, 2440, 610, 
+4488, 612, 6536, 
+614, 904, 616, 
+2952, 618, 5000, 
+620, 7048, 622, 
+1416, 624, 3464, 
+626, 5512, 628, 
+7560, 630, 1928, 
+632, 3976, 634, 
+6024, 636, 8072, 
+638, 2088, 642, 
+4136, 644, 6184, 
+646, 2600, 650, 
+4648, 652, 6696, 
+654, 1064, 656, 
+3112, 658, 5160, 
+660, 7208, 662, 
+1576, 664, 3624, 
+666, 5672, 668, 
+7720, 670, 2216, 
+674, 4264, 676, 
+6312, 678, 2728, 
+682, 4776, 684, 
+6824, 686, 1192, 
+688, 3240, 690, 
+5288, 692, 7336, 
+694, 1704, 696, 
+3752, 698, 5800, 
+700, 7848, 702, 
+2344, 706, 4392, 
+708, 6440, 710, 
+808, 712, 2856, 
+714, 4904, 716, 
+6952, 718, 1320, 
+720, 3368, 722, 
+5416, 724, 7464, 
+726, 1832, 728, 
+3880, 730, 5928, 
+732, 7976, 734, 
+2472, 738, 4520, 
+740, 6568, 742, 
+936, 744, 2984, 
+746, 5032, 748, 
+7080, 750, 1448, 
+752, 3496, 754, 
+5544, 756, 7592, 
+758, 1960, 760, 
+4008, 762, 6056, 
+764, 8104, 766, 
+2120, 770, 4168, 
+772, 6216, 774, 
+2632, 778, 4680, 
+780, 6728, 782, 
+1096, 784, 3144, 
+786, 5192, 788, 
+7240, 790, 1608, 
+792, 3656, 794, 
+5704, 796, 7752, 
+798, 2248, 802, 
+4296, 804, 6344, 
+806, 2760, 810, 
+4808, 812, 6856, 
+814, 1224, 816, 
+3272, 818, 5320, 
+820, 7368, 822, 
+1736, 824, 3784, 
+826, 5832, 828, 
+7880, 830, 2376, 
+834, 4424, 836, 
+6472, 838, 2888, 
+842, 4936, 844, 
+6984, 846, 1352, 
+848, 3400, 850, 
+5448, 852, 7496, 
+854, 1864, 856, 
+3912, 858, 5960, 
+860, 8008, 862, 
+2504, 866, 4552, 
+868, 6600, 870, 
+968, 872, 3016, 
+874, 5064, 876, 
+7112, 878, 1480, 
+880, 3528, 882, 
+5576, 884, 7624, 
+886, 1992, 888, 
+4040, 890, 6088, 
+892, 8136, 894, 
+2152, 898, 4200, 
+900, 6248, 902, 
+2664, 906, 4712, 
+908, 6760, 910, 
+1128, 912, 3176, 
+914, 5224, 916, 
+7272, 918, 1640, 
+920, 3688, 922, 
+5736, 924, 7784, 
+926, 2280, 930, 
+4328, 932, 6376, 
+934, 2792, 938, 
+4840, 940, 6888, 
+942, 1256, 944, 
+3304, 946, 5352, 
+948, 7400, 950, 
+1768, 952, 3816, 
+954, 5864, 956, 
+7912, 958, 2408, 
+962, 4456, 964, 
+6504, 966, 2920, 
+970, 4968, 972, 
+7016, 974, 1384, 
+976, 3432, 978, 
+5480, 980, 7528, 
+982, 1896, 984, 
+3944, 986, 5992, 
+988, 8040, 990, 
+2536, 994, 4584, 
+996, 6632, 998, 
+3048, 1002, 5096, 
+1004, 7144, 1006, 
+1512, 1008, 3560, 
+1010, 5608, 1012, 
+7656, 1014, 2024, 
+1016, 4072, 1018, 
+6120, 1020, 8168, 
+1022, 2064, 1026, 
+4112, 1028, 6160, 
+1030, 2576, 1034, 
+4624, 1036, 6672, 
+1038, 3088, 1042, 
+5136, 1044, 7184, 
+1046, 1552, 1048, 
+3600, 1050, 5648, 
+1052, 7696, 1054, 
+2192, 1058, 4240, 
+1060, 6288, 1062, 
+2704, 1066, 4752, 
+1068, 6800, 1070, 
+1168, 1072, 3216, 
+1074, 5264, 1076, 
+7312, 1078, 1680, 
+1080, 3728, 1082, 
+5776, 1084, 7824, 
+1086, 2320, 1090, 
+4368, 1092, 6416, 
+1094, 2832, 1098, 
+4880, 1100, 6928, 
+1102, 1296, 1104, 
+3344, 1106, 5392, 
+1108, 7440, 1110, 
+1808, 1112, 3856, 
+1114, 5904, 1116, 
+7952, 1118, 2448, 
+1122, 4496, 1124, 
+6544, 1126, 2960, 
+1130, 5008, 1132, 
+7056, 1134, 1424, 
+1136, 3472, 1138, 
+5520, 1140, 7568, 
+1142, 1936, 1144, 
+3984, 1146, 6032, 
+1148, 8080, 1150, 
+2096, 1154, 4144, 
+1156, 6192, 1158, 
+2608, 1162, 4656, 
+1164, 6704, 1166, 
+3120, 1170, 5168, 
+1172, 7216, 1174, 
+1584, 1176, 3632, 
+1178, 5680, 1180, 
+7728, 1182, 2224, 
+1186, 4272, 1188, 
+6320, 1190, 2736, 
+1194, 4784, 1196, 
+6832, 1198, 3248, 
+1202, 5296, 1204, 
+7344, 1206, 1712, 
+1208, 3760, 1210, 
+5808, 1212, 7856, 
+1214, 2352, 1218, 
+4400, 1220, 6448, 
+1222, 2864, 1226, 
+4912, 1228, 6960, 
+1230, 1328, 1232, 
+3376, 1234, 5424, 
+1236, 7472, 1238, 
+1840, 1240, 3888, 
+1242, 5936, 1244, 
+7984, 1246, 2480, 
+1250, 4528, 1252, 
+6576, 1254, 2992, 
+1258, 5040, 1260, 
+7088, 1262, 1456, 
+1264, 3504, 1266, 
+5552, 1268, 7600, 
+1270, 1968, 1272, 
+4016, 1274, 6064, 
+1276, 8112, 1278, 
+2128, 1282, 4176, 
+1284, 6224, 1286, 
+2640, 1290, 4688, 
+1292, 6736, 1294, 
+3152, 1298, 5200, 
+1300, 7248, 1302, 
+1616, 1304, 3664, 
+1306, 5712, 1308, 
+7760, 1310, 2256, 
+1314, 4304, 1316, 
+6352, 1318, 2768, 
+1322, 4816, 1324, 
+6864, 1326, 3280, 
+1330, 5328, 1332, 
+7376, 1334, 1744, 
+1336, 3792, 1338, 
+5840, 1340, 7888, 
+1342, 2384, 1346, 
+4432, 1348, 6480, 
+1350, 2896, 1354, 
+4944, 1356, 6992, 
+1358, 3408, 1362, 
+5456, 1364, 7504, 
+1366, 1872, 1368, 
+3920, 1370, 5968, 
+1372, 8016, 1374, 
+2512, 1378, 4560, 
+1380, 6608, 1382, 
+3024, 1386, 5072, 
+1388, 7120, 1390, 
+1488, 1392, 3536, 
+1394, 5584, 1396, 
+7632, 1398, 2000, 
+1400, 4048, 1402, 
+6096, 1404, 8144, 
+1406, 2160, 1410, 
+4208, 1412, 6256, 
+1414, 2672, 1418, 
+4720, 1420, 6768, 
+1422, 3184, 1426, 
+5232, 1428, 7280, 
+1430, 1648, 1432, 
+3696, 1434, 5744, 
+1436, 7792, 1438, 
+2288, 1442, 4336, 
+1444, 6384, 1446, 
+2800, 1450, 4848, 
+1452, 6896, 1454, 
+3312, 1458, 5360, 
+1460, 7408, 1462, 
+1776, 1464, 3824, 
+1466, 5872, 1468, 
+7920, 1470, 2416, 
+1474, 4464, 1476, 
+6512, 1478, 2928, 
+1482, 4976, 1484, 
+7024, 1486, 3440, 
+1490, 5488, 1492, 
+7536, 1494, 1904, 
+1496, 3952, 1498, 
+6000, 1500, 8048, 
+1502, 2544, 1506, 
+4592, 1508, 6640, 
+1510, 3056, 1514, 
+5104, 1516, 7152, 
+1518, 3568, 1522, 
+5616, 1524, 7664, 
+1526, 2032, 1528, 
+4080, 1530, 6128, 
+1532, 8176, 1534, 
+2072, 1538, 4120, 
+1540, 6168, 1542, 
+2584, 1546, 4632, 
+1548, 6680, 1550, 
+3096, 1554, 5144, 
+1556, 7192, 1558, 
+3608, 1562, 5656, 
+1564, 7704, 1566, 
+2200, 1570, 4248, 
+1572, 6296, 1574, 
+2712, 1578, 4760, 
+1580, 6808, 1582, 
+3224, 1586, 5272, 
+1588, 7320, 1590, 
+1688, 1592, 3736, 
+1594, 5784, 1596, 
+7832, 1598, 2328, 
+1602, 4376, 1604, 
+6424, 1606, 2840, 
+1610, 4888, 1612, 
+6936, 1614, 3352, 
+1618, 5400, 1620, 
+7448, 1622, 1816, 
+1624, 3864, 1626, 
+5912, 1628, 7960, 
+1630, 2456, 1634, 
+4504, 1636, 6552, 
+1638, 2968, 1642, 
+5016, 1644, 7064, 
+1646, 3480, 1650, 
+5528, 1652, 7576, 
+1654, 1944, 1656, 
+3992, 1658, 6040, 
+1660, 8088, 1662, 
+2104, 1666, 4152, 
+1668, 6200, 1670, 
+2616, 1674, 4664, 
+1676, 6712, 1678, 
+3128, 1682, 5176, 
+1684, 7224, 1686, 
+3640, 1690, 5688, 
+1692, 7736, 1694, 
+2232, 1698, 4280, 
+1700, 6328, 1702, 
+2744, 1706, 4792, 
+1708, 6840, 1710, 
+3256, 1714, 5304, 
+1716, 7352, 1718, 
+3768, 1722, 5816, 
+1724, 7864, 1726, 
+2360, 1730, 4408, 
+1732, 6456, 1734, 
+2872, 1738, 4920, 
+1740, 6968, 1742, 
+3384, 1746, 5432, 
+1748, 7480, 1750, 
+1848, 1752, 3896, 
+1754, 5944, 1756, 
+7992, 1758, 2488, 
+1762, 4536, 1764, 
+6584, 1766, 3000, 
+1770, 5048, 1772, 
+7096, 1774, 3512, 
+1778, 5560, 1780, 
+7608, 1782, 1976, 
+1784, 4024, 1786, 
+6072, 1788, 8120, 
+1790, 2136, 1794, 
+4184, 1796, 6232, 
+1798, 2648, 1802, 
+4696, 1804, 6744, 
+1806, 3160, 1810, 
+5208, 1812, 7256, 
+1814, 3672, 1818, 
+5720, 1820, 7768, 
+1822, 2264, 1826, 
+4312, 1828, 6360, 
+1830, 2776, 1834, 
+4824, 1836, 6872, 
+1838, 3288, 1842, 
+5336, 1844, 7384, 
+1846, 3800, 1850, 
+5848, 1852, 7896, 
+1854, 2392, 1858, 
+4440, 1860, 6488, 
+1862, 2904, 1866, 
+4952, 1868, 7000, 
+1870, 3416, 1874, 
+5464, 1876, 7512, 
+1878, 3928, 1882, 
+5976, 1884, 8024, 
+1886, 2520, 1890, 
+4568, 1892, 6616, 
+1894, 3032, 1898, 
+5080, 1900, 7128, 
+1902, 3544, 1906, 
+5592, 1908, 7640, 
+1910, 2008, 1912, 
+4056, 1914, 6104, 
+1916, 8152, 1918, 
+2168, 1922, 4216, 
+1924, 6264, 1926, 
+2680, 1930, 4728, 
+1932, 6776, 1934, 
+3192, 1938, 5240, 
+1940, 7288, 1942, 
+3704, 1946, 5752, 
+1948, 7800, 1950, 
+2296, 1954, 4344, 
+1956, 6392, 1958, 
+2808, 1962, 4856, 
+1964, 6904, 1966, 
+3320, 1970, 5368, 
+1972, 7416, 1974, 
+3832, 1978, 5880, 
+1980, 7928, 1982, 
+2424, 1986, 4472, 
+1988, 6520, 1990, 
+2936, 1994, 4984, 
+1996, 7032, 1998, 
+3448, 2002, 5496, 
+2004, 7544, 2006, 
+3960, 2010, 6008, 
+2012, 8056, 2014, 
+2552, 2018, 4600, 
+2020, 6648, 2022, 
+3064, 2026, 5112, 
+2028, 7160, 2030, 
+3576, 2034, 5624, 
+2036, 7672, 2038, 
+4088, 2042, 6136, 
+2044, 8184, 2046, 
+4098, 2052, 6146, 
+2054, 2562, 2058, 
+4610, 2060, 6658, 
+2062, 3074, 2066, 
+5122, 2068, 7170, 
+2070, 3586, 2074, 
+5634, 2076, 7682, 
+2078, 2178, 2082, 
+4226, 2084, 6274, 
+2086, 2690, 2090, 
+4738, 2092, 6786, 
+2094, 3202, 2098, 
+5250, 2100, 7298, 
+2102, 3714, 2106, 
+5762, 2108, 7810, 
+2110, 2306, 2114, 
+4354, 2116, 6402, 
+2118, 2818, 2122, 
+4866, 2124, 6914, 
+2126, 3330, 2130, 
+5378, 2132, 7426, 
+2134, 3842, 2138, 
+5890, 2140, 7938, 
+2142, 2434, 2146, 
+4482, 2148, 6530, 
+2150, 2946, 2154, 
+4994, 2156, 7042, 
+2158, 3458, 2162, 
+5506, 2164, 7554, 
+2166, 3970, 2170, 
+6018, 2172, 8066, 
+2174, 4130, 2180, 
+6178, 2182, 2594, 
+2186, 4642, 2188, 
+6690, 2190, 3106, 
+2194, 5154, 2196, 
+7202, 2198, 3618, 
+2202, 5666, 2204, 
+7714, 2206, 4258, 
+2212, 6306, 2214, 
+2722, 2218, 4770, 
+2220, 6818, 2222, 
+3234, 2226, 5282, 
+2228, 7330, 2230, 
+3746, 2234, 5794, 
+2236, 7842, 2238, 
+2338, 2242, 4386, 
+2244, 6434, 2246, 
+2850, 2250, 4898, 
+2252, 6946, 2254, 
+3362, 2258, 5410, 
+2260, 7458, 2262, 
+3874, 2266, 5922, 
+2268, 7970, 2270, 
+2466, 2274, 4514, 
+2276, 6562, 2278, 
+2978, 2282, 5026, 
+2284, 7074, 2286, 
+3490, 2290, 5538, 
+2292, 7586, 2294, 
+4002, 2298, 6050, 
+2300, 8098, 2302, 
+4162, 2308, 6210, 
+2310, 2626, 2314, 
+4674, 2316, 6722, 
+2318, 3138, 2322, 
+5186, 2324, 7234, 
+2326, 3650, 2330, 
+5698, 2332, 7746, 
+2334, 4290, 2340, 
+6338, 2342, 2754, 
+2346, 4802, 2348, 
+6850, 2350, 3266, 
+2354, 5314, 2356, 
+7362, 2358, 3778, 
+2362, 5826, 2364, 
+7874, 2366, 4418, 
+2372, 6466, 2374, 
+2882, 2378, 4930, 
+2380, 6978, 2382, 
+3394, 2386, 5442, 
+2388, 7490, 2390, 
+3906, 2394, 5954, 
+2396, 8002, 2398, 
+2498, 2402, 4546, 
+2404, 6594, 2406, 
+3010, 2410, 5058, 
+2412, 7106, 2414, 
+3522, 2418, 5570, 
+2420, 7618, 2422, 
+4034, 2426, 6082, 
+2428, 8130, 2430, 
+4194, 2436, 6242, 
+2438, 2658, 2442, 
+4706, 2444, 6754, 
+2446, 3170, 2450, 
+5218, 2452, 7266, 
+2454, 3682, 2458, 
+5730, 2460, 7778, 
+2462, 4322, 2468, 
+6370, 2470, 2786, 
+2474, 4834, 2476, 
+6882, 2478, 3298, 
+2482, 5346, 2484, 
+7394, 2486, 3810, 
+2490, 5858, 2492, 
+7906, 2494, 4450, 
+2500, 6498, 2502, 
+2914, 2506, 4962, 
+2508, 7010, 2510, 
+3426, 2514, 5474, 
+2516, 7522, 2518, 
+3938, 2522, 5986, 
+2524, 8034, 2526, 
+4578, 2532, 6626, 
+2534, 3042, 2538, 
+5090, 2540, 7138, 
+2542, 3554, 2546, 
+5602, 2548, 7650, 
+2550, 4066, 2554, 
+6114, 2556, 8162, 
+2558, 4106, 2564, 
+6154, 2566, 4618, 
+2572, 6666, 2574, 
+3082, 2578, 5130, 
+2580, 7178, 2582, 
+3594, 2586, 5642, 
+2588, 7690, 2590, 
+4234, 2596, 6282, 
+2598, 2698, 2602, 
+4746, 2604, 6794, 
+2606, 3210, 2610, 
+5258, 2612, 7306, 
+2614, 3722, 2618, 
+5770, 2620, 7818, 
+2622, 4362, 2628, 
+6410, 2630, 2826, 
+2634, 4874, 2636, 
+6922, 2638, 3338, 
+2642, 5386, 2644, 
+7434, 2646, 3850, 
+2650, 5898, 2652, 
+7946, 2654, 4490, 
+2660, 6538, 2662, 
+2954, 2666, 5002, 
+2668, 7050, 2670, 
+3466, 2674, 5514, 
+2676, 7562, 2678, 
+3978, 2682, 6026, 
+2684, 8074, 2686, 
+4138, 2692, 6186, 
+2694, 4650, 2700, 
+6698, 2702, 3114, 
+2706, 5162, 2708, 
+7210, 2710, 3626, 
+2714, 5674, 2716, 
+7722, 2718, 4266, 
+2724, 6314, 2726, 
+4778, 2732, 6826, 
+2734, 3242, 2738, 
+5290, 2740, 7338, 
+2742, 3754, 2746, 
+5802, 2748, 7850, 
+2750, 4394, 2756, 
+6442, 2758, 2858, 
+2762, 4906, 2764, 
+6954, 2766, 3370, 
+2770, 5418, 2772, 
+7466, 2774, 3882, 
+2778, 5930, 2780, 
+7978, 2782, 4522, 
+2788, 6570, 2790, 
+2986, 2794, 5034, 
+2796, 7082, 2798, 
+3498, 2802, 5546, 
+2804, 7594, 2806, 
+4010, 2810, 6058, 
+2812, 8106, 2814, 
+4170, 2820, 6218, 
+2822, 4682, 2828, 
+6730, 2830, 3146, 
+2834, 5194, 2836, 
+7242, 2838, 3658, 
+2842, 5706, 2844, 
+7754, 2846, 4298, 
+2852, 6346, 2854, 
+4810, 2860, 6858, 
+2862, 3274, 2866, 
+5322, 2868, 7370, 
+2870, 3786, 2874, 
+5834, 2876, 7882, 
+2878, 4426, 2884, 
+6474, 2886, 4938, 
+2892, 6986, 2894, 
+3402, 2898, 5450, 
+2900, 7498, 2902, 
+3914, 2906, 5962, 
+2908, 8010, 2910, 
+4554, 2916, 6602, 
+2918, 3018, 2922, 
+5066, 2924, 7114, 
+2926, 3530, 2930, 
+5578, 2932, 7626, 
+2934, 4042, 2938, 
+6090, 2940, 8138, 
+2942, 4202, 2948, 
+6250, 2950, 4714, 
+2956, 6762, 2958, 
+3178, 2962, 5226, 
+2964, 7274, 2966, 
+3690, 2970, 5738, 
+2972, 7786, 2974, 
+4330, 2980, 6378, 
+2982, 4842, 2988, 
+6890, 2990, 3306, 
+2994, 5354, 2996, 
+7402, 2998, 3818, 
+3002, 5866, 3004, 
+7914, 3006, 4458, 
+3012, 6506, 3014, 
+4970, 3020, 7018, 
+3022, 3434, 3026, 
+5482, 3028, 7530, 
+3030, 3946, 3034, 
+5994, 3036, 8042, 
+3038, 4586, 3044, 
+6634, 3046, 5098, 
+3052, 7146, 3054, 
+3562, 3058, 5610, 
+3060, 7658, 3062, 
+4074, 3066, 6122, 
+3068, 8170, 3070, 
+4114, 3076, 6162, 
+3078, 4626, 3084, 
+6674, 3086, 5138, 
+3092, 7186, 3094, 
+3602, 3098, 5650, 
+3100, 7698, 3102, 
+4242, 3108, 6290, 
+3110, 4754, 3116, 
+6802, 3118, 3218, 
+3122, 5266, 3124, 
+7314, 3126, 3730, 
+3130, 5778, 3132, 
+7826, 3134, 4370, 
+3140, 6418, 3142, 
+4882, 3148, 6930, 
+3150, 3346, 3154, 
+5394, 3156, 7442, 
+3158, 3858, 3162, 
+5906, 3164, 7954, 
+3166, 4498, 3172, 
+6546, 3174, 5010, 
+3180, 7058, 3182, 
+3474, 3186, 5522, 
+3188, 7570, 3190, 
+3986, 3194, 6034, 
+3196, 8082, 3198, 
+4146, 3204, 6194, 
+3206, 4658, 3212, 
+6706, 3214, 5170, 
+3220, 7218, 3222, 
+3634, 3226, 5682, 
+3228, 7730, 3230, 
+4274, 3236, 6322, 
+3238, 4786, 3244, 
+6834, 3246, 5298, 
+3252, 7346, 3254, 
+3762, 3258, 5810, 
+3260, 7858, 3262, 
+4402, 3268, 6450, 
+3270, 4914, 3276, 
+6962, 3278, 3378, 
+3282, 5426, 3284, 
+7474, 3286, 3890, 
+3290, 5938, 3292, 
+7986, 3294, 4530, 
+3300, 6578, 3302, 
+5042, 3308, 7090, 
+3310, 3506, 3314, 
+5554, 3316, 7602, 
+3318, 4018, 3322, 
+6066, 3324, 8114, 
+3326, 4178, 3332, 
+6226, 3334, 4690, 
+3340, 6738, 3342, 
+5202, 3348, 7250, 
+3350, 3666, 3354, 
+5714, 3356, 7762, 
+3358, 4306, 3364, 
+6354, 3366, 4818, 
+3372, 6866, 3374, 
+5330, 3380, 7378, 
+3382, 3794, 3386, 
+5842, 3388, 7890, 
+3390, 4434, 3396, 
+6482, 3398, 4946, 
+3404, 6994, 3406, 
+5458, 3412, 7506, 
+3414, 3922, 3418, 
+5970, 3420, 8018, 
+3422, 4562, 3428, 
+6610, 3430, 5074, 
+3436, 7122, 3438, 
+3538, 3442, 5586, 
+3444, 7634, 3446, 
+4050, 3450, 6098, 
+3452, 8146, 3454, 
+4210, 3460, 6258, 
+3462, 4722, 3468, 
+6770, 3470, 5234, 
+3476, 7282, 3478, 
+3698, 3482, 5746, 
+3484, 7794, 3486, 
+4338, 3492, 6386, 
+3494, 4850, 3500, 
+6898, 3502, 5362, 
+3508, 7410, 3510, 
+3826, 3514, 5874, 
+3516, 7922, 3518, 
+4466, 3524, 6514, 
+3526, 4978, 3532, 
+7026, 3534, 5490, 
+3540, 7538, 3542, 
+3954, 3546, 6002, 
+3548, 8050, 3550, 
+4594, 3556, 6642, 
+3558, 5106, 3564, 
+7154, 3566, 5618, 
+3572, 7666, 3574, 
+4082, 3578, 6130, 
+3580, 8178, 3582, 
+4122, 3588, 6170, 
+3590, 4634, 3596, 
+6682, 3598, 5146, 
+3604, 7194, 3606, 
+5658, 3612, 7706, 
+3614, 4250, 3620, 
+6298, 3622, 4762, 
+3628, 6810, 3630, 
+5274, 3636, 7322, 
+3638, 3738, 3642, 
+5786, 3644, 7834, 
+3646, 4378, 3652, 
+6426, 3654, 4890, 
+3660, 6938, 3662, 
+5402, 3668, 7450, 
+3670, 3866, 3674, 
+5914, 3676, 7962, 
+3678, 4506, 3684, 
+6554, 3686, 5018, 
+3692, 7066, 3694, 
+5530, 3700, 7578, 
+3702, 3994, 3706, 
+6042, 3708, 8090, 
+3710, 4154, 3716, 
+6202, 3718, 4666, 
+3724, 6714, 3726, 
+5178, 3732, 7226, 
+3734, 5690, 3740, 
+7738, 3742, 4282, 
+3748, 6330, 3750, 
+4794, 3756, 6842, 
+3758, 5306, 3764, 
+7354, 3766, 5818, 
+3772, 7866, 3774, 
+4410, 3780, 6458, 
+3782, 4922, 3788, 
+6970, 3790, 5434, 
+3796, 7482, 3798, 
+3898, 3802, 5946, 
+3804, 7994, 3806, 
+4538, 3812, 6586, 
+3814, 5050, 3820, 
+7098, 3822, 5562, 
+3828, 7610, 3830, 
+4026, 3834, 6074, 
+3836, 8122, 3838, 
+4186, 3844, 6234, 
+3846, 4698, 3852, 
+6746, 3854, 5210, 
+3860, 7258, 3862, 
+5722, 3868, 7770, 
+3870, 4314, 3876, 
+6362, 3878, 4826, 
+3884, 6874, 3886, 
+5338, 3892, 7386, 
+3894, 5850, 3900, 
+7898, 3902, 4442, 
+3908, 6490, 3910, 
+4954, 3916, 7002, 
+3918, 5466, 3924, 
+7514, 3926, 5978, 
+3932, 8026, 3934, 
+4570, 3940, 6618, 
+3942, 5082, 3948, 
+7130, 3950, 5594, 
+3956, 7642, 3958, 
+4058, 3962, 6106, 
+3964, 8154, 3966, 
+4218, 3972, 6266, 
+3974, 4730, 3980, 
+6778, 3982, 5242, 
+3988, 7290, 3990, 
+5754, 3996, 7802, 
+3998, 4346, 4004, 
+6394, 4006, 4858, 
+4012, 6906, 4014, 
+5370, 4020, 7418, 
+4022, 5882, 4028, 
+7930, 4030, 4474, 
+4036, 6522, 4038, 
+4986, 4044, 7034, 
+4046, 5498, 4052, 
+7546, 4054, 6010, 
+4060, 8058, 4062, 
+4602, 4068, 6650, 
+4070, 5114, 4076, 
+7162, 4078, 5626, 
+4084, 7674, 4086, 
+6138, 4092, 8186, 
+4094, 6148, 4102, 
+4612, 4108, 6660, 
+4110, 5124, 4116, 
+7172, 4118, 5636, 
+4124, 7684, 4126, 
+4228, 4132, 6276, 
+4134, 4740, 4140, 
+6788, 4142, 5252, 
+4148, 7300, 4150, 
+5764, 4156, 7812, 
+4158, 4356, 4164, 
+6404, 4166, 4868, 
+4172, 6916, 4174, 
+5380, 4180, 7428, 
+4182, 5892, 4188, 
+7940, 4190, 4484, 
+4196, 6532, 4198, 
+4996, 4204, 7044, 
+4206, 5508, 4212, 
+7556, 4214, 6020, 
+4220, 8068, 4222, 
+6180, 4230, 4644, 
+4236, 6692, 4238, 
+5156, 4244, 7204, 
+4246, 5668, 4252, 
+7716, 4254, 6308, 
+4262, 4772, 4268, 
+6820, 4270, 5284, 
+4276, 7332, 4278, 
+5796, 4284, 7844, 
+4286, 4388, 4292, 
+6436, 4294, 4900, 
+4300, 6948, 4302, 
+5412, 4308, 7460, 
+4310, 5924, 4316, 
+7972, 4318, 4516, 
+4324, 6564, 4326, 
+5028, 4332, 7076, 
+4334, 5540, 4340, 
+7588, 4342, 6052, 
+4348, 8100, 4350, 
+6212, 4358, 4676, 
+4364, 6724, 4366, 
+5188, 4372, 7236, 
+4374, 5700, 4380, 
+7748, 4382, 6340, 
+4390, 4804, 4396, 
+6852, 4398, 5316, 
+4404, 7364, 4406, 
+5828, 4412, 7876, 
+4414, 6468, 4422, 
+4932, 4428, 6980, 
+4430, 5444, 4436, 
+7492, 4438, 5956, 
+4444, 8004, 4446, 
+4548, 4452, 6596, 
+4454, 5060, 4460, 
+7108, 4462, 5572, 
+4468, 7620, 4470, 
+6084, 4476, 8132, 
+4478, 6244, 4486, 
+4708, 4492, 6756, 
+4494, 5220, 4500, 
+7268, 4502, 5732, 
+4508, 7780, 4510, 
+6372, 4518, 4836, 
+4524, 6884, 4526, 
+5348, 4532, 7396, 
+4534, 5860, 4540, 
+7908, 4542, 6500, 
+4550, 4964, 4556, 
+7012, 4558, 5476, 
+4564, 7524, 4566, 
+5988, 4572, 8036, 
+4574, 6628, 4582, 
+5092, 4588, 7140, 
+4590, 5604, 4596, 
+7652, 4598, 6116, 
+4604, 8164, 4606, 
+6156, 4614, 6668, 
+4622, 5132, 4628, 
+7180, 4630, 5644, 
+4636, 7692, 4638, 
+6284, 4646, 4748, 
+4652, 6796, 4654, 
+5260, 4660, 7308, 
+4662, 5772, 4668, 
+7820, 4670, 6412, 
+4678, 4876, 4684, 
+6924, 4686, 5388, 
+4692, 7436, 4694, 
+5900, 4700, 7948, 
+4702, 6540, 4710, 
+5004, 4716, 7052, 
+4718, 5516, 4724, 
+7564, 4726, 6028, 
+4732, 8076, 4734, 
+6188, 4742, 6700, 
+4750, 5164, 4756, 
+7212, 4758, 5676, 
+4764, 7724, 4766, 
+6316, 4774, 6828, 
+4782, 5292, 4788, 
+7340, 4790, 5804, 
+4796, 7852, 4798, 
+6444, 4806, 4908, 
+4812, 6956, 4814, 
+5420, 4820, 7468, 
+4822, 5932, 4828, 
+7980, 4830, 6572, 
+4838, 5036, 4844, 
+7084, 4846, 5548, 
+4852, 7596, 4854, 
+6060, 4860, 8108, 
+4862, 6220, 4870, 
+6732, 4878, 5196, 
+4884, 7244, 4886, 
+5708, 4892, 7756, 
+4894, 6348, 4902, 
+6860, 4910, 5324, 
+4916, 7372, 4918, 
+5836, 4924, 7884, 
+4926, 6476, 4934, 
+6988, 4942, 5452, 
+4948, 7500, 4950, 
+5964, 4956, 8012, 
+4958, 6604, 4966, 
+5068, 4972, 7116, 
+4974, 5580, 4980, 
+7628, 4982, 6092, 
+4988, 8140, 4990, 
+6252, 4998, 6764, 
+5006, 5228, 5012, 
+7276, 5014, 5740, 
+5020, 7788, 5022, 
+6380, 5030, 6892, 
+5038, 5356, 5044, 
+7404, 5046, 5868, 
+5052, 7916, 5054, 
+6508, 5062, 7020, 
+5070, 5484, 5076, 
+7532, 5078, 5996, 
+5084, 8044, 5086, 
+6636, 5094, 7148, 
+5102, 5612, 5108, 
+7660, 5110, 6124, 
+5116, 8172, 5118, 
+6164, 5126, 6676, 
+5134, 7188, 5142, 
+5652, 5148, 7700, 
+5150, 6292, 5158, 
+6804, 5166, 5268, 
+5172, 7316, 5174, 
+5780, 5180, 7828, 
+5182, 6420, 5190, 
+6932, 5198, 5396, 
+5204, 7444, 5206, 
+5908, 5212, 7956, 
+5214, 6548, 5222, 
+7060, 5230, 5524, 
+5236, 7572, 5238, 
+6036, 5244, 8084, 
+5246, 6196, 5254, 
+6708, 5262, 7220, 
+5270, 5684, 5276, 
+7732, 5278, 6324, 
+5286, 6836, 5294, 
+7348, 5302, 5812, 
+5308, 7860, 5310, 
+6452, 5318, 6964, 
+5326, 5428, 5332, 
+7476, 5334, 5940, 
+5340, 7988, 5342, 
+6580, 5350, 7092, 
+5358, 5556, 5364, 
+7604, 5366, 6068, 
+5372, 8116, 5374, 
+6228, 5382, 6740, 
+5390, 7252, 5398, 
+5716, 5404, 7764, 
+5406, 6356, 5414, 
+6868, 5422, 7380, 
+5430, 5844, 5436, 
+7892, 5438, 6484, 
+5446, 6996, 5454, 
+7508, 5462, 5972, 
+5468, 8020, 5470, 
+6612, 5478, 7124, 
+5486, 5588, 5492, 
+7636, 5494, 6100, 
+5500, 8148, 5502, 
+6260, 5510, 6772, 
+5518, 7284, 5526, 
+5748, 5532, 7796, 
+5534, 6388, 5542, 
+6900, 5550, 7412, 
+5558, 5876, 5564, 
+7924, 5566, 6516, 
+5574, 7028, 5582, 
+7540, 5590, 6004, 
+5596, 8052, 5598, 
+6644, 5606, 7156, 
+5614, 7668, 5622, 
+6132, 5628, 8180, 
+5630, 6172, 5638, 
+6684, 5646, 7196, 
+5654, 7708, 5662, 
+6300, 5670, 6812, 
+5678, 7324, 5686, 
+5788, 5692, 7836, 
+5694, 6428, 5702, 
+6940, 5710, 7452, 
+5718, 5916, 5724, 
+7964, 5726, 6556, 
+5734, 7068, 5742, 
+7580, 5750, 6044, 
+5756, 8092, 5758, 
+6204, 5766, 6716, 
+5774, 7228, 5782, 
+7740, 5790, 6332, 
+5798, 6844, 5806, 
+7356, 5814, 7868, 
+5822, 6460, 5830, 
+6972, 5838, 7484, 
+5846, 5948, 5852, 
+7996, 5854, 6588, 
+5862, 7100, 5870, 
+7612, 5878, 6076, 
+5884, 8124, 5886, 
+6236, 5894, 6748, 
+5902, 7260, 5910, 
+7772, 5918, 6364, 
+5926, 6876, 5934, 
+7388, 5942, 7900, 
+5950, 6492, 5958, 
+7004, 5966, 7516, 
+5974, 8028, 5982, 
+6620, 5990, 7132, 
+5998, 7644, 6006, 
+6108, 6012, 8156, 
+6014, 6268, 6022, 
+6780, 6030, 7292, 
+6038, 7804, 6046, 
+6396, 6054, 6908, 
+6062, 7420, 6070, 
+7932, 6078, 6524, 
+6086, 7036, 6094, 
+7548, 6102, 8060, 
+6110, 6652, 6118, 
+7164, 6126, 7676, 
+6134, 8188, 6142, 
+6662, 6158, 7174, 
+6166, 7686, 6174, 
+6278, 6182, 6790, 
+6190, 7302, 6198, 
+7814, 6206, 6406, 
+6214, 6918, 6222, 
+7430, 6230, 7942, 
+6238, 6534, 6246, 
+7046, 6254, 7558, 
+6262, 8070, 6270, 
+6694, 6286, 7206, 
+6294, 7718, 6302, 
+6822, 6318, 7334, 
+6326, 7846, 6334, 
+6438, 6342, 6950, 
+6350, 7462, 6358, 
+7974, 6366, 6566, 
+6374, 7078, 6382, 
+7590, 6390, 8102, 
+6398, 6726, 6414, 
+7238, 6422, 7750, 
+6430, 6854, 6446, 
+7366, 6454, 7878, 
+6462, 6982, 6478, 
+7494, 6486, 8006, 
+6494, 6598, 6502, 
+7110, 6510, 7622, 
+6518, 8134, 6526, 
+6758, 6542, 7270, 
+6550, 7782, 6558, 
+6886, 6574, 7398, 
+6582, 7910, 6590, 
+7014, 6606, 7526, 
+6614, 8038, 6622, 
+7142, 6638, 7654, 
+6646, 8166, 6654, 
+7182, 6678, 7694, 
+6686, 6798, 6702, 
+7310, 6710, 7822, 
+6718, 6926, 6734, 
+7438, 6742, 7950, 
+6750, 7054, 6766, 
+7566, 6774, 8078, 
+6782, 7214, 6806, 
+7726, 6814, 7342, 
+6838, 7854, 6846, 
+6958, 6862, 7470, 
+6870, 7982, 6878, 
+7086, 6894, 7598, 
+6902, 8110, 6910, 
+7246, 6934, 7758, 
+6942, 7374, 6966, 
+7886, 6974, 7502, 
+6998, 8014, 7006, 
+7118, 7022, 7630, 
+7030, 8142, 7038, 
+7278, 7062, 7790, 
+7070, 7406, 7094, 
+7918, 7102, 7534, 
+7126, 8046, 7134, 
+7662, 7158, 8174, 
+7166, 7702, 7198, 
+7318, 7222, 7830, 
+7230, 7446, 7254, 
+7958, 7262, 7574, 
+7286, 8086, 7294, 
+7734, 7326, 7862, 
+7358, 7478, 7382, 
+7990, 7390, 7606, 
+7414, 8118, 7422, 
+7766, 7454, 7894, 
+7486, 8022, 7518, 
+7638, 7542, 8150, 
+7550, 7798, 7582, 
+7926, 7614, 8054, 
+7646, 8182, 7678, 
+7838, 7742, 7966, 
+7774, 8094, 7806, 
+7998, 7902, 8126, 
+7934, 8158, 8062, 
+};
+__ALIGNED(8) const uint16_t perm57[NB_PERM57]={
+24, 4, 4, 
+8, 8, 16, 
+16, 10, 10, 
+40, 40, 14, 
+14, 26, 26, 
+28, 28, 12, 
+12, 2, 32, 
+20, 20, 18, 
+18, 34, 34, 
+44, 44, 22, 
+22, 42, 42, 
+38, 38, 30, 
+30, 36, 36, 
+6, };
+__ALIGNED(8) const uint16_t perm58[NB_PERM58]={
+32, 4, 4, 
+8, 8, 16, 
+16, 2, 40, 
+20, 20, 10, 
+10, 48, 48, 
+6, 24, 18, 
+18, 34, 34, 
+36, 36, 12, 
+56, 22, 22, 
+42, 42, 52, 
+52, 14, 50, 
+38, 38, 44, 
+44, 28, 28, 
+26, 58, 54, 
+54, 46, 46, 
+60, 60, 30, 
+};
+__ALIGNED(8) const uint16_t perm59[NB_PERM59]={
 40, 24, 24, 
 22, 22, 52, 
 52, 16, 16, 
@@ -7411,7 +6063,7 @@ __ALIGNED(8) const uint16_t perm67[NB_PERM67]={
 38, 54, 54, 
 56, 56, 26, 
 44, 34, };
-__ALIGNED(8) const uint16_t perm68[NB_PERM68]={
+__ALIGNED(8) const uint16_t perm60[NB_PERM60]={
 32, 42, 42, 
 26, 26, 34, 
 34, 74, 74, 
@@ -7441,7 +6093,7 @@ __ALIGNED(8) const uint16_t perm68[NB_PERM68]={
 68, 60, 60, 
 20, 66, 28, 
 };
-__ALIGNED(8) const uint16_t perm69[NB_PERM69]={
+__ALIGNED(8) const uint16_t perm61[NB_PERM61]={
 32, 2, 64, 
 4, 96, 6, 
 40, 10, 72, 
@@ -7459,215 +6111,509 @@ __ALIGNED(8) const uint16_t perm69[NB_PERM69]={
 108, 78, 116, 
 86, 124, 94, 
 };
-__ALIGNED(8) const uint16_t perm70[NB_PERM70]={
-160, 12, 12, 
-360, 360, 74, 
-74, 220, 220, 
-462, 462, 546, 
-546, 178, 178, 
-252, 252, 472, 
-472, 146, 146, 
-242, 242, 272, 
-272, 84, 84, 
-420, 420, 336, 
-336, 104, 104, 
-70, 70, 500, 
-500, 436, 436, 
-416, 416, 16, 
-16, 80, 80, 
-100, 100, 350, 
-350, 624, 624, 
-118, 118, 590, 
-590, 548, 548, 
-338, 338, 264, 
-264, 44, 44, 
-370, 370, 274, 
-274, 244, 244, 
-432, 432, 96, 
-96, 30, 30, 
-600, 600, 148, 
-148, 402, 402, 
-246, 246, 592, 
-592, 108, 108, 
-390, 390, 486, 
-486, 516, 516, 
-328, 328, 64, 
-64, 20, 20, 
-400, 400, 86, 
-86, 580, 580, 
-348, 348, 464, 
-464, 106, 106, 
-230, 230, 512, 
-512, 8, 8, 
-40, 40, 50, 
-50, 250, 250, 
-312, 312, 134, 
-134, 482, 482, 
-196, 196, 342, 
-342, 584, 584, 
-68, 68, 340, 
-340, 424, 424, 
-56, 56, 130, 
-130, 162, 162, 
-172, 172, 372, 
-372, 434, 434, 
-256, 256, 4, 
-4, 320, 320, 
-24, 24, 120, 
-120, 150, 150, 
-562, 562, 258, 
-258, 164, 164, 
-332, 332, 384, 
-384, 6, 6, 
-480, 480, 36, 
-36, 330, 330, 
-224, 224, 32, 
-32, 10, 10, 
-200, 200, 62, 
-62, 610, 610, 
-198, 198, 502, 
-502, 596, 596, 
-428, 428, 376, 
-376, 154, 154, 
-282, 282, 284, 
-284, 444, 444, 
-456, 456, 66, 
-66, 180, 180, 
-412, 412, 446, 
-446, 616, 616, 
-78, 78, 540, 
-540, 448, 448, 
-26, 26, 280, 
-280, 124, 124, 
-470, 470, 586, 
-586, 228, 228, 
-352, 352, 34, 
-34, 170, 170, 
-212, 212, 422, 
-422, 496, 496, 
-116, 116, 430, 
-430, 536, 536, 
-128, 128, 2, 
-520, 48, 48, 
-90, 90, 300, 
-300, 374, 374, 
-594, 594, 268, 
-268, 364, 364, 
-394, 394, 206, 
-206, 542, 542, 
-608, 608, 38, 
-38, 490, 490, 
-236, 236, 392, 
-392, 46, 46, 
-530, 530, 248, 
-248, 152, 152, 
-122, 122, 310, 
-310, 574, 574, 
-618, 618, 238, 
-238, 552, 552, 
-58, 58, 290, 
-290, 174, 174, 
-532, 532, 408, 
-408, 126, 126, 
-630, 630, 598, 
-598, 588, 588, 
-388, 388, 326, 
-326, 504, 504, 
-156, 156, 442, 
-442, 296, 296, 
-54, 54, 570, 
-570, 298, 298, 
-214, 214, 582, 
-582, 508, 508, 
-476, 476, 466, 
-466, 266, 266, 
-204, 204, 382, 
-382, 634, 634, 
-318, 318, 614, 
-614, 518, 518, 
-488, 488, 76, 
-76, 380, 380, 
-474, 474, 306, 
-306, 254, 254, 
-632, 632, 158, 
-158, 602, 602, 
-308, 308, 414, 
-414, 606, 606, 
-628, 628, 438, 
-438, 576, 576, 
-28, 28, 440, 
-440, 136, 136, 
-42, 42, 210, 
-210, 262, 262, 
-484, 484, 356, 
-356, 354, 354, 
-194, 194, 182, 
-182, 572, 572, 
-458, 458, 226, 
-226, 192, 192, 
-22, 22, 560, 
-560, 98, 98, 
-190, 190, 612, 
-612, 358, 358, 
-514, 514, 168, 
-168, 52, 52, 
-410, 410, 286, 
-286, 604, 604, 
-468, 468, 426, 
-426, 216, 216, 
-142, 142, 522, 
-522, 208, 208, 
-102, 102, 510, 
-510, 636, 636, 
-478, 478, 626, 
-626, 278, 278, 
-564, 564, 418, 
-418, 176, 176, 
-92, 92, 460, 
-460, 386, 386, 
-166, 166, 492, 
-492, 396, 396, 
-366, 366, 554, 
-554, 218, 218, 
-302, 302, 534, 
-534, 568, 568, 
-138, 138, 202, 
-202, 222, 222, 
-622, 622, 558, 
-558, 538, 538, 
-288, 288, 14, 
-240, 112, 112, 
-110, 110, 550, 
-550, 498, 498, 
-276, 276, 404, 
-404, 406, 406, 
-566, 566, 578, 
-578, 188, 188, 
-452, 452, 346, 
-346, 304, 304, 
-94, 94, 620, 
-620, 398, 398, 
-526, 526, 528, 
-528, 88, 88, 
-140, 140, 362, 
-362, 234, 234, 
-232, 232, 72, 
-72, 60, 60, 
-450, 450, 186, 
-186, 292, 292, 
-334, 334, 544, 
-544, 18, 260, 
-324, 324, 344, 
-344, 144, 144, 
-82, 270, 524, 
-524, 368, 368, 
-114, 322, 184, 
-184, 132, 494, 
-556, 556, 378, 
-378, 314, 314, 
-294, 454, 506, 
-506, 316, };
-__ALIGNED(8) const uint16_t perm71[NB_PERM71]={
+__ALIGNED(8) const uint16_t perm62[NB_PERM62]={
+72, 4, 4, 
+24, 24, 16, 
+16, 32, 32, 
+64, 64, 42, 
+42, 98, 98, 
+92, 92, 60, 
+60, 18, 18, 
+104, 104, 68, 
+68, 66, 66, 
+114, 114, 102, 
+102, 116, 116, 
+54, 54, 106, 
+106, 140, 140, 
+70, 70, 138, 
+138, 118, 118, 
+126, 126, 110, 
+110, 78, 78, 
+100, 100, 44, 
+44, 50, 50, 
+82, 82, 124, 
+124, 38, 38, 
+74, 74, 76, 
+76, 28, 28, 
+40, 40, 26, 
+26, 88, 88, 
+36, 36, 2, 
+96, 20, 20, 
+56, 56, 58, 
+58, 130, 130, 
+134, 134, 94, 
+94, 132, 132, 
+22, 22, 128, 
+128, 62, 62, 
+90, 90, 108, 
+108, 6, 48, 
+10, 10, 120, 
+120, 14, 14, 
+80, 80, 52, 
+52, 34, 34, 
+136, 136, 46, 
+46, 122, 122, 
+86, 86, 84, 
+84, 12, 12, 
+8, 112, 30, 
+};
+__ALIGNED(8) const uint16_t perm63[NB_PERM63]={
+40, 12, 12, 
+90, 90, 74, 
+74, 54, 54, 
+142, 142, 138, 
+138, 58, 58, 
+72, 72, 14, 
+14, 130, 130, 
+48, 48, 22, 
+22, 140, 140, 
+98, 98, 46, 
+46, 132, 132, 
+88, 88, 34, 
+34, 42, 42, 
+52, 52, 102, 
+102, 126, 126, 
+156, 156, 118, 
+118, 146, 146, 
+68, 68, 84, 
+84, 104, 104, 
+16, 16, 20, 
+20, 100, 100, 
+86, 86, 144, 
+144, 28, 28, 
+110, 110, 136, 
+136, 18, 18, 
+60, 60, 112, 
+112, 26, 26, 
+70, 70, 124, 
+124, 116, 116, 
+106, 106, 56, 
+56, 32, 32, 
+2, 80, 24, 
+24, 30, 30, 
+150, 150, 148, 
+148, 108, 108, 
+96, 96, 6, 
+6, 120, 120, 
+36, 36, 82, 
+82, 64, 64, 
+4, 10, 50, 
+50, 62, 62, 
+152, 152, 38, 
+38, 122, 122, 
+76, 76, 94, 
+94, 154, 154, 
+78, 78, 134, 
+134, 128, 128, 
+8, 92, 114, 
+114, 66, 66, 
+44, };
+__ALIGNED(8) const uint16_t perm64[NB_PERM64]={
+96, 4, 4, 
+32, 32, 80, 
+80, 82, 82, 
+178, 178, 182, 
+182, 126, 126, 
+148, 148, 38, 
+38, 120, 120, 
+20, 20, 72, 
+72, 18, 18, 
+136, 136, 60, 
+60, 10, 10, 
+160, 160, 46, 
+46, 184, 184, 
+62, 62, 106, 
+106, 164, 164, 
+78, 78, 146, 
+146, 102, 102, 
+132, 132, 28, 
+28, 48, 48, 
+2, 128, 84, 
+84, 26, 26, 
+112, 112, 44, 
+44, 88, 88, 
+58, 58, 162, 
+162, 142, 142, 
+188, 188, 94, 
+94, 186, 186, 
+158, 158, 110, 
+110, 108, 108, 
+12, 12, 8, 
+8, 64, 64, 
+42, 42, 152, 
+152, 70, 70, 
+170, 170, 118, 
+118, 172, 172, 
+54, 54, 130, 
+130, 180, 180, 
+30, 30, 144, 
+144, 6, 104, 
+68, 68, 74, 
+74, 114, 114, 
+140, 140, 92, 
+92, 90, 90, 
+154, 154, 166, 
+166, 174, 174, 
+150, 150, 134, 
+134, 124, 124, 
+52, 52, 34, 
+34, 176, 176, 
+86, 86, 122, 
+122, 116, 116, 
+76, 76, 50, 
+50, 98, 98, 
+100, 100, 36, 
+36, 24, 24, 
+16, 16, 40, 
+40, 56, 56, 
+66, 66, 138, 
+138, 156, 156, 
+14, 168, 22, 
+};
+__ALIGNED(8) const uint16_t perm65[NB_PERM65]={
+120, 24, 24, 
+20, 20, 90, 
+90, 192, 192, 
+8, 8, 80, 
+80, 102, 102, 
+164, 164, 96, 
+96, 4, 4, 
+40, 40, 70, 
+70, 212, 212, 
+98, 98, 124, 
+124, 64, 64, 
+52, 52, 42, 
+42, 190, 190, 
+236, 236, 118, 
+118, 214, 214, 
+218, 218, 148, 
+148, 46, 46, 
+230, 230, 158, 
+158, 136, 136, 
+74, 74, 142, 
+142, 234, 234, 
+198, 198, 168, 
+168, 26, 26, 
+140, 140, 114, 
+114, 174, 174, 
+186, 186, 196, 
+196, 48, 48, 
+2, 160, 56, 
+56, 82, 82, 
+222, 222, 188, 
+188, 116, 116, 
+94, 94, 232, 
+232, 78, 78, 
+182, 182, 156, 
+156, 16, 16, 
+50, 50, 122, 
+122, 144, 144, 
+6, 200, 88, 
+88, 72, 72, 
+22, 22, 210, 
+210, 178, 178, 
+226, 226, 228, 
+228, 38, 38, 
+150, 150, 166, 
+166, 216, 216, 
+28, 28, 60, 
+60, 12, 12, 
+10, 130, 224, 
+224, 108, 108, 
+14, 170, 146, 
+146, 126, 126, 
+184, 184, 76, 
+76, 62, 62, 
+132, 132, 34, 
+34, 220, 220, 
+68, 68, 92, 
+92, 112, 112, 
+54, 54, 162, 
+162, 176, 176, 
+106, 106, 204, 
+204, 18, 180, 
+36, 36, 30, 
+100, 44, 44, 
+110, 110, 134, 
+134, 154, 154, 
+206, 206, 138, 
+138, 194, 194, 
+128, 128, 104, 
+104, 84, 84, 
+32, 202, 208, 
+208, 58, 172, 
+66, 152, 86, 
+};
+__ALIGNED(8) const uint16_t perm66[NB_PERM66]={
+128, 4, 4, 
+32, 32, 16, 
+16, 8, 8, 
+64, 64, 2, 
+160, 20, 20, 
+40, 40, 80, 
+80, 10, 10, 
+192, 192, 6, 
+96, 18, 18, 
+136, 136, 68, 
+68, 34, 34, 
+144, 144, 12, 
+224, 22, 22, 
+168, 168, 84, 
+84, 42, 42, 
+208, 208, 14, 
+72, 66, 66, 
+130, 130, 132, 
+132, 36, 36, 
+48, 48, 24, 
+200, 70, 70, 
+162, 162, 148, 
+148, 44, 44, 
+112, 112, 26, 
+104, 82, 82, 
+138, 138, 196, 
+196, 38, 38, 
+176, 176, 28, 
+232, 86, 86, 
+170, 170, 212, 
+212, 46, 46, 
+240, 240, 30, 
+152, 76, 76, 
+98, 98, 146, 
+146, 140, 140, 
+100, 100, 50, 
+56, 88, 88, 
+74, 74, 194, 
+194, 134, 134, 
+164, 164, 52, 
+184, 92, 92, 
+106, 106, 210, 
+210, 142, 142, 
+228, 228, 54, 
+216, 78, 78, 
+226, 226, 150, 
+150, 172, 172, 
+116, 116, 58, 
+120, 90, 90, 
+202, 202, 198, 
+198, 166, 166, 
+180, 180, 60, 
+248, 94, 94, 
+234, 234, 214, 
+214, 174, 174, 
+244, 244, 62, 
+178, 156, 156, 
+108, 108, 114, 
+114, 154, 154, 
+204, 204, 102, 
+242, 158, 158, 
+236, 236, 118, 
+118, 186, 186, 
+220, 220, 110, 
+218, 206, 206, 
+230, 230, 182, 
+182, 188, 188, 
+124, 124, 122, 
+250, 222, 222, 
+238, 238, 246, 
+246, 190, 190, 
+252, 252, 126, 
+};
+__ALIGNED(8) const uint16_t perm67[NB_PERM67]={
+96, 42, 42, 
+48, 48, 80, 
+80, 130, 130, 
+218, 218, 102, 
+102, 74, 74, 
+98, 98, 138, 
+138, 90, 90, 
+10, 10, 224, 
+224, 134, 134, 
+154, 154, 228, 
+228, 70, 70, 
+280, 280, 254, 
+254, 118, 118, 
+242, 242, 142, 
+142, 282, 282, 
+94, 94, 202, 
+202, 220, 220, 
+198, 198, 28, 
+28, 232, 232, 
+262, 262, 246, 
+246, 78, 78, 
+34, 34, 264, 
+264, 86, 86, 
+162, 162, 12, 
+12, 64, 64, 
+248, 248, 174, 
+174, 76, 76, 
+194, 194, 180, 
+180, 20, 20, 
+104, 104, 170, 
+170, 140, 140, 
+186, 186, 52, 
+52, 272, 272, 
+126, 126, 26, 
+26, 136, 136, 
+250, 250, 270, 
+270, 30, 30, 
+72, 72, 2, 
+192, 84, 84, 
+66, 66, 88, 
+88, 258, 258, 
+54, 54, 24, 
+24, 40, 40, 
+208, 208, 252, 
+252, 22, 22, 
+200, 200, 124, 
+124, 274, 274, 
+222, 222, 38, 
+38, 112, 112, 
+210, 210, 92, 
+92, 106, 106, 
+266, 266, 182, 
+182, 116, 116, 
+146, 146, 100, 
+100, 234, 234, 
+14, 14, 160, 
+160, 260, 260, 
+150, 150, 36, 
+36, 16, 16, 
+256, 256, 214, 
+214, 284, 284, 
+190, 190, 244, 
+244, 238, 238, 
+206, 206, 156, 
+156, 68, 68, 
+184, 184, 212, 
+212, 188, 188, 
+148, 148, 196, 
+196, 276, 276, 
+62, 62, 152, 
+152, 132, 132, 
+58, 58, 216, 
+216, 6, 6, 
+32, 32, 168, 
+168, 44, 44, 
+144, 144, 4, 
+128, 122, 122, 
+178, 178, 268, 
+268, 278, 278, 
+158, 158, 164, 
+164, 108, 108, 
+18, 18, 8, 
+240, 46, 176, 
+172, 172, 236, 
+236, 110, 110, 
+114, 114, 50, 
+120, 82, 82, 
+226, 226, 230, 
+230, 166, 166, 
+204, 204, 60, 
+60, 56, };
+__ALIGNED(8) const uint16_t perm68[NB_PERM68]={
+160, 24, 24, 
+90, 90, 252, 
+252, 156, 156, 
+134, 134, 204, 
+204, 126, 126, 
+312, 312, 118, 
+118, 232, 232, 
+106, 106, 262, 
+262, 208, 208, 
+16, 16, 10, 
+10, 240, 240, 
+36, 36, 60, 
+60, 150, 150, 
+214, 214, 216, 
+216, 96, 96, 
+22, 22, 210, 
+210, 176, 176, 
+34, 34, 180, 
+180, 74, 74, 
+242, 242, 196, 
+196, 46, 46, 
+300, 300, 148, 
+148, 54, 54, 
+230, 230, 226, 
+226, 186, 186, 
+274, 274, 178, 
+178, 194, 194, 
+166, 166, 224, 
+224, 26, 26, 
+250, 250, 276, 
+276, 58, 58, 
+270, 270, 288, 
+288, 28, 28, 
+130, 130, 164, 
+164, 64, 64, 
+2, 40, 100, 
+100, 62, 62, 
+310, 310, 238, 
+238, 306, 306, 
+198, 198, 206, 
+206, 286, 286, 
+298, 298, 268, 
+268, 128, 128, 
+4, 200, 86, 
+86, 212, 212, 
+56, 56, 110, 
+110, 302, 302, 
+308, 308, 78, 
+78, 282, 282, 
+258, 258, 168, 
+168, 104, 104, 
+102, 102, 222, 
+222, 296, 296, 
+108, 108, 142, 
+142, 284, 284, 
+138, 138, 244, 
+244, 76, 76, 
+122, 122, 272, 
+272, 18, 18, 
+170, 170, 264, 
+264, 88, 88, 
+92, 92, 132, 
+132, 44, 44, 
+140, 140, 124, 
+124, 152, 152, 
+94, 94, 292, 
+292, 68, 68, 
+42, 42, 260, 
+260, 48, 48, 
+30, 30, 290, 
+290, 188, 188, 
+154, 154, 254, 
+254, 316, 316, 
+158, 158, 294, 
+294, 228, 228, 
+66, 66, 162, 
+162, 184, 184, 
+114, 114, 192, 
+192, 6, 80, 
+12, 12, 120, 
+120, 112, 112, 
+32, 32, 20, 
+20, 50, 50, 
+190, 190, 314, 
+314, 278, 278, 
+218, 218, 256, 
+256, 8, 280, 
+98, 98, 182, 
+182, 234, 234, 
+266, 266, 248, 
+248, 116, 116, 
+72, 72, 82, 
+82, 172, 172, 
+144, 144, 14, 
+220, 136, 136, 
+84, 84, 52, 
+52, 70, 70, 
+202, 202, 246, 
+246, 236, 236, 
+146, 146, 174, 
+174, 304, 304, 
+38, };
+__ALIGNED(8) const uint16_t perm69[NB_PERM69]={
 128, 170, 170, 
 154, 154, 306, 
 306, 102, 102, 
@@ -7791,53 +6737,7 @@ __ALIGNED(8) const uint16_t perm71[NB_PERM71]={
 10, 288, 288, 
 6, 264, 28, 
 354, 118, };
-__ALIGNED(8) const uint16_t perm72[NB_PERM72]={
-72, 4, 4, 
-24, 24, 16, 
-16, 32, 32, 
-64, 64, 42, 
-42, 98, 98, 
-92, 92, 60, 
-60, 18, 18, 
-104, 104, 68, 
-68, 66, 66, 
-114, 114, 102, 
-102, 116, 116, 
-54, 54, 106, 
-106, 140, 140, 
-70, 70, 138, 
-138, 118, 118, 
-126, 126, 110, 
-110, 78, 78, 
-100, 100, 44, 
-44, 50, 50, 
-82, 82, 124, 
-124, 38, 38, 
-74, 74, 76, 
-76, 28, 28, 
-40, 40, 26, 
-26, 88, 88, 
-36, 36, 2, 
-96, 20, 20, 
-56, 56, 58, 
-58, 130, 130, 
-134, 134, 94, 
-94, 132, 132, 
-22, 22, 128, 
-128, 62, 62, 
-90, 90, 108, 
-108, 6, 48, 
-10, 10, 120, 
-120, 14, 14, 
-80, 80, 52, 
-52, 34, 34, 
-136, 136, 46, 
-46, 122, 122, 
-86, 86, 84, 
-84, 12, 12, 
-8, 112, 30, 
-};
-__ALIGNED(8) const uint16_t perm73[NB_PERM73]={
+__ALIGNED(8) const uint16_t perm70[NB_PERM70]={
 200, 124, 124, 
 172, 172, 154, 
 154, 342, 342, 
@@ -7967,58 +6867,7 @@ __ALIGNED(8) const uint16_t perm73[NB_PERM73]={
 326, 258, 258, 
 216, 216, 134, 
 };
-__ALIGNED(8) const uint16_t perm74[NB_PERM74]={
-40, 12, 12, 
-90, 90, 74, 
-74, 54, 54, 
-142, 142, 138, 
-138, 58, 58, 
-72, 72, 14, 
-14, 130, 130, 
-48, 48, 22, 
-22, 140, 140, 
-98, 98, 46, 
-46, 132, 132, 
-88, 88, 34, 
-34, 42, 42, 
-52, 52, 102, 
-102, 126, 126, 
-156, 156, 118, 
-118, 146, 146, 
-68, 68, 84, 
-84, 104, 104, 
-16, 16, 20, 
-20, 100, 100, 
-86, 86, 144, 
-144, 28, 28, 
-110, 110, 136, 
-136, 18, 18, 
-60, 60, 112, 
-112, 26, 26, 
-70, 70, 124, 
-124, 116, 116, 
-106, 106, 56, 
-56, 32, 32, 
-2, 80, 24, 
-24, 30, 30, 
-150, 150, 148, 
-148, 108, 108, 
-96, 96, 6, 
-6, 120, 120, 
-36, 36, 82, 
-82, 64, 64, 
-4, 10, 50, 
-50, 62, 62, 
-152, 152, 38, 
-38, 122, 122, 
-76, 76, 94, 
-94, 154, 154, 
-78, 78, 134, 
-134, 128, 128, 
-8, 92, 114, 
-114, 66, 66, 
-44, };
-__ALIGNED(8) const uint16_t perm75[NB_PERM75]={
+__ALIGNED(8) const uint16_t perm71[NB_PERM71]={
 216, 4, 4, 
 72, 72, 16, 
 16, 96, 96, 
@@ -8160,69 +7009,7 @@ __ALIGNED(8) const uint16_t perm75[NB_PERM75]={
 252, 12, 336, 
 30, 400, 94, 
 };
-__ALIGNED(8) const uint16_t perm76[NB_PERM76]={
-96, 4, 4, 
-32, 32, 80, 
-80, 82, 82, 
-178, 178, 182, 
-182, 126, 126, 
-148, 148, 38, 
-38, 120, 120, 
-20, 20, 72, 
-72, 18, 18, 
-136, 136, 60, 
-60, 10, 10, 
-160, 160, 46, 
-46, 184, 184, 
-62, 62, 106, 
-106, 164, 164, 
-78, 78, 146, 
-146, 102, 102, 
-132, 132, 28, 
-28, 48, 48, 
-2, 128, 84, 
-84, 26, 26, 
-112, 112, 44, 
-44, 88, 88, 
-58, 58, 162, 
-162, 142, 142, 
-188, 188, 94, 
-94, 186, 186, 
-158, 158, 110, 
-110, 108, 108, 
-12, 12, 8, 
-8, 64, 64, 
-42, 42, 152, 
-152, 70, 70, 
-170, 170, 118, 
-118, 172, 172, 
-54, 54, 130, 
-130, 180, 180, 
-30, 30, 144, 
-144, 6, 104, 
-68, 68, 74, 
-74, 114, 114, 
-140, 140, 92, 
-92, 90, 90, 
-154, 154, 166, 
-166, 174, 174, 
-150, 150, 134, 
-134, 124, 124, 
-52, 52, 34, 
-34, 176, 176, 
-86, 86, 122, 
-122, 116, 116, 
-76, 76, 50, 
-50, 98, 98, 
-100, 100, 36, 
-36, 24, 24, 
-16, 16, 40, 
-40, 56, 56, 
-66, 66, 138, 
-138, 156, 156, 
-14, 168, 22, 
-};
-__ALIGNED(8) const uint16_t perm77[NB_PERM77]={
+__ALIGNED(8) const uint16_t perm72[NB_PERM72]={
 160, 422, 422, 
 258, 258, 144, 
 144, 22, 22, 
@@ -8378,77 +7165,1290 @@ __ALIGNED(8) const uint16_t perm77[NB_PERM77]={
 74, 190, 190, 
 472, 472, 438, 
 438, 68, };
+__ALIGNED(8) const uint16_t perm73[NB_PERM73]={
+128, 2, 256, 
+4, 384, 6, 
+32, 8, 160, 
+10, 288, 12, 
+416, 14, 64, 
+16, 192, 18, 
+320, 20, 448, 
+22, 96, 24, 
+224, 26, 352, 
+28, 480, 30, 
+136, 34, 264, 
+36, 392, 38, 
+168, 42, 296, 
+44, 424, 46, 
+72, 48, 200, 
+50, 328, 52, 
+456, 54, 104, 
+56, 232, 58, 
+360, 60, 488, 
+62, 144, 66, 
+272, 68, 400, 
+70, 176, 74, 
+304, 76, 432, 
+78, 208, 82, 
+336, 84, 464, 
+86, 112, 88, 
+240, 90, 368, 
+92, 496, 94, 
+152, 98, 280, 
+100, 408, 102, 
+184, 106, 312, 
+108, 440, 110, 
+216, 114, 344, 
+116, 472, 118, 
+248, 122, 376, 
+124, 504, 126, 
+258, 132, 386, 
+134, 162, 138, 
+290, 140, 418, 
+142, 194, 146, 
+322, 148, 450, 
+150, 226, 154, 
+354, 156, 482, 
+158, 266, 164, 
+394, 166, 298, 
+172, 426, 174, 
+202, 178, 330, 
+180, 458, 182, 
+234, 186, 362, 
+188, 490, 190, 
+274, 196, 402, 
+198, 306, 204, 
+434, 206, 338, 
+212, 466, 214, 
+242, 218, 370, 
+220, 498, 222, 
+282, 228, 410, 
+230, 314, 236, 
+442, 238, 346, 
+244, 474, 246, 
+378, 252, 506, 
+254, 388, 262, 
+292, 268, 420, 
+270, 324, 276, 
+452, 278, 356, 
+284, 484, 286, 
+396, 294, 428, 
+302, 332, 308, 
+460, 310, 364, 
+316, 492, 318, 
+404, 326, 436, 
+334, 468, 342, 
+372, 348, 500, 
+350, 412, 358, 
+444, 366, 476, 
+374, 508, 382, 
+422, 398, 454, 
+406, 486, 414, 
+462, 438, 494, 
+446, 502, 478, 
+};
+__ALIGNED(8) const uint16_t perm74[NB_PERM74]={
+288, 4, 4, 
+96, 96, 80, 
+80, 208, 208, 
+170, 170, 354, 
+354, 460, 460, 
+166, 166, 514, 
+514, 502, 502, 
+558, 558, 446, 
+446, 326, 326, 
+300, 300, 36, 
+36, 8, 8, 
+192, 192, 42, 
+42, 392, 392, 
+276, 276, 90, 
+90, 432, 432, 
+6, 6, 384, 
+384, 84, 84, 
+48, 48, 40, 
+40, 104, 104, 
+272, 272, 250, 
+250, 562, 562, 
+542, 542, 318, 
+318, 452, 452, 
+230, 230, 338, 
+338, 332, 332, 
+204, 204, 74, 
+74, 304, 304, 
+132, 132, 88, 
+88, 144, 144, 
+2, 480, 46, 
+46, 488, 488, 
+238, 238, 530, 
+530, 374, 374, 
+340, 340, 140, 
+140, 280, 280, 
+186, 186, 394, 
+394, 564, 564, 
+94, 94, 528, 
+528, 86, 86, 
+336, 336, 44, 
+44, 200, 200, 
+234, 234, 434, 
+434, 294, 294, 
+388, 388, 180, 
+180, 10, 32, 
+256, 256, 122, 
+122, 344, 344, 
+236, 236, 242, 
+242, 370, 370, 
+500, 500, 270, 
+270, 442, 442, 
+486, 486, 430, 
+430, 572, 572, 
+286, 286, 570, 
+570, 478, 478, 
+494, 494, 366, 
+366, 404, 404, 
+220, 220, 114, 
+114, 408, 408, 
+60, 60, 72, 
+72, 16, 16, 
+128, 128, 248, 
+248, 274, 274, 
+538, 538, 566, 
+566, 382, 382, 
+532, 532, 182, 
+182, 298, 298, 
+484, 484, 142, 
+142, 568, 568, 
+190, 190, 490, 
+490, 526, 526, 
+534, 534, 470, 
+470, 302, 302, 
+324, 324, 12, 
+320, 260, 260, 
+218, 218, 306, 
+306, 420, 420, 
+92, 92, 240, 
+240, 82, 82, 
+496, 496, 174, 
+174, 450, 450, 
+422, 422, 380, 
+380, 244, 244, 
+178, 178, 546, 
+546, 414, 414, 
+444, 444, 38, 
+38, 296, 296, 
+196, 196, 138, 
+138, 472, 472, 
+110, 110, 312, 
+312, 68, 68, 
+264, 264, 58, 
+58, 520, 520, 
+150, 150, 386, 
+386, 372, 372, 
+52, 52, 136, 
+136, 184, 184, 
+106, 106, 560, 
+560, 254, 254, 
+314, 314, 356, 
+356, 268, 268, 
+154, 154, 482, 
+482, 334, 334, 
+492, 492, 78, 
+78, 400, 400, 
+124, 124, 152, 
+152, 194, 194, 
+330, 330, 396, 
+396, 28, 28, 
+160, 160, 130, 
+130, 536, 536, 
+278, 278, 378, 
+378, 436, 436, 
+102, 102, 464, 
+464, 262, 262, 
+506, 506, 310, 
+310, 516, 516, 
+54, 54, 424, 
+424, 188, 188, 
+202, 202, 522, 
+522, 438, 438, 
+390, 390, 468, 
+468, 14, 416, 
+252, 252, 26, 
+26, 352, 352, 
+172, 172, 162, 
+162, 418, 418, 
+540, 540, 30, 
+30, 448, 448, 
+134, 134, 376, 
+376, 148, 148, 
+98, 98, 368, 
+368, 212, 212, 
+266, 266, 346, 
+346, 524, 524, 
+246, 246, 466, 
+466, 550, 550, 
+510, 510, 406, 
+406, 508, 508, 
+118, 118, 504, 
+504, 22, 22, 
+512, 512, 214, 
+214, 554, 554, 
+350, 350, 364, 
+364, 116, 116, 
+216, 216, 18, 
+224, 210, 210, 
+458, 458, 358, 
+358, 556, 556, 
+158, 158, 322, 
+322, 548, 548, 
+222, 222, 402, 
+402, 412, 412, 
+156, 156, 34, 
+34, 544, 544, 
+126, 126, 440, 
+440, 198, 198, 
+426, 426, 476, 
+476, 206, 206, 
+362, 362, 308, 
+308, 228, 228, 
+50, 50, 328, 
+328, 108, 108, 
+24, 24, 64, 
+64, 168, 168, 
+66, 66, 456, 
+456, 70, 70, 
+552, 552, 62, 
+62, 360, 360, 
+20, 232, 146, 
+146, 290, 290, 
+292, 292, 100, 
+100, 176, 176, 
+258, 258, 410, 
+410, 348, 348, 
+76, 76, 112, 
+112, 120, 120, 
+56, 226, 498, 
+498, 462, 462, 
+454, 454, 518, 
+518, 342, 342, 
+428, 428, 284, 
+284, 282, 282, 
+474, 474, 398, 
+398, 316, 316, 
+164, };
+__ALIGNED(8) const uint16_t perm75[NB_PERM75]={
+160, 12, 12, 
+360, 360, 74, 
+74, 220, 220, 
+462, 462, 546, 
+546, 178, 178, 
+252, 252, 472, 
+472, 146, 146, 
+242, 242, 272, 
+272, 84, 84, 
+420, 420, 336, 
+336, 104, 104, 
+70, 70, 500, 
+500, 436, 436, 
+416, 416, 16, 
+16, 80, 80, 
+100, 100, 350, 
+350, 624, 624, 
+118, 118, 590, 
+590, 548, 548, 
+338, 338, 264, 
+264, 44, 44, 
+370, 370, 274, 
+274, 244, 244, 
+432, 432, 96, 
+96, 30, 30, 
+600, 600, 148, 
+148, 402, 402, 
+246, 246, 592, 
+592, 108, 108, 
+390, 390, 486, 
+486, 516, 516, 
+328, 328, 64, 
+64, 20, 20, 
+400, 400, 86, 
+86, 580, 580, 
+348, 348, 464, 
+464, 106, 106, 
+230, 230, 512, 
+512, 8, 8, 
+40, 40, 50, 
+50, 250, 250, 
+312, 312, 134, 
+134, 482, 482, 
+196, 196, 342, 
+342, 584, 584, 
+68, 68, 340, 
+340, 424, 424, 
+56, 56, 130, 
+130, 162, 162, 
+172, 172, 372, 
+372, 434, 434, 
+256, 256, 4, 
+4, 320, 320, 
+24, 24, 120, 
+120, 150, 150, 
+562, 562, 258, 
+258, 164, 164, 
+332, 332, 384, 
+384, 6, 6, 
+480, 480, 36, 
+36, 330, 330, 
+224, 224, 32, 
+32, 10, 10, 
+200, 200, 62, 
+62, 610, 610, 
+198, 198, 502, 
+502, 596, 596, 
+428, 428, 376, 
+376, 154, 154, 
+282, 282, 284, 
+284, 444, 444, 
+456, 456, 66, 
+66, 180, 180, 
+412, 412, 446, 
+446, 616, 616, 
+78, 78, 540, 
+540, 448, 448, 
+26, 26, 280, 
+280, 124, 124, 
+470, 470, 586, 
+586, 228, 228, 
+352, 352, 34, 
+34, 170, 170, 
+212, 212, 422, 
+422, 496, 496, 
+116, 116, 430, 
+430, 536, 536, 
+128, 128, 2, 
+520, 48, 48, 
+90, 90, 300, 
+300, 374, 374, 
+594, 594, 268, 
+268, 364, 364, 
+394, 394, 206, 
+206, 542, 542, 
+608, 608, 38, 
+38, 490, 490, 
+236, 236, 392, 
+392, 46, 46, 
+530, 530, 248, 
+248, 152, 152, 
+122, 122, 310, 
+310, 574, 574, 
+618, 618, 238, 
+238, 552, 552, 
+58, 58, 290, 
+290, 174, 174, 
+532, 532, 408, 
+408, 126, 126, 
+630, 630, 598, 
+598, 588, 588, 
+388, 388, 326, 
+326, 504, 504, 
+156, 156, 442, 
+442, 296, 296, 
+54, 54, 570, 
+570, 298, 298, 
+214, 214, 582, 
+582, 508, 508, 
+476, 476, 466, 
+466, 266, 266, 
+204, 204, 382, 
+382, 634, 634, 
+318, 318, 614, 
+614, 518, 518, 
+488, 488, 76, 
+76, 380, 380, 
+474, 474, 306, 
+306, 254, 254, 
+632, 632, 158, 
+158, 602, 602, 
+308, 308, 414, 
+414, 606, 606, 
+628, 628, 438, 
+438, 576, 576, 
+28, 28, 440, 
+440, 136, 136, 
+42, 42, 210, 
+210, 262, 262, 
+484, 484, 356, 
+356, 354, 354, 
+194, 194, 182, 
+182, 572, 572, 
+458, 458, 226, 
+226, 192, 192, 
+22, 22, 560, 
+560, 98, 98, 
+190, 190, 612, 
+612, 358, 358, 
+514, 514, 168, 
+168, 52, 52, 
+410, 410, 286, 
+286, 604, 604, 
+468, 468, 426, 
+426, 216, 216, 
+142, 142, 522, 
+522, 208, 208, 
+102, 102, 510, 
+510, 636, 636, 
+478, 478, 626, 
+626, 278, 278, 
+564, 564, 418, 
+418, 176, 176, 
+92, 92, 460, 
+460, 386, 386, 
+166, 166, 492, 
+492, 396, 396, 
+366, 366, 554, 
+554, 218, 218, 
+302, 302, 534, 
+534, 568, 568, 
+138, 138, 202, 
+202, 222, 222, 
+622, 622, 558, 
+558, 538, 538, 
+288, 288, 14, 
+240, 112, 112, 
+110, 110, 550, 
+550, 498, 498, 
+276, 276, 404, 
+404, 406, 406, 
+566, 566, 578, 
+578, 188, 188, 
+452, 452, 346, 
+346, 304, 304, 
+94, 94, 620, 
+620, 398, 398, 
+526, 526, 528, 
+528, 88, 88, 
+140, 140, 362, 
+362, 234, 234, 
+232, 232, 72, 
+72, 60, 60, 
+450, 450, 186, 
+186, 292, 292, 
+334, 334, 544, 
+544, 18, 260, 
+324, 324, 344, 
+344, 144, 144, 
+82, 270, 524, 
+524, 368, 368, 
+114, 322, 184, 
+184, 132, 494, 
+556, 556, 378, 
+378, 314, 314, 
+294, 454, 506, 
+506, 316, };
+__ALIGNED(8) const uint16_t perm76[NB_PERM76]={
+384, 4, 4, 
+128, 128, 336, 
+336, 26, 26, 
+448, 448, 172, 
+172, 216, 216, 
+66, 66, 552, 
+552, 92, 92, 
+360, 360, 90, 
+90, 616, 616, 
+230, 230, 482, 
+482, 404, 404, 
+292, 292, 146, 
+146, 408, 408, 
+68, 68, 296, 
+296, 274, 274, 
+714, 714, 630, 
+630, 526, 526, 
+756, 756, 126, 
+126, 592, 592, 
+166, 166, 696, 
+696, 86, 86, 
+488, 488, 276, 
+276, 106, 106, 
+656, 656, 334, 
+334, 754, 754, 
+734, 734, 446, 
+446, 428, 428, 
+356, 356, 314, 
+314, 466, 466, 
+716, 716, 374, 
+374, 506, 506, 
+468, 468, 108, 
+108, 48, 48, 
+8, 8, 256, 
+256, 170, 170, 
+472, 472, 236, 
+236, 354, 354, 
+570, 570, 636, 
+636, 46, 46, 
+736, 736, 190, 
+190, 760, 760, 
+254, 254, 426, 
+426, 612, 612, 
+102, 102, 528, 
+528, 28, 28, 
+192, 192, 2, 
+512, 340, 340, 
+154, 154, 664, 
+664, 238, 238, 
+738, 738, 574, 
+574, 764, 764, 
+382, 382, 762, 
+762, 638, 638, 
+430, 430, 740, 
+740, 318, 318, 
+594, 594, 550, 
+550, 700, 700, 
+214, 214, 674, 
+674, 406, 406, 
+676, 676, 150, 
+150, 536, 536, 
+284, 284, 362, 
+362, 474, 474, 
+620, 620, 358, 
+358, 698, 698, 
+470, 470, 492, 
+492, 52, 52, 
+136, 136, 240, 
+240, 10, 10, 
+640, 640, 174, 
+174, 600, 600, 
+70, 70, 680, 
+680, 278, 278, 
+490, 490, 660, 
+660, 110, 110, 
+432, 432, 12, 
+12, 32, 32, 
+320, 320, 338, 
+338, 410, 410, 
+452, 452, 300, 
+300, 50, 50, 
+392, 392, 260, 
+260, 298, 298, 
+658, 658, 718, 
+718, 758, 758, 
+510, 510, 596, 
+596, 294, 294, 
+530, 530, 412, 
+412, 196, 196, 
+130, 130, 720, 
+720, 30, 30, 
+576, 576, 6, 
+416, 324, 324, 
+114, 114, 560, 
+560, 348, 348, 
+58, 58, 648, 
+648, 78, 78, 
+584, 584, 262, 
+262, 682, 682, 
+662, 662, 494, 
+494, 436, 436, 
+140, 140, 368, 
+368, 346, 346, 
+666, 666, 622, 
+622, 742, 742, 
+702, 702, 598, 
+598, 678, 678, 
+534, 534, 540, 
+540, 60, 60, 
+40, 40, 224, 
+224, 322, 322, 
+722, 722, 414, 
+414, 580, 580, 
+134, 134, 496, 
+496, 180, 180, 
+120, 120, 80, 
+80, 328, 328, 
+242, 242, 394, 
+394, 644, 644, 
+302, 302, 434, 
+434, 396, 396, 
+36, 36, 96, 
+96, 16, 16, 
+160, 160, 184, 
+184, 248, 248, 
+266, 266, 458, 
+458, 460, 460, 
+204, 204, 34, 
+34, 704, 704, 
+342, 342, 538, 
+538, 668, 668, 
+366, 366, 602, 
+602, 454, 454, 
+684, 684, 54, 
+54, 520, 520, 
+244, 244, 138, 
+138, 624, 624, 
+14, 544, 188, 
+188, 376, 376, 
+250, 250, 650, 
+650, 462, 462, 
+588, 588, 38, 
+38, 480, 480, 
+20, 20, 288, 
+288, 18, 672, 
+22, 64, 168, 
+168, 88, 88, 
+232, 232, 226, 
+226, 706, 706, 
+726, 726, 542, 
+542, 444, 444, 
+44, 44, 352, 
+352, 186, 186, 
+632, 632, 270, 
+270, 586, 586, 
+646, 646, 686, 
+686, 438, 438, 
+524, 524, 372, 
+372, 122, 122, 
+464, 464, 332, 
+332, 370, 370, 
+730, 730, 670, 
+670, 750, 750, 
+606, 606, 582, 
+582, 518, 518, 
+500, 500, 308, 
+308, 306, 306, 
+562, 562, 732, 
+732, 62, 62, 
+424, 424, 228, 
+228, 98, 98, 
+400, 400, 164, 
+164, 312, 312, 
+82, 82, 712, 
+712, 246, 246, 
+522, 522, 628, 
+628, 142, 142, 
+752, 752, 350, 
+350, 442, 442, 
+652, 652, 206, 
+206, 418, 418, 
+708, 708, 118, 
+118, 688, 688, 
+182, 182, 504, 
+504, 84, 84, 
+104, 104, 272, 
+272, 330, 330, 
+626, 626, 398, 
+398, 420, 420, 
+100, 100, 144, 
+144, 24, 608, 
+326, 326, 498, 
+498, 564, 564, 
+124, 124, 208, 
+208, 162, 162, 
+568, 568, 252, 
+252, 42, 264, 
+74, 74, 456, 
+456, 76, 76, 
+200, 200, 258, 
+258, 554, 554, 
+476, 476, 364, 
+364, 218, 218, 
+450, 450, 556, 
+556, 220, 220, 
+194, 194, 386, 
+386, 388, 388, 
+132, 132, 112, 
+112, 176, 176, 
+344, 344, 282, 
+282, 618, 618, 
+614, 614, 486, 
+486, 532, 532, 
+156, 156, 56, 
+744, 94, 304, 
+178, 178, 728, 
+728, 286, 286, 
+746, 746, 478, 
+478, 748, 748, 
+222, 222, 578, 
+578, 390, 390, 
+516, 516, 116, 
+152, 280, 280, 
+234, 234, 610, 
+610, 710, 710, 
+502, 502, 692, 
+692, 310, 310, 
+690, 690, 566, 
+566, 508, 508, 
+212, 212, 290, 
+290, 402, 402, 
+548, 548, 316, 
+316, 210, 210, 
+546, 546, 572, 
+572, 380, 380, 
+378, 378, 634, 
+634, 654, 654, 
+590, 590, 422, 
+422, 484, 484, 
+148, 440, 268, 
+268, 202, 202, 
+642, 642, 558, 
+558, 604, 604, 
+198, 198, 514, 
+514, 724, 724, 
+158, };
+__ALIGNED(8) const uint16_t perm77[NB_PERM77]={
+200, 62, 62, 
+760, 760, 188, 
+188, 552, 552, 
+76, 76, 470, 
+470, 744, 744, 
+88, 88, 170, 
+170, 252, 252, 
+572, 572, 576, 
+576, 36, 36, 
+410, 410, 374, 
+374, 714, 714, 
+278, 278, 732, 
+732, 578, 578, 
+236, 236, 472, 
+472, 194, 194, 
+212, 212, 512, 
+512, 16, 16, 
+100, 100, 430, 
+430, 684, 684, 
+468, 468, 544, 
+544, 26, 26, 
+350, 350, 754, 
+754, 338, 338, 
+304, 304, 142, 
+142, 690, 690, 
+318, 318, 792, 
+792, 198, 198, 
+612, 612, 446, 
+446, 784, 784, 
+148, 148, 540, 
+540, 566, 566, 
+726, 726, 728, 
+728, 178, 178, 
+302, 302, 692, 
+692, 518, 518, 
+616, 616, 96, 
+96, 30, 30, 
+750, 750, 688, 
+688, 118, 118, 
+730, 730, 378, 
+378, 364, 364, 
+464, 464, 144, 
+144, 140, 140, 
+490, 490, 256, 
+256, 32, 32, 
+10, 10, 250, 
+250, 372, 372, 
+514, 514, 216, 
+216, 162, 162, 
+202, 202, 262, 
+262, 632, 632, 
+196, 196, 412, 
+412, 574, 574, 
+776, 776, 98, 
+98, 230, 230, 
+622, 622, 696, 
+696, 168, 168, 
+52, 52, 510, 
+510, 756, 756, 
+538, 538, 366, 
+366, 664, 664, 
+158, 158, 790, 
+790, 748, 748, 
+488, 488, 56, 
+56, 160, 160, 
+2, 400, 124, 
+124, 580, 580, 
+436, 436, 534, 
+534, 716, 716, 
+478, 478, 794, 
+794, 398, 398, 
+674, 674, 218, 
+218, 362, 362, 
+264, 264, 82, 
+82, 320, 320, 
+4, 600, 186, 
+186, 352, 352, 
+14, 14, 650, 
+650, 258, 258, 
+232, 232, 72, 
+72, 70, 70, 
+620, 620, 496, 
+496, 106, 106, 
+280, 280, 182, 
+182, 702, 702, 
+768, 768, 48, 
+48, 110, 110, 
+680, 680, 68, 
+68, 420, 420, 
+434, 434, 334, 
+334, 654, 654, 
+658, 658, 308, 
+308, 542, 542, 
+766, 766, 788, 
+788, 548, 548, 
+426, 426, 284, 
+284, 582, 582, 
+636, 636, 596, 
+596, 536, 536, 
+166, 166, 602, 
+602, 386, 386, 
+224, 224, 22, 
+22, 700, 700, 
+568, 568, 176, 
+176, 102, 102, 
+630, 630, 746, 
+746, 288, 288, 
+42, 42, 260, 
+260, 432, 432, 
+134, 134, 640, 
+640, 8, 8, 
+50, 50, 310, 
+310, 742, 742, 
+638, 638, 796, 
+796, 598, 598, 
+736, 736, 38, 
+38, 610, 610, 
+246, 246, 722, 
+722, 328, 328, 
+54, 54, 710, 
+710, 628, 628, 
+546, 546, 226, 
+226, 222, 222, 
+762, 762, 388, 
+388, 424, 424, 
+84, 84, 520, 
+520, 66, 66, 
+220, 220, 562, 
+562, 326, 326, 
+604, 604, 586, 
+586, 286, 286, 
+782, 782, 698, 
+698, 368, 368, 
+114, 114, 330, 
+330, 254, 254, 
+772, 772, 448, 
+448, 44, 44, 
+460, 460, 494, 
+494, 656, 656, 
+108, 108, 480, 
+480, 6, 450, 
+244, 244, 522, 
+522, 266, 266, 
+282, 282, 382, 
+382, 764, 764, 
+588, 588, 486, 
+486, 606, 606, 
+786, 786, 348, 
+348, 554, 554, 
+276, 276, 532, 
+532, 516, 516, 
+416, 416, 34, 
+34, 210, 210, 
+312, 312, 192, 
+192, 12, 300, 
+492, 492, 456, 
+456, 94, 94, 
+770, 770, 248, 
+248, 172, 172, 
+452, 452, 444, 
+444, 584, 584, 
+86, 86, 720, 
+720, 128, 128, 
+40, 40, 60, 
+60, 560, 560, 
+126, 126, 780, 
+780, 498, 498, 
+306, 306, 342, 
+342, 704, 704, 
+28, 28, 550, 
+550, 626, 626, 
+346, 346, 354, 
+354, 214, 214, 
+712, 712, 78, 
+78, 670, 670, 
+758, 758, 738, 
+738, 238, 238, 
+672, 672, 18, 
+500, 506, 506, 
+356, 356, 414, 
+414, 774, 774, 
+648, 648, 58, 
+58, 360, 360, 
+64, 64, 20, 
+150, 740, 740, 
+438, 438, 734, 
+734, 778, 778, 
+298, 298, 292, 
+292, 442, 442, 
+384, 384, 24, 
+660, 508, 508, 
+556, 556, 476, 
+476, 594, 594, 
+336, 336, 104, 
+104, 80, 80, 
+120, 120, 180, 
+180, 502, 502, 
+706, 706, 228, 
+228, 422, 422, 
+634, 634, 396, 
+396, 474, 474, 
+394, 394, 274, 
+274, 332, 332, 
+454, 454, 644, 
+644, 408, 408, 
+174, 174, 652, 
+652, 458, 458, 
+294, 294, 642, 
+642, 208, 208, 
+112, 112, 130, 
+130, 240, 240, 
+122, 122, 380, 
+380, 564, 564, 
+526, 526, 666, 
+666, 358, 358, 
+614, 614, 646, 
+646, 608, 608, 
+46, 270, 682, 
+682, 268, 268, 
+482, 482, 206, 
+206, 662, 662, 
+708, 708, 428, 
+428, 484, 484, 
+406, 406, 724, 
+724, 528, 528, 
+116, 116, 530, 
+530, 316, 316, 
+592, 592, 136, 
+136, 90, 90, 
+370, 370, 314, 
+314, 392, 392, 
+74, 570, 376, 
+376, 164, 164, 
+402, 402, 324, 
+324, 404, 404, 
+524, 524, 466, 
+466, 344, 344, 
+154, 154, 390, 
+390, 624, 624, 
+146, 146, 340, 
+340, 504, 504, 
+156, 156, 590, 
+590, 686, 686, 
+668, 668, 558, 
+558, 676, 676, 
+418, 418, 234, 
+234, 272, 272, 
+132, 132, 440, 
+440, 184, 184, 
+152, 152, 190, 
+190, 752, 752, 
+138, 138, 290, 
+290, 242, 242, 
+322, 322, 204, 
+204, 462, 462, 
+694, 694, 718, 
+718, 678, 678, 
+618, 618, 296, 
+296, 92, };
 __ALIGNED(8) const uint16_t perm78[NB_PERM78]={
-120, 24, 24, 
-20, 20, 90, 
-90, 192, 192, 
-8, 8, 80, 
-80, 102, 102, 
-164, 164, 96, 
-96, 4, 4, 
-40, 40, 70, 
-70, 212, 212, 
-98, 98, 124, 
-124, 64, 64, 
-52, 52, 42, 
-42, 190, 190, 
-236, 236, 118, 
-118, 214, 214, 
-218, 218, 148, 
-148, 46, 46, 
-230, 230, 158, 
-158, 136, 136, 
-74, 74, 142, 
-142, 234, 234, 
-198, 198, 168, 
-168, 26, 26, 
-140, 140, 114, 
-114, 174, 174, 
-186, 186, 196, 
-196, 48, 48, 
-2, 160, 56, 
-56, 82, 82, 
-222, 222, 188, 
-188, 116, 116, 
-94, 94, 232, 
-232, 78, 78, 
-182, 182, 156, 
-156, 16, 16, 
-50, 50, 122, 
-122, 144, 144, 
-6, 200, 88, 
-88, 72, 72, 
-22, 22, 210, 
-210, 178, 178, 
-226, 226, 228, 
-228, 38, 38, 
-150, 150, 166, 
-166, 216, 216, 
-28, 28, 60, 
-60, 12, 12, 
-10, 130, 224, 
-224, 108, 108, 
-14, 170, 146, 
-146, 126, 126, 
-184, 184, 76, 
-76, 62, 62, 
-132, 132, 34, 
-34, 220, 220, 
-68, 68, 92, 
-92, 112, 112, 
-54, 54, 162, 
-162, 176, 176, 
-106, 106, 204, 
-204, 18, 180, 
-36, 36, 30, 
-100, 44, 44, 
-110, 110, 134, 
-134, 154, 154, 
-206, 206, 138, 
-138, 194, 194, 
-128, 128, 104, 
-104, 84, 84, 
-32, 202, 208, 
-208, 58, 172, 
-66, 152, 86, 
-};
+512, 4, 4, 
+128, 128, 16, 
+16, 32, 32, 
+64, 64, 8, 
+8, 256, 256, 
+2, 640, 20, 
+20, 160, 160, 
+80, 80, 40, 
+40, 320, 320, 
+10, 10, 768, 
+768, 6, 384, 
+18, 18, 544, 
+544, 68, 68, 
+136, 136, 272, 
+272, 34, 34, 
+576, 576, 12, 
+896, 22, 22, 
+672, 672, 84, 
+84, 168, 168, 
+336, 336, 42, 
+42, 832, 832, 
+14, 288, 66, 
+66, 520, 520, 
+260, 260, 130, 
+130, 528, 528, 
+36, 36, 192, 
+192, 24, 800, 
+70, 70, 648, 
+648, 276, 276, 
+162, 162, 592, 
+592, 44, 44, 
+448, 448, 26, 
+416, 82, 82, 
+552, 552, 324, 
+324, 138, 138, 
+784, 784, 38, 
+38, 704, 704, 
+28, 928, 86, 
+86, 680, 680, 
+340, 340, 170, 
+170, 848, 848, 
+46, 46, 960, 
+960, 30, 96, 
+72, 72, 264, 
+264, 258, 258, 
+514, 514, 516, 
+516, 132, 132, 
+144, 144, 48, 
+608, 76, 76, 
+392, 392, 274, 
+274, 546, 546, 
+580, 580, 140, 
+140, 400, 400, 
+50, 224, 88, 
+88, 296, 296, 
+322, 322, 522, 
+522, 772, 772, 
+134, 134, 656, 
+656, 52, 736, 
+92, 92, 424, 
+424, 338, 338, 
+554, 554, 836, 
+836, 142, 142, 
+912, 912, 54, 
+352, 74, 74, 
+776, 776, 262, 
+262, 642, 642, 
+532, 532, 164, 
+164, 208, 208, 
+56, 864, 78, 
+78, 904, 904, 
+278, 278, 674, 
+674, 596, 596, 
+172, 172, 464, 
+464, 58, 480, 
+90, 90, 808, 
+808, 326, 326, 
+650, 650, 788, 
+788, 166, 166, 
+720, 720, 60, 
+992, 94, 94, 
+936, 936, 342, 
+342, 682, 682, 
+852, 852, 174, 
+174, 976, 976, 
+62, 584, 268, 
+268, 386, 386, 
+530, 530, 548, 
+548, 196, 196, 
+152, 152, 304, 
+304, 98, 200, 
+280, 280, 290, 
+290, 578, 578, 
+524, 524, 388, 
+388, 146, 146, 
+560, 560, 100, 
+712, 284, 284, 
+418, 418, 594, 
+594, 556, 556, 
+452, 452, 154, 
+154, 816, 816, 
+102, 328, 266, 
+266, 770, 770, 
+518, 518, 644, 
+644, 148, 148, 
+176, 176, 112, 
+112, 104, 840, 
+270, 270, 898, 
+898, 534, 534, 
+676, 676, 212, 
+212, 184, 184, 
+368, 368, 106, 
+456, 282, 282, 
+802, 802, 582, 
+582, 652, 652, 
+404, 404, 178, 
+178, 624, 624, 
+108, 968, 286, 
+286, 930, 930, 
+598, 598, 684, 
+684, 468, 468, 
+186, 186, 880, 
+880, 110, 616, 
+332, 332, 394, 
+394, 786, 786, 
+550, 550, 708, 
+708, 156, 156, 
+432, 432, 114, 
+232, 344, 344, 
+298, 298, 834, 
+834, 526, 526, 
+900, 900, 150, 
+150, 688, 688, 
+116, 744, 348, 
+348, 426, 426, 
+850, 850, 558, 
+558, 964, 964, 
+158, 158, 944, 
+944, 118, 360, 
+330, 330, 778, 
+778, 774, 774, 
+646, 646, 660, 
+660, 180, 180, 
+240, 240, 120, 
+872, 334, 334, 
+906, 906, 790, 
+790, 678, 678, 
+724, 724, 188, 
+188, 496, 496, 
+122, 488, 346, 
+346, 810, 810, 
+838, 838, 654, 
+654, 916, 916, 
+182, 182, 752, 
+752, 124, 1000, 
+350, 350, 938, 
+938, 854, 854, 
+686, 686, 980, 
+980, 190, 190, 
+1008, 1008, 126, 
+536, 292, 292, 
+194, 664, 308, 
+308, 226, 226, 
+600, 600, 300, 
+300, 450, 450, 
+538, 538, 804, 
+804, 198, 792, 
+294, 294, 706, 
+706, 540, 540, 
+420, 420, 210, 
+210, 568, 568, 
+356, 356, 202, 
+408, 306, 306, 
+610, 610, 588, 
+588, 396, 396, 
+402, 402, 562, 
+562, 612, 612, 
+204, 920, 310, 
+310, 738, 738, 
+604, 604, 428, 
+428, 466, 466, 
+570, 570, 868, 
+868, 206, 696, 
+372, 372, 234, 
+234, 856, 856, 
+302, 302, 962, 
+962, 542, 542, 
+932, 932, 214, 
+312, 354, 354, 
+586, 586, 780, 
+780, 390, 390, 
+658, 658, 564, 
+564, 228, 228, 
+216, 824, 358, 
+358, 714, 714, 
+796, 796, 422, 
+422, 722, 722, 
+572, 572, 484, 
+484, 218, 440, 
+370, 370, 618, 
+618, 844, 844, 
+398, 398, 914, 
+914, 566, 566, 
+740, 740, 220, 
+952, 374, 374, 
+746, 746, 860, 
+860, 430, 430, 
+978, 978, 574, 
+574, 996, 996, 
+222, 728, 316, 
+316, 482, 482, 
+602, 602, 812, 
+812, 454, 454, 
+666, 666, 820, 
+820, 230, 472, 
+314, 314, 866, 
+866, 590, 590, 
+908, 908, 406, 
+406, 690, 690, 
+628, 628, 236, 
+984, 318, 318, 
+994, 994, 606, 
+606, 940, 940, 
+470, 470, 698, 
+698, 884, 884, 
+238, 632, 364, 
+364, 458, 458, 
+794, 794, 806, 
+806, 710, 710, 
+668, 668, 436, 
+436, 242, 248, 
+376, 376, 362, 
+362, 842, 842, 
+782, 782, 902, 
+902, 662, 662, 
+692, 692, 244, 
+760, 380, 380, 
+490, 490, 858, 
+858, 814, 814, 
+966, 966, 670, 
+670, 948, 948, 
+246, 888, 366, 
+366, 970, 970, 
+798, 798, 934, 
+934, 726, 726, 
+700, 700, 500, 
+500, 250, 504, 
+378, 378, 874, 
+874, 846, 846, 
+910, 910, 918, 
+918, 694, 694, 
+756, 756, 252, 
+1016, 382, 382, 
+1002, 1002, 862, 
+862, 942, 942, 
+982, 982, 702, 
+702, 1012, 1012, 
+254, 818, 614, 
+614, 716, 716, 
+412, 412, 434, 
+434, 626, 626, 
+620, 620, 460, 
+460, 410, 946, 
+630, 630, 748, 
+748, 476, 476, 
+442, 442, 882, 
+882, 622, 622, 
+972, 972, 414, 
+754, 636, 636, 
+492, 492, 474, 
+474, 826, 826, 
+870, 870, 718, 
+718, 924, 924, 
+438, 498, 634, 
+634, 876, 876, 
+462, 462, 922, 
+922, 822, 822, 
+742, 742, 732, 
+732, 444, 1010, 
+638, 638, 1004, 
+1004, 478, 478, 
+954, 954, 886, 
+886, 750, 750, 
+988, 988, 446, 
+730, 828, 828, 
+486, 986, 830, 
+830, 998, 998, 
+734, 734, 956, 
+956, 502, 502, 
+762, 762, 892, 
+892, 494, 890, 
+878, 878, 974, 
+974, 926, 926, 
+950, 950, 758, 
+758, 764, 764, 
+508, 508, 506, 
+1018, 894, 894, 
+1006, 1006, 990, 
+990, 958, 958, 
+1014, 1014, 766, 
+766, 1020, 1020, 
+510, };
@@ -5,238 +5,238 @@
 
 
 
-#define NB_PERM1 440
+#define NB_PERM1 0
 extern __ALIGNED(8) const uint16_t perm1[NB_PERM1];
 
-#define NB_PERM2 4032
+#define NB_PERM2 0
 extern __ALIGNED(8) const uint16_t perm2[NB_PERM2];
 
 #define NB_PERM3 0
 extern __ALIGNED(8) const uint16_t perm3[NB_PERM3];
 
-#define NB_PERM4 0
+#define NB_PERM4 6
 extern __ALIGNED(8) const uint16_t perm4[NB_PERM4];
 
-#define NB_PERM5 0
+#define NB_PERM5 8
 extern __ALIGNED(8) const uint16_t perm5[NB_PERM5];
 
-#define NB_PERM6 0
+#define NB_PERM6 12
 extern __ALIGNED(8) const uint16_t perm6[NB_PERM6];
 
-#define NB_PERM7 6
+#define NB_PERM7 0
 extern __ALIGNED(8) const uint16_t perm7[NB_PERM7];
 
-#define NB_PERM8 448
+#define NB_PERM8 0
 extern __ALIGNED(8) const uint16_t perm8[NB_PERM8];
 
-#define NB_PERM9 0
+#define NB_PERM9 6
 extern __ALIGNED(8) const uint16_t perm9[NB_PERM9];
 
-#define NB_PERM10 6
+#define NB_PERM10 12
 extern __ALIGNED(8) const uint16_t perm10[NB_PERM10];
 
-#define NB_PERM11 12
+#define NB_PERM11 16
 extern __ALIGNED(8) const uint16_t perm11[NB_PERM11];
 
-#define NB_PERM12 208
+#define NB_PERM12 20
 extern __ALIGNED(8) const uint16_t perm12[NB_PERM12];
 
-#define NB_PERM13 16
+#define NB_PERM13 20
 extern __ALIGNED(8) const uint16_t perm13[NB_PERM13];
 
-#define NB_PERM14 748
+#define NB_PERM14 24
 extern __ALIGNED(8) const uint16_t perm14[NB_PERM14];
 
-#define NB_PERM15 20
+#define NB_PERM15 32
 extern __ALIGNED(8) const uint16_t perm15[NB_PERM15];
 
-#define NB_PERM16 20
+#define NB_PERM16 40
 extern __ALIGNED(8) const uint16_t perm16[NB_PERM16];
 
-#define NB_PERM17 268
+#define NB_PERM17 20
 extern __ALIGNED(8) const uint16_t perm17[NB_PERM17];
 
-#define NB_PERM18 24
+#define NB_PERM18 18
 extern __ALIGNED(8) const uint16_t perm18[NB_PERM18];
 
-#define NB_PERM19 760
+#define NB_PERM19 54
 extern __ALIGNED(8) const uint16_t perm19[NB_PERM19];
 
-#define NB_PERM20 32
+#define NB_PERM20 48
 extern __ALIGNED(8) const uint16_t perm20[NB_PERM20];
 
-#define NB_PERM21 282
+#define NB_PERM21 60
 extern __ALIGNED(8) const uint16_t perm21[NB_PERM21];
 
-#define NB_PERM22 40
+#define NB_PERM22 56
 extern __ALIGNED(8) const uint16_t perm22[NB_PERM22];
 
-#define NB_PERM23 20
+#define NB_PERM23 78
 extern __ALIGNED(8) const uint16_t perm23[NB_PERM23];
 
-#define NB_PERM24 18
+#define NB_PERM24 88
 extern __ALIGNED(8) const uint16_t perm24[NB_PERM24];
 
-#define NB_PERM25 54
+#define NB_PERM25 80
 extern __ALIGNED(8) const uint16_t perm25[NB_PERM25];
 
-#define NB_PERM26 48
+#define NB_PERM26 90
 extern __ALIGNED(8) const uint16_t perm26[NB_PERM26];
 
-#define NB_PERM27 564
+#define NB_PERM27 108
 extern __ALIGNED(8) const uint16_t perm27[NB_PERM27];
 
-#define NB_PERM28 960
+#define NB_PERM28 56
 extern __ALIGNED(8) const uint16_t perm28[NB_PERM28];
 
-#define NB_PERM29 308
+#define NB_PERM29 132
 extern __ALIGNED(8) const uint16_t perm29[NB_PERM29];
 
-#define NB_PERM30 60
+#define NB_PERM30 132
 extern __ALIGNED(8) const uint16_t perm30[NB_PERM30];
 
-#define NB_PERM31 56
+#define NB_PERM31 132
 extern __ALIGNED(8) const uint16_t perm31[NB_PERM31];
 
-#define NB_PERM32 78
+#define NB_PERM32 72
 extern __ALIGNED(8) const uint16_t perm32[NB_PERM32];
 
-#define NB_PERM33 88
+#define NB_PERM33 168
 extern __ALIGNED(8) const uint16_t perm33[NB_PERM33];
 
-#define NB_PERM34 80
+#define NB_PERM34 184
 extern __ALIGNED(8) const uint16_t perm34[NB_PERM34];
 
-#define NB_PERM35 340
+#define NB_PERM35 188
 extern __ALIGNED(8) const uint16_t perm35[NB_PERM35];
 
-#define NB_PERM36 90
+#define NB_PERM36 204
 extern __ALIGNED(8) const uint16_t perm36[NB_PERM36];
 
-#define NB_PERM37 108
+#define NB_PERM37 224
 extern __ALIGNED(8) const uint16_t perm37[NB_PERM37];
 
-#define NB_PERM38 56
+#define NB_PERM38 100
 extern __ALIGNED(8) const uint16_t perm38[NB_PERM38];
 
-#define NB_PERM39 568
+#define NB_PERM39 208
 extern __ALIGNED(8) const uint16_t perm39[NB_PERM39];
 
-#define NB_PERM40 3720
+#define NB_PERM40 268
 extern __ALIGNED(8) const uint16_t perm40[NB_PERM40];
 
-#define NB_PERM41 364
+#define NB_PERM41 282
 extern __ALIGNED(8) const uint16_t perm41[NB_PERM41];
 
-#define NB_PERM42 132
+#define NB_PERM42 308
 extern __ALIGNED(8) const uint16_t perm42[NB_PERM42];
 
-#define NB_PERM43 336
+#define NB_PERM43 340
 extern __ALIGNED(8) const uint16_t perm43[NB_PERM43];
 
-#define NB_PERM44 132
+#define NB_PERM44 364
 extern __ALIGNED(8) const uint16_t perm44[NB_PERM44];
 
-#define NB_PERM45 132
+#define NB_PERM45 336
 extern __ALIGNED(8) const uint16_t perm45[NB_PERM45];
 
-#define NB_PERM46 72
+#define NB_PERM46 412
 extern __ALIGNED(8) const uint16_t perm46[NB_PERM46];
 
-#define NB_PERM47 412
+#define NB_PERM47 468
 extern __ALIGNED(8) const uint16_t perm47[NB_PERM47];
 
-#define NB_PERM48 168
+#define NB_PERM48 440
 extern __ALIGNED(8) const uint16_t perm48[NB_PERM48];
 
-#define NB_PERM49 184
+#define NB_PERM49 564
 extern __ALIGNED(8) const uint16_t perm49[NB_PERM49];
 
-#define NB_PERM50 188
+#define NB_PERM50 568
 extern __ALIGNED(8) const uint16_t perm50[NB_PERM50];
 
-#define NB_PERM51 204
+#define NB_PERM51 748
 extern __ALIGNED(8) const uint16_t perm51[NB_PERM51];
 
-#define NB_PERM52 468
+#define NB_PERM52 760
 extern __ALIGNED(8) const uint16_t perm52[NB_PERM52];
 
-#define NB_PERM53 224
+#define NB_PERM53 448
 extern __ALIGNED(8) const uint16_t perm53[NB_PERM53];
 
-#define NB_PERM54 100
+#define NB_PERM54 960
 extern __ALIGNED(8) const uint16_t perm54[NB_PERM54];
 
-#define NB_PERM55 240
+#define NB_PERM55 3720
 extern __ALIGNED(8) const uint16_t perm55[NB_PERM55];
 
-#define NB_PERM56 904
+#define NB_PERM56 4032
 extern __ALIGNED(8) const uint16_t perm56[NB_PERM56];
 
-#define NB_PERM57 8
+#define NB_PERM57 40
 extern __ALIGNED(8) const uint16_t perm57[NB_PERM57];
 
-#define NB_PERM58 216
+#define NB_PERM58 48
 extern __ALIGNED(8) const uint16_t perm58[NB_PERM58];
 
-#define NB_PERM59 736
+#define NB_PERM59 68
 extern __ALIGNED(8) const uint16_t perm59[NB_PERM59];
 
-#define NB_PERM60 12
+#define NB_PERM60 84
 extern __ALIGNED(8) const uint16_t perm60[NB_PERM60];
 
-#define NB_PERM61 272
+#define NB_PERM61 48
 extern __ALIGNED(8) const uint16_t perm61[NB_PERM61];
 
-#define NB_PERM62 776
+#define NB_PERM62 132
 extern __ALIGNED(8) const uint16_t perm62[NB_PERM62];
 
-#define NB_PERM63 40
+#define NB_PERM63 148
 extern __ALIGNED(8) const uint16_t perm63[NB_PERM63];
 
-#define NB_PERM64 48
+#define NB_PERM64 180
 extern __ALIGNED(8) const uint16_t perm64[NB_PERM64];
 
-#define NB_PERM65 556
+#define NB_PERM65 216
 extern __ALIGNED(8) const uint16_t perm65[NB_PERM65];
 
-#define NB_PERM66 304
+#define NB_PERM66 216
 extern __ALIGNED(8) const uint16_t perm66[NB_PERM66];
 
-#define NB_PERM67 68
+#define NB_PERM67 272
 extern __ALIGNED(8) const uint16_t perm67[NB_PERM67];
 
-#define NB_PERM68 84
+#define NB_PERM68 304
 extern __ALIGNED(8) const uint16_t perm68[NB_PERM68];
 
-#define NB_PERM69 48
+#define NB_PERM69 368
 extern __ALIGNED(8) const uint16_t perm69[NB_PERM69];
 
-#define NB_PERM70 620
+#define NB_PERM70 384
 extern __ALIGNED(8) const uint16_t perm70[NB_PERM70];
 
-#define NB_PERM71 368
+#define NB_PERM71 420
 extern __ALIGNED(8) const uint16_t perm71[NB_PERM71];
 
-#define NB_PERM72 132
+#define NB_PERM72 464
 extern __ALIGNED(8) const uint16_t perm72[NB_PERM72];
 
-#define NB_PERM73 384
+#define NB_PERM73 240
 extern __ALIGNED(8) const uint16_t perm73[NB_PERM73];
 
-#define NB_PERM74 148
+#define NB_PERM74 556
 extern __ALIGNED(8) const uint16_t perm74[NB_PERM74];
 
-#define NB_PERM75 420
+#define NB_PERM75 620
 extern __ALIGNED(8) const uint16_t perm75[NB_PERM75];
 
-#define NB_PERM76 180
+#define NB_PERM76 736
 extern __ALIGNED(8) const uint16_t perm76[NB_PERM76];
 
-#define NB_PERM77 464
+#define NB_PERM77 776
 extern __ALIGNED(8) const uint16_t perm77[NB_PERM77];
 
-#define NB_PERM78 216
+#define NB_PERM78 904
 extern __ALIGNED(8) const uint16_t perm78[NB_PERM78];
 
 
@@ -6,266 +6,248 @@
 
 
 using namespace FFTSCI;
-#define NB_TWIDDLE1 512
-extern __ALIGNED(8) const float32_t twiddle1[NB_TWIDDLE1];
+#define NB_TWIDDLE1 4
+extern __ALIGNED(8) const Q7 twiddle1[NB_TWIDDLE1];
 
-#define NB_TWIDDLE2 8192
-extern __ALIGNED(8) const float32_t twiddle2[NB_TWIDDLE2];
+#define NB_TWIDDLE2 6
+extern __ALIGNED(8) const Q7 twiddle2[NB_TWIDDLE2];
 
-#define NB_TWIDDLE3 4
-extern __ALIGNED(8) const float32_t twiddle3[NB_TWIDDLE3];
+#define NB_TWIDDLE3 8
+extern __ALIGNED(8) const Q7 twiddle3[NB_TWIDDLE3];
 
-#define NB_TWIDDLE4 6
-extern __ALIGNED(8) const float32_t twiddle4[NB_TWIDDLE4];
+#define NB_TWIDDLE4 12
+extern __ALIGNED(8) const Q7 twiddle4[NB_TWIDDLE4];
 
-#define NB_TWIDDLE5 8
-extern __ALIGNED(8) const float32_t twiddle5[NB_TWIDDLE5];
+#define NB_TWIDDLE5 16
+extern __ALIGNED(8) const Q7 twiddle5[NB_TWIDDLE5];
 
-#define NB_TWIDDLE6 10
-extern __ALIGNED(8) const float32_t twiddle6[NB_TWIDDLE6];
+#define NB_TWIDDLE6 32
+extern __ALIGNED(8) const Q7 twiddle6[NB_TWIDDLE6];
 
-#define NB_TWIDDLE7 12
+#define NB_TWIDDLE7 4
 extern __ALIGNED(8) const float32_t twiddle7[NB_TWIDDLE7];
 
-#define NB_TWIDDLE8 1024
+#define NB_TWIDDLE8 6
 extern __ALIGNED(8) const float32_t twiddle8[NB_TWIDDLE8];
 
-#define NB_TWIDDLE9 16
+#define NB_TWIDDLE9 8
 extern __ALIGNED(8) const float32_t twiddle9[NB_TWIDDLE9];
 
-#define NB_TWIDDLE10 18
+#define NB_TWIDDLE10 10
 extern __ALIGNED(8) const float32_t twiddle10[NB_TWIDDLE10];
 
-#define NB_TWIDDLE11 20
+#define NB_TWIDDLE11 12
 extern __ALIGNED(8) const float32_t twiddle11[NB_TWIDDLE11];
 
-#define NB_TWIDDLE12 256
+#define NB_TWIDDLE12 16
 extern __ALIGNED(8) const float32_t twiddle12[NB_TWIDDLE12];
 
-#define NB_TWIDDLE13 24
+#define NB_TWIDDLE13 18
 extern __ALIGNED(8) const float32_t twiddle13[NB_TWIDDLE13];
 
-#define NB_TWIDDLE14 768
+#define NB_TWIDDLE14 20
 extern __ALIGNED(8) const float32_t twiddle14[NB_TWIDDLE14];
 
-#define NB_TWIDDLE15 30
+#define NB_TWIDDLE15 24
 extern __ALIGNED(8) const float32_t twiddle15[NB_TWIDDLE15];
 
-#define NB_TWIDDLE16 32
+#define NB_TWIDDLE16 30
 extern __ALIGNED(8) const float32_t twiddle16[NB_TWIDDLE16];
 
-#define NB_TWIDDLE17 288
+#define NB_TWIDDLE17 32
 extern __ALIGNED(8) const float32_t twiddle17[NB_TWIDDLE17];
 
 #define NB_TWIDDLE18 36
 extern __ALIGNED(8) const float32_t twiddle18[NB_TWIDDLE18];
 
-#define NB_TWIDDLE19 800
+#define NB_TWIDDLE19 40
 extern __ALIGNED(8) const float32_t twiddle19[NB_TWIDDLE19];
 
-#define NB_TWIDDLE20 40
+#define NB_TWIDDLE20 48
 extern __ALIGNED(8) const float32_t twiddle20[NB_TWIDDLE20];
 
-#define NB_TWIDDLE21 300
+#define NB_TWIDDLE21 50
 extern __ALIGNED(8) const float32_t twiddle21[NB_TWIDDLE21];
 
-#define NB_TWIDDLE22 48
+#define NB_TWIDDLE22 54
 extern __ALIGNED(8) const float32_t twiddle22[NB_TWIDDLE22];
 
-#define NB_TWIDDLE23 50
+#define NB_TWIDDLE23 60
 extern __ALIGNED(8) const float32_t twiddle23[NB_TWIDDLE23];
 
-#define NB_TWIDDLE24 54
+#define NB_TWIDDLE24 64
 extern __ALIGNED(8) const float32_t twiddle24[NB_TWIDDLE24];
 
-#define NB_TWIDDLE25 60
+#define NB_TWIDDLE25 72
 extern __ALIGNED(8) const float32_t twiddle25[NB_TWIDDLE25];
 
-#define NB_TWIDDLE26 64
+#define NB_TWIDDLE26 80
 extern __ALIGNED(8) const float32_t twiddle26[NB_TWIDDLE26];
 
-#define NB_TWIDDLE27 576
+#define NB_TWIDDLE27 90
 extern __ALIGNED(8) const float32_t twiddle27[NB_TWIDDLE27];
 
-#define NB_TWIDDLE28 2048
+#define NB_TWIDDLE28 96
 extern __ALIGNED(8) const float32_t twiddle28[NB_TWIDDLE28];
 
-#define NB_TWIDDLE29 320
+#define NB_TWIDDLE29 100
 extern __ALIGNED(8) const float32_t twiddle29[NB_TWIDDLE29];
 
-#define NB_TWIDDLE30 72
+#define NB_TWIDDLE30 108
 extern __ALIGNED(8) const float32_t twiddle30[NB_TWIDDLE30];
 
-#define NB_TWIDDLE31 80
+#define NB_TWIDDLE31 120
 extern __ALIGNED(8) const float32_t twiddle31[NB_TWIDDLE31];
 
-#define NB_TWIDDLE32 90
+#define NB_TWIDDLE32 128
 extern __ALIGNED(8) const float32_t twiddle32[NB_TWIDDLE32];
 
-#define NB_TWIDDLE33 96
+#define NB_TWIDDLE33 144
 extern __ALIGNED(8) const float32_t twiddle33[NB_TWIDDLE33];
 
-#define NB_TWIDDLE34 100
+#define NB_TWIDDLE34 150
 extern __ALIGNED(8) const float32_t twiddle34[NB_TWIDDLE34];
 
-#define NB_TWIDDLE35 360
+#define NB_TWIDDLE35 160
 extern __ALIGNED(8) const float32_t twiddle35[NB_TWIDDLE35];
 
-#define NB_TWIDDLE36 108
+#define NB_TWIDDLE36 162
 extern __ALIGNED(8) const float32_t twiddle36[NB_TWIDDLE36];
 
-#define NB_TWIDDLE37 120
+#define NB_TWIDDLE37 180
 extern __ALIGNED(8) const float32_t twiddle37[NB_TWIDDLE37];
 
-#define NB_TWIDDLE38 128
+#define NB_TWIDDLE38 192
 extern __ALIGNED(8) const float32_t twiddle38[NB_TWIDDLE38];
 
-#define NB_TWIDDLE39 640
+#define NB_TWIDDLE39 200
 extern __ALIGNED(8) const float32_t twiddle39[NB_TWIDDLE39];
 
-#define NB_TWIDDLE40 4096
+#define NB_TWIDDLE40 216
 extern __ALIGNED(8) const float32_t twiddle40[NB_TWIDDLE40];
 
-#define NB_TWIDDLE41 384
+#define NB_TWIDDLE41 240
 extern __ALIGNED(8) const float32_t twiddle41[NB_TWIDDLE41];
 
-#define NB_TWIDDLE42 144
+#define NB_TWIDDLE42 250
 extern __ALIGNED(8) const float32_t twiddle42[NB_TWIDDLE42];
 
-#define NB_TWIDDLE43 400
+#define NB_TWIDDLE43 256
 extern __ALIGNED(8) const float32_t twiddle43[NB_TWIDDLE43];
 
-#define NB_TWIDDLE44 150
+#define NB_TWIDDLE44 288
 extern __ALIGNED(8) const float32_t twiddle44[NB_TWIDDLE44];
 
-#define NB_TWIDDLE45 160
+#define NB_TWIDDLE45 300
 extern __ALIGNED(8) const float32_t twiddle45[NB_TWIDDLE45];
 
-#define NB_TWIDDLE46 162
+#define NB_TWIDDLE46 320
 extern __ALIGNED(8) const float32_t twiddle46[NB_TWIDDLE46];
 
-#define NB_TWIDDLE47 432
+#define NB_TWIDDLE47 360
 extern __ALIGNED(8) const float32_t twiddle47[NB_TWIDDLE47];
 
-#define NB_TWIDDLE48 180
+#define NB_TWIDDLE48 384
 extern __ALIGNED(8) const float32_t twiddle48[NB_TWIDDLE48];
 
-#define NB_TWIDDLE49 192
+#define NB_TWIDDLE49 400
 extern __ALIGNED(8) const float32_t twiddle49[NB_TWIDDLE49];
 
-#define NB_TWIDDLE50 200
+#define NB_TWIDDLE50 432
 extern __ALIGNED(8) const float32_t twiddle50[NB_TWIDDLE50];
 
-#define NB_TWIDDLE51 216
+#define NB_TWIDDLE51 480
 extern __ALIGNED(8) const float32_t twiddle51[NB_TWIDDLE51];
 
-#define NB_TWIDDLE52 480
+#define NB_TWIDDLE52 512
 extern __ALIGNED(8) const float32_t twiddle52[NB_TWIDDLE52];
 
-#define NB_TWIDDLE53 240
+#define NB_TWIDDLE53 576
 extern __ALIGNED(8) const float32_t twiddle53[NB_TWIDDLE53];
 
-#define NB_TWIDDLE54 250
+#define NB_TWIDDLE54 640
 extern __ALIGNED(8) const float32_t twiddle54[NB_TWIDDLE54];
 
-#if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE55 512
-extern __ALIGNED(8) const float16_t twiddle55[NB_TWIDDLE55];
+#define NB_TWIDDLE55 768
+extern __ALIGNED(8) const float32_t twiddle55[NB_TWIDDLE55];
 
-#endif
+#define NB_TWIDDLE56 800
+extern __ALIGNED(8) const float32_t twiddle56[NB_TWIDDLE56];
 
-#if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE56 8192
-extern __ALIGNED(8) const float16_t twiddle56[NB_TWIDDLE56];
+#define NB_TWIDDLE57 1024
+extern __ALIGNED(8) const float32_t twiddle57[NB_TWIDDLE57];
 
-#endif
+#define NB_TWIDDLE58 2048
+extern __ALIGNED(8) const float32_t twiddle58[NB_TWIDDLE58];
 
-#if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE57 4
-extern __ALIGNED(8) const float16_t twiddle57[NB_TWIDDLE57];
+#define NB_TWIDDLE59 4096
+extern __ALIGNED(8) const float32_t twiddle59[NB_TWIDDLE59];
 
-#endif
+#define NB_TWIDDLE60 8192
+extern __ALIGNED(8) const float32_t twiddle60[NB_TWIDDLE60];
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE58 6
-extern __ALIGNED(8) const float16_t twiddle58[NB_TWIDDLE58];
-
-#endif
-
-#if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE59 8
-extern __ALIGNED(8) const float16_t twiddle59[NB_TWIDDLE59];
-
-#endif
-
-#if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE60 10
-extern __ALIGNED(8) const float16_t twiddle60[NB_TWIDDLE60];
-
-#endif
-
-#if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE61 12
+#define NB_TWIDDLE61 4
 extern __ALIGNED(8) const float16_t twiddle61[NB_TWIDDLE61];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE62 1024
+#define NB_TWIDDLE62 6
 extern __ALIGNED(8) const float16_t twiddle62[NB_TWIDDLE62];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE63 16
+#define NB_TWIDDLE63 8
 extern __ALIGNED(8) const float16_t twiddle63[NB_TWIDDLE63];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE64 18
+#define NB_TWIDDLE64 10
 extern __ALIGNED(8) const float16_t twiddle64[NB_TWIDDLE64];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE65 20
+#define NB_TWIDDLE65 12
 extern __ALIGNED(8) const float16_t twiddle65[NB_TWIDDLE65];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE66 256
+#define NB_TWIDDLE66 16
 extern __ALIGNED(8) const float16_t twiddle66[NB_TWIDDLE66];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE67 24
+#define NB_TWIDDLE67 18
 extern __ALIGNED(8) const float16_t twiddle67[NB_TWIDDLE67];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE68 768
+#define NB_TWIDDLE68 20
 extern __ALIGNED(8) const float16_t twiddle68[NB_TWIDDLE68];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE69 30
+#define NB_TWIDDLE69 24
 extern __ALIGNED(8) const float16_t twiddle69[NB_TWIDDLE69];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE70 32
+#define NB_TWIDDLE70 30
 extern __ALIGNED(8) const float16_t twiddle70[NB_TWIDDLE70];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE71 288
+#define NB_TWIDDLE71 32
 extern __ALIGNED(8) const float16_t twiddle71[NB_TWIDDLE71];
 
 #endif
@@ -277,1145 +259,1190 @@ extern __ALIGNED(8) const float16_t twiddle72[NB_TWIDDLE72];
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE73 800
+#define NB_TWIDDLE73 40
 extern __ALIGNED(8) const float16_t twiddle73[NB_TWIDDLE73];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE74 40
+#define NB_TWIDDLE74 48
 extern __ALIGNED(8) const float16_t twiddle74[NB_TWIDDLE74];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE75 300
+#define NB_TWIDDLE75 50
 extern __ALIGNED(8) const float16_t twiddle75[NB_TWIDDLE75];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE76 48
+#define NB_TWIDDLE76 54
 extern __ALIGNED(8) const float16_t twiddle76[NB_TWIDDLE76];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE77 50
+#define NB_TWIDDLE77 60
 extern __ALIGNED(8) const float16_t twiddle77[NB_TWIDDLE77];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE78 54
+#define NB_TWIDDLE78 64
 extern __ALIGNED(8) const float16_t twiddle78[NB_TWIDDLE78];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE79 60
+#define NB_TWIDDLE79 72
 extern __ALIGNED(8) const float16_t twiddle79[NB_TWIDDLE79];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE80 64
+#define NB_TWIDDLE80 80
 extern __ALIGNED(8) const float16_t twiddle80[NB_TWIDDLE80];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE81 576
+#define NB_TWIDDLE81 90
 extern __ALIGNED(8) const float16_t twiddle81[NB_TWIDDLE81];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE82 2048
+#define NB_TWIDDLE82 96
 extern __ALIGNED(8) const float16_t twiddle82[NB_TWIDDLE82];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE83 320
+#define NB_TWIDDLE83 100
 extern __ALIGNED(8) const float16_t twiddle83[NB_TWIDDLE83];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE84 72
+#define NB_TWIDDLE84 108
 extern __ALIGNED(8) const float16_t twiddle84[NB_TWIDDLE84];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE85 80
+#define NB_TWIDDLE85 120
 extern __ALIGNED(8) const float16_t twiddle85[NB_TWIDDLE85];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE86 90
+#define NB_TWIDDLE86 128
 extern __ALIGNED(8) const float16_t twiddle86[NB_TWIDDLE86];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE87 96
+#define NB_TWIDDLE87 144
 extern __ALIGNED(8) const float16_t twiddle87[NB_TWIDDLE87];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE88 100
+#define NB_TWIDDLE88 150
 extern __ALIGNED(8) const float16_t twiddle88[NB_TWIDDLE88];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE89 360
+#define NB_TWIDDLE89 160
 extern __ALIGNED(8) const float16_t twiddle89[NB_TWIDDLE89];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE90 108
+#define NB_TWIDDLE90 162
 extern __ALIGNED(8) const float16_t twiddle90[NB_TWIDDLE90];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE91 120
+#define NB_TWIDDLE91 180
 extern __ALIGNED(8) const float16_t twiddle91[NB_TWIDDLE91];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE92 128
+#define NB_TWIDDLE92 192
 extern __ALIGNED(8) const float16_t twiddle92[NB_TWIDDLE92];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE93 640
+#define NB_TWIDDLE93 200
 extern __ALIGNED(8) const float16_t twiddle93[NB_TWIDDLE93];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE94 4096
+#define NB_TWIDDLE94 216
 extern __ALIGNED(8) const float16_t twiddle94[NB_TWIDDLE94];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE95 384
+#define NB_TWIDDLE95 240
 extern __ALIGNED(8) const float16_t twiddle95[NB_TWIDDLE95];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE96 144
+#define NB_TWIDDLE96 250
 extern __ALIGNED(8) const float16_t twiddle96[NB_TWIDDLE96];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE97 400
+#define NB_TWIDDLE97 256
 extern __ALIGNED(8) const float16_t twiddle97[NB_TWIDDLE97];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE98 150
+#define NB_TWIDDLE98 288
 extern __ALIGNED(8) const float16_t twiddle98[NB_TWIDDLE98];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE99 160
+#define NB_TWIDDLE99 300
 extern __ALIGNED(8) const float16_t twiddle99[NB_TWIDDLE99];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE100 162
+#define NB_TWIDDLE100 320
 extern __ALIGNED(8) const float16_t twiddle100[NB_TWIDDLE100];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE101 432
+#define NB_TWIDDLE101 360
 extern __ALIGNED(8) const float16_t twiddle101[NB_TWIDDLE101];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE102 180
+#define NB_TWIDDLE102 384
 extern __ALIGNED(8) const float16_t twiddle102[NB_TWIDDLE102];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE103 192
+#define NB_TWIDDLE103 400
 extern __ALIGNED(8) const float16_t twiddle103[NB_TWIDDLE103];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE104 200
+#define NB_TWIDDLE104 432
 extern __ALIGNED(8) const float16_t twiddle104[NB_TWIDDLE104];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE105 216
+#define NB_TWIDDLE105 480
 extern __ALIGNED(8) const float16_t twiddle105[NB_TWIDDLE105];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE106 480
+#define NB_TWIDDLE106 512
 extern __ALIGNED(8) const float16_t twiddle106[NB_TWIDDLE106];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE107 240
+#define NB_TWIDDLE107 576
 extern __ALIGNED(8) const float16_t twiddle107[NB_TWIDDLE107];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE108 250
+#define NB_TWIDDLE108 640
 extern __ALIGNED(8) const float16_t twiddle108[NB_TWIDDLE108];
 
 #endif
 
-#define NB_TWIDDLE109 512
-extern __ALIGNED(8) const Q31 twiddle109[NB_TWIDDLE109];
+#if defined(ARM_FLOAT16_SUPPORTED)
+#define NB_TWIDDLE109 768
+extern __ALIGNED(8) const float16_t twiddle109[NB_TWIDDLE109];
+
+#endif
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+#define NB_TWIDDLE110 800
+extern __ALIGNED(8) const float16_t twiddle110[NB_TWIDDLE110];
+
+#endif
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+#define NB_TWIDDLE111 1024
+extern __ALIGNED(8) const float16_t twiddle111[NB_TWIDDLE111];
 
-#define NB_TWIDDLE110 8192
-extern __ALIGNED(8) const Q31 twiddle110[NB_TWIDDLE110];
+#endif
 
-#define NB_TWIDDLE111 4
-extern __ALIGNED(8) const Q31 twiddle111[NB_TWIDDLE111];
+#if defined(ARM_FLOAT16_SUPPORTED)
+#define NB_TWIDDLE112 2048
+extern __ALIGNED(8) const float16_t twiddle112[NB_TWIDDLE112];
 
-#define NB_TWIDDLE112 6
-extern __ALIGNED(8) const Q31 twiddle112[NB_TWIDDLE112];
+#endif
 
-#define NB_TWIDDLE113 8
-extern __ALIGNED(8) const Q31 twiddle113[NB_TWIDDLE113];
+#if defined(ARM_FLOAT16_SUPPORTED)
+#define NB_TWIDDLE113 4096
+extern __ALIGNED(8) const float16_t twiddle113[NB_TWIDDLE113];
 
-#define NB_TWIDDLE114 10
-extern __ALIGNED(8) const Q31 twiddle114[NB_TWIDDLE114];
+#endif
 
-#define NB_TWIDDLE115 12
+#if defined(ARM_FLOAT16_SUPPORTED)
+#define NB_TWIDDLE114 8192
+extern __ALIGNED(8) const float16_t twiddle114[NB_TWIDDLE114];
+
+#endif
+
+#define NB_TWIDDLE115 4
 extern __ALIGNED(8) const Q31 twiddle115[NB_TWIDDLE115];
 
-#define NB_TWIDDLE116 1024
+#define NB_TWIDDLE116 6
 extern __ALIGNED(8) const Q31 twiddle116[NB_TWIDDLE116];
 
-#define NB_TWIDDLE117 16
+#define NB_TWIDDLE117 8
 extern __ALIGNED(8) const Q31 twiddle117[NB_TWIDDLE117];
 
-#define NB_TWIDDLE118 18
+#define NB_TWIDDLE118 10
 extern __ALIGNED(8) const Q31 twiddle118[NB_TWIDDLE118];
 
-#define NB_TWIDDLE119 20
+#define NB_TWIDDLE119 12
 extern __ALIGNED(8) const Q31 twiddle119[NB_TWIDDLE119];
 
-#define NB_TWIDDLE120 256
+#define NB_TWIDDLE120 16
 extern __ALIGNED(8) const Q31 twiddle120[NB_TWIDDLE120];
 
-#define NB_TWIDDLE121 24
+#define NB_TWIDDLE121 18
 extern __ALIGNED(8) const Q31 twiddle121[NB_TWIDDLE121];
 
-#define NB_TWIDDLE122 768
+#define NB_TWIDDLE122 20
 extern __ALIGNED(8) const Q31 twiddle122[NB_TWIDDLE122];
 
-#define NB_TWIDDLE123 30
+#define NB_TWIDDLE123 24
 extern __ALIGNED(8) const Q31 twiddle123[NB_TWIDDLE123];
 
-#define NB_TWIDDLE124 32
+#define NB_TWIDDLE124 30
 extern __ALIGNED(8) const Q31 twiddle124[NB_TWIDDLE124];
 
-#define NB_TWIDDLE125 288
+#define NB_TWIDDLE125 32
 extern __ALIGNED(8) const Q31 twiddle125[NB_TWIDDLE125];
 
 #define NB_TWIDDLE126 36
 extern __ALIGNED(8) const Q31 twiddle126[NB_TWIDDLE126];
 
-#define NB_TWIDDLE127 800
+#define NB_TWIDDLE127 40
 extern __ALIGNED(8) const Q31 twiddle127[NB_TWIDDLE127];
 
-#define NB_TWIDDLE128 40
+#define NB_TWIDDLE128 48
 extern __ALIGNED(8) const Q31 twiddle128[NB_TWIDDLE128];
 
-#define NB_TWIDDLE129 300
+#define NB_TWIDDLE129 50
 extern __ALIGNED(8) const Q31 twiddle129[NB_TWIDDLE129];
 
-#define NB_TWIDDLE130 48
+#define NB_TWIDDLE130 54
 extern __ALIGNED(8) const Q31 twiddle130[NB_TWIDDLE130];
 
-#define NB_TWIDDLE131 50
+#define NB_TWIDDLE131 60
 extern __ALIGNED(8) const Q31 twiddle131[NB_TWIDDLE131];
 
-#define NB_TWIDDLE132 54
+#define NB_TWIDDLE132 64
 extern __ALIGNED(8) const Q31 twiddle132[NB_TWIDDLE132];
 
-#define NB_TWIDDLE133 60
+#define NB_TWIDDLE133 72
 extern __ALIGNED(8) const Q31 twiddle133[NB_TWIDDLE133];
 
-#define NB_TWIDDLE134 64
+#define NB_TWIDDLE134 80
 extern __ALIGNED(8) const Q31 twiddle134[NB_TWIDDLE134];
 
-#define NB_TWIDDLE135 576
+#define NB_TWIDDLE135 90
 extern __ALIGNED(8) const Q31 twiddle135[NB_TWIDDLE135];
 
-#define NB_TWIDDLE136 2048
+#define NB_TWIDDLE136 96
 extern __ALIGNED(8) const Q31 twiddle136[NB_TWIDDLE136];
 
-#define NB_TWIDDLE137 320
+#define NB_TWIDDLE137 100
 extern __ALIGNED(8) const Q31 twiddle137[NB_TWIDDLE137];
 
-#define NB_TWIDDLE138 72
+#define NB_TWIDDLE138 108
 extern __ALIGNED(8) const Q31 twiddle138[NB_TWIDDLE138];
 
-#define NB_TWIDDLE139 80
+#define NB_TWIDDLE139 120
 extern __ALIGNED(8) const Q31 twiddle139[NB_TWIDDLE139];
 
-#define NB_TWIDDLE140 90
+#define NB_TWIDDLE140 128
 extern __ALIGNED(8) const Q31 twiddle140[NB_TWIDDLE140];
 
-#define NB_TWIDDLE141 96
+#define NB_TWIDDLE141 144
 extern __ALIGNED(8) const Q31 twiddle141[NB_TWIDDLE141];
 
-#define NB_TWIDDLE142 100
+#define NB_TWIDDLE142 150
 extern __ALIGNED(8) const Q31 twiddle142[NB_TWIDDLE142];
 
-#define NB_TWIDDLE143 360
+#define NB_TWIDDLE143 160
 extern __ALIGNED(8) const Q31 twiddle143[NB_TWIDDLE143];
 
-#define NB_TWIDDLE144 108
+#define NB_TWIDDLE144 162
 extern __ALIGNED(8) const Q31 twiddle144[NB_TWIDDLE144];
 
-#define NB_TWIDDLE145 120
+#define NB_TWIDDLE145 180
 extern __ALIGNED(8) const Q31 twiddle145[NB_TWIDDLE145];
 
-#define NB_TWIDDLE146 128
+#define NB_TWIDDLE146 192
 extern __ALIGNED(8) const Q31 twiddle146[NB_TWIDDLE146];
 
-#define NB_TWIDDLE147 640
+#define NB_TWIDDLE147 200
 extern __ALIGNED(8) const Q31 twiddle147[NB_TWIDDLE147];
 
-#define NB_TWIDDLE148 4096
+#define NB_TWIDDLE148 216
 extern __ALIGNED(8) const Q31 twiddle148[NB_TWIDDLE148];
 
-#define NB_TWIDDLE149 384
+#define NB_TWIDDLE149 240
 extern __ALIGNED(8) const Q31 twiddle149[NB_TWIDDLE149];
 
-#define NB_TWIDDLE150 144
+#define NB_TWIDDLE150 250
 extern __ALIGNED(8) const Q31 twiddle150[NB_TWIDDLE150];
 
-#define NB_TWIDDLE151 400
+#define NB_TWIDDLE151 256
 extern __ALIGNED(8) const Q31 twiddle151[NB_TWIDDLE151];
 
-#define NB_TWIDDLE152 150
+#define NB_TWIDDLE152 288
 extern __ALIGNED(8) const Q31 twiddle152[NB_TWIDDLE152];
 
-#define NB_TWIDDLE153 160
+#define NB_TWIDDLE153 300
 extern __ALIGNED(8) const Q31 twiddle153[NB_TWIDDLE153];
 
-#define NB_TWIDDLE154 162
+#define NB_TWIDDLE154 320
 extern __ALIGNED(8) const Q31 twiddle154[NB_TWIDDLE154];
 
-#define NB_TWIDDLE155 432
+#define NB_TWIDDLE155 360
 extern __ALIGNED(8) const Q31 twiddle155[NB_TWIDDLE155];
 
-#define NB_TWIDDLE156 180
+#define NB_TWIDDLE156 384
 extern __ALIGNED(8) const Q31 twiddle156[NB_TWIDDLE156];
 
-#define NB_TWIDDLE157 192
+#define NB_TWIDDLE157 400
 extern __ALIGNED(8) const Q31 twiddle157[NB_TWIDDLE157];
 
-#define NB_TWIDDLE158 200
+#define NB_TWIDDLE158 432
 extern __ALIGNED(8) const Q31 twiddle158[NB_TWIDDLE158];
 
-#define NB_TWIDDLE159 216
+#define NB_TWIDDLE159 480
 extern __ALIGNED(8) const Q31 twiddle159[NB_TWIDDLE159];
 
-#define NB_TWIDDLE160 480
+#define NB_TWIDDLE160 512
 extern __ALIGNED(8) const Q31 twiddle160[NB_TWIDDLE160];
 
-#define NB_TWIDDLE161 240
+#define NB_TWIDDLE161 576
 extern __ALIGNED(8) const Q31 twiddle161[NB_TWIDDLE161];
 
-#define NB_TWIDDLE162 250
+#define NB_TWIDDLE162 640
 extern __ALIGNED(8) const Q31 twiddle162[NB_TWIDDLE162];
 
-#define NB_TWIDDLE163 512
-extern __ALIGNED(8) const Q15 twiddle163[NB_TWIDDLE163];
+#define NB_TWIDDLE163 768
+extern __ALIGNED(8) const Q31 twiddle163[NB_TWIDDLE163];
 
-#define NB_TWIDDLE164 8192
-extern __ALIGNED(8) const Q15 twiddle164[NB_TWIDDLE164];
+#define NB_TWIDDLE164 800
+extern __ALIGNED(8) const Q31 twiddle164[NB_TWIDDLE164];
 
-#define NB_TWIDDLE165 4
-extern __ALIGNED(8) const Q15 twiddle165[NB_TWIDDLE165];
+#define NB_TWIDDLE165 1024
+extern __ALIGNED(8) const Q31 twiddle165[NB_TWIDDLE165];
 
-#define NB_TWIDDLE166 6
-extern __ALIGNED(8) const Q15 twiddle166[NB_TWIDDLE166];
+#define NB_TWIDDLE166 2048
+extern __ALIGNED(8) const Q31 twiddle166[NB_TWIDDLE166];
 
-#define NB_TWIDDLE167 8
-extern __ALIGNED(8) const Q15 twiddle167[NB_TWIDDLE167];
+#define NB_TWIDDLE167 4096
+extern __ALIGNED(8) const Q31 twiddle167[NB_TWIDDLE167];
 
-#define NB_TWIDDLE168 10
-extern __ALIGNED(8) const Q15 twiddle168[NB_TWIDDLE168];
+#define NB_TWIDDLE168 8192
+extern __ALIGNED(8) const Q31 twiddle168[NB_TWIDDLE168];
 
-#define NB_TWIDDLE169 12
+#define NB_TWIDDLE169 4
 extern __ALIGNED(8) const Q15 twiddle169[NB_TWIDDLE169];
 
-#define NB_TWIDDLE170 1024
+#define NB_TWIDDLE170 6
 extern __ALIGNED(8) const Q15 twiddle170[NB_TWIDDLE170];
 
-#define NB_TWIDDLE171 16
+#define NB_TWIDDLE171 8
 extern __ALIGNED(8) const Q15 twiddle171[NB_TWIDDLE171];
 
-#define NB_TWIDDLE172 18
+#define NB_TWIDDLE172 10
 extern __ALIGNED(8) const Q15 twiddle172[NB_TWIDDLE172];
 
-#define NB_TWIDDLE173 20
+#define NB_TWIDDLE173 12
 extern __ALIGNED(8) const Q15 twiddle173[NB_TWIDDLE173];
 
-#define NB_TWIDDLE174 256
+#define NB_TWIDDLE174 16
 extern __ALIGNED(8) const Q15 twiddle174[NB_TWIDDLE174];
 
-#define NB_TWIDDLE175 24
+#define NB_TWIDDLE175 18
 extern __ALIGNED(8) const Q15 twiddle175[NB_TWIDDLE175];
 
-#define NB_TWIDDLE176 768
+#define NB_TWIDDLE176 20
 extern __ALIGNED(8) const Q15 twiddle176[NB_TWIDDLE176];
 
-#define NB_TWIDDLE177 30
+#define NB_TWIDDLE177 24
 extern __ALIGNED(8) const Q15 twiddle177[NB_TWIDDLE177];
 
-#define NB_TWIDDLE178 32
+#define NB_TWIDDLE178 30
 extern __ALIGNED(8) const Q15 twiddle178[NB_TWIDDLE178];
 
-#define NB_TWIDDLE179 288
+#define NB_TWIDDLE179 32
 extern __ALIGNED(8) const Q15 twiddle179[NB_TWIDDLE179];
 
 #define NB_TWIDDLE180 36
 extern __ALIGNED(8) const Q15 twiddle180[NB_TWIDDLE180];
 
-#define NB_TWIDDLE181 800
+#define NB_TWIDDLE181 40
 extern __ALIGNED(8) const Q15 twiddle181[NB_TWIDDLE181];
 
-#define NB_TWIDDLE182 40
+#define NB_TWIDDLE182 48
 extern __ALIGNED(8) const Q15 twiddle182[NB_TWIDDLE182];
 
-#define NB_TWIDDLE183 300
+#define NB_TWIDDLE183 50
 extern __ALIGNED(8) const Q15 twiddle183[NB_TWIDDLE183];
 
-#define NB_TWIDDLE184 48
+#define NB_TWIDDLE184 54
 extern __ALIGNED(8) const Q15 twiddle184[NB_TWIDDLE184];
 
-#define NB_TWIDDLE185 50
+#define NB_TWIDDLE185 60
 extern __ALIGNED(8) const Q15 twiddle185[NB_TWIDDLE185];
 
-#define NB_TWIDDLE186 54
+#define NB_TWIDDLE186 64
 extern __ALIGNED(8) const Q15 twiddle186[NB_TWIDDLE186];
 
-#define NB_TWIDDLE187 60
+#define NB_TWIDDLE187 72
 extern __ALIGNED(8) const Q15 twiddle187[NB_TWIDDLE187];
 
-#define NB_TWIDDLE188 64
+#define NB_TWIDDLE188 80
 extern __ALIGNED(8) const Q15 twiddle188[NB_TWIDDLE188];
 
-#define NB_TWIDDLE189 576
+#define NB_TWIDDLE189 90
 extern __ALIGNED(8) const Q15 twiddle189[NB_TWIDDLE189];
 
-#define NB_TWIDDLE190 2048
+#define NB_TWIDDLE190 96
 extern __ALIGNED(8) const Q15 twiddle190[NB_TWIDDLE190];
 
-#define NB_TWIDDLE191 320
+#define NB_TWIDDLE191 100
 extern __ALIGNED(8) const Q15 twiddle191[NB_TWIDDLE191];
 
-#define NB_TWIDDLE192 72
+#define NB_TWIDDLE192 108
 extern __ALIGNED(8) const Q15 twiddle192[NB_TWIDDLE192];
 
-#define NB_TWIDDLE193 80
+#define NB_TWIDDLE193 120
 extern __ALIGNED(8) const Q15 twiddle193[NB_TWIDDLE193];
 
-#define NB_TWIDDLE194 90
+#define NB_TWIDDLE194 128
 extern __ALIGNED(8) const Q15 twiddle194[NB_TWIDDLE194];
 
-#define NB_TWIDDLE195 96
+#define NB_TWIDDLE195 144
 extern __ALIGNED(8) const Q15 twiddle195[NB_TWIDDLE195];
 
-#define NB_TWIDDLE196 100
+#define NB_TWIDDLE196 150
 extern __ALIGNED(8) const Q15 twiddle196[NB_TWIDDLE196];
 
-#define NB_TWIDDLE197 360
+#define NB_TWIDDLE197 160
 extern __ALIGNED(8) const Q15 twiddle197[NB_TWIDDLE197];
 
-#define NB_TWIDDLE198 108
+#define NB_TWIDDLE198 162
 extern __ALIGNED(8) const Q15 twiddle198[NB_TWIDDLE198];
 
-#define NB_TWIDDLE199 120
+#define NB_TWIDDLE199 180
 extern __ALIGNED(8) const Q15 twiddle199[NB_TWIDDLE199];
 
-#define NB_TWIDDLE200 128
+#define NB_TWIDDLE200 192
 extern __ALIGNED(8) const Q15 twiddle200[NB_TWIDDLE200];
 
-#define NB_TWIDDLE201 640
+#define NB_TWIDDLE201 200
 extern __ALIGNED(8) const Q15 twiddle201[NB_TWIDDLE201];
 
-#define NB_TWIDDLE202 4096
+#define NB_TWIDDLE202 216
 extern __ALIGNED(8) const Q15 twiddle202[NB_TWIDDLE202];
 
-#define NB_TWIDDLE203 384
+#define NB_TWIDDLE203 240
 extern __ALIGNED(8) const Q15 twiddle203[NB_TWIDDLE203];
 
-#define NB_TWIDDLE204 144
+#define NB_TWIDDLE204 250
 extern __ALIGNED(8) const Q15 twiddle204[NB_TWIDDLE204];
 
-#define NB_TWIDDLE205 400
+#define NB_TWIDDLE205 256
 extern __ALIGNED(8) const Q15 twiddle205[NB_TWIDDLE205];
 
-#define NB_TWIDDLE206 150
+#define NB_TWIDDLE206 288
 extern __ALIGNED(8) const Q15 twiddle206[NB_TWIDDLE206];
 
-#define NB_TWIDDLE207 160
+#define NB_TWIDDLE207 300
 extern __ALIGNED(8) const Q15 twiddle207[NB_TWIDDLE207];
 
-#define NB_TWIDDLE208 162
+#define NB_TWIDDLE208 320
 extern __ALIGNED(8) const Q15 twiddle208[NB_TWIDDLE208];
 
-#define NB_TWIDDLE209 432
+#define NB_TWIDDLE209 360
 extern __ALIGNED(8) const Q15 twiddle209[NB_TWIDDLE209];
 
-#define NB_TWIDDLE210 180
+#define NB_TWIDDLE210 384
 extern __ALIGNED(8) const Q15 twiddle210[NB_TWIDDLE210];
 
-#define NB_TWIDDLE211 192
+#define NB_TWIDDLE211 400
 extern __ALIGNED(8) const Q15 twiddle211[NB_TWIDDLE211];
 
-#define NB_TWIDDLE212 200
+#define NB_TWIDDLE212 432
 extern __ALIGNED(8) const Q15 twiddle212[NB_TWIDDLE212];
 
-#define NB_TWIDDLE213 216
+#define NB_TWIDDLE213 480
 extern __ALIGNED(8) const Q15 twiddle213[NB_TWIDDLE213];
 
-#define NB_TWIDDLE214 480
+#define NB_TWIDDLE214 512
 extern __ALIGNED(8) const Q15 twiddle214[NB_TWIDDLE214];
 
-#define NB_TWIDDLE215 240
+#define NB_TWIDDLE215 576
 extern __ALIGNED(8) const Q15 twiddle215[NB_TWIDDLE215];
 
-#define NB_TWIDDLE216 250
+#define NB_TWIDDLE216 640
 extern __ALIGNED(8) const Q15 twiddle216[NB_TWIDDLE216];
 
-#define NB_TWIDDLE217 4
-extern __ALIGNED(8) const float32_t twiddle217[NB_TWIDDLE217];
+#define NB_TWIDDLE217 768
+extern __ALIGNED(8) const Q15 twiddle217[NB_TWIDDLE217];
 
-#define NB_TWIDDLE218 6
-extern __ALIGNED(8) const float32_t twiddle218[NB_TWIDDLE218];
+#define NB_TWIDDLE218 800
+extern __ALIGNED(8) const Q15 twiddle218[NB_TWIDDLE218];
 
-#define NB_TWIDDLE219 8
-extern __ALIGNED(8) const float32_t twiddle219[NB_TWIDDLE219];
+#define NB_TWIDDLE219 1024
+extern __ALIGNED(8) const Q15 twiddle219[NB_TWIDDLE219];
 
-#define NB_TWIDDLE220 10
-extern __ALIGNED(8) const float32_t twiddle220[NB_TWIDDLE220];
+#define NB_TWIDDLE220 2048
+extern __ALIGNED(8) const Q15 twiddle220[NB_TWIDDLE220];
 
-#define NB_TWIDDLE221 12
-extern __ALIGNED(8) const float32_t twiddle221[NB_TWIDDLE221];
+#define NB_TWIDDLE221 4096
+extern __ALIGNED(8) const Q15 twiddle221[NB_TWIDDLE221];
 
-#define NB_TWIDDLE222 16
-extern __ALIGNED(8) const float32_t twiddle222[NB_TWIDDLE222];
+#define NB_TWIDDLE222 8192
+extern __ALIGNED(8) const Q15 twiddle222[NB_TWIDDLE222];
 
-#define NB_TWIDDLE223 18
-extern __ALIGNED(8) const float32_t twiddle223[NB_TWIDDLE223];
+#define NB_TWIDDLE223 4
+extern __ALIGNED(8) const Q7 twiddle223[NB_TWIDDLE223];
 
-#define NB_TWIDDLE224 20
-extern __ALIGNED(8) const float32_t twiddle224[NB_TWIDDLE224];
+#define NB_TWIDDLE224 6
+extern __ALIGNED(8) const Q7 twiddle224[NB_TWIDDLE224];
 
-#define NB_TWIDDLE225 24
-extern __ALIGNED(8) const float32_t twiddle225[NB_TWIDDLE225];
+#define NB_TWIDDLE225 16
+extern __ALIGNED(8) const Q7 twiddle225[NB_TWIDDLE225];
 
-#define NB_TWIDDLE226 30
+#define NB_TWIDDLE226 4
 extern __ALIGNED(8) const float32_t twiddle226[NB_TWIDDLE226];
 
-#define NB_TWIDDLE227 32
+#define NB_TWIDDLE227 6
 extern __ALIGNED(8) const float32_t twiddle227[NB_TWIDDLE227];
 
-#define NB_TWIDDLE228 36
+#define NB_TWIDDLE228 8
 extern __ALIGNED(8) const float32_t twiddle228[NB_TWIDDLE228];
 
-#define NB_TWIDDLE229 40
+#define NB_TWIDDLE229 10
 extern __ALIGNED(8) const float32_t twiddle229[NB_TWIDDLE229];
 
-#define NB_TWIDDLE230 48
+#define NB_TWIDDLE230 12
 extern __ALIGNED(8) const float32_t twiddle230[NB_TWIDDLE230];
 
-#define NB_TWIDDLE231 50
+#define NB_TWIDDLE231 16
 extern __ALIGNED(8) const float32_t twiddle231[NB_TWIDDLE231];
 
-#define NB_TWIDDLE232 54
+#define NB_TWIDDLE232 18
 extern __ALIGNED(8) const float32_t twiddle232[NB_TWIDDLE232];
 
-#define NB_TWIDDLE233 60
+#define NB_TWIDDLE233 20
 extern __ALIGNED(8) const float32_t twiddle233[NB_TWIDDLE233];
 
-#define NB_TWIDDLE234 64
+#define NB_TWIDDLE234 24
 extern __ALIGNED(8) const float32_t twiddle234[NB_TWIDDLE234];
 
-#define NB_TWIDDLE235 72
+#define NB_TWIDDLE235 30
 extern __ALIGNED(8) const float32_t twiddle235[NB_TWIDDLE235];
 
-#define NB_TWIDDLE236 80
+#define NB_TWIDDLE236 32
 extern __ALIGNED(8) const float32_t twiddle236[NB_TWIDDLE236];
 
-#define NB_TWIDDLE237 90
+#define NB_TWIDDLE237 36
 extern __ALIGNED(8) const float32_t twiddle237[NB_TWIDDLE237];
 
-#define NB_TWIDDLE238 96
+#define NB_TWIDDLE238 40
 extern __ALIGNED(8) const float32_t twiddle238[NB_TWIDDLE238];
 
-#define NB_TWIDDLE239 100
+#define NB_TWIDDLE239 48
 extern __ALIGNED(8) const float32_t twiddle239[NB_TWIDDLE239];
 
-#define NB_TWIDDLE240 108
+#define NB_TWIDDLE240 50
 extern __ALIGNED(8) const float32_t twiddle240[NB_TWIDDLE240];
 
-#define NB_TWIDDLE241 120
+#define NB_TWIDDLE241 54
 extern __ALIGNED(8) const float32_t twiddle241[NB_TWIDDLE241];
 
-#define NB_TWIDDLE242 128
+#define NB_TWIDDLE242 60
 extern __ALIGNED(8) const float32_t twiddle242[NB_TWIDDLE242];
 
-#define NB_TWIDDLE243 144
+#define NB_TWIDDLE243 64
 extern __ALIGNED(8) const float32_t twiddle243[NB_TWIDDLE243];
 
-#define NB_TWIDDLE244 150
+#define NB_TWIDDLE244 72
 extern __ALIGNED(8) const float32_t twiddle244[NB_TWIDDLE244];
 
-#define NB_TWIDDLE245 160
+#define NB_TWIDDLE245 80
 extern __ALIGNED(8) const float32_t twiddle245[NB_TWIDDLE245];
 
-#define NB_TWIDDLE246 180
+#define NB_TWIDDLE246 90
 extern __ALIGNED(8) const float32_t twiddle246[NB_TWIDDLE246];
 
-#define NB_TWIDDLE247 192
+#define NB_TWIDDLE247 96
 extern __ALIGNED(8) const float32_t twiddle247[NB_TWIDDLE247];
 
-#define NB_TWIDDLE248 200
+#define NB_TWIDDLE248 100
 extern __ALIGNED(8) const float32_t twiddle248[NB_TWIDDLE248];
 
-#define NB_TWIDDLE249 216
+#define NB_TWIDDLE249 108
 extern __ALIGNED(8) const float32_t twiddle249[NB_TWIDDLE249];
 
-#define NB_TWIDDLE250 240
+#define NB_TWIDDLE250 120
 extern __ALIGNED(8) const float32_t twiddle250[NB_TWIDDLE250];
 
-#define NB_TWIDDLE251 256
+#define NB_TWIDDLE251 128
 extern __ALIGNED(8) const float32_t twiddle251[NB_TWIDDLE251];
 
-#define NB_TWIDDLE252 288
+#define NB_TWIDDLE252 144
 extern __ALIGNED(8) const float32_t twiddle252[NB_TWIDDLE252];
 
-#define NB_TWIDDLE253 320
+#define NB_TWIDDLE253 150
 extern __ALIGNED(8) const float32_t twiddle253[NB_TWIDDLE253];
 
-#define NB_TWIDDLE254 384
+#define NB_TWIDDLE254 160
 extern __ALIGNED(8) const float32_t twiddle254[NB_TWIDDLE254];
 
-#define NB_TWIDDLE255 512
+#define NB_TWIDDLE255 180
 extern __ALIGNED(8) const float32_t twiddle255[NB_TWIDDLE255];
 
-#define NB_TWIDDLE256 1024
+#define NB_TWIDDLE256 192
 extern __ALIGNED(8) const float32_t twiddle256[NB_TWIDDLE256];
 
-#if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE257 4
-extern __ALIGNED(8) const float16_t twiddle257[NB_TWIDDLE257];
+#define NB_TWIDDLE257 200
+extern __ALIGNED(8) const float32_t twiddle257[NB_TWIDDLE257];
 
-#endif
+#define NB_TWIDDLE258 216
+extern __ALIGNED(8) const float32_t twiddle258[NB_TWIDDLE258];
 
-#if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE258 6
-extern __ALIGNED(8) const float16_t twiddle258[NB_TWIDDLE258];
-
-#endif
+#define NB_TWIDDLE259 240
+extern __ALIGNED(8) const float32_t twiddle259[NB_TWIDDLE259];
 
-#if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE259 8
-extern __ALIGNED(8) const float16_t twiddle259[NB_TWIDDLE259];
+#define NB_TWIDDLE260 256
+extern __ALIGNED(8) const float32_t twiddle260[NB_TWIDDLE260];
 
-#endif
+#define NB_TWIDDLE261 288
+extern __ALIGNED(8) const float32_t twiddle261[NB_TWIDDLE261];
 
-#if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE260 10
-extern __ALIGNED(8) const float16_t twiddle260[NB_TWIDDLE260];
+#define NB_TWIDDLE262 320
+extern __ALIGNED(8) const float32_t twiddle262[NB_TWIDDLE262];
 
-#endif
+#define NB_TWIDDLE263 384
+extern __ALIGNED(8) const float32_t twiddle263[NB_TWIDDLE263];
 
-#if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE261 12
-extern __ALIGNED(8) const float16_t twiddle261[NB_TWIDDLE261];
+#define NB_TWIDDLE264 512
+extern __ALIGNED(8) const float32_t twiddle264[NB_TWIDDLE264];
 
-#endif
+#define NB_TWIDDLE265 1024
+extern __ALIGNED(8) const float32_t twiddle265[NB_TWIDDLE265];
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE262 16
-extern __ALIGNED(8) const float16_t twiddle262[NB_TWIDDLE262];
-
-#endif
-
-#if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE263 18
-extern __ALIGNED(8) const float16_t twiddle263[NB_TWIDDLE263];
-
-#endif
-
-#if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE264 20
-extern __ALIGNED(8) const float16_t twiddle264[NB_TWIDDLE264];
-
-#endif
-
-#if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE265 24
-extern __ALIGNED(8) const float16_t twiddle265[NB_TWIDDLE265];
-
-#endif
-
-#if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE266 30
+#define NB_TWIDDLE266 4
 extern __ALIGNED(8) const float16_t twiddle266[NB_TWIDDLE266];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE267 32
+#define NB_TWIDDLE267 6
 extern __ALIGNED(8) const float16_t twiddle267[NB_TWIDDLE267];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE268 36
+#define NB_TWIDDLE268 8
 extern __ALIGNED(8) const float16_t twiddle268[NB_TWIDDLE268];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE269 40
+#define NB_TWIDDLE269 10
 extern __ALIGNED(8) const float16_t twiddle269[NB_TWIDDLE269];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE270 48
+#define NB_TWIDDLE270 12
 extern __ALIGNED(8) const float16_t twiddle270[NB_TWIDDLE270];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE271 50
+#define NB_TWIDDLE271 16
 extern __ALIGNED(8) const float16_t twiddle271[NB_TWIDDLE271];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE272 54
+#define NB_TWIDDLE272 18
 extern __ALIGNED(8) const float16_t twiddle272[NB_TWIDDLE272];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE273 60
+#define NB_TWIDDLE273 20
 extern __ALIGNED(8) const float16_t twiddle273[NB_TWIDDLE273];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE274 64
+#define NB_TWIDDLE274 24
 extern __ALIGNED(8) const float16_t twiddle274[NB_TWIDDLE274];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE275 72
+#define NB_TWIDDLE275 30
 extern __ALIGNED(8) const float16_t twiddle275[NB_TWIDDLE275];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE276 80
+#define NB_TWIDDLE276 32
 extern __ALIGNED(8) const float16_t twiddle276[NB_TWIDDLE276];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE277 90
+#define NB_TWIDDLE277 36
 extern __ALIGNED(8) const float16_t twiddle277[NB_TWIDDLE277];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE278 96
+#define NB_TWIDDLE278 40
 extern __ALIGNED(8) const float16_t twiddle278[NB_TWIDDLE278];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE279 100
+#define NB_TWIDDLE279 48
 extern __ALIGNED(8) const float16_t twiddle279[NB_TWIDDLE279];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE280 108
+#define NB_TWIDDLE280 50
 extern __ALIGNED(8) const float16_t twiddle280[NB_TWIDDLE280];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE281 120
+#define NB_TWIDDLE281 54
 extern __ALIGNED(8) const float16_t twiddle281[NB_TWIDDLE281];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE282 128
+#define NB_TWIDDLE282 60
 extern __ALIGNED(8) const float16_t twiddle282[NB_TWIDDLE282];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE283 144
+#define NB_TWIDDLE283 64
 extern __ALIGNED(8) const float16_t twiddle283[NB_TWIDDLE283];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE284 150
+#define NB_TWIDDLE284 72
 extern __ALIGNED(8) const float16_t twiddle284[NB_TWIDDLE284];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE285 160
+#define NB_TWIDDLE285 80
 extern __ALIGNED(8) const float16_t twiddle285[NB_TWIDDLE285];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE286 180
+#define NB_TWIDDLE286 90
 extern __ALIGNED(8) const float16_t twiddle286[NB_TWIDDLE286];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE287 192
+#define NB_TWIDDLE287 96
 extern __ALIGNED(8) const float16_t twiddle287[NB_TWIDDLE287];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE288 200
+#define NB_TWIDDLE288 100
 extern __ALIGNED(8) const float16_t twiddle288[NB_TWIDDLE288];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE289 216
+#define NB_TWIDDLE289 108
 extern __ALIGNED(8) const float16_t twiddle289[NB_TWIDDLE289];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE290 240
+#define NB_TWIDDLE290 120
 extern __ALIGNED(8) const float16_t twiddle290[NB_TWIDDLE290];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE291 256
+#define NB_TWIDDLE291 128
 extern __ALIGNED(8) const float16_t twiddle291[NB_TWIDDLE291];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE292 288
+#define NB_TWIDDLE292 144
 extern __ALIGNED(8) const float16_t twiddle292[NB_TWIDDLE292];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE293 320
+#define NB_TWIDDLE293 150
 extern __ALIGNED(8) const float16_t twiddle293[NB_TWIDDLE293];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE294 384
+#define NB_TWIDDLE294 160
 extern __ALIGNED(8) const float16_t twiddle294[NB_TWIDDLE294];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE295 512
+#define NB_TWIDDLE295 180
 extern __ALIGNED(8) const float16_t twiddle295[NB_TWIDDLE295];
 
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
-#define NB_TWIDDLE296 1024
+#define NB_TWIDDLE296 192
 extern __ALIGNED(8) const float16_t twiddle296[NB_TWIDDLE296];
 
 #endif
 
-#define NB_TWIDDLE297 4
-extern __ALIGNED(8) const Q31 twiddle297[NB_TWIDDLE297];
+#if defined(ARM_FLOAT16_SUPPORTED)
+#define NB_TWIDDLE297 200
+extern __ALIGNED(8) const float16_t twiddle297[NB_TWIDDLE297];
+
+#endif
 
-#define NB_TWIDDLE298 6
-extern __ALIGNED(8) const Q31 twiddle298[NB_TWIDDLE298];
+#if defined(ARM_FLOAT16_SUPPORTED)
+#define NB_TWIDDLE298 216
+extern __ALIGNED(8) const float16_t twiddle298[NB_TWIDDLE298];
 
-#define NB_TWIDDLE299 8
-extern __ALIGNED(8) const Q31 twiddle299[NB_TWIDDLE299];
+#endif
 
-#define NB_TWIDDLE300 10
-extern __ALIGNED(8) const Q31 twiddle300[NB_TWIDDLE300];
+#if defined(ARM_FLOAT16_SUPPORTED)
+#define NB_TWIDDLE299 240
+extern __ALIGNED(8) const float16_t twiddle299[NB_TWIDDLE299];
 
-#define NB_TWIDDLE301 12
-extern __ALIGNED(8) const Q31 twiddle301[NB_TWIDDLE301];
+#endif
 
-#define NB_TWIDDLE302 16
-extern __ALIGNED(8) const Q31 twiddle302[NB_TWIDDLE302];
+#if defined(ARM_FLOAT16_SUPPORTED)
+#define NB_TWIDDLE300 256
+extern __ALIGNED(8) const float16_t twiddle300[NB_TWIDDLE300];
 
-#define NB_TWIDDLE303 18
-extern __ALIGNED(8) const Q31 twiddle303[NB_TWIDDLE303];
+#endif
 
-#define NB_TWIDDLE304 20
-extern __ALIGNED(8) const Q31 twiddle304[NB_TWIDDLE304];
+#if defined(ARM_FLOAT16_SUPPORTED)
+#define NB_TWIDDLE301 288
+extern __ALIGNED(8) const float16_t twiddle301[NB_TWIDDLE301];
 
-#define NB_TWIDDLE305 24
-extern __ALIGNED(8) const Q31 twiddle305[NB_TWIDDLE305];
+#endif
 
-#define NB_TWIDDLE306 30
+#if defined(ARM_FLOAT16_SUPPORTED)
+#define NB_TWIDDLE302 320
+extern __ALIGNED(8) const float16_t twiddle302[NB_TWIDDLE302];
+
+#endif
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+#define NB_TWIDDLE303 384
+extern __ALIGNED(8) const float16_t twiddle303[NB_TWIDDLE303];
+
+#endif
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+#define NB_TWIDDLE304 512
+extern __ALIGNED(8) const float16_t twiddle304[NB_TWIDDLE304];
+
+#endif
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+#define NB_TWIDDLE305 1024
+extern __ALIGNED(8) const float16_t twiddle305[NB_TWIDDLE305];
+
+#endif
+
+#define NB_TWIDDLE306 4
 extern __ALIGNED(8) const Q31 twiddle306[NB_TWIDDLE306];
 
-#define NB_TWIDDLE307 32
+#define NB_TWIDDLE307 6
 extern __ALIGNED(8) const Q31 twiddle307[NB_TWIDDLE307];
 
-#define NB_TWIDDLE308 36
+#define NB_TWIDDLE308 8
 extern __ALIGNED(8) const Q31 twiddle308[NB_TWIDDLE308];
 
-#define NB_TWIDDLE309 40
+#define NB_TWIDDLE309 10
 extern __ALIGNED(8) const Q31 twiddle309[NB_TWIDDLE309];
 
-#define NB_TWIDDLE310 48
+#define NB_TWIDDLE310 12
 extern __ALIGNED(8) const Q31 twiddle310[NB_TWIDDLE310];
 
-#define NB_TWIDDLE311 50
+#define NB_TWIDDLE311 16
 extern __ALIGNED(8) const Q31 twiddle311[NB_TWIDDLE311];
 
-#define NB_TWIDDLE312 54
+#define NB_TWIDDLE312 18
 extern __ALIGNED(8) const Q31 twiddle312[NB_TWIDDLE312];
 
-#define NB_TWIDDLE313 60
+#define NB_TWIDDLE313 20
 extern __ALIGNED(8) const Q31 twiddle313[NB_TWIDDLE313];
 
-#define NB_TWIDDLE314 64
+#define NB_TWIDDLE314 24
 extern __ALIGNED(8) const Q31 twiddle314[NB_TWIDDLE314];
 
-#define NB_TWIDDLE315 72
+#define NB_TWIDDLE315 30
 extern __ALIGNED(8) const Q31 twiddle315[NB_TWIDDLE315];
 
-#define NB_TWIDDLE316 80
+#define NB_TWIDDLE316 32
 extern __ALIGNED(8) const Q31 twiddle316[NB_TWIDDLE316];
 
-#define NB_TWIDDLE317 90
+#define NB_TWIDDLE317 36
 extern __ALIGNED(8) const Q31 twiddle317[NB_TWIDDLE317];
 
-#define NB_TWIDDLE318 96
+#define NB_TWIDDLE318 40
 extern __ALIGNED(8) const Q31 twiddle318[NB_TWIDDLE318];
 
-#define NB_TWIDDLE319 100
+#define NB_TWIDDLE319 48
 extern __ALIGNED(8) const Q31 twiddle319[NB_TWIDDLE319];
 
-#define NB_TWIDDLE320 108
+#define NB_TWIDDLE320 50
 extern __ALIGNED(8) const Q31 twiddle320[NB_TWIDDLE320];
 
-#define NB_TWIDDLE321 120
+#define NB_TWIDDLE321 54
 extern __ALIGNED(8) const Q31 twiddle321[NB_TWIDDLE321];
 
-#define NB_TWIDDLE322 128
+#define NB_TWIDDLE322 60
 extern __ALIGNED(8) const Q31 twiddle322[NB_TWIDDLE322];
 
-#define NB_TWIDDLE323 144
+#define NB_TWIDDLE323 64
 extern __ALIGNED(8) const Q31 twiddle323[NB_TWIDDLE323];
 
-#define NB_TWIDDLE324 150
+#define NB_TWIDDLE324 72
 extern __ALIGNED(8) const Q31 twiddle324[NB_TWIDDLE324];
 
-#define NB_TWIDDLE325 160
+#define NB_TWIDDLE325 80
 extern __ALIGNED(8) const Q31 twiddle325[NB_TWIDDLE325];
 
-#define NB_TWIDDLE326 180
+#define NB_TWIDDLE326 90
 extern __ALIGNED(8) const Q31 twiddle326[NB_TWIDDLE326];
 
-#define NB_TWIDDLE327 192
+#define NB_TWIDDLE327 96
 extern __ALIGNED(8) const Q31 twiddle327[NB_TWIDDLE327];
 
-#define NB_TWIDDLE328 200
+#define NB_TWIDDLE328 100
 extern __ALIGNED(8) const Q31 twiddle328[NB_TWIDDLE328];
 
-#define NB_TWIDDLE329 216
+#define NB_TWIDDLE329 108
 extern __ALIGNED(8) const Q31 twiddle329[NB_TWIDDLE329];
 
-#define NB_TWIDDLE330 240
+#define NB_TWIDDLE330 120
 extern __ALIGNED(8) const Q31 twiddle330[NB_TWIDDLE330];
 
-#define NB_TWIDDLE331 256
+#define NB_TWIDDLE331 128
 extern __ALIGNED(8) const Q31 twiddle331[NB_TWIDDLE331];
 
-#define NB_TWIDDLE332 288
+#define NB_TWIDDLE332 144
 extern __ALIGNED(8) const Q31 twiddle332[NB_TWIDDLE332];
 
-#define NB_TWIDDLE333 320
+#define NB_TWIDDLE333 150
 extern __ALIGNED(8) const Q31 twiddle333[NB_TWIDDLE333];
 
-#define NB_TWIDDLE334 384
+#define NB_TWIDDLE334 160
 extern __ALIGNED(8) const Q31 twiddle334[NB_TWIDDLE334];
 
-#define NB_TWIDDLE335 512
+#define NB_TWIDDLE335 180
 extern __ALIGNED(8) const Q31 twiddle335[NB_TWIDDLE335];
 
-#define NB_TWIDDLE336 1024
+#define NB_TWIDDLE336 192
 extern __ALIGNED(8) const Q31 twiddle336[NB_TWIDDLE336];
 
-#define NB_TWIDDLE337 4
-extern __ALIGNED(8) const Q15 twiddle337[NB_TWIDDLE337];
+#define NB_TWIDDLE337 200
+extern __ALIGNED(8) const Q31 twiddle337[NB_TWIDDLE337];
 
-#define NB_TWIDDLE338 6
-extern __ALIGNED(8) const Q15 twiddle338[NB_TWIDDLE338];
+#define NB_TWIDDLE338 216
+extern __ALIGNED(8) const Q31 twiddle338[NB_TWIDDLE338];
 
-#define NB_TWIDDLE339 8
-extern __ALIGNED(8) const Q15 twiddle339[NB_TWIDDLE339];
+#define NB_TWIDDLE339 240
+extern __ALIGNED(8) const Q31 twiddle339[NB_TWIDDLE339];
 
-#define NB_TWIDDLE340 10
-extern __ALIGNED(8) const Q15 twiddle340[NB_TWIDDLE340];
+#define NB_TWIDDLE340 256
+extern __ALIGNED(8) const Q31 twiddle340[NB_TWIDDLE340];
 
-#define NB_TWIDDLE341 12
-extern __ALIGNED(8) const Q15 twiddle341[NB_TWIDDLE341];
+#define NB_TWIDDLE341 288
+extern __ALIGNED(8) const Q31 twiddle341[NB_TWIDDLE341];
 
-#define NB_TWIDDLE342 16
-extern __ALIGNED(8) const Q15 twiddle342[NB_TWIDDLE342];
+#define NB_TWIDDLE342 320
+extern __ALIGNED(8) const Q31 twiddle342[NB_TWIDDLE342];
 
-#define NB_TWIDDLE343 18
-extern __ALIGNED(8) const Q15 twiddle343[NB_TWIDDLE343];
+#define NB_TWIDDLE343 384
+extern __ALIGNED(8) const Q31 twiddle343[NB_TWIDDLE343];
 
-#define NB_TWIDDLE344 20
-extern __ALIGNED(8) const Q15 twiddle344[NB_TWIDDLE344];
+#define NB_TWIDDLE344 512
+extern __ALIGNED(8) const Q31 twiddle344[NB_TWIDDLE344];
 
-#define NB_TWIDDLE345 24
-extern __ALIGNED(8) const Q15 twiddle345[NB_TWIDDLE345];
+#define NB_TWIDDLE345 1024
+extern __ALIGNED(8) const Q31 twiddle345[NB_TWIDDLE345];
 
-#define NB_TWIDDLE346 30
+#define NB_TWIDDLE346 4
 extern __ALIGNED(8) const Q15 twiddle346[NB_TWIDDLE346];
 
-#define NB_TWIDDLE347 32
+#define NB_TWIDDLE347 6
 extern __ALIGNED(8) const Q15 twiddle347[NB_TWIDDLE347];
 
-#define NB_TWIDDLE348 36
+#define NB_TWIDDLE348 8
 extern __ALIGNED(8) const Q15 twiddle348[NB_TWIDDLE348];
 
-#define NB_TWIDDLE349 40
+#define NB_TWIDDLE349 10
 extern __ALIGNED(8) const Q15 twiddle349[NB_TWIDDLE349];
 
-#define NB_TWIDDLE350 48
+#define NB_TWIDDLE350 12
 extern __ALIGNED(8) const Q15 twiddle350[NB_TWIDDLE350];
 
-#define NB_TWIDDLE351 50
+#define NB_TWIDDLE351 16
 extern __ALIGNED(8) const Q15 twiddle351[NB_TWIDDLE351];
 
-#define NB_TWIDDLE352 54
+#define NB_TWIDDLE352 18
 extern __ALIGNED(8) const Q15 twiddle352[NB_TWIDDLE352];
 
-#define NB_TWIDDLE353 60
+#define NB_TWIDDLE353 20
 extern __ALIGNED(8) const Q15 twiddle353[NB_TWIDDLE353];
 
-#define NB_TWIDDLE354 64
+#define NB_TWIDDLE354 24
 extern __ALIGNED(8) const Q15 twiddle354[NB_TWIDDLE354];
 
-#define NB_TWIDDLE355 72
+#define NB_TWIDDLE355 30
 extern __ALIGNED(8) const Q15 twiddle355[NB_TWIDDLE355];
 
-#define NB_TWIDDLE356 80
+#define NB_TWIDDLE356 32
 extern __ALIGNED(8) const Q15 twiddle356[NB_TWIDDLE356];
 
-#define NB_TWIDDLE357 90
+#define NB_TWIDDLE357 36
 extern __ALIGNED(8) const Q15 twiddle357[NB_TWIDDLE357];
 
-#define NB_TWIDDLE358 96
+#define NB_TWIDDLE358 40
 extern __ALIGNED(8) const Q15 twiddle358[NB_TWIDDLE358];
 
-#define NB_TWIDDLE359 100
+#define NB_TWIDDLE359 48
 extern __ALIGNED(8) const Q15 twiddle359[NB_TWIDDLE359];
 
-#define NB_TWIDDLE360 108
+#define NB_TWIDDLE360 50
 extern __ALIGNED(8) const Q15 twiddle360[NB_TWIDDLE360];
 
-#define NB_TWIDDLE361 120
+#define NB_TWIDDLE361 54
 extern __ALIGNED(8) const Q15 twiddle361[NB_TWIDDLE361];
 
-#define NB_TWIDDLE362 128
+#define NB_TWIDDLE362 60
 extern __ALIGNED(8) const Q15 twiddle362[NB_TWIDDLE362];
 
-#define NB_TWIDDLE363 144
+#define NB_TWIDDLE363 64
 extern __ALIGNED(8) const Q15 twiddle363[NB_TWIDDLE363];
 
-#define NB_TWIDDLE364 150
+#define NB_TWIDDLE364 72
 extern __ALIGNED(8) const Q15 twiddle364[NB_TWIDDLE364];
 
-#define NB_TWIDDLE365 160
+#define NB_TWIDDLE365 80
 extern __ALIGNED(8) const Q15 twiddle365[NB_TWIDDLE365];
 
-#define NB_TWIDDLE366 180
+#define NB_TWIDDLE366 90
 extern __ALIGNED(8) const Q15 twiddle366[NB_TWIDDLE366];
 
-#define NB_TWIDDLE367 192
+#define NB_TWIDDLE367 96
 extern __ALIGNED(8) const Q15 twiddle367[NB_TWIDDLE367];
 
-#define NB_TWIDDLE368 200
+#define NB_TWIDDLE368 100
 extern __ALIGNED(8) const Q15 twiddle368[NB_TWIDDLE368];
 
-#define NB_TWIDDLE369 216
+#define NB_TWIDDLE369 108
 extern __ALIGNED(8) const Q15 twiddle369[NB_TWIDDLE369];
 
-#define NB_TWIDDLE370 240
+#define NB_TWIDDLE370 120
 extern __ALIGNED(8) const Q15 twiddle370[NB_TWIDDLE370];
 
-#define NB_TWIDDLE371 256
+#define NB_TWIDDLE371 128
 extern __ALIGNED(8) const Q15 twiddle371[NB_TWIDDLE371];
 
-#define NB_TWIDDLE372 288
+#define NB_TWIDDLE372 144
 extern __ALIGNED(8) const Q15 twiddle372[NB_TWIDDLE372];
 
-#define NB_TWIDDLE373 320
+#define NB_TWIDDLE373 150
 extern __ALIGNED(8) const Q15 twiddle373[NB_TWIDDLE373];
 
-#define NB_TWIDDLE374 384
+#define NB_TWIDDLE374 160
 extern __ALIGNED(8) const Q15 twiddle374[NB_TWIDDLE374];
 
-#define NB_TWIDDLE375 512
+#define NB_TWIDDLE375 180
 extern __ALIGNED(8) const Q15 twiddle375[NB_TWIDDLE375];
 
-#define NB_TWIDDLE376 1024
+#define NB_TWIDDLE376 192
 extern __ALIGNED(8) const Q15 twiddle376[NB_TWIDDLE376];
 
+#define NB_TWIDDLE377 200
+extern __ALIGNED(8) const Q15 twiddle377[NB_TWIDDLE377];
+
+#define NB_TWIDDLE378 216
+extern __ALIGNED(8) const Q15 twiddle378[NB_TWIDDLE378];
+
+#define NB_TWIDDLE379 240
+extern __ALIGNED(8) const Q15 twiddle379[NB_TWIDDLE379];
+
+#define NB_TWIDDLE380 256
+extern __ALIGNED(8) const Q15 twiddle380[NB_TWIDDLE380];
+
+#define NB_TWIDDLE381 288
+extern __ALIGNED(8) const Q15 twiddle381[NB_TWIDDLE381];
+
+#define NB_TWIDDLE382 320
+extern __ALIGNED(8) const Q15 twiddle382[NB_TWIDDLE382];
+
+#define NB_TWIDDLE383 384
+extern __ALIGNED(8) const Q15 twiddle383[NB_TWIDDLE383];
+
+#define NB_TWIDDLE384 512
+extern __ALIGNED(8) const Q15 twiddle384[NB_TWIDDLE384];
+
+#define NB_TWIDDLE385 1024
+extern __ALIGNED(8) const Q15 twiddle385[NB_TWIDDLE385];
+
 
 
 
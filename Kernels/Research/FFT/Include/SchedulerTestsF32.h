@@ -0,0 +1,56 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "Test.h"
+#include "Pattern.h"
+
+#include "fft.h"
+
+// Plans of the jobs and number of jobs of each plan
+#define NB_PLANS 4
+#define NB_REPEATS 3
+#define NB_JOBS (NB_PLANS*NB_REPEATS)
+
+class SchedulerTestsF32:public Client::Suite
+    {
+        public:
+            SchedulerTestsF32(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "SchedulerTestsF32_decl.h"
+            
+            Client::Pattern<float32_t> input;
+            Client::LocalPattern<float32_t> output;
+            Client::LocalPattern<float32_t> scratch;
+
+            Client::RefPattern<float32_t> ref;
+
+
+            uint32_t nbWorkers;
+            uint32_t scratchSamples;
+
+            fftplan<float32_t> plans[NB_PLANS];
+            fftjob jobs[NB_JOBS];
+            // Set by the callback of each job
+            uint32_t called[NB_JOBS];
+
+
+            arm_status status;
+            
+    };
@@ -0,0 +1,55 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "Test.h"
+#include "Pattern.h"
+
+#include "fft.h"
+
+class ZoomTestsF32:public Client::Suite
+    {
+        public:
+            ZoomTestsF32(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "ZoomTestsF32_decl.h"
+            
+            Client::Pattern<float32_t> input;
+            Client::Pattern<float32_t> window;
+            Client::LocalPattern<float32_t> output;
+
+            Client::RefPattern<float32_t> ref;
+
+
+            float32_t center;
+            uint16_t decimation;
+            uint16_t nbTaps;
+            uint16_t nb;
+            const float32_t *windowp;
+
+            // State of the zoom FFT : filter of 64 taps, zoom factor
+            // of 8 and CFFT of 64 samples at most
+            float32_t coefs[2*64];
+            float32_t delay[64+8];
+            float32_t frame[2*64];
+
+
+            arm_status status;
+            
+    };
@@ -0,0 +1,1215 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef _RADIX_Q7_8_H
+#define _RADIX_Q7_8_H
+
+#include "complex.h"
+
+/**************
+
+DIRECT FFT 
+
+***************/
+template<int inputstrideenabled> 
+struct radix<DIRECT,Q7, 8,inputstrideenabled>{
+
+static constexpr complex<Q7> C0_8_tw{Q7{(q7_t)0x00}, Q7{(q7_t)0x7F}};
+  static constexpr complex<Q7> C1_8_tw{Q7{(q7_t)0x5B}, Q7{(q7_t)0xA5}};
+  static constexpr complex<Q7> C2_8_tw{Q7{(q7_t)0xA5}, Q7{(q7_t)0xA5}};
+  
+static constexpr complex<Q7> C0_8_notw{Q7{(q7_t)0x00}, Q7{(q7_t)0x7F}};
+  static constexpr complex<Q7> C1_8_notw{Q7{(q7_t)0x5B}, Q7{(q7_t)0xA5}};
+  static constexpr complex<Q7> C2_8_notw{Q7{(q7_t)0xA5}, Q7{(q7_t)0xA5}};
+  
+
+/* Nb Multiplications = 5, 
+Nb Additions = 24,
+Nb Negates = 12,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 3
+
+*/
+ __STATIC_FORCEINLINE void run_ip_notw(int stageLength,complex<Q7> *in,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+complex<Q7> a[8];
+complex<Q7> res[8];
+
+
+ complex<Q7> tmp_0;
+ complex<Q7> tmp_1;
+ complex<Q7> tmp_2;
+ complex<Q7> tmp_3;
+ complex<Q7> tmp_4;
+ complex<Q7> tmp_5;
+ complex<Q7> tmp_6;
+ complex<Q7> tmp_7;
+ complex<Q7> tmp_8;
+ complex<Q7> tmp_9;
+ complex<Q7> tmp_10;
+ complex<Q15> tmp_11;
+ complex<Q7> tmp_12;
+ complex<Q15> tmp_13;
+ complex<Q15> tmp_14;
+ complex<Q7> tmp_15;
+ complex<Q7> tmp_16;
+ complex<Q7> tmp_17;
+ complex<Q7> tmp_18;
+ complex<Q15> tmp_19;
+ complex<Q15> tmp_20;
+
+
+a[0] = memory<complex<Q7>>::load(in,0 * stageLength * strideFactor);
+a[1] = memory<complex<Q7>>::load(in,1 * stageLength * strideFactor);
+a[2] = memory<complex<Q7>>::load(in,2 * stageLength * strideFactor);
+a[3] = memory<complex<Q7>>::load(in,3 * stageLength * strideFactor);
+a[4] = memory<complex<Q7>>::load(in,4 * stageLength * strideFactor);
+a[5] = memory<complex<Q7>>::load(in,5 * stageLength * strideFactor);
+a[6] = memory<complex<Q7>>::load(in,6 * stageLength * strideFactor);
+a[7] = memory<complex<Q7>>::load(in,7 * stageLength * strideFactor);
+
+
+tmp_0 = shadd(a[0] , a[4]) ;
+tmp_1 = shadd(a[2] , a[6]) ;
+tmp_2 = shadd(tmp_0 , tmp_1) ;
+tmp_3 = shadd(a[1] , a[5]) ;
+tmp_4 = shadd(a[3] , a[7]) ;
+tmp_5 = shadd(tmp_3 , tmp_4) ;
+res[0] = shadd(tmp_2 , tmp_5) ;
+tmp_6 = shsub(a[0] , a[4]) ;
+tmp_7 = shsub(a[2] , a[6]) ;
+tmp_8 =  rot(tmp_7)  ;
+tmp_9 = shsub(tmp_6 , tmp_8) ;
+tmp_10 = shsub(a[3] , a[7]) ;
+tmp_11 = (C2_8_notw) * tmp_10 ;
+tmp_12 = shsub(a[1] , a[5]) ;
+tmp_13 = (C1_8_notw) * tmp_12 ;
+tmp_14 = (tmp_11 + tmp_13) ;
+res[1] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   +  decq(tmp_14,1)  ) )  ;
+tmp_15 = shsub(tmp_0 , tmp_1) ;
+tmp_16 = shsub(tmp_3 , tmp_4) ;
+tmp_17 =  rot(tmp_16)  ;
+res[2] = shsub(tmp_15 , tmp_17) ;
+tmp_18 = shadd(tmp_6 , tmp_8) ;
+tmp_19 = (tmp_13 - tmp_11) ;
+tmp_20 =  rot(tmp_19)  ;
+res[3] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   -  decq(tmp_20,1)  ) )  ;
+res[4] = shsub(tmp_2 , tmp_5) ;
+res[5] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   -  decq(tmp_14,1)  ) )  ;
+res[6] = shadd(tmp_15 , tmp_17) ;
+res[7] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   +  decq(tmp_20,1)  ) )  ;
+
+
+memory<complex<Q7>>::store(in,0 * stageLength * strideFactor , res[0]);
+memory<complex<Q7>>::store(in,1 * stageLength * strideFactor , res[1]);
+memory<complex<Q7>>::store(in,2 * stageLength * strideFactor , res[2]);
+memory<complex<Q7>>::store(in,3 * stageLength * strideFactor , res[3]);
+memory<complex<Q7>>::store(in,4 * stageLength * strideFactor , res[4]);
+memory<complex<Q7>>::store(in,5 * stageLength * strideFactor , res[5]);
+memory<complex<Q7>>::store(in,6 * stageLength * strideFactor , res[6]);
+memory<complex<Q7>>::store(in,7 * stageLength * strideFactor , res[7]);
+
+
+};
+
+/* Nb Multiplications = 12, 
+Nb Additions = 24,
+Nb Negates = 12,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 3
+
+*/
+ __STATIC_FORCEINLINE void run_ip_tw(int stageLength,const complex<Q7> *w,complex<Q7> *in,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+complex<Q7> a[8];
+complex<Q7> res[8];
+
+
+ complex<Q7> tmp_0;
+ complex<Q7> tmp_1;
+ complex<Q7> tmp_2;
+ complex<Q7> tmp_3;
+ complex<Q7> tmp_4;
+ complex<Q7> tmp_5;
+ complex<Q7> tmp_6;
+ complex<Q7> tmp_7;
+ complex<Q7> tmp_8;
+ complex<Q7> tmp_9;
+ complex<Q7> tmp_10;
+ complex<Q15> tmp_11;
+ complex<Q7> tmp_12;
+ complex<Q15> tmp_13;
+ complex<Q15> tmp_14;
+ complex<Q7> tmp_15;
+ complex<Q7> tmp_16;
+ complex<Q7> tmp_17;
+ complex<Q7> tmp_18;
+ complex<Q15> tmp_19;
+ complex<Q15> tmp_20;
+
+
+a[0] = memory<complex<Q7>>::load(in,0 * stageLength * strideFactor);
+a[1] = memory<complex<Q7>>::load(in,1 * stageLength * strideFactor);
+a[2] = memory<complex<Q7>>::load(in,2 * stageLength * strideFactor);
+a[3] = memory<complex<Q7>>::load(in,3 * stageLength * strideFactor);
+a[4] = memory<complex<Q7>>::load(in,4 * stageLength * strideFactor);
+a[5] = memory<complex<Q7>>::load(in,5 * stageLength * strideFactor);
+a[6] = memory<complex<Q7>>::load(in,6 * stageLength * strideFactor);
+a[7] = memory<complex<Q7>>::load(in,7 * stageLength * strideFactor);
+
+
+tmp_0 = shadd(a[0] , a[4]) ;
+tmp_1 = shadd(a[2] , a[6]) ;
+tmp_2 = shadd(tmp_0 , tmp_1) ;
+tmp_3 = shadd(a[1] , a[5]) ;
+tmp_4 = shadd(a[3] , a[7]) ;
+tmp_5 = shadd(tmp_3 , tmp_4) ;
+res[0] = shadd(tmp_2 , tmp_5) ;
+tmp_6 = shsub(a[0] , a[4]) ;
+tmp_7 = shsub(a[2] , a[6]) ;
+tmp_8 =  rot(tmp_7)  ;
+tmp_9 = shsub(tmp_6 , tmp_8) ;
+tmp_10 = shsub(a[3] , a[7]) ;
+tmp_11 = (C2_8_tw) * tmp_10 ;
+tmp_12 = shsub(a[1] , a[5]) ;
+tmp_13 = (C1_8_tw) * tmp_12 ;
+tmp_14 = (tmp_11 + tmp_13) ;
+res[1] =  narrow<1,complex<Q7>>::run(w[0] *  narrow<NORMALNARROW,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   +  decq(tmp_14,1)  ) )   )  ;
+tmp_15 = shsub(tmp_0 , tmp_1) ;
+tmp_16 = shsub(tmp_3 , tmp_4) ;
+tmp_17 =  rot(tmp_16)  ;
+res[2] =  narrow<NORMALNARROW,complex<Q7>>::run(w[1] * shsub(tmp_15 , tmp_17)  )  ;
+tmp_18 = shadd(tmp_6 , tmp_8) ;
+tmp_19 = (tmp_13 - tmp_11) ;
+tmp_20 =  rot(tmp_19)  ;
+res[3] =  narrow<1,complex<Q7>>::run(w[2] *  narrow<NORMALNARROW,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   -  decq(tmp_20,1)  ) )   )  ;
+res[4] =  narrow<NORMALNARROW,complex<Q7>>::run(w[3] * shsub(tmp_2 , tmp_5)  )  ;
+res[5] =  narrow<1,complex<Q7>>::run(w[4] *  narrow<NORMALNARROW,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   -  decq(tmp_14,1)  ) )   )  ;
+res[6] =  narrow<NORMALNARROW,complex<Q7>>::run(w[5] * shadd(tmp_15 , tmp_17)  )  ;
+res[7] =  narrow<1,complex<Q7>>::run(w[6] *  narrow<NORMALNARROW,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   +  decq(tmp_20,1)  ) )   )  ;
+
+
+memory<complex<Q7>>::store(in,0 * stageLength * strideFactor , res[0]);
+memory<complex<Q7>>::store(in,1 * stageLength * strideFactor , res[1]);
+memory<complex<Q7>>::store(in,2 * stageLength * strideFactor , res[2]);
+memory<complex<Q7>>::store(in,3 * stageLength * strideFactor , res[3]);
+memory<complex<Q7>>::store(in,4 * stageLength * strideFactor , res[4]);
+memory<complex<Q7>>::store(in,5 * stageLength * strideFactor , res[5]);
+memory<complex<Q7>>::store(in,6 * stageLength * strideFactor , res[6]);
+memory<complex<Q7>>::store(in,7 * stageLength * strideFactor , res[7]);
+
+
+};
+
+/* Nb Multiplications = 5, 
+Nb Additions = 24,
+Nb Negates = 12,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 3
+
+*/
+ __STATIC_FORCEINLINE void run_op_notw(int stageLength,const complex<Q7> *in,complex<Q7> *out,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+complex<Q7> a[8];
+complex<Q7> res[8];
+
+
+ complex<Q7> tmp_0;
+ complex<Q7> tmp_1;
+ complex<Q7> tmp_2;
+ complex<Q7> tmp_3;
+ complex<Q7> tmp_4;
+ complex<Q7> tmp_5;
+ complex<Q7> tmp_6;
+ complex<Q7> tmp_7;
+ complex<Q7> tmp_8;
+ complex<Q7> tmp_9;
+ complex<Q7> tmp_10;
+ complex<Q15> tmp_11;
+ complex<Q7> tmp_12;
+ complex<Q15> tmp_13;
+ complex<Q15> tmp_14;
+ complex<Q7> tmp_15;
+ complex<Q7> tmp_16;
+ complex<Q7> tmp_17;
+ complex<Q7> tmp_18;
+ complex<Q15> tmp_19;
+ complex<Q15> tmp_20;
+
+
+a[0] = memory<complex<Q7>>::load(in,0 * stageLength * strideFactor);
+a[1] = memory<complex<Q7>>::load(in,1 * stageLength * strideFactor);
+a[2] = memory<complex<Q7>>::load(in,2 * stageLength * strideFactor);
+a[3] = memory<complex<Q7>>::load(in,3 * stageLength * strideFactor);
+a[4] = memory<complex<Q7>>::load(in,4 * stageLength * strideFactor);
+a[5] = memory<complex<Q7>>::load(in,5 * stageLength * strideFactor);
+a[6] = memory<complex<Q7>>::load(in,6 * stageLength * strideFactor);
+a[7] = memory<complex<Q7>>::load(in,7 * stageLength * strideFactor);
+
+
+tmp_0 = shadd(a[0] , a[4]) ;
+tmp_1 = shadd(a[2] , a[6]) ;
+tmp_2 = shadd(tmp_0 , tmp_1) ;
+tmp_3 = shadd(a[1] , a[5]) ;
+tmp_4 = shadd(a[3] , a[7]) ;
+tmp_5 = shadd(tmp_3 , tmp_4) ;
+res[0] = shadd(tmp_2 , tmp_5) ;
+tmp_6 = shsub(a[0] , a[4]) ;
+tmp_7 = shsub(a[2] , a[6]) ;
+tmp_8 =  rot(tmp_7)  ;
+tmp_9 = shsub(tmp_6 , tmp_8) ;
+tmp_10 = shsub(a[3] , a[7]) ;
+tmp_11 = (C2_8_notw) * tmp_10 ;
+tmp_12 = shsub(a[1] , a[5]) ;
+tmp_13 = (C1_8_notw) * tmp_12 ;
+tmp_14 = (tmp_11 + tmp_13) ;
+res[1] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   +  decq(tmp_14,1)  ) )  ;
+tmp_15 = shsub(tmp_0 , tmp_1) ;
+tmp_16 = shsub(tmp_3 , tmp_4) ;
+tmp_17 =  rot(tmp_16)  ;
+res[2] = shsub(tmp_15 , tmp_17) ;
+tmp_18 = shadd(tmp_6 , tmp_8) ;
+tmp_19 = (tmp_13 - tmp_11) ;
+tmp_20 =  rot(tmp_19)  ;
+res[3] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   -  decq(tmp_20,1)  ) )  ;
+res[4] = shsub(tmp_2 , tmp_5) ;
+res[5] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   -  decq(tmp_14,1)  ) )  ;
+res[6] = shadd(tmp_15 , tmp_17) ;
+res[7] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   +  decq(tmp_20,1)  ) )  ;
+
+
+memory<complex<Q7>>::store(out,0 * stageLength * strideFactor , res[0]);
+memory<complex<Q7>>::store(out,1 * stageLength * strideFactor , res[1]);
+memory<complex<Q7>>::store(out,2 * stageLength * strideFactor , res[2]);
+memory<complex<Q7>>::store(out,3 * stageLength * strideFactor , res[3]);
+memory<complex<Q7>>::store(out,4 * stageLength * strideFactor , res[4]);
+memory<complex<Q7>>::store(out,5 * stageLength * strideFactor , res[5]);
+memory<complex<Q7>>::store(out,6 * stageLength * strideFactor , res[6]);
+memory<complex<Q7>>::store(out,7 * stageLength * strideFactor , res[7]);
+
+
+};
+
+/* Nb Multiplications = 12, 
+Nb Additions = 24,
+Nb Negates = 12,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 3
+
+*/
+ __STATIC_FORCEINLINE void run_op_tw(int stageLength,const complex<Q7> *w,const complex<Q7> *in,complex<Q7> *out,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+complex<Q7> a[8];
+complex<Q7> res[8];
+
+
+ complex<Q7> tmp_0;
+ complex<Q7> tmp_1;
+ complex<Q7> tmp_2;
+ complex<Q7> tmp_3;
+ complex<Q7> tmp_4;
+ complex<Q7> tmp_5;
+ complex<Q7> tmp_6;
+ complex<Q7> tmp_7;
+ complex<Q7> tmp_8;
+ complex<Q7> tmp_9;
+ complex<Q7> tmp_10;
+ complex<Q15> tmp_11;
+ complex<Q7> tmp_12;
+ complex<Q15> tmp_13;
+ complex<Q15> tmp_14;
+ complex<Q7> tmp_15;
+ complex<Q7> tmp_16;
+ complex<Q7> tmp_17;
+ complex<Q7> tmp_18;
+ complex<Q15> tmp_19;
+ complex<Q15> tmp_20;
+
+
+a[0] = memory<complex<Q7>>::load(in,0 * stageLength * strideFactor);
+a[1] = memory<complex<Q7>>::load(in,1 * stageLength * strideFactor);
+a[2] = memory<complex<Q7>>::load(in,2 * stageLength * strideFactor);
+a[3] = memory<complex<Q7>>::load(in,3 * stageLength * strideFactor);
+a[4] = memory<complex<Q7>>::load(in,4 * stageLength * strideFactor);
+a[5] = memory<complex<Q7>>::load(in,5 * stageLength * strideFactor);
+a[6] = memory<complex<Q7>>::load(in,6 * stageLength * strideFactor);
+a[7] = memory<complex<Q7>>::load(in,7 * stageLength * strideFactor);
+
+
+tmp_0 = shadd(a[0] , a[4]) ;
+tmp_1 = shadd(a[2] , a[6]) ;
+tmp_2 = shadd(tmp_0 , tmp_1) ;
+tmp_3 = shadd(a[1] , a[5]) ;
+tmp_4 = shadd(a[3] , a[7]) ;
+tmp_5 = shadd(tmp_3 , tmp_4) ;
+res[0] = shadd(tmp_2 , tmp_5) ;
+tmp_6 = shsub(a[0] , a[4]) ;
+tmp_7 = shsub(a[2] , a[6]) ;
+tmp_8 =  rot(tmp_7)  ;
+tmp_9 = shsub(tmp_6 , tmp_8) ;
+tmp_10 = shsub(a[3] , a[7]) ;
+tmp_11 = (C2_8_tw) * tmp_10 ;
+tmp_12 = shsub(a[1] , a[5]) ;
+tmp_13 = (C1_8_tw) * tmp_12 ;
+tmp_14 = (tmp_11 + tmp_13) ;
+res[1] =  narrow<1,complex<Q7>>::run(w[0] *  narrow<NORMALNARROW,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   +  decq(tmp_14,1)  ) )   )  ;
+tmp_15 = shsub(tmp_0 , tmp_1) ;
+tmp_16 = shsub(tmp_3 , tmp_4) ;
+tmp_17 =  rot(tmp_16)  ;
+res[2] =  narrow<NORMALNARROW,complex<Q7>>::run(w[1] * shsub(tmp_15 , tmp_17)  )  ;
+tmp_18 = shadd(tmp_6 , tmp_8) ;
+tmp_19 = (tmp_13 - tmp_11) ;
+tmp_20 =  rot(tmp_19)  ;
+res[3] =  narrow<1,complex<Q7>>::run(w[2] *  narrow<NORMALNARROW,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   -  decq(tmp_20,1)  ) )   )  ;
+res[4] =  narrow<NORMALNARROW,complex<Q7>>::run(w[3] * shsub(tmp_2 , tmp_5)  )  ;
+res[5] =  narrow<1,complex<Q7>>::run(w[4] *  narrow<NORMALNARROW,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   -  decq(tmp_14,1)  ) )   )  ;
+res[6] =  narrow<NORMALNARROW,complex<Q7>>::run(w[5] * shadd(tmp_15 , tmp_17)  )  ;
+res[7] =  narrow<1,complex<Q7>>::run(w[6] *  narrow<NORMALNARROW,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   +  decq(tmp_20,1)  ) )   )  ;
+
+
+memory<complex<Q7>>::store(out,0 * stageLength * strideFactor , res[0]);
+memory<complex<Q7>>::store(out,1 * stageLength * strideFactor , res[1]);
+memory<complex<Q7>>::store(out,2 * stageLength * strideFactor , res[2]);
+memory<complex<Q7>>::store(out,3 * stageLength * strideFactor , res[3]);
+memory<complex<Q7>>::store(out,4 * stageLength * strideFactor , res[4]);
+memory<complex<Q7>>::store(out,5 * stageLength * strideFactor , res[5]);
+memory<complex<Q7>>::store(out,6 * stageLength * strideFactor , res[6]);
+memory<complex<Q7>>::store(out,7 * stageLength * strideFactor , res[7]);
+
+
+};
+
+/* Nb Multiplications = 5, 
+Nb Additions = 24,
+Nb Negates = 12,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 3
+
+*/
+ __STATIC_FORCEINLINE void run_ip_last(complex<Q7> *in,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+complex<Q7> a[8];
+complex<Q7> res[8];
+
+
+ complex<Q7> tmp_0;
+ complex<Q7> tmp_1;
+ complex<Q7> tmp_2;
+ complex<Q7> tmp_3;
+ complex<Q7> tmp_4;
+ complex<Q7> tmp_5;
+ complex<Q7> tmp_6;
+ complex<Q7> tmp_7;
+ complex<Q7> tmp_8;
+ complex<Q7> tmp_9;
+ complex<Q7> tmp_10;
+ complex<Q15> tmp_11;
+ complex<Q7> tmp_12;
+ complex<Q15> tmp_13;
+ complex<Q15> tmp_14;
+ complex<Q7> tmp_15;
+ complex<Q7> tmp_16;
+ complex<Q7> tmp_17;
+ complex<Q7> tmp_18;
+ complex<Q15> tmp_19;
+ complex<Q15> tmp_20;
+
+
+a[0] = memory<complex<Q7>>::load(in,0 * strideFactor);
+a[1] = memory<complex<Q7>>::load(in,1 * strideFactor);
+a[2] = memory<complex<Q7>>::load(in,2 * strideFactor);
+a[3] = memory<complex<Q7>>::load(in,3 * strideFactor);
+a[4] = memory<complex<Q7>>::load(in,4 * strideFactor);
+a[5] = memory<complex<Q7>>::load(in,5 * strideFactor);
+a[6] = memory<complex<Q7>>::load(in,6 * strideFactor);
+a[7] = memory<complex<Q7>>::load(in,7 * strideFactor);
+
+
+tmp_0 = shadd(a[0] , a[4]) ;
+tmp_1 = shadd(a[2] , a[6]) ;
+tmp_2 = shadd(tmp_0 , tmp_1) ;
+tmp_3 = shadd(a[1] , a[5]) ;
+tmp_4 = shadd(a[3] , a[7]) ;
+tmp_5 = shadd(tmp_3 , tmp_4) ;
+res[0] = shadd(tmp_2 , tmp_5) ;
+tmp_6 = shsub(a[0] , a[4]) ;
+tmp_7 = shsub(a[2] , a[6]) ;
+tmp_8 =  rot(tmp_7)  ;
+tmp_9 = shsub(tmp_6 , tmp_8) ;
+tmp_10 = shsub(a[3] , a[7]) ;
+tmp_11 = (C2_8_notw) * tmp_10 ;
+tmp_12 = shsub(a[1] , a[5]) ;
+tmp_13 = (C1_8_notw) * tmp_12 ;
+tmp_14 = (tmp_11 + tmp_13) ;
+res[1] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   +  decq(tmp_14,1)  ) )  ;
+tmp_15 = shsub(tmp_0 , tmp_1) ;
+tmp_16 = shsub(tmp_3 , tmp_4) ;
+tmp_17 =  rot(tmp_16)  ;
+res[2] = shsub(tmp_15 , tmp_17) ;
+tmp_18 = shadd(tmp_6 , tmp_8) ;
+tmp_19 = (tmp_13 - tmp_11) ;
+tmp_20 =  rot(tmp_19)  ;
+res[3] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   -  decq(tmp_20,1)  ) )  ;
+res[4] = shsub(tmp_2 , tmp_5) ;
+res[5] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   -  decq(tmp_14,1)  ) )  ;
+res[6] = shadd(tmp_15 , tmp_17) ;
+res[7] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   +  decq(tmp_20,1)  ) )  ;
+
+
+memory<complex<Q7>>::store(in,0 * strideFactor , res[0]);
+memory<complex<Q7>>::store(in,1 * strideFactor , res[1]);
+memory<complex<Q7>>::store(in,2 * strideFactor , res[2]);
+memory<complex<Q7>>::store(in,3 * strideFactor , res[3]);
+memory<complex<Q7>>::store(in,4 * strideFactor , res[4]);
+memory<complex<Q7>>::store(in,5 * strideFactor , res[5]);
+memory<complex<Q7>>::store(in,6 * strideFactor , res[6]);
+memory<complex<Q7>>::store(in,7 * strideFactor , res[7]);
+
+
+};
+
+/* Nb Multiplications = 5, 
+Nb Additions = 24,
+Nb Negates = 12,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 3
+
+*/
+ __STATIC_FORCEINLINE void run_op_last(const complex<Q7> *in,complex<Q7> *out,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+complex<Q7> a[8];
+complex<Q7> res[8];
+
+
+ complex<Q7> tmp_0;
+ complex<Q7> tmp_1;
+ complex<Q7> tmp_2;
+ complex<Q7> tmp_3;
+ complex<Q7> tmp_4;
+ complex<Q7> tmp_5;
+ complex<Q7> tmp_6;
+ complex<Q7> tmp_7;
+ complex<Q7> tmp_8;
+ complex<Q7> tmp_9;
+ complex<Q7> tmp_10;
+ complex<Q15> tmp_11;
+ complex<Q7> tmp_12;
+ complex<Q15> tmp_13;
+ complex<Q15> tmp_14;
+ complex<Q7> tmp_15;
+ complex<Q7> tmp_16;
+ complex<Q7> tmp_17;
+ complex<Q7> tmp_18;
+ complex<Q15> tmp_19;
+ complex<Q15> tmp_20;
+
+
+a[0] = memory<complex<Q7>>::load(in,0 * strideFactor);
+a[1] = memory<complex<Q7>>::load(in,1 * strideFactor);
+a[2] = memory<complex<Q7>>::load(in,2 * strideFactor);
+a[3] = memory<complex<Q7>>::load(in,3 * strideFactor);
+a[4] = memory<complex<Q7>>::load(in,4 * strideFactor);
+a[5] = memory<complex<Q7>>::load(in,5 * strideFactor);
+a[6] = memory<complex<Q7>>::load(in,6 * strideFactor);
+a[7] = memory<complex<Q7>>::load(in,7 * strideFactor);
+
+
+tmp_0 = shadd(a[0] , a[4]) ;
+tmp_1 = shadd(a[2] , a[6]) ;
+tmp_2 = shadd(tmp_0 , tmp_1) ;
+tmp_3 = shadd(a[1] , a[5]) ;
+tmp_4 = shadd(a[3] , a[7]) ;
+tmp_5 = shadd(tmp_3 , tmp_4) ;
+res[0] = shadd(tmp_2 , tmp_5) ;
+tmp_6 = shsub(a[0] , a[4]) ;
+tmp_7 = shsub(a[2] , a[6]) ;
+tmp_8 =  rot(tmp_7)  ;
+tmp_9 = shsub(tmp_6 , tmp_8) ;
+tmp_10 = shsub(a[3] , a[7]) ;
+tmp_11 = (C2_8_notw) * tmp_10 ;
+tmp_12 = shsub(a[1] , a[5]) ;
+tmp_13 = (C1_8_notw) * tmp_12 ;
+tmp_14 = (tmp_11 + tmp_13) ;
+res[1] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   +  decq(tmp_14,1)  ) )  ;
+tmp_15 = shsub(tmp_0 , tmp_1) ;
+tmp_16 = shsub(tmp_3 , tmp_4) ;
+tmp_17 =  rot(tmp_16)  ;
+res[2] = shsub(tmp_15 , tmp_17) ;
+tmp_18 = shadd(tmp_6 , tmp_8) ;
+tmp_19 = (tmp_13 - tmp_11) ;
+tmp_20 =  rot(tmp_19)  ;
+res[3] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   -  decq(tmp_20,1)  ) )  ;
+res[4] = shsub(tmp_2 , tmp_5) ;
+res[5] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   -  decq(tmp_14,1)  ) )  ;
+res[6] = shadd(tmp_15 , tmp_17) ;
+res[7] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   +  decq(tmp_20,1)  ) )  ;
+
+
+memory<complex<Q7>>::store(out,0 * strideFactor , res[0]);
+memory<complex<Q7>>::store(out,1 * strideFactor , res[1]);
+memory<complex<Q7>>::store(out,2 * strideFactor , res[2]);
+memory<complex<Q7>>::store(out,3 * strideFactor , res[3]);
+memory<complex<Q7>>::store(out,4 * strideFactor , res[4]);
+memory<complex<Q7>>::store(out,5 * strideFactor , res[5]);
+memory<complex<Q7>>::store(out,6 * strideFactor , res[6]);
+memory<complex<Q7>>::store(out,7 * strideFactor , res[7]);
+
+
+};
+
+};
+
+/**************
+
+INVERSE FFT 
+
+***************/
+template<int inputstrideenabled> 
+struct radix<INVERSE,Q7, 8,inputstrideenabled>{
+
+static constexpr complex<Q7> C0_8_tw{Q7{(q7_t)0x00}, Q7{(q7_t)0x7F}};
+  static constexpr complex<Q7> C1_8_tw{Q7{(q7_t)0x5B}, Q7{(q7_t)0x5B}};
+  static constexpr complex<Q7> C2_8_tw{Q7{(q7_t)0xA5}, Q7{(q7_t)0x5B}};
+  
+static constexpr complex<Q7> C0_8_notw{Q7{(q7_t)0x00}, Q7{(q7_t)0x7F}};
+  static constexpr complex<Q7> C1_8_notw{Q7{(q7_t)0x5B}, Q7{(q7_t)0x5B}};
+  static constexpr complex<Q7> C2_8_notw{Q7{(q7_t)0xA5}, Q7{(q7_t)0x5B}};
+  
+
+/* Nb Multiplications = 5, 
+Nb Additions = 24,
+Nb Negates = 12,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 3
+
+*/
+ __STATIC_FORCEINLINE void run_ip_notw(int stageLength,complex<Q7> *in,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+complex<Q7> a[8];
+complex<Q7> res[8];
+
+
+ complex<Q7> tmp_0;
+ complex<Q7> tmp_1;
+ complex<Q7> tmp_2;
+ complex<Q7> tmp_3;
+ complex<Q7> tmp_4;
+ complex<Q7> tmp_5;
+ complex<Q7> tmp_6;
+ complex<Q7> tmp_7;
+ complex<Q7> tmp_8;
+ complex<Q7> tmp_9;
+ complex<Q7> tmp_10;
+ complex<Q15> tmp_11;
+ complex<Q7> tmp_12;
+ complex<Q15> tmp_13;
+ complex<Q15> tmp_14;
+ complex<Q7> tmp_15;
+ complex<Q7> tmp_16;
+ complex<Q7> tmp_17;
+ complex<Q7> tmp_18;
+ complex<Q15> tmp_19;
+ complex<Q15> tmp_20;
+
+
+a[0] = memory<complex<Q7>>::load(in,0 * stageLength * strideFactor);
+a[1] = memory<complex<Q7>>::load(in,1 * stageLength * strideFactor);
+a[2] = memory<complex<Q7>>::load(in,2 * stageLength * strideFactor);
+a[3] = memory<complex<Q7>>::load(in,3 * stageLength * strideFactor);
+a[4] = memory<complex<Q7>>::load(in,4 * stageLength * strideFactor);
+a[5] = memory<complex<Q7>>::load(in,5 * stageLength * strideFactor);
+a[6] = memory<complex<Q7>>::load(in,6 * stageLength * strideFactor);
+a[7] = memory<complex<Q7>>::load(in,7 * stageLength * strideFactor);
+
+
+tmp_0 = shadd(a[0] , a[4]) ;
+tmp_1 = shadd(a[2] , a[6]) ;
+tmp_2 = shadd(tmp_0 , tmp_1) ;
+tmp_3 = shadd(a[1] , a[5]) ;
+tmp_4 = shadd(a[3] , a[7]) ;
+tmp_5 = shadd(tmp_3 , tmp_4) ;
+res[0] = shadd(tmp_2 , tmp_5) ;
+tmp_6 = shsub(a[0] , a[4]) ;
+tmp_7 = shsub(a[2] , a[6]) ;
+tmp_8 =  rot(tmp_7)  ;
+tmp_9 = shadd(tmp_6 , tmp_8) ;
+tmp_10 = shsub(a[3] , a[7]) ;
+tmp_11 = (C2_8_notw) * tmp_10 ;
+tmp_12 = shsub(a[1] , a[5]) ;
+tmp_13 = (C1_8_notw) * tmp_12 ;
+tmp_14 = (tmp_11 + tmp_13) ;
+res[1] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   +  decq(tmp_14,1)  ) )  ;
+tmp_15 = shsub(tmp_0 , tmp_1) ;
+tmp_16 = shsub(tmp_3 , tmp_4) ;
+tmp_17 =  rot(tmp_16)  ;
+res[2] = shadd(tmp_15 , tmp_17) ;
+tmp_18 = shsub(tmp_6 , tmp_8) ;
+tmp_19 = (tmp_13 - tmp_11) ;
+tmp_20 =  rot(tmp_19)  ;
+res[3] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   +  decq(tmp_20,1)  ) )  ;
+res[4] = shsub(tmp_2 , tmp_5) ;
+res[5] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   -  decq(tmp_14,1)  ) )  ;
+res[6] = shsub(tmp_15 , tmp_17) ;
+res[7] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   -  decq(tmp_20,1)  ) )  ;
+
+
+memory<complex<Q7>>::store(in,0 * stageLength * strideFactor , res[0]);
+memory<complex<Q7>>::store(in,1 * stageLength * strideFactor , res[1]);
+memory<complex<Q7>>::store(in,2 * stageLength * strideFactor , res[2]);
+memory<complex<Q7>>::store(in,3 * stageLength * strideFactor , res[3]);
+memory<complex<Q7>>::store(in,4 * stageLength * strideFactor , res[4]);
+memory<complex<Q7>>::store(in,5 * stageLength * strideFactor , res[5]);
+memory<complex<Q7>>::store(in,6 * stageLength * strideFactor , res[6]);
+memory<complex<Q7>>::store(in,7 * stageLength * strideFactor , res[7]);
+
+
+};
+
+/* Nb Multiplications = 12, 
+Nb Additions = 24,
+Nb Negates = 12,
+Nb Conjugates = 7,
+*/
+/*
+
+Output format : Shifted right by 3
+
+*/
+ __STATIC_FORCEINLINE void run_ip_tw(int stageLength,const complex<Q7> *w,complex<Q7> *in,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+complex<Q7> a[8];
+complex<Q7> res[8];
+
+
+ complex<Q7> tmp_0;
+ complex<Q7> tmp_1;
+ complex<Q7> tmp_2;
+ complex<Q7> tmp_3;
+ complex<Q7> tmp_4;
+ complex<Q7> tmp_5;
+ complex<Q7> tmp_6;
+ complex<Q7> tmp_7;
+ complex<Q7> tmp_8;
+ complex<Q7> tmp_9;
+ complex<Q7> tmp_10;
+ complex<Q15> tmp_11;
+ complex<Q7> tmp_12;
+ complex<Q15> tmp_13;
+ complex<Q15> tmp_14;
+ complex<Q7> tmp_15;
+ complex<Q7> tmp_16;
+ complex<Q7> tmp_17;
+ complex<Q7> tmp_18;
+ complex<Q15> tmp_19;
+ complex<Q15> tmp_20;
+
+
+a[0] = memory<complex<Q7>>::load(in,0 * stageLength * strideFactor);
+a[1] = memory<complex<Q7>>::load(in,1 * stageLength * strideFactor);
+a[2] = memory<complex<Q7>>::load(in,2 * stageLength * strideFactor);
+a[3] = memory<complex<Q7>>::load(in,3 * stageLength * strideFactor);
+a[4] = memory<complex<Q7>>::load(in,4 * stageLength * strideFactor);
+a[5] = memory<complex<Q7>>::load(in,5 * stageLength * strideFactor);
+a[6] = memory<complex<Q7>>::load(in,6 * stageLength * strideFactor);
+a[7] = memory<complex<Q7>>::load(in,7 * stageLength * strideFactor);
+
+
+tmp_0 = shadd(a[0] , a[4]) ;
+tmp_1 = shadd(a[2] , a[6]) ;
+tmp_2 = shadd(tmp_0 , tmp_1) ;
+tmp_3 = shadd(a[1] , a[5]) ;
+tmp_4 = shadd(a[3] , a[7]) ;
+tmp_5 = shadd(tmp_3 , tmp_4) ;
+res[0] = shadd(tmp_2 , tmp_5) ;
+tmp_6 = shsub(a[0] , a[4]) ;
+tmp_7 = shsub(a[2] , a[6]) ;
+tmp_8 =  rot(tmp_7)  ;
+tmp_9 = shadd(tmp_6 , tmp_8) ;
+tmp_10 = shsub(a[3] , a[7]) ;
+tmp_11 = (C2_8_tw) * tmp_10 ;
+tmp_12 = shsub(a[1] , a[5]) ;
+tmp_13 = (C1_8_tw) * tmp_12 ;
+tmp_14 = (tmp_11 + tmp_13) ;
+res[1] =  narrow<1,complex<Q7>>::run(multconj( narrow<NORMALNARROW,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   +  decq(tmp_14,1)  ) )   , w[0]) )  ;
+tmp_15 = shsub(tmp_0 , tmp_1) ;
+tmp_16 = shsub(tmp_3 , tmp_4) ;
+tmp_17 =  rot(tmp_16)  ;
+res[2] =  narrow<NORMALNARROW,complex<Q7>>::run(multconj(shadd(tmp_15 , tmp_17)  , w[1]) )  ;
+tmp_18 = shsub(tmp_6 , tmp_8) ;
+tmp_19 = (tmp_13 - tmp_11) ;
+tmp_20 =  rot(tmp_19)  ;
+res[3] =  narrow<1,complex<Q7>>::run(multconj( narrow<NORMALNARROW,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   +  decq(tmp_20,1)  ) )   , w[2]) )  ;
+res[4] =  narrow<NORMALNARROW,complex<Q7>>::run(multconj(shsub(tmp_2 , tmp_5)  , w[3]) )  ;
+res[5] =  narrow<1,complex<Q7>>::run(multconj( narrow<NORMALNARROW,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   -  decq(tmp_14,1)  ) )   , w[4]) )  ;
+res[6] =  narrow<NORMALNARROW,complex<Q7>>::run(multconj(shsub(tmp_15 , tmp_17)  , w[5]) )  ;
+res[7] =  narrow<1,complex<Q7>>::run(multconj( narrow<NORMALNARROW,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   -  decq(tmp_20,1)  ) )   , w[6]) )  ;
+
+
+memory<complex<Q7>>::store(in,0 * stageLength * strideFactor , res[0]);
+memory<complex<Q7>>::store(in,1 * stageLength * strideFactor , res[1]);
+memory<complex<Q7>>::store(in,2 * stageLength * strideFactor , res[2]);
+memory<complex<Q7>>::store(in,3 * stageLength * strideFactor , res[3]);
+memory<complex<Q7>>::store(in,4 * stageLength * strideFactor , res[4]);
+memory<complex<Q7>>::store(in,5 * stageLength * strideFactor , res[5]);
+memory<complex<Q7>>::store(in,6 * stageLength * strideFactor , res[6]);
+memory<complex<Q7>>::store(in,7 * stageLength * strideFactor , res[7]);
+
+
+};
+
+/* Nb Multiplications = 5, 
+Nb Additions = 24,
+Nb Negates = 12,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 3
+
+*/
+ __STATIC_FORCEINLINE void run_op_notw(int stageLength,const complex<Q7> *in,complex<Q7> *out,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+complex<Q7> a[8];
+complex<Q7> res[8];
+
+
+ complex<Q7> tmp_0;
+ complex<Q7> tmp_1;
+ complex<Q7> tmp_2;
+ complex<Q7> tmp_3;
+ complex<Q7> tmp_4;
+ complex<Q7> tmp_5;
+ complex<Q7> tmp_6;
+ complex<Q7> tmp_7;
+ complex<Q7> tmp_8;
+ complex<Q7> tmp_9;
+ complex<Q7> tmp_10;
+ complex<Q15> tmp_11;
+ complex<Q7> tmp_12;
+ complex<Q15> tmp_13;
+ complex<Q15> tmp_14;
+ complex<Q7> tmp_15;
+ complex<Q7> tmp_16;
+ complex<Q7> tmp_17;
+ complex<Q7> tmp_18;
+ complex<Q15> tmp_19;
+ complex<Q15> tmp_20;
+
+
+a[0] = memory<complex<Q7>>::load(in,0 * stageLength * strideFactor);
+a[1] = memory<complex<Q7>>::load(in,1 * stageLength * strideFactor);
+a[2] = memory<complex<Q7>>::load(in,2 * stageLength * strideFactor);
+a[3] = memory<complex<Q7>>::load(in,3 * stageLength * strideFactor);
+a[4] = memory<complex<Q7>>::load(in,4 * stageLength * strideFactor);
+a[5] = memory<complex<Q7>>::load(in,5 * stageLength * strideFactor);
+a[6] = memory<complex<Q7>>::load(in,6 * stageLength * strideFactor);
+a[7] = memory<complex<Q7>>::load(in,7 * stageLength * strideFactor);
+
+
+tmp_0 = shadd(a[0] , a[4]) ;
+tmp_1 = shadd(a[2] , a[6]) ;
+tmp_2 = shadd(tmp_0 , tmp_1) ;
+tmp_3 = shadd(a[1] , a[5]) ;
+tmp_4 = shadd(a[3] , a[7]) ;
+tmp_5 = shadd(tmp_3 , tmp_4) ;
+res[0] = shadd(tmp_2 , tmp_5) ;
+tmp_6 = shsub(a[0] , a[4]) ;
+tmp_7 = shsub(a[2] , a[6]) ;
+tmp_8 =  rot(tmp_7)  ;
+tmp_9 = shadd(tmp_6 , tmp_8) ;
+tmp_10 = shsub(a[3] , a[7]) ;
+tmp_11 = (C2_8_notw) * tmp_10 ;
+tmp_12 = shsub(a[1] , a[5]) ;
+tmp_13 = (C1_8_notw) * tmp_12 ;
+tmp_14 = (tmp_11 + tmp_13) ;
+res[1] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   +  decq(tmp_14,1)  ) )  ;
+tmp_15 = shsub(tmp_0 , tmp_1) ;
+tmp_16 = shsub(tmp_3 , tmp_4) ;
+tmp_17 =  rot(tmp_16)  ;
+res[2] = shadd(tmp_15 , tmp_17) ;
+tmp_18 = shsub(tmp_6 , tmp_8) ;
+tmp_19 = (tmp_13 - tmp_11) ;
+tmp_20 =  rot(tmp_19)  ;
+res[3] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   +  decq(tmp_20,1)  ) )  ;
+res[4] = shsub(tmp_2 , tmp_5) ;
+res[5] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   -  decq(tmp_14,1)  ) )  ;
+res[6] = shsub(tmp_15 , tmp_17) ;
+res[7] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   -  decq(tmp_20,1)  ) )  ;
+
+
+memory<complex<Q7>>::store(out,0 * stageLength * strideFactor , res[0]);
+memory<complex<Q7>>::store(out,1 * stageLength * strideFactor , res[1]);
+memory<complex<Q7>>::store(out,2 * stageLength * strideFactor , res[2]);
+memory<complex<Q7>>::store(out,3 * stageLength * strideFactor , res[3]);
+memory<complex<Q7>>::store(out,4 * stageLength * strideFactor , res[4]);
+memory<complex<Q7>>::store(out,5 * stageLength * strideFactor , res[5]);
+memory<complex<Q7>>::store(out,6 * stageLength * strideFactor , res[6]);
+memory<complex<Q7>>::store(out,7 * stageLength * strideFactor , res[7]);
+
+
+};
+
+/* Nb Multiplications = 12, 
+Nb Additions = 24,
+Nb Negates = 12,
+Nb Conjugates = 7,
+*/
+/*
+
+Output format : Shifted right by 3
+
+*/
+ __STATIC_FORCEINLINE void run_op_tw(int stageLength,const complex<Q7> *w,const complex<Q7> *in,complex<Q7> *out,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+complex<Q7> a[8];
+complex<Q7> res[8];
+
+
+ complex<Q7> tmp_0;
+ complex<Q7> tmp_1;
+ complex<Q7> tmp_2;
+ complex<Q7> tmp_3;
+ complex<Q7> tmp_4;
+ complex<Q7> tmp_5;
+ complex<Q7> tmp_6;
+ complex<Q7> tmp_7;
+ complex<Q7> tmp_8;
+ complex<Q7> tmp_9;
+ complex<Q7> tmp_10;
+ complex<Q15> tmp_11;
+ complex<Q7> tmp_12;
+ complex<Q15> tmp_13;
+ complex<Q15> tmp_14;
+ complex<Q7> tmp_15;
+ complex<Q7> tmp_16;
+ complex<Q7> tmp_17;
+ complex<Q7> tmp_18;
+ complex<Q15> tmp_19;
+ complex<Q15> tmp_20;
+
+
+a[0] = memory<complex<Q7>>::load(in,0 * stageLength * strideFactor);
+a[1] = memory<complex<Q7>>::load(in,1 * stageLength * strideFactor);
+a[2] = memory<complex<Q7>>::load(in,2 * stageLength * strideFactor);
+a[3] = memory<complex<Q7>>::load(in,3 * stageLength * strideFactor);
+a[4] = memory<complex<Q7>>::load(in,4 * stageLength * strideFactor);
+a[5] = memory<complex<Q7>>::load(in,5 * stageLength * strideFactor);
+a[6] = memory<complex<Q7>>::load(in,6 * stageLength * strideFactor);
+a[7] = memory<complex<Q7>>::load(in,7 * stageLength * strideFactor);
+
+
+tmp_0 = shadd(a[0] , a[4]) ;
+tmp_1 = shadd(a[2] , a[6]) ;
+tmp_2 = shadd(tmp_0 , tmp_1) ;
+tmp_3 = shadd(a[1] , a[5]) ;
+tmp_4 = shadd(a[3] , a[7]) ;
+tmp_5 = shadd(tmp_3 , tmp_4) ;
+res[0] = shadd(tmp_2 , tmp_5) ;
+tmp_6 = shsub(a[0] , a[4]) ;
+tmp_7 = shsub(a[2] , a[6]) ;
+tmp_8 =  rot(tmp_7)  ;
+tmp_9 = shadd(tmp_6 , tmp_8) ;
+tmp_10 = shsub(a[3] , a[7]) ;
+tmp_11 = (C2_8_tw) * tmp_10 ;
+tmp_12 = shsub(a[1] , a[5]) ;
+tmp_13 = (C1_8_tw) * tmp_12 ;
+tmp_14 = (tmp_11 + tmp_13) ;
+res[1] =  narrow<1,complex<Q7>>::run(multconj( narrow<NORMALNARROW,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   +  decq(tmp_14,1)  ) )   , w[0]) )  ;
+tmp_15 = shsub(tmp_0 , tmp_1) ;
+tmp_16 = shsub(tmp_3 , tmp_4) ;
+tmp_17 =  rot(tmp_16)  ;
+res[2] =  narrow<NORMALNARROW,complex<Q7>>::run(multconj(shadd(tmp_15 , tmp_17)  , w[1]) )  ;
+tmp_18 = shsub(tmp_6 , tmp_8) ;
+tmp_19 = (tmp_13 - tmp_11) ;
+tmp_20 =  rot(tmp_19)  ;
+res[3] =  narrow<1,complex<Q7>>::run(multconj( narrow<NORMALNARROW,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   +  decq(tmp_20,1)  ) )   , w[2]) )  ;
+res[4] =  narrow<NORMALNARROW,complex<Q7>>::run(multconj(shsub(tmp_2 , tmp_5)  , w[3]) )  ;
+res[5] =  narrow<1,complex<Q7>>::run(multconj( narrow<NORMALNARROW,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   -  decq(tmp_14,1)  ) )   , w[4]) )  ;
+res[6] =  narrow<NORMALNARROW,complex<Q7>>::run(multconj(shsub(tmp_15 , tmp_17)  , w[5]) )  ;
+res[7] =  narrow<1,complex<Q7>>::run(multconj( narrow<NORMALNARROW,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   -  decq(tmp_20,1)  ) )   , w[6]) )  ;
+
+
+memory<complex<Q7>>::store(out,0 * stageLength * strideFactor , res[0]);
+memory<complex<Q7>>::store(out,1 * stageLength * strideFactor , res[1]);
+memory<complex<Q7>>::store(out,2 * stageLength * strideFactor , res[2]);
+memory<complex<Q7>>::store(out,3 * stageLength * strideFactor , res[3]);
+memory<complex<Q7>>::store(out,4 * stageLength * strideFactor , res[4]);
+memory<complex<Q7>>::store(out,5 * stageLength * strideFactor , res[5]);
+memory<complex<Q7>>::store(out,6 * stageLength * strideFactor , res[6]);
+memory<complex<Q7>>::store(out,7 * stageLength * strideFactor , res[7]);
+
+
+};
+
+/* Nb Multiplications = 5, 
+Nb Additions = 24,
+Nb Negates = 12,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 3
+
+*/
+ __STATIC_FORCEINLINE void run_ip_last(complex<Q7> *in,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+complex<Q7> a[8];
+complex<Q7> res[8];
+
+
+ complex<Q7> tmp_0;
+ complex<Q7> tmp_1;
+ complex<Q7> tmp_2;
+ complex<Q7> tmp_3;
+ complex<Q7> tmp_4;
+ complex<Q7> tmp_5;
+ complex<Q7> tmp_6;
+ complex<Q7> tmp_7;
+ complex<Q7> tmp_8;
+ complex<Q7> tmp_9;
+ complex<Q7> tmp_10;
+ complex<Q15> tmp_11;
+ complex<Q7> tmp_12;
+ complex<Q15> tmp_13;
+ complex<Q15> tmp_14;
+ complex<Q7> tmp_15;
+ complex<Q7> tmp_16;
+ complex<Q7> tmp_17;
+ complex<Q7> tmp_18;
+ complex<Q15> tmp_19;
+ complex<Q15> tmp_20;
+
+
+a[0] = memory<complex<Q7>>::load(in,0 * strideFactor);
+a[1] = memory<complex<Q7>>::load(in,1 * strideFactor);
+a[2] = memory<complex<Q7>>::load(in,2 * strideFactor);
+a[3] = memory<complex<Q7>>::load(in,3 * strideFactor);
+a[4] = memory<complex<Q7>>::load(in,4 * strideFactor);
+a[5] = memory<complex<Q7>>::load(in,5 * strideFactor);
+a[6] = memory<complex<Q7>>::load(in,6 * strideFactor);
+a[7] = memory<complex<Q7>>::load(in,7 * strideFactor);
+
+
+tmp_0 = shadd(a[0] , a[4]) ;
+tmp_1 = shadd(a[2] , a[6]) ;
+tmp_2 = shadd(tmp_0 , tmp_1) ;
+tmp_3 = shadd(a[1] , a[5]) ;
+tmp_4 = shadd(a[3] , a[7]) ;
+tmp_5 = shadd(tmp_3 , tmp_4) ;
+res[0] = shadd(tmp_2 , tmp_5) ;
+tmp_6 = shsub(a[0] , a[4]) ;
+tmp_7 = shsub(a[2] , a[6]) ;
+tmp_8 =  rot(tmp_7)  ;
+tmp_9 = shadd(tmp_6 , tmp_8) ;
+tmp_10 = shsub(a[3] , a[7]) ;
+tmp_11 = (C2_8_notw) * tmp_10 ;
+tmp_12 = shsub(a[1] , a[5]) ;
+tmp_13 = (C1_8_notw) * tmp_12 ;
+tmp_14 = (tmp_11 + tmp_13) ;
+res[1] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   +  decq(tmp_14,1)  ) )  ;
+tmp_15 = shsub(tmp_0 , tmp_1) ;
+tmp_16 = shsub(tmp_3 , tmp_4) ;
+tmp_17 =  rot(tmp_16)  ;
+res[2] = shadd(tmp_15 , tmp_17) ;
+tmp_18 = shsub(tmp_6 , tmp_8) ;
+tmp_19 = (tmp_13 - tmp_11) ;
+tmp_20 =  rot(tmp_19)  ;
+res[3] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   +  decq(tmp_20,1)  ) )  ;
+res[4] = shsub(tmp_2 , tmp_5) ;
+res[5] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   -  decq(tmp_14,1)  ) )  ;
+res[6] = shsub(tmp_15 , tmp_17) ;
+res[7] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   -  decq(tmp_20,1)  ) )  ;
+
+
+memory<complex<Q7>>::store(in,0 * strideFactor , res[0]);
+memory<complex<Q7>>::store(in,1 * strideFactor , res[1]);
+memory<complex<Q7>>::store(in,2 * strideFactor , res[2]);
+memory<complex<Q7>>::store(in,3 * strideFactor , res[3]);
+memory<complex<Q7>>::store(in,4 * strideFactor , res[4]);
+memory<complex<Q7>>::store(in,5 * strideFactor , res[5]);
+memory<complex<Q7>>::store(in,6 * strideFactor , res[6]);
+memory<complex<Q7>>::store(in,7 * strideFactor , res[7]);
+
+
+};
+
+/* Nb Multiplications = 5, 
+Nb Additions = 24,
+Nb Negates = 12,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 3
+
+*/
+ __STATIC_FORCEINLINE void run_op_last(const complex<Q7> *in,complex<Q7> *out,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+complex<Q7> a[8];
+complex<Q7> res[8];
+
+
+ complex<Q7> tmp_0;
+ complex<Q7> tmp_1;
+ complex<Q7> tmp_2;
+ complex<Q7> tmp_3;
+ complex<Q7> tmp_4;
+ complex<Q7> tmp_5;
+ complex<Q7> tmp_6;
+ complex<Q7> tmp_7;
+ complex<Q7> tmp_8;
+ complex<Q7> tmp_9;
+ complex<Q7> tmp_10;
+ complex<Q15> tmp_11;
+ complex<Q7> tmp_12;
+ complex<Q15> tmp_13;
+ complex<Q15> tmp_14;
+ complex<Q7> tmp_15;
+ complex<Q7> tmp_16;
+ complex<Q7> tmp_17;
+ complex<Q7> tmp_18;
+ complex<Q15> tmp_19;
+ complex<Q15> tmp_20;
+
+
+a[0] = memory<complex<Q7>>::load(in,0 * strideFactor);
+a[1] = memory<complex<Q7>>::load(in,1 * strideFactor);
+a[2] = memory<complex<Q7>>::load(in,2 * strideFactor);
+a[3] = memory<complex<Q7>>::load(in,3 * strideFactor);
+a[4] = memory<complex<Q7>>::load(in,4 * strideFactor);
+a[5] = memory<complex<Q7>>::load(in,5 * strideFactor);
+a[6] = memory<complex<Q7>>::load(in,6 * strideFactor);
+a[7] = memory<complex<Q7>>::load(in,7 * strideFactor);
+
+
+tmp_0 = shadd(a[0] , a[4]) ;
+tmp_1 = shadd(a[2] , a[6]) ;
+tmp_2 = shadd(tmp_0 , tmp_1) ;
+tmp_3 = shadd(a[1] , a[5]) ;
+tmp_4 = shadd(a[3] , a[7]) ;
+tmp_5 = shadd(tmp_3 , tmp_4) ;
+res[0] = shadd(tmp_2 , tmp_5) ;
+tmp_6 = shsub(a[0] , a[4]) ;
+tmp_7 = shsub(a[2] , a[6]) ;
+tmp_8 =  rot(tmp_7)  ;
+tmp_9 = shadd(tmp_6 , tmp_8) ;
+tmp_10 = shsub(a[3] , a[7]) ;
+tmp_11 = (C2_8_notw) * tmp_10 ;
+tmp_12 = shsub(a[1] , a[5]) ;
+tmp_13 = (C1_8_notw) * tmp_12 ;
+tmp_14 = (tmp_11 + tmp_13) ;
+res[1] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   +  decq(tmp_14,1)  ) )  ;
+tmp_15 = shsub(tmp_0 , tmp_1) ;
+tmp_16 = shsub(tmp_3 , tmp_4) ;
+tmp_17 =  rot(tmp_16)  ;
+res[2] = shadd(tmp_15 , tmp_17) ;
+tmp_18 = shsub(tmp_6 , tmp_8) ;
+tmp_19 = (tmp_13 - tmp_11) ;
+tmp_20 =  rot(tmp_19)  ;
+res[3] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   +  decq(tmp_20,1)  ) )  ;
+res[4] = shsub(tmp_2 , tmp_5) ;
+res[5] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_9)   -  decq(tmp_14,1)  ) )  ;
+res[6] = shsub(tmp_15 , tmp_17) ;
+res[7] =  narrow<1,complex<Q7>>::run(( widen<complex<Q7>>::run(tmp_18)   -  decq(tmp_20,1)  ) )  ;
+
+
+memory<complex<Q7>>::store(out,0 * strideFactor , res[0]);
+memory<complex<Q7>>::store(out,1 * strideFactor , res[1]);
+memory<complex<Q7>>::store(out,2 * strideFactor , res[2]);
+memory<complex<Q7>>::store(out,3 * strideFactor , res[3]);
+memory<complex<Q7>>::store(out,4 * strideFactor , res[4]);
+memory<complex<Q7>>::store(out,5 * strideFactor , res[5]);
+memory<complex<Q7>>::store(out,6 * strideFactor , res[6]);
+memory<complex<Q7>>::store(out,7 * strideFactor , res[7]);
+
+
+};
+
+};
+
+#endif /* #ifndef _RADIX_Q7_8_H */
\ No newline at end of file
@@ -0,0 +1,647 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef _RADIX_VECTOR_Q7_4_H
+#define _RADIX_VECTOR_Q7_4_H
+
+#include "complex.h"
+
+/**************
+
+DIRECT FFT 
+
+***************/
+template<int inputstrideenabled> 
+struct radixVector<DIRECT,Q7, 4,inputstrideenabled>{
+
+
+/* Nb Multiplications = 0, 
+Nb Additions = 8,
+Nb Negates = 4,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 2
+
+*/
+ __STATIC_FORCEINLINE void run_ip_notw(int stageLength,complex<Q7> *in,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+int8x16_t a[4];
+int8x16_t res[4];
+
+
+ int8x16_t tmp_0;
+ int8x16_t tmp_1;
+ int8x16_t tmp_2;
+ int8x16_t tmp_3;
+
+
+a[0] = vmemory<Q7,inputstrideenabled>::load(in , 0 * stageLength, strideFactor);
+a[1] = vmemory<Q7,inputstrideenabled>::load(in , 1 * stageLength, strideFactor);
+a[2] = vmemory<Q7,inputstrideenabled>::load(in , 2 * stageLength, strideFactor);
+a[3] = vmemory<Q7,inputstrideenabled>::load(in , 3 * stageLength, strideFactor);
+
+
+tmp_0 = vhaddq(a[0] , a[2]) ;
+tmp_1 = vhaddq(a[1] , a[3]) ;
+res[0] = vhaddq(tmp_0 , tmp_1) ;
+tmp_2 = vhsubq(a[0] , a[2]) ;
+tmp_3 = vhsubq(a[1] , a[3]) ;
+res[1] = vhcaddq_rot270(tmp_2 , tmp_3) ;
+res[2] = vhsubq(tmp_0 , tmp_1) ;
+res[3] = vhcaddq_rot90(tmp_2 , tmp_3) ;
+
+
+vmemory<Q7,inputstrideenabled>::store(in, 0 * stageLength, res[0], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 1 * stageLength, res[1], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 2 * stageLength, res[2], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 3 * stageLength, res[3], strideFactor);
+
+
+};
+
+/* Nb Multiplications = 3, 
+Nb Additions = 8,
+Nb Negates = 4,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 2
+
+*/
+ __STATIC_FORCEINLINE void run_ip_tw(int stageLength,const int8x16_t *w,complex<Q7> *in,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+int8x16_t a[4];
+int8x16_t res[4];
+
+
+ int8x16_t tmp_0;
+ int8x16_t tmp_1;
+ int8x16_t tmp_2;
+ int8x16_t tmp_3;
+
+
+a[0] = vmemory<Q7,inputstrideenabled>::load(in , 0 * stageLength, strideFactor);
+a[1] = vmemory<Q7,inputstrideenabled>::load(in , 1 * stageLength, strideFactor);
+a[2] = vmemory<Q7,inputstrideenabled>::load(in , 2 * stageLength, strideFactor);
+a[3] = vmemory<Q7,inputstrideenabled>::load(in , 3 * stageLength, strideFactor);
+
+
+tmp_0 = vhaddq(a[0] , a[2]) ;
+tmp_1 = vhaddq(a[1] , a[3]) ;
+res[0] = vhaddq(tmp_0 , tmp_1) ;
+tmp_2 = vhsubq(a[0] , a[2]) ;
+tmp_3 = vhsubq(a[1] , a[3]) ;
+res[1] = vcomplex_mulq(w[0] , vhcaddq_rot270(tmp_2 , tmp_3) ) ;
+res[2] = vcomplex_mulq(w[1] , vhsubq(tmp_0 , tmp_1) ) ;
+res[3] = vcomplex_mulq(w[2] , vhcaddq_rot90(tmp_2 , tmp_3) ) ;
+
+
+vmemory<Q7,inputstrideenabled>::store(in, 0 * stageLength, res[0], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 1 * stageLength, res[1], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 2 * stageLength, res[2], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 3 * stageLength, res[3], strideFactor);
+
+
+};
+
+/* Nb Multiplications = 0, 
+Nb Additions = 8,
+Nb Negates = 4,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 2
+
+*/
+ __STATIC_FORCEINLINE void run_op_notw(int stageLength,const complex<Q7> *in,complex<Q7> *out,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+int8x16_t a[4];
+int8x16_t res[4];
+
+
+ int8x16_t tmp_0;
+ int8x16_t tmp_1;
+ int8x16_t tmp_2;
+ int8x16_t tmp_3;
+
+
+a[0] = vmemory<Q7,inputstrideenabled>::load(in , 0 * stageLength, strideFactor);
+a[1] = vmemory<Q7,inputstrideenabled>::load(in , 1 * stageLength, strideFactor);
+a[2] = vmemory<Q7,inputstrideenabled>::load(in , 2 * stageLength, strideFactor);
+a[3] = vmemory<Q7,inputstrideenabled>::load(in , 3 * stageLength, strideFactor);
+
+
+tmp_0 = vhaddq(a[0] , a[2]) ;
+tmp_1 = vhaddq(a[1] , a[3]) ;
+res[0] = vhaddq(tmp_0 , tmp_1) ;
+tmp_2 = vhsubq(a[0] , a[2]) ;
+tmp_3 = vhsubq(a[1] , a[3]) ;
+res[1] = vhcaddq_rot270(tmp_2 , tmp_3) ;
+res[2] = vhsubq(tmp_0 , tmp_1) ;
+res[3] = vhcaddq_rot90(tmp_2 , tmp_3) ;
+
+
+vmemory<Q7,inputstrideenabled>::store(out, 0 * stageLength , res[0], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 1 * stageLength , res[1], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 2 * stageLength , res[2], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 3 * stageLength , res[3], strideFactor);
+
+
+};
+
+/* Nb Multiplications = 3, 
+Nb Additions = 8,
+Nb Negates = 4,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 2
+
+*/
+ __STATIC_FORCEINLINE void run_op_tw(int stageLength,const int8x16_t *w,const complex<Q7> *in,complex<Q7> *out,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+int8x16_t a[4];
+int8x16_t res[4];
+
+
+ int8x16_t tmp_0;
+ int8x16_t tmp_1;
+ int8x16_t tmp_2;
+ int8x16_t tmp_3;
+
+
+a[0] = vmemory<Q7,inputstrideenabled>::load(in , 0 * stageLength, strideFactor);
+a[1] = vmemory<Q7,inputstrideenabled>::load(in , 1 * stageLength, strideFactor);
+a[2] = vmemory<Q7,inputstrideenabled>::load(in , 2 * stageLength, strideFactor);
+a[3] = vmemory<Q7,inputstrideenabled>::load(in , 3 * stageLength, strideFactor);
+
+
+tmp_0 = vhaddq(a[0] , a[2]) ;
+tmp_1 = vhaddq(a[1] , a[3]) ;
+res[0] = vhaddq(tmp_0 , tmp_1) ;
+tmp_2 = vhsubq(a[0] , a[2]) ;
+tmp_3 = vhsubq(a[1] , a[3]) ;
+res[1] = vcomplex_mulq(w[0] , vhcaddq_rot270(tmp_2 , tmp_3) ) ;
+res[2] = vcomplex_mulq(w[1] , vhsubq(tmp_0 , tmp_1) ) ;
+res[3] = vcomplex_mulq(w[2] , vhcaddq_rot90(tmp_2 , tmp_3) ) ;
+
+
+vmemory<Q7,inputstrideenabled>::store(out, 0 * stageLength , res[0], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 1 * stageLength , res[1], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 2 * stageLength , res[2], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 3 * stageLength , res[3], strideFactor);
+
+
+};
+
+/* Nb Multiplications = 0, 
+Nb Additions = 8,
+Nb Negates = 4,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 2
+
+*/
+ __STATIC_FORCEINLINE void run_ip_last(complex<Q7> *in,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+int8x16_t a[4];
+int8x16_t res[4];
+
+
+ int8x16_t tmp_0;
+ int8x16_t tmp_1;
+ int8x16_t tmp_2;
+ int8x16_t tmp_3;
+
+
+a[0] = vmemory<Q7,inputstrideenabled>::load(in , 0 , strideFactor);
+a[1] = vmemory<Q7,inputstrideenabled>::load(in , 1 , strideFactor);
+a[2] = vmemory<Q7,inputstrideenabled>::load(in , 2 , strideFactor);
+a[3] = vmemory<Q7,inputstrideenabled>::load(in , 3 , strideFactor);
+
+
+tmp_0 = vhaddq(a[0] , a[2]) ;
+tmp_1 = vhaddq(a[1] , a[3]) ;
+res[0] = vhaddq(tmp_0 , tmp_1) ;
+tmp_2 = vhsubq(a[0] , a[2]) ;
+tmp_3 = vhsubq(a[1] , a[3]) ;
+res[1] = vhcaddq_rot270(tmp_2 , tmp_3) ;
+res[2] = vhsubq(tmp_0 , tmp_1) ;
+res[3] = vhcaddq_rot90(tmp_2 , tmp_3) ;
+
+
+vmemory<Q7,inputstrideenabled>::store(in, 0 , res[0], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 1 , res[1], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 2 , res[2], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 3 , res[3], strideFactor);
+
+
+};
+
+/* Nb Multiplications = 0, 
+Nb Additions = 8,
+Nb Negates = 4,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 2
+
+*/
+ __STATIC_FORCEINLINE void run_op_last(const complex<Q7> *in,complex<Q7> *out,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+int8x16_t a[4];
+int8x16_t res[4];
+
+
+ int8x16_t tmp_0;
+ int8x16_t tmp_1;
+ int8x16_t tmp_2;
+ int8x16_t tmp_3;
+
+
+a[0] = vmemory<Q7,inputstrideenabled>::load(in , 0 , strideFactor);
+a[1] = vmemory<Q7,inputstrideenabled>::load(in , 1 , strideFactor);
+a[2] = vmemory<Q7,inputstrideenabled>::load(in , 2 , strideFactor);
+a[3] = vmemory<Q7,inputstrideenabled>::load(in , 3 , strideFactor);
+
+
+tmp_0 = vhaddq(a[0] , a[2]) ;
+tmp_1 = vhaddq(a[1] , a[3]) ;
+res[0] = vhaddq(tmp_0 , tmp_1) ;
+tmp_2 = vhsubq(a[0] , a[2]) ;
+tmp_3 = vhsubq(a[1] , a[3]) ;
+res[1] = vhcaddq_rot270(tmp_2 , tmp_3) ;
+res[2] = vhsubq(tmp_0 , tmp_1) ;
+res[3] = vhcaddq_rot90(tmp_2 , tmp_3) ;
+
+
+vmemory<Q7,inputstrideenabled>::store(out, 0, res[0], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 1, res[1], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 2, res[2], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 3, res[3], strideFactor);
+
+
+};
+
+};
+
+/**************
+
+INVERSE FFT 
+
+***************/
+template<int inputstrideenabled> 
+struct radixVector<INVERSE,Q7, 4,inputstrideenabled>{
+
+
+/* Nb Multiplications = 0, 
+Nb Additions = 8,
+Nb Negates = 4,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 2
+
+*/
+ __STATIC_FORCEINLINE void run_ip_notw(int stageLength,complex<Q7> *in,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+int8x16_t a[4];
+int8x16_t res[4];
+
+
+ int8x16_t tmp_0;
+ int8x16_t tmp_1;
+ int8x16_t tmp_2;
+ int8x16_t tmp_3;
+
+
+a[0] = vmemory<Q7,inputstrideenabled>::load(in , 0 * stageLength, strideFactor);
+a[1] = vmemory<Q7,inputstrideenabled>::load(in , 1 * stageLength, strideFactor);
+a[2] = vmemory<Q7,inputstrideenabled>::load(in , 2 * stageLength, strideFactor);
+a[3] = vmemory<Q7,inputstrideenabled>::load(in , 3 * stageLength, strideFactor);
+
+
+tmp_0 = vhaddq(a[0] , a[2]) ;
+tmp_1 = vhaddq(a[1] , a[3]) ;
+res[0] = vhaddq(tmp_0 , tmp_1) ;
+tmp_2 = vhsubq(a[0] , a[2]) ;
+tmp_3 = vhsubq(a[1] , a[3]) ;
+res[1] = vhcaddq_rot90(tmp_2 , tmp_3) ;
+res[2] = vhsubq(tmp_0 , tmp_1) ;
+res[3] = vhcaddq_rot270(tmp_2 , tmp_3) ;
+
+
+vmemory<Q7,inputstrideenabled>::store(in, 0 * stageLength, res[0], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 1 * stageLength, res[1], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 2 * stageLength, res[2], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 3 * stageLength, res[3], strideFactor);
+
+
+};
+
+/* Nb Multiplications = 3, 
+Nb Additions = 8,
+Nb Negates = 4,
+Nb Conjugates = 3,
+*/
+/*
+
+Output format : Shifted right by 2
+
+*/
+ __STATIC_FORCEINLINE void run_ip_tw(int stageLength,const int8x16_t *w,complex<Q7> *in,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+int8x16_t a[4];
+int8x16_t res[4];
+
+
+ int8x16_t tmp_0;
+ int8x16_t tmp_1;
+ int8x16_t tmp_2;
+ int8x16_t tmp_3;
+
+
+a[0] = vmemory<Q7,inputstrideenabled>::load(in , 0 * stageLength, strideFactor);
+a[1] = vmemory<Q7,inputstrideenabled>::load(in , 1 * stageLength, strideFactor);
+a[2] = vmemory<Q7,inputstrideenabled>::load(in , 2 * stageLength, strideFactor);
+a[3] = vmemory<Q7,inputstrideenabled>::load(in , 3 * stageLength, strideFactor);
+
+
+tmp_0 = vhaddq(a[0] , a[2]) ;
+tmp_1 = vhaddq(a[1] , a[3]) ;
+res[0] = vhaddq(tmp_0 , tmp_1) ;
+tmp_2 = vhsubq(a[0] , a[2]) ;
+tmp_3 = vhsubq(a[1] , a[3]) ;
+res[1] = vcomplex_mulq( vconjugate(w[0])   , vhcaddq_rot90(tmp_2 , tmp_3) ) ;
+res[2] = vcomplex_mulq( vconjugate(w[1])   , vhsubq(tmp_0 , tmp_1) ) ;
+res[3] = vcomplex_mulq( vconjugate(w[2])   , vhcaddq_rot270(tmp_2 , tmp_3) ) ;
+
+
+vmemory<Q7,inputstrideenabled>::store(in, 0 * stageLength, res[0], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 1 * stageLength, res[1], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 2 * stageLength, res[2], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 3 * stageLength, res[3], strideFactor);
+
+
+};
+
+/* Nb Multiplications = 0, 
+Nb Additions = 8,
+Nb Negates = 4,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 2
+
+*/
+ __STATIC_FORCEINLINE void run_op_notw(int stageLength,const complex<Q7> *in,complex<Q7> *out,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+int8x16_t a[4];
+int8x16_t res[4];
+
+
+ int8x16_t tmp_0;
+ int8x16_t tmp_1;
+ int8x16_t tmp_2;
+ int8x16_t tmp_3;
+
+
+a[0] = vmemory<Q7,inputstrideenabled>::load(in , 0 * stageLength, strideFactor);
+a[1] = vmemory<Q7,inputstrideenabled>::load(in , 1 * stageLength, strideFactor);
+a[2] = vmemory<Q7,inputstrideenabled>::load(in , 2 * stageLength, strideFactor);
+a[3] = vmemory<Q7,inputstrideenabled>::load(in , 3 * stageLength, strideFactor);
+
+
+tmp_0 = vhaddq(a[0] , a[2]) ;
+tmp_1 = vhaddq(a[1] , a[3]) ;
+res[0] = vhaddq(tmp_0 , tmp_1) ;
+tmp_2 = vhsubq(a[0] , a[2]) ;
+tmp_3 = vhsubq(a[1] , a[3]) ;
+res[1] = vhcaddq_rot90(tmp_2 , tmp_3) ;
+res[2] = vhsubq(tmp_0 , tmp_1) ;
+res[3] = vhcaddq_rot270(tmp_2 , tmp_3) ;
+
+
+vmemory<Q7,inputstrideenabled>::store(out, 0 * stageLength , res[0], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 1 * stageLength , res[1], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 2 * stageLength , res[2], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 3 * stageLength , res[3], strideFactor);
+
+
+};
+
+/* Nb Multiplications = 3, 
+Nb Additions = 8,
+Nb Negates = 4,
+Nb Conjugates = 3,
+*/
+/*
+
+Output format : Shifted right by 2
+
+*/
+ __STATIC_FORCEINLINE void run_op_tw(int stageLength,const int8x16_t *w,const complex<Q7> *in,complex<Q7> *out,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+int8x16_t a[4];
+int8x16_t res[4];
+
+
+ int8x16_t tmp_0;
+ int8x16_t tmp_1;
+ int8x16_t tmp_2;
+ int8x16_t tmp_3;
+
+
+a[0] = vmemory<Q7,inputstrideenabled>::load(in , 0 * stageLength, strideFactor);
+a[1] = vmemory<Q7,inputstrideenabled>::load(in , 1 * stageLength, strideFactor);
+a[2] = vmemory<Q7,inputstrideenabled>::load(in , 2 * stageLength, strideFactor);
+a[3] = vmemory<Q7,inputstrideenabled>::load(in , 3 * stageLength, strideFactor);
+
+
+tmp_0 = vhaddq(a[0] , a[2]) ;
+tmp_1 = vhaddq(a[1] , a[3]) ;
+res[0] = vhaddq(tmp_0 , tmp_1) ;
+tmp_2 = vhsubq(a[0] , a[2]) ;
+tmp_3 = vhsubq(a[1] , a[3]) ;
+res[1] = vcomplex_mulq( vconjugate(w[0])   , vhcaddq_rot90(tmp_2 , tmp_3) ) ;
+res[2] = vcomplex_mulq( vconjugate(w[1])   , vhsubq(tmp_0 , tmp_1) ) ;
+res[3] = vcomplex_mulq( vconjugate(w[2])   , vhcaddq_rot270(tmp_2 , tmp_3) ) ;
+
+
+vmemory<Q7,inputstrideenabled>::store(out, 0 * stageLength , res[0], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 1 * stageLength , res[1], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 2 * stageLength , res[2], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 3 * stageLength , res[3], strideFactor);
+
+
+};
+
+/* Nb Multiplications = 0, 
+Nb Additions = 8,
+Nb Negates = 4,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 2
+
+*/
+ __STATIC_FORCEINLINE void run_ip_last(complex<Q7> *in,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+int8x16_t a[4];
+int8x16_t res[4];
+
+
+ int8x16_t tmp_0;
+ int8x16_t tmp_1;
+ int8x16_t tmp_2;
+ int8x16_t tmp_3;
+
+
+a[0] = vmemory<Q7,inputstrideenabled>::load(in , 0 , strideFactor);
+a[1] = vmemory<Q7,inputstrideenabled>::load(in , 1 , strideFactor);
+a[2] = vmemory<Q7,inputstrideenabled>::load(in , 2 , strideFactor);
+a[3] = vmemory<Q7,inputstrideenabled>::load(in , 3 , strideFactor);
+
+
+tmp_0 = vhaddq(a[0] , a[2]) ;
+tmp_1 = vhaddq(a[1] , a[3]) ;
+res[0] = vhaddq(tmp_0 , tmp_1) ;
+tmp_2 = vhsubq(a[0] , a[2]) ;
+tmp_3 = vhsubq(a[1] , a[3]) ;
+res[1] = vhcaddq_rot90(tmp_2 , tmp_3) ;
+res[2] = vhsubq(tmp_0 , tmp_1) ;
+res[3] = vhcaddq_rot270(tmp_2 , tmp_3) ;
+
+
+vmemory<Q7,inputstrideenabled>::store(in, 0 , res[0], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 1 , res[1], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 2 , res[2], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(in, 3 , res[3], strideFactor);
+
+
+};
+
+/* Nb Multiplications = 0, 
+Nb Additions = 8,
+Nb Negates = 4,
+Nb Conjugates = 0,
+*/
+/*
+
+Output format : Shifted right by 2
+
+*/
+ __STATIC_FORCEINLINE void run_op_last(const complex<Q7> *in,complex<Q7> *out,int inputstride)
+
+{
+const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+
+int8x16_t a[4];
+int8x16_t res[4];
+
+
+ int8x16_t tmp_0;
+ int8x16_t tmp_1;
+ int8x16_t tmp_2;
+ int8x16_t tmp_3;
+
+
+a[0] = vmemory<Q7,inputstrideenabled>::load(in , 0 , strideFactor);
+a[1] = vmemory<Q7,inputstrideenabled>::load(in , 1 , strideFactor);
+a[2] = vmemory<Q7,inputstrideenabled>::load(in , 2 , strideFactor);
+a[3] = vmemory<Q7,inputstrideenabled>::load(in , 3 , strideFactor);
+
+
+tmp_0 = vhaddq(a[0] , a[2]) ;
+tmp_1 = vhaddq(a[1] , a[3]) ;
+res[0] = vhaddq(tmp_0 , tmp_1) ;
+tmp_2 = vhsubq(a[0] , a[2]) ;
+tmp_3 = vhsubq(a[1] , a[3]) ;
+res[1] = vhcaddq_rot90(tmp_2 , tmp_3) ;
+res[2] = vhsubq(tmp_0 , tmp_1) ;
+res[3] = vhcaddq_rot270(tmp_2 , tmp_3) ;
+
+
+vmemory<Q7,inputstrideenabled>::store(out, 0, res[0], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 1, res[1], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 2, res[2], strideFactor);
+vmemory<Q7,inputstrideenabled>::store(out, 3, res[3], strideFactor);
+
+
+};
+
+};
+
+#endif /* #ifndef _RADIX_VECTOR_Q7_4_H */
\ No newline at end of file
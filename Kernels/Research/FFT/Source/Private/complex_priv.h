@@ -193,8 +193,8 @@ template<int mode,typename T>
 struct narrow<mode,complex<T>,typename std::enable_if<(mode < 0),int>::type>{
   __STATIC_FORCEINLINE  complex<T> run(complex<PROD<T>> v)
   {
-     T re = narrow<mode,T>::run(v.re);
-     T im = narrow<mode,T>::run(v.im);
+     T re = narrow<mode,T>::run(v.real());
+     T im = narrow<mode,T>::run(v.imag());
      return(complex<T>(re,im));
   }
 };
@@ -203,8 +203,8 @@ template<int mode,typename T>
 struct narrow<mode,complex<T>,typename std::enable_if<(mode > 0),int>::type>{
   __STATIC_FORCEINLINE  complex<T> run(complex<PROD<T>> v)
   {
-     T re = narrow<mode,T>::run(v.re);
-     T im = narrow<mode,T>::run(v.im);
+     T re = narrow<mode,T>::run(v.real());
+     T im = narrow<mode,T>::run(v.imag());
      return(complex<T>(re,im));
   }
 };
@@ -19,7 +19,7 @@
 
 /*
 
-Fixed point operators and specialization for Q15.
+Fixed point operators and specializations for Q15 and Q7.
 
 */
 
@@ -206,6 +206,11 @@ __FORCE_INLINE complex<FFTSCI::Q<F>> const shsub(const complex<FFTSCI::Q<F>> a,c
 }
 
 
+template<>
+struct constant<FFTSCI::Q63>{
+    static constexpr FFTSCI::Q63 zero{0};
+};
+
 template<>
 struct constant<FFTSCI::Q31>{
     static constexpr FFTSCI::Q31 zero{0};
@@ -367,6 +372,179 @@ __FORCE_INLINE complex<FFTSCI::Q15> const shsub(const complex<FFTSCI::Q15> a,con
 #endif
 
 
+#endif 
+
+#ifdef DSPE_Q7
+
+#ifndef DSPE_Q15
+#error "The DSP extension implementation of Q7 is using the one of Q15 for the products"
+#endif
+
+  /* DSP EXTENSION IMPLEMENTATION FOR Q7 
+
+  The real and imaginary parts are the low and high bytes of a 16-bit
+  word (so the complex has the size of two Q7). Additions are done with
+  the 8-bit SIMD instructions. For the products, the parts are sign
+  extended to the 16-bit halves of a q31_t and the product is the DSP
+  extension complex<Q15>.
+
+  */
+template <>
+  struct complex<FFTSCI::Q7> {
+
+    uint16_t value;  
+
+    constexpr complex(const FFTSCI::Q7& re = FFTSCI::Q7(), const FFTSCI::Q7& im = FFTSCI::Q7()):value((uint16_t)((uint8_t)re.value | ((uint8_t)im.value << 8))) {};
+    constexpr complex(const q31_t& v):value((uint16_t)v) {};
+
+    constexpr complex(const complex& c):value(c.value){}; 
+
+    FFTSCI::Q7 real() const {return FFTSCI::Q7((q7_t)value);};
+    FFTSCI::Q7 imag() const {return FFTSCI::Q7((q7_t)(value >> 8));};
+    
+    __FORCE_INLINE complex& operator=(const complex& c){
+         value = c.value ;
+
+         return(*this);
+    };
+
+#ifdef DEBUG
+    void p(const char*s)
+    {
+      printf("%s : %f + i %f\n",s,this->real().f(),this->imag().f());
+    }
+#endif
+
+    __FORCE_INLINE complex const operator-() const {
+        return complex(__QSUB8(0,value));
+    }
+
+
+
+};
+
+/* Real and imaginary parts sign extended to the 16-bit halves */
+__STATIC_FORCEINLINE q31_t unpack_q7x2(const uint16_t v)
+{
+  return(__SXTB16((uint32_t)v | ((uint32_t)v << 8)));
+}
+
+template<> 
+struct FFTSCI::memory<complex<FFTSCI::Q7>> {
+    __STATIC_FORCEINLINE complex<FFTSCI::Q7> load(const complex<FFTSCI::Q7> *buf, const int index)
+    {
+      uint16_t v;
+      memcpy(&v, (const q7_t*)buf + (index<<1), 2);
+      return(complex<FFTSCI::Q7>((q31_t)v));
+    };
+    __STATIC_FORCEINLINE void store(complex<FFTSCI::Q7> *buf,const int index,complex<FFTSCI::Q7> v)
+    {
+       memcpy((q7_t*)buf + (index<<1), &v.value, 2);
+    };
+};
+
+template<> 
+struct FFTSCI::widen<complex<FFTSCI::Q7>>{
+__STATIC_FORCEINLINE complex<FFTSCI::Q15> run(complex<FFTSCI::Q7> v)
+{
+   /* The bits shifted out of the low half are cleared from the high half */
+   return(complex<FFTSCI::Q15>((q31_t)(((uint32_t)unpack_q7x2(v.value) << 7) & 0xFF80FFFF)));
+}
+};
+
+
+template<>
+__FORCE_INLINE complex<FFTSCI::Q7> const operator+(const complex<FFTSCI::Q7> a, const complex<FFTSCI::Q7> b) {
+  return complex<FFTSCI::Q7>(__QADD8(a.value,b.value));
+}
+
+template<>
+__FORCE_INLINE complex<FFTSCI::Q7> const operator-(const complex<FFTSCI::Q7> a, const complex<FFTSCI::Q7> b) {
+  return complex<FFTSCI::Q7>(__QSUB8(a.value,b.value));
+}
+
+/* Complex * Complex */
+template<>
+__FORCE_INLINE complex<FFTSCI::Q15> const multconj(const complex<FFTSCI::Q7> a, const complex<FFTSCI::Q7> b) {
+     q31_t ua,ub,re,im;
+     ua = unpack_q7x2(a.value);
+     ub = unpack_q7x2(b.value);
+     re = __SMUAD(ua, ub);
+     im = __SMUSDX(ub, ua);
+     
+     return complex<FFTSCI::Q15>(__PKHBT(re, im, 16));
+}
+
+template<>
+__FORCE_INLINE complex<FFTSCI::Q15> const operator*(const complex<FFTSCI::Q7> a, const complex<FFTSCI::Q7> b) {
+     q31_t ua,ub,re,im;
+     ua = unpack_q7x2(a.value);
+     ub = unpack_q7x2(b.value);
+     re = __SMUSD(ua, ub) ;
+     im = __SMUADX(ub, ua);
+     
+     return complex<FFTSCI::Q15>(__PKHBT(re, im, 16));
+}
+
+template<>
+__FORCE_INLINE complex<FFTSCI::Q7> operator*(const complex<FFTSCI::Q7> a, 
+  const FFTSCI::Q7 b) {
+     q31_t re,im;
+     re = a.real().value * b.value;
+     im = a.imag().value * b.value;
+
+
+     #ifdef NOSAT
+       return complex<FFTSCI::Q7>(re>>7,im>>7);
+     #else
+      return complex<FFTSCI::Q7>(FFTSCI::sat<FFTSCI::Q7>(re>>7),FFTSCI::sat<FFTSCI::Q7>(im>>7));
+     #endif
+}
+
+
+template<>
+__FORCE_INLINE complex<FFTSCI::Q7> const rot(const complex<FFTSCI::Q7> a)
+{
+  q31_t in1=__REV16(a.value);
+  in1 = (__QSUB8(0,in1) & 0x00FF) | (in1 & 0xFF00);
+  return complex<FFTSCI::Q7>(in1);
+}
+
+template<>
+__FORCE_INLINE complex<FFTSCI::Q7> const conjugate(const complex<FFTSCI::Q7> a)
+{
+  q31_t in1 = (a.value & 0x00FF) | (__QSUB8(0,a.value) & 0xFF00);
+
+  return complex<FFTSCI::Q7>(in1);
+}
+
+#ifdef FASTER
+template<>
+__FORCE_INLINE complex<FFTSCI::Q7> const shadd(const complex<FFTSCI::Q7> a,const complex<FFTSCI::Q7> b)
+{
+  return complex<FFTSCI::Q7>( __SHADD8(__QADD8(a.value,b.value),0));
+}
+
+template<>
+__FORCE_INLINE complex<FFTSCI::Q7> const shsub(const complex<FFTSCI::Q7> a,const complex<FFTSCI::Q7> b)
+{
+  return complex<FFTSCI::Q7>( __SHADD8(__QSUB8(a.value,b.value),0));
+}
+#else
+template<>
+__FORCE_INLINE complex<FFTSCI::Q7> const shadd(const complex<FFTSCI::Q7> a,const complex<FFTSCI::Q7> b)
+{
+  return complex<FFTSCI::Q7>( __QADD8(__SHADD8(a.value,0),__SHADD8(b.value,0)));
+}
+
+template<>
+__FORCE_INLINE complex<FFTSCI::Q7> const shsub(const complex<FFTSCI::Q7> a,const complex<FFTSCI::Q7> b)
+{
+  return complex<FFTSCI::Q7>( __QSUB8(__SHADD8(a.value,0),__SHADD8(b.value,0)));
+}
+#endif
+
+
 #endif 
 
 #endif 
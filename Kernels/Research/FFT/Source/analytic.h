@@ -0,0 +1,274 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Analytic signal : CFFT, mask of the spectrum and CIFFT.
+
+The mask is keeping the bins 0 and n/2, doubling the positive
+frequencies and removing the negative ones.
+The normalization of the CIFFT is merged with the mask.
+
+Without vector support, the real input is read by the first stage
+of the CFFT and the mask is applied by the first stage of the CIFFT
+when it is loading its inputs : the signal is traversed only by the
+FFTs and the permutations.
+With vector support, the FFTs must read contiguous samples
+to use the vector kernels. So, the conversion to complex and the mask
+are done with vector loops.
+
+In fixed point, the positive frequencies are not doubled and the
+bins 0 and n/2 are divided by 2 (the output is the analytic signal
+divided by 2) to avoid overflows.
+
+*/
+
+#ifndef ANALYTIC_H
+#define ANALYTIC_H
+
+// Scaling of the positive frequencies and of the bins 0 and n/2
+template<typename T>
+struct analyticscale{
+  __STATIC_FORCEINLINE T positive(const T normalization)
+  {
+     return(normalization);
+  }
+
+  __STATIC_FORCEINLINE T edge(const T normalization)
+  {
+     return(T(normalization.value >> 1));
+  }
+};
+
+template<>
+struct analyticscale<float32_t>{
+  __STATIC_FORCEINLINE float32_t positive(const float32_t normalization)
+  {
+     return(2.0f * normalization);
+  }
+
+  __STATIC_FORCEINLINE float32_t edge(const float32_t normalization)
+  {
+     return(normalization);
+  }
+};
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+template<>
+struct analyticscale<float16_t>{
+  __STATIC_FORCEINLINE float16_t positive(const float16_t normalization)
+  {
+     return((_Float16)2.0f16 * (_Float16)normalization);
+  }
+
+  __STATIC_FORCEINLINE float16_t edge(const float16_t normalization)
+  {
+     return(normalization);
+  }
+};
+#endif
+
+// Loader for a real input seen as a complex input
+template<typename T>
+struct realloader{
+  const T *in;
+
+  __FORCE_INLINE complex<T> load(int i) const
+  {
+     return(complex<T>(in[i],constant<T>::zero));
+  }
+};
+
+// Loader applying the mask to the permuted spectrum
+template<typename T>
+struct analyticloader{
+  const complex<T> *in;
+  T positive;
+  T edge;
+  int n;
+
+  __FORCE_INLINE complex<T> load(int i) const
+  {
+     if ((i == 0) || (2*i == n))
+     {
+        return(in[i] * edge);
+     }
+     else if (2*i < n)
+     {
+        return(in[i] * positive);
+     }
+     return(complex<T>(constant<T>::zero,constant<T>::zero));
+  }
+};
+
+// Real input to complex (zero imaginary part)
+template<typename T>
+struct realtocomplex{
+  __STATIC_FORCEINLINE void run(const T *in,T *out,uint32_t n)
+  {
+     complex<T> *pOut = (complex<T> *)out;
+     for(uint32_t i = 0; i < n; i++)
+     {
+        pOut[i] = complex<T>(in[i],constant<T>::zero);
+     }
+  }
+};
+
+// Mask applied in a separate pass
+template<typename T>
+struct analyticmask{
+  __STATIC_FORCEINLINE void run(T *spectrum,T positive,T edge,uint32_t n)
+  {
+     complex<T> *p = (complex<T> *)spectrum;
+     for(uint32_t i = 0; i < n; i++)
+     {
+        if ((i == 0) || (2*i == n))
+        {
+           p[i] = p[i] * edge;
+        }
+        else if (2*i < n)
+        {
+           p[i] = p[i] * positive;
+        }
+        else
+        {
+           p[i] = complex<T>(constant<T>::zero,constant<T>::zero);
+        }
+     }
+  }
+};
+
+#if defined(HASVECTOR) && defined(VECTOR_F32)
+template<>
+struct realtocomplex<float32_t>{
+  __STATIC_FORCEINLINE void run(const float32_t *in,float32_t *out,uint32_t n)
+  {
+     uint32_t blkCnt = n >> 2;
+     float32x4x2_t v;
+
+     v.val[1] = vdupq_n_f32(0.0f);
+     while(blkCnt > 0)
+     {
+        v.val[0] = vld1q_f32(in);
+        vst2q_f32(out,v);
+        in += 4;
+        out += 8;
+        blkCnt--;
+     }
+
+     blkCnt = n & 3;
+     while(blkCnt > 0)
+     {
+        *out++ = *in++;
+        *out++ = 0.0f;
+        blkCnt--;
+     }
+  }
+};
+
+template<>
+struct analyticmask<float32_t>{
+  __STATIC_FORCEINLINE void run(float32_t *spectrum,float32_t positive,float32_t edge,uint32_t n)
+  {
+     // Positive frequencies are the bins 1 to (n-1)/2
+     const uint32_t nbPositive = (n - 1) >> 1;
+     const float32x4_t zero = vdupq_n_f32(0.0f);
+     float32_t *p = spectrum + 2;
+     uint32_t blkCnt;
+
+     spectrum[0] *= edge;
+     spectrum[1] *= edge;
+
+     blkCnt = (2*nbPositive) >> 2;
+     while(blkCnt > 0)
+     {
+        vst1q_f32(p,vmulq_n_f32(vld1q_f32(p),positive));
+        p += 4;
+        blkCnt--;
+     }
+
+     blkCnt = (2*nbPositive) & 3;
+     while(blkCnt > 0)
+     {
+        *p++ *= positive;
+        blkCnt--;
+     }
+
+     if ((n & 1) == 0)
+     {
+        *p++ *= edge;
+        *p++ *= edge;
+     }
+
+     blkCnt = (2*(n - 1 - nbPositive - ((n & 1) == 0))) >> 2;
+     while(blkCnt > 0)
+     {
+        vst1q_f32(p,zero);
+        p += 4;
+        blkCnt--;
+     }
+
+     blkCnt = (2*(n - 1 - nbPositive - ((n & 1) == 0))) & 3;
+     while(blkCnt > 0)
+     {
+        *p++ = 0.0f;
+        blkCnt--;
+     }
+  }
+};
+#endif
+
+template<typename T,int vectormode>
+struct analyticfft{
+  __STATIC_FORCEINLINE void run(const cfftconfig<T> *config,int n,const T *in,T *tmp,T *out)
+  {
+     const realloader<T> rloader={in};
+     const analyticloader<T> aloader={(const complex<T> *)tmp,
+        analyticscale<T>::positive(config->normalization),
+        analyticscale<T>::edge(config->normalization),
+        n};
+
+     fftload<DIRECT,T,realloader<T>>::run(config,n,rloader,(complex<T>*)tmp);
+     fft<DIRECT,T,0>::permute(config,n,tmp,0);
+
+     fftload<INVERSE,T,analyticloader<T>>::run(config,n,aloader,(complex<T>*)out);
+     fft<INVERSE,T,0>::permute(config,n,out,0);
+  }
+};
+
+template<typename T>
+struct analyticfft<T,1>{
+  __STATIC_FORCEINLINE void run(const cfftconfig<T> *config,int n,const T *in,T *tmp,T *out)
+  {
+     realtocomplex<T>::run(in,out,n);
+
+     fft<DIRECT,T,0>::run(config,n,(complex<T>*)out,(complex<T>*)tmp,0);
+     fft<DIRECT,T,0>::permute(config,n,tmp,0);
+
+     analyticmask<T>::run(tmp,
+        analyticscale<T>::positive(config->normalization),
+        analyticscale<T>::edge(config->normalization),
+        n);
+
+     fft<INVERSE,T,0>::run(config,n,(complex<T>*)tmp,(complex<T>*)out,0);
+     fft<INVERSE,T,0>::permute(config,n,out,0);
+  }
+};
+
+#endif
@@ -0,0 +1,191 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Polyphase channelizer : M channels and a hop of D input samples
+(critically sampled when D == M, oversampled when D < M).
+
+For each hop, the output of channel k is
+
+y_k = sum_l h[l] x[n-l] exp(-2 i pi k (n-l) / M)
+
+where n is the index of the last input sample and h the prototype
+filter of M * P coefficients generated by configgen.py.
+
+The M polyphase branches are computed together : with the prototype
+filter stored in reversed order, the coefficients and the delay line
+are read in the same direction and the output of the branches is
+u[M-1-j] = sum_q coefs[q*M+j] delay[D+q*M+j]
+
+The modulation by exp(-2 i pi k n / M) is a rotation of the
+branch outputs which is done by the loader of the first stage of the
+FFT : there is no additional pass.
+
+*/
+
+#ifndef CHANNELIZER_H
+#define CHANNELIZER_H
+
+// Polyphase branches (real coefficients and complex samples)
+template<typename T>
+struct channelizerbranches{
+  __STATIC_FORCEINLINE void run(const T *coefs,const T *delay,T *out,uint32_t nbChannels,uint32_t nbTaps)
+  {
+     for(uint32_t j = 0; j < nbChannels; j++)
+     {
+        T accRe = constant<T>::zero;
+        T accIm = constant<T>::zero;
+        for(uint32_t q = 0; q < nbTaps; q++)
+        {
+           const uint32_t k = q*nbChannels + j;
+           accRe = accRe + coefs[k] * delay[2*k];
+           accIm = accIm + coefs[k] * delay[2*k+1];
+        }
+        out[2*j] = accRe;
+        out[2*j+1] = accIm;
+     }
+  }
+};
+
+/*
+
+The vld2 / vst2 are deinterleaving the complex samples so
+that 4 branches are computed with each vector MAC.
+
+*/
+#if defined(HASVECTOR) && defined(VECTOR_F32)
+template<>
+struct channelizerbranches<float32_t>{
+  __STATIC_FORCEINLINE void run(const float32_t *coefs,const float32_t *delay,float32_t *out,uint32_t nbChannels,uint32_t nbTaps)
+  {
+     uint32_t blkCnt = nbChannels >> 2;
+     uint32_t j = 0;
+     float32x4x2_t acc;
+     float32x4x2_t d;
+     float32x4_t c;
+
+     while(blkCnt > 0)
+     {
+        acc.val[0] = vdupq_n_f32(0.0f);
+        acc.val[1] = vdupq_n_f32(0.0f);
+        for(uint32_t q = 0; q < nbTaps; q++)
+        {
+           const uint32_t k = q*nbChannels + j;
+           c = vld1q_f32(coefs + k);
+           d = vld2q_f32(delay + 2*k);
+           acc.val[0] = vaddq_f32(acc.val[0],vmulq_f32(c,d.val[0]));
+           acc.val[1] = vaddq_f32(acc.val[1],vmulq_f32(c,d.val[1]));
+        }
+        vst2q_f32(out + 2*j,acc);
+        j += 4;
+        blkCnt--;
+     }
+
+     for(; j < nbChannels; j++)
+     {
+        float32_t accRe = 0.0f;
+        float32_t accIm = 0.0f;
+        for(uint32_t q = 0; q < nbTaps; q++)
+        {
+           const uint32_t k = q*nbChannels + j;
+           accRe += coefs[k] * delay[2*k];
+           accIm += coefs[k] * delay[2*k+1];
+        }
+        out[2*j] = accRe;
+        out[2*j+1] = accIm;
+     }
+  }
+};
+#endif
+
+// Loader rotating the outputs of the branches
+template<typename T>
+struct rotationloader{
+  const complex<T> *in;
+  uint32_t offset;
+  uint32_t n;
+
+  __FORCE_INLINE complex<T> load(int i) const
+  {
+     uint32_t k = offset + i;
+     if (k >= n)
+     {
+        k -= n;
+     }
+     return(in[k]);
+  }
+};
+
+template<typename T>
+uint32_t inner_channelizer(channelizerstate<T> *S,const T *in,uint32_t nbSamples,T *out)
+{
+    const channelizerconfig<T> *config = S->config;
+    const uint32_t nbChannels = config->nbChannels;
+    const uint32_t length = nbChannels * config->nbTaps;
+    const uint32_t hop = S->hop;
+    const cfftconfig<T> *fftconfig=cfft_config<T>(nbChannels);
+    T *delay = S->delay;
+    uint32_t nbOut = 0;
+    uint32_t i = 0;
+
+    while (i < nbSamples)
+    {
+       uint32_t nb = hop - S->pos;
+       if (nb > nbSamples - i)
+       {
+          nb = nbSamples - i;
+       }
+
+       // New samples after the last nbChannels * nbTaps samples
+       for(uint32_t k = 0; k < 2*nb; k++)
+       {
+          delay[2*(length + S->pos) + k] = in[2*i + k];
+       }
+       S->pos += nb;
+       i += nb;
+
+       if (S->pos == hop)
+       {
+          T *pOut = out + 2 * nbChannels * nbOut;
+
+          channelizerbranches<T>::run(config->coefs,delay + 2*hop,S->tmp,nbChannels,config->nbTaps);
+
+          S->phase = (S->phase + hop) % nbChannels;
+
+          const rotationloader<T> loader={(const complex<T> *)S->tmp,
+                                          (nbChannels - S->phase) % nbChannels,
+                                          nbChannels};
+          fftload<DIRECT,T,rotationloader<T>>::run(fftconfig,nbChannels,loader,(complex<T>*)pOut);
+          fft<DIRECT,T,0>::permute(fftconfig,nbChannels,pOut,0);
+
+          for(uint32_t k = 0; k < 2*length; k++)
+          {
+             delay[k] = delay[2*hop + k];
+          }
+
+          S->pos = 0;
+          nbOut++;
+       }
+    }
+
+    return(nbOut);
+}
+
+#endif
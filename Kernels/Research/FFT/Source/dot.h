@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Dot product of two arrays used by the MFCC (mel filters and DCT)
+and by the direct method of the cross-correlation.
+
+It is vectorized for f32 (Helium and Neon) and f16 (Helium).
+
+*/
+
+#ifndef DOT_H
+#define DOT_H
+
+// Dot product of two arrays
+template<typename T>
+struct dotproduct{
+  __STATIC_FORCEINLINE T run(const T *a,const T *b,uint32_t n)
+  {
+     T acc = constant<T>::zero;
+     for(uint32_t i = 0; i < n; i++)
+     {
+        acc = acc + a[i] * b[i];
+     }
+     return(acc);
+  }
+};
+
+#if defined(HASVECTOR) && defined(VECTOR_F32)
+template<>
+struct dotproduct<float32_t>{
+  __STATIC_FORCEINLINE float32_t run(const float32_t *a,const float32_t *b,uint32_t n)
+  {
+     float32x4_t vacc = vdupq_n_f32(0.0f);
+     float32_t acc;
+     uint32_t blkCnt = n >> 2;
+     while(blkCnt > 0)
+     {
+        vacc = vaddq_f32(vacc,vmulq_f32(vld1q_f32(a),vld1q_f32(b)));
+        a += 4;
+        b += 4;
+        blkCnt--;
+     }
+
+     acc = vgetq_lane_f32(vacc,0) + vgetq_lane_f32(vacc,1) +
+           vgetq_lane_f32(vacc,2) + vgetq_lane_f32(vacc,3);
+
+     blkCnt = n & 3;
+     while(blkCnt > 0)
+     {
+        acc += *a++ * *b++;
+        blkCnt--;
+     }
+     return(acc);
+  }
+};
+#endif
+
+#if defined(HELIUM_VECTOR) && defined(VECTOR_F16)
+template<>
+struct dotproduct<float16_t>{
+  __STATIC_FORCEINLINE float16_t run(const float16_t *a,const float16_t *b,uint32_t n)
+  {
+     float16x8_t vacc = vdupq_n_f16(0.0f16);
+     _Float16 acc;
+     uint32_t blkCnt = n >> 3;
+     while(blkCnt > 0)
+     {
+        vacc = vaddq_f16(vacc,vmulq_f16(vld1q_f16(a),vld1q_f16(b)));
+        a += 8;
+        b += 8;
+        blkCnt--;
+     }
+
+     acc = (_Float16)vgetq_lane_f16(vacc,0) + (_Float16)vgetq_lane_f16(vacc,1) +
+           (_Float16)vgetq_lane_f16(vacc,2) + (_Float16)vgetq_lane_f16(vacc,3) +
+           (_Float16)vgetq_lane_f16(vacc,4) + (_Float16)vgetq_lane_f16(vacc,5) +
+           (_Float16)vgetq_lane_f16(vacc,6) + (_Float16)vgetq_lane_f16(vacc,7);
+
+     blkCnt = n & 7;
+     while(blkCnt > 0)
+     {
+        acc += (_Float16)*a++ * (_Float16)*b++;
+        blkCnt--;
+     }
+     return(acc);
+  }
+};
+#endif
+
+#endif
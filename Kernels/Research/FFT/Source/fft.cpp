@@ -110,6 +110,89 @@ using VECTORTYPE = typename vector<T>::type;
 template<typename T>
 using OFFSETTYPE = typename vector<T>::offset_type;
 
+/*
+
+The stages of a radix are using the vector loops when
+the datatype has a vector version. A datatype having
+vector kernels for only some radix redefines it.
+
+*/
+template<typename T,int factor>
+struct radixvectorized
+{
+    enum {
+           value = vector<T>::vector_enabled
+    };
+};
+
+/*
+
+Radix used by the lengths of a datatype.
+kernels.h is generated by configgen.py and specializes it
+for the radix used by the configuration. The other radix
+are removed from the switch on the factors and their
+kernels are not included.
+
+*/
+template<typename T,int factor>
+struct radixused
+{
+    enum {
+           value = 0
+    };
+};
+
+#include "kernels.h"
+
+/*
+
+A radix used by the factors of config.cpp but not specialized
+in kernels.h would silently be skipped by the FFT (the
+radixused<T,factor>::value == 0 cases do nothing).
+The build fails if kernels.h and the radix mask of config.h
+were not generated from the same configuration.
+
+*/
+template<typename T,int mask>
+struct radixcheck
+{
+    enum {
+           value = (radixused<T,2>::value == ((mask >> 2) & 1)) &&
+                   (radixused<T,3>::value == ((mask >> 3) & 1)) &&
+                   (radixused<T,4>::value == ((mask >> 4) & 1)) &&
+                   (radixused<T,5>::value == ((mask >> 5) & 1)) &&
+                   (radixused<T,6>::value == ((mask >> 6) & 1)) &&
+                   (radixused<T,8>::value == ((mask >> 8) & 1))
+    };
+};
+
+#define RADIX_CHECK_MSG "Generated/kernels.h does not match Generated/config.h : run configgen.py again"
+
+#if defined(DATATYPE_F64)
+static_assert(radixcheck<float64_t,RADIX_MASK_F64>::value,RADIX_CHECK_MSG);
+#endif
+
+#if defined(DATATYPE_F32)
+static_assert(radixcheck<float32_t,RADIX_MASK_F32>::value,RADIX_CHECK_MSG);
+#endif
+
+#if defined(DATATYPE_F16) && defined(ARM_FLOAT16_SUPPORTED)
+static_assert(radixcheck<float16_t,RADIX_MASK_F16>::value,RADIX_CHECK_MSG);
+#endif
+
+#if defined(DATATYPE_Q31)
+static_assert(radixcheck<Q31,RADIX_MASK_Q31>::value,RADIX_CHECK_MSG);
+#endif
+
+#if defined(DATATYPE_Q15)
+static_assert(radixcheck<Q15,RADIX_MASK_Q15>::value,RADIX_CHECK_MSG);
+#endif
+
+#if defined(DATATYPE_Q7)
+static_assert(radixcheck<Q7,RADIX_MASK_Q7>::value,RADIX_CHECK_MSG);
+#endif
+
+
 // Template specializations for the different radixes and datatypes
 #include "radix.h"
 
@@ -134,6 +217,20 @@ using OFFSETTYPE = typename vector<T>::offset_type;
 // Looping on radix and stage
 #include "stageloop.h"
 
+// Profiling hooks (empty when FFT_PROFILING is not defined)
+#include "profile.h"
+
+#if defined(FFT_PROFILING)
+fftprofilesink fftProfileSink=NULL;
+void *fftProfileContext=NULL;
+
+void fft_profile_register(fftprofilesink sink,void *context)
+{
+    fftProfileSink = sink;
+    fftProfileContext = context;
+}
+#endif
+
 
 // FFT Implementation
 template <int mode,typename T,int inputstrideenabled>
@@ -144,31 +241,46 @@ struct fft{
     complex<T> *out,
     int inputstride)
  {
-    int stride;
+    run_groups(config,n,0,0,1,in,out,inputstride);
+ }
+
+  // Run the stage groups starting at group firstGroup.
+  // stage is the index of the first stage of this group and
+  // stride the twiddle stride reached after the previous stages.
+  // It is used when the first stage has been computed with
+  // a different implementation (like for the split complex format).
+  static int run_groups(const cfftconfig<T> *config,
+    int n,
+    uint32_t firstGroup,
+    uint32_t stage,
+    int stride,
+    complex<T> *in, 
+    complex<T> *out,
+    int inputstride)
+ {
     uint32_t factor;
     uint32_t nbFactors;
-    uint32_t stage;
 
     bool hasFirst;
     bool hasLast;
     
-    const complex<T> *twid = (complex<T>*)config->twiddle;
-
-    stride=1;
+    const complex<TWID<T>> *twid = (complex<TWID<T>>*)config->twiddle;
+    fftprofile<mode,T> profile(config,n);
 
     // Iterate on the stages.
     // Stages are grouped per radix.
     // We run all the stages for a given radix.
     // This loop of stages may contain the first, last of both stages
     // and the corresponding special radix kernel must be selected.
-    stage=0;
-    for(uint32_t stageGroup = 0; stageGroup < config->nbGroupedFactors; stageGroup++)
+    for(uint32_t stageGroup = firstGroup; stageGroup < config->nbGroupedFactors; stageGroup++)
     {
        factor = config->factors[2*stageGroup];
        nbFactors = config->factors[2*stageGroup+1];
        hasFirst=(stage == 0); 
        hasLast = (stage + nbFactors == config->nbFactors );
 
+       profile.start();
+
        if (hasFirst && !hasLast)
        {
           stride=factorSwitch<mode,T,STARTONLY,inputstrideenabled>::run(config,n,factor,nbFactors,stage,stride,in,out,twid,inputstride);
@@ -193,14 +305,34 @@ struct fft{
           stride=factorSwitch<mode,T,NORMALLOOP,inputstrideenabled>::run(config,n,factor,nbFactors,stage,stride,in,out,twid,inputstride);
        }
 
+       profile.stop(stageGroup,factor,nbFactors,
+         (hasFirst ? FFT_PROFILE_FIRST : FFT_PROFILE_NORMAL) | (hasLast ? FFT_PROFILE_LAST : FFT_PROFILE_NORMAL));
 
        stage += nbFactors;
     }
 
-   
+    return(stride);
+  }
+
+  // Permutation of the output
+  __STATIC_FORCEINLINE void permute(const cfftconfig<T> *config,
+    int n,
+    T *out,
+    int inputstride)
+  {
+    fftprofile<mode,T> profile(config,n);
+
+    profile.start();
+
+    bitreversal<T,inputstrideenabled,vector<T>::vector_enabled>::run(out,config->nbPerms,config->perms,config->reversalVectorizable,inputstride);
+
+    profile.stop(-1,0,0,FFT_PROFILE_BITREVERSAL);
   }
 };
 
+// First stage reading the input through a loader
+#include "firststage.h"
+
 // API for FFT, RFFT init and #define for supported
 // functions
 #include "config_func.h"
@@ -233,6 +365,60 @@ arm_status cfft2D(const float64_t *in,float64_t* out, uint16_t rows,uint16_t col
 
 template
 arm_status cifft2D(const float64_t *in,float64_t* out, uint16_t rows,uint16_t cols);
+
+template
+arm_status cfft_split(const float64_t *inRe,const float64_t *inIm,float64_t* tmp,float64_t* outRe,float64_t* outIm,uint16_t N);
+
+template
+arm_status cifft_split(const float64_t *inRe,const float64_t *inIm,float64_t* tmp,float64_t* outRe,float64_t* outIm,uint16_t N);
+
+template
+void complex_interleave(const float64_t *re,const float64_t *im,float64_t* out, uint32_t n);
+
+template
+void complex_deinterleave(const float64_t *in,float64_t *re,float64_t* im, uint32_t n);
+
+template
+arm_status cfft_pruned(const float64_t *in,float64_t* tmp,float64_t* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+
+template
+arm_status cfft_pruned_range(const float64_t *in,float64_t* tmp,float64_t* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+template
+arm_status cfft_multi(const float64_t *in,float64_t* out, uint16_t N,uint16_t nbChannels);
+
+template
+arm_status cifft_multi(const float64_t *in,float64_t* out, uint16_t N,uint16_t nbChannels);
+
+template
+arm_status fft_plan_cfft(fftplan<float64_t> *plan,uint16_t N,uint8_t inverse);
+
+template
+arm_status fft_plan_cfft2D(fftplan<float64_t> *plan,uint16_t rows,uint16_t cols,uint8_t inverse);
+
+template
+uint32_t fft_scratch_size(const fftplan<float64_t> *plan);
+
+template
+arm_status fft_execute(const fftplan<float64_t> *plan,const float64_t *in,float64_t* out,float64_t *scratch,uint32_t scratchSize);
+
+template
+void spectrum_mul(const float64_t *a,const float64_t *b,float64_t* out, uint32_t nbBins);
+
+template
+void spectrum_mulconj(const float64_t *a,const float64_t *b,float64_t* out, uint32_t nbBins);
+
+template
+void spectrum_mac(const float64_t *a,const float64_t *b,float64_t* acc, uint32_t nbBins);
+
+template
+arm_status cfft3D(const float64_t *in,float64_t* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+template
+arm_status cifft3D(const float64_t *in,float64_t* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+template
+void fft_job_init(fftjob *job,const fftplan<float64_t> *plan,const float64_t *in,float64_t *out,fftjobcallback callback,void *context);
 #endif
 
 #if defined(FUNC_CFFT_F32)
@@ -248,6 +434,96 @@ arm_status cfft2D(const float32_t *in,float32_t* out, uint16_t rows,uint16_t col
 
 template
 arm_status cifft2D(const float32_t *in,float32_t* out, uint16_t rows,uint16_t cols);
+
+template
+arm_status cfft_split(const float32_t *inRe,const float32_t *inIm,float32_t* tmp,float32_t* outRe,float32_t* outIm,uint16_t N);
+
+template
+arm_status cifft_split(const float32_t *inRe,const float32_t *inIm,float32_t* tmp,float32_t* outRe,float32_t* outIm,uint16_t N);
+
+template
+void complex_interleave(const float32_t *re,const float32_t *im,float32_t* out, uint32_t n);
+
+template
+void complex_deinterleave(const float32_t *in,float32_t *re,float32_t* im, uint32_t n);
+
+template
+arm_status cfft_pruned(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+
+template
+arm_status cfft_pruned_range(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+template
+arm_status sdft_init(sdftstate<float32_t> *S,uint16_t N,const uint16_t *bins,uint16_t nbBins,uint16_t *phase,typename sdftacc<float32_t>::type *acc,float32_t *delay);
+
+template
+void sdft_update(sdftstate<float32_t> *S,const float32_t *in,uint32_t nbSamples);
+
+template
+void sdft_bins(const sdftstate<float32_t> *S,float32_t *out);
+
+template
+arm_status rfft_pair(const float32_t *in1,const float32_t *in2,float32_t* tmp,float32_t* out1,float32_t* out2, uint16_t N);
+
+template
+arm_status cfft_multi(const float32_t *in,float32_t* out, uint16_t N,uint16_t nbChannels);
+
+template
+arm_status cifft_multi(const float32_t *in,float32_t* out, uint16_t N,uint16_t nbChannels);
+
+template
+arm_status welch_csd_init(welchstate<float32_t> *S,uint16_t N,uint16_t overlap,const float32_t *window,uint16_t nbThreads,float32_t *segment,float32_t *tmp,float32_t *acc);
+
+template
+void welch_csd_update(welchstate<float32_t> *S,const float32_t *x,const float32_t *y,uint32_t nbSamples);
+
+template
+arm_status welch_csd(const welchstate<float32_t> *S,float32_t *out);
+
+template
+arm_status welch_coherence(const welchstate<float32_t> *S,float32_t *out);
+
+template
+arm_status analytic_signal(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N);
+
+template
+arm_status hilbert(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N);
+
+template
+arm_status fft_plan_cfft(fftplan<float32_t> *plan,uint16_t N,uint8_t inverse);
+
+template
+arm_status fft_plan_cfft2D(fftplan<float32_t> *plan,uint16_t rows,uint16_t cols,uint8_t inverse);
+
+template
+uint32_t fft_scratch_size(const fftplan<float32_t> *plan);
+
+template
+arm_status fft_execute(const fftplan<float32_t> *plan,const float32_t *in,float32_t* out,float32_t *scratch,uint32_t scratchSize);
+
+template
+void spectrum_mul(const float32_t *a,const float32_t *b,float32_t* out, uint32_t nbBins);
+
+template
+void spectrum_mulconj(const float32_t *a,const float32_t *b,float32_t* out, uint32_t nbBins);
+
+template
+void spectrum_mac(const float32_t *a,const float32_t *b,float32_t* acc, uint32_t nbBins);
+
+template
+arm_status cfft3D(const float32_t *in,float32_t* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+template
+arm_status cifft3D(const float32_t *in,float32_t* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+template
+arm_status zoom_fft_init(zoomstate<float32_t> *S,float32_t center,uint16_t decimation,uint16_t nbTaps,uint16_t N,const float32_t *window,float32_t *coefs,float32_t *delay,float32_t *frame);
+
+template
+uint32_t zoom_fft(zoomstate<float32_t> *S,const float32_t *in,uint32_t nbSamples,float32_t *out);
+
+template
+void fft_job_init(fftjob *job,const fftplan<float32_t> *plan,const float32_t *in,float32_t *out,fftjobcallback callback,void *context);
 #endif
 
 #if defined(FUNC_CFFT_F16) && defined(ARM_FLOAT16_SUPPORTED)
@@ -263,6 +539,81 @@ arm_status cfft2D(const float16_t *in,float16_t* out, uint16_t rows,uint16_t col
 template
 arm_status cifft2D(const float16_t *in,float16_t* out, uint16_t rows,uint16_t cols);
 
+template
+arm_status cfft_split(const float16_t *inRe,const float16_t *inIm,float16_t* tmp,float16_t* outRe,float16_t* outIm,uint16_t N);
+
+template
+arm_status cifft_split(const float16_t *inRe,const float16_t *inIm,float16_t* tmp,float16_t* outRe,float16_t* outIm,uint16_t N);
+
+template
+void complex_interleave(const float16_t *re,const float16_t *im,float16_t* out, uint32_t n);
+
+template
+void complex_deinterleave(const float16_t *in,float16_t *re,float16_t* im, uint32_t n);
+
+template
+arm_status cfft_pruned(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+
+template
+arm_status cfft_pruned_range(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+template
+arm_status rfft_pair(const float16_t *in1,const float16_t *in2,float16_t* tmp,float16_t* out1,float16_t* out2, uint16_t N);
+
+template
+arm_status cfft_multi(const float16_t *in,float16_t* out, uint16_t N,uint16_t nbChannels);
+
+template
+arm_status cifft_multi(const float16_t *in,float16_t* out, uint16_t N,uint16_t nbChannels);
+
+template
+arm_status analytic_signal(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N);
+
+template
+arm_status hilbert(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N);
+
+template
+arm_status fft_plan_cfft(fftplan<float16_t> *plan,uint16_t N,uint8_t inverse);
+
+template
+arm_status fft_plan_cfft2D(fftplan<float16_t> *plan,uint16_t rows,uint16_t cols,uint8_t inverse);
+
+template
+uint32_t fft_scratch_size(const fftplan<float16_t> *plan);
+
+template
+arm_status fft_execute(const fftplan<float16_t> *plan,const float16_t *in,float16_t* out,float16_t *scratch,uint32_t scratchSize);
+
+template
+void spectrum_mul(const float16_t *a,const float16_t *b,float16_t* out, uint32_t nbBins);
+
+template
+void spectrum_mulconj(const float16_t *a,const float16_t *b,float16_t* out, uint32_t nbBins);
+
+template
+void spectrum_mac(const float16_t *a,const float16_t *b,float16_t* acc, uint32_t nbBins);
+
+template
+arm_status cfft_mixed(const float16_t *in,float16_t* out, uint16_t N);
+
+template
+arm_status cifft_mixed(const float16_t *in,float16_t* out, uint16_t N);
+
+template
+arm_status cfft3D(const float16_t *in,float16_t* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+template
+arm_status cifft3D(const float16_t *in,float16_t* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+template
+arm_status zoom_fft_init(zoomstate<float16_t> *S,float32_t center,uint16_t decimation,uint16_t nbTaps,uint16_t N,const float16_t *window,float16_t *coefs,float16_t *delay,float16_t *frame);
+
+template
+uint32_t zoom_fft(zoomstate<float16_t> *S,const float16_t *in,uint32_t nbSamples,float16_t *out);
+
+template
+void fft_job_init(fftjob *job,const fftplan<float16_t> *plan,const float16_t *in,float16_t *out,fftjobcallback callback,void *context);
+
 #endif
 
 #if defined(FUNC_CFFT_Q31)
@@ -278,6 +629,87 @@ arm_status cfft2D(const Q31 *in,Q31* out, uint16_t rows,uint16_t cols);
 template
 arm_status cifft2D(const Q31 *in,Q31* out, uint16_t rows,uint16_t cols);
 
+template
+arm_status cfft_split(const Q31 *inRe,const Q31 *inIm,Q31* tmp,Q31* outRe,Q31* outIm,uint16_t N);
+
+template
+arm_status cifft_split(const Q31 *inRe,const Q31 *inIm,Q31* tmp,Q31* outRe,Q31* outIm,uint16_t N);
+
+template
+void complex_interleave(const Q31 *re,const Q31 *im,Q31* out, uint32_t n);
+
+template
+void complex_deinterleave(const Q31 *in,Q31 *re,Q31* im, uint32_t n);
+
+template
+arm_status cfft_pruned(const Q31 *in,Q31* tmp,Q31* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+
+template
+arm_status cfft_pruned_range(const Q31 *in,Q31* tmp,Q31* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+template
+arm_status sdft_init(sdftstate<Q31> *S,uint16_t N,const uint16_t *bins,uint16_t nbBins,uint16_t *phase,typename sdftacc<Q31>::type *acc,Q31 *delay);
+
+template
+void sdft_update(sdftstate<Q31> *S,const Q31 *in,uint32_t nbSamples);
+
+template
+void sdft_bins(const sdftstate<Q31> *S,Q31 *out);
+
+template
+arm_status rfft_pair(const Q31 *in1,const Q31 *in2,Q31* tmp,Q31* out1,Q31* out2, uint16_t N);
+
+template
+arm_status cfft_multi(const Q31 *in,Q31* out, uint16_t N,uint16_t nbChannels);
+
+template
+arm_status cifft_multi(const Q31 *in,Q31* out, uint16_t N,uint16_t nbChannels);
+
+template
+arm_status analytic_signal(const Q31 *in,Q31* tmp,Q31* out, uint16_t N);
+
+template
+arm_status hilbert(const Q31 *in,Q31* tmp,Q31* out, uint16_t N);
+
+template
+arm_status fft_plan_cfft(fftplan<Q31> *plan,uint16_t N,uint8_t inverse);
+
+template
+arm_status fft_plan_cfft2D(fftplan<Q31> *plan,uint16_t rows,uint16_t cols,uint8_t inverse);
+
+template
+uint32_t fft_scratch_size(const fftplan<Q31> *plan);
+
+template
+arm_status fft_execute(const fftplan<Q31> *plan,const Q31 *in,Q31* out,Q31 *scratch,uint32_t scratchSize);
+
+template
+void spectrum_mul(const Q31 *a,const Q31 *b,Q31* out, uint32_t nbBins);
+
+template
+void spectrum_mulconj(const Q31 *a,const Q31 *b,Q31* out, uint32_t nbBins);
+
+template
+void spectrum_mac(const Q31 *a,const Q31 *b,Q31* acc, uint32_t nbBins);
+
+template
+arm_status cfft3D(const Q31 *in,Q31* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+template
+arm_status cifft3D(const Q31 *in,Q31* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+template
+void fft_job_init(fftjob *job,const fftplan<Q31> *plan,const Q31 *in,Q31 *out,fftjobcallback callback,void *context);
+
+#endif
+
+#if defined(FUNC_CFFT_Q31MIX)
+template
+arm_status cfft_mixed(const Q31 *in,Q31* out, uint16_t N);
+
+template
+arm_status cifft_mixed(const Q31 *in,Q31* out, uint16_t N);
+
 #endif
 
 #if defined(FUNC_CFFT_Q15)
@@ -293,6 +725,78 @@ arm_status cfft2D(const Q15 *in,Q15* out, uint16_t rows,uint16_t cols);
 template
 arm_status cifft2D(const Q15 *in,Q15* out, uint16_t rows,uint16_t cols);
 
+template
+arm_status cfft_split(const Q15 *inRe,const Q15 *inIm,Q15* tmp,Q15* outRe,Q15* outIm,uint16_t N);
+
+template
+arm_status cifft_split(const Q15 *inRe,const Q15 *inIm,Q15* tmp,Q15* outRe,Q15* outIm,uint16_t N);
+
+template
+void complex_interleave(const Q15 *re,const Q15 *im,Q15* out, uint32_t n);
+
+template
+void complex_deinterleave(const Q15 *in,Q15 *re,Q15* im, uint32_t n);
+
+template
+arm_status cfft_pruned(const Q15 *in,Q15* tmp,Q15* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+
+template
+arm_status cfft_pruned_range(const Q15 *in,Q15* tmp,Q15* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+template
+arm_status sdft_init(sdftstate<Q15> *S,uint16_t N,const uint16_t *bins,uint16_t nbBins,uint16_t *phase,typename sdftacc<Q15>::type *acc,Q15 *delay);
+
+template
+void sdft_update(sdftstate<Q15> *S,const Q15 *in,uint32_t nbSamples);
+
+template
+void sdft_bins(const sdftstate<Q15> *S,Q15 *out);
+
+template
+arm_status rfft_pair(const Q15 *in1,const Q15 *in2,Q15* tmp,Q15* out1,Q15* out2, uint16_t N);
+
+template
+arm_status cfft_multi(const Q15 *in,Q15* out, uint16_t N,uint16_t nbChannels);
+
+template
+arm_status cifft_multi(const Q15 *in,Q15* out, uint16_t N,uint16_t nbChannels);
+
+template
+arm_status analytic_signal(const Q15 *in,Q15* tmp,Q15* out, uint16_t N);
+
+template
+arm_status hilbert(const Q15 *in,Q15* tmp,Q15* out, uint16_t N);
+
+template
+arm_status fft_plan_cfft(fftplan<Q15> *plan,uint16_t N,uint8_t inverse);
+
+template
+arm_status fft_plan_cfft2D(fftplan<Q15> *plan,uint16_t rows,uint16_t cols,uint8_t inverse);
+
+template
+uint32_t fft_scratch_size(const fftplan<Q15> *plan);
+
+template
+arm_status fft_execute(const fftplan<Q15> *plan,const Q15 *in,Q15* out,Q15 *scratch,uint32_t scratchSize);
+
+template
+void spectrum_mul(const Q15 *a,const Q15 *b,Q15* out, uint32_t nbBins);
+
+template
+void spectrum_mulconj(const Q15 *a,const Q15 *b,Q15* out, uint32_t nbBins);
+
+template
+void spectrum_mac(const Q15 *a,const Q15 *b,Q15* acc, uint32_t nbBins);
+
+template
+arm_status cfft3D(const Q15 *in,Q15* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+template
+arm_status cifft3D(const Q15 *in,Q15* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+template
+void fft_job_init(fftjob *job,const fftplan<Q15> *plan,const Q15 *in,Q15 *out,fftjobcallback callback,void *context);
+
 #endif
 
 #if defined(FUNC_CFFT_Q7)
@@ -308,6 +812,78 @@ arm_status cfft2D(const Q7 *in,Q7* out, uint16_t rows,uint16_t cols);
 template
 arm_status cifft2D(const Q7 *in,Q7* out, uint16_t rows,uint16_t cols);
 
+template
+arm_status cfft_split(const Q7 *inRe,const Q7 *inIm,Q7* tmp,Q7* outRe,Q7* outIm,uint16_t N);
+
+template
+arm_status cifft_split(const Q7 *inRe,const Q7 *inIm,Q7* tmp,Q7* outRe,Q7* outIm,uint16_t N);
+
+template
+void complex_interleave(const Q7 *re,const Q7 *im,Q7* out, uint32_t n);
+
+template
+void complex_deinterleave(const Q7 *in,Q7 *re,Q7* im, uint32_t n);
+
+template
+arm_status cfft_pruned(const Q7 *in,Q7* tmp,Q7* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+
+template
+arm_status cfft_pruned_range(const Q7 *in,Q7* tmp,Q7* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+template
+arm_status sdft_init(sdftstate<Q7> *S,uint16_t N,const uint16_t *bins,uint16_t nbBins,uint16_t *phase,typename sdftacc<Q7>::type *acc,Q7 *delay);
+
+template
+void sdft_update(sdftstate<Q7> *S,const Q7 *in,uint32_t nbSamples);
+
+template
+void sdft_bins(const sdftstate<Q7> *S,Q7 *out);
+
+template
+arm_status rfft_pair(const Q7 *in1,const Q7 *in2,Q7* tmp,Q7* out1,Q7* out2, uint16_t N);
+
+template
+arm_status cfft_multi(const Q7 *in,Q7* out, uint16_t N,uint16_t nbChannels);
+
+template
+arm_status cifft_multi(const Q7 *in,Q7* out, uint16_t N,uint16_t nbChannels);
+
+template
+arm_status analytic_signal(const Q7 *in,Q7* tmp,Q7* out, uint16_t N);
+
+template
+arm_status hilbert(const Q7 *in,Q7* tmp,Q7* out, uint16_t N);
+
+template
+arm_status fft_plan_cfft(fftplan<Q7> *plan,uint16_t N,uint8_t inverse);
+
+template
+arm_status fft_plan_cfft2D(fftplan<Q7> *plan,uint16_t rows,uint16_t cols,uint8_t inverse);
+
+template
+uint32_t fft_scratch_size(const fftplan<Q7> *plan);
+
+template
+arm_status fft_execute(const fftplan<Q7> *plan,const Q7 *in,Q7* out,Q7 *scratch,uint32_t scratchSize);
+
+template
+void spectrum_mul(const Q7 *a,const Q7 *b,Q7* out, uint32_t nbBins);
+
+template
+void spectrum_mulconj(const Q7 *a,const Q7 *b,Q7* out, uint32_t nbBins);
+
+template
+void spectrum_mac(const Q7 *a,const Q7 *b,Q7* acc, uint32_t nbBins);
+
+template
+arm_status cfft3D(const Q7 *in,Q7* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+template
+arm_status cifft3D(const Q7 *in,Q7* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+template
+void fft_job_init(fftjob *job,const fftplan<Q7> *plan,const Q7 *in,Q7 *out,fftjobcallback callback,void *context);
+
 #endif
 
 
@@ -323,6 +899,15 @@ arm_status rfft(const float64_t *in,float64_t* tmp,float64_t* out, uint16_t N);
 
 template
 arm_status rifft(const float64_t *in,float64_t* tmp,float64_t* out, uint16_t N);
+
+template
+arm_status rfft_pruned(const float64_t *in,float64_t* tmp,float64_t* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+
+template
+arm_status rfft_pruned_range(const float64_t *in,float64_t* tmp,float64_t* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+template
+arm_status fft_plan_rfft(fftplan<float64_t> *plan,uint16_t N,uint8_t inverse);
 #endif
 
 #if defined(FUNC_RFFT_F32)
@@ -331,6 +916,51 @@ arm_status rfft(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N);
 
 template
 arm_status rifft(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N);
+
+template
+arm_status rfft_pruned(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+
+template
+arm_status rfft_pruned_range(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+template
+arm_status power_spectrum(const float32_t *in,const float32_t *window,float32_t* tmp,float32_t* out, uint16_t N);
+
+template
+arm_status log_power_spectrum(const float32_t *in,const float32_t *window,float32_t* tmp,float32_t* out, uint16_t N);
+
+template
+arm_status rfft_multi(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N,uint16_t nbChannels);
+
+template
+arm_status welch_psd_init(welchstate<float32_t> *S,uint16_t N,uint16_t overlap,const float32_t *window,uint16_t nbThreads,float32_t *segment,float32_t *tmp,float32_t *acc);
+
+template
+void welch_psd_update(welchstate<float32_t> *S,const float32_t *in,uint32_t nbSamples);
+
+template
+arm_status welch_psd(const welchstate<float32_t> *S,float32_t *out);
+
+template
+arm_status resampler_init(resamplerstate<float32_t> *S,uint16_t nIn,uint16_t nOut,uint16_t overlap,uint16_t transition,float32_t *gain,float32_t *frame,float32_t *spectrum,float32_t *tmp);
+
+template
+uint32_t resampler(resamplerstate<float32_t> *S,const float32_t *in,uint32_t nbSamples,float32_t *out);
+
+template
+arm_status fft_plan_rfft(fftplan<float32_t> *plan,uint16_t N,uint8_t inverse);
+
+template
+void xcorr(const float32_t *x,uint16_t nx,const float32_t *y,uint16_t ny,int32_t firstLag,uint16_t nbLags,float32_t *tmp,float32_t *out,uint16_t N);
+
+template
+void autocorr(const float32_t *x,uint16_t nx,uint16_t nbLags,float32_t *tmp,float32_t *out,uint16_t N);
+
+template
+arm_status xcorr_stream_init(xcorrstate<float32_t> *S,const float32_t *y,uint16_t M,uint16_t N,float32_t *spectrum,float32_t *segment,float32_t *tmp);
+
+template
+uint32_t xcorr_stream(xcorrstate<float32_t> *S,const float32_t *in,uint32_t nbSamples,float32_t *out);
 #endif
 
 #if defined(FUNC_RFFT_F16) && defined(ARM_FLOAT16_SUPPORTED)
@@ -340,6 +970,48 @@ arm_status rfft(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N);
 template
 arm_status rifft(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N);
 
+template
+arm_status rfft_pruned(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+
+template
+arm_status rfft_pruned_range(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+template
+arm_status power_spectrum(const float16_t *in,const float16_t *window,float16_t* tmp,float16_t* out, uint16_t N);
+
+template
+arm_status log_power_spectrum(const float16_t *in,const float16_t *window,float16_t* tmp,float16_t* out, uint16_t N);
+
+template
+arm_status rfft_multi(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N,uint16_t nbChannels);
+
+template
+arm_status resampler_init(resamplerstate<float16_t> *S,uint16_t nIn,uint16_t nOut,uint16_t overlap,uint16_t transition,float16_t *gain,float16_t *frame,float16_t *spectrum,float16_t *tmp);
+
+template
+uint32_t resampler(resamplerstate<float16_t> *S,const float16_t *in,uint32_t nbSamples,float16_t *out);
+
+template
+arm_status fft_plan_rfft(fftplan<float16_t> *plan,uint16_t N,uint8_t inverse);
+
+template
+arm_status rfft_mixed(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N);
+
+template
+arm_status rifft_mixed(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N);
+
+template
+void xcorr(const float16_t *x,uint16_t nx,const float16_t *y,uint16_t ny,int32_t firstLag,uint16_t nbLags,float16_t *tmp,float16_t *out,uint16_t N);
+
+template
+void autocorr(const float16_t *x,uint16_t nx,uint16_t nbLags,float16_t *tmp,float16_t *out,uint16_t N);
+
+template
+arm_status xcorr_stream_init(xcorrstate<float16_t> *S,const float16_t *y,uint16_t M,uint16_t N,float16_t *spectrum,float16_t *segment,float16_t *tmp);
+
+template
+uint32_t xcorr_stream(xcorrstate<float16_t> *S,const float16_t *in,uint32_t nbSamples,float16_t *out);
+
 #endif
 
 #if defined(FUNC_RFFT_Q31)
@@ -349,6 +1021,30 @@ arm_status rfft(const Q31 *in,Q31* tmp,Q31* out, uint16_t N);
 template
 arm_status rifft(const Q31 *in,Q31* tmp,Q31* out, uint16_t N);
 
+template
+arm_status rfft_pruned(const Q31 *in,Q31* tmp,Q31* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+
+template
+arm_status rfft_pruned_range(const Q31 *in,Q31* tmp,Q31* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+template
+arm_status power_spectrum(const Q31 *in,const Q31 *window,Q31* tmp,Q31* out, uint16_t N);
+
+template
+arm_status rfft_multi(const Q31 *in,Q31* tmp,Q31* out, uint16_t N,uint16_t nbChannels);
+
+template
+arm_status fft_plan_rfft(fftplan<Q31> *plan,uint16_t N,uint8_t inverse);
+
+#endif
+
+#if defined(FUNC_RFFT_Q31MIX)
+template
+arm_status rfft_mixed(const Q31 *in,Q31* tmp,Q31* out, uint16_t N);
+
+template
+arm_status rifft_mixed(const Q31 *in,Q31* tmp,Q31* out, uint16_t N);
+
 #endif
 
 #if defined(FUNC_RFFT_Q15)
@@ -358,13 +1054,81 @@ arm_status rfft(const Q15 *in,Q15* tmp,Q15* out, uint16_t N);
 template
 arm_status rifft(const Q15 *in,Q15* tmp,Q15* out, uint16_t N);
 
+template
+arm_status rfft_pruned(const Q15 *in,Q15* tmp,Q15* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+
+template
+arm_status rfft_pruned_range(const Q15 *in,Q15* tmp,Q15* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+template
+arm_status power_spectrum(const Q15 *in,const Q15 *window,Q15* tmp,Q15* out, uint16_t N);
+
+template
+arm_status rfft_multi(const Q15 *in,Q15* tmp,Q15* out, uint16_t N,uint16_t nbChannels);
+
+template
+arm_status fft_plan_rfft(fftplan<Q15> *plan,uint16_t N,uint8_t inverse);
+
 #endif
 
 #if defined(FUNC_RFFT_Q7)
 template
-arm_status rfft(const Q7 *in,Q7* out,Q7* out, uint16_t N);
+arm_status rfft(const Q7 *in,Q7* tmp,Q7* out, uint16_t N);
+
+template
+arm_status rifft(const Q7 *in,Q7* tmp,Q7* out, uint16_t N);
+
+template
+arm_status rfft_pruned(const Q7 *in,Q7* tmp,Q7* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+
+template
+arm_status rfft_pruned_range(const Q7 *in,Q7* tmp,Q7* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+template
+arm_status power_spectrum(const Q7 *in,const Q7 *window,Q7* tmp,Q7* out, uint16_t N);
+
+template
+arm_status rfft_multi(const Q7 *in,Q7* tmp,Q7* out, uint16_t N,uint16_t nbChannels);
+
+template
+arm_status fft_plan_rfft(fftplan<Q7> *plan,uint16_t N,uint8_t inverse);
+
+#endif
+
+/****
+
+MFCC
+
+*****/
+
+#if defined(FUNC_MFCC_F32)
+template
+arm_status mfcc(const float32_t *in,const float32_t *window,float32_t* tmp,float32_t* out, uint16_t N,uint16_t nbMel,uint16_t nbDct);
+#endif
+
+#if defined(FUNC_MFCC_F16) && defined(ARM_FLOAT16_SUPPORTED)
+template
+arm_status mfcc(const float16_t *in,const float16_t *window,float16_t* tmp,float16_t* out, uint16_t N,uint16_t nbMel,uint16_t nbDct);
+#endif
+
+/****
+
+Channelizer
+
+*****/
 
+#if defined(FUNC_CHANNELIZER_F32)
 template
-arm_status rifft(const Q7 *in,Q7* out,Q7* out, uint16_t N);
+arm_status channelizer_init(channelizerstate<float32_t> *S,uint16_t nbChannels,uint16_t nbTaps,uint16_t hop,float32_t *delay,float32_t *tmp);
 
-#endif
\ No newline at end of file
+template
+uint32_t channelizer(channelizerstate<float32_t> *S,const float32_t *in,uint32_t nbSamples,float32_t *out);
+#endif
+
+#if defined(FUNC_CHANNELIZER_F16) && defined(ARM_FLOAT16_SUPPORTED)
+template
+arm_status channelizer_init(channelizerstate<float16_t> *S,uint16_t nbChannels,uint16_t nbTaps,uint16_t hop,float16_t *delay,float16_t *tmp);
+
+template
+uint32_t channelizer(channelizerstate<float16_t> *S,const float16_t *in,uint32_t nbSamples,float16_t *out);
+#endif
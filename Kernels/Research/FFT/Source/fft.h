@@ -43,6 +43,32 @@ extern template arm_status cifft(const float64_t *in,float64_t* out, uint16_t N)
 
 extern template arm_status cfft2D(const float64_t *in,float64_t* out, uint16_t rows,uint16_t cols);
 extern template arm_status cifft2D(const float64_t *in,float64_t* out, uint16_t rows,uint16_t cols);
+
+extern template arm_status cfft_split(const float64_t *inRe,const float64_t *inIm,float64_t* tmp,float64_t* outRe,float64_t* outIm,uint16_t N);
+extern template arm_status cifft_split(const float64_t *inRe,const float64_t *inIm,float64_t* tmp,float64_t* outRe,float64_t* outIm,uint16_t N);
+
+extern template void complex_interleave(const float64_t *re,const float64_t *im,float64_t* out, uint32_t n);
+extern template void complex_deinterleave(const float64_t *in,float64_t *re,float64_t* im, uint32_t n);
+
+extern template arm_status cfft_pruned(const float64_t *in,float64_t* tmp,float64_t* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+extern template arm_status cfft_pruned_range(const float64_t *in,float64_t* tmp,float64_t* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+extern template arm_status cfft_multi(const float64_t *in,float64_t* out, uint16_t N,uint16_t nbChannels);
+extern template arm_status cifft_multi(const float64_t *in,float64_t* out, uint16_t N,uint16_t nbChannels);
+
+extern template arm_status fft_plan_cfft(fftplan<float64_t> *plan,uint16_t N,uint8_t inverse);
+extern template arm_status fft_plan_cfft2D(fftplan<float64_t> *plan,uint16_t rows,uint16_t cols,uint8_t inverse);
+extern template uint32_t fft_scratch_size(const fftplan<float64_t> *plan);
+extern template arm_status fft_execute(const fftplan<float64_t> *plan,const float64_t *in,float64_t* out,float64_t *scratch,uint32_t scratchSize);
+
+extern template void spectrum_mul(const float64_t *a,const float64_t *b,float64_t* out, uint32_t nbBins);
+extern template void spectrum_mulconj(const float64_t *a,const float64_t *b,float64_t* out, uint32_t nbBins);
+extern template void spectrum_mac(const float64_t *a,const float64_t *b,float64_t* acc, uint32_t nbBins);
+
+extern template arm_status cfft3D(const float64_t *in,float64_t* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+extern template arm_status cifft3D(const float64_t *in,float64_t* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+extern template void fft_job_init(fftjob *job,const fftplan<float64_t> *plan,const float64_t *in,float64_t *out,fftjobcallback callback,void *context);
 #endif
 
 #if defined(FUNC_CFFT_F32)
@@ -51,6 +77,49 @@ extern template arm_status cifft<float32_t>(const float32_t *in,float32_t* out,
 
 extern template arm_status cfft2D<float32_t>(const float32_t *in,float32_t* out, uint16_t rows,uint16_t cols);
 extern template arm_status cifft2D<float32_t>(const float32_t *in,float32_t* out, uint16_t rows,uint16_t cols);
+
+extern template arm_status cfft_split<float32_t>(const float32_t *inRe,const float32_t *inIm,float32_t* tmp,float32_t* outRe,float32_t* outIm,uint16_t N);
+extern template arm_status cifft_split<float32_t>(const float32_t *inRe,const float32_t *inIm,float32_t* tmp,float32_t* outRe,float32_t* outIm,uint16_t N);
+
+extern template void complex_interleave<float32_t>(const float32_t *re,const float32_t *im,float32_t* out, uint32_t n);
+extern template void complex_deinterleave<float32_t>(const float32_t *in,float32_t *re,float32_t* im, uint32_t n);
+
+extern template arm_status cfft_pruned<float32_t>(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+extern template arm_status cfft_pruned_range<float32_t>(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+extern template arm_status sdft_init<float32_t>(sdftstate<float32_t> *S,uint16_t N,const uint16_t *bins,uint16_t nbBins,uint16_t *phase,typename sdftacc<float32_t>::type *acc,float32_t *delay);
+extern template void sdft_update<float32_t>(sdftstate<float32_t> *S,const float32_t *in,uint32_t nbSamples);
+extern template void sdft_bins<float32_t>(const sdftstate<float32_t> *S,float32_t *out);
+
+extern template arm_status rfft_pair<float32_t>(const float32_t *in1,const float32_t *in2,float32_t* tmp,float32_t* out1,float32_t* out2, uint16_t N);
+
+extern template arm_status cfft_multi<float32_t>(const float32_t *in,float32_t* out, uint16_t N,uint16_t nbChannels);
+extern template arm_status cifft_multi<float32_t>(const float32_t *in,float32_t* out, uint16_t N,uint16_t nbChannels);
+
+extern template arm_status welch_csd_init<float32_t>(welchstate<float32_t> *S,uint16_t N,uint16_t overlap,const float32_t *window,uint16_t nbThreads,float32_t *segment,float32_t *tmp,float32_t *acc);
+extern template void welch_csd_update<float32_t>(welchstate<float32_t> *S,const float32_t *x,const float32_t *y,uint32_t nbSamples);
+extern template arm_status welch_csd<float32_t>(const welchstate<float32_t> *S,float32_t *out);
+extern template arm_status welch_coherence<float32_t>(const welchstate<float32_t> *S,float32_t *out);
+
+extern template arm_status analytic_signal<float32_t>(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N);
+extern template arm_status hilbert<float32_t>(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N);
+
+extern template arm_status fft_plan_cfft<float32_t>(fftplan<float32_t> *plan,uint16_t N,uint8_t inverse);
+extern template arm_status fft_plan_cfft2D<float32_t>(fftplan<float32_t> *plan,uint16_t rows,uint16_t cols,uint8_t inverse);
+extern template uint32_t fft_scratch_size<float32_t>(const fftplan<float32_t> *plan);
+extern template arm_status fft_execute<float32_t>(const fftplan<float32_t> *plan,const float32_t *in,float32_t* out,float32_t *scratch,uint32_t scratchSize);
+
+extern template void spectrum_mul<float32_t>(const float32_t *a,const float32_t *b,float32_t* out, uint32_t nbBins);
+extern template void spectrum_mulconj<float32_t>(const float32_t *a,const float32_t *b,float32_t* out, uint32_t nbBins);
+extern template void spectrum_mac<float32_t>(const float32_t *a,const float32_t *b,float32_t* acc, uint32_t nbBins);
+
+extern template arm_status cfft3D<float32_t>(const float32_t *in,float32_t* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+extern template arm_status cifft3D<float32_t>(const float32_t *in,float32_t* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+extern template arm_status zoom_fft_init<float32_t>(zoomstate<float32_t> *S,float32_t center,uint16_t decimation,uint16_t nbTaps,uint16_t N,const float32_t *window,float32_t *coefs,float32_t *delay,float32_t *frame);
+extern template uint32_t zoom_fft<float32_t>(zoomstate<float32_t> *S,const float32_t *in,uint32_t nbSamples,float32_t *out);
+
+extern template void fft_job_init<float32_t>(fftjob *job,const fftplan<float32_t> *plan,const float32_t *in,float32_t *out,fftjobcallback callback,void *context);
 #endif
 
 #if defined(FUNC_CFFT_F16)
@@ -59,6 +128,43 @@ extern template arm_status cifft(const float16_t *in,float16_t* out, uint16_t N)
 
 extern template arm_status cfft2D(const float16_t *in,float16_t* out, uint16_t rows,uint16_t cols);
 extern template arm_status cifft2D(const float16_t *in,float16_t* out, uint16_t rows,uint16_t cols);
+
+extern template arm_status cfft_split(const float16_t *inRe,const float16_t *inIm,float16_t* tmp,float16_t* outRe,float16_t* outIm,uint16_t N);
+extern template arm_status cifft_split(const float16_t *inRe,const float16_t *inIm,float16_t* tmp,float16_t* outRe,float16_t* outIm,uint16_t N);
+
+extern template void complex_interleave(const float16_t *re,const float16_t *im,float16_t* out, uint32_t n);
+extern template void complex_deinterleave(const float16_t *in,float16_t *re,float16_t* im, uint32_t n);
+
+extern template arm_status cfft_pruned(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+extern template arm_status cfft_pruned_range(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+extern template arm_status rfft_pair(const float16_t *in1,const float16_t *in2,float16_t* tmp,float16_t* out1,float16_t* out2, uint16_t N);
+
+extern template arm_status cfft_multi(const float16_t *in,float16_t* out, uint16_t N,uint16_t nbChannels);
+extern template arm_status cifft_multi(const float16_t *in,float16_t* out, uint16_t N,uint16_t nbChannels);
+
+extern template arm_status analytic_signal(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N);
+extern template arm_status hilbert(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N);
+
+extern template arm_status fft_plan_cfft(fftplan<float16_t> *plan,uint16_t N,uint8_t inverse);
+extern template arm_status fft_plan_cfft2D(fftplan<float16_t> *plan,uint16_t rows,uint16_t cols,uint8_t inverse);
+extern template uint32_t fft_scratch_size(const fftplan<float16_t> *plan);
+extern template arm_status fft_execute(const fftplan<float16_t> *plan,const float16_t *in,float16_t* out,float16_t *scratch,uint32_t scratchSize);
+
+extern template void spectrum_mul(const float16_t *a,const float16_t *b,float16_t* out, uint32_t nbBins);
+extern template void spectrum_mulconj(const float16_t *a,const float16_t *b,float16_t* out, uint32_t nbBins);
+extern template void spectrum_mac(const float16_t *a,const float16_t *b,float16_t* acc, uint32_t nbBins);
+
+extern template arm_status cfft_mixed(const float16_t *in,float16_t* out, uint16_t N);
+extern template arm_status cifft_mixed(const float16_t *in,float16_t* out, uint16_t N);
+
+extern template arm_status cfft3D(const float16_t *in,float16_t* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+extern template arm_status cifft3D(const float16_t *in,float16_t* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+extern template arm_status zoom_fft_init(zoomstate<float16_t> *S,float32_t center,uint16_t decimation,uint16_t nbTaps,uint16_t N,const float16_t *window,float16_t *coefs,float16_t *delay,float16_t *frame);
+extern template uint32_t zoom_fft(zoomstate<float16_t> *S,const float16_t *in,uint32_t nbSamples,float16_t *out);
+
+extern template void fft_job_init(fftjob *job,const fftplan<float16_t> *plan,const float16_t *in,float16_t *out,fftjobcallback callback,void *context);
 #endif
 
 #if defined(FUNC_CFFT_Q31)
@@ -67,6 +173,46 @@ extern template arm_status cifft(const Q31 *in,Q31* out, uint16_t N);
 
 extern template arm_status cfft2D(const Q31 *in,Q31* out, uint16_t rows,uint16_t cols);
 extern template arm_status cifft2D(const Q31 *in,Q31* out, uint16_t rows,uint16_t cols);
+
+extern template arm_status cfft_split(const Q31 *inRe,const Q31 *inIm,Q31* tmp,Q31* outRe,Q31* outIm,uint16_t N);
+extern template arm_status cifft_split(const Q31 *inRe,const Q31 *inIm,Q31* tmp,Q31* outRe,Q31* outIm,uint16_t N);
+
+extern template void complex_interleave(const Q31 *re,const Q31 *im,Q31* out, uint32_t n);
+extern template void complex_deinterleave(const Q31 *in,Q31 *re,Q31* im, uint32_t n);
+
+extern template arm_status cfft_pruned(const Q31 *in,Q31* tmp,Q31* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+extern template arm_status cfft_pruned_range(const Q31 *in,Q31* tmp,Q31* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+extern template arm_status sdft_init(sdftstate<Q31> *S,uint16_t N,const uint16_t *bins,uint16_t nbBins,uint16_t *phase,typename sdftacc<Q31>::type *acc,Q31 *delay);
+extern template void sdft_update(sdftstate<Q31> *S,const Q31 *in,uint32_t nbSamples);
+extern template void sdft_bins(const sdftstate<Q31> *S,Q31 *out);
+
+extern template arm_status rfft_pair(const Q31 *in1,const Q31 *in2,Q31* tmp,Q31* out1,Q31* out2, uint16_t N);
+
+extern template arm_status cfft_multi(const Q31 *in,Q31* out, uint16_t N,uint16_t nbChannels);
+extern template arm_status cifft_multi(const Q31 *in,Q31* out, uint16_t N,uint16_t nbChannels);
+
+extern template arm_status analytic_signal(const Q31 *in,Q31* tmp,Q31* out, uint16_t N);
+extern template arm_status hilbert(const Q31 *in,Q31* tmp,Q31* out, uint16_t N);
+
+extern template arm_status fft_plan_cfft(fftplan<Q31> *plan,uint16_t N,uint8_t inverse);
+extern template arm_status fft_plan_cfft2D(fftplan<Q31> *plan,uint16_t rows,uint16_t cols,uint8_t inverse);
+extern template uint32_t fft_scratch_size(const fftplan<Q31> *plan);
+extern template arm_status fft_execute(const fftplan<Q31> *plan,const Q31 *in,Q31* out,Q31 *scratch,uint32_t scratchSize);
+
+extern template void spectrum_mul(const Q31 *a,const Q31 *b,Q31* out, uint32_t nbBins);
+extern template void spectrum_mulconj(const Q31 *a,const Q31 *b,Q31* out, uint32_t nbBins);
+extern template void spectrum_mac(const Q31 *a,const Q31 *b,Q31* acc, uint32_t nbBins);
+
+extern template arm_status cfft3D(const Q31 *in,Q31* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+extern template arm_status cifft3D(const Q31 *in,Q31* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+extern template void fft_job_init(fftjob *job,const fftplan<Q31> *plan,const Q31 *in,Q31 *out,fftjobcallback callback,void *context);
+#endif
+
+#if defined(FUNC_CFFT_Q31MIX)
+extern template arm_status cfft_mixed(const Q31 *in,Q31* out, uint16_t N);
+extern template arm_status cifft_mixed(const Q31 *in,Q31* out, uint16_t N);
 #endif
 
 #if defined(FUNC_CFFT_Q15)
@@ -75,6 +221,41 @@ extern template arm_status cifft(const Q15 *in,Q15* out, uint16_t N);
 
 extern template arm_status cfft2D(const Q15 *in,Q15* out, uint16_t rows,uint16_t cols);
 extern template arm_status cifft2D(const Q15 *in,Q15* out, uint16_t rows,uint16_t cols);
+
+extern template arm_status cfft_split(const Q15 *inRe,const Q15 *inIm,Q15* tmp,Q15* outRe,Q15* outIm,uint16_t N);
+extern template arm_status cifft_split(const Q15 *inRe,const Q15 *inIm,Q15* tmp,Q15* outRe,Q15* outIm,uint16_t N);
+
+extern template void complex_interleave(const Q15 *re,const Q15 *im,Q15* out, uint32_t n);
+extern template void complex_deinterleave(const Q15 *in,Q15 *re,Q15* im, uint32_t n);
+
+extern template arm_status cfft_pruned(const Q15 *in,Q15* tmp,Q15* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+extern template arm_status cfft_pruned_range(const Q15 *in,Q15* tmp,Q15* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+extern template arm_status sdft_init(sdftstate<Q15> *S,uint16_t N,const uint16_t *bins,uint16_t nbBins,uint16_t *phase,typename sdftacc<Q15>::type *acc,Q15 *delay);
+extern template void sdft_update(sdftstate<Q15> *S,const Q15 *in,uint32_t nbSamples);
+extern template void sdft_bins(const sdftstate<Q15> *S,Q15 *out);
+
+extern template arm_status rfft_pair(const Q15 *in1,const Q15 *in2,Q15* tmp,Q15* out1,Q15* out2, uint16_t N);
+
+extern template arm_status cfft_multi(const Q15 *in,Q15* out, uint16_t N,uint16_t nbChannels);
+extern template arm_status cifft_multi(const Q15 *in,Q15* out, uint16_t N,uint16_t nbChannels);
+
+extern template arm_status analytic_signal(const Q15 *in,Q15* tmp,Q15* out, uint16_t N);
+extern template arm_status hilbert(const Q15 *in,Q15* tmp,Q15* out, uint16_t N);
+
+extern template arm_status fft_plan_cfft(fftplan<Q15> *plan,uint16_t N,uint8_t inverse);
+extern template arm_status fft_plan_cfft2D(fftplan<Q15> *plan,uint16_t rows,uint16_t cols,uint8_t inverse);
+extern template uint32_t fft_scratch_size(const fftplan<Q15> *plan);
+extern template arm_status fft_execute(const fftplan<Q15> *plan,const Q15 *in,Q15* out,Q15 *scratch,uint32_t scratchSize);
+
+extern template void spectrum_mul(const Q15 *a,const Q15 *b,Q15* out, uint32_t nbBins);
+extern template void spectrum_mulconj(const Q15 *a,const Q15 *b,Q15* out, uint32_t nbBins);
+extern template void spectrum_mac(const Q15 *a,const Q15 *b,Q15* acc, uint32_t nbBins);
+
+extern template arm_status cfft3D(const Q15 *in,Q15* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+extern template arm_status cifft3D(const Q15 *in,Q15* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+extern template void fft_job_init(fftjob *job,const fftplan<Q15> *plan,const Q15 *in,Q15 *out,fftjobcallback callback,void *context);
 #endif
 
 #if defined(FUNC_CFFT_Q7)
@@ -83,6 +264,41 @@ extern template arm_status cifft(const Q7 *in,Q7* out, uint16_t N);
 
 extern template arm_status cfft2D(const Q7 *in,Q7* out, uint16_t rows,uint16_t cols);
 extern template arm_status cifft2D(const Q7 *in,Q7* out, uint16_t rows,uint16_t cols);
+
+extern template arm_status cfft_split(const Q7 *inRe,const Q7 *inIm,Q7* tmp,Q7* outRe,Q7* outIm,uint16_t N);
+extern template arm_status cifft_split(const Q7 *inRe,const Q7 *inIm,Q7* tmp,Q7* outRe,Q7* outIm,uint16_t N);
+
+extern template void complex_interleave(const Q7 *re,const Q7 *im,Q7* out, uint32_t n);
+extern template void complex_deinterleave(const Q7 *in,Q7 *re,Q7* im, uint32_t n);
+
+extern template arm_status cfft_pruned(const Q7 *in,Q7* tmp,Q7* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+extern template arm_status cfft_pruned_range(const Q7 *in,Q7* tmp,Q7* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+extern template arm_status sdft_init(sdftstate<Q7> *S,uint16_t N,const uint16_t *bins,uint16_t nbBins,uint16_t *phase,typename sdftacc<Q7>::type *acc,Q7 *delay);
+extern template void sdft_update(sdftstate<Q7> *S,const Q7 *in,uint32_t nbSamples);
+extern template void sdft_bins(const sdftstate<Q7> *S,Q7 *out);
+
+extern template arm_status rfft_pair(const Q7 *in1,const Q7 *in2,Q7* tmp,Q7* out1,Q7* out2, uint16_t N);
+
+extern template arm_status cfft_multi(const Q7 *in,Q7* out, uint16_t N,uint16_t nbChannels);
+extern template arm_status cifft_multi(const Q7 *in,Q7* out, uint16_t N,uint16_t nbChannels);
+
+extern template arm_status analytic_signal(const Q7 *in,Q7* tmp,Q7* out, uint16_t N);
+extern template arm_status hilbert(const Q7 *in,Q7* tmp,Q7* out, uint16_t N);
+
+extern template arm_status fft_plan_cfft(fftplan<Q7> *plan,uint16_t N,uint8_t inverse);
+extern template arm_status fft_plan_cfft2D(fftplan<Q7> *plan,uint16_t rows,uint16_t cols,uint8_t inverse);
+extern template uint32_t fft_scratch_size(const fftplan<Q7> *plan);
+extern template arm_status fft_execute(const fftplan<Q7> *plan,const Q7 *in,Q7* out,Q7 *scratch,uint32_t scratchSize);
+
+extern template void spectrum_mul(const Q7 *a,const Q7 *b,Q7* out, uint32_t nbBins);
+extern template void spectrum_mulconj(const Q7 *a,const Q7 *b,Q7* out, uint32_t nbBins);
+extern template void spectrum_mac(const Q7 *a,const Q7 *b,Q7* acc, uint32_t nbBins);
+
+extern template arm_status cfft3D(const Q7 *in,Q7* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+extern template arm_status cifft3D(const Q7 *in,Q7* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+extern template void fft_job_init(fftjob *job,const fftplan<Q7> *plan,const Q7 *in,Q7 *out,fftjobcallback callback,void *context);
 #endif
 
 /*
@@ -111,18 +327,68 @@ out buffer has length n real samples.
 extern template arm_status rfft(const float64_t *in,float64_t* tmp,float64_t* out, uint16_t N);
 
 extern template arm_status rifft(const float64_t *in,float64_t* tmp,float64_t* out, uint16_t N);
+
+extern template arm_status rfft_pruned(const float64_t *in,float64_t* tmp,float64_t* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+extern template arm_status rfft_pruned_range(const float64_t *in,float64_t* tmp,float64_t* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+extern template arm_status fft_plan_rfft(fftplan<float64_t> *plan,uint16_t N,uint8_t inverse);
 #endif
 
 #if defined(FUNC_RFFT_F32)
 extern template arm_status rfft(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N);
 
 extern template arm_status rifft(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N);
+
+extern template arm_status rfft_pruned(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+extern template arm_status rfft_pruned_range(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+extern template arm_status power_spectrum(const float32_t *in,const float32_t *window,float32_t* tmp,float32_t* out, uint16_t N);
+
+extern template arm_status log_power_spectrum(const float32_t *in,const float32_t *window,float32_t* tmp,float32_t* out, uint16_t N);
+
+extern template arm_status rfft_multi(const float32_t *in,float32_t* tmp,float32_t* out, uint16_t N,uint16_t nbChannels);
+
+extern template arm_status welch_psd_init(welchstate<float32_t> *S,uint16_t N,uint16_t overlap,const float32_t *window,uint16_t nbThreads,float32_t *segment,float32_t *tmp,float32_t *acc);
+extern template void welch_psd_update(welchstate<float32_t> *S,const float32_t *in,uint32_t nbSamples);
+extern template arm_status welch_psd(const welchstate<float32_t> *S,float32_t *out);
+
+extern template arm_status resampler_init(resamplerstate<float32_t> *S,uint16_t nIn,uint16_t nOut,uint16_t overlap,uint16_t transition,float32_t *gain,float32_t *frame,float32_t *spectrum,float32_t *tmp);
+extern template uint32_t resampler(resamplerstate<float32_t> *S,const float32_t *in,uint32_t nbSamples,float32_t *out);
+
+extern template arm_status fft_plan_rfft(fftplan<float32_t> *plan,uint16_t N,uint8_t inverse);
+
+extern template void xcorr(const float32_t *x,uint16_t nx,const float32_t *y,uint16_t ny,int32_t firstLag,uint16_t nbLags,float32_t *tmp,float32_t *out,uint16_t N);
+extern template void autocorr(const float32_t *x,uint16_t nx,uint16_t nbLags,float32_t *tmp,float32_t *out,uint16_t N);
+extern template arm_status xcorr_stream_init(xcorrstate<float32_t> *S,const float32_t *y,uint16_t M,uint16_t N,float32_t *spectrum,float32_t *segment,float32_t *tmp);
+extern template uint32_t xcorr_stream(xcorrstate<float32_t> *S,const float32_t *in,uint32_t nbSamples,float32_t *out);
 #endif
 
 #if defined(FUNC_RFFT_F16)
 extern template arm_status rfft(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N);
 
 extern template arm_status rifft(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N);
+
+extern template arm_status rfft_pruned(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+extern template arm_status rfft_pruned_range(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+extern template arm_status power_spectrum(const float16_t *in,const float16_t *window,float16_t* tmp,float16_t* out, uint16_t N);
+
+extern template arm_status log_power_spectrum(const float16_t *in,const float16_t *window,float16_t* tmp,float16_t* out, uint16_t N);
+
+extern template arm_status rfft_multi(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N,uint16_t nbChannels);
+
+extern template arm_status resampler_init(resamplerstate<float16_t> *S,uint16_t nIn,uint16_t nOut,uint16_t overlap,uint16_t transition,float16_t *gain,float16_t *frame,float16_t *spectrum,float16_t *tmp);
+extern template uint32_t resampler(resamplerstate<float16_t> *S,const float16_t *in,uint32_t nbSamples,float16_t *out);
+
+extern template arm_status fft_plan_rfft(fftplan<float16_t> *plan,uint16_t N,uint8_t inverse);
+
+extern template arm_status rfft_mixed(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N);
+extern template arm_status rifft_mixed(const float16_t *in,float16_t* tmp,float16_t* out, uint16_t N);
+
+extern template void xcorr(const float16_t *x,uint16_t nx,const float16_t *y,uint16_t ny,int32_t firstLag,uint16_t nbLags,float16_t *tmp,float16_t *out,uint16_t N);
+extern template void autocorr(const float16_t *x,uint16_t nx,uint16_t nbLags,float16_t *tmp,float16_t *out,uint16_t N);
+extern template arm_status xcorr_stream_init(xcorrstate<float16_t> *S,const float16_t *y,uint16_t M,uint16_t N,float16_t *spectrum,float16_t *segment,float16_t *tmp);
+extern template uint32_t xcorr_stream(xcorrstate<float16_t> *S,const float16_t *in,uint32_t nbSamples,float16_t *out);
 #endif
 
 #if defined(FUNC_RFFT_Q31)
@@ -130,6 +396,20 @@ extern template arm_status rfft(const Q31 *in,Q31* tmp,Q31* out, uint16_t N);
 
 extern template arm_status rifft(const Q31 *in,Q31* tmp,Q31* out, uint16_t N);
 
+extern template arm_status rfft_pruned(const Q31 *in,Q31* tmp,Q31* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+extern template arm_status rfft_pruned_range(const Q31 *in,Q31* tmp,Q31* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+extern template arm_status power_spectrum(const Q31 *in,const Q31 *window,Q31* tmp,Q31* out, uint16_t N);
+
+extern template arm_status rfft_multi(const Q31 *in,Q31* tmp,Q31* out, uint16_t N,uint16_t nbChannels);
+
+extern template arm_status fft_plan_rfft(fftplan<Q31> *plan,uint16_t N,uint8_t inverse);
+
+#endif
+
+#if defined(FUNC_RFFT_Q31MIX)
+extern template arm_status rfft_mixed(const Q31 *in,Q31* tmp,Q31* out, uint16_t N);
+extern template arm_status rifft_mixed(const Q31 *in,Q31* tmp,Q31* out, uint16_t N);
 #endif
 
 #if defined(FUNC_RFFT_Q15)
@@ -137,6 +417,15 @@ extern template arm_status rfft(const Q15 *in,Q15* tmp,Q15* out, uint16_t N);
 
 extern template arm_status rifft(const Q15 *in,Q15* tmp,Q15* out, uint16_t N);
 
+extern template arm_status rfft_pruned(const Q15 *in,Q15* tmp,Q15* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+extern template arm_status rfft_pruned_range(const Q15 *in,Q15* tmp,Q15* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+extern template arm_status power_spectrum(const Q15 *in,const Q15 *window,Q15* tmp,Q15* out, uint16_t N);
+
+extern template arm_status rfft_multi(const Q15 *in,Q15* tmp,Q15* out, uint16_t N,uint16_t nbChannels);
+
+extern template arm_status fft_plan_rfft(fftplan<Q15> *plan,uint16_t N,uint8_t inverse);
+
 #endif
 
 #if defined(FUNC_RFFT_Q7)
@@ -144,6 +433,62 @@ extern template arm_status rfft(const Q7 *in,Q7* tmp,Q7* out, uint16_t N);
 
 extern template arm_status rifft(const Q7 *in,Q7* tmp,Q7* out, uint16_t N);
 
+extern template arm_status rfft_pruned(const Q7 *in,Q7* tmp,Q7* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+extern template arm_status rfft_pruned_range(const Q7 *in,Q7* tmp,Q7* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+extern template arm_status power_spectrum(const Q7 *in,const Q7 *window,Q7* tmp,Q7* out, uint16_t N);
+
+extern template arm_status rfft_multi(const Q7 *in,Q7* tmp,Q7* out, uint16_t N,uint16_t nbChannels);
+
+extern template arm_status fft_plan_rfft(fftplan<Q7> *plan,uint16_t N,uint8_t inverse);
+
+#endif
+
+
+
+/*
+
+MFCC
+
+*/
+
+/*
+
+tmp has N + N/2 + 1 samples and can be the same as in.
+
+*/
+
+#if defined(FUNC_MFCC_F32)
+extern template arm_status mfcc(const float32_t *in,const float32_t *window,float32_t* tmp,float32_t* out, uint16_t N,uint16_t nbMel,uint16_t nbDct);
+#endif
+
+#if defined(FUNC_MFCC_F16)
+extern template arm_status mfcc(const float16_t *in,const float16_t *window,float16_t* tmp,float16_t* out, uint16_t N,uint16_t nbMel,uint16_t nbDct);
+#endif
+
+/*
+
+Channelizer
+
+*/
+
+/*
+
+delay has nbChannels * nbTaps + hop complex samples and tmp
+nbChannels complex samples.
+channelizer returns the number of outputs of nbChannels complex
+samples written to out.
+
+*/
+
+#if defined(FUNC_CHANNELIZER_F32)
+extern template arm_status channelizer_init(channelizerstate<float32_t> *S,uint16_t nbChannels,uint16_t nbTaps,uint16_t hop,float32_t *delay,float32_t *tmp);
+extern template uint32_t channelizer(channelizerstate<float32_t> *S,const float32_t *in,uint32_t nbSamples,float32_t *out);
+#endif
+
+#if defined(FUNC_CHANNELIZER_F16)
+extern template arm_status channelizer_init(channelizerstate<float16_t> *S,uint16_t nbChannels,uint16_t nbTaps,uint16_t hop,float16_t *delay,float16_t *tmp);
+extern template uint32_t channelizer(channelizerstate<float16_t> *S,const float16_t *in,uint32_t nbSamples,float16_t *out);
 #endif
 
 
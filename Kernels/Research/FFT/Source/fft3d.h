@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+CFFT 3D of a volume depth x rows x cols (row-major, complex samples).
+
+The planes are computed one after the other : the FFTs of the rows
+and then the FFTs of the columns (with an input stride of cols) of a
+plane are computed while the plane is in the cache.
+Then the FFTs along the depth axis are computed with an input
+stride of rows x cols by blocks of adjacent lines : the lines of a
+block are sharing the same cache lines.
+
+The planes and the blocks of the depth axis are independent and
+can be spread across threads (FFT_THREADS). The blocks are never
+shared between two threads so two threads are never writing to the
+same cache line.
+
+*/
+
+#ifndef FFT3D_H
+#define FFT3D_H
+
+// Include templates to spread the planes across threads
+#include "threads.h"
+
+// Size of a cache line in bytes
+#if !defined(FFT_CACHE_LINE)
+#define FFT_CACHE_LINE 64
+#endif
+
+// FFT along one axis
+template<typename T,int mode>
+struct fft3daxis;
+
+template<typename T>
+struct fft3daxis<T,DIRECT>{
+  template<int inputstrideenabled>
+  __STATIC_FORCEINLINE void run(const T *in,T *out,int n,int inputstride)
+  {
+     (void)inner_cfft<T,inputstrideenabled>(in,out,n,inputstride);
+  }
+};
+
+template<typename T>
+struct fft3daxis<T,INVERSE>{
+  template<int inputstrideenabled>
+  __STATIC_FORCEINLINE void run(const T *in,T *out,int n,int inputstride)
+  {
+     (void)inner_cifft<T,inputstrideenabled>(in,out,n,inputstride);
+  }
+};
+
+template<typename T,int mode>
+struct fft3d{
+  const T *in;
+  T *out;
+  uint32_t depth;
+  uint32_t rows;
+  uint32_t cols;
+
+  // Number of adjacent lines of the depth axis in a block
+  static constexpr uint32_t block = (FFT_CACHE_LINE / sizeof(complex<T>)) > 0 ?
+        (FFT_CACHE_LINE / sizeof(complex<T>)) : 1;
+
+  // Rows and columns of the planes first to last-1
+  static void planes(void *context,uint32_t thread,uint32_t first,uint32_t last)
+  {
+     const fft3d<T,mode> *p = (const fft3d<T,mode> *)context;
+     const uint32_t planeSize = p->rows * p->cols;
+     (void)thread;
+
+     for(uint32_t d = first; d < last; d++)
+     {
+        const T *in = p->in + 2 * d * planeSize;
+        T *out = p->out + 2 * d * planeSize;
+
+        for(uint32_t row = 0; row < p->rows; row++)
+        {
+           fft3daxis<T,mode>::template run<0>(&in[2*row*p->cols],&out[2*row*p->cols],p->cols,0);
+        }
+
+        for(uint32_t col = 0; col < p->cols; col++)
+        {
+           fft3daxis<T,mode>::template run<1>(&out[2*col],&out[2*col],p->rows,p->cols);
+        }
+     }
+  }
+
+  // Depth axis for the blocks first to last-1
+  static void lines(void *context,uint32_t thread,uint32_t first,uint32_t last)
+  {
+     const fft3d<T,mode> *p = (const fft3d<T,mode> *)context;
+     const uint32_t planeSize = p->rows * p->cols;
+     uint32_t start,stop;
+     (void)thread;
+
+     for(uint32_t b = first; b < last; b++)
+     {
+        start = b * block;
+        stop = start + block;
+        if (stop > planeSize)
+        {
+           stop = planeSize;
+        }
+
+        for(uint32_t i = start; i < stop; i++)
+        {
+           fft3daxis<T,mode>::template run<1>(&p->out[2*i],&p->out[2*i],p->depth,planeSize);
+        }
+     }
+  }
+
+  static arm_status run(const T *in,T* out,uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads)
+  {
+     const fft3d<T,mode> p = {in,out,depth,rows,cols};
+     const uint32_t planeSize = (uint32_t)rows * cols;
+
+     if (!cfft_config<T>(depth) || !cfft_config<T>(rows) || !cfft_config<T>(cols))
+     {
+        return(ARM_MATH_LENGTH_ERROR);
+     }
+
+     fft_parallel(planes,(void*)&p,depth,nbThreads);
+     fft_parallel(lines,(void*)&p,(planeSize + block - 1) / block,nbThreads);
+
+     return(ARM_MATH_SUCCESS);
+  }
+};
+
+#endif
@@ -47,7 +47,7 @@ arm_status inner_cfft(const T *in,T* out, int n, int inputstride)
 
         fft<DIRECT,T,inputstrideenabled>::run(config,n,(complex<T>*)in,(complex<T>*)out,inputstride);
 
-        bitreversal<T,inputstrideenabled,vector<T>::vector_enabled>::run(out,config->nbPerms,config->perms,config->reversalVectorizable,inputstride);
+        fft<DIRECT,T,inputstrideenabled>::permute(config,n,out,inputstride);
     }
     else
     {
@@ -78,7 +78,7 @@ arm_status inner_cifft(const T *in,T* out, int n, int inputstride)
 
         fft<INVERSE,T,inputstrideenabled>::run(config,n,(complex<T>*)in,(complex<T>*)out,inputstride);
 
-        bitreversal<T,inputstrideenabled,vector<T>::vector_enabled>::run(out,config->nbPerms,config->perms,config->reversalVectorizable,inputstride);
+        fft<INVERSE,T,inputstrideenabled>::permute(config,n,out,inputstride);
 
         /* Normalize */
         for(int i =0; i < n ; i++)
@@ -166,6 +166,150 @@ arm_status cifft2D(const T *in,T* out, uint16_t rows,uint16_t cols)
 
 
 
+/****
+
+CFFT3D
+
+*****/
+
+// Include templates for the CFFT 3D
+#include "fft3d.h"
+
+template<typename T>
+arm_status cfft3D(const T *in,T* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads)
+{
+    return(fft3d<T,DIRECT>::run(in,out,depth,rows,cols,nbThreads));
+}
+
+template<typename T>
+arm_status cifft3D(const T *in,T* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads)
+{
+    return(fft3d<T,INVERSE>::run(in,out,depth,rows,cols,nbThreads));
+}
+
+
+
+/****
+
+Multi-channel FFT
+
+*****/
+
+// Include templates for the multi-channel FFT
+#include "multichannel.h"
+
+template<typename T>
+arm_status cfft_multi(const T *in,T* out, uint16_t n,uint16_t nbChannels)
+{
+    arm_status status=ARM_MATH_SUCCESS;
+
+    for(int channel=0; channel < nbChannels; channel ++)
+    {
+        status=inner_cfft<T,1>(&in[2*channel],&out[2*channel],n,nbChannels);
+
+        if (status != ARM_MATH_SUCCESS)
+        {
+           return(status);
+        }
+    }
+
+    return(status);
+}
+
+template<typename T>
+arm_status cifft_multi(const T *in,T* out, uint16_t n,uint16_t nbChannels)
+{
+    arm_status status=ARM_MATH_SUCCESS;
+
+    for(int channel=0; channel < nbChannels; channel ++)
+    {
+        status=inner_cifft<T,1>(&in[2*channel],&out[2*channel],n,nbChannels);
+
+        if (status != ARM_MATH_SUCCESS)
+        {
+           return(status);
+        }
+    }
+
+    return(status);
+}
+
+
+
+/****
+
+CFFT with split complex format
+
+*****/
+
+// Include templates for the split complex format
+#include "split.h"
+
+template<typename T>
+void complex_interleave(const T *re,const T *im,T* out, uint32_t n)
+{
+    interleave<T>::run(re,im,out,n);
+}
+
+template<typename T>
+void complex_deinterleave(const T *in,T *re,T* im, uint32_t n)
+{
+    deinterleave<T>::run(in,re,im,n);
+}
+
+template<typename T>
+arm_status cfft_split(const T *inRe,const T *inIm,T* tmp,T* outRe,T* outIm,uint16_t n)
+{
+    const cfftconfig<T> *config=cfft_config<T>(n);
+    arm_status status=ARM_MATH_SUCCESS;
+
+    if (config)
+    {
+        splitfft<DIRECT,T,vector<T>::vector_enabled>::run(config,n,inRe,inIm,tmp);
+
+        fft<DIRECT,T,0>::permute(config,n,tmp,0);
+
+        deinterleave<T>::run(tmp,outRe,outIm,n);
+    }
+    else
+    {
+      status=ARM_MATH_LENGTH_ERROR;
+    }
+
+    return(status);
+}
+
+template<typename T>
+arm_status cifft_split(const T *inRe,const T *inIm,T* tmp,T* outRe,T* outIm,uint16_t n)
+{
+    const cfftconfig<T> *config=cfft_config<T>(n);
+    arm_status status=ARM_MATH_SUCCESS;
+
+    if (config)
+    {
+        const complex<T> *ctmp=(const complex<T> *)tmp;
+        complex<T> a;
+
+        splitfft<INVERSE,T,vector<T>::vector_enabled>::run(config,n,inRe,inIm,tmp);
+
+        fft<INVERSE,T,0>::permute(config,n,tmp,0);
+
+        /* Normalize and deinterleave */
+        for(int i =0; i < n ; i++)
+        {
+           a = ctmp[i] * config->normalization;
+           outRe[i] = a.real();
+           outIm[i] = a.imag();
+        }
+    }
+    else
+    {
+      status=ARM_MATH_LENGTH_ERROR;
+    }
+
+    return(status);
+}
+
 /****
 
 RFFT
@@ -222,4 +366,1087 @@ arm_status rifft(const T *in,T* tmp,T* out, uint16_t n)
 
 
 
-#endif
\ No newline at end of file
+// The spectra of the channels are written one after the other in out
+// (n/2+1 complex samples for each channel)
+template<typename T>
+arm_status rfft_multi(const T *in,T* tmp,T* out, uint16_t n,uint16_t nbChannels)
+{
+    const rfftconfig<T> *rconfig=rfft_config<T>(n);
+    const int halflength = n >> 1;
+    const cfftconfig<T> *config=cfft_config<T>(halflength);
+
+    if (!rconfig || !config)
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+
+    for(int channel=0; channel < nbChannels; channel ++)
+    {
+        const channelloader<T> loader={&in[channel],nbChannels};
+
+        fftload<DIRECT,T,channelloader<T>>::run(config,halflength,loader,(complex<T>*)tmp);
+
+        fft<DIRECT,T,0>::permute(config,halflength,tmp,0);
+
+        rfft_split(rconfig,tmp,&out[channel*(n+2)],n);
+    }
+
+    return(ARM_MATH_SUCCESS);
+}
+
+// Two real FFTs of length n with one CFFT of length n
+// (n is even : the bin n/2 is the Nyquist bin)
+template<typename T>
+arm_status rfft_pair(const T *in1,const T *in2,T* tmp,T* out1,T* out2, uint16_t n)
+{
+    const cfftconfig<T> *config=cfft_config<T>(n);
+    arm_status status=ARM_MATH_SUCCESS;
+
+    if (config && ((n & 1) == 0))
+    {
+        const splitloader<T> loader={in1,in2};
+
+        fftload<DIRECT,T,splitloader<T>>::run(config,n,loader,(complex<T>*)tmp);
+
+        fft<DIRECT,T,0>::permute(config,n,tmp,0);
+
+        rfft_pair_separate(tmp,out1,out2,n);
+    }
+    else
+    {
+      status=ARM_MATH_LENGTH_ERROR;
+    }
+
+    return(status);
+}
+
+
+
+/****
+
+Pruned FFT
+
+*****/
+
+// Include templates for the pruned FFT
+#include "pruned.h"
+
+template<typename T>
+arm_status inner_cfft_pruned(const T *in,T* tmp,T* out, uint16_t n,const prunedbins &bins)
+{
+    const cfftconfig<T> *config=cfft_config<T>(n);
+    const complex<T> *cin=(const complex<T> *)in;
+    complex<T> *ctmp=(complex<T> *)tmp;
+    complex<T> *cout=(complex<T> *)out;
+
+    if (!config)
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+
+    for(uint32_t i = 0; i < bins.nbBins; i++)
+    {
+       if (bins.user(i) >= n)
+       {
+          return(ARM_MATH_ARGUMENT_ERROR);
+       }
+    }
+
+    switch(pruned_algorithm(config,n,bins,n,binsdft<T>::enabled))
+    {
+       case PRUNED_DFT:
+         binsdft<T>::cfft(cin,n,bins,(const complex<T> *)config->twiddle,cout);
+         return(ARM_MATH_SUCCESS);
+       break;
+       case PRUNED_FULL:
+         fft<DIRECT,T,0>::run(config,n,(complex<T>*)cin,ctmp,0);
+       break;
+       default:
+         prunedfft<DIRECT,T>::run(config,n,bins,cin,ctmp);
+       break;
+    }
+
+    for(uint32_t i = 0; i < bins.nbBins; i++)
+    {
+       cout[i] = ctmp[pruned_position(config,n,bins[i])];
+    }
+
+    return(ARM_MATH_SUCCESS);
+}
+
+template<typename T>
+arm_status cfft_pruned(const T *in,T* tmp,T* out, uint16_t n,const uint16_t *bins,uint16_t nbBins)
+{
+    const prunedbins b={bins,0,nbBins,n,false};
+    return(inner_cfft_pruned(in,tmp,out,n,b));
+}
+
+template<typename T>
+arm_status cfft_pruned_range(const T *in,T* tmp,T* out, uint16_t n,uint16_t firstBin,uint16_t nbBins)
+{
+    const prunedbins b={NULL,firstBin,nbBins,n,false};
+    return(inner_cfft_pruned(in,tmp,out,n,b));
+}
+
+// The RFFT bins are between 0 and n/2 (included)
+template<typename T>
+arm_status inner_rfft_pruned(const T *in,T* tmp,T* out, uint16_t n,const prunedbins &bins)
+{
+    const rfftconfig<T> *rconfig=rfft_config<T>(n);
+    const uint32_t halflength = n >> 1;
+    const cfftconfig<T> *config=cfft_config<T>(halflength);
+    complex<T> *ctmp=(complex<T> *)tmp;
+    complex<T> *cout=(complex<T> *)out;
+    const complex<T> *pTwid;
+
+    if (!rconfig || !config)
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+    pTwid=(const complex<T> *)rconfig->twiddle;
+
+    for(uint32_t i = 0; i < bins.nbBins; i++)
+    {
+       if (bins.user(i) > halflength)
+       {
+          return(ARM_MATH_ARGUMENT_ERROR);
+       }
+    }
+
+    switch(pruned_algorithm(config,halflength,bins,halflength,binsdft<T>::enabled))
+    {
+       case PRUNED_DFT:
+         binsdft<T>::rfft(in,n,bins,pTwid,cout);
+         return(ARM_MATH_SUCCESS);
+       break;
+       case PRUNED_FULL:
+         fft<DIRECT,T,0>::run(config,halflength,(complex<T>*)in,ctmp,0);
+       break;
+       default:
+         prunedfft<DIRECT,T>::run(config,halflength,bins,(const complex<T>*)in,ctmp);
+       break;
+    }
+
+    for(uint32_t i = 0; i < bins.nbBins; i++)
+    {
+       const uint32_t k = bins.user(i);
+       const complex<T> a = ctmp[pruned_position(config,halflength,k % halflength)];
+
+       if (k == 0)
+       {
+          cout[i] = complex<T>(a.real() + a.imag(),constant<T>::zero);
+       }
+       else if (k == halflength)
+       {
+          cout[i] = complex<T>(a.real() - a.imag(),constant<T>::zero);
+       }
+       else
+       {
+          const complex<T> b = conjugate(ctmp[pruned_position(config,halflength,halflength - k)]);
+          cout[i] = rfft_split_bin(a,b,pTwid[k]);
+       }
+    }
+
+    return(ARM_MATH_SUCCESS);
+}
+
+template<typename T>
+arm_status rfft_pruned(const T *in,T* tmp,T* out, uint16_t n,const uint16_t *bins,uint16_t nbBins)
+{
+    const prunedbins b={bins,0,nbBins,(uint32_t)(n >> 1),true};
+    return(inner_rfft_pruned(in,tmp,out,n,b));
+}
+
+template<typename T>
+arm_status rfft_pruned_range(const T *in,T* tmp,T* out, uint16_t n,uint16_t firstBin,uint16_t nbBins)
+{
+    const prunedbins b={NULL,firstBin,nbBins,(uint32_t)(n >> 1),true};
+    return(inner_rfft_pruned(in,tmp,out,n,b));
+}
+
+
+
+/****
+
+Sliding DFT
+
+*****/
+
+// Include templates for the sliding DFT
+#include "sdft.h"
+
+template<typename T>
+arm_status sdft_init(sdftstate<T> *S,uint16_t n,const uint16_t *bins,uint16_t nbBins,uint16_t *phase,typename sdftacc<T>::type *acc,T *delay)
+{
+    const cfftconfig<T> *config=cfft_config<T>(n);
+
+    if (!config)
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+
+    for(uint32_t b = 0; b < nbBins; b++)
+    {
+       if (bins[b] >= n)
+       {
+          return(ARM_MATH_ARGUMENT_ERROR);
+       }
+    }
+
+    S->n = n;
+    S->nbBins = nbBins;
+    S->bins = bins;
+    S->twiddle = (const complex<T> *)config->twiddle;
+    S->pos = 0;
+    S->shift = sdftinput<T>::shift(n);
+    S->phase = phase;
+    S->acc = acc;
+    S->delay = delay;
+
+    for(uint32_t b = 0; b < nbBins; b++)
+    {
+       phase[b] = 0;
+       acc[2*b] = constant<typename sdftacc<T>::type>::zero;
+       acc[2*b+1] = constant<typename sdftacc<T>::type>::zero;
+    }
+
+    for(uint32_t i = 0; i < n; i++)
+    {
+       delay[i] = constant<T>::zero;
+    }
+
+    return(ARM_MATH_SUCCESS);
+}
+
+template<typename T>
+void sdft_update(sdftstate<T> *S,const T *in,uint32_t nbSamples)
+{
+    sdft<T>::update(S,in,nbSamples);
+}
+
+template<typename T>
+void sdft_bins(const sdftstate<T> *S,T *out)
+{
+    sdft<T>::bins(S,out);
+}
+
+
+
+/****
+
+Power spectrum
+
+*****/
+
+// Include templates for the power spectrum
+#include "power.h"
+
+template<typename T>
+arm_status power_spectrum(const T *in,const T *window,T* tmp,T* out, uint16_t n)
+{
+    return(inner_power_spectrum<T,0>(in,window,tmp,out,n));
+}
+
+template<typename T>
+arm_status log_power_spectrum(const T *in,const T *window,T* tmp,T* out, uint16_t n)
+{
+    return(inner_power_spectrum<T,1>(in,window,tmp,out,n));
+}
+
+
+
+/****
+
+MFCC
+
+*****/
+
+// Include templates for the dot products
+// (used by the MFCC and the cross-correlation)
+#include "dot.h"
+
+// Include templates for the MFCC
+#include "mfcc.h"
+
+template<typename T>
+arm_status mfcc(const T *in,const T *window,T* tmp,T* out, uint16_t n,uint16_t nbMel,uint16_t nbDct)
+{
+    return(inner_mfcc(in,window,tmp,out,n,nbMel,nbDct));
+}
+
+
+
+/****
+
+Welch
+
+*****/
+
+// Include templates for the Welch estimators
+#include "welch.h"
+
+template<typename T>
+arm_status welch_psd_init(welchstate<T> *S,uint16_t n,uint16_t overlap,const T *window,uint16_t nbThreads,T *segment,T *tmp,T *acc)
+{
+    if (!rfft_config<T>(n) || !cfft_config<T>(n >> 1))
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+
+    if ((overlap >= n) || (nbThreads == 0) || (nbThreads > FFT_MAX_THREADS))
+    {
+      return(ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    welch_init_state(S,n,overlap,window,nbThreads,segment,tmp,acc,welchpsd<T>::accSize(n));
+
+    return(ARM_MATH_SUCCESS);
+}
+
+template<typename T>
+void welch_psd_update(welchstate<T> *S,const T *in,uint32_t nbSamples)
+{
+    welchpsd<T> p = {S,in};
+
+    welch_stream(S,p,nbSamples);
+}
+
+template<typename T>
+arm_status welch_psd(const welchstate<T> *S,T *out)
+{
+    const uint32_t accSize = welchpsd<T>::accSize(S->n);
+    T scale;
+
+    if (S->nbSegments == 0)
+    {
+      return(ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    scale = (T)1.0f / ((T)S->nbSegments * S->windowPower);
+
+    for(uint32_t k = 0; k < accSize; k++)
+    {
+       out[k] = welch_sum(S,accSize,k) * scale;
+    }
+
+    return(ARM_MATH_SUCCESS);
+}
+
+template<typename T>
+arm_status welch_csd_init(welchstate<T> *S,uint16_t n,uint16_t overlap,const T *window,uint16_t nbThreads,T *segment,T *tmp,T *acc)
+{
+    // Like rfft_pair, the separation of X and Y needs an even length
+    if (!cfft_config<T>(n) || (n & 1))
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+
+    if ((overlap >= n) || (nbThreads == 0) || (nbThreads > FFT_MAX_THREADS))
+    {
+      return(ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    welch_init_state(S,n,overlap,window,nbThreads,segment,tmp,acc,welchcsd<T>::accSize(n));
+
+    return(ARM_MATH_SUCCESS);
+}
+
+template<typename T>
+void welch_csd_update(welchstate<T> *S,const T *x,const T *y,uint32_t nbSamples)
+{
+    welchcsd<T> p = {S,x,y};
+
+    welch_stream(S,p,nbSamples);
+}
+
+template<typename T>
+arm_status welch_csd(const welchstate<T> *S,T *out)
+{
+    const uint32_t accSize = welchcsd<T>::accSize(S->n);
+    const uint32_t nbBins = (S->n >> 1) + 1;
+    T scale;
+
+    if (S->nbSegments == 0)
+    {
+      return(ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    scale = (T)1.0f / ((T)S->nbSegments * S->windowPower);
+
+    // Sxy is after Sxx and Syy in the accumulators
+    for(uint32_t k = 0; k < 2*nbBins; k++)
+    {
+       out[k] = welch_sum(S,accSize,2*nbBins + k) * scale;
+    }
+
+    return(ARM_MATH_SUCCESS);
+}
+
+template<typename T>
+arm_status welch_coherence(const welchstate<T> *S,T *out)
+{
+    const uint32_t accSize = welchcsd<T>::accSize(S->n);
+    const uint32_t nbBins = (S->n >> 1) + 1;
+
+    if (S->nbSegments == 0)
+    {
+      return(ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    // The three spectra have the same normalization
+    // which is cancelling in the coherence
+    for(uint32_t k = 0; k < nbBins; k++)
+    {
+       const T sxx = welch_sum(S,accSize,k);
+       const T syy = welch_sum(S,accSize,nbBins + k);
+       const T re = welch_sum(S,accSize,2*nbBins + 2*k);
+       const T im = welch_sum(S,accSize,2*nbBins + 2*k + 1);
+       const T den = sxx * syy;
+
+       out[k] = den > constant<T>::zero ? (re * re + im * im) / den : constant<T>::zero;
+    }
+
+    return(ARM_MATH_SUCCESS);
+}
+
+
+
+/****
+
+Channelizer
+
+*****/
+
+// Include templates for the channelizer
+#include "channelizer.h"
+
+template<typename T>
+arm_status channelizer_init(channelizerstate<T> *S,uint16_t nbChannels,uint16_t nbTaps,uint16_t hop,T *delay,T *tmp)
+{
+    const channelizerconfig<T> *config=channelizer_config<T>(nbChannels,nbTaps);
+    const uint32_t delayLength = 2*((uint32_t)nbChannels * nbTaps + hop);
+
+    if (!config || !cfft_config<T>(nbChannels))
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+
+    if ((hop == 0) || (hop > nbChannels))
+    {
+      return(ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    S->config = config;
+    S->hop = hop;
+    S->pos = 0;
+    S->phase = 0;
+    S->delay = delay;
+    S->tmp = tmp;
+
+    for(uint32_t i = 0; i < delayLength; i++)
+    {
+       delay[i] = constant<T>::zero;
+    }
+
+    return(ARM_MATH_SUCCESS);
+}
+
+template<typename T>
+uint32_t channelizer(channelizerstate<T> *S,const T *in,uint32_t nbSamples,T *out)
+{
+    return(inner_channelizer(S,in,nbSamples,out));
+}
+
+
+
+/****
+
+Resampler
+
+*****/
+
+// Include templates for the resampler
+#include "resampler.h"
+
+template<typename T>
+arm_status resampler_init(resamplerstate<T> *S,uint16_t nIn,uint16_t nOut,uint16_t overlap,uint16_t transition,T *gain,T *frame,T *spectrum,T *tmp)
+{
+    const uint32_t hopIn = nIn - overlap;
+    const uint32_t nbBins = (nIn < nOut ? nIn : nOut) >> 1;
+    const float32_t scale = (float32_t)nOut / (float32_t)nIn;
+    uint32_t hopOut;
+
+    if (!rfft_config<T>(nIn) || !rfft_config<T>(nOut))
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+
+    if ((overlap >= nIn) || (overlap & 1) || (transition == 0) || (transition > nbBins))
+    {
+      return(ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    // The output hop must be an integer and the discarded output
+    // samples must be split evenly between the start and end of a frame
+    if ((hopIn * nOut) % nIn != 0)
+    {
+      return(ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    hopOut = (hopIn * nOut) / nIn;
+    if ((nOut - hopOut) & 1)
+    {
+      return(ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    S->nIn = nIn;
+    S->nOut = nOut;
+    S->hopIn = hopIn;
+    S->hopOut = hopOut;
+    S->nbBins = nbBins;
+    S->gain = gain;
+    S->frame = frame;
+    S->spectrum = spectrum;
+    S->tmp = tmp;
+
+    // Raised cosine on the last transition bins.
+    // The spectrum is also scaled to keep the amplitude
+    // of the signal with the RIFFT of length nOut.
+    for(uint32_t k = 0; k <= nbBins; k++)
+    {
+       if (k + transition <= nbBins)
+       {
+          gain[k] = (T)scale;
+       }
+       else
+       {
+          const float32_t x = (float32_t)(k + transition - nbBins) / (float32_t)transition;
+          gain[k] = (T)(0.5f * scale * (1.0f + cosf(PI * x)));
+       }
+    }
+
+    // Half of the overlap is history before the first sample so that
+    // the output sample i is at the time of the input sample i*nIn/nOut
+    S->pos = overlap >> 1;
+    for(uint32_t i = 0; i < S->pos; i++)
+    {
+       frame[i] = constant<T>::zero;
+    }
+
+    return(ARM_MATH_SUCCESS);
+}
+
+template<typename T>
+uint32_t resampler(resamplerstate<T> *S,const T *in,uint32_t nbSamples,T *out)
+{
+    return(inner_resampler(S,in,nbSamples,out));
+}
+
+
+
+/****
+
+Analytic signal
+
+*****/
+
+// Include templates for the analytic signal
+#include "analytic.h"
+
+template<typename T>
+arm_status analytic_signal(const T *in,T* tmp,T* out, uint16_t n)
+{
+    const cfftconfig<T> *config=cfft_config<T>(n);
+
+    if (!config)
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+
+    analyticfft<T,vector<T>::vector_enabled>::run(config,n,in,tmp,out);
+
+    return(ARM_MATH_SUCCESS);
+}
+
+template<typename T>
+arm_status hilbert(const T *in,T* tmp,T* out, uint16_t n)
+{
+    T *analytic = tmp + 2*n;
+    arm_status status;
+
+    status=analytic_signal(in,tmp,analytic,n);
+    if (status != ARM_MATH_SUCCESS)
+    {
+      return(status);
+    }
+
+    for(uint32_t i = 0; i < n; i++)
+    {
+       out[i] = analytic[2*i+1];
+    }
+
+    return(ARM_MATH_SUCCESS);
+}
+
+
+
+/****
+
+Plans
+
+*****/
+
+// Include templates for the plans
+#include "plan.h"
+
+template<typename T>
+arm_status fft_plan_cfft(fftplan<T> *plan,uint16_t n,uint8_t inverse)
+{
+    if (!cfft_config<T>(n))
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+
+    plan->kind = inverse ? FFT_PLAN_CIFFT : FFT_PLAN_CFFT;
+    plan->n = n;
+    plan->m = 1;
+    plan->scratchSize = 0;
+    plan->run = inverse ? plancfft<T,INVERSE>::run : plancfft<T,DIRECT>::run;
+
+    return(ARM_MATH_SUCCESS);
+}
+
+template<typename T>
+arm_status fft_plan_cfft2D(fftplan<T> *plan,uint16_t rows,uint16_t cols,uint8_t inverse)
+{
+    if (!cfft_config<T>(rows) || !cfft_config<T>(cols))
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+
+    plan->kind = inverse ? FFT_PLAN_CIFFT2D : FFT_PLAN_CFFT2D;
+    plan->n = rows;
+    plan->m = cols;
+    plan->scratchSize = 0;
+    plan->run = inverse ? plancfft2D<T,INVERSE>::run : plancfft2D<T,DIRECT>::run;
+
+    return(ARM_MATH_SUCCESS);
+}
+
+template<typename T>
+arm_status fft_plan_rfft(fftplan<T> *plan,uint16_t n,uint8_t inverse)
+{
+    if (!rfft_config<T>(n) || !cfft_config<T>(n >> 1))
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+
+    plan->kind = inverse ? FFT_PLAN_RIFFT : FFT_PLAN_RFFT;
+    plan->n = n;
+    plan->m = 1;
+    // tmp buffer of rfft and rifft
+    plan->scratchSize = n;
+    plan->run = inverse ? planrfft<T,INVERSE>::run : planrfft<T,DIRECT>::run;
+
+    return(ARM_MATH_SUCCESS);
+}
+
+template<typename T>
+uint32_t fft_scratch_size(const fftplan<T> *plan)
+{
+    return(plan->scratchSize);
+}
+
+template<typename T>
+arm_status fft_execute(const fftplan<T> *plan,const T *in,T* out,T *scratch,uint32_t scratchSize)
+{
+    if (scratchSize < plan->scratchSize)
+    {
+      return(ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    return(plan->run(plan,in,out,scratch));
+}
+
+
+/****
+
+Spectrum operations
+
+*****/
+
+// Include templates for the pointwise operations on spectra
+#include "spectrum.h"
+
+template<typename T>
+void spectrum_mul(const T *a,const T *b,T* out, uint32_t nbBins)
+{
+    spectrumloop<T,SPECTRUM_MUL,vector<T>::vector_enabled>::run(a,b,out,nbBins);
+}
+
+template<typename T>
+void spectrum_mulconj(const T *a,const T *b,T* out, uint32_t nbBins)
+{
+    spectrumloop<T,SPECTRUM_MULCONJ,vector<T>::vector_enabled>::run(a,b,out,nbBins);
+}
+
+template<typename T>
+void spectrum_mac(const T *a,const T *b,T* acc, uint32_t nbBins)
+{
+    spectrumloop<T,SPECTRUM_MAC,vector<T>::vector_enabled>::run(a,b,acc,nbBins);
+}
+
+
+/****
+
+Mixed precision FFT
+
+*****/
+
+// Include templates for float16_t storage and float32_t computations
+// and for Q31 samples with Q15 twiddles
+#include "mixed.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED) || defined(FUNC_CFFT_Q31MIX)
+template<typename T>
+arm_status cfft_mixed(const T *in,T* out, uint16_t n)
+{
+    return(inner_cfft_mixed<DIRECT>(in,out,n));
+}
+
+template<typename T>
+arm_status cifft_mixed(const T *in,T* out, uint16_t n)
+{
+    return(inner_cfft_mixed<INVERSE>(in,out,n));
+}
+
+template<typename T>
+arm_status rfft_mixed(const T *in,T* tmp,T* out, uint16_t n)
+{
+    const rfftconfig<typename mixedconfig<T>::type> *config=rfft_config<typename mixedconfig<T>::type>(n);
+    arm_status status=ARM_MATH_SUCCESS;
+
+    if (config)
+    {
+        status=inner_cfft_mixed<DIRECT>(in,tmp,n>>1);
+        if (status == ARM_MATH_SUCCESS)
+        {
+            rfft_split_mixed(config,tmp,out,n);
+        }
+    }
+    else
+    {
+      status=ARM_MATH_LENGTH_ERROR;
+    }
+
+    return(status);
+}
+
+template<typename T>
+arm_status rifft_mixed(const T *in,T* tmp,T* out, uint16_t n)
+{
+    const rfftconfig<typename mixedconfig<T>::type> *config=rfft_config<typename mixedconfig<T>::type>(n);
+    arm_status status=ARM_MATH_SUCCESS;
+
+    if (config)
+    {
+        rfft_merge_mixed(config,in,tmp,n);
+        status=inner_cfft_mixed<INVERSE>(tmp,out,n>>1);
+    }
+    else
+    {
+      status=ARM_MATH_LENGTH_ERROR;
+    }
+
+    return(status);
+}
+#endif
+
+
+/****
+
+Zoom FFT
+
+*****/
+
+// Include templates for the zoom FFT
+#include "zoom.h"
+
+template<typename T>
+arm_status zoom_fft_init(zoomstate<T> *S,float32_t center,uint16_t decimation,uint16_t nbTaps,uint16_t N,const T *window,T *coefs,T *delay,T *frame)
+{
+    const uint32_t length = (uint32_t)decimation * nbTaps;
+    const float32_t middle = 0.5f * (float32_t)(length - 1);
+    float32_t sum = 0.0f;
+
+    if (!cfft_config<T>(N))
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+
+    if ((decimation == 0) || (nbTaps == 0) || (length > 0xFFFF) ||
+        (center < -0.5f) || (center > 0.5f))
+    {
+      return(ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    S->decimation = decimation;
+    S->n = N;
+    S->length = length;
+    S->pos = 0;
+    S->nbFrame = 0;
+    S->window = window;
+    S->coefs = coefs;
+    S->delay = delay;
+    S->frame = frame;
+    S->oscRe = 1.0f;
+    S->oscIm = 0.0f;
+    S->stepRe = cosf(2.0f * PI * center * decimation);
+    S->stepIm = -sinf(2.0f * PI * center * decimation);
+
+    // Lowpass filter with a cutoff at 1/(2 decimation) (Blackman
+    // window) normalized for a unity gain at the center frequency
+    for(uint32_t l = 0; l < length; l++)
+    {
+       sum += zoom_lowpass(l,length,middle,decimation);
+    }
+
+    // Coefficients in reversed order : coefs[j] is applied to
+    // the sample delayed by l = length - 1 - j
+    for(uint32_t j = 0; j < length; j++)
+    {
+       const uint32_t l = length - 1 - j;
+       const float32_t h = zoom_lowpass(l,length,middle,decimation) / sum;
+
+       coefs[j] = (T)(h * cosf(2.0f * PI * center * l));
+       coefs[length + j] = (T)(h * sinf(2.0f * PI * center * l));
+    }
+
+    for(uint32_t i = 0; i < length + decimation; i++)
+    {
+       delay[i] = constant<T>::zero;
+    }
+
+    return(ARM_MATH_SUCCESS);
+}
+
+template<typename T>
+uint32_t zoom_fft(zoomstate<T> *S,const T *in,uint32_t nbSamples,T *out)
+{
+    return(inner_zoom_fft(S,in,nbSamples,out));
+}
+
+/****
+
+Cross-correlation
+
+*****/
+
+// Include templates for the cross-correlation
+#include "xcorr.h"
+
+template<typename T>
+void xcorr(const T *x,uint16_t nx,const T *y,uint16_t ny,int32_t firstLag,uint16_t nbLags,T *tmp,T *out,uint16_t n)
+{
+    inner_xcorr(x,nx,y,ny,firstLag,nbLags,tmp,out,n);
+}
+
+template<typename T>
+void autocorr(const T *x,uint16_t nx,uint16_t nbLags,T *tmp,T *out,uint16_t n)
+{
+    inner_xcorr(x,nx,x,nx,0,nbLags,tmp,out,n);
+}
+
+template<typename T>
+arm_status xcorr_stream_init(xcorrstate<T> *S,const T *y,uint16_t m,uint16_t n,T *spectrum,T *segment,T *tmp)
+{
+    const rfftconfig<T> *rconfig=rfft_config<T>(n);
+
+    if (!rconfig)
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+
+    if ((m == 0) || (m > n))
+    {
+      return(ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    S->n = n;
+    S->m = m;
+    S->pos = 0;
+    S->spectrum = spectrum;
+    S->segment = segment;
+    S->tmp = tmp;
+
+    xcorr_spectrum(rconfig,y,m,tmp,spectrum,n);
+
+    return(ARM_MATH_SUCCESS);
+}
+
+template<typename T>
+uint32_t xcorr_stream(xcorrstate<T> *S,const T *in,uint32_t nbSamples,T *out)
+{
+    return(inner_xcorr_stream(S,in,nbSamples,out));
+}
+
+/****
+
+FFT jobs scheduler
+
+*****/
+
+// Include the worker threads of the scheduler
+#include "scheduler.h"
+
+template<typename T>
+void fft_job_init(fftjob *job,const fftplan<T> *plan,const T *in,T *out,fftjobcallback callback,void *context)
+{
+    job->plan = plan;
+    job->execute = fft_job_execute<T>;
+    job->in = in;
+    job->out = out;
+    job->callback = callback;
+    job->context = context;
+    job->status = ARM_MATH_SUCCESS;
+    job->done = 0;
+    job->next = NULL;
+}
+
+arm_status fft_scheduler_init(fftscheduler *S,uint32_t nbWorkers,void *scratch,uint32_t scratchBytes)
+{
+    if ((nbWorkers == 0) || (nbWorkers > FFT_SCHEDULER_MAX_WORKERS))
+    {
+      return(ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    S->submitted = NULL;
+    S->nbWorkers = 0;
+    S->scratchBytes = scratchBytes;
+    S->stopping = 0;
+
+    for(uint32_t i = 0; i < nbWorkers; i++)
+    {
+       S->workers[i].scheduler = S;
+       S->workers[i].id = i;
+       S->workers[i].scratch = (uint8_t *)scratch + i * scratchBytes;
+       S->workers[i].head = NULL;
+       S->workers[i].tail = NULL;
+    }
+
+#if defined(FFT_THREADS)
+    sem_init(&S->wake,0,0);
+    pthread_mutex_init(&S->doneLock,NULL);
+    pthread_cond_init(&S->doneCond,NULL);
+    pthread_mutex_init(&S->callerLock,NULL);
+
+    // The workers are started after the initialization of all the
+    // queues since they can steal from each other.
+    // If a thread cannot be created, the pool is smaller and if none
+    // can be created the jobs are executed by the caller.
+    for(uint32_t i = 0; i < nbWorkers; i++)
+    {
+       pthread_mutex_init(&S->workers[i].lock,NULL);
+    }
+
+    for(uint32_t i = 0; i < nbWorkers; i++)
+    {
+       const uint32_t id = S->nbWorkers;
+
+       if (pthread_create(&S->workers[id].thread,NULL,fft_worker_entry,&S->workers[id]) == 0)
+       {
+          __atomic_store_n(&S->nbWorkers,id + 1,__ATOMIC_RELEASE);
+       }
+    }
+#endif
+
+    return(ARM_MATH_SUCCESS);
+}
+
+void fft_scheduler_submit(fftscheduler *S,fftjob *job)
+{
+    job->done = 0;
+
+#if defined(FFT_THREADS)
+    if (S->nbWorkers > 0)
+    {
+       fftjob *head = __atomic_load_n(&S->submitted,__ATOMIC_RELAXED);
+
+       do
+       {
+          job->next = head;
+       } while(!__atomic_compare_exchange_n(&S->submitted,&head,job,true,__ATOMIC_RELEASE,__ATOMIC_RELAXED));
+
+       sem_post(&S->wake);
+       return;
+    }
+
+    // No worker : the callers are executing their jobs with the
+    // same scratch so they are serialized.
+    job->next = NULL;
+    pthread_mutex_lock(&S->callerLock);
+    fft_scheduler_run(S,S->workers[0].scratch,job);
+    pthread_mutex_unlock(&S->callerLock);
+#else
+    job->next = NULL;
+    fft_scheduler_run(S,S->workers[0].scratch,job);
+#endif
+}
+
+uint32_t fft_job_done(const fftjob *job)
+{
+#if defined(FFT_THREADS)
+    return(__atomic_load_n(&job->done,__ATOMIC_ACQUIRE));
+#else
+    return(job->done);
+#endif
+}
+
+void fft_job_wait(fftscheduler *S,fftjob *job)
+{
+#if defined(FFT_THREADS)
+    pthread_mutex_lock(&S->doneLock);
+    while(!job->done)
+    {
+       pthread_cond_wait(&S->doneCond,&S->doneLock);
+    }
+    pthread_mutex_unlock(&S->doneLock);
+#else
+    (void)S;
+    (void)job;
+#endif
+}
+
+// The jobs submitted before are executed before the workers stop
+void fft_scheduler_stop(fftscheduler *S)
+{
+#if defined(FFT_THREADS)
+    const uint32_t nbWorkers = S->nbWorkers;
+
+    __atomic_store_n(&S->stopping,1,__ATOMIC_RELEASE);
+    for(uint32_t i = 0; i < nbWorkers; i++)
+    {
+       sem_post(&S->wake);
+    }
+
+    for(uint32_t i = 0; i < nbWorkers; i++)
+    {
+       pthread_join(S->workers[i].thread,NULL);
+    }
+
+    for(uint32_t i = 0; i < nbWorkers; i++)
+    {
+       pthread_mutex_destroy(&S->workers[i].lock);
+    }
+    pthread_cond_destroy(&S->doneCond);
+    pthread_mutex_destroy(&S->doneLock);
+    pthread_mutex_destroy(&S->callerLock);
+    sem_destroy(&S->wake);
+    S->nbWorkers = 0;
+#else
+    (void)S;
+#endif
+}
+
+
+#endif
\ No newline at end of file
@@ -38,8 +38,26 @@ Indirectly include by clients when fft.h is included
 // No saturation when narrowing
 #define NOSAT 1
 
+// When defined, the duration of each group of stages and of the
+// permutation is reported to the sink registered with fft_profile_register
+//#define FFT_PROFILING 1
+
+// When defined (Linux only), the segments of the Welch estimators,
+// the planes of the CFFT 3D and the jobs of the FFT scheduler
+// are spread across pthreads
+//#define FFT_THREADS 1
+
+// When defined, the NORMAL stages with many small groups are computed
+// group after group with a pre-expanded table of twiddles (grouploop.h)
+//#define FFT_GROUP_MAJOR 1
+
 #include <arm_math_types.h>
 
+#if defined(FFT_THREADS)
+#include <pthread.h>
+#include <semaphore.h>
+#endif
+
 #define  __FORCE_INLINE __attribute__((always_inline)) __INLINE
 
 
@@ -49,6 +67,44 @@ Indirectly include by clients when fft.h is included
 #include "complex.h"
 #include "fixedpoint.h"
 
+#if defined(ARM_FLOAT16_SUPPORTED)
+/*
+
+Sample type of the mixed precision FFTs : the samples and the twiddles
+are stored as float16_t and the butterflies are computed with float32_t.
+It has the layout of a float16_t.
+
+*/
+struct float16mix_t{
+   float16_t v;
+};
+#endif
+
+/*
+
+Sample type of the reduced table Q31 FFTs : the samples are Q31 and
+the twiddles are Q15 (the Q15 tables are used).
+It has the layout of a Q31.
+
+*/
+struct q31mix_t{
+   FFTSCI::Q31 v;
+};
+
+// Type of the twiddles for a sample type
+template<typename T>
+struct TWIDDLETYPE {
+   typedef T type;
+};
+
+template<>
+struct TWIDDLETYPE<q31mix_t> {
+   typedef FFTSCI::Q15 type;
+};
+
+template<typename T>
+using TWID = typename TWIDDLETYPE<T>::type;
+
 /*
 
 CFFT Configuration structure
@@ -63,7 +119,7 @@ struct cfftconfig {
    const uint16_t *perms;
    // Pointer to Twiddle with number of twiddles
    uint16_t nbTwiddle;
-   const T *twiddle;
+   const TWID<T> *twiddle;
    // Pointer to factors with number of different factors
    // and group of factors.
    uint16_t nbGroupedFactors;
@@ -91,20 +147,423 @@ struct rfftconfig {
 };
 
 
+/*
+
+Plan : transform executed with a scratch arena owned by the caller
+
+*/
+#define FFT_PLAN_CFFT 0
+#define FFT_PLAN_CIFFT 1
+#define FFT_PLAN_CFFT2D 2
+#define FFT_PLAN_CIFFT2D 3
+#define FFT_PLAN_RFFT 4
+#define FFT_PLAN_RIFFT 5
+
+template<typename T>
+struct fftplan {
+   // FFT_PLAN_CFFT ...
+   uint16_t kind;
+   // Length (rows and columns for the 2D transforms)
+   uint16_t n;
+   uint16_t m;
+   // Number of samples of scratch needed by the execution
+   uint32_t scratchSize;
+   arm_status (*run)(const fftplan<T> *plan,const T *in,T *out,T *scratch);
+};
+
+/*
+
+Sliding DFT state
+
+*/
+
+// Type of the sliding DFT accumulators (type of a product)
+template<typename T>
+struct sdftacc {
+   typedef T type;
+};
+
+template<>
+struct sdftacc<FFTSCI::Q31> {
+   typedef FFTSCI::Q63 type;
+};
+
+template<>
+struct sdftacc<FFTSCI::Q15> {
+   typedef FFTSCI::Q31 type;
+};
+
+template<>
+struct sdftacc<FFTSCI::Q7> {
+   typedef FFTSCI::Q15 type;
+};
+
+template<typename T>
+struct sdftstate {
+   // Length of the sliding window
+   uint16_t n;
+   // Tracked bins
+   uint16_t nbBins;
+   const uint16_t *bins;
+   // Twiddles of the CFFT of length n
+   const complex<T> *twiddle;
+   // Position in the delay line
+   uint16_t pos;
+   // Input shift for fixed point
+   // (output bins are the DFT divided by 2^shift)
+   int16_t shift;
+   // Current twiddle index of each bin (nbBins values)
+   uint16_t *phase;
+   // Complex accumulators (2*nbBins values)
+   typename sdftacc<T>::type *acc;
+   // Last n input samples
+   T *delay;
+};
+
+/*
+
+Welch state (PSD and CSD)
+
+*/
+template<typename T>
+struct welchstate {
+   // Length of a segment and overlap between segments
+   uint16_t n;
+   uint16_t overlap;
+   // Window (NULL for rectangular) and sum of its squares
+   const T *window;
+   T windowPower;
+   // Number of threads (scratch and accumulators for each)
+   uint16_t nbThreads;
+   // Start of the next segment (n values for PSD, 2n for CSD)
+   T *segment;
+   uint16_t pos;
+   // Number of accumulated segments
+   uint32_t nbSegments;
+   // Scratch and accumulators of the threads
+   T *tmp;
+   T *acc;
+};
+
+/*
+
+MFCC Configuration structure
+
+*/
+template<typename T>
+struct mfccconfig {
+   // Length of the RFFT
+   uint16_t fftLen;
+   // Number of mel filters and of DCT outputs
+   uint16_t nbMel;
+   uint16_t nbDct;
+   // First bin and number of nonzero weights of each mel filter
+   const uint16_t *filterPos;
+   const uint16_t *filterLengths;
+   // Nonzero weights of all the mel filters
+   const T *filterCoefs;
+   // DCT matrix (nbDct rows of nbMel values)
+   const T *dct;
+};
+
+/*
+
+Channelizer Configuration structure and state
+
+*/
+template<typename T>
+struct channelizerconfig {
+   // Number of channels (length of the CFFT)
+   uint16_t nbChannels;
+   // Number of taps of each polyphase branch
+   uint16_t nbTaps;
+   // Prototype filter (nbChannels * nbTaps values) in reversed order
+   const T *coefs;
+};
+
+template<typename T>
+struct channelizerstate {
+   const channelizerconfig<T> *config;
+   // Number of input samples between two outputs
+   uint16_t hop;
+   // Number of samples of the next hop already in the delay line
+   uint16_t pos;
+   // Number of input samples modulo the number of channels
+   uint16_t phase;
+   // Delay line (nbChannels * nbTaps + hop complex values)
+   T *delay;
+   // Outputs of the polyphase branches (nbChannels complex values)
+   T *tmp;
+};
+
+/*
+
+Zoom FFT state
+
+*/
+template<typename T>
+struct zoomstate {
+   // Decimation factor (zoom factor) and length of the CFFT
+   uint16_t decimation;
+   uint16_t n;
+   // Number of taps of the decimation filter
+   uint16_t length;
+   // Number of samples of the next decimation already in the delay line
+   uint16_t pos;
+   // Number of decimated samples in the frame
+   uint16_t nbFrame;
+   // Window of the frames (n values) or NULL
+   const T *window;
+   // Decimation filter shifted to the center frequency
+   // (length real parts followed by length imaginary parts)
+   T *coefs;
+   // Delay line (length + decimation values)
+   T *delay;
+   // Decimated samples of the frame (n complex values)
+   T *frame;
+   // Oscillator at the decimated rate and its step
+   float32_t oscRe;
+   float32_t oscIm;
+   float32_t stepRe;
+   float32_t stepIm;
+};
+
+/*
+
+Streaming cross-correlation state
+
+*/
+template<typename T>
+struct xcorrstate {
+   // Length of the RFFT and of the template
+   uint16_t n;
+   uint16_t m;
+   // Number of samples in the segment
+   uint16_t pos;
+   // Spectrum of the template (n+2 values)
+   T *spectrum;
+   // Segment of the stream (n values)
+   T *segment;
+   // Scratch (2n+2 values)
+   T *tmp;
+};
+
+/*
+
+Resampler state
+
+*/
+template<typename T>
+struct resamplerstate {
+   // Lengths of the input and output frames (RFFT lengths)
+   uint16_t nIn;
+   uint16_t nOut;
+   // Number of new samples for each frame (input and output)
+   uint16_t hopIn;
+   uint16_t hopOut;
+   // Number of samples in the input frame
+   uint16_t pos;
+   // Number of kept bins (min(nIn,nOut)/2) and their gain (nbBins+1 values)
+   uint16_t nbBins;
+   T *gain;
+   // Input frame (nIn), spectrum (nIn+2) and scratch (max(nIn,nOut))
+   T *frame;
+   T *spectrum;
+   T *tmp;
+};
+
+/*
+
+Profiling (when FFT_PROFILING is defined)
+
+*/
+
+// Datatype of the profiled FFT
+#define FFT_PROFILE_F64 0
+#define FFT_PROFILE_F32 1
+#define FFT_PROFILE_F16 2
+#define FFT_PROFILE_Q31 3
+#define FFT_PROFILE_Q15 4
+#define FFT_PROFILE_Q7 5
+
+// Stages of the FFT in a profiled step
+// (a group of stages may contain the first and the last stages)
+#define FFT_PROFILE_NORMAL 0
+#define FFT_PROFILE_FIRST 1
+#define FFT_PROFILE_LAST 2
+#define FFT_PROFILE_BITREVERSAL 4
+
+struct fftprofileevent {
+   // Configuration of the FFT (to identify the transform)
+   const void *config;
+   // Length of the FFT
+   uint16_t n;
+   // FFT_PROFILE_F32 ...
+   uint8_t datatype;
+   // Direct (0) or inverse (1) FFT
+   uint8_t inverse;
+   // Index of the group of stages (-1 for the permutation)
+   int16_t stageGroup;
+   // Radix and number of stages of the group
+   uint16_t factor;
+   uint16_t nbStages;
+   // FFT_PROFILE_NORMAL, FFT_PROFILE_FIRST | FFT_PROFILE_LAST or
+   // FFT_PROFILE_BITREVERSAL
+   uint16_t stageMode;
+   // In cycles or ns (depending on FFT_PROFILE_CLOCK)
+   uint32_t duration;
+};
+
+typedef void (*fftprofilesink)(const fftprofileevent *event,void *context);
+
+/*
+
+FFT jobs and scheduler
+
+*/
+
+// Maximum number of workers of a scheduler
+#define FFT_SCHEDULER_MAX_WORKERS 16
+
+struct fftjob;
+
+// Called by the worker when the job has been executed
+typedef void (*fftjobcallback)(fftjob *job,void *context);
+
+struct fftjob {
+   // Plan (of any datatype) and its execution
+   const void *plan;
+   arm_status (*execute)(const void *plan,const void *in,void *out,void *scratch,uint32_t scratchBytes);
+   const void *in;
+   void *out;
+   // Callback (can be NULL) and its context
+   fftjobcallback callback;
+   void *context;
+   // Status of the execution (valid when done is set)
+   arm_status status;
+   uint32_t done;
+   // Used by the scheduler (submission queue, batches)
+   fftjob *next;
+   fftjob *nextBatch;
+   fftjob *prevBatch;
+   fftjob *batchLast;
+   uint32_t batchSize;
+};
+
+struct fftscheduler;
+
+struct fftworker {
+   fftscheduler *scheduler;
+   uint32_t id;
+   // Scratch of the worker
+   void *scratch;
+   // Queue of batches (head is the oldest one)
+   fftjob *head;
+   fftjob *tail;
+#if defined(FFT_THREADS)
+   pthread_t thread;
+   pthread_mutex_t lock;
+#endif
+};
+
+struct fftscheduler {
+   // Lock-free stack of the submitted jobs
+   fftjob *submitted;
+   // Number of started workers (0 when the jobs are executed by the caller)
+   uint32_t nbWorkers;
+   // Bytes of scratch of each worker
+   uint32_t scratchBytes;
+   uint32_t stopping;
+   fftworker workers[FFT_SCHEDULER_MAX_WORKERS];
+#if defined(FFT_THREADS)
+   // Posted when jobs are submitted or batches can be stolen
+   sem_t wake;
+   // Signaled when jobs are done
+   pthread_mutex_t doneLock;
+   pthread_cond_t doneCond;
+   // Jobs executed by the callers (no worker) share the first scratch
+   pthread_mutex_t callerLock;
+#endif
+};
+
 /*
 
 Interfaces
 
 */
+#if defined(FFT_PROFILING)
+// NULL sink to disable the reporting
+void fft_profile_register(fftprofilesink sink,void *context);
+#endif
+
+// scratch has nbWorkers * scratchBytes bytes
+arm_status fft_scheduler_init(fftscheduler *S,uint32_t nbWorkers,void *scratch,uint32_t scratchBytes);
+void fft_scheduler_submit(fftscheduler *S,fftjob *job);
+void fft_scheduler_stop(fftscheduler *S);
+void fft_job_wait(fftscheduler *S,fftjob *job);
+uint32_t fft_job_done(const fftjob *job);
+
+template<typename T>
+void fft_job_init(fftjob *job,const fftplan<T> *plan,const T *in,T *out,fftjobcallback callback,void *context);
+
 template<typename T>
 const cfftconfig<T> *cfft_config(uint32_t nbSamples);
 
 template<typename T>
 const rfftconfig<T> *rfft_config(uint32_t nbSamples);
 
+/*
+
+Search of a configuration in the tables generated by configgen.py.
+lengths is sorted and configs[i] is the configuration for lengths[i].
+The search is a binary search where the comparison is only used to select
+the next base : the loop has a fixed number of iterations for a given nb.
+
+*/
+template<typename C>
+const C *fft_config_search(const uint16_t *lengths,const C *configs,uint32_t nb,uint32_t nbSamples)
+{
+    uint32_t base = 0;
+
+    if (nb == 0)
+    {
+       return(NULL);
+    }
+
+    while (nb > 1)
+    {
+       const uint32_t half = nb >> 1;
+       base = (lengths[base + half] <= nbSamples) ? base + half : base;
+       nb -= half;
+    }
+
+    return((lengths[base] == nbSamples) ? &configs[base] : NULL);
+}
+
+template<typename T>
+const mfccconfig<T> *mfcc_config(uint32_t fftLen,uint32_t nbMel,uint32_t nbDct);
+
+template<typename T>
+const channelizerconfig<T> *channelizer_config(uint32_t nbChannels,uint32_t nbTaps);
+
 template<typename T>
 arm_status cfft(const T *in,T* out, uint16_t N);
 
+template<typename T>
+arm_status fft_plan_cfft(fftplan<T> *plan,uint16_t N,uint8_t inverse);
+
+template<typename T>
+arm_status fft_plan_cfft2D(fftplan<T> *plan,uint16_t rows,uint16_t cols,uint8_t inverse);
+
+template<typename T>
+arm_status fft_plan_rfft(fftplan<T> *plan,uint16_t N,uint8_t inverse);
+
+template<typename T>
+uint32_t fft_scratch_size(const fftplan<T> *plan);
+
+template<typename T>
+arm_status fft_execute(const fftplan<T> *plan,const T *in,T* out,T *scratch,uint32_t scratchSize);
+
 template<typename T>
 arm_status cifft(const T *in,T* out, uint16_t N);
 
@@ -114,12 +573,154 @@ arm_status cfft2D(const T *in,T* out, uint16_t rows,uint16_t cols);
 template<typename T>
 arm_status cifft2D(const T *in,T* out, uint16_t rows,uint16_t cols);
 
+// Volume depth x rows x cols. nbThreads is only used when FFT_THREADS is defined
+template<typename T>
+arm_status cfft3D(const T *in,T* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+template<typename T>
+arm_status cifft3D(const T *in,T* out, uint16_t depth,uint16_t rows,uint16_t cols,uint16_t nbThreads);
+
+template<typename T>
+arm_status cfft_multi(const T *in,T* out, uint16_t N,uint16_t nbChannels);
+
+template<typename T>
+arm_status cifft_multi(const T *in,T* out, uint16_t N,uint16_t nbChannels);
+
+template<typename T>
+arm_status rfft_multi(const T *in,T* tmp,T* out, uint16_t N,uint16_t nbChannels);
+
+template<typename T>
+void complex_interleave(const T *re,const T *im,T* out, uint32_t n);
+
+template<typename T>
+void complex_deinterleave(const T *in,T *re,T* im, uint32_t n);
+
+// Spectra of nbBins complex values (n/2+1 for a rfft of length n)
+template<typename T>
+void spectrum_mul(const T *a,const T *b,T* out, uint32_t nbBins);
+
+template<typename T>
+void spectrum_mulconj(const T *a,const T *b,T* out, uint32_t nbBins);
+
+template<typename T>
+void spectrum_mac(const T *a,const T *b,T* acc, uint32_t nbBins);
+
+template<typename T>
+arm_status cfft_split(const T *inRe,const T *inIm,T* tmp,T* outRe,T* outIm,uint16_t N);
+
+template<typename T>
+arm_status cifft_split(const T *inRe,const T *inIm,T* tmp,T* outRe,T* outIm,uint16_t N);
+
 template<typename T>
 arm_status rfft(const T *in,T* tmp,T* out, uint16_t N);
 
 template<typename T>
 arm_status rifft(const T *in,T* tmp,T* out, uint16_t N);
 
+// Mixed precision : float16_t storage and float32_t computations,
+// or Q31 samples and Q15 twiddles (Q31)
+template<typename T>
+arm_status cfft_mixed(const T *in,T* out, uint16_t N);
+
+template<typename T>
+arm_status cifft_mixed(const T *in,T* out, uint16_t N);
+
+template<typename T>
+arm_status rfft_mixed(const T *in,T* tmp,T* out, uint16_t N);
+
+template<typename T>
+arm_status rifft_mixed(const T *in,T* tmp,T* out, uint16_t N);
+
+template<typename T>
+arm_status analytic_signal(const T *in,T* tmp,T* out, uint16_t N);
+
+template<typename T>
+arm_status hilbert(const T *in,T* tmp,T* out, uint16_t N);
+
+template<typename T>
+arm_status rfft_pair(const T *in1,const T *in2,T* tmp,T* out1,T* out2, uint16_t N);
+
+template<typename T>
+arm_status cfft_pruned(const T *in,T* tmp,T* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+
+template<typename T>
+arm_status cfft_pruned_range(const T *in,T* tmp,T* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+template<typename T>
+arm_status rfft_pruned(const T *in,T* tmp,T* out, uint16_t N,const uint16_t *bins,uint16_t nbBins);
+
+template<typename T>
+arm_status rfft_pruned_range(const T *in,T* tmp,T* out, uint16_t N,uint16_t firstBin,uint16_t nbBins);
+
+template<typename T>
+arm_status sdft_init(sdftstate<T> *S,uint16_t N,const uint16_t *bins,uint16_t nbBins,uint16_t *phase,typename sdftacc<T>::type *acc,T *delay);
+
+template<typename T>
+void sdft_update(sdftstate<T> *S,const T *in,uint32_t nbSamples);
+
+template<typename T>
+void sdft_bins(const sdftstate<T> *S,T *out);
+
+template<typename T>
+arm_status welch_psd_init(welchstate<T> *S,uint16_t N,uint16_t overlap,const T *window,uint16_t nbThreads,T *segment,T *tmp,T *acc);
+
+template<typename T>
+void welch_psd_update(welchstate<T> *S,const T *in,uint32_t nbSamples);
+
+template<typename T>
+arm_status welch_psd(const welchstate<T> *S,T *out);
+
+template<typename T>
+arm_status welch_csd_init(welchstate<T> *S,uint16_t N,uint16_t overlap,const T *window,uint16_t nbThreads,T *segment,T *tmp,T *acc);
+
+template<typename T>
+void welch_csd_update(welchstate<T> *S,const T *x,const T *y,uint32_t nbSamples);
+
+template<typename T>
+arm_status welch_csd(const welchstate<T> *S,T *out);
+
+template<typename T>
+arm_status welch_coherence(const welchstate<T> *S,T *out);
+
+template<typename T>
+arm_status power_spectrum(const T *in,const T *window,T* tmp,T* out, uint16_t N);
+
+template<typename T>
+arm_status log_power_spectrum(const T *in,const T *window,T* tmp,T* out, uint16_t N);
+
+template<typename T>
+arm_status mfcc(const T *in,const T *window,T* tmp,T* out, uint16_t N,uint16_t nbMel,uint16_t nbDct);
+
+template<typename T>
+arm_status zoom_fft_init(zoomstate<T> *S,float32_t center,uint16_t decimation,uint16_t nbTaps,uint16_t N,const T *window,T *coefs,T *delay,T *frame);
+
+template<typename T>
+uint32_t zoom_fft(zoomstate<T> *S,const T *in,uint32_t nbSamples,T *out);
+
+template<typename T>
+arm_status channelizer_init(channelizerstate<T> *S,uint16_t nbChannels,uint16_t nbTaps,uint16_t hop,T *delay,T *tmp);
+
+template<typename T>
+uint32_t channelizer(channelizerstate<T> *S,const T *in,uint32_t nbSamples,T *out);
+
+template<typename T>
+void xcorr(const T *x,uint16_t nx,const T *y,uint16_t ny,int32_t firstLag,uint16_t nbLags,T *tmp,T *out,uint16_t N);
+
+template<typename T>
+void autocorr(const T *x,uint16_t nx,uint16_t nbLags,T *tmp,T *out,uint16_t N);
+
+template<typename T>
+arm_status xcorr_stream_init(xcorrstate<T> *S,const T *y,uint16_t M,uint16_t N,T *spectrum,T *segment,T *tmp);
+
+template<typename T>
+uint32_t xcorr_stream(xcorrstate<T> *S,const T *in,uint32_t nbSamples,T *out);
+
+template<typename T>
+arm_status resampler_init(resamplerstate<T> *S,uint16_t nIn,uint16_t nOut,uint16_t overlap,uint16_t transition,T *gain,T *frame,T *spectrum,T *tmp);
+
+template<typename T>
+uint32_t resampler(resamplerstate<T> *S,const T *in,uint32_t nbSamples,T *out);
+
 
 
 #endif
@@ -0,0 +1,241 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+First stage of the FFT reading the input through a loader.
+
+A loader is a struct with a method
+
+complex<T> load(int i) const
+
+returning the complex sample i of the FFT input.
+It is used to transform the input (format, windowing ...)
+while it is read by the first stage : no additional
+pass on the input is needed.
+
+The other stages are the normal ones.
+
+*/
+
+#ifndef FIRSTSTAGE_H
+#define FIRSTSTAGE_H
+
+/*
+
+First stage reading its input through a loader.
+The inputs of a butterfly are gathered in a local array and
+the radix is computed in place on this array with a stage length of 1.
+Then, the result is written to the interleaved output.
+
+*/
+template<int mode,typename T,int factor,typename L>
+struct loadfirst{
+  __STATIC_FORCEINLINE int run(const int n,
+                int stageLength,
+                const L &loader,
+                complex<T> *out,
+                const complex<TWID<T>> *twid,
+                bool isLast)
+  {
+      complex<T> a[factor];
+
+      // Only one stage. The FFT length is equal to the radix.
+      if (isLast)
+      {
+         (void)n;
+         for(int k = 0; k < factor; k++)
+         {
+            a[k] = loader.load(k);
+         }
+         radix<mode,T,factor,0>::run_ip_last(a,0);
+         for(int k = 0; k < factor; k++)
+         {
+            memory<complex<T>>::store(out,k,a[k]);
+         }
+         return(factor);
+      }
+
+      // First group (twiddle is 1)
+      for(int k = 0; k < factor; k++)
+      {
+         a[k] = loader.load(k * stageLength);
+      }
+      radix<mode,T,factor,0>::run_ip_notw(1,a,0);
+      for(int k = 0; k < factor; k++)
+      {
+         memory<complex<T>>::store(out,k * stageLength,a[k]);
+      }
+
+      for(int sample=1; sample < stageLength ; sample++)
+      {
+         complex<TWID<T>> w[factor-1];
+         const complex<TWID<T>> *p = &twid[sample];
+
+         for(int k = 0; k < factor-1 ; k++)
+         {
+           w[k] = *p;
+           p += sample;
+         }
+
+         for(int k = 0; k < factor; k++)
+         {
+            a[k] = loader.load(sample + k * stageLength);
+         }
+         radix<mode,T,factor,0>::run_ip_tw(1,w,a,0);
+         for(int k = 0; k < factor; k++)
+         {
+            memory<complex<T>>::store(out,sample + k * stageLength,a[k]);
+         }
+      }
+
+      return(factor);
+  }
+};
+
+// First stage for one radix (not instantiated when the radix
+// is not used by the datatype : kernels.h and config.h are checked
+// to agree by a static_assert in fft.cpp)
+template <int mode,typename T,int factor,typename L,int used=radixused<T,factor>::value>
+struct loadCase{
+  __STATIC_FORCEINLINE int run(const int n,
+    const int stageLength,
+    const L &loader,
+    complex<T> *out,
+    const complex<TWID<T>> *twid,
+    bool isLast)
+  {
+    return(loadfirst<mode,T,factor,L>::run(n,stageLength,loader,out,twid,isLast));
+  }
+};
+
+template <int mode,typename T,int factor,typename L>
+struct loadCase<mode,T,factor,L,0>{
+  __STATIC_FORCEINLINE int run(const int n,
+    const int stageLength,
+    const L &loader,
+    complex<T> *out,
+    const complex<TWID<T>> *twid,
+    bool isLast)
+  {
+    (void)n;
+    (void)stageLength;
+    (void)loader;
+    (void)out;
+    (void)twid;
+    (void)isLast;
+    return(1);
+  }
+};
+
+// Select the radix for the first stage.
+// Must be kept consistent with factorSwitch in stageloop.h
+template <int mode,typename T,typename L>
+struct loadFactorSwitch{
+  static int run(
+    const int n,
+    const int factor,
+    const int stageLength,
+    const L &loader,
+    complex<T> *out,
+    const complex<TWID<T>> *twid,
+    bool isLast)
+  {
+        switch(factor)
+        {
+          #if defined(RADIX2)
+            case 2:
+              return(loadCase<mode,T,2,L>::run(n,stageLength,loader,out,twid,isLast));
+            break;
+          #endif
+
+          #if defined(RADIX3)
+            case 3:
+              return(loadCase<mode,T,3,L>::run(n,stageLength,loader,out,twid,isLast));
+            break;
+          #endif
+
+          #if defined(RADIX4)
+            case 4:
+              return(loadCase<mode,T,4,L>::run(n,stageLength,loader,out,twid,isLast));
+            break;
+          #endif
+
+          #if defined(RADIX5)
+            case 5:
+              return(loadCase<mode,T,5,L>::run(n,stageLength,loader,out,twid,isLast));
+            break;
+          #endif
+
+          #if defined(RADIX6)
+            case 6:
+              return(loadCase<mode,T,6,L>::run(n,stageLength,loader,out,twid,isLast));
+            break;
+          #endif
+
+          #if defined(RADIX8)
+            case 8:
+              return(loadCase<mode,T,8,L>::run(n,stageLength,loader,out,twid,isLast));
+            break;
+          #endif
+
+        }
+        return(1);
+  }
+};
+
+// FFT with input read by the loader and interleaved output (not permuted)
+template <int mode,typename T,typename L>
+struct fftload{
+  static void run(const cfftconfig<T> *config,
+    int n,
+    const L &loader,
+    complex<T> *out)
+  {
+    const complex<TWID<T>> *twid = (complex<TWID<T>>*)config->twiddle;
+    const uint32_t factor = config->factors[0];
+    const uint32_t nbFactors = config->factors[1];
+    const bool hasLast = (nbFactors == config->nbFactors);
+    int stride;
+    fftprofile<mode,T> profile(config,n);
+
+    profile.start();
+
+    stride = loadFactorSwitch<mode,T,L>::run(n,factor,config->lengths[0],loader,out,twid,hasLast && (nbFactors == 1));
+
+    // Remaining stages for the radix of the first stage
+    if (nbFactors > 1)
+    {
+       if (hasLast)
+       {
+          stride=factorSwitch<mode,T,ENDONLY,0>::run(config,n,factor,nbFactors-1,1,stride,out,out,twid,0);
+       }
+       else
+       {
+          stride=factorSwitch<mode,T,NORMALLOOP,0>::run(config,n,factor,nbFactors-1,1,stride,out,out,twid,0);
+       }
+    }
+
+    profile.stop(0,factor,nbFactors,FFT_PROFILE_FIRST | (hasLast ? FFT_PROFILE_LAST : FFT_PROFILE_NORMAL));
+
+    fft<mode,T,0>::run_groups(config,n,1,nbFactors,stride,out,out,0);
+  }
+};
+
+#endif
@@ -28,6 +28,83 @@ static constexpr int FIRSTANDLAST=3; // FIRST AND LAST STAGE for the loop
 template<int mode,typename T, int factor,int stagemode,int inputstrideenabled, int vectormode>
 struct loopcore;
 
+#if defined(FFT_GROUP_MAJOR)
+/*
+
+Group-major order for the NORMAL stages.
+
+The sample-major loop is loading the twiddles of a sample once and
+iterating on all the groups with a stride of factor*stageLength.
+When there are many small groups, each twiddle is walking the
+whole buffer.
+
+In group-major order, a group is computed before the next one.
+The twiddles of the stage are first expanded in a small contiguous
+table (factor-1 twiddles per sample) which is streamed for each group.
+
+The group-major order is selected when there are more groups than
+samples per group and when the expanded table is small enough.
+
+*/
+#if !defined(FFT_GROUP_MAJOR_MAX_TWIDDLES)
+#define FFT_GROUP_MAJOR_MAX_TWIDDLES 64
+#endif
+
+template<int factor>
+struct groupmajor{
+     __STATIC_FORCEINLINE bool selected(const int n,const int stageLength)
+     {
+          const int nbGroups = n / (factor*stageLength);
+
+          return((nbGroups > stageLength) &&
+                 ((stageLength - 1)*(factor - 1) <= FFT_GROUP_MAJOR_MAX_TWIDDLES));
+     }
+
+     template<int mode,typename T,int inputstrideenabled>
+     __STATIC_FORCEINLINE int run(const int n,
+                int stageLength,
+                complex<T> *in,
+                const int stride,
+                const complex<TWID<T>> *twid,
+                int inputstride
+                )
+     {
+          complex<TWID<T>> w[FFT_GROUP_MAJOR_MAX_TWIDDLES];
+          complex<TWID<T>> *q = w;
+          int twidOffset=stride;
+          const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+          // Expanded twiddles of the stage
+          for(int sample=1; sample < stageLength ; sample++)
+          {
+             const complex<TWID<T>> *p = &twid[1*twidOffset];
+      
+             for(int k = 0; k < factor-1 ; k++)
+             {
+               *q++ = *p;
+               p += twidOffset;
+             }
+             twidOffset += stride;
+          }
+
+          // Iterate on the groups
+          for (int i = 0 ; i < n ; i = i + factor*stageLength)
+          {
+             radix<mode,T,factor,inputstrideenabled>::run_ip_notw(stageLength,&in[i * strideFactor],inputstride);
+
+             q = w;
+             for(int sample=1; sample < stageLength ; sample++)
+             {
+                radix<mode,T,factor,inputstrideenabled>::run_ip_tw(stageLength,q,&in[(i + sample) * strideFactor],inputstride);
+                q += factor-1;
+             }
+          }
+
+          return(factor*stride);
+     }
+};
+#endif
+
 
 
 // Generic loop not containing first and last.
@@ -39,7 +116,7 @@ struct loopcore<mode,T,factor,NORMAL,inputstrideenabled,0>{
                 complex<T> *in,
                 complex<T> *out,
                 const int stride,
-                const complex<T> *twid,
+                const complex<TWID<T>> *twid,
                 int inputstride
                 )
      {    
@@ -49,6 +126,13 @@ struct loopcore<mode,T,factor,NORMAL,inputstrideenabled,0>{
           // inputstride is 0 when no stride is used.
           const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
 
+#if defined(FFT_GROUP_MAJOR)
+          if (groupmajor<factor>::selected(n,stageLength))
+          {
+             return(groupmajor<factor>::template run<mode,T,inputstrideenabled>(n,stageLength,in,stride,twid,inputstride));
+          }
+#endif
+
           // First group
           for (int i = 0 ; i < n ; i = i + factor*stageLength)
           {
@@ -58,8 +142,8 @@ struct loopcore<mode,T,factor,NORMAL,inputstrideenabled,0>{
 
           for(int sample=1; sample < stageLength ; sample++)
           {
-             complex<T> w[factor-1];
-             const complex<T> *p = &twid[1*twidOffset];
+             complex<TWID<T>> w[factor-1];
+             const complex<TWID<T>> *p = &twid[1*twidOffset];
       
              // Twiddle is shared between several groups
              for(int k = 0; k < factor-1 ; k++)
@@ -90,7 +174,7 @@ struct loopcore<mode,T,factor,FIRST,inputstrideenabled,0>{
                 complex<T> *in,
                 complex<T> *out,
                 const int stride,
-                const complex<T> *twid,
+                const complex<TWID<T>> *twid,
                 int inputstride
                 )
      {    
@@ -105,8 +189,8 @@ struct loopcore<mode,T,factor,FIRST,inputstrideenabled,0>{
 
           for(int sample=1; sample < stageLength ; sample++)
           {
-             complex<T> w[factor-1];
-             const complex<T> *p = &twid[1*twidOffset];
+             complex<TWID<T>> w[factor-1];
+             const complex<TWID<T>> *p = &twid[1*twidOffset];
       
              for(int k = 0; k < factor-1 ; k++)
              {
@@ -131,7 +215,7 @@ struct loopcore<mode,T,factor,LAST,inputstrideenabled,0>{
                 complex<T> *in,
                 complex<T> *out,
                 const int stride,
-                const complex<T> *twid,
+                const complex<TWID<T>> *twid,
                 int inputstride
                 )
      {
@@ -157,7 +241,7 @@ struct loopcore<mode,T,factor,FIRSTANDLAST,inputstrideenabled,0>{
                 complex<T> *in,
                 complex<T> *out,
                 const int stride,
-                const complex<T> *twid,
+                const complex<TWID<T>> *twid,
                 int inputstride
                 )
      {
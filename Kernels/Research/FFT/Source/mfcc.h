@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+MFCC : power spectrum, mel filters, log and DCT on one frame.
+
+The mel filters and the DCT matrix are generated by configgen.py.
+Only the nonzero weights of each triangular filter are stored
+with the first bin of the filter.
+
+The mel filters and the DCT are dot products (dot.h) which are
+vectorized when the datatype has vector support.
+
+*/
+
+#ifndef MFCC_H
+#define MFCC_H
+
+/*
+
+The power spectrum is written after the N samples used by the FFT
+in tmp. Once the power spectrum is computed, the log of the mel
+energies is written at the beginning of tmp.
+
+*/
+template<typename T>
+arm_status inner_mfcc(const T *in,const T *window,T* tmp,T* out,uint16_t n,uint16_t nbMel,uint16_t nbDct)
+{
+    const mfccconfig<T> *config=mfcc_config<T>(n,nbMel,nbDct);
+    T *spectrum = tmp + n;
+    const T *coefs;
+    arm_status status;
+
+    if (!config)
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+
+    status=inner_power_spectrum<T,0>(in,window,tmp,spectrum,n);
+    if (status != ARM_MATH_SUCCESS)
+    {
+      return(status);
+    }
+
+    coefs = config->filterCoefs;
+    for(uint32_t m = 0; m < nbMel; m++)
+    {
+       const uint32_t length = config->filterLengths[m];
+
+       tmp[m] = powercompress<T,1>::run(dotproduct<T>::run(spectrum + config->filterPos[m],coefs,length));
+       coefs += length;
+    }
+
+    for(uint32_t k = 0; k < nbDct; k++)
+    {
+       out[k] = dotproduct<T>::run(config->dct + k*nbMel,tmp,nbMel);
+    }
+
+    return(ARM_MATH_SUCCESS);
+}
+
+#endif
@@ -0,0 +1,455 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Mixed precision FFTs : float16_t storage and float32_t computations.
+(The reduced table Q31 FFTs are at the end of the file.)
+
+The FFT is run with the sample type float16mix_t and the float16_t
+configuration (twiddles and permutations).
+The radix of float16mix_t is loading the samples and twiddles of a
+butterfly, widening them to float32_t, computing the butterfly with
+the float32_t radix and narrowing the results when storing them.
+
+So the memory traffic and the tables are the ones of the float16_t
+FFT but the accuracy is much better since the butterflies are not
+computed with float16_t arithmetic.
+
+The normalization of the inverse FFTs and the RFFT split / merge
+steps are also computed with float32_t.
+
+*/
+
+#ifndef MIXED_H
+#define MIXED_H
+
+// Datatype of the configurations (twiddles and permutations)
+// used by the mixed FFTs of a datatype
+template<typename T>
+struct mixedconfig;
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+template<>
+struct mixedconfig<float16_t>{
+  typedef float16_t type;
+};
+
+// Used by the radix 2 first stage (rot of the twiddles)
+__FORCE_INLINE float16mix_t operator-(const float16mix_t a)
+{
+    float16mix_t r;
+    r.v = (float16_t)(-(float32_t)a.v);
+    return(r);
+}
+
+template<>
+struct profiledatatype<float16mix_t>{
+  static constexpr uint8_t id = FFT_PROFILE_F16;
+};
+
+// The float16mix_t FFTs are using the f16 lengths
+template<int factor>
+struct radixused<float16mix_t,factor>{
+  enum { value = radixused<float16_t,factor>::value };
+};
+
+__STATIC_FORCEINLINE complex<float32_t> mixed_widen(const complex<float16mix_t> a)
+{
+    return(complex<float32_t>((float32_t)a.re.v,(float32_t)a.im.v));
+}
+
+__STATIC_FORCEINLINE complex<float16mix_t> mixed_narrow(const complex<float32_t> a)
+{
+    float16mix_t re,im;
+
+    re.v = (float16_t)a.re;
+    im.v = (float16_t)a.im;
+    return(complex<float16mix_t>(re,im));
+}
+
+/*
+
+Radix for float16mix_t : the butterfly is computed by the
+float32_t radix in a local buffer of factor samples.
+
+*/
+template<int mode,int factor,int inputstrideenabled>
+struct radix<mode,float16mix_t,factor,inputstrideenabled>{
+
+  __STATIC_FORCEINLINE void load(int stageLength,const complex<float16mix_t> *in,complex<float32_t> *a,int inputstride)
+  {
+     const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+     for(int k = 0; k < factor; k++)
+     {
+        a[k] = mixed_widen(in[k * stageLength * strideFactor]);
+     }
+  }
+
+  __STATIC_FORCEINLINE void store(int stageLength,complex<float16mix_t> *out,const complex<float32_t> *a,int inputstride)
+  {
+     const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+
+     for(int k = 0; k < factor; k++)
+     {
+        out[k * stageLength * strideFactor] = mixed_narrow(a[k]);
+     }
+  }
+
+  __STATIC_FORCEINLINE void twiddles(const complex<float16mix_t> *w,complex<float32_t> *w32)
+  {
+     for(int k = 0; k < factor-1; k++)
+     {
+        w32[k] = mixed_widen(w[k]);
+     }
+  }
+
+  __STATIC_FORCEINLINE void run_ip_tw(int stageLength,const complex<float16mix_t> *w,complex<float16mix_t> *in,int inputstride)
+  {
+     run_op_tw(stageLength,w,in,in,inputstride);
+  }
+
+  __STATIC_FORCEINLINE void run_op_tw(int stageLength,const complex<float16mix_t> *w,const complex<float16mix_t> *in,complex<float16mix_t> *out,int inputstride)
+  {
+     complex<float32_t> a[factor];
+     complex<float32_t> w32[factor-1];
+
+     load(stageLength,in,a,inputstride);
+     twiddles(w,w32);
+     radix<mode,float32_t,factor,0>::run_ip_tw(1,w32,a,0);
+     store(stageLength,out,a,inputstride);
+  }
+
+  __STATIC_FORCEINLINE void run_ip_notw(int stageLength,complex<float16mix_t> *in,int inputstride)
+  {
+     run_op_notw(stageLength,in,in,inputstride);
+  }
+
+  __STATIC_FORCEINLINE void run_op_notw(int stageLength,const complex<float16mix_t> *in,complex<float16mix_t> *out,int inputstride)
+  {
+     complex<float32_t> a[factor];
+
+     load(stageLength,in,a,inputstride);
+     radix<mode,float32_t,factor,0>::run_ip_notw(1,a,0);
+     store(stageLength,out,a,inputstride);
+  }
+
+  __STATIC_FORCEINLINE void run_ip_last(complex<float16mix_t> *in,int inputstride)
+  {
+     run_op_last(in,in,inputstride);
+  }
+
+  __STATIC_FORCEINLINE void run_op_last(const complex<float16mix_t> *in,complex<float16mix_t> *out,int inputstride)
+  {
+     complex<float32_t> a[factor];
+
+     load(1,in,a,inputstride);
+     radix<mode,float32_t,factor,0>::run_ip_last(a,0);
+     store(1,out,a,inputstride);
+  }
+};
+
+/*
+
+CFFT
+
+*/
+template<int mode>
+arm_status inner_cfft_mixed(const float16_t *in,float16_t* out, uint16_t n)
+{
+    const cfftconfig<float16mix_t> *config=(const cfftconfig<float16mix_t> *)cfft_config<float16_t>(n);
+    complex<float16mix_t> *pOut = (complex<float16mix_t> *)out;
+
+    if (!config)
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+
+    fft<mode,float16mix_t,0>::run(config,n,(complex<float16mix_t>*)in,pOut,0);
+
+    fft<mode,float16mix_t,0>::permute(config,n,(float16mix_t*)out,0);
+
+    if (mode == INVERSE)
+    {
+       const float32_t normalization = 1.0f / n;
+
+       for(int i = 0; i < n; i++)
+       {
+          pOut[i] = mixed_narrow(mixed_widen(pOut[i]) * normalization);
+       }
+    }
+
+    return(ARM_MATH_SUCCESS);
+}
+
+/*
+
+RFFT
+
+*/
+template<typename T>
+void rfft_split_mixed(const rfftconfig<T> *config,const T *tmp,T* out, unsigned int n)
+{
+    const unsigned int halflength = n >> 1;
+    const complex<float16mix_t> *pA = (const complex<float16mix_t> *)tmp;
+    const complex<float16mix_t> *pB = pA + halflength;
+    complex<float16mix_t> *pOut = (complex<float16mix_t> *)out;
+    const complex<float16mix_t> *pTwid = (const complex<float16mix_t> *)config->twiddle;
+    complex<float32_t> a;
+    complex<float32_t> b;
+
+    a = mixed_widen(pA[0]);
+    pOut[0] = mixed_narrow(complex<float32_t>(a.real() + a.imag(),0.0f));
+
+    pOut[halflength] = mixed_narrow(complex<float32_t>(a.real() - a.imag(),0.0f));
+
+    for(unsigned int i = 1; i < halflength; i++)
+    {
+       a = mixed_widen(pA[i]);
+       b = conjugate(mixed_widen(pB[-(int)i]));
+
+       pOut[i] = mixed_narrow(rfft_split_bin(a,b,mixed_widen(pTwid[i])));
+    }
+}
+
+template<typename T>
+void rfft_merge_mixed(const rfftconfig<T> *config,const T *in,T* tmp, unsigned int n)
+{
+    const unsigned int halflength = n >> 1;
+    const complex<float16mix_t> *pA = (const complex<float16mix_t> *)in;
+    const complex<float16mix_t> *pB = pA + halflength;
+    complex<float16mix_t> *pTmp = (complex<float16mix_t> *)tmp;
+    const complex<float16mix_t> *pTwid = (const complex<float16mix_t> *)config->twiddle;
+    complex<float32_t> a;
+    complex<float32_t> b;
+    complex<float32_t> f;
+    complex<float32_t> g;
+
+    for(unsigned int i = 0; i < halflength; i++)
+    {
+       a = mixed_widen(pA[i]);
+       b = conjugate(mixed_widen(pB[-(int)i]));
+
+       f = a + b;
+       g = multconj((a - b),mixed_widen(pTwid[i]));
+
+       pTmp[i] = mixed_narrow(narrow<1,complex<float32_t>>::run(f + g));
+    }
+}
+#endif
+
+/*
+
+Reduced table FFTs : Q31 samples and Q15 twiddles.
+
+The FFT is run with the sample type q31mix_t and the Q15
+configuration (the Q15 and Q31 FFTs have the same factorizations
+and output formats).
+The radix of q31mix_t is widening the Q15 twiddles of a butterfly
+to Q31 and computing the butterfly with the Q31 radix. The low half
+of the widened twiddles is zero so the products are the 32x16
+products of the Q31 samples with the Q15 twiddles.
+
+The twiddle tables (CFFT and RFFT split / merge) are half the size
+of the Q31 ones and no Q31 table is needed. The error of the
+twiddles is the Q15 one.
+
+*/
+#if defined(FUNC_CFFT_Q31MIX)
+template<>
+struct mixedconfig<Q31>{
+  typedef Q15 type;
+};
+
+template<>
+struct profiledatatype<q31mix_t>{
+  static constexpr uint8_t id = FFT_PROFILE_Q31;
+};
+
+// The q31mix_t FFTs are using the q15 lengths
+template<int factor>
+struct radixused<q31mix_t,factor>{
+  enum { value = radixused<Q15,factor>::value };
+};
+
+__STATIC_FORCEINLINE complex<Q31> mixed_widen(const complex<Q15> a)
+{
+    return(complex<Q31>(Q31((q31_t)a.real().value << 16),Q31((q31_t)a.imag().value << 16)));
+}
+
+// Normalization 1/n of the inverse FFT in Q31 (the
+// configuration has the Q15 one)
+__STATIC_FORCEINLINE Q31 mixed_normalization(uint32_t n)
+{
+    const uint64_t r = ((((uint64_t)1) << 32) / n + 1) >> 1;
+
+    return(Q31((q31_t)(r > 0x7FFFFFFF ? 0x7FFFFFFF : r)));
+}
+
+/*
+
+Radix for q31mix_t : the samples have the layout of Q31 samples so
+the Q31 radix is working directly on them.
+
+*/
+template<int mode,int factor,int inputstrideenabled>
+struct radix<mode,q31mix_t,factor,inputstrideenabled>{
+
+  __STATIC_FORCEINLINE void twiddles(const complex<Q15> *w,complex<Q31> *w31)
+  {
+     for(int k = 0; k < factor-1; k++)
+     {
+        w31[k] = mixed_widen(w[k]);
+     }
+  }
+
+  __STATIC_FORCEINLINE void run_ip_tw(int stageLength,const complex<Q15> *w,complex<q31mix_t> *in,int inputstride)
+  {
+     complex<Q31> w31[factor-1];
+
+     twiddles(w,w31);
+     radix<mode,Q31,factor,inputstrideenabled>::run_ip_tw(stageLength,w31,(complex<Q31>*)in,inputstride);
+  }
+
+  __STATIC_FORCEINLINE void run_op_tw(int stageLength,const complex<Q15> *w,const complex<q31mix_t> *in,complex<q31mix_t> *out,int inputstride)
+  {
+     complex<Q31> w31[factor-1];
+
+     twiddles(w,w31);
+     radix<mode,Q31,factor,inputstrideenabled>::run_op_tw(stageLength,w31,(const complex<Q31>*)in,(complex<Q31>*)out,inputstride);
+  }
+
+  __STATIC_FORCEINLINE void run_ip_notw(int stageLength,complex<q31mix_t> *in,int inputstride)
+  {
+     radix<mode,Q31,factor,inputstrideenabled>::run_ip_notw(stageLength,(complex<Q31>*)in,inputstride);
+  }
+
+  __STATIC_FORCEINLINE void run_op_notw(int stageLength,const complex<q31mix_t> *in,complex<q31mix_t> *out,int inputstride)
+  {
+     radix<mode,Q31,factor,inputstrideenabled>::run_op_notw(stageLength,(const complex<Q31>*)in,(complex<Q31>*)out,inputstride);
+  }
+
+  __STATIC_FORCEINLINE void run_ip_last(complex<q31mix_t> *in,int inputstride)
+  {
+     radix<mode,Q31,factor,inputstrideenabled>::run_ip_last((complex<Q31>*)in,inputstride);
+  }
+
+  __STATIC_FORCEINLINE void run_op_last(const complex<q31mix_t> *in,complex<q31mix_t> *out,int inputstride)
+  {
+     radix<mode,Q31,factor,inputstrideenabled>::run_op_last((const complex<Q31>*)in,(complex<Q31>*)out,inputstride);
+  }
+};
+
+/*
+
+CFFT
+
+*/
+template<int mode>
+arm_status inner_cfft_mixed(const Q31 *in,Q31* out, uint16_t n)
+{
+    const cfftconfig<Q15> *tables=cfft_config<Q15>(n);
+
+    if (!tables)
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+
+    const cfftconfig<q31mix_t> config={
+       {mixed_normalization(n)},
+       tables->nbPerms,tables->perms,
+       tables->nbTwiddle,tables->twiddle,
+       tables->nbGroupedFactors,tables->nbFactors,
+       tables->factors,tables->lengths,
+       tables->format,tables->reversalVectorizable
+    };
+
+    fft<mode,q31mix_t,0>::run(&config,n,(complex<q31mix_t>*)in,(complex<q31mix_t>*)out,0);
+
+    fft<mode,q31mix_t,0>::permute(&config,n,(q31mix_t*)out,0);
+
+    if (mode == INVERSE)
+    {
+       complex<Q31> *pOut = (complex<Q31> *)out;
+
+       for(int i = 0; i < n; i++)
+       {
+          pOut[i] = pOut[i] * config.normalization.v;
+       }
+    }
+
+    return(ARM_MATH_SUCCESS);
+}
+
+/*
+
+RFFT
+
+*/
+void rfft_split_mixed(const rfftconfig<Q15> *config,const Q31 *tmp,Q31* out, unsigned int n)
+{
+    const unsigned int halflength = n >> 1;
+    const complex<Q31> *pA = (const complex<Q31> *)tmp;
+    const complex<Q31> *pB = pA + halflength;
+    complex<Q31> *pOut = (complex<Q31> *)out;
+    const complex<Q15> *pTwid = (const complex<Q15> *)config->twiddle;
+    complex<Q31> a;
+    complex<Q31> b;
+
+    a = pA[0];
+    pOut[0] = complex<Q31>(a.real() + a.imag(),constant<Q31>::zero);
+
+    pOut[halflength] = complex<Q31>(a.real() - a.imag(),constant<Q31>::zero);
+
+    for(unsigned int i = 1; i < halflength; i++)
+    {
+       a = pA[i];
+       b = conjugate(pB[-(int)i]);
+
+       pOut[i] = rfft_split_bin(a,b,mixed_widen(pTwid[i]));
+    }
+}
+
+void rfft_merge_mixed(const rfftconfig<Q15> *config,const Q31 *in,Q31* tmp, unsigned int n)
+{
+    const unsigned int halflength = n >> 1;
+    const complex<Q31> *pA = (const complex<Q31> *)in;
+    const complex<Q31> *pB = pA + halflength;
+    complex<Q31> *pTmp = (complex<Q31> *)tmp;
+    const complex<Q15> *pTwid = (const complex<Q15> *)config->twiddle;
+    complex<Q31> a;
+    complex<Q31> b;
+    complex<PROD<Q31>> f;
+    complex<PROD<Q31>> g;
+
+    for(unsigned int i = 0; i < halflength; i++)
+    {
+       a = pA[i];
+       b = conjugate(pB[-(int)i]);
+
+       f = widen<complex<Q31>>::run(a + b);
+       g = multconj((a - b),mixed_widen(pTwid[i]));
+
+       pTmp[i] = narrow<1,complex<Q31>>::run(f+g);
+    }
+}
+#endif
+
+#endif
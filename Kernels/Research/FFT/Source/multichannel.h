@@ -0,0 +1,49 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Multi-channel FFTs on interleaved inputs.
+
+For the CFFT, a channel is a CFFT with an input stride (like the
+columns of the CFFT2D). The kernels are reading and writing
+the samples of the channel in the interleaved buffers.
+
+For the RFFT, the real samples of a channel seen as complex samples
+are not contiguous. The first stage is reading them through a loader
+and the other stages are computed in tmp.
+
+*/
+
+#ifndef MULTICHANNEL_H
+#define MULTICHANNEL_H
+
+// Loader for the real samples of a channel seen as complex samples
+template<typename T>
+struct channelloader{
+  const T *in;
+  int nbChannels;
+
+  __FORCE_INLINE complex<T> load(int i) const
+  {
+     return(complex<T>(in[2*i*nbChannels],in[(2*i+1)*nbChannels]));
+  }
+};
+
+#endif
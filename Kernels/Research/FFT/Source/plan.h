@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Plans : transform selected once and executed with a scratch
+arena owned by the caller.
+
+The plan is only read by fft_execute and the transforms are not
+using any global buffer : several threads or tasks can execute
+plans at the same time if they are using different arenas.
+
+The execution of a plan is done through a function pointer set
+when the plan is initialized. So, fft_execute does not depend on
+the kinds of transforms configured for a datatype.
+
+Only the CFFT, CFFT2D and RFFT (and their inverses) have plans.
+The other transforms must be called directly.
+
+*/
+
+#ifndef PLAN_H
+#define PLAN_H
+
+template<typename T,int mode>
+struct plancfft;
+
+template<typename T>
+struct plancfft<T,DIRECT>{
+  static arm_status run(const fftplan<T> *plan,const T *in,T *out,T *scratch)
+  {
+     (void)scratch;
+     return(inner_cfft<T,0>(in,out,plan->n,0));
+  }
+};
+
+template<typename T>
+struct plancfft<T,INVERSE>{
+  static arm_status run(const fftplan<T> *plan,const T *in,T *out,T *scratch)
+  {
+     (void)scratch;
+     return(inner_cifft<T,0>(in,out,plan->n,0));
+  }
+};
+
+template<typename T,int mode>
+struct plancfft2D;
+
+template<typename T>
+struct plancfft2D<T,DIRECT>{
+  static arm_status run(const fftplan<T> *plan,const T *in,T *out,T *scratch)
+  {
+     (void)scratch;
+     return(cfft2D(in,out,plan->n,plan->m));
+  }
+};
+
+template<typename T>
+struct plancfft2D<T,INVERSE>{
+  static arm_status run(const fftplan<T> *plan,const T *in,T *out,T *scratch)
+  {
+     (void)scratch;
+     return(cifft2D(in,out,plan->n,plan->m));
+  }
+};
+
+template<typename T,int mode>
+struct planrfft;
+
+template<typename T>
+struct planrfft<T,DIRECT>{
+  static arm_status run(const fftplan<T> *plan,const T *in,T *out,T *scratch)
+  {
+     return(rfft(in,scratch,out,plan->n));
+  }
+};
+
+template<typename T>
+struct planrfft<T,INVERSE>{
+  static arm_status run(const fftplan<T> *plan,const T *in,T *out,T *scratch)
+  {
+     return(rifft(in,scratch,out,plan->n));
+  }
+};
+
+#endif
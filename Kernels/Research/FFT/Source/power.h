@@ -0,0 +1,255 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Power spectrum : window + RFFT + |X|^2 (+ log)
+
+Without vector support, the window is applied when the first stage of
+the FFT is loading its inputs.
+With vector support, the first stage must read contiguous samples
+to use the vector kernels. So, the window is applied with a vector
+loop before the FFT.
+
+The |X|^2 (and the log) is computed when the RFFT split step
+is writing its output.
+
+*/
+
+#ifndef POWER_H
+#define POWER_H
+
+// Loader applying the window to the real input
+// seen as a complex array
+template<typename T>
+struct windowloader{
+  const T *in;
+  const T *window;
+
+  __FORCE_INLINE complex<T> load(int i) const
+  {
+     return(complex<T>(FFTSCI::narrow<NORMALNARROW,T>::run(in[2*i] * window[2*i]),
+                       FFTSCI::narrow<NORMALNARROW,T>::run(in[2*i+1] * window[2*i+1])));
+  }
+};
+
+// Window applied in a separate pass
+template<typename T>
+struct applywindow{
+  __STATIC_FORCEINLINE void run(const T *in,const T *window,T *out,uint32_t n)
+  {
+     for(uint32_t i = 0; i < n; i++)
+     {
+        out[i] = FFTSCI::narrow<NORMALNARROW,T>::run(in[i] * window[i]);
+     }
+  }
+};
+
+#if defined(HASVECTOR) && defined(VECTOR_F32)
+template<>
+struct applywindow<float32_t>{
+  __STATIC_FORCEINLINE void run(const float32_t *in,const float32_t *window,float32_t *out,uint32_t n)
+  {
+     uint32_t blkCnt = n >> 2;
+     while(blkCnt > 0)
+     {
+        vst1q_f32(out,vmulq_f32(vld1q_f32(in),vld1q_f32(window)));
+        in += 4;
+        window += 4;
+        out += 4;
+        blkCnt--;
+     }
+
+     blkCnt = n & 3;
+     while(blkCnt > 0)
+     {
+        *out++ = *in++ * *window++;
+        blkCnt--;
+     }
+  }
+};
+#endif
+
+#if defined(HELIUM_VECTOR) && defined(VECTOR_F16)
+template<>
+struct applywindow<float16_t>{
+  __STATIC_FORCEINLINE void run(const float16_t *in,const float16_t *window,float16_t *out,uint32_t n)
+  {
+     uint32_t blkCnt = n >> 3;
+     while(blkCnt > 0)
+     {
+        vst1q_f16(out,vmulq_f16(vld1q_f16(in),vld1q_f16(window)));
+        in += 8;
+        window += 8;
+        out += 8;
+        blkCnt--;
+     }
+
+     blkCnt = n & 7;
+     while(blkCnt > 0)
+     {
+        *out++ = (_Float16)*in++ * (_Float16)*window++;
+        blkCnt--;
+     }
+  }
+};
+#endif
+
+// Windowed FFT of the real input seen as a complex array of length n.
+// The output is not permuted.
+template<typename T,int vectormode>
+struct windowfft{
+  __STATIC_FORCEINLINE void run(const cfftconfig<T> *config,int n,const T *in,const T *window,T *out)
+  {
+     const windowloader<T> loader={in,window};
+
+     fftload<DIRECT,T,windowloader<T>>::run(config,n,loader,(complex<T>*)out);
+  }
+};
+
+template<typename T>
+struct windowfft<T,1>{
+  __STATIC_FORCEINLINE void run(const cfftconfig<T> *config,int n,const T *in,const T *window,T *out)
+  {
+     applywindow<T>::run(in,window,out,2*n);
+
+     fft<DIRECT,T,0>::run(config,n,(complex<T>*)out,(complex<T>*)out,0);
+  }
+};
+
+/*
+
+|X|^2
+In fixed point, it is |X|^2 / 2 to avoid overflows.
+
+*/
+template<typename T>
+struct magsquared{
+  __STATIC_FORCEINLINE T run(const complex<T> a)
+  {
+     return(FFTSCI::narrow<1,T>::run(a.real() * a.real() + a.imag() * a.imag()));
+  }
+};
+
+template<>
+struct magsquared<float32_t>{
+  __STATIC_FORCEINLINE float32_t run(const complex<float32_t> a)
+  {
+     return(a.real() * a.real() + a.imag() * a.imag());
+  }
+};
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+template<>
+struct magsquared<float16_t>{
+  __STATIC_FORCEINLINE float16_t run(const complex<float16_t> a)
+  {
+     return((_Float16)a.real() * (_Float16)a.real() + (_Float16)a.imag() * (_Float16)a.imag());
+  }
+};
+#endif
+
+/*
+
+Log compression (floating point only).
+A floor is added to the power to avoid log(0).
+
+*/
+#define LOG_POWER_FLOOR 1.0e-12f
+
+template<typename T,int withlog>
+struct powercompress{
+  __STATIC_FORCEINLINE T run(const T v)
+  {
+     return(v);
+  }
+};
+
+template<>
+struct powercompress<float32_t,1>{
+  __STATIC_FORCEINLINE float32_t run(const float32_t v)
+  {
+     return(logf(v + LOG_POWER_FLOOR));
+  }
+};
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+template<>
+struct powercompress<float16_t,1>{
+  __STATIC_FORCEINLINE float16_t run(const float16_t v)
+  {
+     return((float16_t)logf((float32_t)v + LOG_POWER_FLOOR));
+  }
+};
+#endif
+
+// RFFT split step writing the power of the bins
+template<typename T,int withlog>
+void rfft_split_power(const rfftconfig<T> *config,const T *tmp,T* out, unsigned int n)
+{
+    const unsigned int halflength = n >> 1;
+    const complex<T> *pA = (complex<T> *)tmp;
+    const complex<T> *pB = pA + halflength;
+    const complex<T> *pTwid =(complex<T> *)config->twiddle;
+    complex<T> a;
+    complex<T> b;
+
+    a=pA[0];
+    out[0] = powercompress<T,withlog>::run(magsquared<T>::run(complex<T>(a.real() + a.imag(),constant<T>::zero)));
+
+    out[halflength] = powercompress<T,withlog>::run(magsquared<T>::run(complex<T>(a.real() - a.imag(),constant<T>::zero)));
+
+    for(unsigned int i = 1; i < halflength; i++)
+    {
+       a=pA[i];
+       b=conjugate(pB[-(int)i]);
+
+       out[i] = powercompress<T,withlog>::run(magsquared<T>::run(rfft_split_bin(a,b,pTwid[i])));
+    }
+}
+
+template<typename T,int withlog>
+arm_status inner_power_spectrum(const T *in,const T *window,T* tmp,T* out, uint16_t n)
+{
+    const rfftconfig<T> *rconfig=rfft_config<T>(n);
+    const int halflength = n >> 1;
+    const cfftconfig<T> *config=cfft_config<T>(halflength);
+
+    if (!rconfig || !config)
+    {
+      return(ARM_MATH_LENGTH_ERROR);
+    }
+
+    if (window)
+    {
+       windowfft<T,vector<T>::vector_enabled>::run(config,halflength,in,window,tmp);
+    }
+    else
+    {
+       fft<DIRECT,T,0>::run(config,halflength,(complex<T>*)in,(complex<T>*)tmp,0);
+    }
+
+    fft<DIRECT,T,0>::permute(config,halflength,tmp,0);
+
+    rfft_split_power<T,withlog>(rconfig,tmp,out,n);
+
+    return(ARM_MATH_SUCCESS);
+}
+
+#endif
@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Profiling of the FFT stages.
+
+When FFT_PROFILING is not defined, the profiler is empty
+and the hooks are removed by the compiler.
+
+The clock is FFT_PROFILE_CLOCK() which must return an uint32_t.
+On Linux, the default is using clock_gettime (ns).
+On Cortex-M, it must be defined by the user (for instance as DWT->CYCCNT
+or with the cycle counter of the PMU on Cortex-A and Cortex-R).
+
+*/
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#if defined(FFT_PROFILING)
+#define FFT_PROFILING_ENABLED 1
+
+#if !defined(FFT_PROFILE_CLOCK)
+#if defined(__linux__)
+#include <time.h>
+
+__STATIC_FORCEINLINE uint32_t fft_profile_clock()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC,&t);
+    return((uint32_t)(t.tv_sec * 1000000000ULL + t.tv_nsec));
+}
+
+#define FFT_PROFILE_CLOCK() fft_profile_clock()
+#else
+#error "FFT_PROFILE_CLOCK() must be defined when FFT_PROFILING is enabled"
+#endif
+#endif
+
+extern fftprofilesink fftProfileSink;
+extern void *fftProfileContext;
+
+#else
+#define FFT_PROFILING_ENABLED 0
+#endif
+
+template<typename T>
+struct profiledatatype;
+
+template<>
+struct profiledatatype<float64_t>{
+  static constexpr uint8_t id = FFT_PROFILE_F64;
+};
+
+template<>
+struct profiledatatype<float32_t>{
+  static constexpr uint8_t id = FFT_PROFILE_F32;
+};
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+template<>
+struct profiledatatype<float16_t>{
+  static constexpr uint8_t id = FFT_PROFILE_F16;
+};
+#endif
+
+template<>
+struct profiledatatype<Q31>{
+  static constexpr uint8_t id = FFT_PROFILE_Q31;
+};
+
+template<>
+struct profiledatatype<Q15>{
+  static constexpr uint8_t id = FFT_PROFILE_Q15;
+};
+
+template<>
+struct profiledatatype<Q7>{
+  static constexpr uint8_t id = FFT_PROFILE_Q7;
+};
+
+// Disabled profiler
+template<int mode,typename T,int enabled>
+struct fftprofiler{
+  fftprofiler(const cfftconfig<T> *config,int n)
+  {
+     (void)config;
+     (void)n;
+  }
+
+  __FORCE_INLINE void start()
+  {
+  }
+
+  __FORCE_INLINE void stop(int stageGroup,int factor,int nbStages,int stageMode)
+  {
+     (void)stageGroup;
+     (void)factor;
+     (void)nbStages;
+     (void)stageMode;
+  }
+};
+
+#if defined(FFT_PROFILING)
+template<int mode,typename T>
+struct fftprofiler<mode,T,1>{
+  fftprofiler(const cfftconfig<T> *config,int n):
+  config(config),n(n),t0(0)
+  {
+  }
+
+  __FORCE_INLINE void start()
+  {
+     t0 = FFT_PROFILE_CLOCK();
+  }
+
+  __FORCE_INLINE void stop(int stageGroup,int factor,int nbStages,int stageMode)
+  {
+     const uint32_t t1 = FFT_PROFILE_CLOCK();
+     fftprofileevent event;
+
+     if (fftProfileSink)
+     {
+        event.config = config;
+        event.n = n;
+        event.datatype = profiledatatype<T>::id;
+        event.inverse = mode;
+        event.stageGroup = stageGroup;
+        event.factor = factor;
+        event.nbStages = nbStages;
+        event.stageMode = stageMode;
+        event.duration = t1 - t0;
+        fftProfileSink(&event,fftProfileContext);
+     }
+  }
+
+  const cfftconfig<T> *config;
+  const int n;
+  uint32_t t0;
+};
+#endif
+
+template<int mode,typename T>
+using fftprofile = fftprofiler<mode,T,FFT_PROFILING_ENABLED>;
+
+#endif
@@ -0,0 +1,477 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Pruned FFT : only a subset of the output bins is computed.
+
+After a stage, a group of the FFT is split into factor sub-groups
+which are independent FFTs. Each sub-group is producing a
+subset of the output bins (the bins having the same residue
+modulo the product of the factors of the previous stages).
+
+So, a sub-group is computed only when it contains at least one
+of the wanted bins. The permutation is not done : the wanted bins
+are read directly from their position in the non permuted output.
+
+When there are very few bins, a DFT per bin is used instead
+(only for floating point datatypes).
+
+*/
+
+#ifndef PRUNED_H
+#define PRUNED_H
+
+/*
+
+List of wanted bins.
+It is either an array of bins or a range of bins when list is NULL.
+
+For the RFFT, the bins are the bins of the CFFT of length n/2
+used to compute the RFFT. Each RFFT bin k is needing the CFFT bins
+k and n/2 - k (the mirrored bins).
+
+*/
+struct prunedbins {
+   const uint16_t *list;
+   uint32_t first;
+   uint32_t nbBins;
+   // Length of the CFFT
+   uint32_t n;
+   // Add the mirrored bins (for the RFFT)
+   bool mirrored;
+
+   // Bin as requested by the user
+   uint32_t user(uint32_t i) const
+   {
+      return(list ? list[i] : first + i);
+   }
+
+   // Number of bins of the CFFT to compute
+   uint32_t size() const
+   {
+      return(mirrored ? 2*nbBins : nbBins);
+   }
+
+   // Bin of the CFFT
+   uint32_t operator[](uint32_t i) const
+   {
+      if (i < nbBins)
+      {
+         return(user(i) % n);
+      }
+      return((n - user(i - nbBins)) % n);
+   }
+};
+
+// Position of the bin k in the non permuted output of the CFFT
+template<typename T>
+__STATIC_FORCEINLINE uint32_t pruned_position(const cfftconfig<T> *config,uint32_t n,uint32_t k)
+{
+    uint32_t pos = 0;
+    uint32_t groupLength = n;
+
+    for(uint32_t stage = 0; stage < config->nbFactors; stage++)
+    {
+       const uint32_t stageLength = config->lengths[stage];
+       const uint32_t factor = groupLength / stageLength;
+
+       pos += (k % factor) * stageLength;
+       k = k / factor;
+       groupLength = stageLength;
+    }
+
+    return(pos);
+}
+
+/*
+
+Selection of the algorithm.
+
+The cost is estimated as the number of complex samples going through
+a butterfly (an upper bound for the pruned FFT).
+
+The DFT of a bin on a sample (one multiply-accumulate with a twiddle
+read from the table) is cheaper than a butterfly : 3/4 is used
+as ratio.
+
+The full FFT is used when the pruned one would not save anything or when
+there are too many bins (the search of the groups to compute
+is quadratic in the number of bins).
+
+*/
+static constexpr int PRUNED_FFT=0;
+static constexpr int PRUNED_FULL=1;
+static constexpr int PRUNED_DFT=2;
+
+template<typename T>
+__STATIC_FORCEINLINE int pruned_algorithm(const cfftconfig<T> *config,
+  uint32_t n,
+  const prunedbins &bins,
+  uint32_t nbDFTSamples,
+  bool dftEnabled)
+{
+    const uint32_t nbBins = bins.size();
+    uint32_t cost = 0;
+    uint32_t groupLength = n;
+
+    for(uint32_t stage = 0; stage < config->nbFactors; stage++)
+    {
+       const uint32_t nbGroups = n / groupLength;
+
+       cost += (nbBins < nbGroups ? nbBins : nbGroups) * groupLength;
+       groupLength = config->lengths[stage];
+    }
+
+    if (dftEnabled && (3*bins.nbBins*nbDFTSamples <= 4*cost))
+    {
+       return(PRUNED_DFT);
+    }
+
+    if ((cost >= n * config->nbFactors) || (nbBins * nbBins > n))
+    {
+       return(PRUNED_FULL);
+    }
+
+    return(PRUNED_FFT);
+}
+
+/*
+
+Run one stage of the FFT on one group.
+Nothing is instantiated for a radix not used by the datatype
+(fft.cpp checks that kernels.h agrees with config.h).
+
+*/
+template<int mode,typename T,int factor,int used=radixused<T,factor>::value>
+struct prunedstage{
+  __STATIC_FORCEINLINE void run(const int stagemode,
+    const int n,
+    const int stageLength,
+    complex<T> *in,
+    complex<T> *out,
+    const int stride,
+    const complex<T> *twid)
+  {
+     switch(stagemode)
+     {
+        case FIRST:
+          loopcore<mode,T,factor,FIRST,0,radixvectorized<T,factor>::value>::run(n,stageLength,in,out,stride,twid,0);
+        break;
+        case NORMAL:
+          loopcore<mode,T,factor,NORMAL,0,radixvectorized<T,factor>::value>::run(n,stageLength,in,out,stride,twid,0);
+        break;
+        case LAST:
+          loopcore<mode,T,factor,LAST,0,0>::run(n,stageLength,in,out,stride,twid,0);
+        break;
+        case FIRSTANDLAST:
+          loopcore<mode,T,factor,FIRSTANDLAST,0,0>::run(n,stageLength,in,out,stride,twid,0);
+        break;
+     }
+  }
+};
+
+template<int mode,typename T,int factor>
+struct prunedstage<mode,T,factor,0>{
+  __STATIC_FORCEINLINE void run(const int stagemode,
+    const int n,
+    const int stageLength,
+    complex<T> *in,
+    complex<T> *out,
+    const int stride,
+    const complex<T> *twid)
+  {
+     (void)stagemode;
+     (void)n;
+     (void)stageLength;
+     (void)in;
+     (void)out;
+     (void)stride;
+     (void)twid;
+  }
+};
+
+// Select the radix.
+// Must be kept consistent with factorSwitch in stageloop.h
+template <int mode,typename T>
+struct prunedFactorSwitch{
+  static void run(
+    const int factor,
+    const int stagemode,
+    const int n,
+    const int stageLength,
+    complex<T> *in,
+    complex<T> *out,
+    const int stride,
+    const complex<T> *twid)
+  {
+        switch(factor)
+        {
+          #if defined(RADIX2)
+            case 2:
+              prunedstage<mode,T,2>::run(stagemode,n,stageLength,in,out,stride,twid);
+            break;
+          #endif
+
+          #if defined(RADIX3)
+            case 3:
+              prunedstage<mode,T,3>::run(stagemode,n,stageLength,in,out,stride,twid);
+            break;
+          #endif
+
+          #if defined(RADIX4)
+            case 4:
+              prunedstage<mode,T,4>::run(stagemode,n,stageLength,in,out,stride,twid);
+            break;
+          #endif
+
+          #if defined(RADIX5)
+            case 5:
+              prunedstage<mode,T,5>::run(stagemode,n,stageLength,in,out,stride,twid);
+            break;
+          #endif
+
+          #if defined(RADIX6)
+            case 6:
+              prunedstage<mode,T,6>::run(stagemode,n,stageLength,in,out,stride,twid);
+            break;
+          #endif
+
+          #if defined(RADIX8)
+            case 8:
+              prunedstage<mode,T,8>::run(stagemode,n,stageLength,in,out,stride,twid);
+            break;
+          #endif
+        }
+  }
+};
+
+// Pruned FFT with non permuted output.
+// The wanted bins are then at the position given by pruned_position
+template <int mode,typename T>
+struct prunedfft{
+  static void run(const cfftconfig<T> *config,
+    int n,
+    const prunedbins &bins,
+    const complex<T> *in,
+    complex<T> *out)
+  {
+    const complex<T> *twid = (complex<T>*)config->twiddle;
+    const uint32_t nbBins = bins.size();
+    const uint32_t nbStages = config->nbFactors;
+    uint32_t groupLength = n;
+    int stride = 1;
+
+    for(uint32_t stage = 0; stage < nbStages; stage++)
+    {
+       const int stageLength = config->lengths[stage];
+       const int factor = groupLength / stageLength;
+       const bool isLast = (stage == nbStages - 1);
+
+       if (stage == 0)
+       {
+          // The first stage is a single group containing all the bins
+          prunedFactorSwitch<mode,T>::run(factor,isLast ? FIRSTANDLAST : FIRST,
+            n,stageLength,(complex<T>*)in,out,stride,twid);
+       }
+       else
+       {
+          const uint32_t nbGroups = n / groupLength;
+
+          for(uint32_t i = 0; i < nbBins; i++)
+          {
+             const uint32_t group = bins[i] % nbGroups;
+             bool done = false;
+
+             // Is the group already computed for a previous bin ?
+             for(uint32_t j = 0; j < i; j++)
+             {
+                if ((bins[j] % nbGroups) == group)
+                {
+                   done = true;
+                   break;
+                }
+             }
+
+             if (!done)
+             {
+                uint32_t pos = pruned_position(config,n,bins[i]);
+                pos -= pos % groupLength;
+
+                prunedFactorSwitch<mode,T>::run(factor,isLast ? LAST : NORMAL,
+                  groupLength,stageLength,&out[pos],&out[pos],stride,twid);
+             }
+          }
+       }
+
+       stride = stride * factor;
+       groupLength = stageLength;
+    }
+  }
+};
+
+/*
+
+DFT of a few bins.
+Only enabled for floating point datatypes.
+
+The twiddle of the sample i for the bin k is read from the
+twiddle table at the index (k*i) mod n. There is no recurrence
+(like in a Goertzel filter) so the error is growing like the
+error of a sum : a Goertzel filter in f32 is losing
+more than 30 dB at 4096 samples for the bins near Nyquist.
+
+The sum is done on blocks of DFT_BLOCK samples to reduce
+the error of the accumulation on long lengths.
+
+*/
+#define DFT_BLOCK 32
+
+template<typename T>
+struct binsdft{
+  static constexpr bool enabled = false;
+
+  static void cfft(const complex<T> *in,uint32_t n,const prunedbins &bins,
+    const complex<T> *twid,complex<T> *out)
+  {
+     (void)in;
+     (void)n;
+     (void)bins;
+     (void)twid;
+     (void)out;
+  }
+
+  static void rfft(const T *in,uint32_t n,const prunedbins &bins,
+    const complex<T> *twid,complex<T> *out)
+  {
+     (void)in;
+     (void)n;
+     (void)bins;
+     (void)twid;
+     (void)out;
+  }
+};
+
+template<typename T>
+struct binsdftfloat{
+  static constexpr bool enabled = true;
+
+  // twid is the CFFT twiddle table : exp(-2 i pi k / n) for k < n
+  __STATIC_FORCEINLINE complex<T> cfft_bin(const complex<T> *in,uint32_t n,uint32_t k,
+    const complex<T> *twid)
+  {
+     T accr = constant<T>::zero, acci = constant<T>::zero;
+     uint32_t index = 0;
+     uint32_t i = 0;
+
+     while(i < n)
+     {
+        const uint32_t blockEnd = (n - i) > DFT_BLOCK ? i + DFT_BLOCK : n;
+        T sumr = constant<T>::zero, sumi = constant<T>::zero;
+
+        for(; i < blockEnd; i++)
+        {
+           const complex<T> w = twid[index];
+
+           sumr += in[i].real() * w.real() - in[i].imag() * w.imag();
+           sumi += in[i].real() * w.imag() + in[i].imag() * w.real();
+
+           index += k;
+           if (index >= n)
+           {
+              index -= n;
+           }
+        }
+
+        accr += sumr;
+        acci += sumi;
+     }
+
+     return(complex<T>(accr,acci));
+  }
+
+  // twid is the RFFT twiddle table : -i exp(-2 i pi k / n) for k < n/2
+  // and exp(-2 i pi (k + n/2) / n) = -exp(-2 i pi k / n)
+  __STATIC_FORCEINLINE complex<T> rfft_bin(const T *in,uint32_t n,uint32_t k,
+    const complex<T> *twid)
+  {
+     const uint32_t halflength = n >> 1;
+     T accr = constant<T>::zero, acci = constant<T>::zero;
+     uint32_t index = 0;
+     uint32_t i = 0;
+
+     while(i < n)
+     {
+        const uint32_t blockEnd = (n - i) > DFT_BLOCK ? i + DFT_BLOCK : n;
+        T sumr = constant<T>::zero, sumi = constant<T>::zero;
+
+        for(; i < blockEnd; i++)
+        {
+           if (index < halflength)
+           {
+              sumr -= in[i] * twid[index].imag();
+              sumi += in[i] * twid[index].real();
+           }
+           else
+           {
+              sumr += in[i] * twid[index - halflength].imag();
+              sumi -= in[i] * twid[index - halflength].real();
+           }
+
+           index += k;
+           if (index >= n)
+           {
+              index -= n;
+           }
+        }
+
+        accr += sumr;
+        acci += sumi;
+     }
+
+     return(complex<T>(accr,acci));
+  }
+
+  static void cfft(const complex<T> *in,uint32_t n,const prunedbins &bins,
+    const complex<T> *twid,complex<T> *out)
+  {
+     for(uint32_t i = 0; i < bins.nbBins; i++)
+     {
+        out[i] = cfft_bin(in,n,bins[i],twid);
+     }
+  }
+
+  // The RFFT bins are between 0 and n/2 (included)
+  static void rfft(const T *in,uint32_t n,const prunedbins &bins,
+    const complex<T> *twid,complex<T> *out)
+  {
+     for(uint32_t i = 0; i < bins.nbBins; i++)
+     {
+        out[i] = rfft_bin(in,n,bins.user(i),twid);
+     }
+  }
+};
+
+template<>
+struct binsdft<float64_t>:binsdftfloat<float64_t>{};
+
+template<>
+struct binsdft<float32_t>:binsdftfloat<float32_t>{};
+
+#endif
@@ -20,6 +20,8 @@
 /*
 
 Include template specializations for the supported scalar radix
+Only the radix used by the lengths of a datatype are included
+(RADIX_<DATATYPE>_<radix> defined in kernels.h)
 
 */
 
@@ -27,70 +29,175 @@ Include template specializations for the supported scalar radix
 #define RADIX_H
 
 #ifdef DATATYPE_F64
-  #include "Scalar/F64/radix_F64_2.h"
-  #include "Scalar/F64/radix_F64_3.h"
-  #include "Scalar/F64/radix_F64_4.h"
-  #include "Scalar/F64/radix_F64_5.h"
-  #include "Scalar/F64/radix_F64_6.h"
-  #include "Scalar/F64/radix_F64_8.h"
+  #if defined(RADIX_F64_2)
+    #include "Scalar/F64/radix_F64_2.h"
+  #endif
+  #if defined(RADIX_F64_3)
+    #include "Scalar/F64/radix_F64_3.h"
+  #endif
+  #if defined(RADIX_F64_4)
+    #include "Scalar/F64/radix_F64_4.h"
+  #endif
+  #if defined(RADIX_F64_5)
+    #include "Scalar/F64/radix_F64_5.h"
+  #endif
+  #if defined(RADIX_F64_6)
+    #include "Scalar/F64/radix_F64_6.h"
+  #endif
+  #if defined(RADIX_F64_8)
+    #include "Scalar/F64/radix_F64_8.h"
+  #endif
 #endif
 
 #ifdef DATATYPE_F32
-  #include "Scalar/F32/radix_F32_2.h"
-  #include "Scalar/F32/radix_F32_3.h"
-  #include "Scalar/F32/radix_F32_4.h"
-  #include "Scalar/F32/radix_F32_5.h"
-  #include "Scalar/F32/radix_F32_6.h"
-  #include "Scalar/F32/radix_F32_8.h"
+  #if defined(RADIX_F32_2)
+    #include "Scalar/F32/radix_F32_2.h"
+  #endif
+  #if defined(RADIX_F32_3)
+    #include "Scalar/F32/radix_F32_3.h"
+  #endif
+  #if defined(RADIX_F32_4)
+    #include "Scalar/F32/radix_F32_4.h"
+  #endif
+  #if defined(RADIX_F32_5)
+    #include "Scalar/F32/radix_F32_5.h"
+  #endif
+  #if defined(RADIX_F32_6)
+    #include "Scalar/F32/radix_F32_6.h"
+  #endif
+  #if defined(RADIX_F32_8)
+    #include "Scalar/F32/radix_F32_8.h"
+  #endif
 #endif
 
 #if defined(ARM_FLOAT16_SUPPORTED)
 #ifdef DATATYPE_F16
-  #include "Scalar/F16/radix_F16_2.h"
-  #include "Scalar/F16/radix_F16_3.h"
-  #include "Scalar/F16/radix_F16_4.h"
-  #include "Scalar/F16/radix_F16_5.h"
-  #include "Scalar/F16/radix_F16_6.h"
-  #include "Scalar/F16/radix_F16_8.h"
+  #if defined(RADIX_F16_2)
+    #include "Scalar/F16/radix_F16_2.h"
+  #endif
+  #if defined(RADIX_F16_3)
+    #include "Scalar/F16/radix_F16_3.h"
+  #endif
+  #if defined(RADIX_F16_4)
+    #include "Scalar/F16/radix_F16_4.h"
+  #endif
+  #if defined(RADIX_F16_5)
+    #include "Scalar/F16/radix_F16_5.h"
+  #endif
+  #if defined(RADIX_F16_6)
+    #include "Scalar/F16/radix_F16_6.h"
+  #endif
+  #if defined(RADIX_F16_8)
+    #include "Scalar/F16/radix_F16_8.h"
+  #endif
 #endif
 #endif
 
 
 
 #ifdef DATATYPE_Q31
-  #include "Scalar/Q31/radix_Q31_2.h"
-  #include "Scalar/Q31/radix_Q31_3.h"
-  #include "Scalar/Q31/radix_Q31_4.h"
-  #include "Scalar/Q31/radix_Q31_5.h"
-  #include "Scalar/Q31/radix_Q31_6.h"
-  #include "Scalar/Q31/radix_Q31_8.h"
+  #if defined(RADIX_Q31_2)
+    #include "Scalar/Q31/radix_Q31_2.h"
+  #endif
+  #if defined(RADIX_Q31_3)
+    #include "Scalar/Q31/radix_Q31_3.h"
+  #endif
+  #if defined(RADIX_Q31_4)
+    #include "Scalar/Q31/radix_Q31_4.h"
+  #endif
+  #if defined(RADIX_Q31_5)
+    #include "Scalar/Q31/radix_Q31_5.h"
+  #endif
+  #if defined(RADIX_Q31_6)
+    #include "Scalar/Q31/radix_Q31_6.h"
+  #endif
+  #if defined(RADIX_Q31_8)
+    #include "Scalar/Q31/radix_Q31_8.h"
+  #endif
 #endif
 
 #ifdef DATATYPE_Q15
   #ifdef DSPE_Q15
-      #include "DSP/Q15/radix_Q15_2.h"
-      #include "DSP/Q15/radix_Q15_3.h"
-      #include "DSP/Q15/radix_Q15_4.h"
-      #include "DSP/Q15/radix_Q15_5.h"
-      #include "DSP/Q15/radix_Q15_6.h"
-      #include "DSP/Q15/radix_Q15_8.h"
+      #if defined(RADIX_Q15_2)
+        #include "DSP/Q15/radix_Q15_2.h"
+      #endif
+      #if defined(RADIX_Q15_3)
+        #include "DSP/Q15/radix_Q15_3.h"
+      #endif
+      #if defined(RADIX_Q15_4)
+        #include "DSP/Q15/radix_Q15_4.h"
+      #endif
+      #if defined(RADIX_Q15_5)
+        #include "DSP/Q15/radix_Q15_5.h"
+      #endif
+      #if defined(RADIX_Q15_6)
+        #include "DSP/Q15/radix_Q15_6.h"
+      #endif
+      #if defined(RADIX_Q15_8)
+        #include "DSP/Q15/radix_Q15_8.h"
+      #endif
   #else
-      #include "Scalar/Q15/radix_Q15_2.h"
-      #include "Scalar/Q15/radix_Q15_3.h"
-      #include "Scalar/Q15/radix_Q15_4.h"
-      #include "Scalar/Q15/radix_Q15_5.h"
-      #include "Scalar/Q15/radix_Q15_6.h"
-      #include "Scalar/Q15/radix_Q15_8.h"
+      #if defined(RADIX_Q15_2)
+        #include "Scalar/Q15/radix_Q15_2.h"
+      #endif
+      #if defined(RADIX_Q15_3)
+        #include "Scalar/Q15/radix_Q15_3.h"
+      #endif
+      #if defined(RADIX_Q15_4)
+        #include "Scalar/Q15/radix_Q15_4.h"
+      #endif
+      #if defined(RADIX_Q15_5)
+        #include "Scalar/Q15/radix_Q15_5.h"
+      #endif
+      #if defined(RADIX_Q15_6)
+        #include "Scalar/Q15/radix_Q15_6.h"
+      #endif
+      #if defined(RADIX_Q15_8)
+        #include "Scalar/Q15/radix_Q15_8.h"
+      #endif
   #endif
 #endif
 
 #ifdef DATATYPE_Q7
-  #include "Scalar/Q7/radix_Q7_2.h"
-  #include "Scalar/Q7/radix_Q7_3.h"
-  #include "Scalar/Q7/radix_Q7_4.h"
-  #include "Scalar/Q7/radix_Q7_5.h"
-  #include "Scalar/Q7/radix_Q7_6.h"
-  #include "Scalar/Q7/radix_Q7_8.h"
+  #ifdef DSPE_Q7
+      #if defined(RADIX_Q7_2)
+        #include "DSP/Q7/radix_Q7_2.h"
+      #endif
+      #if defined(RADIX_Q7_3)
+        #include "DSP/Q7/radix_Q7_3.h"
+      #endif
+      #if defined(RADIX_Q7_4)
+        #include "DSP/Q7/radix_Q7_4.h"
+      #endif
+      #if defined(RADIX_Q7_5)
+        #include "DSP/Q7/radix_Q7_5.h"
+      #endif
+      #if defined(RADIX_Q7_6)
+        #include "DSP/Q7/radix_Q7_6.h"
+      #endif
+      #if defined(RADIX_Q7_8)
+        #include "DSP/Q7/radix_Q7_8.h"
+      #endif
+  #else
+      #if defined(RADIX_Q7_2)
+        #include "Scalar/Q7/radix_Q7_2.h"
+      #endif
+      #if defined(RADIX_Q7_3)
+        #include "Scalar/Q7/radix_Q7_3.h"
+      #endif
+      #if defined(RADIX_Q7_4)
+        #include "Scalar/Q7/radix_Q7_4.h"
+      #endif
+      #if defined(RADIX_Q7_5)
+        #include "Scalar/Q7/radix_Q7_5.h"
+      #endif
+      #if defined(RADIX_Q7_6)
+        #include "Scalar/Q7/radix_Q7_6.h"
+      #endif
+      #if defined(RADIX_Q7_8)
+        #include "Scalar/Q7/radix_Q7_8.h"
+      #endif
+  #endif
 #endif
 
 #endif
\ No newline at end of file
@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Rational resampler in the frequency domain (overlap-save).
+
+A frame of nIn input samples is transformed with a RFFT of length nIn.
+The spectrum is truncated (nOut < nIn) or zero padded (nOut > nIn),
+and the frame is transformed back with a RIFFT of length nOut :
+the frame covers the same duration at the output rate.
+
+The bins near the band edge are attenuated with a raised cosine to
+limit the length of the equivalent filter. The first and last
+overlap/2 input samples of a frame are only used to avoid the
+circular effects : only the center of the output frame is kept.
+
+The gain and the truncation / zero padding of the spectrum are
+done by the RFFT merge step when it is reading the bins.
+
+*/
+
+#ifndef RESAMPLER_H
+#define RESAMPLER_H
+
+// Bin k of the modified spectrum
+template<typename T>
+__STATIC_FORCEINLINE complex<T> resampler_bin(const complex<T> *pX,const T *gain,unsigned int nbBins,unsigned int k)
+{
+    if (k <= nbBins)
+    {
+       return(pX[k] * gain[k]);
+    }
+    return(complex<T>(constant<T>::zero,constant<T>::zero));
+}
+
+// RFFT merge step of length n reading the modified spectrum
+template<typename T>
+void resampler_merge(const rfftconfig<T> *config,const T *in,const T *gain,unsigned int nbBins,T* tmp, unsigned int n)
+{
+    const unsigned int halflength = n >> 1;
+    const complex<T> *pX = (complex<T> *)in;
+    complex<T> *pTmp =(complex<T> *)tmp;
+    const complex<T> *pTwid =(complex<T> *)config->twiddle;
+
+    complex<T> a;
+    complex<T> b;
+    complex<FFTSCI::PROD<T>> f;
+    complex<FFTSCI::PROD<T>> g;
+
+    for(unsigned int i = 0; i < halflength; i++)
+    {
+       a=resampler_bin(pX,gain,nbBins,i);
+       b=conjugate(resampler_bin(pX,gain,nbBins,halflength - i));
+
+       f = widen<complex<T>>::run(a + b);
+       g = multconj((a - b) ,(pTwid[i]));
+
+       pTmp[i] = narrow<1,complex<T>>::run(f+g);
+    }
+}
+
+// Resample a frame of nIn samples and write the hopOut
+// samples of the center of the output frame
+template<typename T>
+void resampler_frame(const resamplerstate<T> *S,T *out)
+{
+    const rfftconfig<T> *config=rfft_config<T>(S->nOut);
+    const unsigned int first = (S->nOut - S->hopOut) >> 1;
+
+    rfft(S->frame,S->tmp,S->spectrum,S->nIn);
+
+    resampler_merge(config,S->spectrum,S->gain,S->nbBins,S->tmp,S->nOut);
+    inner_cifft<T,0>(S->tmp,S->tmp,S->nOut >> 1,0);
+
+    for(unsigned int i = 0; i < S->hopOut; i++)
+    {
+       out[i] = S->tmp[first + i];
+    }
+}
+
+template<typename T>
+uint32_t inner_resampler(resamplerstate<T> *S,const T *in,uint32_t nbSamples,T *out)
+{
+    const uint32_t overlap = S->nIn - S->hopIn;
+    uint32_t nbOut = 0;
+    uint32_t i = 0;
+
+    while (i < nbSamples)
+    {
+       uint32_t nb = S->nIn - S->pos;
+       if (nb > nbSamples - i)
+       {
+          nb = nbSamples - i;
+       }
+
+       for(uint32_t k = 0; k < nb; k++)
+       {
+          S->frame[S->pos + k] = in[i + k];
+       }
+       S->pos += nb;
+       i += nb;
+
+       if (S->pos == S->nIn)
+       {
+          resampler_frame(S,out + nbOut);
+          nbOut += S->hopOut;
+
+          // The end of the frame is the start of the next one
+          for(uint32_t k = 0; k < overlap; k++)
+          {
+             S->frame[k] = S->frame[S->hopIn + k];
+          }
+          S->pos = overlap;
+       }
+    }
+
+    return(nbOut);
+}
+
+#endif
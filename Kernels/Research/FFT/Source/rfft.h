@@ -28,6 +28,20 @@ Split/merge for the RFFT
 
 
 
+// One bin of the RFFT from the bins k and n/2-k (conjugated)
+// of the CFFT of length n/2
+template<typename T>
+__STATIC_FORCEINLINE complex<T> rfft_split_bin(const complex<T> a,const complex<T> b,const complex<T> w)
+{
+    complex<FFTSCI::PROD<T>> f;
+    complex<FFTSCI::PROD<T>> g;
+
+    f = widen<complex<T>>::run(a + b);
+    g = w * (a - b);
+
+    return(narrow<1,complex<T>>::run(f+g));
+}
+
 template<typename T>
 void rfft_split(const rfftconfig<T> *config,const T *tmp,T* out, unsigned int n)
 {
@@ -38,8 +52,6 @@ void rfft_split(const rfftconfig<T> *config,const T *tmp,T* out, unsigned int n)
     const complex<T> *pTwid =(complex<T> *)config->twiddle;
     complex<T> a;
     complex<T> b;
-    complex<FFTSCI::PROD<T>> f;
-    complex<FFTSCI::PROD<T>> g;
 
     a=pA[0];
     pOut[0] = complex<T>(a.real() + a.imag(),constant<T>::zero);
@@ -50,12 +62,9 @@ void rfft_split(const rfftconfig<T> *config,const T *tmp,T* out, unsigned int n)
     for(unsigned int i = 1; i < halflength; i++)
     {
        a=pA[i];
-       b=conjugate(pB[-i]);
-
-       f = widen<complex<T>>::run(a + b);
-       g = pTwid[i] * (a - b);
+       b=conjugate(pB[-(int)i]);
 
-       pOut[i] = narrow<1,complex<T>>::run(f+g);
+       pOut[i] = rfft_split_bin(a,b,pTwid[i]);
 
       
     }  
@@ -79,7 +88,7 @@ void rfft_merge(const rfftconfig<T> *config,const T *in,T* tmp, unsigned int n)
     for(unsigned int i = 0; i < halflength; i++)
     {
        a=pA[i];
-       b=conjugate(pB[-i]);
+       b=conjugate(pB[-(int)i]);
 
        f = widen<complex<T>>::run(a + b);
        g = multconj((a - b) ,(pTwid[i]));
@@ -92,4 +101,118 @@ void rfft_merge(const rfftconfig<T> *config,const T *in,T* tmp, unsigned int n)
 }
 
 
+/*
+
+Two real FFTs computed with one CFFT
+
+The two real signals are the real and imaginary parts of the input
+of the CFFT. With Z the output of the CFFT :
+
+X1[k] = (Z[k] + conj(Z[n-k])) / 2
+X2[k] = -i (Z[k] - conj(Z[n-k])) / 2
+
+There is no twiddle in this step.
+
+*/
+template<typename T>
+__STATIC_FORCEINLINE void rfft_pair_bin(const complex<T> a,const complex<T> b,complex<T> *out1,complex<T> *out2)
+{
+    const complex<FFTSCI::PROD<T>> f = widen<complex<T>>::run(a) + widen<complex<T>>::run(conjugate(b));
+    const complex<FFTSCI::PROD<T>> g = widen<complex<T>>::run(a) - widen<complex<T>>::run(conjugate(b));
+
+    *out1 = narrow<1,complex<T>>::run(f);
+    *out2 = narrow<1,complex<T>>::run(complex<FFTSCI::PROD<T>>(g.imag(),-g.real()));
+}
+
+// Bins k to n/2-1
+template<typename T>
+struct rfft_pair_split{
+  __STATIC_FORCEINLINE void run(const T *tmp,T* out1,T* out2,uint32_t n,uint32_t k)
+  {
+     const complex<T> *pZ = (const complex<T> *)tmp;
+     complex<T> *pOut1 =(complex<T> *)out1;
+     complex<T> *pOut2 =(complex<T> *)out2;
+
+     for(; k < (n >> 1); k++)
+     {
+        rfft_pair_bin(pZ[k],pZ[n - k],&pOut1[k],&pOut2[k]);
+     }
+  }
+};
+
+#if defined(HASVECTOR) && defined(VECTOR_F32)
+template<>
+struct rfft_pair_split<float32_t>{
+  // Load the complex samples p[0] to p[3] in reverse order
+  // with real and imaginary parts in different vectors
+  __STATIC_FORCEINLINE float32x4x2_t reversed(const float32_t *p)
+  {
+     float32x4x2_t v;
+#if defined(HELIUM_VECTOR)
+     const uint32x4_t offsets = vddupq_n_u32(6,2);
+
+     v.val[0] = vldrwq_gather_shifted_offset_f32(p,offsets);
+     v.val[1] = vldrwq_gather_shifted_offset_f32(p+1,offsets);
+#else
+     v = vld2q_f32(p);
+     v.val[0] = vrev64q_f32(v.val[0]);
+     v.val[0] = vcombine_f32(vget_high_f32(v.val[0]),vget_low_f32(v.val[0]));
+     v.val[1] = vrev64q_f32(v.val[1]);
+     v.val[1] = vcombine_f32(vget_high_f32(v.val[1]),vget_low_f32(v.val[1]));
+#endif
+     return(v);
+  }
+
+  __STATIC_FORCEINLINE void run(const float32_t *tmp,float32_t* out1,float32_t* out2,uint32_t n,uint32_t k)
+  {
+     float32x4x2_t a,b,x1,x2;
+     uint32_t blkCnt = ((n >> 1) - k) >> 2;
+
+     while(blkCnt > 0)
+     {
+        a = vld2q_f32(tmp + 2*k);
+        b = reversed(tmp + 2*(n - k - 3));
+
+        x1.val[0] = vmulq_n_f32(vaddq_f32(a.val[0],b.val[0]),0.5f);
+        x1.val[1] = vmulq_n_f32(vsubq_f32(a.val[1],b.val[1]),0.5f);
+        x2.val[0] = vmulq_n_f32(vaddq_f32(a.val[1],b.val[1]),0.5f);
+        x2.val[1] = vmulq_n_f32(vsubq_f32(b.val[0],a.val[0]),0.5f);
+
+        vst2q_f32(out1 + 2*k,x1);
+        vst2q_f32(out2 + 2*k,x2);
+
+        k += 4;
+        blkCnt--;
+     }
+
+     // Remaining bins
+     for(; k < (n >> 1); k++)
+     {
+        rfft_pair_bin(((const complex<float32_t> *)tmp)[k],((const complex<float32_t> *)tmp)[n - k],
+          &((complex<float32_t> *)out1)[k],&((complex<float32_t> *)out2)[k]);
+     }
+  }
+};
+#endif
+
+// tmp contains the permuted output of the CFFT of length n
+// (n is even)
+template<typename T>
+void rfft_pair_separate(const T *tmp,T* out1,T* out2, unsigned int n)
+{
+    const unsigned int halflength = n >> 1;
+    const complex<T> *pZ = (const complex<T> *)tmp;
+    complex<T> *pOut1 =(complex<T> *)out1;
+    complex<T> *pOut2 =(complex<T> *)out2;
+
+    pOut1[0] = complex<T>(pZ[0].real(),constant<T>::zero);
+    pOut2[0] = complex<T>(pZ[0].imag(),constant<T>::zero);
+
+    pOut1[halflength] = complex<T>(pZ[halflength].real(),constant<T>::zero);
+    pOut2[halflength] = complex<T>(pZ[halflength].imag(),constant<T>::zero);
+
+    rfft_pair_split<T>::run(tmp,out1,out2,n,1);
+}
+
+
 #endif
\ No newline at end of file
@@ -0,0 +1,292 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Scheduler of FFT jobs on a pool of worker threads (FFT_THREADS).
+
+A job is a plan of any datatype with its input and output.
+The submission queue is a lock-free stack : the producers push
+their jobs with a compare and swap and a worker takes the whole
+stack with an exchange (no ABA problem since single jobs are
+never popped).
+
+The worker taking the stack groups the jobs using the same plan
+into batches (the twiddles and permutations of the plan stay in
+the cache for the whole batch) and appends them to its own queue.
+An idle worker takes the oldest batch of its queue or steals the
+newest batch of the queue of another worker.
+
+Without FFT_THREADS (or if no thread can be created) the jobs
+are executed by the caller when they are submitted. With FFT_THREADS
+and no worker, the callers are serialized since there is only one
+scratch for all of them.
+
+*/
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+// Maximum number of jobs in a batch
+#if !defined(FFT_SCHEDULER_MAX_BATCH)
+#define FFT_SCHEDULER_MAX_BATCH 8
+#endif
+
+template<typename T>
+arm_status fft_job_execute(const void *plan,const void *in,void *out,void *scratch,uint32_t scratchBytes)
+{
+    return(fft_execute((const fftplan<T> *)plan,(const T *)in,(T *)out,(T *)scratch,scratchBytes / sizeof(T)));
+}
+
+// Run the jobs of a batch. The next job is read before the job is
+// marked as done since the job can be reused as soon as it is done.
+static void fft_scheduler_run(fftscheduler *S,void *scratch,fftjob *job)
+{
+    fftjob *next;
+
+    while(job)
+    {
+       next = job->next;
+
+       job->status = job->execute(job->plan,job->in,job->out,scratch,S->scratchBytes);
+       if (job->callback)
+       {
+          job->callback(job,job->context);
+       }
+
+#if defined(FFT_THREADS)
+       pthread_mutex_lock(&S->doneLock);
+       __atomic_store_n(&job->done,1,__ATOMIC_RELEASE);
+       pthread_cond_broadcast(&S->doneCond);
+       pthread_mutex_unlock(&S->doneLock);
+#else
+       job->done = 1;
+#endif
+
+       job = next;
+    }
+}
+
+#if defined(FFT_THREADS)
+// Append a batch to the queue of a worker (lock taken)
+static void fft_worker_append(fftworker *w,fftjob *batch)
+{
+    batch->nextBatch = NULL;
+    batch->prevBatch = w->tail;
+    if (w->tail)
+    {
+       w->tail->nextBatch = batch;
+    }
+    else
+    {
+       w->head = batch;
+    }
+    w->tail = batch;
+}
+
+// Oldest batch of the queue of the worker
+static fftjob *fft_worker_pop(fftworker *w)
+{
+    fftjob *batch;
+
+    pthread_mutex_lock(&w->lock);
+    batch = w->head;
+    if (batch)
+    {
+       w->head = batch->nextBatch;
+       if (w->head)
+       {
+          w->head->prevBatch = NULL;
+       }
+       else
+       {
+          w->tail = NULL;
+       }
+    }
+    pthread_mutex_unlock(&w->lock);
+
+    return(batch);
+}
+
+// Newest batch of the queue of another worker
+static fftjob *fft_worker_steal(fftworker *w)
+{
+    fftjob *batch;
+
+    pthread_mutex_lock(&w->lock);
+    batch = w->tail;
+    if (batch)
+    {
+       w->tail = batch->prevBatch;
+       if (w->tail)
+       {
+          w->tail->nextBatch = NULL;
+       }
+       else
+       {
+          w->head = NULL;
+       }
+    }
+    pthread_mutex_unlock(&w->lock);
+
+    return(batch);
+}
+
+// Take the submitted jobs and group them into batches
+// in the queue of the worker
+static void fft_worker_grab(fftscheduler *S,fftworker *w)
+{
+    fftjob *job = __atomic_exchange_n(&S->submitted,(fftjob *)NULL,__ATOMIC_ACQUIRE);
+    fftjob *fifo = NULL;
+    fftjob *first = NULL;
+    fftjob *last = NULL;
+    fftjob *next;
+    fftjob *b;
+    uint32_t nbBatches = 0;
+
+    // The stack is in reverse order of submission
+    while(job)
+    {
+       next = job->next;
+       job->next = fifo;
+       fifo = job;
+       job = next;
+    }
+
+    // Batches are linked with nextBatch while they are built
+    for(job = fifo; job; job = next)
+    {
+       next = job->next;
+       job->next = NULL;
+
+       for(b = first; b; b = b->nextBatch)
+       {
+          if ((b->plan == job->plan) && (b->batchSize < FFT_SCHEDULER_MAX_BATCH))
+          {
+             break;
+          }
+       }
+
+       if (b)
+       {
+          b->batchLast->next = job;
+          b->batchLast = job;
+          b->batchSize++;
+       }
+       else
+       {
+          job->batchLast = job;
+          job->batchSize = 1;
+          job->nextBatch = NULL;
+          if (last)
+          {
+             last->nextBatch = job;
+          }
+          else
+          {
+             first = job;
+          }
+          last = job;
+          nbBatches++;
+       }
+    }
+
+    if (nbBatches == 0)
+    {
+       return;
+    }
+
+    pthread_mutex_lock(&w->lock);
+    for(b = first; b; b = next)
+    {
+       next = b->nextBatch;
+       fft_worker_append(w,b);
+    }
+    pthread_mutex_unlock(&w->lock);
+
+    // Wake up other workers to steal the other batches
+    for(uint32_t i = 1; i < nbBatches; i++)
+    {
+       sem_post(&S->wake);
+    }
+}
+
+static fftjob *fft_worker_batch(fftscheduler *S,fftworker *w)
+{
+    fftjob *batch = fft_worker_pop(w);
+
+    if (batch)
+    {
+       return(batch);
+    }
+
+    if (__atomic_load_n(&S->submitted,__ATOMIC_RELAXED))
+    {
+       fft_worker_grab(S,w);
+       batch = fft_worker_pop(w);
+       if (batch)
+       {
+          return(batch);
+       }
+    }
+
+    const uint32_t nbWorkers = __atomic_load_n(&S->nbWorkers,__ATOMIC_ACQUIRE);
+
+    for(uint32_t i = 1; i < nbWorkers; i++)
+    {
+       fftworker *victim = &S->workers[(w->id + i) % nbWorkers];
+
+       batch = fft_worker_steal(victim);
+       if (batch)
+       {
+          return(batch);
+       }
+    }
+
+    return(NULL);
+}
+
+static void *fft_worker_entry(void *args)
+{
+    fftworker *w = (fftworker *)args;
+    fftscheduler *S = w->scheduler;
+    fftjob *batch;
+
+    for(;;)
+    {
+       batch = fft_worker_batch(S,w);
+       if (batch)
+       {
+          fft_scheduler_run(S,w->scratch,batch);
+          continue;
+       }
+
+       if (__atomic_load_n(&S->stopping,__ATOMIC_ACQUIRE))
+       {
+          break;
+       }
+
+       sem_wait(&S->wake);
+    }
+
+    return(NULL);
+}
+#endif
+
+#endif
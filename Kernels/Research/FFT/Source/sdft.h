@@ -0,0 +1,208 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Sliding DFT
+
+Modulated sliding DFT : the accumulator of bin k is
+
+A_k = sum x[t] w^(k t) on the last n samples t
+
+where w = exp(-2 i pi / n) and t is the absolute sample index.
+When a new sample is received, the sample leaving the window has
+the same twiddle w^(k t) so the update is
+
+A_k = A_k + (x[t] - x[t - n]) w^(k t)
+
+There is no recursive multiplication by a twiddle, so the
+rounding errors are not amplified. But each update still adds
+a rounding error to the accumulator and those errors are never
+removed : they random-walk and grow like the square root of the
+number of samples received.
+
+In fixed point, the difference and the product are exact in the
+PROD<T> accumulator : the samples leaving the window are exactly
+removed and the accumulator never drifts.
+
+In float32, the accumulators would drift by about 1e-4 (relative
+to the full scale) after 65536 samples and 1e-3 after 10M samples.
+So they are recomputed from the delay line at the end of each
+window (sdftresync) : the drift is bounded to the errors of
+the n last updates.
+
+The bin is then A_k w^(-k (t+1)).
+
+*/
+
+#ifndef SDFT_H
+#define SDFT_H
+
+/*
+
+Input scaling.
+In fixed point, the input is shifted so that the accumulators
+cannot overflow. The output bins are the DFT divided by 2^shift.
+
+*/
+template<typename T>
+struct sdftinput{
+  static int shift(uint32_t n)
+  {
+     int s = 0;
+     while((1UL << s) < n)
+     {
+        s++;
+     }
+     return(s);
+  }
+
+  __STATIC_FORCEINLINE T run(const T v,const int shift)
+  {
+     return(decq(v,shift));
+  }
+};
+
+template<>
+struct sdftinput<float32_t>{
+  static int shift(uint32_t n)
+  {
+     (void)n;
+     return(0);
+  }
+
+  __STATIC_FORCEINLINE float32_t run(const float32_t v,const int shift)
+  {
+     (void)shift;
+     return(v);
+  }
+};
+
+/*
+
+Resynchronization of the accumulators at the end of a window
+(when the position in the delay line is back to 0).
+
+The sample delay[p] has the twiddle w^(k p) so the accumulator
+is recomputed as A_k = sum delay[p] w^(k p).
+The cost of a resynchronization is the cost of n updates :
+the average cost of an update is doubled in float32.
+
+In fixed point, the accumulators are exact : nothing is done.
+
+*/
+template<typename T>
+struct sdftresync{
+  __STATIC_FORCEINLINE void run(sdftstate<T> *S)
+  {
+     (void)S;
+  }
+};
+
+template<>
+struct sdftresync<float32_t>{
+  __STATIC_FORCEINLINE void run(sdftstate<float32_t> *S)
+  {
+     complex<float32_t> *acc = (complex<float32_t> *)S->acc;
+     const complex<float32_t> *twid = S->twiddle;
+     const uint32_t n = S->n;
+
+     for(uint32_t b = 0; b < S->nbBins; b++)
+     {
+        const uint32_t k = S->bins[b];
+        float32_t accr = 0.0f, acci = 0.0f;
+        uint32_t index = 0;
+
+        for(uint32_t p = 0; p < n; p++)
+        {
+           accr += S->delay[p] * twid[index].real();
+           acci += S->delay[p] * twid[index].imag();
+
+           index += k;
+           if (index >= n)
+           {
+              index -= n;
+           }
+        }
+
+        acc[b] = complex<float32_t>(accr,acci);
+     }
+  }
+};
+
+template<typename T>
+struct sdft{
+  typedef typename sdftacc<T>::type acc_t;
+
+  static void update(sdftstate<T> *S,const T *in,uint32_t nbSamples)
+  {
+     complex<acc_t> *acc = (complex<acc_t> *)S->acc;
+     const complex<T> *twid = S->twiddle;
+     const uint32_t n = S->n;
+     uint32_t pos = S->pos;
+     complex<T> w;
+     T x,d;
+
+     for(uint32_t i = 0; i < nbSamples; i++)
+     {
+        x = sdftinput<T>::run(in[i],S->shift);
+        d = x - S->delay[pos];
+        S->delay[pos] = x;
+
+        for(uint32_t b = 0; b < S->nbBins; b++)
+        {
+           uint32_t phase = S->phase[b];
+
+           w = twid[phase];
+           acc[b] = acc[b] + complex<acc_t>(d * w.real(),d * w.imag());
+
+           phase += S->bins[b];
+           if (phase >= n)
+           {
+              phase -= n;
+           }
+           S->phase[b] = phase;
+        }
+
+        pos++;
+        if (pos == n)
+        {
+           pos = 0;
+           sdftresync<T>::run(S);
+        }
+     }
+
+     S->pos = pos;
+  }
+
+  static void bins(const sdftstate<T> *S,T *out)
+  {
+     const complex<acc_t> *acc = (const complex<acc_t> *)S->acc;
+     complex<T> *cout = (complex<T> *)out;
+     complex<T> a;
+
+     for(uint32_t b = 0; b < S->nbBins; b++)
+     {
+        a = FFTSCI::narrow<NORMALNARROW,complex<T>>::run(acc[b]);
+        cout[b] = FFTSCI::narrow<NORMALNARROW,complex<T>>::run(multconj(a,S->twiddle[S->phase[b]]));
+     }
+  }
+};
+
+#endif
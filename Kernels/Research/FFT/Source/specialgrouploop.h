@@ -33,14 +33,14 @@ struct loopcore<mode,T,2,FIRST,inputstrideenabled,0>{
                 complex<T> *in,
                 complex<T> *out,
                 const int stride,
-                const complex<T> *twid,
+                const complex<TWID<T>> *twid,
                 int inputstride
                 )
      {    
           (void)stride;
           (void)n;
-          complex<T> *p = (complex<T> *)twid;
-          complex<T> wb;
+          complex<TWID<T>> *p = (complex<TWID<T>> *)twid;
+          complex<TWID<T>> wb;
           const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
 
           if ((stageLength & 1) == 0)
@@ -0,0 +1,290 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Pointwise operations on spectra : a * b, a * conj(b) and acc + a * b.
+
+The spectra are arrays of complex values. The spectrum of a rfft of
+length n has n/2+1 bins (n+2 values) : the bins 0 and n/2 are stored
+as complex values with a zero imaginary part so the same kernels
+are used with nbBins = n/2+1.
+
+In fixed point, the products are saturated to the datatype
+and the accumulation is saturating.
+
+*/
+
+#ifndef SPECTRUM_H
+#define SPECTRUM_H
+
+#define SPECTRUM_MUL 0
+#define SPECTRUM_MULCONJ 1
+#define SPECTRUM_MAC 2
+
+// Operations on one bin (fixed point)
+// narrow is not saturating when NOSAT is defined (for the FFT kernels)
+// so the products are saturated here.
+template<typename T>
+struct spectrumop{
+  __STATIC_FORCEINLINE complex<T> satprod(const complex<FFTSCI::PROD<T>> p)
+  {
+     const FFTSCI::PROD<T> re(p.real().value >> FFTSCI::QPRODUCT<T>::shift);
+     const FFTSCI::PROD<T> im(p.imag().value >> FFTSCI::QPRODUCT<T>::shift);
+
+     return(complex<T>(FFTSCI::sat<T>(re),FFTSCI::sat<T>(im)));
+  }
+
+  __STATIC_FORCEINLINE complex<T> mul(const complex<T> a,const complex<T> b)
+  {
+     return(satprod(a * b));
+  }
+
+  __STATIC_FORCEINLINE complex<T> mulconj(const complex<T> a,const complex<T> b)
+  {
+     return(satprod(multconj(a,b)));
+  }
+
+  __STATIC_FORCEINLINE complex<T> add(const complex<T> a,const complex<T> b)
+  {
+     const FFTSCI::PROD<T> re((FFTSCI::PRODSTORAGE<T>)a.real().value + b.real().value);
+     const FFTSCI::PROD<T> im((FFTSCI::PRODSTORAGE<T>)a.imag().value + b.imag().value);
+
+     return(complex<T>(FFTSCI::sat<T>(re),FFTSCI::sat<T>(im)));
+  }
+};
+
+template<typename T>
+struct spectrumopfloat{
+  __STATIC_FORCEINLINE complex<T> mul(const complex<T> a,const complex<T> b)
+  {
+     return(a * b);
+  }
+
+  __STATIC_FORCEINLINE complex<T> mulconj(const complex<T> a,const complex<T> b)
+  {
+     return(multconj(a,b));
+  }
+
+  __STATIC_FORCEINLINE complex<T> add(const complex<T> a,const complex<T> b)
+  {
+     return(a + b);
+  }
+};
+
+template<>
+struct spectrumop<float32_t>:spectrumopfloat<float32_t>{};
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+template<>
+struct spectrumop<float16_t>:spectrumopfloat<float16_t>{};
+#endif
+
+// There is no product type for float64_t
+template<>
+struct spectrumop<float64_t>{
+  __STATIC_FORCEINLINE complex<float64_t> mul(const complex<float64_t> a,const complex<float64_t> b)
+  {
+     return(complex<float64_t>(a.re * b.re - a.im * b.im,a.re * b.im + a.im * b.re));
+  }
+
+  __STATIC_FORCEINLINE complex<float64_t> mulconj(const complex<float64_t> a,const complex<float64_t> b)
+  {
+     return(complex<float64_t>(a.re * b.re + a.im * b.im,a.im * b.re - a.re * b.im));
+  }
+
+  __STATIC_FORCEINLINE complex<float64_t> add(const complex<float64_t> a,const complex<float64_t> b)
+  {
+     return(a + b);
+  }
+};
+
+// One bin of the operation op
+template<typename T,int op>
+struct spectrumbin;
+
+template<typename T>
+struct spectrumbin<T,SPECTRUM_MUL>{
+  __STATIC_FORCEINLINE complex<T> run(const complex<T> a,const complex<T> b,const complex<T> acc)
+  {
+     (void)acc;
+     return(spectrumop<T>::mul(a,b));
+  }
+};
+
+template<typename T>
+struct spectrumbin<T,SPECTRUM_MULCONJ>{
+  __STATIC_FORCEINLINE complex<T> run(const complex<T> a,const complex<T> b,const complex<T> acc)
+  {
+     (void)acc;
+     return(spectrumop<T>::mulconj(a,b));
+  }
+};
+
+template<typename T>
+struct spectrumbin<T,SPECTRUM_MAC>{
+  __STATIC_FORCEINLINE complex<T> run(const complex<T> a,const complex<T> b,const complex<T> acc)
+  {
+     return(spectrumop<T>::add(acc,spectrumop<T>::mul(a,b)));
+  }
+};
+
+// out can be a or b (or acc for the MAC)
+template<typename T,int op,int vectormode>
+struct spectrumloop{
+  __STATIC_FORCEINLINE void run(const T *a,const T *b,T *out,uint32_t nbBins)
+  {
+     const complex<T> *pA = (const complex<T> *)a;
+     const complex<T> *pB = (const complex<T> *)b;
+     complex<T> *pOut = (complex<T> *)out;
+
+     for(uint32_t k = 0; k < nbBins; k++)
+     {
+        pOut[k] = spectrumbin<T,op>::run(pA[k],pB[k],pOut[k]);
+     }
+  }
+};
+
+#if defined(HASVECTOR) && defined(VECTOR_F32)
+template<int op>
+struct spectrumvectorf32;
+
+template<>
+struct spectrumvectorf32<SPECTRUM_MUL>{
+  __STATIC_FORCEINLINE float32x4x2_t run(const float32x4x2_t a,const float32x4x2_t b,const float32_t *acc)
+  {
+     float32x4x2_t r;
+     (void)acc;
+
+     r.val[0] = vsubq_f32(vmulq_f32(a.val[0],b.val[0]),vmulq_f32(a.val[1],b.val[1]));
+     r.val[1] = vaddq_f32(vmulq_f32(a.val[0],b.val[1]),vmulq_f32(a.val[1],b.val[0]));
+     return(r);
+  }
+};
+
+template<>
+struct spectrumvectorf32<SPECTRUM_MULCONJ>{
+  __STATIC_FORCEINLINE float32x4x2_t run(const float32x4x2_t a,const float32x4x2_t b,const float32_t *acc)
+  {
+     float32x4x2_t r;
+     (void)acc;
+
+     r.val[0] = vaddq_f32(vmulq_f32(a.val[0],b.val[0]),vmulq_f32(a.val[1],b.val[1]));
+     r.val[1] = vsubq_f32(vmulq_f32(a.val[1],b.val[0]),vmulq_f32(a.val[0],b.val[1]));
+     return(r);
+  }
+};
+
+template<>
+struct spectrumvectorf32<SPECTRUM_MAC>{
+  __STATIC_FORCEINLINE float32x4x2_t run(const float32x4x2_t a,const float32x4x2_t b,const float32_t *acc)
+  {
+     float32x4x2_t r = vld2q_f32(acc);
+     const float32x4x2_t p = spectrumvectorf32<SPECTRUM_MUL>::run(a,b,acc);
+
+     r.val[0] = vaddq_f32(r.val[0],p.val[0]);
+     r.val[1] = vaddq_f32(r.val[1],p.val[1]);
+     return(r);
+  }
+};
+
+template<int op>
+struct spectrumloop<float32_t,op,1>{
+  __STATIC_FORCEINLINE void run(const float32_t *a,const float32_t *b,float32_t *out,uint32_t nbBins)
+  {
+     uint32_t blkCnt = nbBins >> 2;
+
+     while(blkCnt > 0)
+     {
+        vst2q_f32(out,spectrumvectorf32<op>::run(vld2q_f32(a),vld2q_f32(b),out));
+        a += 8;
+        b += 8;
+        out += 8;
+        blkCnt--;
+     }
+
+     spectrumloop<float32_t,op,0>::run(a,b,out,nbBins & 3);
+  }
+};
+#endif
+
+#if defined(HELIUM_VECTOR) && defined(VECTOR_F16)
+template<int op>
+struct spectrumvectorf16;
+
+template<>
+struct spectrumvectorf16<SPECTRUM_MUL>{
+  __STATIC_FORCEINLINE float16x8x2_t run(const float16x8x2_t a,const float16x8x2_t b,const float16_t *acc)
+  {
+     float16x8x2_t r;
+     (void)acc;
+
+     r.val[0] = vsubq_f16(vmulq_f16(a.val[0],b.val[0]),vmulq_f16(a.val[1],b.val[1]));
+     r.val[1] = vaddq_f16(vmulq_f16(a.val[0],b.val[1]),vmulq_f16(a.val[1],b.val[0]));
+     return(r);
+  }
+};
+
+template<>
+struct spectrumvectorf16<SPECTRUM_MULCONJ>{
+  __STATIC_FORCEINLINE float16x8x2_t run(const float16x8x2_t a,const float16x8x2_t b,const float16_t *acc)
+  {
+     float16x8x2_t r;
+     (void)acc;
+
+     r.val[0] = vaddq_f16(vmulq_f16(a.val[0],b.val[0]),vmulq_f16(a.val[1],b.val[1]));
+     r.val[1] = vsubq_f16(vmulq_f16(a.val[1],b.val[0]),vmulq_f16(a.val[0],b.val[1]));
+     return(r);
+  }
+};
+
+template<>
+struct spectrumvectorf16<SPECTRUM_MAC>{
+  __STATIC_FORCEINLINE float16x8x2_t run(const float16x8x2_t a,const float16x8x2_t b,const float16_t *acc)
+  {
+     float16x8x2_t r = vld2q_f16(acc);
+     const float16x8x2_t p = spectrumvectorf16<SPECTRUM_MUL>::run(a,b,acc);
+
+     r.val[0] = vaddq_f16(r.val[0],p.val[0]);
+     r.val[1] = vaddq_f16(r.val[1],p.val[1]);
+     return(r);
+  }
+};
+
+template<int op>
+struct spectrumloop<float16_t,op,1>{
+  __STATIC_FORCEINLINE void run(const float16_t *a,const float16_t *b,float16_t *out,uint32_t nbBins)
+  {
+     uint32_t blkCnt = nbBins >> 3;
+
+     while(blkCnt > 0)
+     {
+        vst2q_f16(out,spectrumvectorf16<op>::run(vld2q_f16(a),vld2q_f16(b),out));
+        a += 16;
+        b += 16;
+        out += 16;
+        blkCnt--;
+     }
+
+     spectrumloop<float16_t,op,0>::run(a,b,out,nbBins & 7);
+  }
+};
+#endif
+
+#endif
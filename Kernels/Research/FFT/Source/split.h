@@ -0,0 +1,174 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Split complex format (real and imaginary parts in different arrays).
+
+Without vector kernels, the first stage of the FFT is reading
+the real and imaginary arrays directly. So, there is no
+interleaving pass before the FFT.
+With vector kernels, the scalar first stage would be slower
+than an interleaving pass (vst2) followed by the vector FFT.
+
+The other stages are working in place on an interleaved buffer
+and the output is deinterleaved after the permutation.
+
+There are no radix kernels working directly on the split
+format (they would need their own twiddle layout) : they are
+not implemented yet.
+
+*/
+
+#ifndef SPLIT_H
+#define SPLIT_H
+
+/*
+
+Conversion between split and interleaved formats
+
+*/
+template<typename T>
+struct interleave{
+  __STATIC_FORCEINLINE void run(const T *re,const T *im,T *out,uint32_t n)
+  {
+     complex<T> *pOut = (complex<T> *)out;
+     for(uint32_t i = 0; i < n; i++)
+     {
+        memory<complex<T>>::store(pOut,i,complex<T>(re[i],im[i]));
+     }
+  }
+};
+
+template<typename T>
+struct deinterleave{
+  __STATIC_FORCEINLINE void run(const T *in,T *re,T *im,uint32_t n)
+  {
+     const complex<T> *pIn = (const complex<T> *)in;
+     complex<T> a;
+     for(uint32_t i = 0; i < n; i++)
+     {
+        a = memory<complex<T>>::load(pIn,i);
+        re[i] = a.real();
+        im[i] = a.imag();
+     }
+  }
+};
+
+/*
+
+The vld2 / vst2 are doing the conversion and have the
+same name with Helium and Neon.
+
+*/
+#if defined(HASVECTOR) && defined(VECTOR_F32)
+template<>
+struct interleave<float32_t>{
+  __STATIC_FORCEINLINE void run(const float32_t *re,const float32_t *im,float32_t *out,uint32_t n)
+  {
+     uint32_t blkCnt = n >> 2;
+     float32x4x2_t v;
+     while(blkCnt > 0)
+     {
+        v.val[0] = vld1q_f32(re);
+        v.val[1] = vld1q_f32(im);
+        vst2q_f32(out,v);
+        re += 4;
+        im += 4;
+        out += 8;
+        blkCnt--;
+     }
+
+     blkCnt = n & 3;
+     while(blkCnt > 0)
+     {
+        *out++ = *re++;
+        *out++ = *im++;
+        blkCnt--;
+     }
+  }
+};
+
+template<>
+struct deinterleave<float32_t>{
+  __STATIC_FORCEINLINE void run(const float32_t *in,float32_t *re,float32_t *im,uint32_t n)
+  {
+     uint32_t blkCnt = n >> 2;
+     float32x4x2_t v;
+     while(blkCnt > 0)
+     {
+        v = vld2q_f32(in);
+        vst1q_f32(re,v.val[0]);
+        vst1q_f32(im,v.val[1]);
+        re += 4;
+        im += 4;
+        in += 8;
+        blkCnt--;
+     }
+
+     blkCnt = n & 3;
+     while(blkCnt > 0)
+     {
+        *re++ = *in++;
+        *im++ = *in++;
+        blkCnt--;
+     }
+  }
+};
+#endif
+
+/*
+
+Loader for the first stage reading the split input
+
+*/
+template<typename T>
+struct splitloader{
+  const T *re;
+  const T *im;
+
+  __FORCE_INLINE complex<T> load(int i) const
+  {
+     return(complex<T>(re[i],im[i]));
+  }
+};
+
+// FFT of the split input.
+// The output is interleaved and not permuted.
+template<int mode,typename T,int vectormode>
+struct splitfft{
+  __STATIC_FORCEINLINE void run(const cfftconfig<T> *config,int n,const T *re,const T *im,T *out)
+  {
+     const splitloader<T> loader={re,im};
+
+     fftload<mode,T,splitloader<T>>::run(config,n,loader,(complex<T>*)out);
+  }
+};
+
+template<int mode,typename T>
+struct splitfft<mode,T,1>{
+  __STATIC_FORCEINLINE void run(const cfftconfig<T> *config,int n,const T *re,const T *im,T *out)
+  {
+     interleave<T>::run(re,im,out,n);
+
+     fft<mode,T,0>::run(config,n,(complex<T>*)out,(complex<T>*)out,0);
+  }
+};
+
+#endif
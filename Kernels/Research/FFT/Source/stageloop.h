@@ -37,7 +37,7 @@ struct loop{
     int stride,
     complex<T> *in,
     complex<T> *out,
-    const complex<T> *twid,
+    const complex<TWID<T>> *twid,
     int inputstride)
   {
     int stage;
@@ -51,7 +51,7 @@ struct loop{
           #endif
 
           int stageLength = lengths[stage];
-          stride=loopcore<mode,T,factor,NORMAL,inputstrideenabled,vector<T>::vector_enabled>::run(n,stageLength,out,out,stride,twid,inputstride);
+          stride=loopcore<mode,T,factor,NORMAL,inputstrideenabled,radixvectorized<T,factor>::value>::run(n,stageLength,out,out,stride,twid,inputstride);
     }
     return(stride);
   }
@@ -70,7 +70,7 @@ struct loop<mode,T,STARTONLY,factor,inputstrideenabled>{
     int stride,
     complex<T> *in,
     complex<T> *out,
-    const complex<T> *twid,
+    const complex<TWID<T>> *twid,
     int inputstride)
    {
     int stage;
@@ -79,7 +79,7 @@ struct loop<mode,T,STARTONLY,factor,inputstrideenabled>{
     #if defined(DEBUG)
              printf("  first stage 0\n");
     #endif
-    stride=loopcore<mode,T,factor,FIRST,inputstrideenabled,vector<T>::vector_enabled>::run(n,stageLength,in,out,stride,twid,inputstride);
+    stride=loopcore<mode,T,factor,FIRST,inputstrideenabled,radixvectorized<T,factor>::value>::run(n,stageLength,in,out,stride,twid,inputstride);
 
     for(stage = 1; stage < nbFactors; stage ++)
     {
@@ -88,7 +88,7 @@ struct loop<mode,T,STARTONLY,factor,inputstrideenabled>{
           #endif
 
           stageLength = lengths[stage];
-          stride=loopcore<mode,T,factor,NORMAL,inputstrideenabled,vector<T>::vector_enabled>::run(n,stageLength,out,out,stride,twid,inputstride);
+          stride=loopcore<mode,T,factor,NORMAL,inputstrideenabled,radixvectorized<T,factor>::value>::run(n,stageLength,out,out,stride,twid,inputstride);
     }
     return(stride);
   }
@@ -107,7 +107,7 @@ struct loop<mode,T,ENDONLY,factor,inputstrideenabled>{
     int stride,
     complex<T> *in,
     complex<T> *out,
-    const complex<T> *twid,
+    const complex<TWID<T>> *twid,
     int inputstride)
   {
     int stage;
@@ -123,7 +123,7 @@ struct loop<mode,T,ENDONLY,factor,inputstrideenabled>{
           #endif
 
           stageLength = lengths[stage];
-          stride=loopcore<mode,T,factor,NORMAL,inputstrideenabled,vector<T>::vector_enabled>::run(n,stageLength,out,out,stride,twid,inputstride);
+          stride=loopcore<mode,T,factor,NORMAL,inputstrideenabled,radixvectorized<T,factor>::value>::run(n,stageLength,out,out,stride,twid,inputstride);
     }
 
     stageLength = lengths[stage];
@@ -149,7 +149,7 @@ struct loop<mode,T,BOTH,factor,inputstrideenabled>{
     int stride,
     complex<T> *in,
     complex<T> *out,
-    const complex<T> *twid,
+    const complex<TWID<T>> *twid,
     int inputstride)
   {
     int stage;
@@ -159,7 +159,7 @@ struct loop<mode,T,BOTH,factor,inputstrideenabled>{
     #if defined(DEBUG)
              printf("  first stage 0\n");
     #endif
-    stride=loopcore<mode,T,factor,FIRST,inputstrideenabled,vector<T>::vector_enabled>::run(n,stageLength,in,out,stride,twid,inputstride);
+    stride=loopcore<mode,T,factor,FIRST,inputstrideenabled,radixvectorized<T,factor>::value>::run(n,stageLength,in,out,stride,twid,inputstride);
 
     for(stage = 1; stage < nbFactors-1; stage ++)
     {
@@ -168,7 +168,7 @@ struct loop<mode,T,BOTH,factor,inputstrideenabled>{
           #endif
 
           stageLength = lengths[stage];
-          stride=loopcore<mode,T,factor,NORMAL,inputstrideenabled,vector<T>::vector_enabled>::run(n,stageLength,out,out,stride,twid,inputstride);
+          stride=loopcore<mode,T,factor,NORMAL,inputstrideenabled,radixvectorized<T,factor>::value>::run(n,stageLength,out,out,stride,twid,inputstride);
     }
 
     stageLength = lengths[stage];
@@ -194,7 +194,7 @@ struct loop<mode,T,ONESTAGE,factor,inputstrideenabled>{
     int stride,
     complex<T> *in,
     complex<T> *out,
-    const complex<T> *twid,
+    const complex<TWID<T>> *twid,
     int inputstride)
   {
     (void)nbFactors;
@@ -211,6 +211,47 @@ struct loop<mode,T,ONESTAGE,factor,inputstrideenabled>{
 };
 
 
+// Run the stages for one radix.
+// The radix not used by the lengths of the datatype (kernels.h generated
+// by configgen.py) are not instantiated. A factor of config.cpp reaching
+// one of those cases is prevented by the static_assert of fft.cpp.
+template <int mode,typename T, int loopmode,int factor,int inputstrideenabled,int used=radixused<T,factor>::value>
+struct factorCase{
+  __STATIC_FORCEINLINE int run(const uint16_t *lengths,
+    const int n,
+    const int nbFactors,
+    int stride,
+    complex<T> *in,
+    complex<T> *out,
+    const complex<TWID<T>> *twid,
+    int inputstride)
+  {
+    return(loop<mode,T,loopmode,factor,inputstrideenabled>::run(lengths,n,nbFactors,stride,in,out,twid,inputstride));
+  }
+};
+
+template <int mode,typename T, int loopmode,int factor,int inputstrideenabled>
+struct factorCase<mode,T,loopmode,factor,inputstrideenabled,0>{
+  __STATIC_FORCEINLINE int run(const uint16_t *lengths,
+    const int n,
+    const int nbFactors,
+    int stride,
+    complex<T> *in,
+    complex<T> *out,
+    const complex<TWID<T>> *twid,
+    int inputstride)
+  {
+    (void)lengths;
+    (void)n;
+    (void)nbFactors;
+    (void)in;
+    (void)out;
+    (void)twid;
+    (void)inputstride;
+    return(stride);
+  }
+};
+
 // Select the radix.
 // If new radix are added to the kernels and python, this switch / case must be
 // modified and the new radix added here too.
@@ -225,7 +266,7 @@ struct factorSwitch{
     const int stride,
     complex<T> *in,
     complex<T> *out,
-    const complex<T> *twid,
+    const complex<TWID<T>> *twid,
     int inputstride)
   {
      // nbFactors is the exponent
@@ -238,37 +279,37 @@ struct factorSwitch{
         {
           #if defined(RADIX2)
             case 2:
-              return(loop<mode,T,loopmode,2,inputstrideenabled>::run(&config->lengths[stage],n,nbFactors,stride,in,out,twid,inputstride));
+              return(factorCase<mode,T,loopmode,2,inputstrideenabled>::run(&config->lengths[stage],n,nbFactors,stride,in,out,twid,inputstride));
             break;
           #endif
             
           #if defined(RADIX3)
             case 3:
-              return(loop<mode,T,loopmode,3,inputstrideenabled>::run(&config->lengths[stage],n,nbFactors,stride,in,out,twid,inputstride));
+              return(factorCase<mode,T,loopmode,3,inputstrideenabled>::run(&config->lengths[stage],n,nbFactors,stride,in,out,twid,inputstride));
             break;
           #endif
             
           #if defined(RADIX4)
             case 4:
-              return(loop<mode,T,loopmode,4,inputstrideenabled>::run(&config->lengths[stage],n,nbFactors,stride,in,out,twid,inputstride));
+              return(factorCase<mode,T,loopmode,4,inputstrideenabled>::run(&config->lengths[stage],n,nbFactors,stride,in,out,twid,inputstride));
             break;
           #endif
             
           #if defined(RADIX5)
             case 5:
-              return(loop<mode,T,loopmode,5,inputstrideenabled>::run(&config->lengths[stage],n,nbFactors,stride,in,out,twid,inputstride));
+              return(factorCase<mode,T,loopmode,5,inputstrideenabled>::run(&config->lengths[stage],n,nbFactors,stride,in,out,twid,inputstride));
             break;
           #endif
             
           #if defined(RADIX6)
             case 6:
-              return(loop<mode,T,loopmode,6,inputstrideenabled>::run(&config->lengths[stage],n,nbFactors,stride,in,out,twid,inputstride));
+              return(factorCase<mode,T,loopmode,6,inputstrideenabled>::run(&config->lengths[stage],n,nbFactors,stride,in,out,twid,inputstride));
             break;
           #endif 
 
           #if defined(RADIX8)
             case 8:
-              return(loop<mode,T,loopmode,8,inputstrideenabled>::run(&config->lengths[stage],n,nbFactors,stride,in,out,twid,inputstride));
+              return(factorCase<mode,T,loopmode,8,inputstrideenabled>::run(&config->lengths[stage],n,nbFactors,stride,in,out,twid,inputstride));
             break;
           #endif
 
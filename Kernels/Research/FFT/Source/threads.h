@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Spreading independent work items across threads.
+
+When FFT_THREADS is defined (Linux only), the items are split into
+contiguous chunks computed by different threads.
+Otherwise, all the items are computed by the caller.
+
+*/
+
+#ifndef THREADS_H
+#define THREADS_H
+
+#if defined(FFT_THREADS)
+#include <pthread.h>
+#endif
+
+#define FFT_MAX_THREADS 16
+
+// Compute the items first to last-1 with the scratch of thread
+typedef void (*fftthreadwork)(void *context,uint32_t thread,uint32_t first,uint32_t last);
+
+#if defined(FFT_THREADS)
+struct fftthreadargs {
+   fftthreadwork work;
+   void *context;
+   uint32_t thread;
+   uint32_t first;
+   uint32_t last;
+};
+
+static inline void *fft_thread_entry(void *args)
+{
+    const fftthreadargs *a = (const fftthreadargs *)args;
+
+    a->work(a->context,a->thread,a->first,a->last);
+    return(NULL);
+}
+#endif
+
+static inline void fft_parallel(fftthreadwork work,void *context,uint32_t nbItems,uint32_t nbThreads)
+{
+#if defined(FFT_THREADS)
+    if (nbThreads > FFT_MAX_THREADS)
+    {
+       nbThreads = FFT_MAX_THREADS;
+    }
+
+    if (nbThreads > nbItems)
+    {
+       nbThreads = nbItems;
+    }
+
+    if (nbThreads > 1)
+    {
+       pthread_t threads[FFT_MAX_THREADS];
+       fftthreadargs args[FFT_MAX_THREADS];
+       uint32_t nbStarted = 0;
+
+       for(uint32_t t = 0; t < nbThreads; t++)
+       {
+          args[t].work = work;
+          args[t].context = context;
+          args[t].thread = t;
+          args[t].first = (nbItems * t) / nbThreads;
+          args[t].last = (nbItems * (t + 1)) / nbThreads;
+       }
+
+       // The first chunk is computed by the caller.
+       // If a thread cannot be created, its chunk is also
+       // computed by the caller.
+       for(uint32_t t = 1; t < nbThreads; t++)
+       {
+          if (pthread_create(&threads[nbStarted],NULL,fft_thread_entry,&args[t]) == 0)
+          {
+             nbStarted++;
+          }
+          else
+          {
+             args[t].thread = 0;
+             fft_thread_entry(&args[t]);
+          }
+       }
+
+       fft_thread_entry(&args[0]);
+
+       for(uint32_t t = 0; t < nbStarted; t++)
+       {
+          pthread_join(threads[t],NULL);
+       }
+       return;
+    }
+#else
+    (void)nbThreads;
+#endif
+
+    work(context,0,0,nbItems);
+}
+
+#endif
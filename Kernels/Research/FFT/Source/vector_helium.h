@@ -138,6 +138,67 @@ struct vector<float16_t>
 };
 #endif /* defined(VECTOR_F16) */
 
+#if defined(VECTOR_Q7)
+template<>
+struct vector<Q7>
+{
+    typedef int8x16_t type;
+    typedef uint16x8_t offset_type;
+
+     /* A Q7 complex is 16 bits. The gather and scatter are done
+       on halfwords : the byte offsets of a vldrb would be limited to 255.
+       So {index,index+1, ..., index+7} offset in array of complexes with stride.
+      */
+    __STATIC_FORCEINLINE offset_type complex_offset(const int stride,const int index){
+         const uint16_t off[8]={ static_cast<uint16_t>(2*stride*(index+0))
+                               , static_cast<uint16_t>(2*stride*(index+1))
+                               , static_cast<uint16_t>(2*stride*(index+2))
+                               , static_cast<uint16_t>(2*stride*(index+3))
+                               , static_cast<uint16_t>(2*stride*(index+4))
+                               , static_cast<uint16_t>(2*stride*(index+5))
+                               , static_cast<uint16_t>(2*stride*(index+6))
+                               , static_cast<uint16_t>(2*stride*(index+7))
+                               };
+
+         return(vld1q(off));
+    };
+
+    __STATIC_FORCEINLINE type gather_offset(Q7* p,const int stride,const int index)
+    {
+            offset_type voffset=complex_offset(stride,index);
+            return(vreinterpretq_s8_s16(vldrhq_gather_offset_s16((int16_t*)p,voffset)));
+    };
+
+    __STATIC_FORCEINLINE void scatter_offset(Q7* p,const int stride,const int index, type value)
+    {
+            offset_type voffset=complex_offset(stride,index);
+            vstrhq_scatter_offset_s16((int16_t*)p,voffset,vreinterpretq_s16_s8(value));
+    };
+
+    enum {
+           vector_enabled = 1
+    };
+
+    /* Number of complex numbers in the vector and related
+    shift and masks for the loop counters. */
+    enum {
+           nb_complexes = 8,
+           loop_shift = 3,
+           tail_mask = 7
+    };
+};
+
+/* Only the radix 2 and 4 have a Q7 vector version. The stages
+of the other radix are using the scalar loops. */
+template<int factor>
+struct radixvectorized<Q7,factor>
+{
+    enum {
+           value = (factor == 2) || (factor == 4)
+    };
+};
+#endif /* defined(VECTOR_Q7) */
+
 /*
 
 load/store with no stride.
@@ -177,6 +238,28 @@ struct vmemory<T,1>{
     };
 };
 
+#if defined(VECTOR_Q7)
+/*
+
+Q7 is not a native type of the intrinsics
+
+*/
+template<> 
+struct vmemory<Q7,0>{
+    __STATIC_FORCEINLINE int8x16_t load(const complex<Q7> *buf, const int index, const int stride)
+    {
+       (void)stride;
+       return(vld1q((const int8_t*)(buf + index)));
+    };
+
+    __STATIC_FORCEINLINE void store(complex<Q7> *buf,const int index,int8x16_t v, const int stride)
+    {
+       (void)stride;
+        vst1q((int8_t*)(buf + index), v);
+    };
+};
+#endif /* defined(VECTOR_Q7) */
+
 
 /*************
 
@@ -280,6 +363,45 @@ __FORCE_INLINE float32x4_t vcomplex_mulq_n<float32x4_t,complex<float32_t>>(float
 };
 #endif /* #if defined(VECTOR_F32) */
 
+#if defined(VECTOR_Q7)
+
+/* The imaginary parts are the odd lanes */
+#define CMPLX_IMAG_LANES_Q7 0xAAAA
+
+template<> 
+__FORCE_INLINE int8x16_t vload<Q7>(Q7 *v)
+{
+    return(vld1q((int8_t*)v));
+};
+
+template<>
+__FORCE_INLINE int8x16_t vrot<int8x16_t>(int8x16_t v)
+{
+    return(vcaddq_rot90(vdupq_n_s8(0),v));
+};
+
+template<>
+__FORCE_INLINE int8x16_t vconjugate<int8x16_t>(int8x16_t v)
+{
+    return(vqnegq_m(v,v,CMPLX_IMAG_LANES_Q7));
+};
+
+/*
+
+The 16 bits products are doubled and the high
+half is kept : the result is narrowed to Q7 as
+for the scalar kernels (but with saturation).
+
+*/
+template<>
+__FORCE_INLINE int8x16_t vcomplex_mulq<int8x16_t>(int8x16_t a,int8x16_t b)
+{
+    int8x16_t vec_acc = vqdmlsdhq(vuninitializedq_s8(), a, b);
+    vec_acc = vqdmladhxq(vec_acc, a, b);
+    return(vec_acc);
+};
+#endif /* #if defined(VECTOR_Q7) */
+
 
 /*
 
@@ -453,25 +575,142 @@ struct bitreversal<float16_t,inputstrideenabled,1>{
 }
 };
 
+#if defined(VECTOR_Q7)
+template<int inputstrideenabled>
+struct bitreversal<Q7,inputstrideenabled,1>{
+  __STATIC_FORCEINLINE void run(
+        Q7 *pSrc,
+  const int bitRevLen,
+  const uint16_t *pBitRevTab,
+  const uint16_t isVectorizable,
+  const int inputstride)
+{
+  Q7 tmp;
+  int a,b;
+  int index=0;
+  uint16_t *pBitRevTabTmp = (uint16_t *)pBitRevTab;
+
+  /* A Q7 complex is swapped as an halfword */
+  uint16_t       *src = (uint16_t *) pSrc;
+  uint32_t        blkCnt;     /* loop counters */
+  uint16x8_t      bitRevTabOff;
+
+  const int strideFactor = (1 + inputstrideenabled * (inputstride - 1));
+  uint16x8_t     factor = vdupq_n_u16(strideFactor);
+
+  if (isVectorizable)
+  {
+     blkCnt = bitRevLen >> 3; 
+  }
+  else
+  {
+    blkCnt = 0;
+  }
+
+  while(blkCnt >0)
+  {
+    bitRevTabOff = vldrhq_u16(pBitRevTabTmp);
+    pBitRevTabTmp += 8;
+
+    uint32x4_t      bitRevOff1 = vmullbq_int_u16(bitRevTabOff, factor);
+    uint32x4_t      bitRevOff2 = vmulltq_int_u16(bitRevTabOff, factor);
+
+    uint32x4_t      in1 = vldrhq_gather_offset_u32(src, bitRevOff1);
+    uint32x4_t      in2 = vldrhq_gather_offset_u32(src, bitRevOff2);
+
+    vstrhq_scatter_offset_u32(src, bitRevOff1, in2);
+    vstrhq_scatter_offset_u32(src, bitRevOff2, in1);
+
+    blkCnt --;
+    index += 8;
+  }
+
+  if (isVectorizable)
+  {
+     blkCnt = (bitRevLen >> 1) & 3;
+  }
+  else
+  {
+    blkCnt = bitRevLen >> 1;
+  }
+  while(blkCnt>0)
+  {
+     /* Index in a complex array. So they have been pre-multiplied by 2
+     in the Python script */
+     a = pBitRevTab[index    ] ;
+     b = pBitRevTab[index + 1] ;
+
+     //real
+     tmp = pSrc[a * strideFactor];
+     pSrc[a * strideFactor] = pSrc[b * strideFactor];
+     pSrc[b * strideFactor] = tmp;
+
+     //complex
+     tmp = pSrc[a * strideFactor + 1];
+     pSrc[a * strideFactor + 1] = pSrc[b * strideFactor + 1];
+     pSrc[b * strideFactor + 1] = tmp;
+
+     index +=2;
+     blkCnt--;
+  }
+}
+};
+#endif /* defined(VECTOR_Q7) */
+
 #ifdef DATATYPE_F32
     #if defined(VECTOR_F32)
-        #include "Helium/F32/radix_F32_2.h"
-        #include "Helium/F32/radix_F32_3.h"
-        #include "Helium/F32/radix_F32_4.h"
-        #include "Helium/F32/radix_F32_5.h"
-        #include "Helium/F32/radix_F32_6.h"
-        #include "Helium/F32/radix_F32_8.h"
+        #if defined(RADIX_F32_2)
+          #include "Helium/F32/radix_F32_2.h"
+        #endif
+        #if defined(RADIX_F32_3)
+          #include "Helium/F32/radix_F32_3.h"
+        #endif
+        #if defined(RADIX_F32_4)
+          #include "Helium/F32/radix_F32_4.h"
+        #endif
+        #if defined(RADIX_F32_5)
+          #include "Helium/F32/radix_F32_5.h"
+        #endif
+        #if defined(RADIX_F32_6)
+          #include "Helium/F32/radix_F32_6.h"
+        #endif
+        #if defined(RADIX_F32_8)
+          #include "Helium/F32/radix_F32_8.h"
+        #endif
     #endif
 #endif
 
 #ifdef DATATYPE_F16
     #if defined(VECTOR_F16)
-        #include "Helium/F16/radix_F16_2.h"
-        #include "Helium/F16/radix_F16_3.h"
-        #include "Helium/F16/radix_F16_4.h"
-        #include "Helium/F16/radix_F16_5.h"
-        #include "Helium/F16/radix_F16_6.h"
-        #include "Helium/F16/radix_F16_8.h"
+        #if defined(RADIX_F16_2)
+          #include "Helium/F16/radix_F16_2.h"
+        #endif
+        #if defined(RADIX_F16_3)
+          #include "Helium/F16/radix_F16_3.h"
+        #endif
+        #if defined(RADIX_F16_4)
+          #include "Helium/F16/radix_F16_4.h"
+        #endif
+        #if defined(RADIX_F16_5)
+          #include "Helium/F16/radix_F16_5.h"
+        #endif
+        #if defined(RADIX_F16_6)
+          #include "Helium/F16/radix_F16_6.h"
+        #endif
+        #if defined(RADIX_F16_8)
+          #include "Helium/F16/radix_F16_8.h"
+        #endif
+    #endif
+#endif
+
+#ifdef DATATYPE_Q7
+    #if defined(VECTOR_Q7)
+        #if defined(RADIX_Q7_2)
+          #include "Helium/Q7/radix_Q7_2.h"
+        #endif
+        #if defined(RADIX_Q7_4)
+          #include "Helium/Q7/radix_Q7_4.h"
+        #endif
     #endif
 #endif
 
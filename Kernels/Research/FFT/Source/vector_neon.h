@@ -261,12 +261,24 @@ __STATIC_FORCEINLINE void run(
 
 #ifdef DATATYPE_F32
     #if defined(VECTOR_F32)
-        #include "Neon/F32/radix_F32_2.h"
-        #include "Neon/F32/radix_F32_3.h"
-        #include "Neon/F32/radix_F32_4.h"
-        #include "Neon/F32/radix_F32_5.h"
-        #include "Neon/F32/radix_F32_6.h"
-        #include "Neon/F32/radix_F32_8.h"
+        #if defined(RADIX_F32_2)
+          #include "Neon/F32/radix_F32_2.h"
+        #endif
+        #if defined(RADIX_F32_3)
+          #include "Neon/F32/radix_F32_3.h"
+        #endif
+        #if defined(RADIX_F32_4)
+          #include "Neon/F32/radix_F32_4.h"
+        #endif
+        #if defined(RADIX_F32_5)
+          #include "Neon/F32/radix_F32_5.h"
+        #endif
+        #if defined(RADIX_F32_6)
+          #include "Neon/F32/radix_F32_6.h"
+        #endif
+        #if defined(RADIX_F32_8)
+          #include "Neon/F32/radix_F32_8.h"
+        #endif
     #endif
 #endif
 
@@ -0,0 +1,375 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Welch estimators : PSD, cross spectral density and coherence.
+
+The input is a stream cut into segments of length n overlapping
+by overlap samples. The spectra of the windowed segments are
+accumulated : the segments are not stored.
+
+Only the samples of the next segment are kept between two updates.
+The segments contained in the input of an update are read directly
+from the input and can be computed by several threads
+(each thread has its own scratch and accumulators).
+
+PSD : power spectrum of the segment (fused window + RFFT + |X|^2)
+
+CSD : the two channels x and y are the real and imaginary parts
+of a CFFT of length n (like rfft_pair). X and Y are separated
+and Sxx, Syy and Sxy = X conj(Y) accumulated in the same loop.
+
+*/
+
+#ifndef WELCH_H
+#define WELCH_H
+
+// Include templates to spread the segments across threads
+#include "threads.h"
+
+/*
+
+Cut the stream into segments.
+
+P must provide :
+
+copy(from,to,count) : copy input samples to the segment buffer
+move(from,count)    : move samples of the segment buffer to its start
+buffered()          : accumulate the segment buffer
+direct(first,nb)    : accumulate nb segments of the input starting at
+                      first, first+hop ...
+
+*/
+template<typename T,typename P>
+void welch_stream(welchstate<T> *S,P &p,uint32_t nbSamples)
+{
+    const uint32_t n = S->n;
+    const uint32_t overlap = S->overlap;
+    const uint32_t hop = n - overlap;
+    uint32_t i = 0;
+    uint32_t nb;
+
+    // The next segment is starting in the segment buffer
+    while (S->pos > 0)
+    {
+       const uint32_t pos = S->pos;
+       const uint32_t needed = n - pos;
+
+       if (nbSamples - i < needed)
+       {
+          p.copy(i,pos,nbSamples - i);
+          S->pos = pos + nbSamples - i;
+          return;
+       }
+
+       p.copy(i,pos,needed);
+       i += needed;
+       p.buffered();
+       S->nbSegments++;
+
+       if (hop < pos)
+       {
+          // Next segment starting in the segment buffer
+          p.move(hop,overlap);
+          S->pos = overlap;
+       }
+       else
+       {
+          // Next segment starting in the input
+          i -= overlap;
+          S->pos = 0;
+       }
+    }
+
+    // Segments contained in the input
+    nb = 0;
+    if (nbSamples - i >= n)
+    {
+       nb = (nbSamples - i - n) / hop + 1;
+       p.direct(i,nb);
+       S->nbSegments += nb;
+       i += nb * hop;
+    }
+
+    // Start of the next segment
+    p.copy(i,0,nbSamples - i);
+    S->pos = nbSamples - i;
+}
+
+/*
+
+PSD
+
+*/
+template<typename T>
+struct welchpsd{
+  welchstate<T> *S;
+  const T *in;
+
+  // Size of the scratch and accumulators of a thread
+  static uint32_t tmpSize(uint32_t n)
+  {
+     return(n + (n >> 1) + 1);
+  }
+
+  static uint32_t accSize(uint32_t n)
+  {
+     return((n >> 1) + 1);
+  }
+
+  static void segment(welchstate<T> *S,const T *x,uint32_t thread)
+  {
+     const uint32_t n = S->n;
+     T *tmp = S->tmp + thread * tmpSize(n);
+     T *spectrum = tmp + n;
+     T *acc = S->acc + thread * accSize(n);
+
+     inner_power_spectrum<T,0>(x,S->window,tmp,spectrum,n);
+
+     for(uint32_t k = 0; k < accSize(n); k++)
+     {
+        acc[k] += spectrum[k];
+     }
+  }
+
+  static void work(void *context,uint32_t thread,uint32_t first,uint32_t last)
+  {
+     const welchpsd<T> *p = (const welchpsd<T> *)context;
+     const uint32_t hop = p->S->n - p->S->overlap;
+
+     for(uint32_t s = first; s < last; s++)
+     {
+        segment(p->S,p->in + s * hop,thread);
+     }
+  }
+
+  void copy(uint32_t from,uint32_t to,uint32_t count)
+  {
+     for(uint32_t i = 0; i < count; i++)
+     {
+        S->segment[to + i] = in[from + i];
+     }
+  }
+
+  void move(uint32_t from,uint32_t count)
+  {
+     for(uint32_t i = 0; i < count; i++)
+     {
+        S->segment[i] = S->segment[from + i];
+     }
+  }
+
+  void buffered()
+  {
+     segment(S,S->segment,0);
+  }
+
+  void direct(uint32_t first,uint32_t nb)
+  {
+     const welchpsd<T> p = {S,in + first};
+     fft_parallel(work,(void*)&p,nb,S->nbThreads);
+  }
+};
+
+/*
+
+CSD
+
+*/
+
+// Loader for the two windowed channels as real and imaginary parts
+template<typename T>
+struct welchloader{
+  const T *x;
+  const T *y;
+  const T *window;
+
+  __FORCE_INLINE complex<T> load(int i) const
+  {
+     return(complex<T>(x[i] * window[i],y[i] * window[i]));
+  }
+};
+
+template<typename T>
+struct welchcsd{
+  welchstate<T> *S;
+  const T *x;
+  const T *y;
+
+  static uint32_t tmpSize(uint32_t n)
+  {
+     return(2*n);
+  }
+
+  // Sxx, Syy (n/2+1 values) and Sxy (n/2+1 complex values)
+  static uint32_t accSize(uint32_t n)
+  {
+     return(4*((n >> 1) + 1));
+  }
+
+  __STATIC_FORCEINLINE void accumulate(const complex<T> a,const complex<T> b,
+    T *sxx,T *syy,complex<T> *sxy)
+  {
+     *sxx += a.real() * a.real() + a.imag() * a.imag();
+     *syy += b.real() * b.real() + b.imag() * b.imag();
+     *sxy = *sxy + complex<T>(a.real() * b.real() + a.imag() * b.imag(),
+                              a.imag() * b.real() - a.real() * b.imag());
+  }
+
+  static void segment(welchstate<T> *S,const T *x,const T *y,uint32_t thread)
+  {
+     const uint32_t n = S->n;
+     const uint32_t halflength = n >> 1;
+     T *tmp = S->tmp + thread * tmpSize(n);
+     T *sxx = S->acc + thread * accSize(n);
+     T *syy = sxx + halflength + 1;
+     complex<T> *sxy = (complex<T> *)(syy + halflength + 1);
+     const cfftconfig<T> *config=cfft_config<T>(n);
+     const complex<T> *pZ = (const complex<T> *)tmp;
+     complex<T> a,b;
+
+     if (S->window)
+     {
+        const welchloader<T> loader={x,y,S->window};
+        fftload<DIRECT,T,welchloader<T>>::run(config,n,loader,(complex<T>*)tmp);
+     }
+     else
+     {
+        const splitloader<T> loader={x,y};
+        fftload<DIRECT,T,splitloader<T>>::run(config,n,loader,(complex<T>*)tmp);
+     }
+
+     fft<DIRECT,T,0>::permute(config,n,tmp,0);
+
+     accumulate(complex<T>(pZ[0].real(),constant<T>::zero),
+                complex<T>(pZ[0].imag(),constant<T>::zero),&sxx[0],&syy[0],&sxy[0]);
+
+     accumulate(complex<T>(pZ[halflength].real(),constant<T>::zero),
+                complex<T>(pZ[halflength].imag(),constant<T>::zero),
+                &sxx[halflength],&syy[halflength],&sxy[halflength]);
+
+     for(uint32_t k = 1; k < halflength; k++)
+     {
+        rfft_pair_bin(pZ[k],pZ[n - k],&a,&b);
+        accumulate(a,b,&sxx[k],&syy[k],&sxy[k]);
+     }
+  }
+
+  static void work(void *context,uint32_t thread,uint32_t first,uint32_t last)
+  {
+     const welchcsd<T> *p = (const welchcsd<T> *)context;
+     const uint32_t hop = p->S->n - p->S->overlap;
+
+     for(uint32_t s = first; s < last; s++)
+     {
+        segment(p->S,p->x + s * hop,p->y + s * hop,thread);
+     }
+  }
+
+  void copy(uint32_t from,uint32_t to,uint32_t count)
+  {
+     T *sx = S->segment;
+     T *sy = S->segment + S->n;
+
+     for(uint32_t i = 0; i < count; i++)
+     {
+        sx[to + i] = x[from + i];
+        sy[to + i] = y[from + i];
+     }
+  }
+
+  void move(uint32_t from,uint32_t count)
+  {
+     T *sx = S->segment;
+     T *sy = S->segment + S->n;
+
+     for(uint32_t i = 0; i < count; i++)
+     {
+        sx[i] = sx[from + i];
+        sy[i] = sy[from + i];
+     }
+  }
+
+  void buffered()
+  {
+     segment(S,S->segment,S->segment + S->n,0);
+  }
+
+  void direct(uint32_t first,uint32_t nb)
+  {
+     const welchcsd<T> p = {S,x + first,y + first};
+     fft_parallel(work,(void*)&p,nb,S->nbThreads);
+  }
+};
+
+/*
+
+Initialization and results
+
+*/
+template<typename T>
+void welch_init_state(welchstate<T> *S,uint16_t n,uint16_t overlap,const T *window,
+  uint16_t nbThreads,T *segment,T *tmp,T *acc,uint32_t accSize)
+{
+    T power = constant<T>::zero;
+
+    if (window)
+    {
+       for(uint32_t i = 0; i < n; i++)
+       {
+          power += window[i] * window[i];
+       }
+    }
+    else
+    {
+       power = (T)n;
+    }
+
+    S->n = n;
+    S->overlap = overlap;
+    S->window = window;
+    S->windowPower = power;
+    S->nbThreads = nbThreads;
+    S->segment = segment;
+    S->pos = 0;
+    S->nbSegments = 0;
+    S->tmp = tmp;
+    S->acc = acc;
+
+    for(uint32_t i = 0; i < nbThreads * accSize; i++)
+    {
+       acc[i] = constant<T>::zero;
+    }
+}
+
+// Sum of the accumulators of all threads for the value i
+template<typename T>
+__STATIC_FORCEINLINE T welch_sum(const welchstate<T> *S,uint32_t accSize,uint32_t i)
+{
+    T sum = S->acc[i];
+
+    for(uint32_t t = 1; t < S->nbThreads; t++)
+    {
+       sum += S->acc[t * accSize + i];
+    }
+    return(sum);
+}
+
+#endif
@@ -0,0 +1,208 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Cross-correlation r[l] = sum_k x[k+l] y[k]
+
+Direct method : one dot product for each lag.
+
+FFT method : with x and y zero padded to n, the inverse RFFT of
+X conj(Y) is the circular correlation c[l] = sum_k x[(k+l) mod n] y[k].
+The nonzero lags are -(ny-1) ... nx-1 so c[l mod n] = r[l] when l+n
+and l-n are outside of this range : l > nx-1-n and l < n-ny+1.
+The zero padding is done by the loader of the first stage of the FFT.
+
+Streaming (overlap-save) : the stream is correlated with a template
+of m samples. A segment of n samples gives the n-m+1 first lags
+of the circular correlation without wrap-around. The next segment
+starts with the last m-1 samples of the previous one.
+
+*/
+
+#ifndef XCORR_H
+#define XCORR_H
+
+// The direct method is selected when nbLags * overlap is smaller
+// than FFT_XCORR_DIRECT_COST * n * log2(n)
+#if !defined(FFT_XCORR_DIRECT_COST)
+#define FFT_XCORR_DIRECT_COST 3
+#endif
+
+template<typename T>
+void xcorr_direct(const T *x,int32_t nx,const T *y,int32_t ny,int32_t firstLag,uint32_t nbLags,T *out)
+{
+    for(uint32_t j = 0; j < nbLags; j++)
+    {
+       const int32_t lag = firstLag + (int32_t)j;
+       const int32_t start = lag < 0 ? -lag : 0;
+       const int32_t stop = (nx - lag) < ny ? (nx - lag) : ny;
+
+       if (stop > start)
+       {
+          out[j] = dotproduct<T>::run(x + start + lag,y + start,stop - start);
+       }
+       else
+       {
+          out[j] = constant<T>::zero;
+       }
+    }
+}
+
+__STATIC_FORCEINLINE bool xcorr_direct_selected(uint32_t n,uint32_t nbLags,uint32_t overlap)
+{
+    uint32_t log2n = 0;
+
+    while((1UL << log2n) < n)
+    {
+       log2n++;
+    }
+
+    return((uint64_t)nbLags * overlap <= (uint64_t)FFT_XCORR_DIRECT_COST * n * log2n);
+}
+
+// Real samples seen as complex samples, zero padded after length samples
+template<typename T>
+struct xcorrloader{
+  const T *in;
+  int length;
+
+  __FORCE_INLINE complex<T> load(int i) const
+  {
+     return(complex<T>(2*i < length ? in[2*i] : constant<T>::zero,
+                       2*i+1 < length ? in[2*i+1] : constant<T>::zero));
+  }
+};
+
+// RFFT of length n of the zero padded signal
+template<typename T>
+void xcorr_spectrum(const rfftconfig<T> *rconfig,const T *in,uint32_t length,T *tmp,T *out,uint32_t n)
+{
+    const cfftconfig<T> *config=cfft_config<T>(n >> 1);
+    const xcorrloader<T> loader={in,(int)length};
+
+    fftload<DIRECT,T,xcorrloader<T>>::run(config,n >> 1,loader,(complex<T>*)tmp);
+    fft<DIRECT,T,0>::permute(config,n >> 1,tmp,0);
+    rfft_split(rconfig,tmp,out,n);
+}
+
+/*
+
+tmp : scratch (n), spectrum of x (n+2) and spectrum of y (n+2)
+
+*/
+template<typename T>
+void inner_xcorr(const T *x,uint32_t nx,const T *y,uint32_t ny,int32_t firstLag,uint32_t nbLags,T *tmp,T *out,uint32_t n)
+{
+    const rfftconfig<T> *rconfig=rfft_config<T>(n);
+    const int32_t lastLag = firstLag + (int32_t)nbLags - 1;
+    const uint32_t overlap = nx < ny ? nx : ny;
+    T *sx = tmp + n;
+    T *sy = sx + n + 2;
+
+    if (!rconfig || (nx > n) || (ny > n) ||
+        (firstLag <= (int32_t)nx - 1 - (int32_t)n) ||
+        (lastLag >= (int32_t)n - (int32_t)ny + 1) ||
+        xcorr_direct_selected(n,nbLags,overlap))
+    {
+       xcorr_direct(x,(int32_t)nx,y,(int32_t)ny,firstLag,nbLags,out);
+       return;
+    }
+
+    xcorr_spectrum(rconfig,x,nx,tmp,sx,n);
+    if (x == y)
+    {
+       spectrumloop<T,SPECTRUM_MULCONJ,vector<T>::vector_enabled>::run(sx,sx,sx,(n >> 1) + 1);
+    }
+    else
+    {
+       xcorr_spectrum(rconfig,y,ny,tmp,sy,n);
+       spectrumloop<T,SPECTRUM_MULCONJ,vector<T>::vector_enabled>::run(sx,sy,sx,(n >> 1) + 1);
+    }
+
+    // Circular correlation in sy
+    rfft_merge(rconfig,sx,tmp,n);
+    inner_cifft<T,0>(tmp,sy,n >> 1,0);
+
+    for(uint32_t j = 0; j < nbLags; j++)
+    {
+       int32_t lag = firstLag + (int32_t)j;
+       if (lag < 0)
+       {
+          lag += n;
+       }
+       out[j] = sy[lag];
+    }
+}
+
+template<typename T>
+uint32_t inner_xcorr_stream(xcorrstate<T> *S,const T *in,uint32_t nbSamples,T *out)
+{
+    const uint32_t n = S->n;
+    const uint32_t hop = n - S->m + 1;
+    const rfftconfig<T> *rconfig=rfft_config<T>(n);
+    T *segment = S->segment;
+    T *spectrum = S->tmp + n;
+    uint32_t nbOut = 0;
+    uint32_t i = 0;
+
+    while (i < nbSamples)
+    {
+       uint32_t nb = n - S->pos;
+       if (nb > nbSamples - i)
+       {
+          nb = nbSamples - i;
+       }
+
+       for(uint32_t k = 0; k < nb; k++)
+       {
+          segment[S->pos + k] = in[i + k];
+       }
+       S->pos += nb;
+       i += nb;
+
+       if (S->pos == n)
+       {
+          inner_cfft<T,0>(segment,S->tmp,n >> 1,0);
+          rfft_split(rconfig,S->tmp,spectrum,n);
+
+          spectrumloop<T,SPECTRUM_MULCONJ,vector<T>::vector_enabled>::run(spectrum,S->spectrum,spectrum,(n >> 1) + 1);
+
+          rfft_merge(rconfig,spectrum,S->tmp,n);
+          inner_cifft<T,0>(S->tmp,spectrum,n >> 1,0);
+
+          for(uint32_t k = 0; k < hop; k++)
+          {
+             out[nbOut + k] = spectrum[k];
+          }
+          nbOut += hop;
+
+          // The last m-1 samples are the start of the next segment
+          for(uint32_t k = 0; k < n - hop; k++)
+          {
+             segment[k] = segment[hop + k];
+          }
+          S->pos = n - hop;
+       }
+    }
+
+    return(nbOut);
+}
+
+#endif
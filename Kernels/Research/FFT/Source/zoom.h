@@ -0,0 +1,251 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+
+Zoom FFT : a band of width 1/D (in cycles per sample) around a
+center frequency f0 is shifted to baseband, decimated by D and
+analyzed by a CFFT of length n. The resolution is 1/(D n) for
+frames of n D input samples.
+
+The decimated sample m (last input sample of index t = m D) is
+
+y[m] = sum_l h[l] x[t-l] exp(-2 i pi f0 (t-l))
+     = exp(-2 i pi f0 t) sum_l h[l] exp(2 i pi f0 l) x[t-l]
+
+where h is a lowpass filter with a cutoff at 1/(2D).
+The heterodyne is folded into the complex coefficients
+h[l] exp(2 i pi f0 l) computed by the initialization : the FIR is
+only computed at the decimated rate and the remaining rotation
+exp(-2 i pi f0 t) is an oscillator running at the decimated rate.
+
+*/
+
+#ifndef ZOOM_H
+#define ZOOM_H
+
+// Blackman windowed sinc with a cutoff at 1/(2 decimation).
+// The window is computed on length + 2 points to avoid zero end taps.
+__STATIC_FORCEINLINE float32_t zoom_lowpass(uint32_t l,uint32_t length,float32_t middle,uint32_t decimation)
+{
+    const float32_t t = PI * ((float32_t)l - middle) / (float32_t)decimation;
+    const float32_t x = 2.0f * PI * (float32_t)(l + 1) / (float32_t)(length + 1);
+    const float32_t sinc = (t == 0.0f) ? 1.0f : sinf(t) / t;
+
+    return(sinc * (0.42f - 0.5f * cosf(x) + 0.08f * cosf(2.0f * x)));
+}
+
+// Complex FIR on real samples : coefs has the real parts
+// followed by the imaginary parts
+template<typename T>
+struct zoomfir{
+  __STATIC_FORCEINLINE void run(const T *coefs,const T *delay,uint32_t length,T *re,T *im)
+  {
+     T accRe = constant<T>::zero;
+     T accIm = constant<T>::zero;
+
+     for(uint32_t j = 0; j < length; j++)
+     {
+        accRe = accRe + coefs[j] * delay[j];
+        accIm = accIm + coefs[length + j] * delay[j];
+     }
+     *re = accRe;
+     *im = accIm;
+  }
+};
+
+#if defined(HASVECTOR) && defined(VECTOR_F32)
+template<>
+struct zoomfir<float32_t>{
+  __STATIC_FORCEINLINE void run(const float32_t *coefs,const float32_t *delay,uint32_t length,float32_t *re,float32_t *im)
+  {
+     const float32_t *coefsIm = coefs + length;
+     float32x4_t accRe = vdupq_n_f32(0.0f);
+     float32x4_t accIm = vdupq_n_f32(0.0f);
+     float32x4_t d;
+     float32_t sumRe,sumIm;
+     uint32_t blkCnt = length >> 2;
+
+     while(blkCnt > 0)
+     {
+        d = vld1q_f32(delay);
+        accRe = vaddq_f32(accRe,vmulq_f32(vld1q_f32(coefs),d));
+        accIm = vaddq_f32(accIm,vmulq_f32(vld1q_f32(coefsIm),d));
+        coefs += 4;
+        coefsIm += 4;
+        delay += 4;
+        blkCnt--;
+     }
+
+     sumRe = vgetq_lane_f32(accRe,0) + vgetq_lane_f32(accRe,1) +
+             vgetq_lane_f32(accRe,2) + vgetq_lane_f32(accRe,3);
+     sumIm = vgetq_lane_f32(accIm,0) + vgetq_lane_f32(accIm,1) +
+             vgetq_lane_f32(accIm,2) + vgetq_lane_f32(accIm,3);
+
+     blkCnt = length & 3;
+     while(blkCnt > 0)
+     {
+        sumRe += *coefs++ * *delay;
+        sumIm += *coefsIm++ * *delay++;
+        blkCnt--;
+     }
+
+     *re = sumRe;
+     *im = sumIm;
+  }
+};
+#endif
+
+#if defined(HELIUM_VECTOR) && defined(VECTOR_F16)
+template<>
+struct zoomfir<float16_t>{
+  __STATIC_FORCEINLINE void run(const float16_t *coefs,const float16_t *delay,uint32_t length,float16_t *re,float16_t *im)
+  {
+     const float16_t *coefsIm = coefs + length;
+     float16x8_t accRe = vdupq_n_f16(0.0f16);
+     float16x8_t accIm = vdupq_n_f16(0.0f16);
+     float16x8_t d;
+     _Float16 sumRe,sumIm;
+     uint32_t blkCnt = length >> 3;
+
+     while(blkCnt > 0)
+     {
+        d = vld1q_f16(delay);
+        accRe = vaddq_f16(accRe,vmulq_f16(vld1q_f16(coefs),d));
+        accIm = vaddq_f16(accIm,vmulq_f16(vld1q_f16(coefsIm),d));
+        coefs += 8;
+        coefsIm += 8;
+        delay += 8;
+        blkCnt--;
+     }
+
+     sumRe = (_Float16)vgetq_lane_f16(accRe,0) + (_Float16)vgetq_lane_f16(accRe,1) +
+             (_Float16)vgetq_lane_f16(accRe,2) + (_Float16)vgetq_lane_f16(accRe,3) +
+             (_Float16)vgetq_lane_f16(accRe,4) + (_Float16)vgetq_lane_f16(accRe,5) +
+             (_Float16)vgetq_lane_f16(accRe,6) + (_Float16)vgetq_lane_f16(accRe,7);
+     sumIm = (_Float16)vgetq_lane_f16(accIm,0) + (_Float16)vgetq_lane_f16(accIm,1) +
+             (_Float16)vgetq_lane_f16(accIm,2) + (_Float16)vgetq_lane_f16(accIm,3) +
+             (_Float16)vgetq_lane_f16(accIm,4) + (_Float16)vgetq_lane_f16(accIm,5) +
+             (_Float16)vgetq_lane_f16(accIm,6) + (_Float16)vgetq_lane_f16(accIm,7);
+
+     blkCnt = length & 7;
+     while(blkCnt > 0)
+     {
+        sumRe += (_Float16)*coefs++ * (_Float16)*delay;
+        sumIm += (_Float16)*coefsIm++ * (_Float16)*delay++;
+        blkCnt--;
+     }
+
+     *re = sumRe;
+     *im = sumIm;
+  }
+};
+#endif
+
+// Loader applying the window to the frame
+template<typename T>
+struct zoomloader{
+  const complex<T> *frame;
+  const T *window;
+
+  __FORCE_INLINE complex<T> load(int i) const
+  {
+     return(complex<T>(frame[i].real() * window[i],frame[i].imag() * window[i]));
+  }
+};
+
+template<typename T>
+uint32_t inner_zoom_fft(zoomstate<T> *S,const T *in,uint32_t nbSamples,T *out)
+{
+    const uint32_t decimation = S->decimation;
+    const uint32_t length = S->length;
+    const uint32_t n = S->n;
+    T *delay = S->delay;
+    uint32_t nbOut = 0;
+    uint32_t i = 0;
+    T re,im;
+
+    while (i < nbSamples)
+    {
+       uint32_t nb = decimation - S->pos;
+       if (nb > nbSamples - i)
+       {
+          nb = nbSamples - i;
+       }
+
+       // New samples after the last length samples
+       for(uint32_t k = 0; k < nb; k++)
+       {
+          delay[length + S->pos + k] = in[i + k];
+       }
+       S->pos += nb;
+       i += nb;
+
+       if (S->pos == decimation)
+       {
+          zoomfir<T>::run(S->coefs,delay + decimation,length,&re,&im);
+
+          for(uint32_t k = 0; k < length; k++)
+          {
+             delay[k] = delay[decimation + k];
+          }
+          S->pos = 0;
+
+          // Rotation to baseband and step of the oscillator.
+          // The oscillator is renormalized to avoid a drift of
+          // its amplitude.
+          const float32_t fre = (float32_t)re;
+          const float32_t fim = (float32_t)im;
+          const float32_t oscRe = S->oscRe * S->stepRe - S->oscIm * S->stepIm;
+          const float32_t oscIm = S->oscRe * S->stepIm + S->oscIm * S->stepRe;
+          const float32_t g = 1.5f - 0.5f * (oscRe * oscRe + oscIm * oscIm);
+
+          S->frame[2*S->nbFrame] = (T)(fre * S->oscRe - fim * S->oscIm);
+          S->frame[2*S->nbFrame+1] = (T)(fre * S->oscIm + fim * S->oscRe);
+          S->oscRe = g * oscRe;
+          S->oscIm = g * oscIm;
+          S->nbFrame++;
+
+          if (S->nbFrame == n)
+          {
+             T *pOut = out + 2 * n * nbOut;
+
+             if (S->window)
+             {
+                const cfftconfig<T> *config=cfft_config<T>(n);
+                const zoomloader<T> loader={(const complex<T> *)S->frame,S->window};
+
+                fftload<DIRECT,T,zoomloader<T>>::run(config,n,loader,(complex<T>*)pOut);
+                fft<DIRECT,T,0>::permute(config,n,pOut,0);
+             }
+             else
+             {
+                inner_cfft<T,0>(S->frame,pOut,n,0);
+             }
+
+             S->nbFrame = 0;
+             nbOut++;
+          }
+       }
+    }
+
+    return(nbOut);
+}
+
+#endif
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "AnalyticTestsF16.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+#define SNR_THRESHOLD 56
+
+    void AnalyticTestsF16::test_analytic_f16()
+    {
+       const float16_t *inp = input.ptr();
+
+       float16_t *outp = output.ptr();
+       float16_t *tmpp = tmp.ptr();
+
+       status=analytic_signal(inp,tmpp,outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float16_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void AnalyticTestsF16::test_hilbert_f16()
+    {
+       const float16_t *inp = input.ptr();
+
+       float16_t *outp = output.ptr();
+       float16_t *tmpp = tmp.ptr();
+
+       status=hilbert(inp,tmpp,outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float16_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void AnalyticTestsF16::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case AnalyticTestsF16::TEST_ANALYTIC_F16_1:
+             
+               input.reload(AnalyticTestsF16::INPUTS_ANALYTIC_1_F16_ID,mgr);
+               ref.reload(  AnalyticTestsF16::REF_ANALYTIC_1_F16_ID,mgr);
+             
+               this->nb=64;
+             
+             break;
+
+             case AnalyticTestsF16::TEST_ANALYTIC_F16_2:
+             
+               input.reload(AnalyticTestsF16::INPUTS_ANALYTIC_2_F16_ID,mgr);
+               ref.reload(  AnalyticTestsF16::REF_ANALYTIC_2_F16_ID,mgr);
+             
+               this->nb=60;
+             
+             break;
+
+             case AnalyticTestsF16::TEST_HILBERT_F16_3:
+             
+               input.reload(AnalyticTestsF16::INPUTS_ANALYTIC_1_F16_ID,mgr);
+               ref.reload(  AnalyticTestsF16::REF_HILBERT_1_F16_ID,mgr);
+             
+               this->nb=64;
+             
+             break;
+
+             case AnalyticTestsF16::TEST_HILBERT_F16_4:
+             
+               input.reload(AnalyticTestsF16::INPUTS_ANALYTIC_2_F16_ID,mgr);
+               ref.reload(  AnalyticTestsF16::REF_HILBERT_2_F16_ID,mgr);
+             
+               this->nb=60;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),AnalyticTestsF16::OUTPUT_ANALYTIC_F16_ID,mgr);
+       // Scratch of hilbert (analytic_signal is using 2*nb samples)
+       tmp.create(4*this->nb,AnalyticTestsF16::TMP_ANALYTIC_F16_ID,mgr);
+
+    }
+
+    void AnalyticTestsF16::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "AnalyticTestsF32.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+#define SNR_THRESHOLD 120
+
+    void AnalyticTestsF32::test_analytic_f32()
+    {
+       const float32_t *inp = input.ptr();
+
+       float32_t *outp = output.ptr();
+       float32_t *tmpp = tmp.ptr();
+
+       status=analytic_signal(inp,tmpp,outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void AnalyticTestsF32::test_hilbert_f32()
+    {
+       const float32_t *inp = input.ptr();
+
+       float32_t *outp = output.ptr();
+       float32_t *tmpp = tmp.ptr();
+
+       status=hilbert(inp,tmpp,outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void AnalyticTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case AnalyticTestsF32::TEST_ANALYTIC_F32_1:
+             
+               input.reload(AnalyticTestsF32::INPUTS_ANALYTIC_1_F32_ID,mgr);
+               ref.reload(  AnalyticTestsF32::REF_ANALYTIC_1_F32_ID,mgr);
+             
+               this->nb=64;
+             
+             break;
+
+             case AnalyticTestsF32::TEST_ANALYTIC_F32_2:
+             
+               input.reload(AnalyticTestsF32::INPUTS_ANALYTIC_2_F32_ID,mgr);
+               ref.reload(  AnalyticTestsF32::REF_ANALYTIC_2_F32_ID,mgr);
+             
+               this->nb=60;
+             
+             break;
+
+             case AnalyticTestsF32::TEST_HILBERT_F32_3:
+             
+               input.reload(AnalyticTestsF32::INPUTS_ANALYTIC_1_F32_ID,mgr);
+               ref.reload(  AnalyticTestsF32::REF_HILBERT_1_F32_ID,mgr);
+             
+               this->nb=64;
+             
+             break;
+
+             case AnalyticTestsF32::TEST_HILBERT_F32_4:
+             
+               input.reload(AnalyticTestsF32::INPUTS_ANALYTIC_2_F32_ID,mgr);
+               ref.reload(  AnalyticTestsF32::REF_HILBERT_2_F32_ID,mgr);
+             
+               this->nb=60;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),AnalyticTestsF32::OUTPUT_ANALYTIC_F32_ID,mgr);
+       // Scratch of hilbert (analytic_signal is using 2*nb samples)
+       tmp.create(4*this->nb,AnalyticTestsF32::TMP_ANALYTIC_F32_ID,mgr);
+
+    }
+
+    void AnalyticTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
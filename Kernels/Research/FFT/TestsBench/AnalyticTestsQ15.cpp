@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "AnalyticTestsQ15.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+/*
+
+The output is the analytic signal divided by 2 with the
+scaling of cifft(cfft(x)) : the reference is the analytic
+signal divided by 2 and 2*format bits are lost.
+In q15, only short lengths are tested.
+
+*/
+#define SNR_THRESHOLD 15
+
+    void AnalyticTestsQ15::test_analytic_q15()
+    {
+       const q15_t *inp = input.ptr();
+
+       q15_t *outp = output.ptr();
+       q15_t *tmpp = tmp.ptr();
+       q15_t *tmpoutp = tmpout.ptr();
+       int fftscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q15>(this->nb)->format;
+
+       status=analytic_signal((const FFTSCI::Q15*)inp,(FFTSCI::Q15*)tmpp,(FFTSCI::Q15*)outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       // Scaling of the CFFT and of the CIFFT
+       for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+       {
+          tmpoutp[i] = ((q63_t)outp[i] << (2*fftscaling));
+       }
+
+       ASSERT_SNR(tmpout,ref,(q15_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void AnalyticTestsQ15::test_hilbert_q15()
+    {
+       const q15_t *inp = input.ptr();
+
+       q15_t *outp = output.ptr();
+       q15_t *tmpp = tmp.ptr();
+       q15_t *tmpoutp = tmpout.ptr();
+       int fftscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q15>(this->nb)->format;
+
+       status=hilbert((const FFTSCI::Q15*)inp,(FFTSCI::Q15*)tmpp,(FFTSCI::Q15*)outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       // Scaling of the CFFT and of the CIFFT
+       for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+       {
+          tmpoutp[i] = ((q63_t)outp[i] << (2*fftscaling));
+       }
+
+       ASSERT_SNR(tmpout,ref,(q15_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void AnalyticTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case AnalyticTestsQ15::TEST_ANALYTIC_Q15_1:
+             
+               input.reload(AnalyticTestsQ15::INPUTS_ANALYTIC_1_Q15_ID,mgr);
+               ref.reload(  AnalyticTestsQ15::REF_ANALYTIC_1_Q15_ID,mgr);
+             
+               this->nb=8;
+             
+             break;
+
+             case AnalyticTestsQ15::TEST_ANALYTIC_Q15_2:
+             
+               input.reload(AnalyticTestsQ15::INPUTS_ANALYTIC_2_Q15_ID,mgr);
+               ref.reload(  AnalyticTestsQ15::REF_ANALYTIC_2_Q15_ID,mgr);
+             
+               this->nb=16;
+             
+             break;
+
+             case AnalyticTestsQ15::TEST_HILBERT_Q15_3:
+             
+               input.reload(AnalyticTestsQ15::INPUTS_ANALYTIC_1_Q15_ID,mgr);
+               ref.reload(  AnalyticTestsQ15::REF_HILBERT_1_Q15_ID,mgr);
+             
+               this->nb=8;
+             
+             break;
+
+             case AnalyticTestsQ15::TEST_HILBERT_Q15_4:
+             
+               input.reload(AnalyticTestsQ15::INPUTS_ANALYTIC_2_Q15_ID,mgr);
+               ref.reload(  AnalyticTestsQ15::REF_HILBERT_2_Q15_ID,mgr);
+             
+               this->nb=16;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),AnalyticTestsQ15::OUTPUT_ANALYTIC_Q15_ID,mgr);
+       // Scratch of hilbert (analytic_signal is using 2*nb samples)
+       tmp.create(4*this->nb,AnalyticTestsQ15::TMP_ANALYTIC_Q15_ID,mgr);
+       tmpout.create(ref.nbSamples(),AnalyticTestsQ15::TMPOUT_ANALYTIC_Q15_ID,mgr);
+
+    }
+
+    void AnalyticTestsQ15::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
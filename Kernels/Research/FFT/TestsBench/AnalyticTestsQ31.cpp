@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "AnalyticTestsQ31.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+/*
+
+The output is the analytic signal divided by 2 with the
+scaling of cifft(cfft(x)) : the reference is the analytic
+signal divided by 2 and 2*format bits are lost.
+In q15, only short lengths are tested.
+
+*/
+#define SNR_THRESHOLD 60
+
+    void AnalyticTestsQ31::test_analytic_q31()
+    {
+       const q31_t *inp = input.ptr();
+
+       q31_t *outp = output.ptr();
+       q31_t *tmpp = tmp.ptr();
+       q31_t *tmpoutp = tmpout.ptr();
+       int fftscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q31>(this->nb)->format;
+
+       status=analytic_signal((const FFTSCI::Q31*)inp,(FFTSCI::Q31*)tmpp,(FFTSCI::Q31*)outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       // Scaling of the CFFT and of the CIFFT
+       for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+       {
+          tmpoutp[i] = ((q63_t)outp[i] << (2*fftscaling));
+       }
+
+       ASSERT_SNR(tmpout,ref,(q31_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void AnalyticTestsQ31::test_hilbert_q31()
+    {
+       const q31_t *inp = input.ptr();
+
+       q31_t *outp = output.ptr();
+       q31_t *tmpp = tmp.ptr();
+       q31_t *tmpoutp = tmpout.ptr();
+       int fftscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q31>(this->nb)->format;
+
+       status=hilbert((const FFTSCI::Q31*)inp,(FFTSCI::Q31*)tmpp,(FFTSCI::Q31*)outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       // Scaling of the CFFT and of the CIFFT
+       for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+       {
+          tmpoutp[i] = ((q63_t)outp[i] << (2*fftscaling));
+       }
+
+       ASSERT_SNR(tmpout,ref,(q31_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void AnalyticTestsQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case AnalyticTestsQ31::TEST_ANALYTIC_Q31_1:
+             
+               input.reload(AnalyticTestsQ31::INPUTS_ANALYTIC_1_Q31_ID,mgr);
+               ref.reload(  AnalyticTestsQ31::REF_ANALYTIC_1_Q31_ID,mgr);
+             
+               this->nb=64;
+             
+             break;
+
+             case AnalyticTestsQ31::TEST_ANALYTIC_Q31_2:
+             
+               input.reload(AnalyticTestsQ31::INPUTS_ANALYTIC_2_Q31_ID,mgr);
+               ref.reload(  AnalyticTestsQ31::REF_ANALYTIC_2_Q31_ID,mgr);
+             
+               this->nb=60;
+             
+             break;
+
+             case AnalyticTestsQ31::TEST_HILBERT_Q31_3:
+             
+               input.reload(AnalyticTestsQ31::INPUTS_ANALYTIC_1_Q31_ID,mgr);
+               ref.reload(  AnalyticTestsQ31::REF_HILBERT_1_Q31_ID,mgr);
+             
+               this->nb=64;
+             
+             break;
+
+             case AnalyticTestsQ31::TEST_HILBERT_Q31_4:
+             
+               input.reload(AnalyticTestsQ31::INPUTS_ANALYTIC_2_Q31_ID,mgr);
+               ref.reload(  AnalyticTestsQ31::REF_HILBERT_2_Q31_ID,mgr);
+             
+               this->nb=60;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),AnalyticTestsQ31::OUTPUT_ANALYTIC_Q31_ID,mgr);
+       // Scratch of hilbert (analytic_signal is using 2*nb samples)
+       tmp.create(4*this->nb,AnalyticTestsQ31::TMP_ANALYTIC_Q31_ID,mgr);
+       tmpout.create(ref.nbSamples(),AnalyticTestsQ31::TMPOUT_ANALYTIC_Q31_ID,mgr);
+
+    }
+
+    void AnalyticTestsQ31::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
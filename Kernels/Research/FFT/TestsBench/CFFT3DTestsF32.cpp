@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "CFFT3DTestsF32.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+#define SNR_THRESHOLD 120
+
+    void CFFT3DTestsF32::test_cfft3d_f32()
+    {
+       const float32_t *inp = input.ptr();
+
+       float32_t *outp = output.ptr();
+
+       status=cfft3D(inp,outp,this->depth,this->rows,this->cols,this->nbThreads);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void CFFT3DTestsF32::test_cifft3d_f32()
+    {
+       const float32_t *inp = input.ptr();
+
+       float32_t *outp = output.ptr();
+
+       status=cifft3D(inp,outp,this->depth,this->rows,this->cols,this->nbThreads);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void CFFT3DTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case CFFT3DTestsF32::TEST_CFFT3D_F32_1:
+             
+               input.reload(CFFT3DTestsF32::INPUTS_CFFT3D_NOISY_1_F32_ID,mgr);
+               ref.reload(  CFFT3DTestsF32::REF_CFFT3D_NOISY_1_F32_ID,mgr);
+             
+               this->depth=4;
+               this->rows=8;
+               this->cols=16;
+               this->nbThreads=1;
+             
+             break;
+
+             case CFFT3DTestsF32::TEST_CFFT3D_F32_2:
+             
+               input.reload(CFFT3DTestsF32::INPUTS_CFFT3D_NOISY_2_F32_ID,mgr);
+               ref.reload(  CFFT3DTestsF32::REF_CFFT3D_NOISY_2_F32_ID,mgr);
+             
+               this->depth=16;
+               this->rows=16;
+               this->cols=16;
+               this->nbThreads=2;
+             
+             break;
+
+             case CFFT3DTestsF32::TEST_CIFFT3D_F32_3:
+             
+               input.reload(CFFT3DTestsF32::INPUTS_CIFFT3D_NOISY_1_F32_ID,mgr);
+               ref.reload(  CFFT3DTestsF32::REF_CIFFT3D_NOISY_1_F32_ID,mgr);
+             
+               this->depth=4;
+               this->rows=8;
+               this->cols=16;
+               this->nbThreads=1;
+             
+             break;
+
+             case CFFT3DTestsF32::TEST_CIFFT3D_F32_4:
+             
+               input.reload(CFFT3DTestsF32::INPUTS_CIFFT3D_NOISY_2_F32_ID,mgr);
+               ref.reload(  CFFT3DTestsF32::REF_CIFFT3D_NOISY_2_F32_ID,mgr);
+             
+               this->depth=16;
+               this->rows=16;
+               this->cols=16;
+               this->nbThreads=2;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),CFFT3DTestsF32::OUTPUT_CFFT3D_F32_ID,mgr);
+
+    }
+
+    void CFFT3DTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
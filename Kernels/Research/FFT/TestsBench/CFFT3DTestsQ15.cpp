@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "CFFT3DTestsQ15.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+#include "FixedPointScaling.h"
+
+#define SNR_THRESHOLD 48
+/* The output of the inverse FFT is scaled by
+2^-format twice (formats of the three dimensions)
+so it is only tested for the smallest volume */
+#define IFFT_SNR_THRESHOLD 30
+
+    void CFFT3DTestsQ15::test_cfft3d_q15()
+    {
+       const q15_t *inp = input.ptr();
+
+       q15_t *outp = output.ptr();
+       q15_t *tmpoutp = tmpout.ptr();
+       int fftscaling ,testscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q15>(this->depth)->format +
+         cfft_config<FFTSCI::Q15>(this->rows)->format +
+         cfft_config<FFTSCI::Q15>(this->cols)->format;
+       testscaling = scaling(this->depth) + scaling(this->rows) + scaling(this->cols);
+
+       status=cfft3D((const FFTSCI::Q15*)inp,(FFTSCI::Q15*)outp,this->depth,this->rows,this->cols,this->nbThreads);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       if ((testscaling-fftscaling) > 0)
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+       }
+       else
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = ((q63_t)outp[i] << (fftscaling - testscaling));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q15_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void CFFT3DTestsQ15::test_cifft3d_q15()
+    {
+       const q15_t *inp = input.ptr();
+
+       q15_t *outp = output.ptr();
+       q15_t *tmpoutp = tmpout.ptr();
+       int fftscaling ,testscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q15>(this->depth)->format +
+         cfft_config<FFTSCI::Q15>(this->rows)->format +
+         cfft_config<FFTSCI::Q15>(this->cols)->format;
+       testscaling = 2;
+
+       status=cifft3D((const FFTSCI::Q15*)inp,(FFTSCI::Q15*)outp,this->depth,this->rows,this->cols,this->nbThreads);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       if ((testscaling-fftscaling) > 0)
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+       }
+       else
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = ((q63_t)outp[i] << (fftscaling - testscaling));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q15_t)IFFT_SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void CFFT3DTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case CFFT3DTestsQ15::TEST_CFFT3D_Q15_1:
+             
+               input.reload(CFFT3DTestsQ15::INPUTS_CFFT3D_NOISY_1_Q15_ID,mgr);
+               ref.reload(  CFFT3DTestsQ15::REF_CFFT3D_NOISY_1_Q15_ID,mgr);
+             
+               this->depth=4;
+               this->rows=8;
+               this->cols=16;
+               this->nbThreads=1;
+             
+             break;
+
+             case CFFT3DTestsQ15::TEST_CFFT3D_Q15_2:
+             
+               input.reload(CFFT3DTestsQ15::INPUTS_CFFT3D_NOISY_2_Q15_ID,mgr);
+               ref.reload(  CFFT3DTestsQ15::REF_CFFT3D_NOISY_2_Q15_ID,mgr);
+             
+               this->depth=2;
+               this->rows=4;
+               this->cols=4;
+               this->nbThreads=1;
+             
+             break;
+
+             case CFFT3DTestsQ15::TEST_CIFFT3D_Q15_3:
+             
+               input.reload(CFFT3DTestsQ15::INPUTS_CIFFT3D_NOISY_2_Q15_ID,mgr);
+               ref.reload(  CFFT3DTestsQ15::REF_CIFFT3D_NOISY_2_Q15_ID,mgr);
+             
+               this->depth=2;
+               this->rows=4;
+               this->cols=4;
+               this->nbThreads=1;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),CFFT3DTestsQ15::OUTPUT_CFFT3D_Q15_ID,mgr);
+       tmpout.create(ref.nbSamples(),CFFT3DTestsQ15::TMPOUT_CFFT3D_Q15_ID,mgr);
+
+    }
+
+    void CFFT3DTestsQ15::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "ChannelizerTestsF16.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+#define SNR_THRESHOLD 56
+
+    void ChannelizerTestsF16::test_channelizer_f16()
+    {
+       const float16_t *inp = input.ptr();
+       channelizerstate<float16_t> S;
+       uint32_t nbOut;
+
+       float16_t *outp = output.ptr();
+
+       // The input is given in two updates which are not
+       // ending on a hop
+       const uint32_t nbSamples = input.nbSamples() >> 1;
+       const uint32_t first = nbSamples / 3;
+
+       status=channelizer_init(&S,this->nbChannels,this->nbTaps,this->hop,this->delay,this->tmp);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       nbOut = channelizer(&S,inp,first,outp);
+       ASSERT_TRUE(nbOut == first / this->hop);
+
+       nbOut += channelizer(&S,inp + 2*first,nbSamples - first,outp + 2*this->nbChannels*nbOut);
+       ASSERT_TRUE(nbOut == nbSamples / this->hop);
+
+       ASSERT_SNR(output,ref,(float16_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void ChannelizerTestsF16::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case ChannelizerTestsF16::TEST_CHANNELIZER_F16_1:
+             
+               input.reload(ChannelizerTestsF16::INPUTS_CHANNELIZER_1_F16_ID,mgr);
+               ref.reload(  ChannelizerTestsF16::REF_CHANNELIZER_1_F16_ID,mgr);
+             
+               this->nbChannels=16;
+               this->nbTaps=8;
+               this->hop=16;
+             
+             break;
+
+             case ChannelizerTestsF16::TEST_CHANNELIZER_F16_2:
+             
+               input.reload(ChannelizerTestsF16::INPUTS_CHANNELIZER_2_F16_ID,mgr);
+               ref.reload(  ChannelizerTestsF16::REF_CHANNELIZER_2_F16_ID,mgr);
+             
+               this->nbChannels=32;
+               this->nbTaps=8;
+               this->hop=12;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),ChannelizerTestsF16::OUTPUT_CHANNELIZER_F16_ID,mgr);
+
+    }
+
+    void ChannelizerTestsF16::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
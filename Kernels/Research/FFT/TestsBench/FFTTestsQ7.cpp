@@ -0,0 +1,261 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "FFTTestsQ7.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+#include "FixedPointScaling.h"
+
+#define SNR_THRESHOLD 20
+/* The output of the inverse FFTs is scaled
+by 2^-format twice so only the length 4 is tested */
+#define IFFT_SNR_THRESHOLD 10
+
+    void FFTTestsQ7::test_cfft_q7()
+    {
+       const q7_t *inp = input.ptr();
+
+       q7_t *outp = output.ptr();
+       q7_t *tmpoutp = tmpout.ptr();
+       int fftscaling ,testscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q7>(this->nb)->format;
+       testscaling = scaling(this->nb);
+
+       status=cfft((const FFTSCI::Q7*)inp,(FFTSCI::Q7*)outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       if ((testscaling-fftscaling) > 0)
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+       }
+       else
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = ((q15_t)outp[i] << (fftscaling - testscaling));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q7_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void FFTTestsQ7::test_cifft_q7()
+    {
+       const q7_t *inp = input.ptr();
+
+       q7_t *outp = output.ptr();
+       q7_t *tmpoutp = tmpout.ptr();
+       int fftscaling ,testscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q7>(this->nb)->format;
+       testscaling = 2;
+
+       status=cifft((const FFTSCI::Q7*)inp,(FFTSCI::Q7*)outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       if ((testscaling-fftscaling) > 0)
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+       }
+       else
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = ((q15_t)outp[i] << (fftscaling - testscaling));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q7_t)IFFT_SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void FFTTestsQ7::test_rfft_q7()
+    {
+       const q7_t *inp = input.ptr();
+
+       q7_t *outp = output.ptr();
+       q7_t *tmpp = tmp.ptr();
+       q7_t *tmpoutp = tmpout.ptr();
+       int fftscaling ,testscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q7>((this->nb>>1))->format;
+       testscaling = scaling((this->nb>>1));
+
+       status=rfft((const FFTSCI::Q7*)inp,(FFTSCI::Q7*)tmpp,(FFTSCI::Q7*)outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       if ((testscaling-fftscaling) > 0)
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+       }
+       else
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = ((q15_t)outp[i] << (fftscaling - testscaling));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q7_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void FFTTestsQ7::test_rifft_q7()
+    {
+       const q7_t *inp = input.ptr();
+
+       q7_t *outp = output.ptr();
+       q7_t *tmpp = tmp.ptr();
+       q7_t *tmpoutp = tmpout.ptr();
+       int fftscaling ,testscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q7>((this->nb>>1))->format;
+       testscaling = 2;
+
+       status=rifft((const FFTSCI::Q7*)inp,(FFTSCI::Q7*)tmpp,(FFTSCI::Q7*)outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       if ((testscaling-fftscaling) > 0)
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+       }
+       else
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = ((q15_t)outp[i] << (fftscaling - testscaling));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q7_t)IFFT_SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void FFTTestsQ7::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case FFTTestsQ7::TEST_CFFT_Q7_1:
+             
+               input.reload(FFTTestsQ7::INPUTS_CFFT_1_Q7_ID,mgr);
+               ref.reload(  FFTTestsQ7::REF_CFFT_1_Q7_ID,mgr);
+             
+               this->nb=4;
+             
+             break;
+
+             case FFTTestsQ7::TEST_CFFT_Q7_2:
+             
+               input.reload(FFTTestsQ7::INPUTS_CFFT_2_Q7_ID,mgr);
+               ref.reload(  FFTTestsQ7::REF_CFFT_2_Q7_ID,mgr);
+             
+               this->nb=6;
+             
+             break;
+
+             case FFTTestsQ7::TEST_CFFT_Q7_3:
+             
+               input.reload(FFTTestsQ7::INPUTS_CFFT_3_Q7_ID,mgr);
+               ref.reload(  FFTTestsQ7::REF_CFFT_3_Q7_ID,mgr);
+             
+               this->nb=16;
+             
+             break;
+
+             case FFTTestsQ7::TEST_CIFFT_Q7_4:
+             
+               input.reload(FFTTestsQ7::INPUTS_CIFFT_1_Q7_ID,mgr);
+               ref.reload(  FFTTestsQ7::REF_CIFFT_1_Q7_ID,mgr);
+             
+               this->nb=4;
+             
+             break;
+
+             case FFTTestsQ7::TEST_RFFT_Q7_5:
+             
+               input.reload(FFTTestsQ7::INPUTS_RFFT_1_Q7_ID,mgr);
+               ref.reload(  FFTTestsQ7::REF_RFFT_1_Q7_ID,mgr);
+             
+               this->nb=4;
+             
+             break;
+
+             case FFTTestsQ7::TEST_RFFT_Q7_6:
+             
+               input.reload(FFTTestsQ7::INPUTS_RFFT_2_Q7_ID,mgr);
+               ref.reload(  FFTTestsQ7::REF_RFFT_2_Q7_ID,mgr);
+             
+               this->nb=6;
+             
+             break;
+
+             case FFTTestsQ7::TEST_RFFT_Q7_7:
+             
+               input.reload(FFTTestsQ7::INPUTS_RFFT_3_Q7_ID,mgr);
+               ref.reload(  FFTTestsQ7::REF_RFFT_3_Q7_ID,mgr);
+             
+               this->nb=16;
+             
+             break;
+
+             case FFTTestsQ7::TEST_RIFFT_Q7_8:
+             
+               input.reload(FFTTestsQ7::INPUTS_RIFFT_1_Q7_ID,mgr);
+               ref.reload(  FFTTestsQ7::REF_RIFFT_1_Q7_ID,mgr);
+             
+               this->nb=4;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),FFTTestsQ7::OUTPUT_Q7_ID,mgr);
+       tmp.create(this->nb,FFTTestsQ7::TMP_Q7_ID,mgr);
+       tmpout.create(ref.nbSamples(),FFTTestsQ7::TMPOUT_Q7_ID,mgr);
+
+    }
+
+    void FFTTestsQ7::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
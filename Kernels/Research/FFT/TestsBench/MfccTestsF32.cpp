@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "MfccTestsF32.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+/*
+
+The reference is computed with numpy from the mel filters
+and DCT generated by config/mfcc.py.
+
+*/
+#define SNR_THRESHOLD 120
+
+    void MfccTestsF32::test_mfcc_f32()
+    {
+       const float32_t *inp = input.ptr();
+       const float32_t *windowp = this->windowed ? window.ptr() : NULL;
+
+       float32_t *outp = output.ptr();
+       float32_t *tmpp = tmp.ptr();
+
+       status=mfcc(inp,windowp,tmpp,outp,this->nb,this->nbMel,this->nbDct);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void MfccTestsF32::test_mfcc_length_error_f32()
+    {
+       const float32_t *inp = input.ptr();
+
+       float32_t *outp = output.ptr();
+       float32_t *tmpp = tmp.ptr();
+
+       status=mfcc(inp,(const float32_t*)NULL,tmpp,outp,this->nb,this->nbMel+1,this->nbDct);
+       ASSERT_TRUE(status==ARM_MATH_LENGTH_ERROR);
+
+    } 
+
+    void MfccTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case MfccTestsF32::TEST_MFCC_F32_1:
+             
+               input.reload(MfccTestsF32::INPUTS_MFCC_1_F32_ID,mgr);
+               window.reload(MfccTestsF32::WINDOW_MFCC_1_F32_ID,mgr);
+               ref.reload(  MfccTestsF32::REF_MFCC_RECT_1_F32_ID,mgr);
+             
+               this->nb=512;
+               this->nbMel=40;
+               this->nbDct=13;
+               this->windowed=0;
+             
+             break;
+
+             case MfccTestsF32::TEST_MFCC_F32_2:
+             
+               input.reload(MfccTestsF32::INPUTS_MFCC_1_F32_ID,mgr);
+               window.reload(MfccTestsF32::WINDOW_MFCC_1_F32_ID,mgr);
+               ref.reload(  MfccTestsF32::REF_MFCC_HANN_1_F32_ID,mgr);
+             
+               this->nb=512;
+               this->nbMel=40;
+               this->nbDct=13;
+               this->windowed=1;
+             
+             break;
+
+             case MfccTestsF32::TEST_MFCC_LENGTH_ERROR_F32_3:
+             
+               input.reload(MfccTestsF32::INPUTS_MFCC_1_F32_ID,mgr);
+               ref.reload(  MfccTestsF32::REF_MFCC_RECT_1_F32_ID,mgr);
+             
+               this->nb=512;
+               this->nbMel=40;
+               this->nbDct=13;
+               this->windowed=0;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),MfccTestsF32::OUTPUT_MFCC_F32_ID,mgr);
+       /* N samples for the FFT and N/2+1 for the power spectrum */
+       tmp.create(this->nb + (this->nb >> 1) + 1,MfccTestsF32::TMP_MFCC_F32_ID,mgr);
+
+    }
+
+    void MfccTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,176 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "MixedTestsF16.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+#define SNR_THRESHOLD 60
+
+    void MixedTestsF16::test_cfft_mixed_f16()
+    {
+       const float16_t *inp = input.ptr();
+
+       float16_t *outp = output.ptr();
+
+       status=cfft_mixed(inp,outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float16_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void MixedTestsF16::test_cifft_mixed_f16()
+    {
+       const float16_t *inp = input.ptr();
+
+       float16_t *outp = output.ptr();
+
+       status=cifft_mixed(inp,outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float16_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void MixedTestsF16::test_rfft_mixed_f16()
+    {
+       const float16_t *inp = input.ptr();
+
+       float16_t *outp = output.ptr();
+       float16_t *tmpp = tmp.ptr();
+
+       status=rfft_mixed(inp,tmpp,outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float16_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void MixedTestsF16::test_rifft_mixed_f16()
+    {
+       const float16_t *inp = input.ptr();
+
+       float16_t *outp = output.ptr();
+       float16_t *tmpp = tmp.ptr();
+
+       status=rifft_mixed(inp,tmpp,outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float16_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void MixedTestsF16::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case MixedTestsF16::TEST_CFFT_MIXED_F16_1:
+             
+               input.reload(MixedTestsF16::INPUTS_CFFT_1_F16_ID,mgr);
+               ref.reload(  MixedTestsF16::REF_CFFT_1_F16_ID,mgr);
+             
+               this->nb=256;
+             
+             break;
+
+             case MixedTestsF16::TEST_CFFT_MIXED_F16_2:
+             
+               input.reload(MixedTestsF16::INPUTS_CFFT_2_F16_ID,mgr);
+               ref.reload(  MixedTestsF16::REF_CFFT_2_F16_ID,mgr);
+             
+               this->nb=120;
+             
+             break;
+
+             case MixedTestsF16::TEST_CIFFT_MIXED_F16_3:
+             
+               input.reload(MixedTestsF16::INPUTS_CIFFT_1_F16_ID,mgr);
+               ref.reload(  MixedTestsF16::REF_CIFFT_1_F16_ID,mgr);
+             
+               this->nb=256;
+             
+             break;
+
+             case MixedTestsF16::TEST_CIFFT_MIXED_F16_4:
+             
+               input.reload(MixedTestsF16::INPUTS_CIFFT_2_F16_ID,mgr);
+               ref.reload(  MixedTestsF16::REF_CIFFT_2_F16_ID,mgr);
+             
+               this->nb=120;
+             
+             break;
+
+             case MixedTestsF16::TEST_RFFT_MIXED_F16_5:
+             
+               input.reload(MixedTestsF16::INPUTS_RFFT_1_F16_ID,mgr);
+               ref.reload(  MixedTestsF16::REF_RFFT_1_F16_ID,mgr);
+             
+               this->nb=256;
+             
+             break;
+
+             case MixedTestsF16::TEST_RFFT_MIXED_F16_6:
+             
+               input.reload(MixedTestsF16::INPUTS_RFFT_2_F16_ID,mgr);
+               ref.reload(  MixedTestsF16::REF_RFFT_2_F16_ID,mgr);
+             
+               this->nb=120;
+             
+             break;
+
+             case MixedTestsF16::TEST_RIFFT_MIXED_F16_7:
+             
+               input.reload(MixedTestsF16::INPUTS_RIFFT_1_F16_ID,mgr);
+               ref.reload(  MixedTestsF16::REF_RIFFT_1_F16_ID,mgr);
+             
+               this->nb=256;
+             
+             break;
+
+             case MixedTestsF16::TEST_RIFFT_MIXED_F16_8:
+             
+               input.reload(MixedTestsF16::INPUTS_RIFFT_2_F16_ID,mgr);
+               ref.reload(  MixedTestsF16::REF_RIFFT_2_F16_ID,mgr);
+             
+               this->nb=120;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),MixedTestsF16::OUTPUT_MIXED_F16_ID,mgr);
+       tmp.create(this->nb,MixedTestsF16::TMP_MIXED_F16_ID,mgr);
+
+    }
+
+    void MixedTestsF16::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,265 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "MixedTestsQ31.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+#include "FixedPointScaling.h"
+
+#define SNR_THRESHOLD 89
+/* The inverse FFTs have a lower SNR
+(about 88 dB for 256 samples) */
+#define IFFT_SNR_THRESHOLD 80
+
+    void MixedTestsQ31::test_cfft_mixed_q31()
+    {
+       const q31_t *inp = input.ptr();
+
+       q31_t *outp = output.ptr();
+       q31_t *tmpoutp = tmpout.ptr();
+       int fftscaling ,testscaling;
+
+       // The Q31 FFTs with Q15 twiddles are using the q15 configurations
+       fftscaling = cfft_config<FFTSCI::Q15>(this->nb)->format;
+       testscaling = scaling(this->nb);
+
+       status=cfft_mixed((const FFTSCI::Q31*)inp,(FFTSCI::Q31*)outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       if ((testscaling-fftscaling) > 0)
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+       }
+       else
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = ((q63_t)outp[i] << (fftscaling - testscaling));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q31_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void MixedTestsQ31::test_cifft_mixed_q31()
+    {
+       const q31_t *inp = input.ptr();
+
+       q31_t *outp = output.ptr();
+       q31_t *tmpoutp = tmpout.ptr();
+       int fftscaling ,testscaling;
+
+       // The Q31 FFTs with Q15 twiddles are using the q15 configurations
+       fftscaling = cfft_config<FFTSCI::Q15>(this->nb)->format;
+       testscaling = 2;
+
+       status=cifft_mixed((const FFTSCI::Q31*)inp,(FFTSCI::Q31*)outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       if ((testscaling-fftscaling) > 0)
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+       }
+       else
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = ((q63_t)outp[i] << (fftscaling - testscaling));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q31_t)IFFT_SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void MixedTestsQ31::test_rfft_mixed_q31()
+    {
+       const q31_t *inp = input.ptr();
+
+       q31_t *outp = output.ptr();
+       q31_t *tmpp = tmp.ptr();
+       q31_t *tmpoutp = tmpout.ptr();
+       int fftscaling ,testscaling;
+
+       // The Q31 FFTs with Q15 twiddles are using the q15 configurations
+       fftscaling = cfft_config<FFTSCI::Q15>((this->nb>>1))->format;
+       testscaling = scaling((this->nb>>1));
+
+       status=rfft_mixed((const FFTSCI::Q31*)inp,(FFTSCI::Q31*)tmpp,(FFTSCI::Q31*)outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       if ((testscaling-fftscaling) > 0)
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+       }
+       else
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = ((q63_t)outp[i] << (fftscaling - testscaling));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q31_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void MixedTestsQ31::test_rifft_mixed_q31()
+    {
+       const q31_t *inp = input.ptr();
+
+       q31_t *outp = output.ptr();
+       q31_t *tmpp = tmp.ptr();
+       q31_t *tmpoutp = tmpout.ptr();
+       int fftscaling ,testscaling;
+
+       // The Q31 FFTs with Q15 twiddles are using the q15 configurations
+       fftscaling = cfft_config<FFTSCI::Q15>((this->nb>>1))->format;
+       testscaling = 2;
+
+       status=rifft_mixed((const FFTSCI::Q31*)inp,(FFTSCI::Q31*)tmpp,(FFTSCI::Q31*)outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       if ((testscaling-fftscaling) > 0)
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+       }
+       else
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = ((q63_t)outp[i] << (fftscaling - testscaling));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q31_t)IFFT_SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void MixedTestsQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case MixedTestsQ31::TEST_CFFT_MIXED_Q31_1:
+             
+               input.reload(MixedTestsQ31::INPUTS_CFFT_1_Q31_ID,mgr);
+               ref.reload(  MixedTestsQ31::REF_CFFT_1_Q31_ID,mgr);
+             
+               this->nb=256;
+             
+             break;
+
+             case MixedTestsQ31::TEST_CFFT_MIXED_Q31_2:
+             
+               input.reload(MixedTestsQ31::INPUTS_CFFT_2_Q31_ID,mgr);
+               ref.reload(  MixedTestsQ31::REF_CFFT_2_Q31_ID,mgr);
+             
+               this->nb=120;
+             
+             break;
+
+             case MixedTestsQ31::TEST_CIFFT_MIXED_Q31_3:
+             
+               input.reload(MixedTestsQ31::INPUTS_CIFFT_1_Q31_ID,mgr);
+               ref.reload(  MixedTestsQ31::REF_CIFFT_1_Q31_ID,mgr);
+             
+               this->nb=256;
+             
+             break;
+
+             case MixedTestsQ31::TEST_CIFFT_MIXED_Q31_4:
+             
+               input.reload(MixedTestsQ31::INPUTS_CIFFT_2_Q31_ID,mgr);
+               ref.reload(  MixedTestsQ31::REF_CIFFT_2_Q31_ID,mgr);
+             
+               this->nb=120;
+             
+             break;
+
+             case MixedTestsQ31::TEST_RFFT_MIXED_Q31_5:
+             
+               input.reload(MixedTestsQ31::INPUTS_RFFT_1_Q31_ID,mgr);
+               ref.reload(  MixedTestsQ31::REF_RFFT_1_Q31_ID,mgr);
+             
+               this->nb=256;
+             
+             break;
+
+             case MixedTestsQ31::TEST_RFFT_MIXED_Q31_6:
+             
+               input.reload(MixedTestsQ31::INPUTS_RFFT_2_Q31_ID,mgr);
+               ref.reload(  MixedTestsQ31::REF_RFFT_2_Q31_ID,mgr);
+             
+               this->nb=120;
+             
+             break;
+
+             case MixedTestsQ31::TEST_RIFFT_MIXED_Q31_7:
+             
+               input.reload(MixedTestsQ31::INPUTS_RIFFT_1_Q31_ID,mgr);
+               ref.reload(  MixedTestsQ31::REF_RIFFT_1_Q31_ID,mgr);
+             
+               this->nb=256;
+             
+             break;
+
+             case MixedTestsQ31::TEST_RIFFT_MIXED_Q31_8:
+             
+               input.reload(MixedTestsQ31::INPUTS_RIFFT_2_Q31_ID,mgr);
+               ref.reload(  MixedTestsQ31::REF_RIFFT_2_Q31_ID,mgr);
+             
+               this->nb=120;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),MixedTestsQ31::OUTPUT_MIXED_Q31_ID,mgr);
+       tmp.create(this->nb,MixedTestsQ31::TMP_MIXED_Q31_ID,mgr);
+       tmpout.create(ref.nbSamples(),MixedTestsQ31::TMPOUT_MIXED_Q31_ID,mgr);
+
+    }
+
+    void MixedTestsQ31::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
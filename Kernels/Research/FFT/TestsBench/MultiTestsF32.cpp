@@ -0,0 +1,159 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "MultiTestsF32.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+/*
+
+The channels are interleaved in the inputs and in the
+outputs of the CFFT. The spectra of the RFFT are one
+after the other.
+
+*/
+#define SNR_THRESHOLD 120
+#define IFFT_SNR_THRESHOLD 120
+#define RFFT_SNR_THRESHOLD 120
+
+    void MultiTestsF32::test_cfft_multi_f32()
+    {
+       const float32_t *inp = input.ptr();
+
+       float32_t *outp = output.ptr();
+
+       if (this->ifft)
+       {
+          status=cifft_multi(inp,outp,this->nb,this->nbChannels);
+       }
+       else
+       {
+          status=cfft_multi(inp,outp,this->nb,this->nbChannels);
+       }
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float32_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void MultiTestsF32::test_rfft_multi_f32()
+    {
+       const float32_t *inp = input.ptr();
+
+       float32_t *outp = output.ptr();
+       float32_t *tmpp = tmp.ptr();
+
+       status=rfft_multi(inp,tmpp,outp,this->nb,this->nbChannels);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float32_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void MultiTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case MultiTestsF32::TEST_CFFT_MULTI_F32_1:
+             
+               input.reload(MultiTestsF32::INPUTS_MULTI_FFT_1_F32_ID,mgr);
+               ref.reload(  MultiTestsF32::REF_MULTI_FFT_1_F32_ID,mgr);
+             
+               this->nb=64;
+               this->nbChannels=2;
+               this->ifft=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case MultiTestsF32::TEST_CFFT_MULTI_F32_2:
+             
+               input.reload(MultiTestsF32::INPUTS_MULTI_FFT_2_F32_ID,mgr);
+               ref.reload(  MultiTestsF32::REF_MULTI_FFT_2_F32_ID,mgr);
+             
+               this->nb=60;
+               this->nbChannels=3;
+               this->ifft=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case MultiTestsF32::TEST_CFFT_MULTI_F32_3:
+             
+               input.reload(MultiTestsF32::INPUTS_MULTI_IFFT_1_F32_ID,mgr);
+               ref.reload(  MultiTestsF32::REF_MULTI_IFFT_1_F32_ID,mgr);
+             
+               this->nb=64;
+               this->nbChannels=2;
+               this->ifft=1;
+               this->snr=IFFT_SNR_THRESHOLD;
+             
+             break;
+
+             case MultiTestsF32::TEST_CFFT_MULTI_F32_4:
+             
+               input.reload(MultiTestsF32::INPUTS_MULTI_IFFT_2_F32_ID,mgr);
+               ref.reload(  MultiTestsF32::REF_MULTI_IFFT_2_F32_ID,mgr);
+             
+               this->nb=60;
+               this->nbChannels=3;
+               this->ifft=1;
+               this->snr=IFFT_SNR_THRESHOLD;
+             
+             break;
+
+             case MultiTestsF32::TEST_RFFT_MULTI_F32_5:
+             
+               input.reload(MultiTestsF32::INPUTS_MULTI_RFFT_1_F32_ID,mgr);
+               ref.reload(  MultiTestsF32::REF_MULTI_RFFT_1_F32_ID,mgr);
+             
+               this->nb=64;
+               this->nbChannels=2;
+               this->ifft=0;
+               this->snr=RFFT_SNR_THRESHOLD;
+             
+             break;
+
+             case MultiTestsF32::TEST_RFFT_MULTI_F32_6:
+             
+               input.reload(MultiTestsF32::INPUTS_MULTI_RFFT_2_F32_ID,mgr);
+               ref.reload(  MultiTestsF32::REF_MULTI_RFFT_2_F32_ID,mgr);
+             
+               this->nb=60;
+               this->nbChannels=3;
+               this->ifft=0;
+               this->snr=RFFT_SNR_THRESHOLD;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),MultiTestsF32::OUTPUT_MULTI_F32_ID,mgr);
+       tmp.create(this->nb,MultiTestsF32::TMP_MULTI_F32_ID,mgr);
+
+    }
+
+    void MultiTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,198 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "MultiTestsQ15.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+#include "FixedPointScaling.h"
+
+/*
+
+The channels are interleaved in the inputs and in the
+outputs of the CFFT. The spectra of the RFFT are one
+after the other.
+In q15, the inverse FFTs lose 2*format bits (like cifft) :
+the inverse of length 60 is disabled.
+
+*/
+#define SNR_THRESHOLD 35
+#define IFFT_SNR_THRESHOLD 12
+#define RFFT_SNR_THRESHOLD 35
+
+    void MultiTestsQ15::test_cfft_multi_q15()
+    {
+       const q15_t *inp = input.ptr();
+
+       q15_t *outp = output.ptr();
+       q15_t *tmpoutp = tmpout.ptr();
+       int fftscaling,testscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q15>(this->nb)->format;
+
+       if (this->ifft)
+       {
+          testscaling = 2;
+          status=cifft_multi((const FFTSCI::Q15*)inp,(FFTSCI::Q15*)outp,this->nb,this->nbChannels);
+       }
+       else
+       {
+          testscaling = scaling(this->nb);
+          status=cfft_multi((const FFTSCI::Q15*)inp,(FFTSCI::Q15*)outp,this->nb,this->nbChannels);
+       }
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+       {
+          if ((testscaling-fftscaling) > 0)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+          else
+          {
+             tmpoutp[i] = __SSAT(((q31_t)outp[i] << (fftscaling - testscaling)),16);
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q15_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void MultiTestsQ15::test_rfft_multi_q15()
+    {
+       const q15_t *inp = input.ptr();
+
+       q15_t *outp = output.ptr();
+       q15_t *tmpp = tmp.ptr();
+       q15_t *tmpoutp = tmpout.ptr();
+       int fftscaling,testscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q15>(this->nb >> 1)->format;
+       testscaling = scaling(this->nb >> 1);
+
+       status=rfft_multi((const FFTSCI::Q15*)inp,(FFTSCI::Q15*)tmpp,(FFTSCI::Q15*)outp,this->nb,this->nbChannels);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+       {
+          if ((testscaling-fftscaling) > 0)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+          else
+          {
+             tmpoutp[i] = __SSAT(((q31_t)outp[i] << (fftscaling - testscaling)),16);
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q15_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void MultiTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case MultiTestsQ15::TEST_CFFT_MULTI_Q15_1:
+             
+               input.reload(MultiTestsQ15::INPUTS_MULTI_FFT_1_Q15_ID,mgr);
+               ref.reload(  MultiTestsQ15::REF_MULTI_FFT_1_Q15_ID,mgr);
+             
+               this->nb=64;
+               this->nbChannels=2;
+               this->ifft=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case MultiTestsQ15::TEST_CFFT_MULTI_Q15_2:
+             
+               input.reload(MultiTestsQ15::INPUTS_MULTI_FFT_2_Q15_ID,mgr);
+               ref.reload(  MultiTestsQ15::REF_MULTI_FFT_2_Q15_ID,mgr);
+             
+               this->nb=60;
+               this->nbChannels=3;
+               this->ifft=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case MultiTestsQ15::TEST_CFFT_MULTI_Q15_3:
+             
+               input.reload(MultiTestsQ15::INPUTS_MULTI_IFFT_1_Q15_ID,mgr);
+               ref.reload(  MultiTestsQ15::REF_MULTI_IFFT_1_Q15_ID,mgr);
+             
+               this->nb=64;
+               this->nbChannels=2;
+               this->ifft=1;
+               this->snr=IFFT_SNR_THRESHOLD;
+             
+             break;
+
+             case MultiTestsQ15::TEST_CFFT_MULTI_Q15_4:
+             
+               input.reload(MultiTestsQ15::INPUTS_MULTI_IFFT_2_Q15_ID,mgr);
+               ref.reload(  MultiTestsQ15::REF_MULTI_IFFT_2_Q15_ID,mgr);
+             
+               this->nb=60;
+               this->nbChannels=3;
+               this->ifft=1;
+               this->snr=IFFT_SNR_THRESHOLD;
+             
+             break;
+
+             case MultiTestsQ15::TEST_RFFT_MULTI_Q15_5:
+             
+               input.reload(MultiTestsQ15::INPUTS_MULTI_RFFT_1_Q15_ID,mgr);
+               ref.reload(  MultiTestsQ15::REF_MULTI_RFFT_1_Q15_ID,mgr);
+             
+               this->nb=64;
+               this->nbChannels=2;
+               this->ifft=0;
+               this->snr=RFFT_SNR_THRESHOLD;
+             
+             break;
+
+             case MultiTestsQ15::TEST_RFFT_MULTI_Q15_6:
+             
+               input.reload(MultiTestsQ15::INPUTS_MULTI_RFFT_2_Q15_ID,mgr);
+               ref.reload(  MultiTestsQ15::REF_MULTI_RFFT_2_Q15_ID,mgr);
+             
+               this->nb=60;
+               this->nbChannels=3;
+               this->ifft=0;
+               this->snr=RFFT_SNR_THRESHOLD;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),MultiTestsQ15::OUTPUT_MULTI_Q15_ID,mgr);
+       tmp.create(this->nb,MultiTestsQ15::TMP_MULTI_Q15_ID,mgr);
+       tmpout.create(ref.nbSamples(),MultiTestsQ15::TMPOUT_MULTI_Q15_ID,mgr);
+
+    }
+
+    void MultiTestsQ15::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,196 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "MultiTestsQ31.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+#include "FixedPointScaling.h"
+
+/*
+
+The channels are interleaved in the inputs and in the
+outputs of the CFFT. The spectra of the RFFT are one
+after the other.
+
+*/
+#define SNR_THRESHOLD 120
+#define IFFT_SNR_THRESHOLD 95
+#define RFFT_SNR_THRESHOLD 120
+
+    void MultiTestsQ31::test_cfft_multi_q31()
+    {
+       const q31_t *inp = input.ptr();
+
+       q31_t *outp = output.ptr();
+       q31_t *tmpoutp = tmpout.ptr();
+       int fftscaling,testscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q31>(this->nb)->format;
+
+       if (this->ifft)
+       {
+          testscaling = 2;
+          status=cifft_multi((const FFTSCI::Q31*)inp,(FFTSCI::Q31*)outp,this->nb,this->nbChannels);
+       }
+       else
+       {
+          testscaling = scaling(this->nb);
+          status=cfft_multi((const FFTSCI::Q31*)inp,(FFTSCI::Q31*)outp,this->nb,this->nbChannels);
+       }
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+       {
+          if ((testscaling-fftscaling) > 0)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+          else
+          {
+             tmpoutp[i] = ((q63_t)outp[i] << (fftscaling - testscaling));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q31_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void MultiTestsQ31::test_rfft_multi_q31()
+    {
+       const q31_t *inp = input.ptr();
+
+       q31_t *outp = output.ptr();
+       q31_t *tmpp = tmp.ptr();
+       q31_t *tmpoutp = tmpout.ptr();
+       int fftscaling,testscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q31>(this->nb >> 1)->format;
+       testscaling = scaling(this->nb >> 1);
+
+       status=rfft_multi((const FFTSCI::Q31*)inp,(FFTSCI::Q31*)tmpp,(FFTSCI::Q31*)outp,this->nb,this->nbChannels);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+       {
+          if ((testscaling-fftscaling) > 0)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+          else
+          {
+             tmpoutp[i] = ((q63_t)outp[i] << (fftscaling - testscaling));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q31_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void MultiTestsQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case MultiTestsQ31::TEST_CFFT_MULTI_Q31_1:
+             
+               input.reload(MultiTestsQ31::INPUTS_MULTI_FFT_1_Q31_ID,mgr);
+               ref.reload(  MultiTestsQ31::REF_MULTI_FFT_1_Q31_ID,mgr);
+             
+               this->nb=64;
+               this->nbChannels=2;
+               this->ifft=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case MultiTestsQ31::TEST_CFFT_MULTI_Q31_2:
+             
+               input.reload(MultiTestsQ31::INPUTS_MULTI_FFT_2_Q31_ID,mgr);
+               ref.reload(  MultiTestsQ31::REF_MULTI_FFT_2_Q31_ID,mgr);
+             
+               this->nb=60;
+               this->nbChannels=3;
+               this->ifft=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case MultiTestsQ31::TEST_CFFT_MULTI_Q31_3:
+             
+               input.reload(MultiTestsQ31::INPUTS_MULTI_IFFT_1_Q31_ID,mgr);
+               ref.reload(  MultiTestsQ31::REF_MULTI_IFFT_1_Q31_ID,mgr);
+             
+               this->nb=64;
+               this->nbChannels=2;
+               this->ifft=1;
+               this->snr=IFFT_SNR_THRESHOLD;
+             
+             break;
+
+             case MultiTestsQ31::TEST_CFFT_MULTI_Q31_4:
+             
+               input.reload(MultiTestsQ31::INPUTS_MULTI_IFFT_2_Q31_ID,mgr);
+               ref.reload(  MultiTestsQ31::REF_MULTI_IFFT_2_Q31_ID,mgr);
+             
+               this->nb=60;
+               this->nbChannels=3;
+               this->ifft=1;
+               this->snr=IFFT_SNR_THRESHOLD;
+             
+             break;
+
+             case MultiTestsQ31::TEST_RFFT_MULTI_Q31_5:
+             
+               input.reload(MultiTestsQ31::INPUTS_MULTI_RFFT_1_Q31_ID,mgr);
+               ref.reload(  MultiTestsQ31::REF_MULTI_RFFT_1_Q31_ID,mgr);
+             
+               this->nb=64;
+               this->nbChannels=2;
+               this->ifft=0;
+               this->snr=RFFT_SNR_THRESHOLD;
+             
+             break;
+
+             case MultiTestsQ31::TEST_RFFT_MULTI_Q31_6:
+             
+               input.reload(MultiTestsQ31::INPUTS_MULTI_RFFT_2_Q31_ID,mgr);
+               ref.reload(  MultiTestsQ31::REF_MULTI_RFFT_2_Q31_ID,mgr);
+             
+               this->nb=60;
+               this->nbChannels=3;
+               this->ifft=0;
+               this->snr=RFFT_SNR_THRESHOLD;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),MultiTestsQ31::OUTPUT_MULTI_Q31_ID,mgr);
+       tmp.create(this->nb,MultiTestsQ31::TMP_MULTI_Q31_ID,mgr);
+       tmpout.create(ref.nbSamples(),MultiTestsQ31::TMPOUT_MULTI_Q31_ID,mgr);
+
+    }
+
+    void MultiTestsQ31::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
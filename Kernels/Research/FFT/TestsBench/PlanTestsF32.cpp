@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "PlanTestsF32.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+/*
+
+One test for each kind of plan : the scratch size is checked,
+a too short arena must be rejected and then the plan is executed.
+
+*/
+#define SNR_THRESHOLD 120
+#define IFFT_SNR_THRESHOLD 120
+
+    void PlanTestsF32::test_plan_f32()
+    {
+       const float32_t *inp = input.ptr();
+
+       float32_t *outp = output.ptr();
+       float32_t *scratchp = this->scratchSamples > 0 ? scratch.ptr() : NULL;
+       fftplan<float32_t> plan;
+
+       switch(this->kind)
+       {
+         case FFT_PLAN_CFFT:
+         case FFT_PLAN_CIFFT:
+           status=fft_plan_cfft(&plan,this->n,this->kind == FFT_PLAN_CIFFT);
+         break;
+
+         case FFT_PLAN_RFFT:
+         case FFT_PLAN_RIFFT:
+           status=fft_plan_rfft(&plan,this->n,this->kind == FFT_PLAN_RIFFT);
+         break;
+
+         default:
+           status=fft_plan_cfft2D(&plan,this->n,this->m,this->kind == FFT_PLAN_CIFFT2D);
+         break;
+       }
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+       ASSERT_TRUE(plan.kind == this->kind);
+       ASSERT_TRUE(fft_scratch_size(&plan) == this->scratchSamples);
+
+       if (this->scratchSamples > 0)
+       {
+          status=fft_execute(&plan,(const float32_t*)inp,(float32_t*)outp,(float32_t*)scratchp,this->scratchSamples - 1);
+          ASSERT_TRUE(status==ARM_MATH_ARGUMENT_ERROR);
+       }
+
+       status=fft_execute(&plan,(const float32_t*)inp,(float32_t*)outp,(float32_t*)scratchp,this->scratchSamples);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float32_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void PlanTestsF32::test_plan_length_error_f32()
+    {
+       fftplan<float32_t> plan;
+
+       status=fft_plan_cfft(&plan,7,0);
+       ASSERT_TRUE(status==ARM_MATH_LENGTH_ERROR);
+
+       status=fft_plan_cfft2D(&plan,8,7,0);
+       ASSERT_TRUE(status==ARM_MATH_LENGTH_ERROR);
+
+       status=fft_plan_rfft(&plan,14,0);
+       ASSERT_TRUE(status==ARM_MATH_LENGTH_ERROR);
+
+    } 
+
+    void PlanTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case PlanTestsF32::TEST_PLAN_F32_1:
+             
+               input.reload(PlanTestsF32::INPUTS_PLAN_CFFT_F32_ID,mgr);
+               ref.reload(  PlanTestsF32::REF_PLAN_CFFT_F32_ID,mgr);
+             
+               this->kind=FFT_PLAN_CFFT;
+               this->n=64;
+               this->m=1;
+               this->scratchSamples=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PlanTestsF32::TEST_PLAN_F32_2:
+             
+               input.reload(PlanTestsF32::INPUTS_PLAN_CIFFT_F32_ID,mgr);
+               ref.reload(  PlanTestsF32::REF_PLAN_CIFFT_F32_ID,mgr);
+             
+               this->kind=FFT_PLAN_CIFFT;
+               this->n=64;
+               this->m=1;
+               this->scratchSamples=0;
+               this->snr=IFFT_SNR_THRESHOLD;
+             
+             break;
+
+             case PlanTestsF32::TEST_PLAN_F32_3:
+             
+               input.reload(PlanTestsF32::INPUTS_PLAN_RFFT_F32_ID,mgr);
+               ref.reload(  PlanTestsF32::REF_PLAN_RFFT_F32_ID,mgr);
+             
+               this->kind=FFT_PLAN_RFFT;
+               this->n=64;
+               this->m=1;
+               this->scratchSamples=64;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PlanTestsF32::TEST_PLAN_F32_4:
+             
+               input.reload(PlanTestsF32::INPUTS_PLAN_RIFFT_F32_ID,mgr);
+               ref.reload(  PlanTestsF32::REF_PLAN_RIFFT_F32_ID,mgr);
+             
+               this->kind=FFT_PLAN_RIFFT;
+               this->n=64;
+               this->m=1;
+               this->scratchSamples=64;
+               this->snr=IFFT_SNR_THRESHOLD;
+             
+             break;
+
+             case PlanTestsF32::TEST_PLAN_F32_5:
+             
+               input.reload(PlanTestsF32::INPUTS_PLAN_CFFT2D_F32_ID,mgr);
+               ref.reload(  PlanTestsF32::REF_PLAN_CFFT2D_F32_ID,mgr);
+             
+               this->kind=FFT_PLAN_CFFT2D;
+               this->n=8;
+               this->m=4;
+               this->scratchSamples=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PlanTestsF32::TEST_PLAN_LENGTH_ERROR_F32_6:
+             
+               input.reload(PlanTestsF32::INPUTS_PLAN_CFFT_F32_ID,mgr);
+               ref.reload(  PlanTestsF32::REF_PLAN_CFFT_F32_ID,mgr);
+             
+               this->kind=FFT_PLAN_CFFT;
+               this->n=64;
+               this->m=1;
+               this->scratchSamples=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),PlanTestsF32::OUTPUT_PLAN_F32_ID,mgr);
+       scratch.create(this->scratchSamples > 0 ? this->scratchSamples : 1,PlanTestsF32::SCRATCH_PLAN_F32_ID,mgr);
+
+    }
+
+    void PlanTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,227 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "PlanTestsQ15.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+#include "FixedPointScaling.h"
+
+/*
+
+One test for each kind of plan : the scratch size is checked,
+a too short arena must be rejected and then the plan is executed.
+In q15, the inverse FFTs lose 2*format bits (like cifft).
+
+*/
+#define SNR_THRESHOLD 40
+#define IFFT_SNR_THRESHOLD 12
+
+    void PlanTestsQ15::test_plan_q15()
+    {
+       const q15_t *inp = input.ptr();
+
+       q15_t *outp = output.ptr();
+       q15_t *scratchp = this->scratchSamples > 0 ? scratch.ptr() : NULL;
+       fftplan<FFTSCI::Q15> plan;
+
+       switch(this->kind)
+       {
+         case FFT_PLAN_CFFT:
+         case FFT_PLAN_CIFFT:
+           status=fft_plan_cfft(&plan,this->n,this->kind == FFT_PLAN_CIFFT);
+         break;
+
+         case FFT_PLAN_RFFT:
+         case FFT_PLAN_RIFFT:
+           status=fft_plan_rfft(&plan,this->n,this->kind == FFT_PLAN_RIFFT);
+         break;
+
+         default:
+           status=fft_plan_cfft2D(&plan,this->n,this->m,this->kind == FFT_PLAN_CIFFT2D);
+         break;
+       }
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+       ASSERT_TRUE(plan.kind == this->kind);
+       ASSERT_TRUE(fft_scratch_size(&plan) == this->scratchSamples);
+
+       if (this->scratchSamples > 0)
+       {
+          status=fft_execute(&plan,(const FFTSCI::Q15*)inp,(FFTSCI::Q15*)outp,(FFTSCI::Q15*)scratchp,this->scratchSamples - 1);
+          ASSERT_TRUE(status==ARM_MATH_ARGUMENT_ERROR);
+       }
+
+       status=fft_execute(&plan,(const FFTSCI::Q15*)inp,(FFTSCI::Q15*)outp,(FFTSCI::Q15*)scratchp,this->scratchSamples);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       q15_t *tmpoutp = tmpout.ptr();
+       int fftscaling,testscaling;
+
+       switch(this->kind)
+       {
+         case FFT_PLAN_RFFT:
+         case FFT_PLAN_RIFFT:
+           fftscaling = cfft_config<FFTSCI::Q15>(this->n >> 1)->format;
+           testscaling = scaling(this->n >> 1);
+         break;
+
+         case FFT_PLAN_CFFT2D:
+         case FFT_PLAN_CIFFT2D:
+           fftscaling = cfft_config<FFTSCI::Q15>(this->n)->format + cfft_config<FFTSCI::Q15>(this->m)->format;
+           testscaling = scaling(this->n) + scaling(this->m);
+         break;
+
+         default:
+           fftscaling = cfft_config<FFTSCI::Q15>(this->n)->format;
+           testscaling = scaling(this->n);
+         break;
+       }
+
+       if ((this->kind == FFT_PLAN_CIFFT) || (this->kind == FFT_PLAN_RIFFT) || (this->kind == FFT_PLAN_CIFFT2D))
+       {
+          testscaling = 2;
+       }
+
+       for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+       {
+          if ((testscaling-fftscaling) > 0)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+          else
+          {
+             tmpoutp[i] = __SSAT(((q31_t)outp[i] << (fftscaling - testscaling)),16);
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q15_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void PlanTestsQ15::test_plan_length_error_q15()
+    {
+       fftplan<FFTSCI::Q15> plan;
+
+       status=fft_plan_cfft(&plan,7,0);
+       ASSERT_TRUE(status==ARM_MATH_LENGTH_ERROR);
+
+       status=fft_plan_cfft2D(&plan,8,7,0);
+       ASSERT_TRUE(status==ARM_MATH_LENGTH_ERROR);
+
+       status=fft_plan_rfft(&plan,14,0);
+       ASSERT_TRUE(status==ARM_MATH_LENGTH_ERROR);
+
+    } 
+
+    void PlanTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case PlanTestsQ15::TEST_PLAN_Q15_1:
+             
+               input.reload(PlanTestsQ15::INPUTS_PLAN_CFFT_Q15_ID,mgr);
+               ref.reload(  PlanTestsQ15::REF_PLAN_CFFT_Q15_ID,mgr);
+             
+               this->kind=FFT_PLAN_CFFT;
+               this->n=64;
+               this->m=1;
+               this->scratchSamples=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PlanTestsQ15::TEST_PLAN_Q15_2:
+             
+               input.reload(PlanTestsQ15::INPUTS_PLAN_CIFFT_Q15_ID,mgr);
+               ref.reload(  PlanTestsQ15::REF_PLAN_CIFFT_Q15_ID,mgr);
+             
+               this->kind=FFT_PLAN_CIFFT;
+               this->n=64;
+               this->m=1;
+               this->scratchSamples=0;
+               this->snr=IFFT_SNR_THRESHOLD;
+             
+             break;
+
+             case PlanTestsQ15::TEST_PLAN_Q15_3:
+             
+               input.reload(PlanTestsQ15::INPUTS_PLAN_RFFT_Q15_ID,mgr);
+               ref.reload(  PlanTestsQ15::REF_PLAN_RFFT_Q15_ID,mgr);
+             
+               this->kind=FFT_PLAN_RFFT;
+               this->n=64;
+               this->m=1;
+               this->scratchSamples=64;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PlanTestsQ15::TEST_PLAN_Q15_4:
+             
+               input.reload(PlanTestsQ15::INPUTS_PLAN_RIFFT_Q15_ID,mgr);
+               ref.reload(  PlanTestsQ15::REF_PLAN_RIFFT_Q15_ID,mgr);
+             
+               this->kind=FFT_PLAN_RIFFT;
+               this->n=64;
+               this->m=1;
+               this->scratchSamples=64;
+               this->snr=IFFT_SNR_THRESHOLD;
+             
+             break;
+
+             case PlanTestsQ15::TEST_PLAN_Q15_5:
+             
+               input.reload(PlanTestsQ15::INPUTS_PLAN_CFFT2D_Q15_ID,mgr);
+               ref.reload(  PlanTestsQ15::REF_PLAN_CFFT2D_Q15_ID,mgr);
+             
+               this->kind=FFT_PLAN_CFFT2D;
+               this->n=8;
+               this->m=4;
+               this->scratchSamples=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PlanTestsQ15::TEST_PLAN_LENGTH_ERROR_Q15_6:
+             
+               input.reload(PlanTestsQ15::INPUTS_PLAN_CFFT_Q15_ID,mgr);
+               ref.reload(  PlanTestsQ15::REF_PLAN_CFFT_Q15_ID,mgr);
+             
+               this->kind=FFT_PLAN_CFFT;
+               this->n=64;
+               this->m=1;
+               this->scratchSamples=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),PlanTestsQ15::OUTPUT_PLAN_Q15_ID,mgr);
+       scratch.create(this->scratchSamples > 0 ? this->scratchSamples : 1,PlanTestsQ15::SCRATCH_PLAN_Q15_ID,mgr);
+       tmpout.create(ref.nbSamples(),PlanTestsQ15::TMPOUT_PLAN_Q15_ID,mgr);
+
+    }
+
+    void PlanTestsQ15::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
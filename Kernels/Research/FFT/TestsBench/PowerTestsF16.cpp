@@ -0,0 +1,173 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "PowerTestsF16.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+#define SNR_THRESHOLD 50
+/* The log is computed in float32 : the small bins are less accurate */
+#define LOG_SNR_THRESHOLD 40
+
+    void PowerTestsF16::test_power_spectrum_f16()
+    {
+       const float16_t *inp = input.ptr();
+       const float16_t *windowp = this->windowed ? window.ptr() : NULL;
+
+       float16_t *outp = output.ptr();
+       float16_t *tmpp = tmp.ptr();
+
+       status=power_spectrum(inp,windowp,tmpp,outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float16_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void PowerTestsF16::test_log_power_spectrum_f16()
+    {
+       const float16_t *inp = input.ptr();
+       const float16_t *windowp = this->windowed ? window.ptr() : NULL;
+
+       float16_t *outp = output.ptr();
+       float16_t *tmpp = tmp.ptr();
+
+       status=log_power_spectrum(inp,windowp,tmpp,outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float16_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+
+    void PowerTestsF16::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case PowerTestsF16::TEST_POWER_SPECTRUM_F16_1:
+             
+               input.reload(PowerTestsF16::INPUTS_POWER_1_F16_ID,mgr);
+               window.reload(PowerTestsF16::WINDOW_POWER_1_F16_ID,mgr);
+               ref.reload(  PowerTestsF16::REF_POWER_RECT_1_F16_ID,mgr);
+             
+               this->nb=256;
+               this->windowed=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsF16::TEST_POWER_SPECTRUM_F16_2:
+             
+               input.reload(PowerTestsF16::INPUTS_POWER_2_F16_ID,mgr);
+               window.reload(PowerTestsF16::WINDOW_POWER_2_F16_ID,mgr);
+               ref.reload(  PowerTestsF16::REF_POWER_RECT_2_F16_ID,mgr);
+             
+               this->nb=120;
+               this->windowed=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsF16::TEST_POWER_SPECTRUM_F16_3:
+             
+               input.reload(PowerTestsF16::INPUTS_POWER_1_F16_ID,mgr);
+               window.reload(PowerTestsF16::WINDOW_POWER_1_F16_ID,mgr);
+               ref.reload(  PowerTestsF16::REF_POWER_HANN_1_F16_ID,mgr);
+             
+               this->nb=256;
+               this->windowed=1;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsF16::TEST_POWER_SPECTRUM_F16_4:
+             
+               input.reload(PowerTestsF16::INPUTS_POWER_2_F16_ID,mgr);
+               window.reload(PowerTestsF16::WINDOW_POWER_2_F16_ID,mgr);
+               ref.reload(  PowerTestsF16::REF_POWER_HANN_2_F16_ID,mgr);
+             
+               this->nb=120;
+               this->windowed=1;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsF16::TEST_LOG_POWER_SPECTRUM_F16_5:
+             
+               input.reload(PowerTestsF16::INPUTS_POWER_1_F16_ID,mgr);
+               window.reload(PowerTestsF16::WINDOW_POWER_1_F16_ID,mgr);
+               ref.reload(  PowerTestsF16::REF_LOG_POWER_RECT_1_F16_ID,mgr);
+             
+               this->nb=256;
+               this->windowed=0;
+               this->snr=LOG_SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsF16::TEST_LOG_POWER_SPECTRUM_F16_6:
+             
+               input.reload(PowerTestsF16::INPUTS_POWER_2_F16_ID,mgr);
+               window.reload(PowerTestsF16::WINDOW_POWER_2_F16_ID,mgr);
+               ref.reload(  PowerTestsF16::REF_LOG_POWER_RECT_2_F16_ID,mgr);
+             
+               this->nb=120;
+               this->windowed=0;
+               this->snr=LOG_SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsF16::TEST_LOG_POWER_SPECTRUM_F16_7:
+             
+               input.reload(PowerTestsF16::INPUTS_POWER_1_F16_ID,mgr);
+               window.reload(PowerTestsF16::WINDOW_POWER_1_F16_ID,mgr);
+               ref.reload(  PowerTestsF16::REF_LOG_POWER_HANN_1_F16_ID,mgr);
+             
+               this->nb=256;
+               this->windowed=1;
+               this->snr=LOG_SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsF16::TEST_LOG_POWER_SPECTRUM_F16_8:
+             
+               input.reload(PowerTestsF16::INPUTS_POWER_2_F16_ID,mgr);
+               window.reload(PowerTestsF16::WINDOW_POWER_2_F16_ID,mgr);
+               ref.reload(  PowerTestsF16::REF_LOG_POWER_HANN_2_F16_ID,mgr);
+             
+               this->nb=120;
+               this->windowed=1;
+               this->snr=LOG_SNR_THRESHOLD;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),PowerTestsF16::OUTPUT_POWER_F16_ID,mgr);
+       tmp.create(this->nb,PowerTestsF16::TMP_POWER_F16_ID,mgr);
+
+    }
+
+    void PowerTestsF16::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,173 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "PowerTestsF32.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+#define SNR_THRESHOLD 120
+/* The log is computed in float32 : the small bins are less accurate */
+#define LOG_SNR_THRESHOLD 110
+
+    void PowerTestsF32::test_power_spectrum_f32()
+    {
+       const float32_t *inp = input.ptr();
+       const float32_t *windowp = this->windowed ? window.ptr() : NULL;
+
+       float32_t *outp = output.ptr();
+       float32_t *tmpp = tmp.ptr();
+
+       status=power_spectrum(inp,windowp,tmpp,outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float32_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void PowerTestsF32::test_log_power_spectrum_f32()
+    {
+       const float32_t *inp = input.ptr();
+       const float32_t *windowp = this->windowed ? window.ptr() : NULL;
+
+       float32_t *outp = output.ptr();
+       float32_t *tmpp = tmp.ptr();
+
+       status=log_power_spectrum(inp,windowp,tmpp,outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float32_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+
+    void PowerTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case PowerTestsF32::TEST_POWER_SPECTRUM_F32_1:
+             
+               input.reload(PowerTestsF32::INPUTS_POWER_1_F32_ID,mgr);
+               window.reload(PowerTestsF32::WINDOW_POWER_1_F32_ID,mgr);
+               ref.reload(  PowerTestsF32::REF_POWER_RECT_1_F32_ID,mgr);
+             
+               this->nb=256;
+               this->windowed=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsF32::TEST_POWER_SPECTRUM_F32_2:
+             
+               input.reload(PowerTestsF32::INPUTS_POWER_2_F32_ID,mgr);
+               window.reload(PowerTestsF32::WINDOW_POWER_2_F32_ID,mgr);
+               ref.reload(  PowerTestsF32::REF_POWER_RECT_2_F32_ID,mgr);
+             
+               this->nb=120;
+               this->windowed=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsF32::TEST_POWER_SPECTRUM_F32_3:
+             
+               input.reload(PowerTestsF32::INPUTS_POWER_1_F32_ID,mgr);
+               window.reload(PowerTestsF32::WINDOW_POWER_1_F32_ID,mgr);
+               ref.reload(  PowerTestsF32::REF_POWER_HANN_1_F32_ID,mgr);
+             
+               this->nb=256;
+               this->windowed=1;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsF32::TEST_POWER_SPECTRUM_F32_4:
+             
+               input.reload(PowerTestsF32::INPUTS_POWER_2_F32_ID,mgr);
+               window.reload(PowerTestsF32::WINDOW_POWER_2_F32_ID,mgr);
+               ref.reload(  PowerTestsF32::REF_POWER_HANN_2_F32_ID,mgr);
+             
+               this->nb=120;
+               this->windowed=1;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsF32::TEST_LOG_POWER_SPECTRUM_F32_5:
+             
+               input.reload(PowerTestsF32::INPUTS_POWER_1_F32_ID,mgr);
+               window.reload(PowerTestsF32::WINDOW_POWER_1_F32_ID,mgr);
+               ref.reload(  PowerTestsF32::REF_LOG_POWER_RECT_1_F32_ID,mgr);
+             
+               this->nb=256;
+               this->windowed=0;
+               this->snr=LOG_SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsF32::TEST_LOG_POWER_SPECTRUM_F32_6:
+             
+               input.reload(PowerTestsF32::INPUTS_POWER_2_F32_ID,mgr);
+               window.reload(PowerTestsF32::WINDOW_POWER_2_F32_ID,mgr);
+               ref.reload(  PowerTestsF32::REF_LOG_POWER_RECT_2_F32_ID,mgr);
+             
+               this->nb=120;
+               this->windowed=0;
+               this->snr=LOG_SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsF32::TEST_LOG_POWER_SPECTRUM_F32_7:
+             
+               input.reload(PowerTestsF32::INPUTS_POWER_1_F32_ID,mgr);
+               window.reload(PowerTestsF32::WINDOW_POWER_1_F32_ID,mgr);
+               ref.reload(  PowerTestsF32::REF_LOG_POWER_HANN_1_F32_ID,mgr);
+             
+               this->nb=256;
+               this->windowed=1;
+               this->snr=LOG_SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsF32::TEST_LOG_POWER_SPECTRUM_F32_8:
+             
+               input.reload(PowerTestsF32::INPUTS_POWER_2_F32_ID,mgr);
+               window.reload(PowerTestsF32::WINDOW_POWER_2_F32_ID,mgr);
+               ref.reload(  PowerTestsF32::REF_LOG_POWER_HANN_2_F32_ID,mgr);
+             
+               this->nb=120;
+               this->windowed=1;
+               this->snr=LOG_SNR_THRESHOLD;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),PowerTestsF32::OUTPUT_POWER_F32_ID,mgr);
+       tmp.create(this->nb,PowerTestsF32::TMP_POWER_F32_ID,mgr);
+
+    }
+
+    void PowerTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
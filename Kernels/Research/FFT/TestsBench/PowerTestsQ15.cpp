@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "PowerTestsQ15.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+#include "FixedPointScaling.h"
+
+/*
+
+The output is |X|^2 / 2 where X has the format of the RFFT :
+the output is shifted by twice the difference between the
+format of the RFFT and the scaling of the reference.
+
+*/
+#define SNR_THRESHOLD 30
+
+    void PowerTestsQ15::test_power_spectrum_q15()
+    {
+       const q15_t *inp = input.ptr();
+       const q15_t *windowp = this->windowed ? window.ptr() : NULL;
+
+       q15_t *outp = output.ptr();
+       q15_t *tmpp = tmp.ptr();
+       q15_t *tmpoutp = tmpout.ptr();
+       int fftscaling,testscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q15>(this->nb >> 1)->format;
+       testscaling = scaling(this->nb >> 1);
+
+       status=power_spectrum((const FFTSCI::Q15*)inp,(const FFTSCI::Q15*)windowp,
+          (FFTSCI::Q15*)tmpp,(FFTSCI::Q15*)outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+       {
+          if ((testscaling-fftscaling) > 0)
+          {
+             tmpoutp[i] = outp[i] >> (2*(testscaling-fftscaling));
+          }
+          else
+          {
+             tmpoutp[i] = __SSAT(((q31_t)outp[i] << (2*(fftscaling - testscaling))),16);
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q15_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void PowerTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case PowerTestsQ15::TEST_POWER_SPECTRUM_Q15_1:
+             
+               input.reload(PowerTestsQ15::INPUTS_POWER_1_Q15_ID,mgr);
+               window.reload(PowerTestsQ15::WINDOW_POWER_1_Q15_ID,mgr);
+               ref.reload(  PowerTestsQ15::REF_POWER_RECT_1_Q15_ID,mgr);
+             
+               this->nb=256;
+               this->windowed=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsQ15::TEST_POWER_SPECTRUM_Q15_2:
+             
+               input.reload(PowerTestsQ15::INPUTS_POWER_2_Q15_ID,mgr);
+               window.reload(PowerTestsQ15::WINDOW_POWER_2_Q15_ID,mgr);
+               ref.reload(  PowerTestsQ15::REF_POWER_RECT_2_Q15_ID,mgr);
+             
+               this->nb=64;
+               this->windowed=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsQ15::TEST_POWER_SPECTRUM_Q15_3:
+             
+               input.reload(PowerTestsQ15::INPUTS_POWER_1_Q15_ID,mgr);
+               window.reload(PowerTestsQ15::WINDOW_POWER_1_Q15_ID,mgr);
+               ref.reload(  PowerTestsQ15::REF_POWER_HANN_1_Q15_ID,mgr);
+             
+               this->nb=256;
+               this->windowed=1;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsQ15::TEST_POWER_SPECTRUM_Q15_4:
+             
+               input.reload(PowerTestsQ15::INPUTS_POWER_2_Q15_ID,mgr);
+               window.reload(PowerTestsQ15::WINDOW_POWER_2_Q15_ID,mgr);
+               ref.reload(  PowerTestsQ15::REF_POWER_HANN_2_Q15_ID,mgr);
+             
+               this->nb=64;
+               this->windowed=1;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),PowerTestsQ15::OUTPUT_POWER_Q15_ID,mgr);
+       tmp.create(this->nb,PowerTestsQ15::TMP_POWER_Q15_ID,mgr);
+       tmpout.create(ref.nbSamples(),PowerTestsQ15::TMPOUT_POWER_Q15_ID,mgr);
+
+    }
+
+    void PowerTestsQ15::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
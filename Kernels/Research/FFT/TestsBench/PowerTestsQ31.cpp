@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "PowerTestsQ31.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+#include "FixedPointScaling.h"
+
+/*
+
+The output is |X|^2 / 2 where X has the format of the RFFT :
+the output is shifted by twice the difference between the
+format of the RFFT and the scaling of the reference.
+
+*/
+#define SNR_THRESHOLD 95
+
+    void PowerTestsQ31::test_power_spectrum_q31()
+    {
+       const q31_t *inp = input.ptr();
+       const q31_t *windowp = this->windowed ? window.ptr() : NULL;
+
+       q31_t *outp = output.ptr();
+       q31_t *tmpp = tmp.ptr();
+       q31_t *tmpoutp = tmpout.ptr();
+       int fftscaling,testscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q31>(this->nb >> 1)->format;
+       testscaling = scaling(this->nb >> 1);
+
+       status=power_spectrum((const FFTSCI::Q31*)inp,(const FFTSCI::Q31*)windowp,
+          (FFTSCI::Q31*)tmpp,(FFTSCI::Q31*)outp,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+       {
+          if ((testscaling-fftscaling) > 0)
+          {
+             tmpoutp[i] = outp[i] >> (2*(testscaling-fftscaling));
+          }
+          else
+          {
+             tmpoutp[i] = ((q63_t)outp[i] << (2*(fftscaling - testscaling)));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q31_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void PowerTestsQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case PowerTestsQ31::TEST_POWER_SPECTRUM_Q31_1:
+             
+               input.reload(PowerTestsQ31::INPUTS_POWER_1_Q31_ID,mgr);
+               window.reload(PowerTestsQ31::WINDOW_POWER_1_Q31_ID,mgr);
+               ref.reload(  PowerTestsQ31::REF_POWER_RECT_1_Q31_ID,mgr);
+             
+               this->nb=256;
+               this->windowed=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsQ31::TEST_POWER_SPECTRUM_Q31_2:
+             
+               input.reload(PowerTestsQ31::INPUTS_POWER_2_Q31_ID,mgr);
+               window.reload(PowerTestsQ31::WINDOW_POWER_2_Q31_ID,mgr);
+               ref.reload(  PowerTestsQ31::REF_POWER_RECT_2_Q31_ID,mgr);
+             
+               this->nb=120;
+               this->windowed=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsQ31::TEST_POWER_SPECTRUM_Q31_3:
+             
+               input.reload(PowerTestsQ31::INPUTS_POWER_1_Q31_ID,mgr);
+               window.reload(PowerTestsQ31::WINDOW_POWER_1_Q31_ID,mgr);
+               ref.reload(  PowerTestsQ31::REF_POWER_HANN_1_Q31_ID,mgr);
+             
+               this->nb=256;
+               this->windowed=1;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case PowerTestsQ31::TEST_POWER_SPECTRUM_Q31_4:
+             
+               input.reload(PowerTestsQ31::INPUTS_POWER_2_Q31_ID,mgr);
+               window.reload(PowerTestsQ31::WINDOW_POWER_2_Q31_ID,mgr);
+               ref.reload(  PowerTestsQ31::REF_POWER_HANN_2_Q31_ID,mgr);
+             
+               this->nb=120;
+               this->windowed=1;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),PowerTestsQ31::OUTPUT_POWER_Q31_ID,mgr);
+       tmp.create(this->nb,PowerTestsQ31::TMP_POWER_Q31_ID,mgr);
+       tmpout.create(ref.nbSamples(),PowerTestsQ31::TMPOUT_POWER_Q31_ID,mgr);
+
+    }
+
+    void PowerTestsQ31::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "PrunedTestsF16.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+#define SNR_THRESHOLD 56
+
+/*
+
+The bins must be the same as in FFT.py
+
+*/
+static const uint16_t few_bins[2]={32,100};
+static const uint16_t cfft_bins[8]={0,5,17,32,128,200,224,31};
+static const uint16_t rfft_bins[4]={0,7,32,128};
+
+    void PrunedTestsF16::test_pruned_f16()
+    {
+       const float16_t *inp = input.ptr();
+       arm_status status;
+
+       float16_t *outp = output.ptr();
+       float16_t *tmpp = tmp.ptr();
+
+       if (this->real)
+       {
+         if (this->bins)
+         {
+           status=rfft_pruned(inp,tmpp,outp,this->nb,this->bins,this->nbBins);
+         }
+         else
+         {
+           status=rfft_pruned_range(inp,tmpp,outp,this->nb,this->firstBin,this->nbBins);
+         }
+       }
+       else
+       {
+         if (this->bins)
+         {
+           status=cfft_pruned(inp,tmpp,outp,this->nb,this->bins,this->nbBins);
+         }
+         else
+         {
+           status=cfft_pruned_range(inp,tmpp,outp,this->nb,this->firstBin,this->nbBins);
+         }
+       }
+
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+       ASSERT_SNR(output,ref,(float16_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void PrunedTestsF16::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       this->snr = SNR_THRESHOLD;
+
+       switch(id)
+       {
+             case PrunedTestsF16::TEST_PRUNED_F16_1:
+             
+               input.reload(PrunedTestsF16::INPUTS_CFFT_PRUNED_1_F16_ID,mgr);
+               ref.reload(  PrunedTestsF16::REF_CFFT_PRUNED_1_F16_ID,mgr);
+             
+               this->real=0;
+               this->nb=256;
+               this->bins=few_bins;
+               this->firstBin=0;
+               this->nbBins=2;
+             
+             break;
+
+             case PrunedTestsF16::TEST_PRUNED_F16_2:
+             
+               input.reload(PrunedTestsF16::INPUTS_CFFT_PRUNED_2_F16_ID,mgr);
+               ref.reload(  PrunedTestsF16::REF_CFFT_PRUNED_2_F16_ID,mgr);
+             
+               this->real=0;
+               this->nb=256;
+               this->bins=cfft_bins;
+               this->firstBin=0;
+               this->nbBins=8;
+             
+             break;
+
+             case PrunedTestsF16::TEST_PRUNED_F16_3:
+             
+               input.reload(PrunedTestsF16::INPUTS_CFFT_PRUNED_3_F16_ID,mgr);
+               ref.reload(  PrunedTestsF16::REF_CFFT_PRUNED_3_F16_ID,mgr);
+             
+               this->real=0;
+               this->nb=120;
+               this->bins=NULL;
+               this->firstBin=10;
+               this->nbBins=6;
+             
+             break;
+
+             case PrunedTestsF16::TEST_PRUNED_F16_4:
+             
+               input.reload(PrunedTestsF16::INPUTS_RFFT_PRUNED_4_F16_ID,mgr);
+               ref.reload(  PrunedTestsF16::REF_RFFT_PRUNED_4_F16_ID,mgr);
+             
+               this->real=1;
+               this->nb=256;
+               this->bins=rfft_bins;
+               this->firstBin=0;
+               this->nbBins=4;
+             
+             break;
+
+             case PrunedTestsF16::TEST_PRUNED_F16_5:
+             
+               input.reload(PrunedTestsF16::INPUTS_RFFT_PRUNED_5_F16_ID,mgr);
+               ref.reload(  PrunedTestsF16::REF_RFFT_PRUNED_5_F16_ID,mgr);
+             
+               this->real=1;
+               this->nb=120;
+               this->bins=NULL;
+               this->firstBin=12;
+               this->nbBins=8;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),PrunedTestsF16::OUTPUT_PRUNED_F16_ID,mgr);
+       tmp.create(2*this->nb,PrunedTestsF16::TMP_PRUNED_F16_ID,mgr);
+
+    }
+
+    void PrunedTestsF16::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,195 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "PrunedTestsQ15.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+#include "FixedPointScaling.h"
+
+#define SNR_THRESHOLD 26
+#define RFFT_SNR_THRESHOLD 33
+
+/*
+
+The bins must be the same as in FFT.py
+
+*/
+static const uint16_t few_bins[2]={32,100};
+static const uint16_t cfft_bins[8]={0,5,17,32,128,200,224,31};
+static const uint16_t rfft_bins[4]={0,7,32,128};
+
+    void PrunedTestsQ15::test_pruned_q15()
+    {
+       const q15_t *inp = input.ptr();
+       arm_status status;
+
+       q15_t *outp = output.ptr();
+       q15_t *tmpp = tmp.ptr();
+       q15_t *tmpoutp = tmpout.ptr();
+       int fftscaling ,testscaling;
+       const cfftconfig<FFTSCI::Q15> *config;
+
+       if (this->real)
+       {
+          testscaling = scaling(this->nb>>1);
+          config = cfft_config<FFTSCI::Q15>(this->nb>>1);
+       }
+       else
+       {
+          testscaling = scaling(this->nb);
+          config = cfft_config<FFTSCI::Q15>(this->nb);
+       }
+
+       fftscaling = config->format;
+
+       if (this->real)
+       {
+         if (this->bins)
+         {
+           status=rfft_pruned((const FFTSCI::Q15*)inp,(FFTSCI::Q15*)tmpp,(FFTSCI::Q15*)outp,this->nb,this->bins,this->nbBins);
+         }
+         else
+         {
+           status=rfft_pruned_range((const FFTSCI::Q15*)inp,(FFTSCI::Q15*)tmpp,(FFTSCI::Q15*)outp,this->nb,this->firstBin,this->nbBins);
+         }
+       }
+       else
+       {
+         if (this->bins)
+         {
+           status=cfft_pruned((const FFTSCI::Q15*)inp,(FFTSCI::Q15*)tmpp,(FFTSCI::Q15*)outp,this->nb,this->bins,this->nbBins);
+         }
+         else
+         {
+           status=cfft_pruned_range((const FFTSCI::Q15*)inp,(FFTSCI::Q15*)tmpp,(FFTSCI::Q15*)outp,this->nb,this->firstBin,this->nbBins);
+         }
+       }
+
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       if ((testscaling-fftscaling) > 0)
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+       }
+       else
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = ((q63_t)outp[i] << (fftscaling - testscaling));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q15_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void PrunedTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       this->snr = SNR_THRESHOLD;
+
+       switch(id)
+       {
+             case PrunedTestsQ15::TEST_PRUNED_Q15_1:
+             
+               input.reload(PrunedTestsQ15::INPUTS_CFFT_PRUNED_1_Q15_ID,mgr);
+               ref.reload(  PrunedTestsQ15::REF_CFFT_PRUNED_1_Q15_ID,mgr);
+             
+               this->real=0;
+               this->nb=256;
+               this->bins=few_bins;
+               this->firstBin=0;
+               this->nbBins=2;
+             
+             break;
+
+             case PrunedTestsQ15::TEST_PRUNED_Q15_2:
+             
+               input.reload(PrunedTestsQ15::INPUTS_CFFT_PRUNED_2_Q15_ID,mgr);
+               ref.reload(  PrunedTestsQ15::REF_CFFT_PRUNED_2_Q15_ID,mgr);
+             
+               this->real=0;
+               this->nb=256;
+               this->bins=cfft_bins;
+               this->firstBin=0;
+               this->nbBins=8;
+             
+             break;
+
+             case PrunedTestsQ15::TEST_PRUNED_Q15_3:
+             
+               input.reload(PrunedTestsQ15::INPUTS_CFFT_PRUNED_3_Q15_ID,mgr);
+               ref.reload(  PrunedTestsQ15::REF_CFFT_PRUNED_3_Q15_ID,mgr);
+             
+               this->real=0;
+               this->nb=120;
+               this->bins=NULL;
+               this->firstBin=10;
+               this->nbBins=6;
+             
+             break;
+
+             case PrunedTestsQ15::TEST_PRUNED_Q15_4:
+             
+               input.reload(PrunedTestsQ15::INPUTS_RFFT_PRUNED_4_Q15_ID,mgr);
+               ref.reload(  PrunedTestsQ15::REF_RFFT_PRUNED_4_Q15_ID,mgr);
+             
+               this->real=1;
+               this->nb=256;
+               this->bins=rfft_bins;
+               this->firstBin=0;
+               this->nbBins=4;
+
+               this->snr = RFFT_SNR_THRESHOLD;
+             
+             break;
+
+             case PrunedTestsQ15::TEST_PRUNED_Q15_5:
+             
+               input.reload(PrunedTestsQ15::INPUTS_RFFT_PRUNED_5_Q15_ID,mgr);
+               ref.reload(  PrunedTestsQ15::REF_RFFT_PRUNED_5_Q15_ID,mgr);
+             
+               this->real=1;
+               this->nb=120;
+               this->bins=NULL;
+               this->firstBin=12;
+               this->nbBins=8;
+
+               this->snr = RFFT_SNR_THRESHOLD;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),PrunedTestsQ15::OUTPUT_PRUNED_Q15_ID,mgr);
+       tmp.create(2*this->nb,PrunedTestsQ15::TMP_PRUNED_Q15_ID,mgr);
+       tmpout.create(ref.nbSamples(),PrunedTestsQ15::TMPOUT_PRUNED_Q15_ID,mgr);
+
+    }
+
+    void PrunedTestsQ15::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "RFFTPairTestsF32.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+/*
+
+The output is the RFFT of the first signal followed by
+the RFFT of the second signal (N/2+1 complex samples each).
+
+*/
+#define SNR_THRESHOLD 120
+
+    void RFFTPairTestsF32::test_rfft_pair_f32()
+    {
+       const float32_t *inp1 = input1.ptr();
+       const float32_t *inp2 = input2.ptr();
+
+       float32_t *outp = output.ptr();
+       float32_t *tmpp = tmp.ptr();
+
+       status=rfft_pair(inp1,inp2,tmpp,outp,outp + this->nb + 2,this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    /* 
+
+    15 is a length of the CFFT but the Nyquist bin
+    of the pair separation is only defined for even lengths.
+
+    */
+    void RFFTPairTestsF32::test_rfft_pair_odd_f32()
+    {
+       const float32_t *inp1 = input1.ptr();
+       const float32_t *inp2 = input2.ptr();
+
+       float32_t *outp = output.ptr();
+       float32_t *tmpp = tmp.ptr();
+
+       status=rfft_pair(inp1,inp2,tmpp,outp,(outp + 16),15);
+       ASSERT_TRUE(status==ARM_MATH_LENGTH_ERROR);
+
+    } 
+
+    void RFFTPairTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case RFFTPairTestsF32::TEST_RFFT_PAIR_F32_1:
+             
+               input1.reload(RFFTPairTestsF32::INPUTS1_PAIR_1_F32_ID,mgr);
+               input2.reload(RFFTPairTestsF32::INPUTS2_PAIR_1_F32_ID,mgr);
+               ref.reload(  RFFTPairTestsF32::REF_PAIR_1_F32_ID,mgr);
+             
+               this->nb=64;
+             
+             break;
+
+             case RFFTPairTestsF32::TEST_RFFT_PAIR_F32_2:
+             
+               input1.reload(RFFTPairTestsF32::INPUTS1_PAIR_2_F32_ID,mgr);
+               input2.reload(RFFTPairTestsF32::INPUTS2_PAIR_2_F32_ID,mgr);
+               ref.reload(  RFFTPairTestsF32::REF_PAIR_2_F32_ID,mgr);
+             
+               this->nb=60;
+             
+             break;
+
+             case RFFTPairTestsF32::TEST_RFFT_PAIR_ODD_F32_3:
+             
+               input1.reload(RFFTPairTestsF32::INPUTS1_PAIR_1_F32_ID,mgr);
+               input2.reload(RFFTPairTestsF32::INPUTS2_PAIR_1_F32_ID,mgr);
+               ref.reload(  RFFTPairTestsF32::REF_PAIR_1_F32_ID,mgr);
+             
+               this->nb=15;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),RFFTPairTestsF32::OUTPUT_PAIR_F32_ID,mgr);
+       tmp.create(2*this->nb,RFFTPairTestsF32::TMP_PAIR_F32_ID,mgr);
+
+    }
+
+    void RFFTPairTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "RFFTPairTestsQ15.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+#include "FixedPointScaling.h"
+
+/*
+
+The output is the RFFT of the first signal followed by
+the RFFT of the second signal (N/2+1 complex samples each).
+The output has the format of the CFFT of length N.
+
+*/
+#define SNR_THRESHOLD 35
+
+    void RFFTPairTestsQ15::test_rfft_pair_q15()
+    {
+       const q15_t *inp1 = input1.ptr();
+       const q15_t *inp2 = input2.ptr();
+
+       q15_t *outp = output.ptr();
+       q15_t *tmpp = tmp.ptr();
+       q15_t *tmpoutp = tmpout.ptr();
+       int fftscaling,testscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q15>(this->nb)->format;
+       testscaling = scaling(this->nb);
+
+       status=rfft_pair((const FFTSCI::Q15*)inp1,(const FFTSCI::Q15*)inp2,
+          (FFTSCI::Q15*)tmpp,
+          (FFTSCI::Q15*)outp,(FFTSCI::Q15*)(outp + this->nb + 2),this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+       {
+          if ((testscaling-fftscaling) > 0)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+          else
+          {
+             tmpoutp[i] = ((q63_t)outp[i] << (fftscaling - testscaling));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q15_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    /* 
+
+    15 is a length of the CFFT but the Nyquist bin
+    of the pair separation is only defined for even lengths.
+
+    */
+    void RFFTPairTestsQ15::test_rfft_pair_odd_q15()
+    {
+       const q15_t *inp1 = input1.ptr();
+       const q15_t *inp2 = input2.ptr();
+
+       q15_t *outp = output.ptr();
+       q15_t *tmpp = tmp.ptr();
+
+       status=rfft_pair((const FFTSCI::Q15*)inp1,(const FFTSCI::Q15*)inp2,(FFTSCI::Q15*)tmpp,(FFTSCI::Q15*)outp,(FFTSCI::Q15*)(outp + 16),15);
+       ASSERT_TRUE(status==ARM_MATH_LENGTH_ERROR);
+
+    } 
+
+    void RFFTPairTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case RFFTPairTestsQ15::TEST_RFFT_PAIR_Q15_1:
+             
+               input1.reload(RFFTPairTestsQ15::INPUTS1_PAIR_1_Q15_ID,mgr);
+               input2.reload(RFFTPairTestsQ15::INPUTS2_PAIR_1_Q15_ID,mgr);
+               ref.reload(  RFFTPairTestsQ15::REF_PAIR_1_Q15_ID,mgr);
+             
+               this->nb=64;
+             
+             break;
+
+             case RFFTPairTestsQ15::TEST_RFFT_PAIR_Q15_2:
+             
+               input1.reload(RFFTPairTestsQ15::INPUTS1_PAIR_2_Q15_ID,mgr);
+               input2.reload(RFFTPairTestsQ15::INPUTS2_PAIR_2_Q15_ID,mgr);
+               ref.reload(  RFFTPairTestsQ15::REF_PAIR_2_Q15_ID,mgr);
+             
+               this->nb=60;
+             
+             break;
+
+             case RFFTPairTestsQ15::TEST_RFFT_PAIR_ODD_Q15_3:
+             
+               input1.reload(RFFTPairTestsQ15::INPUTS1_PAIR_1_Q15_ID,mgr);
+               input2.reload(RFFTPairTestsQ15::INPUTS2_PAIR_1_Q15_ID,mgr);
+               ref.reload(  RFFTPairTestsQ15::REF_PAIR_1_Q15_ID,mgr);
+             
+               this->nb=15;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),RFFTPairTestsQ15::OUTPUT_PAIR_Q15_ID,mgr);
+       tmp.create(2*this->nb,RFFTPairTestsQ15::TMP_PAIR_Q15_ID,mgr);
+       tmpout.create(ref.nbSamples(),RFFTPairTestsQ15::TMPOUT_PAIR_Q15_ID,mgr);
+
+    }
+
+    void RFFTPairTestsQ15::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "RFFTPairTestsQ31.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+#include "FixedPointScaling.h"
+
+/*
+
+The output is the RFFT of the first signal followed by
+the RFFT of the second signal (N/2+1 complex samples each).
+The output has the format of the CFFT of length N.
+
+*/
+#define SNR_THRESHOLD 89
+
+    void RFFTPairTestsQ31::test_rfft_pair_q31()
+    {
+       const q31_t *inp1 = input1.ptr();
+       const q31_t *inp2 = input2.ptr();
+
+       q31_t *outp = output.ptr();
+       q31_t *tmpp = tmp.ptr();
+       q31_t *tmpoutp = tmpout.ptr();
+       int fftscaling,testscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q31>(this->nb)->format;
+       testscaling = scaling(this->nb);
+
+       status=rfft_pair((const FFTSCI::Q31*)inp1,(const FFTSCI::Q31*)inp2,
+          (FFTSCI::Q31*)tmpp,
+          (FFTSCI::Q31*)outp,(FFTSCI::Q31*)(outp + this->nb + 2),this->nb);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+       {
+          if ((testscaling-fftscaling) > 0)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+          else
+          {
+             tmpoutp[i] = ((q63_t)outp[i] << (fftscaling - testscaling));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q31_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    /* 
+
+    15 is a length of the CFFT but the Nyquist bin
+    of the pair separation is only defined for even lengths.
+
+    */
+    void RFFTPairTestsQ31::test_rfft_pair_odd_q31()
+    {
+       const q31_t *inp1 = input1.ptr();
+       const q31_t *inp2 = input2.ptr();
+
+       q31_t *outp = output.ptr();
+       q31_t *tmpp = tmp.ptr();
+
+       status=rfft_pair((const FFTSCI::Q31*)inp1,(const FFTSCI::Q31*)inp2,(FFTSCI::Q31*)tmpp,(FFTSCI::Q31*)outp,(FFTSCI::Q31*)(outp + 16),15);
+       ASSERT_TRUE(status==ARM_MATH_LENGTH_ERROR);
+
+    } 
+
+    void RFFTPairTestsQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case RFFTPairTestsQ31::TEST_RFFT_PAIR_Q31_1:
+             
+               input1.reload(RFFTPairTestsQ31::INPUTS1_PAIR_1_Q31_ID,mgr);
+               input2.reload(RFFTPairTestsQ31::INPUTS2_PAIR_1_Q31_ID,mgr);
+               ref.reload(  RFFTPairTestsQ31::REF_PAIR_1_Q31_ID,mgr);
+             
+               this->nb=64;
+             
+             break;
+
+             case RFFTPairTestsQ31::TEST_RFFT_PAIR_Q31_2:
+             
+               input1.reload(RFFTPairTestsQ31::INPUTS1_PAIR_2_Q31_ID,mgr);
+               input2.reload(RFFTPairTestsQ31::INPUTS2_PAIR_2_Q31_ID,mgr);
+               ref.reload(  RFFTPairTestsQ31::REF_PAIR_2_Q31_ID,mgr);
+             
+               this->nb=60;
+             
+             break;
+
+             case RFFTPairTestsQ31::TEST_RFFT_PAIR_ODD_Q31_3:
+             
+               input1.reload(RFFTPairTestsQ31::INPUTS1_PAIR_1_Q31_ID,mgr);
+               input2.reload(RFFTPairTestsQ31::INPUTS2_PAIR_1_Q31_ID,mgr);
+               ref.reload(  RFFTPairTestsQ31::REF_PAIR_1_Q31_ID,mgr);
+             
+               this->nb=15;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),RFFTPairTestsQ31::OUTPUT_PAIR_Q31_ID,mgr);
+       tmp.create(2*this->nb,RFFTPairTestsQ31::TMP_PAIR_Q31_ID,mgr);
+       tmpout.create(ref.nbSamples(),RFFTPairTestsQ31::TMPOUT_PAIR_Q31_ID,mgr);
+
+    }
+
+    void RFFTPairTestsQ31::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "ResamplerTestsF16.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+#define SNR_THRESHOLD 56
+
+    void ResamplerTestsF16::test_resampler_f16()
+    {
+       const float16_t *inp = input.ptr();
+       resamplerstate<float16_t> S;
+       uint32_t nbOut;
+
+       float16_t *outp = output.ptr();
+
+       // The input is given in two updates which are not
+       // ending on a frame
+       const uint32_t nbSamples = input.nbSamples();
+       const uint32_t first = nbSamples / 3;
+
+       status=resampler_init(&S,this->nIn,this->nOut,this->overlap,this->transition,
+         this->gain,this->frame,this->spectrum,this->tmp);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       nbOut = resampler(&S,inp,first,outp);
+       nbOut += resampler(&S,inp + first,nbSamples - first,outp + nbOut);
+       ASSERT_TRUE(nbOut == ref.nbSamples());
+
+       ASSERT_SNR(output,ref,(float16_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void ResamplerTestsF16::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case ResamplerTestsF16::TEST_RESAMPLER_F16_1:
+             
+               input.reload(ResamplerTestsF16::INPUTS_RESAMPLER_1_F16_ID,mgr);
+               ref.reload(  ResamplerTestsF16::REF_RESAMPLER_1_F16_ID,mgr);
+             
+               this->nIn=128;
+               this->nOut=384;
+               this->overlap=64;
+               this->transition=8;
+             
+             break;
+
+             case ResamplerTestsF16::TEST_RESAMPLER_F16_2:
+             
+               input.reload(ResamplerTestsF16::INPUTS_RESAMPLER_2_F16_ID,mgr);
+               ref.reload(  ResamplerTestsF16::REF_RESAMPLER_2_F16_ID,mgr);
+             
+               this->nIn=160;
+               this->nOut=96;
+               this->overlap=60;
+               this->transition=6;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),ResamplerTestsF16::OUTPUT_RESAMPLER_F16_ID,mgr);
+
+    }
+
+    void ResamplerTestsF16::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
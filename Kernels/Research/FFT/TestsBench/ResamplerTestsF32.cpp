@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "ResamplerTestsF32.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+#define SNR_THRESHOLD 120
+
+    void ResamplerTestsF32::test_resampler_f32()
+    {
+       const float32_t *inp = input.ptr();
+       resamplerstate<float32_t> S;
+       uint32_t nbOut;
+
+       float32_t *outp = output.ptr();
+
+       // The input is given in two updates which are not
+       // ending on a frame
+       const uint32_t nbSamples = input.nbSamples();
+       const uint32_t first = nbSamples / 3;
+
+       status=resampler_init(&S,this->nIn,this->nOut,this->overlap,this->transition,
+         this->gain,this->frame,this->spectrum,this->tmp);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       nbOut = resampler(&S,inp,first,outp);
+       nbOut += resampler(&S,inp + first,nbSamples - first,outp + nbOut);
+       ASSERT_TRUE(nbOut == ref.nbSamples());
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void ResamplerTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case ResamplerTestsF32::TEST_RESAMPLER_F32_1:
+             
+               input.reload(ResamplerTestsF32::INPUTS_RESAMPLER_1_F32_ID,mgr);
+               ref.reload(  ResamplerTestsF32::REF_RESAMPLER_1_F32_ID,mgr);
+             
+               this->nIn=128;
+               this->nOut=384;
+               this->overlap=64;
+               this->transition=8;
+             
+             break;
+
+             case ResamplerTestsF32::TEST_RESAMPLER_F32_2:
+             
+               input.reload(ResamplerTestsF32::INPUTS_RESAMPLER_2_F32_ID,mgr);
+               ref.reload(  ResamplerTestsF32::REF_RESAMPLER_2_F32_ID,mgr);
+             
+               this->nIn=160;
+               this->nOut=96;
+               this->overlap=60;
+               this->transition=6;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),ResamplerTestsF32::OUTPUT_RESAMPLER_F32_ID,mgr);
+
+    }
+
+    void ResamplerTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "SDFTTestsF32.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+#define SNR_THRESHOLD 120
+
+/*
+
+The bins must be the same as in FFT.py
+
+*/
+static const uint16_t bins_64[5]={0,5,8,31,32};
+static const uint16_t bins_60[5]={1,7,8,20,30};
+
+    void SDFTTestsF32::test_sdft_f32()
+    {
+       const float32_t *inp = input.ptr();
+       arm_status status;
+
+       float32_t *outp = output.ptr();
+       sdftstate<float32_t> S;
+
+       // The input is given in two updates
+       const uint32_t first = input.nbSamples() / 3;
+
+       status=sdft_init(&S,this->nb,this->bins,this->nbBins,this->phase,this->acc,this->delay);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       sdft_update(&S,inp,first);
+       sdft_update(&S,inp+first,input.nbSamples()-first);
+       sdft_bins(&S,outp);
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void SDFTTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case SDFTTestsF32::TEST_SDFT_F32_1:
+             
+               input.reload(SDFTTestsF32::INPUTS_SDFT_1_F32_ID,mgr);
+               ref.reload(  SDFTTestsF32::REF_SDFT_1_F32_ID,mgr);
+             
+               this->nb=64;
+               this->bins=bins_64;
+               this->nbBins=5;
+             
+             break;
+
+             case SDFTTestsF32::TEST_SDFT_F32_2:
+             
+               input.reload(SDFTTestsF32::INPUTS_SDFT_2_F32_ID,mgr);
+               ref.reload(  SDFTTestsF32::REF_SDFT_2_F32_ID,mgr);
+             
+               this->nb=60;
+               this->bins=bins_60;
+               this->nbBins=5;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),SDFTTestsF32::OUTPUT_SDFT_F32_ID,mgr);
+
+    }
+
+    void SDFTTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
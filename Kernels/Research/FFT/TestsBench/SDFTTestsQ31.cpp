@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "SDFTTestsQ31.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+#include "FixedPointScaling.h"
+
+#define SNR_THRESHOLD 89
+
+/*
+
+The bins must be the same as in FFT.py
+
+*/
+static const uint16_t bins_64[5]={0,5,8,31,32};
+static const uint16_t bins_60[5]={1,7,8,20,30};
+
+    void SDFTTestsQ31::test_sdft_q31()
+    {
+       const q31_t *inp = input.ptr();
+       arm_status status;
+
+       q31_t *outp = output.ptr();
+       q31_t *tmpoutp = tmpout.ptr();
+       int fftscaling ,testscaling;
+       sdftstate<FFTSCI::Q31> S;
+
+       // The input is given in two updates
+       const uint32_t first = input.nbSamples() / 3;
+
+       status=sdft_init(&S,this->nb,this->bins,this->nbBins,this->phase,(FFTSCI::Q63*)this->acc,(FFTSCI::Q31*)this->delay);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       sdft_update(&S,(const FFTSCI::Q31*)inp,first);
+       sdft_update(&S,(const FFTSCI::Q31*)inp+first,input.nbSamples()-first);
+       sdft_bins(&S,(FFTSCI::Q31*)outp);
+
+       // The bins are the DFT divided by 2^S.shift
+       fftscaling = S.shift;
+       testscaling = scaling(this->nb);
+
+       if ((testscaling-fftscaling) > 0)
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+       }
+       else
+       {
+          for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+          {
+             tmpoutp[i] = ((q63_t)outp[i] << (fftscaling - testscaling));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q31_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void SDFTTestsQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case SDFTTestsQ31::TEST_SDFT_Q31_1:
+             
+               input.reload(SDFTTestsQ31::INPUTS_SDFT_1_Q31_ID,mgr);
+               ref.reload(  SDFTTestsQ31::REF_SDFT_1_Q31_ID,mgr);
+             
+               this->nb=64;
+               this->bins=bins_64;
+               this->nbBins=5;
+             
+             break;
+
+             case SDFTTestsQ31::TEST_SDFT_Q31_2:
+             
+               input.reload(SDFTTestsQ31::INPUTS_SDFT_2_Q31_ID,mgr);
+               ref.reload(  SDFTTestsQ31::REF_SDFT_2_Q31_ID,mgr);
+             
+               this->nb=60;
+               this->bins=bins_60;
+               this->nbBins=5;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),SDFTTestsQ31::OUTPUT_SDFT_Q31_ID,mgr);
+       tmpout.create(ref.nbSamples(),SDFTTestsQ31::TMPOUT_SDFT_Q31_ID,mgr);
+
+    }
+
+    void SDFTTestsQ31::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "SchedulerTestsF32.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+#define SNR_THRESHOLD 120
+
+/*
+
+The jobs of the different plans are interleaved and
+their inputs and outputs are concatenated.
+
+*/
+static uint32_t inputLength(const fftplan<float32_t> *plan)
+{
+    switch(plan->kind)
+    {
+      case FFT_PLAN_RFFT:
+        return(plan->n);
+      case FFT_PLAN_RIFFT:
+        return(plan->n + 2);
+      default:
+        return(2*plan->n);
+    }
+}
+
+static uint32_t outputLength(const fftplan<float32_t> *plan)
+{
+    switch(plan->kind)
+    {
+      case FFT_PLAN_RFFT:
+        return(plan->n + 2);
+      case FFT_PLAN_RIFFT:
+        return(plan->n);
+      default:
+        return(2*plan->n);
+    }
+}
+
+static void jobDone(fftjob *job,void *context)
+{
+    (void)job;
+    *(uint32_t *)context = 1;
+}
+
+    void SchedulerTestsF32::test_scheduler_f32()
+    {
+       const float32_t *inp = input.ptr();
+       float32_t *outp = output.ptr();
+       fftscheduler S;
+
+       status=fft_scheduler_init(&S,0,scratch.ptr(),this->scratchSamples*sizeof(float32_t));
+       ASSERT_TRUE(status==ARM_MATH_ARGUMENT_ERROR);
+
+       status=fft_scheduler_init(&S,this->nbWorkers,scratch.ptr(),this->scratchSamples*sizeof(float32_t));
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       for(int r = 0; r < NB_REPEATS; r++)
+       {
+          for(int p = 0; p < NB_PLANS; p++)
+          {
+             const int k = r*NB_PLANS + p;
+
+             this->called[k] = 0;
+             fft_job_init(&this->jobs[k],&this->plans[p],inp,outp,jobDone,&this->called[k]);
+             fft_scheduler_submit(&S,&this->jobs[k]);
+
+             inp += inputLength(&this->plans[p]);
+             outp += outputLength(&this->plans[p]);
+          }
+       }
+
+       for(int k = 0; k < NB_JOBS; k++)
+       {
+          fft_job_wait(&S,&this->jobs[k]);
+       }
+       fft_scheduler_stop(&S);
+
+       for(int k = 0; k < NB_JOBS; k++)
+       {
+          ASSERT_TRUE(fft_job_done(&this->jobs[k]));
+          ASSERT_TRUE(this->jobs[k].status==ARM_MATH_SUCCESS);
+          ASSERT_TRUE(this->called[k]==1);
+       }
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void SchedulerTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case SchedulerTestsF32::TEST_SCHEDULER_F32_1:
+               this->nbWorkers=1;
+             break;
+
+             case SchedulerTestsF32::TEST_SCHEDULER_F32_2:
+               this->nbWorkers=4;
+             break;
+       }
+
+       // Must be the same plans as in the patterns
+       fft_plan_cfft(&this->plans[0],64,0);
+       fft_plan_cfft(&this->plans[1],60,1);
+       fft_plan_rfft(&this->plans[2],128,0);
+       fft_plan_rfft(&this->plans[3],120,1);
+
+       // Scratch of a worker : biggest scratch of the plans
+       this->scratchSamples = 1;
+       for(int p = 0; p < NB_PLANS; p++)
+       {
+          if (fft_scratch_size(&this->plans[p]) > this->scratchSamples)
+          {
+             this->scratchSamples = fft_scratch_size(&this->plans[p]);
+          }
+       }
+
+       input.reload(SchedulerTestsF32::INPUTS_F32_ID,mgr);
+       ref.reload(SchedulerTestsF32::REF_F32_ID,mgr);
+
+       output.create(ref.nbSamples(),SchedulerTestsF32::OUTPUT_F32_ID,mgr);
+       scratch.create(this->nbWorkers*this->scratchSamples,SchedulerTestsF32::SCRATCH_F32_ID,mgr);
+
+    }
+
+    void SchedulerTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
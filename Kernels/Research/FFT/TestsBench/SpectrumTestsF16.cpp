@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "SpectrumTestsF16.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+/*
+
+The output is computed in place : it is a copy of a for
+spectrum_mul, of b for spectrum_mulconj and of acc for spectrum_mac.
+
+*/
+#define SNR_THRESHOLD 65
+
+#define OP_MUL 0
+#define OP_MULCONJ 1
+#define OP_MAC 2
+
+    void SpectrumTestsF16::test_spectrum_f16()
+    {
+       const float16_t *ap = inputA.ptr();
+       const float16_t *bp = inputB.ptr();
+
+       float16_t *outp = output.ptr();
+
+       switch(this->op)
+       {
+         case OP_MUL:
+           memcpy(outp,ap,sizeof(float16_t)*2*this->nbBins);
+           spectrum_mul((const float16_t*)outp,(const float16_t*)bp,(float16_t*)outp,this->nbBins);
+         break;
+
+         case OP_MULCONJ:
+           memcpy(outp,bp,sizeof(float16_t)*2*this->nbBins);
+           spectrum_mulconj((const float16_t*)ap,(const float16_t*)outp,(float16_t*)outp,this->nbBins);
+         break;
+
+         default:
+           memcpy(outp,inputAcc.ptr(),sizeof(float16_t)*2*this->nbBins);
+           spectrum_mac((const float16_t*)ap,(const float16_t*)bp,(float16_t*)outp,this->nbBins);
+         break;
+       }
+
+       ASSERT_SNR(output,ref,(float16_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void SpectrumTestsF16::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case SpectrumTestsF16::TEST_SPECTRUM_F16_1:
+             
+               inputA.reload(SpectrumTestsF16::INPUTS_SPECTRUM_A_1_F16_ID,mgr);
+               inputB.reload(SpectrumTestsF16::INPUTS_SPECTRUM_B_1_F16_ID,mgr);
+               inputAcc.reload(SpectrumTestsF16::INPUTS_SPECTRUM_ACC_1_F16_ID,mgr);
+               ref.reload(  SpectrumTestsF16::REF_SPECTRUM_MUL_1_F16_ID,mgr);
+             
+               this->nbBins=33;
+               this->op=OP_MUL;
+             
+             break;
+
+             case SpectrumTestsF16::TEST_SPECTRUM_F16_2:
+             
+               inputA.reload(SpectrumTestsF16::INPUTS_SPECTRUM_A_2_F16_ID,mgr);
+               inputB.reload(SpectrumTestsF16::INPUTS_SPECTRUM_B_2_F16_ID,mgr);
+               inputAcc.reload(SpectrumTestsF16::INPUTS_SPECTRUM_ACC_2_F16_ID,mgr);
+               ref.reload(  SpectrumTestsF16::REF_SPECTRUM_MUL_2_F16_ID,mgr);
+             
+               this->nbBins=17;
+               this->op=OP_MUL;
+             
+             break;
+
+             case SpectrumTestsF16::TEST_SPECTRUM_F16_3:
+             
+               inputA.reload(SpectrumTestsF16::INPUTS_SPECTRUM_A_1_F16_ID,mgr);
+               inputB.reload(SpectrumTestsF16::INPUTS_SPECTRUM_B_1_F16_ID,mgr);
+               inputAcc.reload(SpectrumTestsF16::INPUTS_SPECTRUM_ACC_1_F16_ID,mgr);
+               ref.reload(  SpectrumTestsF16::REF_SPECTRUM_MULCONJ_1_F16_ID,mgr);
+             
+               this->nbBins=33;
+               this->op=OP_MULCONJ;
+             
+             break;
+
+             case SpectrumTestsF16::TEST_SPECTRUM_F16_4:
+             
+               inputA.reload(SpectrumTestsF16::INPUTS_SPECTRUM_A_2_F16_ID,mgr);
+               inputB.reload(SpectrumTestsF16::INPUTS_SPECTRUM_B_2_F16_ID,mgr);
+               inputAcc.reload(SpectrumTestsF16::INPUTS_SPECTRUM_ACC_2_F16_ID,mgr);
+               ref.reload(  SpectrumTestsF16::REF_SPECTRUM_MULCONJ_2_F16_ID,mgr);
+             
+               this->nbBins=17;
+               this->op=OP_MULCONJ;
+             
+             break;
+
+             case SpectrumTestsF16::TEST_SPECTRUM_F16_5:
+             
+               inputA.reload(SpectrumTestsF16::INPUTS_SPECTRUM_A_1_F16_ID,mgr);
+               inputB.reload(SpectrumTestsF16::INPUTS_SPECTRUM_B_1_F16_ID,mgr);
+               inputAcc.reload(SpectrumTestsF16::INPUTS_SPECTRUM_ACC_1_F16_ID,mgr);
+               ref.reload(  SpectrumTestsF16::REF_SPECTRUM_MAC_1_F16_ID,mgr);
+             
+               this->nbBins=33;
+               this->op=OP_MAC;
+             
+             break;
+
+             case SpectrumTestsF16::TEST_SPECTRUM_F16_6:
+             
+               inputA.reload(SpectrumTestsF16::INPUTS_SPECTRUM_A_2_F16_ID,mgr);
+               inputB.reload(SpectrumTestsF16::INPUTS_SPECTRUM_B_2_F16_ID,mgr);
+               inputAcc.reload(SpectrumTestsF16::INPUTS_SPECTRUM_ACC_2_F16_ID,mgr);
+               ref.reload(  SpectrumTestsF16::REF_SPECTRUM_MAC_2_F16_ID,mgr);
+             
+               this->nbBins=17;
+               this->op=OP_MAC;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),SpectrumTestsF16::OUTPUT_SPECTRUM_F16_ID,mgr);
+
+    }
+
+    void SpectrumTestsF16::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
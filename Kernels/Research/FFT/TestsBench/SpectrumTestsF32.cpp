@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "SpectrumTestsF32.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+/*
+
+The output is computed in place : it is a copy of a for
+spectrum_mul, of b for spectrum_mulconj and of acc for spectrum_mac.
+
+*/
+#define SNR_THRESHOLD 120
+
+#define OP_MUL 0
+#define OP_MULCONJ 1
+#define OP_MAC 2
+
+    void SpectrumTestsF32::test_spectrum_f32()
+    {
+       const float32_t *ap = inputA.ptr();
+       const float32_t *bp = inputB.ptr();
+
+       float32_t *outp = output.ptr();
+
+       switch(this->op)
+       {
+         case OP_MUL:
+           memcpy(outp,ap,sizeof(float32_t)*2*this->nbBins);
+           spectrum_mul((const float32_t*)outp,(const float32_t*)bp,(float32_t*)outp,this->nbBins);
+         break;
+
+         case OP_MULCONJ:
+           memcpy(outp,bp,sizeof(float32_t)*2*this->nbBins);
+           spectrum_mulconj((const float32_t*)ap,(const float32_t*)outp,(float32_t*)outp,this->nbBins);
+         break;
+
+         default:
+           memcpy(outp,inputAcc.ptr(),sizeof(float32_t)*2*this->nbBins);
+           spectrum_mac((const float32_t*)ap,(const float32_t*)bp,(float32_t*)outp,this->nbBins);
+         break;
+       }
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void SpectrumTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case SpectrumTestsF32::TEST_SPECTRUM_F32_1:
+             
+               inputA.reload(SpectrumTestsF32::INPUTS_SPECTRUM_A_1_F32_ID,mgr);
+               inputB.reload(SpectrumTestsF32::INPUTS_SPECTRUM_B_1_F32_ID,mgr);
+               inputAcc.reload(SpectrumTestsF32::INPUTS_SPECTRUM_ACC_1_F32_ID,mgr);
+               ref.reload(  SpectrumTestsF32::REF_SPECTRUM_MUL_1_F32_ID,mgr);
+             
+               this->nbBins=33;
+               this->op=OP_MUL;
+             
+             break;
+
+             case SpectrumTestsF32::TEST_SPECTRUM_F32_2:
+             
+               inputA.reload(SpectrumTestsF32::INPUTS_SPECTRUM_A_2_F32_ID,mgr);
+               inputB.reload(SpectrumTestsF32::INPUTS_SPECTRUM_B_2_F32_ID,mgr);
+               inputAcc.reload(SpectrumTestsF32::INPUTS_SPECTRUM_ACC_2_F32_ID,mgr);
+               ref.reload(  SpectrumTestsF32::REF_SPECTRUM_MUL_2_F32_ID,mgr);
+             
+               this->nbBins=17;
+               this->op=OP_MUL;
+             
+             break;
+
+             case SpectrumTestsF32::TEST_SPECTRUM_F32_3:
+             
+               inputA.reload(SpectrumTestsF32::INPUTS_SPECTRUM_A_1_F32_ID,mgr);
+               inputB.reload(SpectrumTestsF32::INPUTS_SPECTRUM_B_1_F32_ID,mgr);
+               inputAcc.reload(SpectrumTestsF32::INPUTS_SPECTRUM_ACC_1_F32_ID,mgr);
+               ref.reload(  SpectrumTestsF32::REF_SPECTRUM_MULCONJ_1_F32_ID,mgr);
+             
+               this->nbBins=33;
+               this->op=OP_MULCONJ;
+             
+             break;
+
+             case SpectrumTestsF32::TEST_SPECTRUM_F32_4:
+             
+               inputA.reload(SpectrumTestsF32::INPUTS_SPECTRUM_A_2_F32_ID,mgr);
+               inputB.reload(SpectrumTestsF32::INPUTS_SPECTRUM_B_2_F32_ID,mgr);
+               inputAcc.reload(SpectrumTestsF32::INPUTS_SPECTRUM_ACC_2_F32_ID,mgr);
+               ref.reload(  SpectrumTestsF32::REF_SPECTRUM_MULCONJ_2_F32_ID,mgr);
+             
+               this->nbBins=17;
+               this->op=OP_MULCONJ;
+             
+             break;
+
+             case SpectrumTestsF32::TEST_SPECTRUM_F32_5:
+             
+               inputA.reload(SpectrumTestsF32::INPUTS_SPECTRUM_A_1_F32_ID,mgr);
+               inputB.reload(SpectrumTestsF32::INPUTS_SPECTRUM_B_1_F32_ID,mgr);
+               inputAcc.reload(SpectrumTestsF32::INPUTS_SPECTRUM_ACC_1_F32_ID,mgr);
+               ref.reload(  SpectrumTestsF32::REF_SPECTRUM_MAC_1_F32_ID,mgr);
+             
+               this->nbBins=33;
+               this->op=OP_MAC;
+             
+             break;
+
+             case SpectrumTestsF32::TEST_SPECTRUM_F32_6:
+             
+               inputA.reload(SpectrumTestsF32::INPUTS_SPECTRUM_A_2_F32_ID,mgr);
+               inputB.reload(SpectrumTestsF32::INPUTS_SPECTRUM_B_2_F32_ID,mgr);
+               inputAcc.reload(SpectrumTestsF32::INPUTS_SPECTRUM_ACC_2_F32_ID,mgr);
+               ref.reload(  SpectrumTestsF32::REF_SPECTRUM_MAC_2_F32_ID,mgr);
+             
+               this->nbBins=17;
+               this->op=OP_MAC;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),SpectrumTestsF32::OUTPUT_SPECTRUM_F32_ID,mgr);
+
+    }
+
+    void SpectrumTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
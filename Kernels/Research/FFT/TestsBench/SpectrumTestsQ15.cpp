@@ -0,0 +1,164 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "SpectrumTestsQ15.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+/*
+
+The output is computed in place : it is a copy of a for
+spectrum_mul, of b for spectrum_mulconj and of acc for spectrum_mac.
+The last bins of the patterns are saturating : the saturated
+values must be exactly the bounds of the datatype.
+
+*/
+#define SNR_THRESHOLD 75
+
+#define OP_MUL 0
+#define OP_MULCONJ 1
+#define OP_MAC 2
+
+    void SpectrumTestsQ15::test_spectrum_q15()
+    {
+       const q15_t *ap = inputA.ptr();
+       const q15_t *bp = inputB.ptr();
+
+       q15_t *outp = output.ptr();
+
+       switch(this->op)
+       {
+         case OP_MUL:
+           memcpy(outp,ap,sizeof(q15_t)*2*this->nbBins);
+           spectrum_mul((const FFTSCI::Q15*)outp,(const FFTSCI::Q15*)bp,(FFTSCI::Q15*)outp,this->nbBins);
+         break;
+
+         case OP_MULCONJ:
+           memcpy(outp,bp,sizeof(q15_t)*2*this->nbBins);
+           spectrum_mulconj((const FFTSCI::Q15*)ap,(const FFTSCI::Q15*)outp,(FFTSCI::Q15*)outp,this->nbBins);
+         break;
+
+         default:
+           memcpy(outp,inputAcc.ptr(),sizeof(q15_t)*2*this->nbBins);
+           spectrum_mac((const FFTSCI::Q15*)ap,(const FFTSCI::Q15*)bp,(FFTSCI::Q15*)outp,this->nbBins);
+         break;
+       }
+
+       ASSERT_SNR(output,ref,(q15_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+       const q15_t *refp = ref.ptr();
+       for(uint32_t i=0; i < 2*this->nbBins; i++)
+       {
+          if ((refp[i] == INT16_MAX) || (refp[i] == INT16_MIN))
+          {
+             ASSERT_TRUE(outp[i] == refp[i]);
+          }
+       }
+
+    } 
+
+    void SpectrumTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case SpectrumTestsQ15::TEST_SPECTRUM_Q15_1:
+             
+               inputA.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_A_1_Q15_ID,mgr);
+               inputB.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_B_1_Q15_ID,mgr);
+               inputAcc.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_ACC_1_Q15_ID,mgr);
+               ref.reload(  SpectrumTestsQ15::REF_SPECTRUM_MUL_1_Q15_ID,mgr);
+             
+               this->nbBins=33;
+               this->op=OP_MUL;
+             
+             break;
+
+             case SpectrumTestsQ15::TEST_SPECTRUM_Q15_2:
+             
+               inputA.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_A_2_Q15_ID,mgr);
+               inputB.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_B_2_Q15_ID,mgr);
+               inputAcc.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_ACC_2_Q15_ID,mgr);
+               ref.reload(  SpectrumTestsQ15::REF_SPECTRUM_MUL_2_Q15_ID,mgr);
+             
+               this->nbBins=17;
+               this->op=OP_MUL;
+             
+             break;
+
+             case SpectrumTestsQ15::TEST_SPECTRUM_Q15_3:
+             
+               inputA.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_A_1_Q15_ID,mgr);
+               inputB.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_B_1_Q15_ID,mgr);
+               inputAcc.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_ACC_1_Q15_ID,mgr);
+               ref.reload(  SpectrumTestsQ15::REF_SPECTRUM_MULCONJ_1_Q15_ID,mgr);
+             
+               this->nbBins=33;
+               this->op=OP_MULCONJ;
+             
+             break;
+
+             case SpectrumTestsQ15::TEST_SPECTRUM_Q15_4:
+             
+               inputA.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_A_2_Q15_ID,mgr);
+               inputB.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_B_2_Q15_ID,mgr);
+               inputAcc.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_ACC_2_Q15_ID,mgr);
+               ref.reload(  SpectrumTestsQ15::REF_SPECTRUM_MULCONJ_2_Q15_ID,mgr);
+             
+               this->nbBins=17;
+               this->op=OP_MULCONJ;
+             
+             break;
+
+             case SpectrumTestsQ15::TEST_SPECTRUM_Q15_5:
+             
+               inputA.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_A_1_Q15_ID,mgr);
+               inputB.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_B_1_Q15_ID,mgr);
+               inputAcc.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_ACC_1_Q15_ID,mgr);
+               ref.reload(  SpectrumTestsQ15::REF_SPECTRUM_MAC_1_Q15_ID,mgr);
+             
+               this->nbBins=33;
+               this->op=OP_MAC;
+             
+             break;
+
+             case SpectrumTestsQ15::TEST_SPECTRUM_Q15_6:
+             
+               inputA.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_A_2_Q15_ID,mgr);
+               inputB.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_B_2_Q15_ID,mgr);
+               inputAcc.reload(SpectrumTestsQ15::INPUTS_SPECTRUM_ACC_2_Q15_ID,mgr);
+               ref.reload(  SpectrumTestsQ15::REF_SPECTRUM_MAC_2_Q15_ID,mgr);
+             
+               this->nbBins=17;
+               this->op=OP_MAC;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),SpectrumTestsQ15::OUTPUT_SPECTRUM_Q15_ID,mgr);
+
+    }
+
+    void SpectrumTestsQ15::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "SplitTestsF16.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+/*
+
+The input and the output are the real parts
+followed by the imaginary parts.
+
+*/
+#define SNR_THRESHOLD 56
+#define IFFT_SNR_THRESHOLD 56
+
+    void SplitTestsF16::test_cfft_split_f16()
+    {
+       const float16_t *inp = input.ptr();
+
+       float16_t *outp = output.ptr();
+       float16_t *tmpp = tmp.ptr();
+
+       if (this->ifft)
+       {
+          status=cifft_split(inp,inp + this->nb,tmpp,outp,outp + this->nb,this->nb);
+       }
+       else
+       {
+          status=cfft_split(inp,inp + this->nb,tmpp,outp,outp + this->nb,this->nb);
+       }
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float16_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void SplitTestsF16::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case SplitTestsF16::TEST_CFFT_SPLIT_F16_1:
+             
+               input.reload(SplitTestsF16::INPUTS_SPLIT_FFT_1_F16_ID,mgr);
+               ref.reload(  SplitTestsF16::REF_SPLIT_FFT_1_F16_ID,mgr);
+             
+               this->nb=64;
+               this->ifft=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case SplitTestsF16::TEST_CFFT_SPLIT_F16_2:
+             
+               input.reload(SplitTestsF16::INPUTS_SPLIT_FFT_2_F16_ID,mgr);
+               ref.reload(  SplitTestsF16::REF_SPLIT_FFT_2_F16_ID,mgr);
+             
+               this->nb=60;
+               this->ifft=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case SplitTestsF16::TEST_CFFT_SPLIT_F16_3:
+             
+               input.reload(SplitTestsF16::INPUTS_SPLIT_IFFT_1_F16_ID,mgr);
+               ref.reload(  SplitTestsF16::REF_SPLIT_IFFT_1_F16_ID,mgr);
+             
+               this->nb=64;
+               this->ifft=1;
+               this->snr=IFFT_SNR_THRESHOLD;
+             
+             break;
+
+             case SplitTestsF16::TEST_CFFT_SPLIT_F16_4:
+             
+               input.reload(SplitTestsF16::INPUTS_SPLIT_IFFT_2_F16_ID,mgr);
+               ref.reload(  SplitTestsF16::REF_SPLIT_IFFT_2_F16_ID,mgr);
+             
+               this->nb=60;
+               this->ifft=1;
+               this->snr=IFFT_SNR_THRESHOLD;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),SplitTestsF16::OUTPUT_SPLIT_F16_ID,mgr);
+       tmp.create(2*this->nb,SplitTestsF16::TMP_SPLIT_F16_ID,mgr);
+
+    }
+
+    void SplitTestsF16::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
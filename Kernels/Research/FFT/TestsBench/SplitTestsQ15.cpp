@@ -0,0 +1,141 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "SplitTestsQ15.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+#include "FixedPointScaling.h"
+
+/*
+
+The input and the output are the real parts
+followed by the imaginary parts.
+In q15, the inverse FFTs lose 2*format bits (like cifft) :
+the inverse of length 60 is disabled.
+
+*/
+#define SNR_THRESHOLD 26
+#define IFFT_SNR_THRESHOLD 15
+
+    void SplitTestsQ15::test_cfft_split_q15()
+    {
+       const q15_t *inp = input.ptr();
+
+       q15_t *outp = output.ptr();
+       q15_t *tmpp = tmp.ptr();
+       q15_t *tmpoutp = tmpout.ptr();
+       int fftscaling,testscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q15>(this->nb)->format;
+
+       if (this->ifft)
+       {
+          testscaling = 2;
+          status=cifft_split((const FFTSCI::Q15*)inp,(const FFTSCI::Q15*)(inp + this->nb),
+            (FFTSCI::Q15*)tmpp,
+            (FFTSCI::Q15*)outp,(FFTSCI::Q15*)(outp + this->nb),this->nb);
+       }
+       else
+       {
+          testscaling = scaling(this->nb);
+          status=cfft_split((const FFTSCI::Q15*)inp,(const FFTSCI::Q15*)(inp + this->nb),
+            (FFTSCI::Q15*)tmpp,
+            (FFTSCI::Q15*)outp,(FFTSCI::Q15*)(outp + this->nb),this->nb);
+       }
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+       {
+          if ((testscaling-fftscaling) > 0)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+          else
+          {
+             tmpoutp[i] = __SSAT(((q31_t)outp[i] << (fftscaling - testscaling)),16);
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q15_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void SplitTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case SplitTestsQ15::TEST_CFFT_SPLIT_Q15_1:
+             
+               input.reload(SplitTestsQ15::INPUTS_SPLIT_FFT_1_Q15_ID,mgr);
+               ref.reload(  SplitTestsQ15::REF_SPLIT_FFT_1_Q15_ID,mgr);
+             
+               this->nb=64;
+               this->ifft=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case SplitTestsQ15::TEST_CFFT_SPLIT_Q15_2:
+             
+               input.reload(SplitTestsQ15::INPUTS_SPLIT_FFT_2_Q15_ID,mgr);
+               ref.reload(  SplitTestsQ15::REF_SPLIT_FFT_2_Q15_ID,mgr);
+             
+               this->nb=60;
+               this->ifft=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case SplitTestsQ15::TEST_CFFT_SPLIT_Q15_3:
+             
+               input.reload(SplitTestsQ15::INPUTS_SPLIT_IFFT_1_Q15_ID,mgr);
+               ref.reload(  SplitTestsQ15::REF_SPLIT_IFFT_1_Q15_ID,mgr);
+             
+               this->nb=64;
+               this->ifft=1;
+               this->snr=IFFT_SNR_THRESHOLD;
+             
+             break;
+
+             case SplitTestsQ15::TEST_CFFT_SPLIT_Q15_4:
+             
+               input.reload(SplitTestsQ15::INPUTS_SPLIT_IFFT_2_Q15_ID,mgr);
+               ref.reload(  SplitTestsQ15::REF_SPLIT_IFFT_2_Q15_ID,mgr);
+             
+               this->nb=60;
+               this->ifft=1;
+               this->snr=IFFT_SNR_THRESHOLD;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),SplitTestsQ15::OUTPUT_SPLIT_Q15_ID,mgr);
+       tmp.create(2*this->nb,SplitTestsQ15::TMP_SPLIT_Q15_ID,mgr);
+       tmpout.create(ref.nbSamples(),SplitTestsQ15::TMPOUT_SPLIT_Q15_ID,mgr);
+
+    }
+
+    void SplitTestsQ15::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "SplitTestsQ31.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+#include "FixedPointScaling.h"
+
+/*
+
+The input and the output are the real parts
+followed by the imaginary parts.
+
+*/
+#define SNR_THRESHOLD 89
+#define IFFT_SNR_THRESHOLD 70
+
+    void SplitTestsQ31::test_cfft_split_q31()
+    {
+       const q31_t *inp = input.ptr();
+
+       q31_t *outp = output.ptr();
+       q31_t *tmpp = tmp.ptr();
+       q31_t *tmpoutp = tmpout.ptr();
+       int fftscaling,testscaling;
+
+       fftscaling = cfft_config<FFTSCI::Q31>(this->nb)->format;
+
+       if (this->ifft)
+       {
+          testscaling = 2;
+          status=cifft_split((const FFTSCI::Q31*)inp,(const FFTSCI::Q31*)(inp + this->nb),
+            (FFTSCI::Q31*)tmpp,
+            (FFTSCI::Q31*)outp,(FFTSCI::Q31*)(outp + this->nb),this->nb);
+       }
+       else
+       {
+          testscaling = scaling(this->nb);
+          status=cfft_split((const FFTSCI::Q31*)inp,(const FFTSCI::Q31*)(inp + this->nb),
+            (FFTSCI::Q31*)tmpp,
+            (FFTSCI::Q31*)outp,(FFTSCI::Q31*)(outp + this->nb),this->nb);
+       }
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       for(Testing::nbSamples_t i=0; i < output.nbSamples(); i ++)
+       {
+          if ((testscaling-fftscaling) > 0)
+          {
+             tmpoutp[i] = outp[i] >> (testscaling-fftscaling);
+          }
+          else
+          {
+             tmpoutp[i] = ((q63_t)outp[i] << (fftscaling - testscaling));
+          }
+       }
+
+       ASSERT_SNR(tmpout,ref,(q31_t)this->snr);
+       ASSERT_EMPTY_TAIL(output);
+
+    } 
+
+    void SplitTestsQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case SplitTestsQ31::TEST_CFFT_SPLIT_Q31_1:
+             
+               input.reload(SplitTestsQ31::INPUTS_SPLIT_FFT_1_Q31_ID,mgr);
+               ref.reload(  SplitTestsQ31::REF_SPLIT_FFT_1_Q31_ID,mgr);
+             
+               this->nb=64;
+               this->ifft=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case SplitTestsQ31::TEST_CFFT_SPLIT_Q31_2:
+             
+               input.reload(SplitTestsQ31::INPUTS_SPLIT_FFT_2_Q31_ID,mgr);
+               ref.reload(  SplitTestsQ31::REF_SPLIT_FFT_2_Q31_ID,mgr);
+             
+               this->nb=60;
+               this->ifft=0;
+               this->snr=SNR_THRESHOLD;
+             
+             break;
+
+             case SplitTestsQ31::TEST_CFFT_SPLIT_Q31_3:
+             
+               input.reload(SplitTestsQ31::INPUTS_SPLIT_IFFT_1_Q31_ID,mgr);
+               ref.reload(  SplitTestsQ31::REF_SPLIT_IFFT_1_Q31_ID,mgr);
+             
+               this->nb=64;
+               this->ifft=1;
+               this->snr=IFFT_SNR_THRESHOLD;
+             
+             break;
+
+             case SplitTestsQ31::TEST_CFFT_SPLIT_Q31_4:
+             
+               input.reload(SplitTestsQ31::INPUTS_SPLIT_IFFT_2_Q31_ID,mgr);
+               ref.reload(  SplitTestsQ31::REF_SPLIT_IFFT_2_Q31_ID,mgr);
+             
+               this->nb=60;
+               this->ifft=1;
+               this->snr=IFFT_SNR_THRESHOLD;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),SplitTestsQ31::OUTPUT_SPLIT_Q31_ID,mgr);
+       tmp.create(2*this->nb,SplitTestsQ31::TMP_SPLIT_Q31_ID,mgr);
+       tmpout.create(ref.nbSamples(),SplitTestsQ31::TMPOUT_SPLIT_Q31_ID,mgr);
+
+    }
+
+    void SplitTestsQ31::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
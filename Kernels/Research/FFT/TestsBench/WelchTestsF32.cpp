@@ -0,0 +1,218 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "WelchTestsF32.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+#define SNR_THRESHOLD 120
+
+/*
+
+The input is given in three updates : the first one is
+shorter than a segment and the two others are not
+multiple of the hop.
+
+*/
+#define FIRST_UPDATE 10
+
+    void WelchTestsF32::test_psd_f32()
+    {
+       const float32_t *inp = inputX.ptr();
+       const uint32_t nbSamples = inputX.nbSamples();
+       const uint32_t second = nbSamples / 3;
+
+       float32_t *outp = output.ptr();
+       welchstate<float32_t> S;
+
+       status=welch_psd_init(&S,this->nb,this->overlap,this->windowp,this->nbThreads,
+         this->segment,this->tmp,this->acc);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       // No segment accumulated yet
+       welch_psd_update(&S,inp,FIRST_UPDATE);
+       status=welch_psd(&S,outp);
+       ASSERT_TRUE(status==ARM_MATH_ARGUMENT_ERROR);
+
+       welch_psd_update(&S,inp+FIRST_UPDATE,second);
+       welch_psd_update(&S,inp+FIRST_UPDATE+second,nbSamples-FIRST_UPDATE-second);
+       status=welch_psd(&S,outp);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void WelchTestsF32::test_csd_f32()
+    {
+       const float32_t *inpx = inputX.ptr();
+       const float32_t *inpy = inputY.ptr();
+       const uint32_t nbSamples = inputX.nbSamples();
+       const uint32_t second = nbSamples / 3;
+
+       float32_t *outp = output.ptr();
+       welchstate<float32_t> S;
+
+       // 15 is a CFFT length but X and Y can't be separated
+       // for odd lengths
+       status=welch_csd_init(&S,15,this->overlap,this->windowp,this->nbThreads,
+         this->segment,this->tmp,this->acc);
+       ASSERT_TRUE(status==ARM_MATH_LENGTH_ERROR);
+
+       status=welch_csd_init(&S,this->nb,this->overlap,this->windowp,this->nbThreads,
+         this->segment,this->tmp,this->acc);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       welch_csd_update(&S,inpx,inpy,FIRST_UPDATE);
+       welch_csd_update(&S,inpx+FIRST_UPDATE,inpy+FIRST_UPDATE,second);
+       welch_csd_update(&S,inpx+FIRST_UPDATE+second,inpy+FIRST_UPDATE+second,
+         nbSamples-FIRST_UPDATE-second);
+       status=welch_csd(&S,outp);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void WelchTestsF32::test_coherence_f32()
+    {
+       const float32_t *inpx = inputX.ptr();
+       const float32_t *inpy = inputY.ptr();
+       const uint32_t nbSamples = inputX.nbSamples();
+       const uint32_t second = nbSamples / 3;
+
+       float32_t *outp = output.ptr();
+       welchstate<float32_t> S;
+
+       status=welch_csd_init(&S,this->nb,this->overlap,this->windowp,this->nbThreads,
+         this->segment,this->tmp,this->acc);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       welch_csd_update(&S,inpx,inpy,FIRST_UPDATE);
+       welch_csd_update(&S,inpx+FIRST_UPDATE,inpy+FIRST_UPDATE,second);
+       welch_csd_update(&S,inpx+FIRST_UPDATE+second,inpy+FIRST_UPDATE+second,
+         nbSamples-FIRST_UPDATE-second);
+       status=welch_coherence(&S,outp);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void WelchTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case WelchTestsF32::TEST_PSD_F32_1:
+             
+               inputX.reload(WelchTestsF32::INPUTX_WELCH_1_F32_ID,mgr);
+               window.reload(WelchTestsF32::WINDOW_WELCH_1_F32_ID,mgr);
+               ref.reload(   WelchTestsF32::REF_PSD_1_F32_ID,mgr);
+             
+               this->nb=64;
+               this->overlap=32;
+               this->windowp=window.ptr();
+               this->nbThreads=1;
+             
+             break;
+
+             case WelchTestsF32::TEST_PSD_F32_2:
+             
+               inputX.reload(WelchTestsF32::INPUTX_WELCH_2_F32_ID,mgr);
+               ref.reload(   WelchTestsF32::REF_PSD_2_F32_ID,mgr);
+             
+               this->nb=128;
+               this->overlap=96;
+               this->windowp=NULL;
+               this->nbThreads=2;
+             
+             break;
+
+             case WelchTestsF32::TEST_CSD_F32_3:
+             
+               inputX.reload(WelchTestsF32::INPUTX_WELCH_1_F32_ID,mgr);
+               inputY.reload(WelchTestsF32::INPUTY_WELCH_1_F32_ID,mgr);
+               window.reload(WelchTestsF32::WINDOW_WELCH_1_F32_ID,mgr);
+               ref.reload(   WelchTestsF32::REF_CSD_1_F32_ID,mgr);
+             
+               this->nb=64;
+               this->overlap=32;
+               this->windowp=window.ptr();
+               this->nbThreads=1;
+             
+             break;
+
+             case WelchTestsF32::TEST_CSD_F32_4:
+             
+               inputX.reload(WelchTestsF32::INPUTX_WELCH_2_F32_ID,mgr);
+               inputY.reload(WelchTestsF32::INPUTY_WELCH_2_F32_ID,mgr);
+               ref.reload(   WelchTestsF32::REF_CSD_2_F32_ID,mgr);
+             
+               this->nb=128;
+               this->overlap=96;
+               this->windowp=NULL;
+               this->nbThreads=2;
+             
+             break;
+
+             case WelchTestsF32::TEST_COHERENCE_F32_5:
+             
+               inputX.reload(WelchTestsF32::INPUTX_WELCH_1_F32_ID,mgr);
+               inputY.reload(WelchTestsF32::INPUTY_WELCH_1_F32_ID,mgr);
+               window.reload(WelchTestsF32::WINDOW_WELCH_1_F32_ID,mgr);
+               ref.reload(   WelchTestsF32::REF_COHERENCE_1_F32_ID,mgr);
+             
+               this->nb=64;
+               this->overlap=32;
+               this->windowp=window.ptr();
+               this->nbThreads=1;
+             
+             break;
+
+             case WelchTestsF32::TEST_COHERENCE_F32_6:
+             
+               inputX.reload(WelchTestsF32::INPUTX_WELCH_2_F32_ID,mgr);
+               inputY.reload(WelchTestsF32::INPUTY_WELCH_2_F32_ID,mgr);
+               ref.reload(   WelchTestsF32::REF_COHERENCE_2_F32_ID,mgr);
+             
+               this->nb=128;
+               this->overlap=96;
+               this->windowp=NULL;
+               this->nbThreads=2;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),WelchTestsF32::OUTPUT_WELCH_F32_ID,mgr);
+
+    }
+
+    void WelchTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
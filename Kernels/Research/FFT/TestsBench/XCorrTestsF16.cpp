@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "XCorrTestsF16.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+/*
+
+The direct method is accumulating up to 100 products in f16
+
+*/
+#define SNR_THRESHOLD 50
+
+    void XCorrTestsF16::test_xcorr_f16()
+    {
+       const float16_t *inpx = inputX.ptr();
+       const float16_t *inpy = inputY.ptr();
+
+       float16_t *outp = output.ptr();
+       float16_t *tmpp = tmp.ptr();
+
+       xcorr(inpx,inputX.nbSamples(),inpy,inputY.nbSamples(),
+         this->firstLag,this->nbLags,tmpp,outp,this->nb);
+
+       ASSERT_SNR(output,ref,(float16_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void XCorrTestsF16::test_autocorr_f16()
+    {
+       const float16_t *inpx = inputX.ptr();
+
+       float16_t *outp = output.ptr();
+       float16_t *tmpp = tmp.ptr();
+
+       autocorr(inpx,inputX.nbSamples(),this->nbLags,tmpp,outp,this->nb);
+
+       ASSERT_SNR(output,ref,(float16_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void XCorrTestsF16::test_xcorr_stream_f16()
+    {
+       const float16_t *inpx = inputX.ptr();
+       xcorrstate<float16_t> S;
+       uint32_t nbOut;
+
+       float16_t *outp = output.ptr();
+       float16_t *tmpp = tmp.ptr();
+
+       // The input is given in two updates which are not
+       // ending on a segment
+       const uint32_t nbSamples = inputX.nbSamples();
+       const uint32_t first = nbSamples / 3;
+
+       status=xcorr_stream_init(&S,inputY.ptr(),inputY.nbSamples(),this->nb,
+         this->spectrum,this->segment,tmpp);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       nbOut = xcorr_stream(&S,inpx,first,outp);
+       nbOut += xcorr_stream(&S,inpx + first,nbSamples - first,outp + nbOut);
+       ASSERT_TRUE(nbOut == ref.nbSamples());
+
+       ASSERT_SNR(output,ref,(float16_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void XCorrTestsF16::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             // All the lags with the RFFT
+             case XCorrTestsF16::TEST_XCORR_F16_1:
+             
+               inputX.reload(XCorrTestsF16::INPUTX_XCORR_1_F16_ID,mgr);
+               inputY.reload(XCorrTestsF16::INPUTY_XCORR_1_F16_ID,mgr);
+               ref.reload(   XCorrTestsF16::REF_XCORR_1_F16_ID,mgr);
+             
+               this->firstLag=-99;
+               this->nbLags=299;
+               this->nb=512;
+             
+             break;
+
+             // A few lags with the dot products
+             case XCorrTestsF16::TEST_XCORR_F16_2:
+             
+               inputX.reload(XCorrTestsF16::INPUTX_XCORR_2_F16_ID,mgr);
+               inputY.reload(XCorrTestsF16::INPUTY_XCORR_2_F16_ID,mgr);
+               ref.reload(   XCorrTestsF16::REF_XCORR_2_F16_ID,mgr);
+             
+               this->firstLag=-10;
+               this->nbLags=21;
+               this->nb=512;
+             
+             break;
+
+             case XCorrTestsF16::TEST_AUTOCORR_F16_3:
+             
+               inputX.reload(XCorrTestsF16::INPUTX_AUTOCORR_3_F16_ID,mgr);
+               ref.reload(   XCorrTestsF16::REF_AUTOCORR_3_F16_ID,mgr);
+             
+               this->firstLag=0;
+               this->nbLags=100;
+               this->nb=512;
+             
+             break;
+
+             case XCorrTestsF16::TEST_XCORR_STREAM_F16_4:
+             
+               inputX.reload(XCorrTestsF16::INPUTX_STREAM_4_F16_ID,mgr);
+               inputY.reload(XCorrTestsF16::INPUTY_STREAM_4_F16_ID,mgr);
+               ref.reload(   XCorrTestsF16::REF_STREAM_4_F16_ID,mgr);
+             
+               this->firstLag=0;
+               this->nbLags=0;
+               this->nb=128;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),XCorrTestsF16::OUTPUT_XCORR_F16_ID,mgr);
+       tmp.create(3*this->nb+4,XCorrTestsF16::TMP_XCORR_F16_ID,mgr);
+
+    }
+
+    void XCorrTestsF16::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+*
+* Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "ZoomTestsF32.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+/*
+
+The coefficients of the filter and the oscillator are
+computed in f32 (sinf / cosf of phases up to 2 pi center D nbTaps)
+
+*/
+#define SNR_THRESHOLD 90
+
+    void ZoomTestsF32::test_zoom_fft_f32()
+    {
+       const float32_t *inp = input.ptr();
+       zoomstate<float32_t> S;
+       uint32_t nbOut;
+
+       float32_t *outp = output.ptr();
+
+       // The input is given in two updates which are not
+       // ending on a decimated sample
+       const uint32_t nbSamples = input.nbSamples();
+       const uint32_t first = nbSamples / 3;
+
+       status=zoom_fft_init(&S,this->center,this->decimation,this->nbTaps,this->nb,
+         this->windowp,this->coefs,this->delay,this->frame);
+       ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+       nbOut = zoom_fft(&S,inp,first,outp);
+       nbOut += zoom_fft(&S,inp + first,nbSamples - first,outp + 2*this->nb*nbOut);
+       ASSERT_TRUE(2*this->nb*nbOut == ref.nbSamples());
+
+       ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+       ASSERT_EMPTY_TAIL(output);
+
+
+    } 
+
+    void ZoomTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+             case ZoomTestsF32::TEST_ZOOM_FFT_F32_1:
+             
+               input.reload( ZoomTestsF32::INPUTS_ZOOM_1_F32_ID,mgr);
+               window.reload(ZoomTestsF32::WINDOW_ZOOM_1_F32_ID,mgr);
+               ref.reload(   ZoomTestsF32::REF_ZOOM_1_F32_ID,mgr);
+             
+               this->center=0.125f;
+               this->decimation=8;
+               this->nbTaps=8;
+               this->nb=64;
+               this->windowp=window.ptr();
+             
+             break;
+
+             case ZoomTestsF32::TEST_ZOOM_FFT_F32_2:
+             
+               input.reload( ZoomTestsF32::INPUTS_ZOOM_2_F32_ID,mgr);
+               ref.reload(   ZoomTestsF32::REF_ZOOM_2_F32_ID,mgr);
+             
+               this->center=-0.2f;
+               this->decimation=4;
+               this->nbTaps=6;
+               this->nb=60;
+               this->windowp=NULL;
+             
+             break;
+       }
+       output.create(ref.nbSamples(),ZoomTestsF32::OUTPUT_ZOOM_F32_ID,mgr);
+
+    }
+
+    void ZoomTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
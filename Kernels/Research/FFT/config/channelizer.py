@@ -0,0 +1,102 @@
+#
+#
+# Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+from config.fft import *
+from config.mfcc import printSizedArray
+
+# Kaiser window parameter of the prototype filter
+CHANNELIZER_KAISER_BETA = 8.0
+
+# Lowpass prototype filter of nbChannels * nbTaps coefficients
+# with a cutoff at half the channel spacing and a DC gain of 1.
+def prototypeFilter(nbChannels,nbTaps):
+    length = nbChannels * nbTaps
+    t = np.arange(length) - (length - 1) / 2.0
+    h = np.sinc(t / nbChannels) * np.kaiser(length, CHANNELIZER_KAISER_BETA)
+    return(h / np.sum(h))
+
+channelizerconfig = """channelizerconfig<%s> channelizerconfig%d={
+   .nbChannels=%d,
+   .nbTaps=%d,
+   .coefs=channelizerCoefs%d
+   };
+"""
+
+channelizerconfigFuncStart="""
+template<>
+const channelizerconfig<%s> *channelizer_config<%s>(uint32_t nbChannels,uint32_t nbTaps)
+{"""
+
+channelizerCase="""    if ((nbChannels == %d) && (nbTaps == %d))
+    {
+        return(&channelizerconfig%d);
+    }"""
+
+channelizerconfigFuncStop="""    return(NULL);
+}
+"""
+
+# Description of a channelizer configuration :
+# [nbChannels, nbTaps]
+# nbTaps is the number of taps of each polyphase branch
+class Channelizer:
+    ChannelizerID = 0
+
+    def __init__(self,datatype,desc):
+        Channelizer.ChannelizerID = Channelizer.ChannelizerID + 1
+        self._id = Channelizer.ChannelizerID
+        self._datatype = datatype
+        self._nbChannels,self._nbTaps = desc[0],desc[1]
+
+    @property
+    def channelizerID(self):
+        return(self._id)
+
+    @property
+    def datatype(self):
+        return(self._datatype)
+
+    @property
+    def nbChannels(self):
+        return(self._nbChannels)
+
+    @property
+    def nbTaps(self):
+        return(self._nbTaps)
+
+    # The prototype filter is stored reversed : the branch MACs
+    # are then reading the coefficients and the delay line in the
+    # same direction.
+    # Size in bytes of the prototype filter
+    @property
+    def tableBytes(self):
+        return(getCtypeSize(self.datatype)*self.nbChannels*self.nbTaps)
+
+    def writeChannelizerCode(self,c):
+        ctype=getCtype(self.datatype)
+        h=prototypeFilter(self.nbChannels,self.nbTaps)
+
+        printSizedArray(c,ctype,"channelizerCoefs%d" % self.channelizerID,h[::-1])
+
+        print(channelizerconfig % (ctype,self.channelizerID,self.nbChannels,self.nbTaps,
+            self.channelizerID),file=c)
+
+    def writeChannelizerCase(self,c):
+        print(channelizerCase % (self.nbChannels,self.nbTaps,self.channelizerID),file=c)
@@ -40,6 +40,8 @@ class FFT:
            return([5,4,3,2])
         if datatype == "q31":
            return([5,4,3,2])
+        if datatype == "q7":
+           return([5,4,3,2])
         return([5,4,3,2])
 
 
@@ -52,6 +54,8 @@ class M0(FFT):
            return([5,4,3,2])
         if datatype == "q31":
            return([5,4,3,2])
+        if datatype == "q7":
+           return([5,4,3,2])
         # For float, we have no vectorization and we use a radix 8
         # for better performance.
         return([8,5,4,3,2])
@@ -64,6 +68,8 @@ class M4(FFT):
     def mode(self,datatype):
         if datatype == "q15":
             return("DSP")
+        if datatype == "q7":
+            return("DSP")
         return("C")
 
     def radix(self,datatype,nb):
@@ -71,6 +77,8 @@ class M4(FFT):
            return([5,4,3,2])
         if datatype == "q31":
            return([5,4,3,2])
+        if datatype == "q7":
+           return([5,4,3,2])
         
         if nb == 512:
            return([8,5,4,3,2])
@@ -86,6 +94,8 @@ class M7(M4):
            return([5,4,3,2])
         if datatype == "q31":
            return([5,4,3,2])
+        if datatype == "q7":
+           return([5,4,3,2])
         
         return([8,5,4,3,2])
         
@@ -100,6 +110,8 @@ class M33(M4):
            return([5,4,3,2])
         if datatype == "q31":
            return([5,4,3,2])
+        if datatype == "q7":
+           return([5,4,3,2])
         
         if nb > 512:
            return([5,4,3,2])
@@ -116,6 +128,8 @@ class M55NOMVE(M4):
            return([5,4,3,2])
         if datatype == "q31":
            return([5,4,3,2])
+        if datatype == "q7":
+           return([5,4,3,2])
         if nb > 512:
            return([5,4,3,2])
         else:
@@ -125,13 +139,16 @@ class M55(M55NOMVE):
     def __init__(self):
         M55NOMVE.__init__(self)
        
-    # Vector version for floar.
-    # Scalar for other datatypes
+    # Vector version for float and q7.
+    # Scalar for other datatypes.
+    # Only the radix 2 and 4 have a q7 vector version.
     def hasVector(self,datatype):
         if datatype == "f32":
            return(True)
         if datatype == "f16":
            return(True)
+        if datatype == "q7":
+           return(True)
         return(False)
 
     # Helium extensions
@@ -144,6 +161,8 @@ class M55(M55NOMVE):
            return([5,4,3,2])
         if datatype == "q31":
            return([5,4,3,2])
+        if datatype == "q7":
+           return([5,4,3,2])
         # Short radixes for vectorization (register pressure)
         return([5,4,3,2])
         
@@ -155,6 +174,8 @@ class A32(FFT):
     def mode(self,datatype):
         if datatype == "q15":
             return("DSP")
+        if datatype == "q7":
+            return("DSP")
         return("C")
 
     def hasVector(self,datatype):
@@ -172,6 +193,8 @@ class A32(FFT):
            return([5,4,3,2])
         if datatype == "q31":
            return([5,4,3,2])
+        if datatype == "q7":
+           return([5,4,3,2])
         ## Short radixes for vectorization
         return([5,4,3,2])
 
@@ -185,6 +208,8 @@ class R8(M4):
            return([5,4,3,2])
         if datatype == "q31":
            return([5,4,3,2])
+        if datatype == "q7":
+           return([5,4,3,2])
 
         if nb <= 256:
            return([5,4,3,2])
@@ -200,6 +225,8 @@ class R52(A32):
            return([5,4,3,2])
         if datatype == "q31":
            return([5,4,3,2])
+        if datatype == "q7":
+           return([5,4,3,2])
 
         return([8,5,4,3,2])
 
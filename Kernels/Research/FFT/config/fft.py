@@ -386,8 +386,31 @@ def getCtype(t):
         return("Q7")
     return("void")
 
+# Size in bytes of a datatype
+def getCtypeSize(t):
+    if t == 'f64':
+        return(8)
+    if t in ['f32','q31']:
+        return(4)
+    if t in ['f16','q15']:
+        return(2)
+    return(1)
+
+# Size in bytes of a structure on a 32-bit target.
+# fields is the list of the sizes of the fields (the alignment
+# of a field is its size).
+def structSize(fields):
+    size = 0
+    align = 1
+    for f in fields:
+        size = (size + f - 1) // f * f + f
+        align = max(align,f)
+    return((size + align - 1) // align * align)
+
 # Configuration structures for CFFT and RFFT
-cfftconfig = """cfftconfig<%s> config%d={
+# (elements of the array of configurations of a datatype)
+cfftconfig = """   /* Length %d */
+   {
    .normalization=%s,
    .nbPerms=%s,
    .perms=perm%d,
@@ -399,12 +422,13 @@ cfftconfig = """cfftconfig<%s> config%d={
    .lengths=lengths%d,
    .format=%d,
    .reversalVectorizable=%d
-   };"""
+   },"""
 
-rfftconfig = """rfftconfig<%s> config%d={
+rfftconfig = """   /* Length %d */
+   {
    .nbTwiddle=%s,
    .twiddle=twiddle%d
-   };"""
+   },"""
 
 fftconfigHeader = """extern %sconfig<%s> config%d;"""
 
@@ -464,6 +488,16 @@ class Perm:
     def nbFactors(self):
         return(len(self._factors))
 
+    # Size in bytes of the permutation table
+    @property
+    def permBytes(self):
+        return(2*len(self.perms))
+
+    # Size in bytes of the factor and length tables
+    @property
+    def factorBytes(self):
+        return(2*len(self._groupedFactors) + 2*len(self._lens))
+
     def writePermHeader(self,h):
         printUInt16ArrayHeader(h,"perm%d" % self.permID,self.perms)
 
@@ -515,6 +549,11 @@ class Twiddle:
         else:
            return(self._nb)
 
+    # Size in bytes of the twiddle table
+    @property
+    def twiddleBytes(self):
+        return(2*self.nbTwiddles*getCtypeSize(self.datatype))
+
     def writeTwidHeader(self,h):
         ctype=getCtype(self.datatype)
         # Twiddle is a complex array so 2*nbSamples must be used
@@ -557,6 +596,15 @@ class Config:
     def nbSamples(self):
         return(self.twiddle.nbSamples)
 
+    # Size in bytes of the configuration structure and
+    # of its entry in the array of lengths
+    @property
+    def configBytes(self):
+        if self.transform == "RFFT":
+            return(structSize([2,4]) + 2)
+        else:
+            return(structSize([getCtypeSize(self.twiddle.datatype),2,4,2,4,2,2,4,4,2,2]) + 2)
+
     def writeConfigHeader(self,c):
         ctype=getCtype(self.twiddle.datatype)
         print(fftconfigHeader % (self.transform.lower(),ctype,self.configID),file=c)
@@ -566,7 +614,7 @@ class Config:
         twiddleLen = "NB_" + ("twiddle%d"% self.twiddle.twiddleID).upper() 
 
         if self.transform == "RFFT":
-            print(rfftconfig % (ctype,self.configID,twiddleLen,self.twiddle.twiddleID),file=c)
+            print(rfftconfig % (self.nbSamples,twiddleLen,self.twiddle.twiddleID),file=c)
         else:
             normfactor = 1.0 / self.twiddle.nbSamples
             normFactorStr = convertToDatatype(normfactor,ctype,self._coreMode)
@@ -581,10 +629,10 @@ class Config:
             # We need to cmpute the final format of the FFT
             # and record it in the initialization structure
             # so that the user can easily know how to recover the
-            # input format (q31, q15). It is encoded as a shift value.
+            # input format (q31, q15, q7). It is encoded as a shift value.
             # The shift to apply to recover the input format
             # But applying this shift will saturate the result in general.
-            if self.twiddle.datatype == "q15" or self.twiddle.datatype == "q31":
+            if self.twiddle.datatype in ["q31","q15","q7"]:
                 for f in self.perms.factors:
                    #print(f,self.twiddle.datatype,self._coreMode)
                    # The file "formats.py" is decribing the format of each radix
@@ -602,7 +650,7 @@ class Config:
             if self.perms.isVectorizable:
                vectorizable = 1 
 
-            print(cfftconfig % (ctype,self.configID,normFactorStr,permsLen,self.perms.permID,
+            print(cfftconfig % (self.nbSamples,normFactorStr,permsLen,self.perms.permID,
                twiddleLen,self.twiddle.twiddleID,self.perms.nbGroupedFactors,self.perms.nbFactors,
                self.perms.permID,self.perms.permID,outputFormat,vectorizable
                ),file=c)
@@ -24,7 +24,9 @@ formats[2]["HELIUM"]={}
 formats[2]["NEON"]={}
 formats[2]["C"]["q31"]=1
 formats[2]["C"]["q15"]=1
+formats[2]["C"]["q7"]=1
 formats[2]["DSP"]["q15"]=1
+formats[2]["DSP"]["q7"]=1
 formats[3]={}
 formats[3]["C"]={}
 formats[3]["DSP"]={}
@@ -32,7 +34,9 @@ formats[3]["HELIUM"]={}
 formats[3]["NEON"]={}
 formats[3]["C"]["q31"]=2
 formats[3]["C"]["q15"]=2
+formats[3]["C"]["q7"]=2
 formats[3]["DSP"]["q15"]=2
+formats[3]["DSP"]["q7"]=2
 formats[4]={}
 formats[4]["C"]={}
 formats[4]["DSP"]={}
@@ -40,7 +44,9 @@ formats[4]["HELIUM"]={}
 formats[4]["NEON"]={}
 formats[4]["C"]["q31"]=2
 formats[4]["C"]["q15"]=2
+formats[4]["C"]["q7"]=2
 formats[4]["DSP"]["q15"]=2
+formats[4]["DSP"]["q7"]=2
 formats[5]={}
 formats[5]["C"]={}
 formats[5]["DSP"]={}
@@ -48,7 +54,9 @@ formats[5]["HELIUM"]={}
 formats[5]["NEON"]={}
 formats[5]["C"]["q31"]=4
 formats[5]["C"]["q15"]=4
+formats[5]["C"]["q7"]=4
 formats[5]["DSP"]["q15"]=4
+formats[5]["DSP"]["q7"]=4
 formats[6]={}
 formats[6]["C"]={}
 formats[6]["DSP"]={}
@@ -56,7 +64,9 @@ formats[6]["HELIUM"]={}
 formats[6]["NEON"]={}
 formats[6]["C"]["q31"]=3
 formats[6]["C"]["q15"]=3
+formats[6]["C"]["q7"]=3
 formats[6]["DSP"]["q15"]=3
+formats[6]["DSP"]["q7"]=3
 formats[8]={}
 formats[8]["C"]={}
 formats[8]["DSP"]={}
@@ -64,4 +74,6 @@ formats[8]["HELIUM"]={}
 formats[8]["NEON"]={}
 formats[8]["C"]["q31"]=3
 formats[8]["C"]["q15"]=3
+formats[8]["C"]["q7"]=3
 formats[8]["DSP"]["q15"]=3
+formats[8]["DSP"]["q7"]=3
@@ -49,33 +49,39 @@ cheader="""
 #include "%s.h"
 """
 
+# Radix used by the configured lengths of a datatype
+radixUsed="""template<> struct radixused<%s,%d>{ enum { value = 1 }; };"""
 
 
 
 
-cfftconfigFuncStart="""
+
+# Configurations of a transform and datatype are packed in an array
+# sorted by length. The lengths are in a separate sorted array
+# used for a binary search.
+fftconfigArrayStart="""const %sconfig<%s> %sConfigs%s[%d]={"""
+
+fftconfigArrayStop="""};
+"""
+
+fftconfigLengths="""const uint16_t %sLengths%s[%d]={%s};
+"""
+
+cfftconfigFunc="""
 template<>
 const cfftconfig<%s> *cfft_config<%s>(uint32_t nbSamples)
 {
-    switch(nbSamples)
-    {""" 
+    return(fft_config_search(cfftLengths%s,cfftConfigs%s,%d,nbSamples));
+}
+""" 
 
-rfftconfigFuncStart="""
+rfftconfigFunc="""
 template<>
 const rfftconfig<%s> *rfft_config<%s>(uint32_t nbSamples)
 {
-    switch(nbSamples)
-    {""" 
-
-fftconfigFuncStop="""
-    }
-    return(NULL);
+    return(fft_config_search(rfftLengths%s,rfftConfigs%s,%d,nbSamples));
 }
-"""
-
-fftCase="""        case %d:
-            return(&config%d);
-        break;"""
+""" 
 
 #def writeConfig(c,ffts):
 #    print(fftconfigFuncStart, file=c)
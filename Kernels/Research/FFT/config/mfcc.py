@@ -0,0 +1,164 @@
+#
+#
+# Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+from config.fft import *
+
+# Mel scale (HTK convention)
+def frequencyToMel(freq):
+    return(1127.0 * np.log(1.0 + freq / 700.0))
+
+# Triangular mel filters on the nbSamples/2+1 bins of a RFFT.
+# Only the span of nonzero weights of each filter is kept :
+# the first bin, the number of weights and the weights.
+def melFilters(nbSamples,nbMel,sampleRate,fmin,fmax):
+    nbBins = nbSamples // 2 + 1
+    bins = frequencyToMel(np.linspace(0, sampleRate / 2.0, nbBins))
+    mels = np.linspace(frequencyToMel(fmin), frequencyToMel(fmax), nbMel + 2)
+
+    filterPos=[]
+    filterLengths=[]
+    coefs=[]
+    for m in range(nbMel):
+        upper = (bins - mels[m]) / (mels[m+1] - mels[m])
+        lower = (mels[m+2] - bins) / (mels[m+2] - mels[m+1])
+        weights = np.maximum(0.0, np.minimum(upper, lower))
+
+        nonzero = np.nonzero(weights)[0]
+        if len(nonzero) == 0:
+            # Filter too narrow for the frequency resolution
+            filterPos.append(0)
+            filterLengths.append(0)
+        else:
+            start = nonzero[0]
+            stop = nonzero[-1] + 1
+            filterPos.append(start)
+            filterLengths.append(stop - start)
+            coefs += list(weights[start:stop])
+
+    return(np.array(filterPos),np.array(filterLengths),np.array(coefs))
+
+# Orthonormal DCT-II matrix (nbDct rows of nbMel values)
+def dctMatrix(nbDct,nbMel):
+    s = (np.arange(nbMel) + 0.5) / nbMel
+    result = np.zeros((nbDct,nbMel))
+    for k in range(nbDct):
+        result[k,:] = np.cos(k * np.pi * s) * np.sqrt(2.0 / nbMel)
+    result[0,:] = result[0,:] / np.sqrt(2.0)
+    return(result)
+
+# Arrays in the configuration file have their length in the declaration
+# since there is no header defining their size.
+def printSizedArray(f,ctype,name,a):
+    n = a.reshape(a.size)
+
+    print("__ALIGNED(8) const %s %s[%d]={" % (ctype,name,max(len(n),1)),file=f)
+
+    if len(n) == 0:
+        n = np.zeros(1)
+
+    if ctype == "float32_t":
+       printFloat32Array(f,n)
+
+    if ctype == "float16_t":
+       printFloat16Array(f,n)
+
+    print("};\n",file=f)
+
+def printSizedUInt16Array(f,name,a):
+    print("const uint16_t %s[%d]={%s};\n" % (name,len(a),joinStr([str(x) for x in a])),file=f)
+
+mfccconfig = """mfccconfig<%s> mfccconfig%d={
+   .fftLen=%d,
+   .nbMel=%d,
+   .nbDct=%d,
+   .filterPos=mfccFilterPos%d,
+   .filterLengths=mfccFilterLengths%d,
+   .filterCoefs=mfccFilterCoefs%d,
+   .dct=mfccDct%d
+   };
+"""
+
+mfccconfigFuncStart="""
+template<>
+const mfccconfig<%s> *mfcc_config<%s>(uint32_t fftLen,uint32_t nbMel,uint32_t nbDct)
+{"""
+
+mfccCase="""    if ((fftLen == %d) && (nbMel == %d) && (nbDct == %d))
+    {
+        return(&mfccconfig%d);
+    }"""
+
+mfccconfigFuncStop="""    return(NULL);
+}
+"""
+
+# Description of a MFCC configuration :
+# [fftLen, nbMel, nbDct, sampleRate, fmin, fmax]
+class Mfcc:
+    MfccID = 0
+
+    def __init__(self,datatype,desc):
+        Mfcc.MfccID = Mfcc.MfccID + 1
+        self._id = Mfcc.MfccID
+        self._datatype = datatype
+        self._nbSamples,self._nbMel,self._nbDct = desc[0],desc[1],desc[2]
+        self._sampleRate,self._fmin,self._fmax = desc[3],desc[4],desc[5]
+
+    @property
+    def mfccID(self):
+        return(self._id)
+
+    @property
+    def datatype(self):
+        return(self._datatype)
+
+    @property
+    def nbSamples(self):
+        return(self._nbSamples)
+
+    @property
+    def nbMel(self):
+        return(self._nbMel)
+
+    @property
+    def nbDct(self):
+        return(self._nbDct)
+
+    # Size in bytes of the mel filters and DCT tables
+    @property
+    def tableBytes(self):
+        pos,lengths,coefs=melFilters(self.nbSamples,self.nbMel,self._sampleRate,self._fmin,self._fmax)
+        return(2*len(pos) + 2*len(lengths) + getCtypeSize(self.datatype)*(len(coefs) + self.nbDct*self.nbMel))
+
+    def writeMfccCode(self,c):
+        ctype=getCtype(self.datatype)
+        pos,lengths,coefs=melFilters(self.nbSamples,self.nbMel,self._sampleRate,self._fmin,self._fmax)
+        dct=dctMatrix(self.nbDct,self.nbMel)
+
+        printSizedUInt16Array(c,"mfccFilterPos%d" % self.mfccID,pos)
+        printSizedUInt16Array(c,"mfccFilterLengths%d" % self.mfccID,lengths)
+        printSizedArray(c,ctype,"mfccFilterCoefs%d" % self.mfccID,coefs)
+        printSizedArray(c,ctype,"mfccDct%d" % self.mfccID,dct)
+
+        print(mfccconfig % (ctype,self.mfccID,self.nbSamples,self.nbMel,self.nbDct,
+            self.mfccID,self.mfccID,self.mfccID,self.mfccID),file=c)
+
+    def writeMfccCase(self,c):
+        print(mfccCase % (self.nbSamples,self.nbMel,self.nbDct,self.mfccID),file=c)
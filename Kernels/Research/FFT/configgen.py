@@ -23,6 +23,8 @@ import numpy as np
 from sympy.combinatorics import Permutation
 from config.fft import *
 from config.core import *
+from config.mfcc import *
+from config.channelizer import *
 import config.io as io
 import yaml
 
@@ -33,6 +35,8 @@ parser.add_argument('-twid', nargs='?',type = str, default="twiddle", help="Name
 parser.add_argument('-perm', nargs='?',type = str, default="perm", help="Name of permutation file")
 parser.add_argument('-config', nargs='?',type = str, default="config", help="Name of configuration file")
 parser.add_argument('-mode', nargs='?',type = str, default="mode", help="Name of mode configuration file (DSPE, C ...)")
+parser.add_argument('-kernels', nargs='?',type = str, default="kernels", help="Name of radix kernels selection file")
+parser.add_argument('-footprint', nargs='?',type = str, default="footprint", help="Name of footprint report")
 parser.add_argument('-r', nargs='?',type = str, default=".", help="Root folder")
 
 
@@ -63,6 +67,9 @@ class ConfigDescription:
         self._core=core 
         # List of all radix used to avoid compiling all radixes in the C++ code later
         self._radixUsed=set([])
+        # Radix used by the lengths of each datatype to only compile
+        # the radix kernels needed by a datatype
+        self._radixForDatatype={}
         # List of all datatype used to avoid compiling all datatype versions in
         # the C++ later
         self._datatypeUsed=set([])
@@ -70,6 +77,16 @@ class ConfigDescription:
         # Configurations for size and datype
         self._configs={}
 
+        # MFCC configurations for datatype
+        self._mfccs={}
+
+        # Channelizer configurations for datatype
+        self._channelizers={}
+
+        # Transforms with a q31mix version (Q31 samples and
+        # Q15 twiddles using the q15 configurations)
+        self._mixed=set([])
+
     @property 
     def core(self):
         return(self._core)
@@ -95,6 +112,10 @@ class ConfigDescription:
     def addUsedDatatype(self,datatype):
         self._datatypeUsed.add(datatype)
 
+    # Record that the q31mix version of a transform is used
+    def addMixed(self,transform):
+        self._mixed.add(transform)
+
     # Add factors of a FFT length to identify the used radixes
     # (Factors are only expressed with the supported radixes)
     def addUsedFactor(self,factors):
@@ -107,6 +128,10 @@ class ConfigDescription:
     # Add factors and permutations for a given FFT length and datatype
     def addFactors(self,selectedCore,nb,datatype):
         factors=Perm.getFactors(selectedCore,nb,datatype)
+        if not (datatype in self._radixForDatatype):
+           self._radixForDatatype[datatype]=set([])
+        self._radixForDatatype[datatype].update(factors)
+
         if not tuple(factors) in self._perms:
            perm=Perm(selectedCore,nb,datatype)
            self._perms[tuple(factors)]=perm
@@ -146,6 +171,18 @@ class ConfigDescription:
         self.configs[transform][datatype] = {} 
         self.configs[transform][datatype][nb] = newConf
 
+    # Add a MFCC configuration (mel filters and DCT) for a datatype
+    def addMfcc(self,datatype,desc):
+        if not (datatype in self._mfccs):
+           self._mfccs[datatype] = []
+        self._mfccs[datatype].append(Mfcc(datatype,desc))
+
+    # Add a channelizer configuration (prototype filter) for a datatype
+    def addChannelizer(self,datatype,desc):
+        if not (datatype in self._channelizers):
+           self._channelizers[datatype] = []
+        self._channelizers[datatype].append(Channelizer(datatype,desc))
+
     # Write the twiddle files
     # All the twidlle arrays and their headers
     def writeTwiddle(self):
@@ -198,26 +235,28 @@ class ConfigDescription:
 
 
     # Write the configurations structures
-    def writeConfigStructs(self,c,ctype,transform,confs):
-        for nb in confs:
+    # (array of configurations sorted by length and array of lengths)
+    def writeConfigStructs(self,c,ctype,datatype,transform,confs):
+        sortedConfs=sorted(confs.keys())
+        name=transform.lower()
+        suffix=datatype.upper()
+
+        print(io.fftconfigArrayStart % (name,ctype,name,suffix,len(sortedConfs)),file=c)
+        for nb in sortedConfs:
             conf=confs[nb]
             conf.writeConfigCode(c)
+        print(io.fftconfigArrayStop,file=c)
 
-            
+        print(io.fftconfigLengths % (name,suffix,len(sortedConfs),joinStr([str(x) for x in sortedConfs])),file=c)
 
     # Write the initialization code
-    # (The switch/case to select  configuration based upon the transform length)
-    def writeConfigCode(self,c,ctype,transform,confs):
+    # (binary search of the configuration based upon the transform length)
+    def writeConfigCode(self,c,ctype,datatype,transform,confs):
+        suffix=datatype.upper()
         if (transform == "CFFT"):
-            print(io.cfftconfigFuncStart % (ctype,ctype),file=c)
+            print(io.cfftconfigFunc % (ctype,ctype,suffix,suffix,len(confs)),file=c)
         else:
-            print(io.rfftconfigFuncStart % (ctype,ctype),file=c)
-        sortedConfs=sorted(confs.keys())
-        for nb in sortedConfs:
-            conf=confs[nb]
-            print(io.fftCase % (nb,conf.configID), file=c)
-
-        print(io.fftconfigFuncStop,file=c)
+            print(io.rfftconfigFunc % (ctype,ctype,suffix,suffix,len(confs)),file=c)
 
     # Add header to rfft or cfft for a given datatype.
     # It is a reference to the temple to avoid instantiating the template twice.
@@ -238,6 +277,61 @@ class ConfigDescription:
         if ctype == "float16_t":
             print("#endif\n",file=h) 
 
+    # Write the mel filters, the DCT and the configuration structures
+    # of the MFCC and the function selecting a MFCC configuration.
+    def writeMfccCode(self,c,ctype,mfccs):
+        for m in mfccs:
+            m.writeMfccCode(c)
+
+        print(mfccconfigFuncStart % (ctype,ctype),file=c)
+        for m in mfccs:
+            m.writeMfccCase(c)
+        print(mfccconfigFuncStop,file=c)
+
+    def addMfccDatatypeHeader(self,datatype,h):
+        print("\n#define FUNC_MFCC_%s\n" % datatype.upper(),file=h)
+
+        ctype=getCtype(datatype)
+        if ctype == "float16_t":
+             print("#if defined(ARM_FLOAT16_SUPPORTED)",file=h) 
+
+        print("extern template const mfccconfig<%s> *mfcc_config<%s>(uint32_t fftLen,uint32_t nbMel,uint32_t nbDct);" % 
+              (ctype,ctype),file=h)
+
+        if ctype == "float16_t":
+            print("#endif\n",file=h) 
+
+    # Write the prototype filters and the configuration structures
+    # of the channelizers and the function selecting a configuration.
+    def writeChannelizerCode(self,c,ctype,channelizers):
+        for m in channelizers:
+            m.writeChannelizerCode(c)
+
+        print(channelizerconfigFuncStart % (ctype,ctype),file=c)
+        for m in channelizers:
+            m.writeChannelizerCase(c)
+        print(channelizerconfigFuncStop,file=c)
+
+    def addChannelizerDatatypeHeader(self,datatype,h):
+        print("\n#define FUNC_CHANNELIZER_%s\n" % datatype.upper(),file=h)
+
+        ctype=getCtype(datatype)
+        if ctype == "float16_t":
+             print("#if defined(ARM_FLOAT16_SUPPORTED)",file=h) 
+
+        print("extern template const channelizerconfig<%s> *channelizer_config<%s>(uint32_t nbChannels,uint32_t nbTaps);" % 
+              (ctype,ctype),file=h)
+
+        if ctype == "float16_t":
+            print("#endif\n",file=h) 
+
+    # Bit mask of the radix used by the lengths of a datatype
+    def radixMask(self,datatype):
+        mask = 0
+        for radix in self._radixForDatatype.get(datatype,set([])):
+            mask = mask | (1 << radix)
+        return(mask)
+
     # Write configurations headers and configuration code.
     # Define the scalar mode (C or DSPE), the datatypes
     # The vector mode, the vector archi (Helium or Neon)
@@ -256,7 +350,7 @@ class ConfigDescription:
 
           hasAnyVector = False
 
-          for datatype in self._datatypeUsed:
+          for datatype in sorted(self._datatypeUsed):
                 
                 if self.coreMode(datatype)=="DSP":
                    print("#define DSPE_%s 1\n" % datatype.upper(),file=h)
@@ -265,6 +359,11 @@ class ConfigDescription:
                    print("#define VECTOR_%s 1\n" % datatype.upper(),file=h)
                    hasAnyVector = True
 
+          # The DSP Q7 kernels are using the DSP Q15 complex for the products
+          dspQ15 = ("q15" in self._datatypeUsed) and (self.coreMode("q15")=="DSP")
+          if ("q7" in self._datatypeUsed) and (self.coreMode("q7")=="DSP") and not dspQ15:
+                print("#define DSPE_Q15 1\n",file=h)
+
           if hasAnyVector:
                 print("#define HASVECTOR 1\n",file=h)
                 if self.vectorArchi(datatype)=="Helium":
@@ -280,10 +379,22 @@ class ConfigDescription:
 
             
             print("",file=h)
-            for radix in self._radixUsed:
+            for radix in sorted(self._radixUsed):
                 print("#define RADIX%d\n" % radix,file=h)
-            for datatype in self._datatypeUsed:
+            datatypes=set(self._datatypeUsed)
+            # The f32 radix are used by the f16 mixed precision FFTs
+            if "f16" in datatypes:
+                datatypes.add("f32")
+            # The q31 radix are used by the q31mix FFTs
+            if self._mixed:
+                datatypes.add("q31")
+            for datatype in sorted(datatypes):
                 print("#define DATATYPE_%s\n" % datatype.upper(),file=h)
+
+            # Radix used by the lengths of each datatype. fft.cpp checks
+            # it against the radixused specializations of kernels.h
+            for datatype in sorted(datatypes):
+                print("#define RADIX_MASK_%s 0x%03x\n" % (datatype.upper(),self.radixMask(datatype)),file=h)
               
 
             print(io.hfooter % ("CONFIG_H"),file=h)
@@ -301,6 +412,15 @@ class ConfigDescription:
 
                     self.addTransformDatatypeHeader(transform,datatype,h)
 
+            for transform in sorted(self._mixed):
+                print("\n#define FUNC_%s_Q31MIX\n" % transform,file=h)
+
+            for datatype in self._mfccs:
+                self.addMfccDatatypeHeader(datatype,h)
+
+            for datatype in self._channelizers:
+                self.addChannelizerDatatypeHeader(datatype,h)
+
             print(io.hfooter % ("CONFIG_FUNC_H"),file=h)
 
         with open(cpath,"w") as c:
@@ -308,6 +428,12 @@ class ConfigDescription:
             print("#include \"perm.h\"",file=c)
             print("#include \"twiddle.h\"\n",file=c)
 
+            # The factors below must have been generated with config.h
+            for datatype in sorted(datatypes):
+                print("#if RADIX_MASK_%s != 0x%03x" % (datatype.upper(),self.radixMask(datatype)),file=c)
+                print("#error \"Generated/config.h does not match Generated/config.cpp : run configgen.py again\"",file=c)
+                print("#endif\n",file=c)
+
     
             # Write factors arrays used in several config
             for p in self._perms:
@@ -320,19 +446,141 @@ class ConfigDescription:
                     if ctype == "float16_t":
                          print("#if defined(ARM_FLOAT16_SUPPORTED)",file=c) 
 
-                    self.writeConfigStructs(c,ctype,transform,self.configs[transform][datatype])
-                    self.writeConfigCode(c,ctype,transform,self.configs[transform][datatype])
+                    self.writeConfigStructs(c,ctype,datatype,transform,self.configs[transform][datatype])
+                    self.writeConfigCode(c,ctype,datatype,transform,self.configs[transform][datatype])
     
                     if ctype == "float16_t":
                         print("#endif\n",file=c) 
 
+            for datatype in self._mfccs:
+                ctype=getCtype(datatype)
+                if ctype == "float16_t":
+                     print("#if defined(ARM_FLOAT16_SUPPORTED)",file=c) 
+
+                self.writeMfccCode(c,ctype,self._mfccs[datatype])
+
+                if ctype == "float16_t":
+                    print("#endif\n",file=c) 
+
+            for datatype in self._channelizers:
+                ctype=getCtype(datatype)
+                if ctype == "float16_t":
+                     print("#if defined(ARM_FLOAT16_SUPPORTED)",file=c) 
+
+                self.writeChannelizerCode(c,ctype,self._channelizers[datatype])
+
+                if ctype == "float16_t":
+                    print("#endif\n",file=c) 
+
             print("",file=c)
 
+    # Write the header selecting the radix kernels : the radix
+    # specializations and the cases of factorSwitch not used by
+    # the lengths of a datatype are not compiled.
+    def writeKernels(self):
+        headerpath=os.path.join(args.d,args.kernels) + ".h"
+
+        # Kernels included for each datatype.
+        # The f32 radix are used by the f16 mixed precision FFTs
+        # and the q31 radix by the q31mix FFTs (q15 lengths)
+        kernels={}
+        for datatype in self._radixForDatatype:
+            kernels[datatype]=set(self._radixForDatatype[datatype])
+        if "f16" in self._radixForDatatype:
+            kernels["f32"]=kernels.get("f32",set([])) | self._radixForDatatype["f16"]
+        if self._mixed and ("q15" in self._radixForDatatype):
+            kernels["q31"]=kernels.get("q31",set([])) | self._radixForDatatype["q15"]
+
+        with open(headerpath,"w") as h:
+            print(io.hheader % ("KERNELS_H","KERNELS_H"),file=h)
+
+            for datatype in sorted(kernels):
+                for radix in sorted(kernels[datatype]):
+                    print("#define RADIX_%s_%d" % (datatype.upper(),radix),file=h)
+                print("",file=h)
+
+            for datatype in sorted(self._radixForDatatype):
+                ctype=getCtype(datatype)
+                if ctype == "float16_t":
+                     print("#if defined(ARM_FLOAT16_SUPPORTED)",file=h)
+                for radix in sorted(self._radixForDatatype[datatype]):
+                    print(io.radixUsed % (ctype,radix),file=h)
+                if ctype == "float16_t":
+                     print("#endif",file=h)
+                print("",file=h)
+
+            print(io.hfooter % ("KERNELS_H"),file=h)
+
+    # Write the footprint report : bytes of the tables and
+    # configuration structures for each length and datatype
+    # (32-bit target).
+    # A permutation or factor table shared by several lengths
+    # is only counted once in the totals.
+    def writeFootprint(self):
+        path=os.path.join(args.d,args.footprint) + ".txt"
+        permUsers={}
+        for transform in self.configs:
+            for datatype in self.configs[transform]:
+                for nb in self.configs[transform][datatype]:
+                    conf=self.configs[transform][datatype][nb]
+                    if conf.perms:
+                       permUsers[conf.perms.permID]=permUsers.get(conf.perms.permID,0) + 1
+
+        totalTwiddles=0
+        totalPerms=0
+        totalFactors=0
+        totalConfigs=0
+        counted=set([])
+        with open(path,"w") as f:
+            print("Footprint of the configuration (bytes, 32-bit target)\n",file=f)
+            print("%-12s %-9s %7s %9s %7s %8s %7s" % ("Transform","Datatype","Length","Twiddles","Perms","Factors","Config"),file=f)
+            for transform in self.configs:
+                for datatype in self.configs[transform]:
+                    for nb in sorted(self.configs[transform][datatype]):
+                        conf=self.configs[transform][datatype][nb]
+                        twiddleBytes=conf.twiddle.twiddleBytes
+                        permBytes=0
+                        factorBytes=0
+                        shared=""
+                        if conf.perms:
+                           permBytes=conf.perms.permBytes
+                           factorBytes=conf.perms.factorBytes
+                           if permUsers[conf.perms.permID] > 1:
+                              shared="*"
+                           if not (conf.perms.permID in counted):
+                              counted.add(conf.perms.permID)
+                              totalPerms += permBytes
+                              totalFactors += factorBytes
+                        totalTwiddles += twiddleBytes
+                        totalConfigs += conf.configBytes
+                        print("%-12s %-9s %7d %9d %7s %8s %7d" % (transform,datatype,nb,twiddleBytes,
+                              "%d%s" % (permBytes,shared),"%d%s" % (factorBytes,shared),conf.configBytes),file=f)
+
+            totalMfcc=sum([m.tableBytes for d in self._mfccs for m in self._mfccs[d]])
+            totalChannelizer=sum([c.tableBytes for d in self._channelizers for c in self._channelizers[d]])
+
+            print("\n(*) Shared with other lengths or datatypes\n",file=f)
+            print("Twiddles     : %d" % totalTwiddles,file=f)
+            print("Permutations : %d" % totalPerms,file=f)
+            print("Factors      : %d" % totalFactors,file=f)
+            print("Configs      : %d" % totalConfigs,file=f)
+            if totalMfcc > 0:
+               print("MFCC         : %d" % totalMfcc,file=f)
+            if totalChannelizer > 0:
+               print("Channelizer  : %d" % totalChannelizer,file=f)
+            print("Total        : %d\n" % (totalTwiddles + totalPerms + totalFactors + totalConfigs + totalMfcc + totalChannelizer),file=f)
+
+            print("Radix used by the lengths of each datatype",file=f)
+            for datatype in sorted(self._radixForDatatype):
+                print("%-4s : %s" % (datatype,joinStr([str(x) for x in sorted(self._radixForDatatype[datatype])])),file=f)
+
     # Generate the twiddle, permutation and configuration files.
     def generate(self):
         self.writeTwiddle()
         self.writePerms() 
         self.writeConfigs()
+        self.writeKernels()
+        self.writeFootprint()
 
 # When a RFFT is defined in the yaml file, it will require
 # some CFFT to be defined.
@@ -351,7 +599,41 @@ def addCFFTForRFFT(configfile,core):
              if not (datatype in cfft):
                cfft[datatype] = {}
    
-             cfft[datatype]= list(set(cfft[datatype]) | set(cfftLengths))
+             cfft[datatype]= sorted(set(cfft[datatype]) | set(cfftLengths))
+
+# A MFCC is computed from a RFFT.
+# The RFFT do not have to be written in the yaml file.
+# They are implied by the MFCC settings.
+# It must be called before addCFFTForRFFT.
+def addRFFTForMFCC(configfile,core):
+  if ("MFCC" in configfile[core]) and not ("RFFT" in configfile[core]):
+       configfile[core]["RFFT"] = {}
+  for transform,transformData in configfile[core].items():
+      if transform == "MFCC":
+         for datatype,mfccs in transformData.items():
+             rfftLengths=[x[0] for x in mfccs]
+
+             rfft=configfile[core]["RFFT"]
+             if not (datatype in rfft):
+               rfft[datatype] = {}
+
+             rfft[datatype]= sorted(set(rfft[datatype]) | set(rfftLengths))
+
+# A channelizer with M channels is using a CFFT of length M.
+# The CFFT do not have to be written in the yaml file.
+def addCFFTForChannelizer(configfile,core):
+  if ("CHANNELIZER" in configfile[core]) and not ("CFFT" in configfile[core]):
+       configfile[core]["CFFT"] = {}
+  for transform,transformData in configfile[core].items():
+      if transform == "CHANNELIZER":
+         for datatype,channelizers in transformData.items():
+             cfftLengths=[x[0] for x in channelizers]
+
+             cfft=configfile[core]["CFFT"]
+             if not (datatype in cfft):
+               cfft[datatype] = {}
+
+             cfft[datatype]= sorted(set(cfft[datatype]) | set(cfftLengths))
 
 # A CFFT2D of size nxm is implifying CFFT od size n and m
 # With this function, those CFFT do not have to be written in
@@ -370,8 +652,42 @@ def addCFFTForCFFT2D(configfile,core):
              if not (datatype in cfft):
                cfft[datatype] = {}
    
-             cfft[datatype]= list(set(cfft[datatype]) | set(cfftLengthRows) | set(cfftLengthCols))
+             cfft[datatype]= sorted(set(cfft[datatype]) | set(cfftLengthRows) | set(cfftLengthCols))
      
+# A CFFT3D of size dxnxm is implying CFFT of size d, n and m
+def addCFFTForCFFT3D(configfile,core):
+  if ("CFFT3D" in configfile[core]) and not ("CFFT" in configfile[core]):
+       configfile[core]["CFFT"] = {}
+  for transform,transformData in configfile[core].items():
+      if transform == "CFFT3D":
+         for datatype,datatypeLengths in transformData.items():
+             cfftLengths=[y for x in datatypeLengths for y in x]
+
+             cfft=configfile[core]["CFFT"]
+             if not (datatype in cfft):
+               cfft[datatype] = {}
+
+             cfft[datatype]= sorted(set(cfft[datatype]) | set(cfftLengths))
+
+# The q31mix FFTs (Q31 samples and Q15 twiddles) are using the q15
+# configurations : the q31mix lengths are added to the q15 ones.
+# A q31mix RFFT is using a q31mix CFFT of half the length.
+# It must be called before addCFFTForRFFT.
+def addQ15ForQ31Mix(configfile,core,config):
+  for transform in ["CFFT","RFFT"]:
+      if (transform in configfile[core]) and ("q31mix" in configfile[core][transform]):
+         transformData=configfile[core][transform]
+         mixedLengths=transformData.pop("q31mix")
+
+         if not ("q15" in transformData):
+           transformData["q15"] = []
+
+         transformData["q15"]= sorted(set(transformData["q15"]) | set(mixedLengths))
+
+         config.addMixed(transform)
+         if transform == "RFFT":
+            config.addMixed("CFFT")
+
 # Known cores defined in fft.py
 KNOWNCORES=['M0','M4','M7','M33','M55','M55NOMVE','A32','R8','R52']
 
@@ -380,7 +696,13 @@ KNOWNCORES=['M0','M4','M7','M33','M55','M55NOMVE','A32','R8','R52']
 KNOWNTYPES=['f64','f32','f16','q31','q15','q7']
 
 # Known transforms.
-KNOWNTRANSFORMS=['CFFT','RFFT','CFFT2D']
+KNOWNTRANSFORMS=['CFFT','RFFT','CFFT2D','CFFT3D','MFCC','CHANNELIZER']
+
+# Datatypes supported by the MFCC
+MFCCTYPES=['f32','f16']
+
+# Datatypes supported by the channelizer
+CHANNELIZERTYPES=['f32','f16']
 
 # Parsing of the YAML configuration file.
 cores=list(configfile.keys())
@@ -425,18 +747,41 @@ else:
            # configurations for this code
            config=ConfigDescription(selectedCore)
            
-           # Add missing CFFT for RFFT and CFFT2D
+           # Add missing CFFT for RFFT, CFFT2D and CFFT3D
            # Like that other steps don't have to do anything special
            # to manage those CFTT.
+           addRFFTForMFCC(configfile,core)
+           addQ15ForQ31Mix(configfile,core,config)
            addCFFTForRFFT(configfile,core) 
            addCFFTForCFFT2D(configfile,core)
+           addCFFTForCFFT3D(configfile,core)
+           addCFFTForChannelizer(configfile,core)
 
            # Iterate of the transform (CFFT, RFFT, CFFT2D)
            for transform,transformData in configfile[core].items():
-               # CFFT2D are transformed into 2 CFFT so already taken into account
+               # CFFT2D and CFFT3D are transformed into CFFT so already taken into account
                # So we don't process the CFF2D.
                # Only RFFT (they have a special config) and CFFT
-               if transform in KNOWNTRANSFORMS and (transform != "CFFT2D") :
+               # MFCC are only adding their mel filters and DCT
+               if transform == "MFCC":
+                   print("  TRANSFORM = %s" %transform);
+                   for datatype,mfccs in transformData.items():
+                       if datatype in MFCCTYPES:
+                           print("    DATATYPE = %s" % datatype)
+                           for desc in mfccs:
+                               config.addMfcc(datatype,desc)
+                       else:
+                           print("%s is an unsupported datatype for MFCC" % datatype)
+               elif transform == "CHANNELIZER":
+                   print("  TRANSFORM = %s" %transform);
+                   for datatype,channelizers in transformData.items():
+                       if datatype in CHANNELIZERTYPES:
+                           print("    DATATYPE = %s" % datatype)
+                           for desc in channelizers:
+                               config.addChannelizer(datatype,desc)
+                       else:
+                           print("%s is an unsupported datatype for the channelizer" % datatype)
+               elif transform in KNOWNTRANSFORMS and not (transform in ["CFFT2D","CFFT3D"]) :
                    print("  TRANSFORM = %s" %transform);
                    # Parse all datatypes for the current transform
                    for datatype,datatypeLengths in transformData.items():
@@ -469,7 +814,7 @@ else:
                        else:
                            print("%s is an unsupported datatype" % datatype)
                else:
-                  if transform != "CFFT2D":
+                  if not (transform in ["CFFT2D","CFFT3D"]):
                      print("%s is an unsupported transform" % transform)
        else:
           print("%s is an unsupported core. You may customize this script and core.py to add it" % core)  